@@ -18,6 +18,8 @@
 */
 
 #include "fmb2d.h"
+#include "sat.h"
+#include "frameinternal.h"
 
 // ------------- Macros -------------
 
@@ -30,7 +32,46 @@
 #define FST_VAR 0
 #define SND_VAR 1
 
-#define EPSILON 0.0000001
+#define EPSILON FMB_EPSILON
+
+// Number of Frames projected at once by the batch intersection test
+#define FMB_BATCH_CHUNK 32
+
+// Number of rows of the system and of its successive eliminations for
+// each pair of types (C for Cuboid, T for Tetrahedron, that first).
+// The number of rows of the system is exact. The number of rows after
+// the first elimination is its maximum, given by the pattern of signs
+// of the constraints on tho. The number of rows after the following
+// eliminations is the minimum of the maximum given by the pattern of
+// signs and the value which has proven to be sufficient during tests,
+// validation and qualification (the maximum being much larger than
+// what is actually reached)
+#define FMB2D_NB_ROWS_CC 8
+#define FMB2D_NB_ROWS_P_CC 11
+#define FMB2D_NB_ROWS_CT 7
+#define FMB2D_NB_ROWS_P_CT 10
+#define FMB2D_NB_ROWS_TC 7
+#define FMB2D_NB_ROWS_P_TC 8
+#define FMB2D_NB_ROWS_TT 6
+#define FMB2D_NB_ROWS_P_TT 7
+
+// Default axes used as filters by the hybrid intersection test
+#ifndef FMB2D_HYBRID_AXES
+  #define FMB2D_HYBRID_AXES FMB_HYBRID_AXES_ALL
+#endif
+
+// ------------- Global variables -------------
+
+// Axes currently used as filters by the hybrid intersection test,
+// atomic as they may be changed while other threads are running it
+static _Atomic unsigned int fmbHybridAxes2D = FMB2D_HYBRID_AXES;
+
+// Statistics of the elimination, cf FMB_ELIM_STATS, accumulated per
+// thread (cf FrameStats)
+FRAME_STATS_DEFINE(
+  FMBElimStats,
+  fmbElimStats2D,
+  FMBElimStatsMerge)
 
 // ------------- Functions declaration -------------
 
@@ -40,13 +81,13 @@
 // the resulting system in nbRemainRows
 // Return false if the system becomes inconsistent during elimination,
 // else return true
-bool ElimVar2D(
-  const double (*M)[2],
-  const double* Y,
+static bool ElimVar2D(
+  const FMB_REAL (*M)[2],
+  const FMB_REAL* Y,
   const int nbRows,
   const int nbCols,
-  double (*Mp)[2],
-  double* Yp,
+  FMB_REAL (*Mp)[2],
+  FMB_REAL* Yp,
   int* const nbRemainRows);
 
 // Get the bounds of the iVar-th variable in the nbRows rows
@@ -56,10 +97,10 @@ bool ElimVar2D(
 // (M arrangement is [iRow][iCol])
 // May return inconsistent values (max < min), which would
 // mean the system has no solution
-void GetBoundLastVar2D(
+static void GetBoundLastVar2D(
   const int iVar,
-  const double (*M)[2],
-  const double* Y,
+  const FMB_REAL (*M)[2],
+  const FMB_REAL* Y,
   const int nbRows,
   AABB2D* const bdgBox);
 
@@ -67,14 +108,133 @@ void GetBoundLastVar2D(
 // system M.X<=Y where the iVar-th variable is on the first column
 // and store them in the iVar-th axis of the AABB bdgBox
 // (M arrangement is [iRow][iCol])
-void GetBoundVar2D(
+static void GetBoundVar2D(
   const int iVar,
-  const double (*M)[2],
-  const double* Y,
+  const FMB_REAL (*M)[2],
+  const FMB_REAL* Y,
   const int nbRows,
   const int nbCols,
   AABB2D* const bdgBox);
 
+// Solve the system of inequalities of the intersection between a
+// Frame of type thatType and the Frame thoProj of type thoType,
+// projection of tho in that's coordinates system, using the buffers
+// M, Y, Mp, Yp...
+// (cf FMBTestIntersection2D)
+static inline bool FMBTestIntersectionSolve2D(
+  const FrameType thatType,
+  const FrameType thoType,
+  const Frame2D* const thoProj,
+  AABB2D* const bdgBox,
+  FMB_REAL (*M)[2],
+  FMB_REAL* Y,
+  FMB_REAL (*Mp)[2],
+  FMB_REAL* Yp) __attribute__((always_inline));
+
+// Kernels testing the intersection for each pair of types, C for
+// Cuboid and T for Tetrahedron, the first letter being the type of
+// that and the second the type of tho
+static bool FMBTestIntersectionProj2DCCGeneric(
+  const Frame2D* const thoProj,
+  AABB2D* const bdgBox);
+static bool FMBTestIntersectionProj2DCTGeneric(
+  const Frame2D* const thoProj,
+  AABB2D* const bdgBox);
+static bool FMBTestIntersectionProj2DTCGeneric(
+  const Frame2D* const thoProj,
+  AABB2D* const bdgBox);
+static bool FMBTestIntersectionProj2DTTGeneric(
+  const Frame2D* const thoProj,
+  AABB2D* const bdgBox);
+
+// Implementations of the kernels for each FrameCPUPath
+FRAME_CPU_VARIANTS(
+  bool,
+  FMBTestIntersectionProj2DCC,
+  (
+    const Frame2D* const thoProj,
+    AABB2D* const bdgBox),
+  (thoProj, bdgBox))
+FRAME_CPU_VARIANTS(
+  bool,
+  FMBTestIntersectionProj2DCT,
+  (
+    const Frame2D* const thoProj,
+    AABB2D* const bdgBox),
+  (thoProj, bdgBox))
+FRAME_CPU_VARIANTS(
+  bool,
+  FMBTestIntersectionProj2DTC,
+  (
+    const Frame2D* const thoProj,
+    AABB2D* const bdgBox),
+  (thoProj, bdgBox))
+FRAME_CPU_VARIANTS(
+  bool,
+  FMBTestIntersectionProj2DTT,
+  (
+    const Frame2D* const thoProj,
+    AABB2D* const bdgBox),
+  (thoProj, bdgBox))
+
+// Dispatch table of the kernels, [FrameCPUPath][thatType][thoType]
+static bool (* const fmbKernels2D[FrameCPUNb][2][2])(
+  const Frame2D* const,
+  AABB2D* const) = {
+
+  {
+
+    {
+      FMBTestIntersectionProj2DCCGeneric,
+      FMBTestIntersectionProj2DCTGeneric},
+    {
+      FMBTestIntersectionProj2DTCGeneric,
+      FMBTestIntersectionProj2DTTGeneric}
+
+  },
+  {
+
+    {
+      FMBTestIntersectionProj2DCCSSE2,
+      FMBTestIntersectionProj2DCTSSE2},
+    {
+      FMBTestIntersectionProj2DTCSSE2,
+      FMBTestIntersectionProj2DTTSSE2}
+
+  },
+  {
+
+    {
+      FMBTestIntersectionProj2DCCAVX2,
+      FMBTestIntersectionProj2DCTAVX2},
+    {
+      FMBTestIntersectionProj2DTCAVX2,
+      FMBTestIntersectionProj2DTTAVX2}
+
+  },
+  {
+
+    {
+      FMBTestIntersectionProj2DCCAVX512,
+      FMBTestIntersectionProj2DCTAVX512},
+    {
+      FMBTestIntersectionProj2DTCAVX512,
+      FMBTestIntersectionProj2DTTAVX512}
+
+  }
+
+};
+
+// Test for intersection between a Frame of type thatType and the
+// Frame thoProj of type thoType, projection of tho in that's
+// coordinates system
+// (cf FMBTestIntersection2D)
+static inline bool FMBTestIntersectionProj2D(
+  const FrameType thatType,
+  const FrameType thoType,
+  const Frame2D* const thoProj,
+  AABB2D* const bdgBox);
+
 // ------------- Functions implementation -------------
 
 // Eliminate the first variable in the system M.X<=Y
@@ -84,13 +244,13 @@ void GetBoundVar2D(
 // (M arrangement is [iRow][iCol])
 // Return true if the system becomes inconsistent during elimination,
 // else return false
-bool ElimVar2D(
-  const double (*M)[2],
-  const double* Y,
+static bool ElimVar2D(
+  const FMB_REAL (*M)[2],
+  const FMB_REAL* Y,
   const int nbRows,
   const int nbCols,
-  double (*Mp)[2],
-  double* Yp,
+  FMB_REAL (*Mp)[2],
+  FMB_REAL* Yp,
   int* const nbRemainRows) {
 
   // Initialize the number of rows in the result system
@@ -104,16 +264,16 @@ bool ElimVar2D(
     ++iRow) {
 
     // Shortcuts
-    const double fabsMIRowIVar = fabs(M[iRow][0]);
+    const FMB_REAL fabsMIRowIVar = fabs(M[iRow][0]);
 
     // If the coefficient for the eliminated variable is not null
     // in this row
     if (fabsMIRowIVar > EPSILON) {
 
       // Shortcuts
-      const double* MiRow = M[iRow];
+      const FMB_REAL* MiRow = M[iRow];
       const int sgnMIRowIVar = sgn(MiRow[0]);
-      const double YIRowDivideByFabsMIRowIVar = Y[iRow] / fabsMIRowIVar;
+      const FMB_REAL YIRowDivideByFabsMIRowIVar = Y[iRow] / fabsMIRowIVar;
 
       // For each following rows
       for (
@@ -128,12 +288,12 @@ bool ElimVar2D(
           fabs(M[jRow][0]) > EPSILON) {
 
           // Shortcuts
-          const double* MjRow = M[jRow];
-          const double fabsMjRow = fabs(MjRow[0]);
+          const FMB_REAL* MjRow = M[jRow];
+          const FMB_REAL fabsMjRow = fabs(MjRow[0]);
 
           // Declare a variable to memorize the sum of the negative
           // coefficients in the row
-          double sumNegCoeff = 0.0;
+          FMB_REAL sumNegCoeff = 0.0;
 
           // Add the sum of the two normed (relative to the eliminated
           // variable) rows into the result system. This actually
@@ -188,14 +348,14 @@ bool ElimVar2D(
     ++iRow) {
 
     // Shortcut
-    const double* MiRow = M[iRow];
+    const FMB_REAL* MiRow = M[iRow];
 
     // If the coefficient of the eliminated variable is null on
     // this row
     if (fabs(MiRow[0]) < EPSILON) {
 
       // Shortcut
-      double* MpnbResRows = Mp[nbResRows];
+      FMB_REAL* MpnbResRows = Mp[nbResRows];
 
       // Copy this row into the result system excluding the eliminated
       // variable
@@ -232,16 +392,16 @@ bool ElimVar2D(
 // (M arrangement is [iRow][iCol])
 // May return inconsistent values (max < min), which would
 // mean the system has no solution
-void GetBoundLastVar2D(
+static void GetBoundLastVar2D(
   const int iVar,
-  const double (*M)[2],
-  const double* Y,
+  const FMB_REAL (*M)[2],
+  const FMB_REAL* Y,
   const int nbRows,
   AABB2D* const bdgBox) {
 
   // Shortcuts
-  double* min = bdgBox->min + iVar;
-  double* max = bdgBox->max + iVar;
+  FMB_REAL* min = bdgBox->min + iVar;
+  FMB_REAL* max = bdgBox->max + iVar;
 
   // Initialize the bounds to their maximum maximum and minimum minimum
   *min = 0.0;
@@ -254,14 +414,14 @@ void GetBoundLastVar2D(
     ++jRow) {
 
     // Shortcut
-    double MjRowiVar = M[jRow][0];
+    FMB_REAL MjRowiVar = M[jRow][0];
 
     // If this row has been reduced to the variable in argument
     // and it has a strictly positive coefficient
     if (MjRowiVar > EPSILON) {
 
       // Get the scaled value of Y for this row
-      double y = Y[jRow] / MjRowiVar;
+      FMB_REAL y = Y[jRow] / MjRowiVar;
 
       // If the value is lower than the current maximum bound
       if (*max > y) {
@@ -276,7 +436,7 @@ void GetBoundLastVar2D(
     } else if (MjRowiVar < -EPSILON) {
 
       // Get the scaled value of Y for this row
-      double y = Y[jRow] / MjRowiVar;
+      FMB_REAL y = Y[jRow] / MjRowiVar;
 
       // If the value is greater than the current minimum bound
       if (*min < y) {
@@ -296,17 +456,17 @@ void GetBoundLastVar2D(
 // system M.X<=Y where the iVar-th variable is on the first column
 // and store them in the iVar-th axis of the AABB bdgBox
 // (M arrangement is [iRow][iCol])
-void GetBoundVar2D(
+static void GetBoundVar2D(
   const int iVar,
-  const double (*M)[2],
-  const double* Y,
+  const FMB_REAL (*M)[2],
+  const FMB_REAL* Y,
   const int nbRows,
   const int nbCols,
   AABB2D* const bdgBox) {
 
   // Shortcuts
-  double* bdgBoxMin = bdgBox->min;
-  double* bdgBoxMax = bdgBox->max;
+  FMB_REAL* bdgBoxMin = bdgBox->min;
+  FMB_REAL* bdgBoxMax = bdgBox->max;
 
   // Initialize the bounds
   bdgBoxMin[iVar] = 0.0;
@@ -319,16 +479,16 @@ void GetBoundVar2D(
     ++iRow) {
 
     // Shortcuts
-    const double* MIRow = M[iRow];
-    double fabsMIRowIVar = fabs(MIRow[0]);
+    const FMB_REAL* MIRow = M[iRow];
+    FMB_REAL fabsMIRowIVar = fabs(MIRow[0]);
 
     // If the coefficient of the first variable on this row is not null
     if (fabsMIRowIVar > EPSILON) {
 
       // Declare two variables to memorize the min and max of the
       // requested variable in this row
-      double min = -1.0 * Y[iRow];
-      double max = Y[iRow];
+      FMB_REAL min = -1.0 * Y[iRow];
+      FMB_REAL max = Y[iRow];
 
       // Loop on columns except the first one which is the one of the
       // requested variable
@@ -371,47 +531,50 @@ void GetBoundVar2D(
 
 }
 
-// Test for intersection between Frame that and Frame tho
-// Return true if the two Frames are intersecting, else false
-// If the Frame are intersecting the AABB of the intersection
-// is stored into bdgBox, else bdgBox is not modified
-// If bdgBox is null, the result AABB is not memorized (to use if
-// unnecessary and want to speed up the algorithm)
-// The resulting AABB may be larger than the smallest possible AABB
-// The resulting AABB of FMBTestIntersection(A,B) may be different
-// of the resulting AABB of FMBTestIntersection(B,A)
-// The resulting AABB is given in tho's local coordinates system
-bool FMBTestIntersection2D(
-  Frame2D* const that,
-  const Frame2D* const tho,
-  AABB2D* const bdgBox) {
-
-  // Get the projection of the Frame tho in Frame that coordinates
-  // system
-  Frame2D thoProj;
-  Frame2DImportFrame(that, tho, &thoProj);
-
-  // Declare two variables to memorize the system to be solved M.X <= Y
-  // (M arrangement is [iRow][iCol])
-  double M[8][2];
-  double Y[8];
+// Solve the system of inequalities of the intersection between a
+// Frame of type thatType and the Frame thoProj of type thoType,
+// projection of tho in that's coordinates system
+// M, Y, Mp, Yp... are the buffers for the system and its successive
+// eliminations, sized by the caller for the pair of types
+// Always inlined, the types being constant in the callers the
+// construction of the system is fully specialized
+// (cf FMBTestIntersection2D)
+static inline bool FMBTestIntersectionSolve2D(
+  const FrameType thatType,
+  const FrameType thoType,
+  const Frame2D* const thoProj,
+  AABB2D* const bdgBox,
+  FMB_REAL (*M)[2],
+  FMB_REAL* Y,
+  FMB_REAL (*Mp)[2],
+  FMB_REAL* Yp) {
 
   // Create the inequality system
   // -sum_iC_j,iX_i<=O_j
-  M[0][0] = -thoProj.comp[0][0];
-  M[0][1] = -thoProj.comp[1][0];
-  Y[0] = thoProj.orig[0];
+  M[0][0] = -thoProj->comp[0][0];
+  M[0][1] = -thoProj->comp[1][0];
+  Y[0] = thoProj->orig[0];
   if (Y[0] < neg(M[0][0]) + neg(M[0][1])) {
 
+    FMB_ELIM_STATS_STAGE(
+      fmbElimStats2DThread(),
+      thatType,
+      thoType,
+      FMBElimStageInit);
     return false;
 
   }
 
-  M[1][0] = -thoProj.comp[0][1];
-  M[1][1] = -thoProj.comp[1][1];
-  Y[1] = thoProj.orig[1];
+  M[1][0] = -thoProj->comp[0][1];
+  M[1][1] = -thoProj->comp[1][1];
+  Y[1] = thoProj->orig[1];
   if (Y[1] < neg(M[1][0]) + neg(M[1][1])) {
 
+    FMB_ELIM_STATS_STAGE(
+      fmbElimStats2DThread(),
+      thatType,
+      thoType,
+      FMBElimStageInit);
     return false;
 
   }
@@ -419,25 +582,35 @@ bool FMBTestIntersection2D(
   // Variable to memorize the nb of rows in the system
   int nbRows = 2;
 
-  if (that->type == FrameCuboid) {
+  if (thatType == FrameCuboid) {
 
     // sum_iC_j,iX_i<=1.0-O_j
-    M[nbRows][0] = thoProj.comp[0][0];
-    M[nbRows][1] = thoProj.comp[1][0];
-    Y[nbRows] = 1.0 - thoProj.orig[0];
+    M[nbRows][0] = thoProj->comp[0][0];
+    M[nbRows][1] = thoProj->comp[1][0];
+    Y[nbRows] = 1.0 - thoProj->orig[0];
     if (Y[nbRows] < neg(M[nbRows][0]) + neg(M[nbRows][1])) {
 
+      FMB_ELIM_STATS_STAGE(
+        fmbElimStats2DThread(),
+        thatType,
+        thoType,
+        FMBElimStageInit);
       return false;
 
     }
 
     ++nbRows;
 
-    M[nbRows][0] = thoProj.comp[0][1];
-    M[nbRows][1] = thoProj.comp[1][1];
-    Y[nbRows] = 1.0 - thoProj.orig[1];
+    M[nbRows][0] = thoProj->comp[0][1];
+    M[nbRows][1] = thoProj->comp[1][1];
+    Y[nbRows] = 1.0 - thoProj->orig[1];
     if (Y[nbRows] < neg(M[nbRows][0]) + neg(M[nbRows][1])) {
 
+      FMB_ELIM_STATS_STAGE(
+        fmbElimStats2DThread(),
+        thatType,
+        thoType,
+        FMBElimStageInit);
       return false;
 
     }
@@ -447,11 +620,16 @@ bool FMBTestIntersection2D(
   } else {
 
     // sum_j(sum_iC_j,iX_i)<=1.0-sum_iO_i
-    M[nbRows][0] = thoProj.comp[0][0] + thoProj.comp[0][1];
-    M[nbRows][1] = thoProj.comp[1][0] + thoProj.comp[1][1];
-    Y[nbRows] = 1.0 - thoProj.orig[0] - thoProj.orig[1];
+    M[nbRows][0] = thoProj->comp[0][0] + thoProj->comp[0][1];
+    M[nbRows][1] = thoProj->comp[1][0] + thoProj->comp[1][1];
+    Y[nbRows] = 1.0 - thoProj->orig[0] - thoProj->orig[1];
     if (Y[nbRows] < neg(M[nbRows][0]) + neg(M[nbRows][1])) {
 
+      FMB_ELIM_STATS_STAGE(
+        fmbElimStats2DThread(),
+        thatType,
+        thoType,
+        FMBElimStageInit);
       return false;
 
     }
@@ -460,7 +638,7 @@ bool FMBTestIntersection2D(
 
   }
 
-  if (tho->type == FrameCuboid) {
+  if (thoType == FrameCuboid) {
 
     // X_i <= 1.0
     M[nbRows][0] = 1.0;
@@ -504,15 +682,8 @@ bool FMBTestIntersection2D(
 
   };
 
-  // Declare variables to eliminate the first variable
-  // The size of the array given in the doc is a majoring value.
-  // Instead I use a smaller value which has proven to be sufficient
-  // during tests, validation and qualification, to avoid running
-  // into the heap limit and to optimize slightly the performance
-  //double Mp[24][2];
-  //double Yp[24];
-  double Mp[11][2];
-  double Yp[11];
+  // Declare a variable to memorize the number of rows of the system
+  // after elimination of the first variable
   int nbRowsP;
 
   // Eliminate the first variable
@@ -530,10 +701,23 @@ bool FMBTestIntersection2D(
   if (inconsistency == true) {
 
     // The two Frames are not in intersection
+    FMB_ELIM_STATS_STAGE(
+      fmbElimStats2DThread(),
+      thatType,
+      thoType,
+      FMBElimStagePass1);
     return false;
 
   }
 
+  // Record the size of the resulting system
+  FMB_ELIM_STATS_ROWS(
+    fmbElimStats2DThread(),
+    thatType,
+    thoType,
+    0,
+    nbRowsP);
+
   // Get the bounds for the remaining second variable
   GetBoundLastVar2D(
     SND_VAR,
@@ -546,6 +730,11 @@ bool FMBTestIntersection2D(
   if (bdgBoxLocal.min[SND_VAR] >= bdgBoxLocal.max[SND_VAR]) {
 
     // The two Frames are not in intersection
+    FMB_ELIM_STATS_STAGE(
+      fmbElimStats2DThread(),
+      thatType,
+      thoType,
+      FMBElimStageBound);
     return false;
 
   // Else, if the bounds are consistent here it means
@@ -569,6 +758,323 @@ bool FMBTestIntersection2D(
   }
 
   // If we've reached here the two Frames are intersecting
+  FMB_ELIM_STATS_STAGE(
+    fmbElimStats2DThread(),
+    thatType,
+    thoType,
+    FMBElimStageInter);
   return true;
 
 }
+
+// Test for intersection between a Cuboid that and the
+// Cuboid thoProj, projection of tho in that's coordinates system
+static bool FMBTestIntersectionProj2DCCGeneric(
+  const Frame2D* const thoProj,
+  AABB2D* const bdgBox) {
+
+  // Declare the buffers of the system and its eliminations, sized for
+  // this pair of types
+  FMB_REAL M[FMB2D_NB_ROWS_CC][2];
+  FMB_REAL Y[FMB2D_NB_ROWS_CC];
+  FMB_REAL Mp[FMB2D_NB_ROWS_P_CC][2];
+  FMB_REAL Yp[FMB2D_NB_ROWS_P_CC];
+
+  // Solve the system
+  return
+    FMBTestIntersectionSolve2D(
+      FrameCuboid,
+      FrameCuboid,
+      thoProj,
+      bdgBox,
+      M,
+      Y,
+      Mp,
+      Yp);
+
+}
+
+// Test for intersection between a Cuboid that and the
+// Tetrahedron thoProj, projection of tho in that's coordinates system
+static bool FMBTestIntersectionProj2DCTGeneric(
+  const Frame2D* const thoProj,
+  AABB2D* const bdgBox) {
+
+  // Declare the buffers of the system and its eliminations, sized for
+  // this pair of types
+  FMB_REAL M[FMB2D_NB_ROWS_CT][2];
+  FMB_REAL Y[FMB2D_NB_ROWS_CT];
+  FMB_REAL Mp[FMB2D_NB_ROWS_P_CT][2];
+  FMB_REAL Yp[FMB2D_NB_ROWS_P_CT];
+
+  // Solve the system
+  return
+    FMBTestIntersectionSolve2D(
+      FrameCuboid,
+      FrameTetrahedron,
+      thoProj,
+      bdgBox,
+      M,
+      Y,
+      Mp,
+      Yp);
+
+}
+
+// Test for intersection between a Tetrahedron that and the
+// Cuboid thoProj, projection of tho in that's coordinates system
+static bool FMBTestIntersectionProj2DTCGeneric(
+  const Frame2D* const thoProj,
+  AABB2D* const bdgBox) {
+
+  // Declare the buffers of the system and its eliminations, sized for
+  // this pair of types
+  FMB_REAL M[FMB2D_NB_ROWS_TC][2];
+  FMB_REAL Y[FMB2D_NB_ROWS_TC];
+  FMB_REAL Mp[FMB2D_NB_ROWS_P_TC][2];
+  FMB_REAL Yp[FMB2D_NB_ROWS_P_TC];
+
+  // Solve the system
+  return
+    FMBTestIntersectionSolve2D(
+      FrameTetrahedron,
+      FrameCuboid,
+      thoProj,
+      bdgBox,
+      M,
+      Y,
+      Mp,
+      Yp);
+
+}
+
+// Test for intersection between a Tetrahedron that and the
+// Tetrahedron thoProj, projection of tho in that's coordinates system
+static bool FMBTestIntersectionProj2DTTGeneric(
+  const Frame2D* const thoProj,
+  AABB2D* const bdgBox) {
+
+  // Declare the buffers of the system and its eliminations, sized for
+  // this pair of types
+  FMB_REAL M[FMB2D_NB_ROWS_TT][2];
+  FMB_REAL Y[FMB2D_NB_ROWS_TT];
+  FMB_REAL Mp[FMB2D_NB_ROWS_P_TT][2];
+  FMB_REAL Yp[FMB2D_NB_ROWS_P_TT];
+
+  // Solve the system
+  return
+    FMBTestIntersectionSolve2D(
+      FrameTetrahedron,
+      FrameTetrahedron,
+      thoProj,
+      bdgBox,
+      M,
+      Y,
+      Mp,
+      Yp);
+
+}
+
+// Test for intersection between a Frame of type thatType and the
+// Frame thoProj of type thoType, projection of tho in that's
+// coordinates system
+// (cf FMBTestIntersection2D)
+static inline bool FMBTestIntersectionProj2D(
+  const FrameType thatType,
+  const FrameType thoType,
+  const Frame2D* const thoProj,
+  AABB2D* const bdgBox) {
+
+  // Call the kernel for this pair of types
+  return
+    fmbKernels2D[FrameGetCPUPath()][thatType][thoType](
+      thoProj,
+      bdgBox);
+
+}
+
+// Get the statistics of the elimination since the last reset
+// (cf frame.h)
+FMBElimStats FMBGetElimStats2D(void) {
+
+  FMBElimStats stats;
+  FrameStatsGet(
+    &fmbElimStats2D,
+    &stats);
+  return stats;
+
+}
+
+// Reset the statistics of the elimination
+void FMBResetElimStats2D(void) {
+
+  FrameStatsReset(&fmbElimStats2D);
+
+}
+
+// Test for intersection between Frame that and Frame tho
+// Return true if the two Frames are intersecting, else false
+// If the Frame are intersecting the AABB of the intersection
+// is stored into bdgBox, else bdgBox is not modified
+// If bdgBox is null, the result AABB is not memorized (to use if
+// unnecessary and want to speed up the algorithm)
+// The resulting AABB may be larger than the smallest possible AABB
+// The resulting AABB of FMBTestIntersection(A,B) may be different
+// of the resulting AABB of FMBTestIntersection(B,A)
+// The resulting AABB is given in tho's local coordinates system
+bool FMBTestIntersection2D(
+  const Frame2D* const that,
+  const Frame2D* const tho,
+  AABB2D* const bdgBox) {
+
+  // Get the projection of the Frame tho in Frame that coordinates
+  // system
+  Frame2D thoProj;
+  Frame2DImportFrame(that, tho, &thoProj);
+
+  // Test for intersection with the projected Frame
+  return
+    FMBTestIntersectionProj2D(
+      that->type,
+      tho->type,
+      &thoProj,
+      bdgBox);
+
+}
+
+// Test for intersection between the Frame that and each of the nbTho
+// Frames in the array thos
+// The result for thos[i] is stored in the i-th bit of the bitset
+// isIntersecting, which must have at least FMBBitsetNbWords(nbTho)
+// words (cf frame.h)
+// If bdgBoxes is not null, the AABB of the intersection with thos[i]
+// is stored into bdgBoxes[i] if the Frames are intersecting, else
+// bdgBoxes[i] is not modified
+// The results are identical to FMBTestIntersection2D(that, thos + i,
+// bdgBoxes + i), but the Frames are projected by chunks sharing the
+// setup of that
+void FMBTestIntersection2DBatch(
+  const Frame2D* const that,
+  const Frame2D* const thos,
+  const int nbTho,
+  unsigned long* const isIntersecting,
+  AABB2D* const bdgBoxes) {
+
+  // Reset the bitset
+  int nbWords = FMBBitsetNbWords(nbTho);
+  for (
+    int iWord = nbWords;
+    iWord--;) {
+
+    isIntersecting[iWord] = 0UL;
+
+  }
+
+  // Shortcut
+  const FrameType thatType = that->type;
+
+  // Declare a variable to memorize the projected Frames of the
+  // current chunk
+  Frame2D thosProj[FMB_BATCH_CHUNK];
+
+  // Loop on chunks of Frames
+  for (
+    int iStart = 0;
+    iStart < nbTho;
+    iStart += FMB_BATCH_CHUNK) {
+
+    // Get the number of Frames in this chunk
+    int nbChunk = nbTho - iStart;
+    if (nbChunk > FMB_BATCH_CHUNK) {
+
+      nbChunk = FMB_BATCH_CHUNK;
+
+    }
+
+    // Project the Frames of the chunk in that's coordinates system
+    Frame2DImportFrames(
+      that,
+      thos + iStart,
+      nbChunk,
+      thosProj);
+
+    // Loop on the projected Frames
+    for (
+      int iChunk = 0;
+      iChunk < nbChunk;
+      ++iChunk) {
+
+      // Test the intersection
+      int iTho = iStart + iChunk;
+      bool isInter =
+        FMBTestIntersectionProj2D(
+          thatType,
+          thosProj[iChunk].type,
+          thosProj + iChunk,
+          (bdgBoxes != NULL ? bdgBoxes + iTho : NULL));
+
+      // Memorize the result
+      if (isInter == true) {
+
+        FMBBitsetSet(isIntersecting, iTho);
+
+      }
+
+    }
+
+  }
+
+}
+
+// Set the axes used as filters by the hybrid intersection test
+void FMBSetHybridAxes2D(const unsigned int axes) {
+
+  atomic_store_explicit(
+    &fmbHybridAxes2D,
+    axes,
+    memory_order_relaxed);
+
+}
+
+// Get the axes currently used as filters by the hybrid intersection
+// test
+unsigned int FMBGetHybridAxes2D(void) {
+
+  return
+    atomic_load_explicit(
+      &fmbHybridAxes2D,
+      memory_order_relaxed);
+
+}
+
+// Test for intersection between Frame that and Frame tho, checking
+// first the SAT axes selected by FMBSetHybridAxes2D
+bool FMBHybridTestIntersection2D(
+  const Frame2D* const that,
+  const Frame2D* const tho,
+  AABB2D* const bdgBox) {
+
+  // If one of the filter axes separates the Frames
+  bool isIntersection =
+    SATCheckFaces2D(
+      that,
+      tho,
+      atomic_load_explicit(
+        &fmbHybridAxes2D,
+        memory_order_relaxed));
+  if (isIntersection == false) {
+
+    // The Frames are not in intersection,
+    // terminate the test
+    return false;
+
+  }
+
+  // Else, confirm with FMB
+  return
+    FMBTestIntersection2D(
+      that,
+      tho,
+      bdgBox);
+
+}
@@ -25,6 +25,17 @@
 
 // ------------- Functions declaration -------------
 
+// Get the statistics of the Fourier-Motzkin elimination in
+// FMBTestIntersection2D since the last reset (cf frame.h), recorded
+// only if FMB_ELIM_STATS is defined at compilation and added over all
+// the threads, this function and FMBResetElimStats2D must not be
+// called while another thread is running FMBTestIntersection2D
+FMBElimStats FMBGetElimStats2D(void);
+
+// Reset the statistics of the Fourier-Motzkin elimination of all the
+// threads
+void FMBResetElimStats2D(void);
+
 // Test for intersection between Frame that and Frame tho
 // Return true if the two Frames are intersecting, else false
 // If the Frame are intersecting the AABB of the intersection
@@ -36,8 +47,55 @@
 // of the resulting AABB of FMBTestIntersection(B,A)
 // The resulting AABB is given in tho's local coordinates system
 bool FMBTestIntersection2D(
-  Frame2D* const that,
+  const Frame2D* const that,
   const Frame2D* const tho,
   AABB2D* const bdgBox);
 
+// Set the axes used as filters by FMBHybridTestIntersection2D, the
+// normals to the edges of the Frames selected by axes (cf
+// FMB_HYBRID_AXES_ALL in frame.h)
+// The default ones are FMB2D_HYBRID_AXES, FMB_HYBRID_AXES_ALL unless
+// defined otherwise at compilation (for example
+// -DFMB2D_HYBRID_AXES=FMB_HYBRID_AXES_THAT)
+void FMBSetHybridAxes2D(const unsigned int axes);
+
+// Get the axes currently used as filters by
+// FMBHybridTestIntersection2D
+unsigned int FMBGetHybridAxes2D(void);
+
+// Test for intersection between Frame that and Frame tho
+// Return true if the two Frames are intersecting, else false, and
+// store the AABB of the intersection into bdgBox, as
+// FMBTestIntersection2D
+// The normals to the edges selected by FMBSetHybridAxes2D are
+// checked first with SAT (cf SATCheckFaces2D), and
+// FMBTestIntersection2D is run only if none of them separates the
+// Frames
+// Cost: on random pairs (cf QualifyHybrid2D) non intersecting pairs
+// cost about 0.5 times FMBTestIntersection2D with all the axes, while
+// intersecting pairs cost FMBTestIntersection2D plus the filter, about
+// 1.25 times FMBTestIntersection2D
+bool FMBHybridTestIntersection2D(
+  const Frame2D* const that,
+  const Frame2D* const tho,
+  AABB2D* const bdgBox);
+
+// Test for intersection between the Frame that and each of the nbTho
+// Frames in the array thos
+// The result for thos[i] is stored in the i-th bit of the bitset
+// isIntersecting, which must have at least FMBBitsetNbWords(nbTho)
+// words (cf frame.h)
+// If bdgBoxes is not null, the AABB of the intersection with thos[i]
+// is stored into bdgBoxes[i] if the Frames are intersecting, else
+// bdgBoxes[i] is not modified
+// The results are identical to FMBTestIntersection2D(that, thos + i,
+// bdgBoxes + i), but the Frames are projected by chunks sharing the
+// setup of that
+void FMBTestIntersection2DBatch(
+  const Frame2D* const that,
+  const Frame2D* const thos,
+  const int nbTho,
+  unsigned long* const isIntersecting,
+  AABB2D* const bdgBoxes);
+
 #endif
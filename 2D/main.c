@@ -29,8 +29,8 @@
 int main(int argc, char** argv) {
 
   // Create the two objects to be tested for intersection
-  double origP2D[2] = {0.0, 0.0};
-  double compP2D[2][2] = {
+  FMB_REAL origP2D[2] = {0.0, 0.0};
+  FMB_REAL compP2D[2][2] = {
 
     {1.0, 0.0},  // First component
     {0.0, 1.0}   // Second component
@@ -42,8 +42,8 @@ int main(int argc, char** argv) {
       origP2D,
       compP2D);
 
-  double origQ2D[2] = {0.0, 0.0};
-  double compQ2D[2][2] = {{1.0, 0.0}, {0.0, 1.0}};
+  FMB_REAL origQ2D[2] = {0.0, 0.0};
+  FMB_REAL compQ2D[2][2] = {{1.0, 0.0}, {0.0, 1.0}};
   Frame2D Q2D =
     Frame2DCreateStatic(
       FrameCuboid,
@@ -21,13 +21,17 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdbool.h>
+#include <math.h>
+#include <string.h>
 #include <time.h>
-#include <sys/time.h>
 
 // Include FMB and SAT algorithm library
 #include "fmb2d.h"
 #include "sat.h"
 
+// Include the benchmark harness
+#include "bench.h"
+
 // Epsilon to detect degenerated triangles
 #define EPSILON 0.1
 
@@ -40,9 +44,8 @@
 // Nb of tests per run
 #define NB_TESTS 500000
 
-// Nb of times the test is run on one pair of frame, used to
-// slow down the processus and be able to measure time
-#define NB_REPEAT_2D 1500
+// Nb of Frames in the set used to qualify the batch test
+#define NB_FRAMES_BATCH 1000
 
 // Helper macro to generate random number in [0.0, 1.0]
 #define rnd() (double)(rand())/(double)(RAND_MAX)
@@ -51,8 +54,8 @@
 typedef struct {
 
   FrameType type;
-  double orig[2];
-  double comp[2][2];
+  FMB_REAL orig[2];
+  FMB_REAL comp[2][2];
 
 } Param2D;
 
@@ -62,52 +65,48 @@ typedef enum {
   typeQualif_nearCaseOnly
 } TypeQualif;
 
-// Global variables to count nb of tests resulting in intersection
-// and no intersection, and min/max/total time of execution for each
-double minInter;
-double maxInter;
-double sumInter;
-unsigned long countInter;
-double minNoInter;
-double maxNoInter;
-double sumNoInter;
-unsigned long countNoInter;
-
-double minInterCC;
-double maxInterCC;
-double sumInterCC;
-unsigned long countInterCC;
-double minNoInterCC;
-double maxNoInterCC;
-double sumNoInterCC;
-unsigned long countNoInterCC;
-
-double minInterCT;
-double maxInterCT;
-double sumInterCT;
-unsigned long countInterCT;
-double minNoInterCT;
-double maxNoInterCT;
-double sumNoInterCT;
-unsigned long countNoInterCT;
-
-double minInterTC;
-double maxInterTC;
-double sumInterTC;
-unsigned long countInterTC;
-double minNoInterTC;
-double maxNoInterTC;
-double sumNoInterTC;
-unsigned long countNoInterTC;
-
-double minInterTT;
-double maxInterTT;
-double sumInterTT;
-unsigned long countInterTT;
-double minNoInterTT;
-double maxNoInterTT;
-double sumNoInterTT;
-unsigned long countNoInterTT;
+// Global variables to memorize the distributions of the ratio of
+// execution time FMB/SAT, [iCase][iInter], iCase being 0 for all the
+// pairs and 1 + 2 * typeThat + typeTho for each pair of types, iInter
+// being 0 for the pairs in intersection and 1 for the others
+BenchDist* ratios[5][2];
+
+// Wrappers of the intersection tests with the signature expected by
+// the benchmark harness
+bool QualifTestFMB(
+  const void* const that,
+  const void* const tho) {
+
+  return
+    FMBTestIntersection2D(
+      that,
+      tho,
+      NULL);
+
+}
+
+bool QualifTestSAT(
+  const void* const that,
+  const void* const tho) {
+
+  return
+    SATTestIntersection2D(
+      that,
+      tho);
+
+}
+
+bool QualifTestHybrid(
+  const void* const that,
+  const void* const tho) {
+
+  return
+    FMBHybridTestIntersection2D(
+      that,
+      tho,
+      NULL);
+
+}
 
 // Qualification function
 // Takes two Frame definition as input, run the intersection test on
@@ -153,745 +152,631 @@ void Qualification2DStatic(
 
   }
 
+  // Configuration of the measurements, the time of each test being
+  // the median over repeated samples after warmup
+  BenchConfig config = BenchConfigDefault();
+
   // Loop on pairs of Frames
   for (
     int iPair = 2;
     iPair--;) {
 
-    // Declare an array to memorize the results of the repeated
-    // test on the same pair,
-    // to prevent optimization from the compiler to remove the for loop
-    bool isIntersectingFMB[NB_REPEAT_2D] = {false};
-
-    // Start measuring time
-    struct timeval start;
-    gettimeofday(&start, NULL);
-
-    // Run the FMB intersection test
-    for (
-      int i = NB_REPEAT_2D;
-      i--;) {
-
-      isIntersectingFMB[i] =
-        FMBTestIntersection2D(
-          that,
-          tho,
-          NULL);
+    // Measure the FMB and SAT intersection tests on the pair
+    BenchStats statsFMB;
+    bool isIntersectingFMB =
+      BenchMeasurePair(
+        &config,
+        QualifTestFMB,
+        that,
+        tho,
+        &statsFMB);
+    BenchStats statsSAT;
+    bool isIntersectingSAT =
+      BenchMeasurePair(
+        &config,
+        QualifTestSAT,
+        that,
+        tho,
+        &statsSAT);
+
+    // If FMB and SAT disagrees
+    if (isIntersectingFMB != isIntersectingSAT) {
+
+      printf("Qualification has failed\n");
+      Frame2DPrint(that);
+      printf(" against ");
+      Frame2DPrint(tho);
+      printf("\n");
+      printf("FMB : ");
+      if (isIntersectingFMB == false) printf("no ");
+      printf("intersection\n");
+      printf("SAT : ");
+      if (isIntersectingSAT == false) printf("no ");
+      printf("intersection\n");
+
+      // Stop the qualification test
+      exit(0);
 
     }
 
-    // Stop measuring time
-    struct timeval stop;
-    gettimeofday(&stop, NULL);
+    // Get the ratio of execution time
+    double ratio = statsFMB.median / statsSAT.median;
 
-    // Calculate the delay of execution
-    unsigned long deltausFMB = 0;
-    if (stop.tv_sec < start.tv_sec) {
+    // Update the distributions for all the pairs and for the pair of
+    // types
+    int iInter = (isIntersectingSAT == true ? 0 : 1);
+    BenchDistAdd(
+      ratios[0][iInter],
+      ratio);
+    BenchDistAdd(
+      ratios[1 + 2 * paramP.type + paramQ.type][iInter],
+      ratio);
 
-      printf("time warps, try again\n");
-      exit(0);
+    // Flip the pair of Frames
+    that = &Q;
+    tho = &P;
 
-    }
+  }
 
-    if (stop.tv_sec > start.tv_sec + 1) {
+}
 
-      printf("deltausFMB >> 1s, decrease NB_REPEAT\n");
-      exit(0);
+void Qualify2DStatic(TypeQualif typeQualif) {
 
-    }
+  // Initialise the random generator
+  srandom(time(NULL));
 
-    if (stop.tv_usec < start.tv_usec) {
+  // Open the files to save the results
+  FILE* fp = NULL;
+  FILE* fpCC = NULL;
+  FILE* fpCT = NULL;
+  FILE* fpTC = NULL;
+  FILE* fpTT = NULL;
+  if (typeQualif == typeQualif_all) {
 
-      deltausFMB = stop.tv_sec - start.tv_sec;
-      deltausFMB += stop.tv_usec + 1000000 - start.tv_usec;
+    fp = fopen("../Results/qualification2D.txt", "w");
+    fpCC = fopen("../Results/qualification2DCC.txt", "w");
+    fpCT = fopen("../Results/qualification2DCT.txt", "w");
+    fpTC = fopen("../Results/qualification2DTC.txt", "w");
+    fpTT = fopen("../Results/qualification2DTT.txt", "w");
 
-    } else {
+  } else if (typeQualif == typeQualif_nearCaseOnly) {
 
-      deltausFMB = stop.tv_usec - start.tv_usec;
+    fp = fopen("../Results/qualification2Dnearcaseonly.txt", "w");
+    fpCC = fopen("../Results/qualification2DCCnearcaseonly.txt", "w");
+    fpCT = fopen("../Results/qualification2DCTnearcaseonly.txt", "w");
+    fpTC = fopen("../Results/qualification2DTCnearcaseonly.txt", "w");
+    fpTT = fopen("../Results/qualification2DTTnearcaseonly.txt", "w");
 
-    }
+  } else {
 
-    // Declare an array to memorize the results of the repeated
-    // test on the same pair,
-    // to prevent optimization from the compiler to remove the for loop
-    bool isIntersectingSAT[NB_REPEAT_2D] = {false};
+    printf("Unimplemented typeQualif in Qualifiy2DStatic\n");
+    exit(1);
 
-    // Start measuring time
-    gettimeofday(&start, NULL);
+  }
+
+  // Create the distributions
+  for (
+    int iCase = 5;
+    iCase--;) {
 
-    // Run the FMB intersection test
     for (
-      int i = NB_REPEAT_2D;
-      i--;) {
+      int iInter = 2;
+      iInter--;) {
 
-      isIntersectingSAT[i] =
-        SATTestIntersection2D(
-          that,
-          tho);
+      ratios[iCase][iInter] = BenchDistCreate();
 
     }
 
-    // Stop measuring time
-    gettimeofday(&stop, NULL);
+  }
 
-    // Calculate the delay of execution
-    unsigned long deltausSAT = 0;
-    if (stop.tv_sec < start.tv_sec) {
+  // Loop on runs
+  for (
+    int iRun = 0;
+    iRun < NB_RUNS;
+    ++iRun) {
 
-      printf("time warps, try again\n");
-      exit(0);
+    // Ratio intersection/no intersection for the displayed results
+    double ratioInter = 0.1 + 0.8 * (double)iRun / (double)(NB_RUNS - 1);
 
-    }
+    // Reset the distributions
+    for (
+      int iCase = 5;
+      iCase--;) {
 
-    if (stop.tv_sec > start.tv_sec + 1) {
+      for (
+        int iInter = 2;
+        iInter--;) {
 
-      printf("deltausSAT >> 1s, decrease NB_REPEAT\n");
-      exit(0);
+        BenchDistReset(ratios[iCase][iInter]);
+
+      }
 
     }
 
-    if (stop.tv_usec < start.tv_usec) {
+    // Declare two variables to memorize the arguments to the
+    // Qualification function
+    Param2D paramP;
+    Param2D paramQ;
 
-      deltausSAT = stop.tv_sec - start.tv_sec;
-      deltausSAT += stop.tv_usec + 1000000 - start.tv_usec;
+    // Loop on the number of tests
+    for (
+      unsigned long iTest = NB_TESTS;
+      iTest--;) {
 
-    } else {
+      // Create two random Frame definitions
+      Param2D* param = &paramP;
+      for (
+        int iParam = 2;
+        iParam--;) {
 
-      deltausSAT = stop.tv_usec - start.tv_usec;
+        // 50% chance of being a Cuboid or a Tetrahedron
+        if (rnd() < 0.5) {
 
-    }
+          param->type = FrameCuboid;
 
-    // If the delays are greater than 10ms
-    if (deltausFMB >= 10 && deltausSAT >= 10) {
-
-      // If FMB and SAT disagrees
-      if (isIntersectingFMB[0] != isIntersectingSAT[0]) {
-
-        printf("Qualification has failed\n");
-        Frame2DPrint(that);
-        printf(" against ");
-        Frame2DPrint(tho);
-        printf("\n");
-        printf("FMB : ");
-        if (isIntersectingFMB[0] == false) printf("no ");
-        printf("intersection\n");
-        printf("SAT : ");
-        if (isIntersectingSAT[0] == false) printf("no ");
-        printf("intersection\n");
-
-        // Stop the qualification test
-        exit(0);
+        } else {
 
-      }
+          param->type = FrameTetrahedron;
 
-      // Get the ratio of execution time
-      double ratio = ((double)deltausFMB) / ((double)deltausSAT);
+        }
 
-      // If the Frames intersect
-      if (isIntersectingSAT[0] == true) {
+        for (
+          int iAxis = 2;
+          iAxis--;) {
 
-        // Update the counters
-        if (countInter == 0) {
+          param->orig[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
 
-          minInter = ratio;
-          maxInter = ratio;
+          for (
+            int iComp = 2;
+            iComp--;) {
 
-        } else {
+            param->comp[iComp][iAxis] =
+              -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
 
-          if (minInter > ratio) minInter = ratio;
-          if (maxInter < ratio) maxInter = ratio;
+          }
 
         }
 
-        sumInter += ratio;
-        ++countInter;
+        param = &paramQ;
 
-        if (
-          paramP.type == FrameCuboid &&
-          paramQ.type == FrameCuboid) {
+      }
 
-          if (countInterCC == 0) {
+      // Calculate the determinant of the Frames' components matrix
+      double detP =
+        paramP.comp[0][0] * paramP.comp[1][1] -
+        paramP.comp[1][0] * paramP.comp[0][1];
 
-            minInterCC = ratio;
-            maxInterCC = ratio;
+      double detQ =
+        paramQ.comp[0][0] * paramQ.comp[1][1] -
+        paramQ.comp[1][0] * paramQ.comp[0][1];
 
-          } else {
+      // If the determinants are not null, ie the Frame are not degenerate
+      if (fabs(detP) > EPSILON && fabs(detQ) > EPSILON) {
 
-            if (minInterCC > ratio) minInterCC = ratio;
-            if (maxInterCC < ratio) maxInterCC = ratio;
+        // Run the validation on the two Frames
+        Qualification2DStatic(
+          paramP,
+          paramQ,
+          typeQualif);
 
-          }
+      }
 
-          sumInterCC += ratio;
-          ++countInterCC;
+    }
 
-        } else if (
-          paramP.type == FrameCuboid &&
-          paramQ.type == FrameTetrahedron) {
+    // Save the results
+    FILE* fps[5] = {fp, fpCC, fpCT, fpTC, fpTT};
+    const char* suffixes[5] = {"To", "CC", "CT", "TC", "TT"};
+    for (
+      int iCase = 0;
+      iCase < 5;
+      ++iCase) {
 
-          if (countInterCT == 0) {
+      if (iRun == 0) {
 
-            minInterCT = ratio;
-            maxInterCT = ratio;
+        BenchPrintQualifHeader(
+          fps[iCase],
+          suffixes[iCase]);
 
-          } else {
+      }
 
-            if (minInterCT > ratio) minInterCT = ratio;
-            if (maxInterCT < ratio) maxInterCT = ratio;
+      BenchPrintQualif(
+        fps[iCase],
+        ratioInter,
+        ratios[iCase][0],
+        ratios[iCase][1]);
 
-          }
+    }
+
+  }
 
-          sumInterCT += ratio;
-          ++countInterCT;
+  // Close the files
+  fclose(fp);
+  fclose(fpCC);
+  fclose(fpCT);
+  fclose(fpTC);
+  fclose(fpTT);
 
-        } else if (
-          paramP.type == FrameTetrahedron &&
-          paramQ.type == FrameCuboid) {
+  // Free the distributions
+  for (
+    int iCase = 5;
+    iCase--;) {
 
-          if (countInterTC == 0) {
+    for (
+      int iInter = 2;
+      iInter--;) {
 
-            minInterTC = ratio;
-            maxInterTC = ratio;
+      BenchDistFree(ratios[iCase] + iInter);
 
-          } else {
+    }
 
-            if (minInterTC > ratio) minInterTC = ratio;
-            if (maxInterTC < ratio) maxInterTC = ratio;
+  }
 
-          }
+}
 
-          sumInterTC += ratio;
-          ++countInterTC;
+// Qualification of the batch intersection test against the single
+// pair one. Measure the time per pair to test one Frame against a set
+// of NB_FRAMES_BATCH Frames, first by calling FMBTestIntersection2D
+// on each pair, second by calling FMBTestIntersection2DBatch once
+// Results are printed and saved in ../Results/qualification2DBatch.txt
+void QualifyBatch2D(void) {
 
-        } else if (
-          paramP.type == FrameTetrahedron &&
-          paramQ.type == FrameTetrahedron) {
+  // Open the file to save the results
+  FILE* fp = fopen("../Results/qualification2DBatch.txt", "w");
+  fprintf(fp, "run\tscalar\tbatch\n");
 
-          if (countInterTT == 0) {
+  // Create the set of random non degenerated Frames
+  Frame2D* frames = malloc(sizeof(Frame2D) * NB_FRAMES_BATCH);
+  for (
+    int iFrame = NB_FRAMES_BATCH;
+    iFrame--;) {
 
-            minInterTT = ratio;
-            maxInterTT = ratio;
+    bool isDegenerated = true;
+    while (isDegenerated == true) {
 
-          } else {
+      FrameType type = (rnd() < 0.5 ? FrameCuboid : FrameTetrahedron);
+      FMB_REAL orig[2];
+      FMB_REAL comp[2][2];
+      for (
+        int iAxis = 2;
+        iAxis--;) {
 
-            if (minInterTT > ratio) minInterTT = ratio;
-            if (maxInterTT < ratio) maxInterTT = ratio;
+        orig[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
 
-          }
+        for (
+          int iComp = 2;
+          iComp--;) {
 
-          sumInterTT += ratio;
-          ++countInterTT;
+          comp[iComp][iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
 
         }
 
-      // Else, the Frames do not intersect
-      } else {
+      }
 
-        // Update the counters
-        if (countNoInter == 0) {
+      double det =
+        comp[0][0] * comp[1][1] - comp[1][0] * comp[0][1];
+      if (fabs(det) > EPSILON) {
 
-          minNoInter = ratio;
-          maxNoInter = ratio;
+        frames[iFrame] =
+          Frame2DCreateStatic(
+            type,
+            orig,
+            comp);
+        isDegenerated = false;
 
-        } else {
+      }
 
-          if (minNoInter > ratio) minNoInter = ratio;
-          if (maxNoInter < ratio) maxNoInter = ratio;
+    }
 
-        }
+  }
 
-        sumNoInter += ratio;
-        ++countNoInter;
+  // Allocate memory for the results
+  bool* isIntersectingScalar = malloc(sizeof(bool) * NB_FRAMES_BATCH);
+  unsigned long* isIntersectingBatch =
+    malloc(sizeof(unsigned long) * FMBBitsetNbWords(NB_FRAMES_BATCH));
 
-        if (
-          paramP.type == FrameCuboid &&
-          paramQ.type == FrameCuboid) {
+  // Declare variables to sum the time per pair over all the runs
+  double sumScalar = 0.0;
+  double sumBatch = 0.0;
 
-          if (countNoInterCC == 0) {
+  // Loop on runs
+  for (
+    int iRun = 0;
+    iRun < NB_RUNS;
+    ++iRun) {
 
-            minNoInterCC = ratio;
-            maxNoInterCC = ratio;
+    // Start measuring time
+    double start = BenchGetNs();
 
-          } else {
+    // Run the single pair intersection test on all the pairs
+    for (
+      int iThat = NB_FRAMES_BATCH;
+      iThat--;) {
 
-            if (minNoInterCC > ratio) minNoInterCC = ratio;
-            if (maxNoInterCC < ratio) maxNoInterCC = ratio;
+      for (
+        int iTho = NB_FRAMES_BATCH;
+        iTho--;) {
 
-          }
+        isIntersectingScalar[iTho] =
+          FMBTestIntersection2D(
+            frames + iThat,
+            frames + iTho,
+            NULL);
 
-          sumNoInterCC += ratio;
-          ++countNoInterCC;
+      }
 
-        } else if (
-          paramP.type == FrameCuboid &&
-          paramQ.type == FrameTetrahedron) {
+    }
 
-          if (countNoInterCT == 0) {
+    // Calculate the delay of execution
+    double deltansScalar = BenchGetNs() - start;
 
-            minNoInterCT = ratio;
-            maxNoInterCT = ratio;
+    // Start measuring time
+    start = BenchGetNs();
 
-          } else {
+    // Run the batch intersection test on all the pairs
+    for (
+      int iThat = NB_FRAMES_BATCH;
+      iThat--;) {
 
-            if (minNoInterCT > ratio) minNoInterCT = ratio;
-            if (maxNoInterCT < ratio) maxNoInterCT = ratio;
+      FMBTestIntersection2DBatch(
+        frames + iThat,
+        frames,
+        NB_FRAMES_BATCH,
+        isIntersectingBatch,
+        NULL);
 
-          }
+    }
 
-          sumNoInterCT += ratio;
-          ++countNoInterCT;
+    // Calculate the delay of execution
+    double deltansBatch = BenchGetNs() - start;
 
-        } else if (
-          paramP.type == FrameTetrahedron &&
-          paramQ.type == FrameCuboid) {
+    // Check the results of the last tested Frame against the
+    // set are the same, also prevents the compiler from optimizing
+    // away the loops
+    for (
+      int iTho = NB_FRAMES_BATCH;
+      iTho--;) {
 
-          if (countNoInterTC == 0) {
+      bool isInterBatch =
+        (FMBBitsetGet(isIntersectingBatch, iTho) == 1UL);
+      if (isIntersectingScalar[iTho] != isInterBatch) {
 
-            minNoInterTC = ratio;
-            maxNoInterTC = ratio;
+        printf("Scalar and batch tests disagree\n");
+        exit(0);
 
-          } else {
+      }
 
-            if (minNoInterTC > ratio) minNoInterTC = ratio;
-            if (maxNoInterTC < ratio) maxNoInterTC = ratio;
+    }
 
-          }
+    // Convert the delays to nanoseconds per pair
+    double nsScalar =
+      deltansScalar /
+      ((double)NB_FRAMES_BATCH * (double)NB_FRAMES_BATCH);
+    double nsBatch =
+      deltansBatch /
+      ((double)NB_FRAMES_BATCH * (double)NB_FRAMES_BATCH);
+    sumScalar += nsScalar;
+    sumBatch += nsBatch;
+
+    // Print and save the results of the run
+    printf("run %d: scalar %fns/pair, batch %fns/pair\n",
+      iRun, nsScalar, nsBatch);
+    fprintf(fp, "%d\t%f\t%f\n", iRun, nsScalar, nsBatch);
 
-          sumNoInterTC += ratio;
-          ++countNoInterTC;
+  }
 
-        } else if (
-          paramP.type == FrameTetrahedron &&
-          paramQ.type == FrameTetrahedron) {
+  // Print the average results
+  printf("Average per pair: scalar %fns, batch %fns (ratio %f)\n",
+    sumScalar / (double)NB_RUNS,
+    sumBatch / (double)NB_RUNS,
+    sumBatch / sumScalar);
 
-          if (countNoInterTT == 0) {
+  // Free memory and close the file
+  free(frames);
+  free(isIntersectingScalar);
+  free(isIntersectingBatch);
+  fclose(fp);
 
-            minNoInterTT = ratio;
-            maxNoInterTT = ratio;
+}
 
-          } else {
+// Create a random non degenerated Frame for the qualification of the
+// hybrid intersection test
+Frame2D QualifRandomFrame2D(void) {
 
-            if (minNoInterTT > ratio) minNoInterTT = ratio;
-            if (maxNoInterTT < ratio) maxNoInterTT = ratio;
+  // Loop until we get a non degenerated Frame
+  while (true) {
 
-          }
+    // 50% chance of being a Cuboid or a Tetrahedron
+    FrameType type = (rnd() < 0.5 ? FrameCuboid : FrameTetrahedron);
 
-          sumNoInterTT += ratio;
-          ++countNoInterTT;
+    // Random origin and components
+    FMB_REAL orig[2];
+    FMB_REAL comp[2][2];
+    for (
+      int iAxis = 2;
+      iAxis--;) {
 
-        }
+      orig[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
 
-      }
+      for (
+        int iComp = 2;
+        iComp--;) {
 
-    // Else, if time of execution for FMB was less than 10ms
-    } else if (deltausFMB < 10) {
+        comp[iComp][iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
 
-      printf("deltausFMB < 10ms, increase NB_REPEAT\n");
-      exit(0);
+      }
 
-    // Else, if time of execution for SAT was less than 10ms
-    } else if (deltausSAT < 10) {
+    }
 
-      printf("deltausSAT < 10ms, increase NB_REPEAT\n");
-      exit(0);
+    // If the determinant is not null, ie the Frame is not degenerate
+    double det =
+      comp[0][0] * comp[1][1] - comp[1][0] * comp[0][1];
+    if (fabs(det) > EPSILON) {
 
-    }
+      return
+        Frame2DCreateStatic(
+          type,
+          orig,
+          comp);
 
-    // Flip the pair of Frames
-    that = &Q;
-    tho = &P;
+    }
 
   }
 
 }
 
-void Qualify2DStatic(TypeQualif typeQualif) {
+// Qualification of the hybrid intersection test against FMB and SAT
+// For random pairs of Frames, and for random pairs of Frames whose
+// AABBs intersect (nearCaseOnly, as after a broadphase), measure the
+// median time of FMBTestIntersection2D, SATTestIntersection2D,
+// and FMBHybridTestIntersection2D with the normals to the faces of
+// both Frames and of that only as filter axes, and get the average
+// time per test for the pairs in intersection and the others
+// Results are printed and saved in
+// ../Results/qualification2DHybrid.txt
+void QualifyHybrid2D(void) {
 
   // Initialise the random generator
   srandom(time(NULL));
 
-  // Open the files to save the results
-  FILE* fp = NULL;
-  FILE* fpCC = NULL;
-  FILE* fpCT = NULL;
-  FILE* fpTC = NULL;
-  FILE* fpTT = NULL;
-  if (typeQualif == typeQualif_all) {
+  // Open the file to save the results
+  FILE* fp = fopen("../Results/qualification2DHybrid.txt", "w");
+  fprintf(fp, "dist\tinter\tfmb\tsat\thybridall\thybridthat\n");
 
-    fp = fopen("../Results/qualification2D.txt", "w");
-    fpCC = fopen("../Results/qualification2DCC.txt", "w");
-    fpCT = fopen("../Results/qualification2DCT.txt", "w");
-    fpTC = fopen("../Results/qualification2DTC.txt", "w");
-    fpTT = fopen("../Results/qualification2DTT.txt", "w");
+  // Tests to measure, and the filter axes of the hybrid tests
+  BenchPairTest tests[4] = {
 
-  } else if (typeQualif == typeQualif_nearCaseOnly) {
-
-    fp = fopen("../Results/qualification2Dnearcaseonly.txt", "w");
-    fpCC = fopen("../Results/qualification2DCCnearcaseonly.txt", "w");
-    fpCT = fopen("../Results/qualification2DCTnearcaseonly.txt", "w");
-    fpTC = fopen("../Results/qualification2DTCnearcaseonly.txt", "w");
-    fpTT = fopen("../Results/qualification2DTTnearcaseonly.txt", "w");
+    QualifTestFMB,
+    QualifTestSAT,
+    QualifTestHybrid,
+    QualifTestHybrid
 
-  } else {
+  };
+  unsigned int hybridAxes[4] = {
 
-    printf("Unimplemented typeQualif in Qualifiy2DStatic\n");
-    exit(1);
+    FMB_HYBRID_AXES_ALL,
+    FMB_HYBRID_AXES_ALL,
+    FMB_HYBRID_AXES_ALL,
+    FMB_HYBRID_AXES_THAT
 
-  }
+  };
+  const char* labelDists[2] = {"random", "nearcaseonly"};
+  const char* labelInters[2] = {"inter", "nointer"};
 
-  // Loop on runs
-  for (
-    int iRun = 0;
-    iRun < NB_RUNS;
-    ++iRun) {
+  // Memorize the current filter axes
+  unsigned int axes = FMBGetHybridAxes2D();
 
-    // Ratio intersection/no intersection for the displayed results
-    double ratioInter = 0.1 + 0.8 * (double)iRun / (double)(NB_RUNS - 1);
+  // Configuration of the measurements
+  BenchConfig config = BenchConfigDefault();
 
-    // Initialize counters
-    minInter = 0.0;
-    maxInter = 0.0;
-    sumInter = 0.0;
-    countInter = 0;
-    minNoInter = 0.0;
-    maxNoInter = 0.0;
-    sumNoInter = 0.0;
-    countNoInter = 0;
-
-    minInterCC = 0.0;
-    maxInterCC = 0.0;
-    sumInterCC = 0.0;
-    countInterCC = 0;
-    minNoInterCC = 0.0;
-    maxNoInterCC = 0.0;
-    sumNoInterCC = 0.0;
-    countNoInterCC = 0;
-
-    minInterCT = 0.0;
-    maxInterCT = 0.0;
-    sumInterCT = 0.0;
-    countInterCT = 0;
-    minNoInterCT = 0.0;
-    maxNoInterCT = 0.0;
-    sumNoInterCT = 0.0;
-    countNoInterCT = 0;
-
-    minInterTC = 0.0;
-    maxInterTC = 0.0;
-    sumInterTC = 0.0;
-    countInterTC = 0;
-    minNoInterTC = 0.0;
-    maxNoInterTC = 0.0;
-    sumNoInterTC = 0.0;
-    countNoInterTC = 0;
-
-    minInterTT = 0.0;
-    maxInterTT = 0.0;
-    sumInterTT = 0.0;
-    countInterTT = 0;
-    minNoInterTT = 0.0;
-    maxNoInterTT = 0.0;
-    sumNoInterTT = 0.0;
-    countNoInterTT = 0;
+  // Loop on the distributions of pairs
+  for (
+    int iDist = 0;
+    iDist < 2;
+    ++iDist) {
 
-    // Declare two variables to memorize the arguments to the
-    // Qualification function
-    Param2D paramP;
-    Param2D paramQ;
+    // Declare variables to sum the time per test (in ns) for the pairs
+    // in intersection and the others, [iInter][iTest]
+    double sum[2][4] = {{0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0}};
+    unsigned long count[2] = {0, 0};
 
-    // Loop on the number of tests
+    // Loop on pairs
     for (
-      unsigned long iTest = NB_TESTS;
-      iTest--;) {
-
-      // Create two random Frame definitions
-      Param2D* param = &paramP;
-      for (
-        int iParam = 2;
-        iParam--;) {
-
-        // 50% chance of being a Cuboid or a Tetrahedron
-        if (rnd() < 0.5) {
-
-          param->type = FrameCuboid;
-
-        } else {
-
-          param->type = FrameTetrahedron;
-
-        }
+      unsigned long iPair = NB_FRAMES_BATCH * NB_RUNS;
+      iPair--;) {
 
-        for (
-          int iAxis = 2;
-          iAxis--;) {
+      // Create two random Frames, with intersecting AABBs for the
+      // nearCaseOnly distribution
+      Frame2D frames[2];
+      bool isNear = false;
+      while (isNear == false) {
 
-          param->orig[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+        frames[0] = QualifRandomFrame2D();
+        frames[1] = QualifRandomFrame2D();
+        if (iDist == 0) {
 
-          for (
-            int iComp = 2;
-            iComp--;) {
-
-            param->comp[iComp][iAxis] =
-              -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
-
-          }
+          break;
 
         }
 
-        param = &paramQ;
+        // Check if the AABBs of the Frames intersect
+        isNear =
+          AABBTestIntersection2D(
+            &(frames[0].bdgBox),
+            &(frames[1].bdgBox));
 
       }
 
-      // Calculate the determinant of the Frames' components matrix
-      double detP =
-        paramP.comp[0][0] * paramP.comp[1][1] -
-        paramP.comp[1][0] * paramP.comp[0][1];
-
-      double detQ =
-        paramQ.comp[0][0] * paramQ.comp[1][1] -
-        paramQ.comp[1][0] * paramQ.comp[0][1];
-
-      // If the determinants are not null, ie the Frame are not degenerate
-      if (fabs(detP) > EPSILON && fabs(detQ) > EPSILON) {
-
-        // Run the validation on the two Frames
-        Qualification2DStatic(
-          paramP,
-          paramQ,
-          typeQualif);
+      // Measure the median time of each test, the last one measured
+      // being FMB
+      bool isIntersecting = false;
+      double deltans[4];
+      for (
+        int iTest = 4;
+        iTest--;) {
+
+        FMBSetHybridAxes2D(hybridAxes[iTest]);
+        BenchStats stats;
+        isIntersecting =
+          BenchMeasurePair(
+            &config,
+            tests[iTest],
+            frames,
+            frames + 1,
+            &stats);
+        deltans[iTest] = stats.median / BenchGetCyclesPerNs();
 
       }
 
-    }
+      // Update the sums
+      int iInter = (isIntersecting == true ? 0 : 1);
+      for (
+        int iTest = 4;
+        iTest--;) {
 
-    // Save the results
-    if (iRun == 0) {
-
-      fprintf(fp, "percPairInter,");
-      fprintf(fp, "countInterTo,countNoInterTo,");
-      fprintf(fp, "minInterTo,avgInterTo,maxInterTo,");
-      fprintf(fp, "minNoInterTo,avgNoInterTo,maxNoInterTo,");
-      fprintf(fp, "minTotalTo,avgTotalTo,maxTotalTo\n");
-
-      fprintf(fpCC, "percPairInter,");
-      fprintf(fpCC, "countInterCC,countNoInterCC,");
-      fprintf(fpCC, "minInterCC,avgInterCC,maxInterCC,");
-      fprintf(fpCC, "minNoInterCC,avgNoInterCC,maxNoInterCC,");
-      fprintf(fpCC, "minTotalCC,avgTotalCC,maxTotalCC\n");
-
-      fprintf(fpCT, "percPairInter,");
-      fprintf(fpCT, "countInterCT,countNoInterCT,");
-      fprintf(fpCT, "minInterCT,avgInterCT,maxInterCT,");
-      fprintf(fpCT, "minNoInterCT,avgNoInterCT,maxNoInterCT,");
-      fprintf(fpCT, "minTotalCT,avgTotalCT,maxTotalCT\n");
-
-      fprintf(fpTC, "percPairInter,");
-      fprintf(fpTC, "countInterTC,countNoInterTC,");
-      fprintf(fpTC, "minInterTC,avgInterTC,maxInterTC,");
-      fprintf(fpTC, "minNoInterTC,avgNoInterTC,maxNoInterTC,");
-      fprintf(fpTC, "minTotalTC,avgTotalTC,maxTotalTC\n");
-
-      fprintf(fpTT, "percPairInter,");
-      fprintf(fpTT, "countInterTT,countNoInterTT,");
-      fprintf(fpTT, "minInterTT,avgInterTT,maxInterTT,");
-      fprintf(fpTT, "minNoInterTT,avgNoInterTT,maxNoInterTT,");
-      fprintf(fpTT, "minTotalTT,avgTotalTT,maxTotalTT\n");
+        sum[iInter][iTest] += deltans[iTest];
 
-    }
+      }
 
-    fprintf(
-      fp,
-      "%.1f,",
-      ratioInter);
-    fprintf(
-      fp,
-      "%lu,%lu,",
-      countInter,
-      countNoInter);
-    double avgInter = sumInter / (double)countInter;
-    fprintf(
-      fp,
-      "%f,%f,%f,",
-      minInter,
-      avgInter,
-      maxInter);
-    double avgNoInter = sumNoInter / (double)countNoInter;
-    fprintf(
-      fp,
-      "%f,%f,%f,",
-      minNoInter,
-      avgNoInter,
-      maxNoInter);
-    double avg =
-      ratioInter * avgInter + (1.0 - ratioInter) * avgNoInter;
-    fprintf(
-      fp,
-      "%f,%f,%f",
-      (minNoInter < minInter ? minNoInter : minInter),
-      avg,
-      (maxNoInter > maxInter ? maxNoInter : maxInter));
-    if (iRun < NB_RUNS - 1) {
-
-      fprintf(fp, "\n");
+      ++(count[iInter]);
 
     }
 
-    fprintf(
-      fpCC,
-      "%.1f,",
-      ratioInter);
-    fprintf(
-      fpCC,
-      "%lu,%lu,",
-      countInterCC,
-      countNoInterCC);
-    double avgInterCC = sumInterCC / (double)countInterCC;
-    fprintf(
-      fpCC,
-      "%f,%f,%f,",
-      minInterCC,
-      avgInterCC,
-      maxInterCC);
-    double avgNoInterCC = sumNoInterCC / (double)countNoInterCC;
-    fprintf(
-      fpCC,
-      "%f,%f,%f,",
-      minNoInterCC,
-      avgNoInterCC,
-      maxNoInterCC);
-    double avgCC =
-      ratioInter * avgInterCC + (1.0 - ratioInter) * avgNoInterCC;
-    fprintf(
-      fpCC,
-      "%f,%f,%f",
-      (minNoInterCC < minInterCC ? minNoInterCC : minInterCC),
-      avgCC,
-      (maxNoInterCC > maxInterCC ? maxNoInterCC : maxInterCC));
-    if (iRun < NB_RUNS - 1) {
-
-      fprintf(fpCC, "\n");
+    // Print and save the results
+    printf("Time per test (ns), %s pairs\n", labelDists[iDist]);
+    for (
+      int iInter = 0;
+      iInter < 2;
+      ++iInter) {
 
-    }
+      double avg[4] = {0.0, 0.0, 0.0, 0.0};
+      for (
+        int iTest = 4;
+        iTest--;) {
 
-    fprintf(
-      fpCT,
-      "%.1f,",
-      ratioInter);
-    fprintf(
-      fpCT,
-      "%lu,%lu,",
-      countInterCT,
-      countNoInterCT);
-    double avgInterCT = sumInterCT / (double)countInterCT;
-    fprintf(
-      fpCT,
-      "%f,%f,%f,",
-      minInterCT,
-      avgInterCT,
-      maxInterCT);
-    double avgNoInterCT = sumNoInterCT / (double)countNoInterCT;
-    fprintf(
-      fpCT,
-      "%f,%f,%f,",
-      minNoInterCT,
-      avgNoInterCT,
-      maxNoInterCT);
-    double avgCT =
-      ratioInter * avgInterCT + (1.0 - ratioInter) * avgNoInterCT;
-    fprintf(
-      fpCT,
-      "%f,%f,%f",
-      (minNoInterCT < minInterCT ? minNoInterCT : minInterCT),
-      avgCT,
-      (maxNoInterCT > maxInterCT ? maxNoInterCT : maxInterCT));
-    if (iRun < NB_RUNS - 1) {
-
-      fprintf(fpCT, "\n");
+        if (count[iInter] > 0) {
 
-    }
+          avg[iTest] = sum[iInter][iTest] / (double)(count[iInter]);
 
-    fprintf(
-      fpTC,
-      "%.1f,",
-      ratioInter);
-    fprintf(
-      fpTC,
-      "%lu,%lu,",
-      countInterTC,
-      countNoInterTC);
-    double avgInterTC = sumInterTC / (double)countInterTC;
-    fprintf(
-      fpTC,
-      "%f,%f,%f,",
-      minInterTC,
-      avgInterTC,
-      maxInterTC);
-    double avgNoInterTC = sumNoInterTC / (double)countNoInterTC;
-    fprintf(
-      fpTC,
-      "%f,%f,%f,",
-      minNoInterTC,
-      avgNoInterTC,
-      maxNoInterTC);
-    double avgTC =
-      ratioInter * avgInterTC + (1.0 - ratioInter) * avgNoInterTC;
-    fprintf(
-      fpTC,
-      "%f,%f,%f",
-      (minNoInterTC < minInterTC ? minNoInterTC : minInterTC),
-      avgTC,
-      (maxNoInterTC > maxInterTC ? maxNoInterTC : maxInterTC));
-    if (iRun < NB_RUNS - 1) {
-
-      fprintf(fpTC, "\n");
+        }
 
-    }
+      }
 
-    fprintf(
-      fpTT,
-      "%.1f,",
-      ratioInter);
-    fprintf(
-      fpTT,
-      "%lu,%lu,",
-      countInterTT,
-      countNoInterTT);
-    double avgInterTT = sumInterTT / (double)countInterTT;
-    fprintf(
-      fpTT,
-      "%f,%f,%f,",
-      minInterTT,
-      avgInterTT,
-      maxInterTT);
-    double avgNoInterTT = sumNoInterTT / (double)countNoInterTT;
-    fprintf(
-      fpTT,
-      "%f,%f,%f,",
-      minNoInterTT,
-      avgNoInterTT,
-      maxNoInterTT);
-    double avgTT =
-      ratioInter * avgInterTT + (1.0 - ratioInter) * avgNoInterTT;
-    fprintf(
-      fpTT,
-      "%f,%f,%f",
-      (minNoInterTT < minInterTT ? minNoInterTT : minInterTT),
-      avgTT,
-      (maxNoInterTT > maxInterTT ? maxNoInterTT : maxInterTT));
-    if (iRun < NB_RUNS - 1) {
-
-      fprintf(fpTT, "\n");
+      printf("%s (%lu pairs): FMB %f, SAT %f, ",
+        labelInters[iInter], count[iInter], avg[0], avg[1]);
+      printf("hybrid all %f, hybrid that %f\n", avg[2], avg[3]);
+      fprintf(fp, "%s\t%s\t%f\t%f\t%f\t%f\n",
+        labelDists[iDist], labelInters[iInter],
+        avg[0], avg[1], avg[2], avg[3]);
 
     }
 
   }
 
-  // Close the files
+  // Restore the filter axes
+  FMBSetHybridAxes2D(axes);
+
+  // Close the file
   fclose(fp);
-  fclose(fpCC);
-  fclose(fpCT);
-  fclose(fpTC);
-  fclose(fpTT);
 
 }
 
@@ -908,12 +793,32 @@ int main(int argc, char** argv) {
 
       typeQualif = typeQualif_nearCaseOnly;
 
+    } else if (strcmp(argv[iArg], "-batch") == 0) {
+
+      QualifyBatch2D();
+      return 0;
+
+    } else if (strcmp(argv[iArg], "-hybrid") == 0) {
+
+      QualifyHybrid2D();
+      return 0;
+
     }
 
   }
 
   Qualify2DStatic(typeQualif);
 
+#ifdef FMB_ELIM_STATS
+
+  // Print the statistics of the elimination
+  FMBElimStats elimStats = FMBGetElimStats2D();
+  FMBElimStatsPrint(
+    &elimStats,
+    stdout);
+
+#endif
+
   return 0;
 
 }
@@ -28,12 +28,15 @@
 // Epsilon for numerical precision
 #define EPSILON 0.0001
 
+// Pi
+#define PI 3.14159265358979323846
+
 // Helper structure to pass arguments to the UnitTest function
 typedef struct {
 
   FrameType type;
-  double orig[2];
-  double comp[2][2];
+  FMB_REAL orig[2];
+  FMB_REAL comp[2][2];
 
 } Param2D;
 
@@ -202,6 +205,131 @@ void UnitTest2D(
 
 }
 
+// Check if the Frames A and B are identical (including their inverse
+// components and bounding box)
+bool IsSameFrame2D(
+  const Frame2D* const A,
+  const Frame2D* const B) {
+
+  for (
+    int i = 2;
+    i--;) {
+
+    if (fabs(A->orig[i] - B->orig[i]) > EPSILON) {
+
+      return false;
+
+    }
+
+    for (
+      int j = 2;
+      j--;) {
+
+      if (
+        fabs(A->comp[i][j] - B->comp[i][j]) > EPSILON ||
+        fabs(A->invComp[i][j] - B->invComp[i][j]) > EPSILON) {
+
+        return false;
+
+      }
+
+    }
+
+  }
+
+  for (
+    int i = 2;
+    i--;) {
+
+    if (
+      fabs(A->bdgBox.min[i] - B->bdgBox.min[i]) > EPSILON ||
+      fabs(A->bdgBox.max[i] - B->bdgBox.max[i]) > EPSILON) {
+
+      return false;
+
+    }
+
+  }
+
+  return true;
+
+}
+
+// Unit test of the functions modifying a Frame
+// Translate, rotate and set the components of a Frame and check the
+// result against the same Frame created from scratch
+void UnitTestMutation2D(void) {
+
+  // Create the Frame to be modified
+  FMB_REAL orig[2] = {0.0, 0.0};
+  FMB_REAL comp[2][2] = {{1.0, 0.0}, {0.0, 1.0}};
+  Frame2D P =
+    Frame2DCreateStatic(
+      FrameCuboid,
+      orig,
+      comp);
+
+  // Translate and rotate the Frame
+  FMB_REAL v[2] = {1.0, 2.0};
+  Frame2DTranslate(
+    &P,
+    v);
+  Frame2DRotate(
+    &P,
+    PI * 0.5);
+
+  // Create the expected Frame
+  FMB_REAL origExpected[2] = {1.0, 2.0};
+  FMB_REAL compRot[2][2] = {{0.0, 1.0}, {-1.0, 0.0}};
+  Frame2D Q =
+    Frame2DCreateStatic(
+      FrameCuboid,
+      origExpected,
+      compRot);
+
+  // Check the result
+  if (IsSameFrame2D(&P, &Q) == false) {
+
+    printf("UnitTestMutation2D translate/rotate Failed\n");
+    printf("Expected : ");
+    Frame2DPrint(&Q);
+    printf("\n     Got : ");
+    Frame2DPrint(&P);
+    printf("\n");
+    exit(0);
+
+  }
+
+  // Set the components of the Frame
+  FMB_REAL compSet[2][2] = {{2.0, 0.5}, {0.0, 2.0}};
+  Frame2DSetComp(
+    &P,
+    compSet);
+
+  // Create the expected Frame
+  Q =
+    Frame2DCreateStatic(
+      FrameCuboid,
+      origExpected,
+      compSet);
+
+  // Check the result
+  if (IsSameFrame2D(&P, &Q) == false) {
+
+    printf("UnitTestMutation2D set components Failed\n");
+    printf("Expected : ");
+    Frame2DPrint(&Q);
+    printf("\n     Got : ");
+    Frame2DPrint(&P);
+    printf("\n");
+    exit(0);
+
+  }
+
+  printf("UnitTestMutation2D Succeed\n\n");
+
+}
+
 void Test2D(void) {
 
   // Declare two variables to memorize the arguments to the
@@ -783,6 +911,9 @@ void Test2D(void) {
     false,
     NULL);
 
+  // ----------------------------
+  UnitTestMutation2D();
+
   // If we reached here, it means all the unit tests succeed
   printf("All unit tests 2D have succeed.\n");
 
@@ -36,6 +36,18 @@
 // Nb of tests of the validation
 #define NB_TESTS 1000000
 
+// Nb of Frames in the set used to validate the batch test
+#define NB_FRAMES_BATCH 1000
+
+// Maximum rate of disagreement between FMB and SAT, null in double
+// precision, in float precision both may be wrong on Frames closer
+// than the precision
+#ifdef FMB_REAL_FLOAT
+  #define MAX_DISAGREE_RATE 0.001
+#else
+  #define MAX_DISAGREE_RATE 0.0
+#endif
+
 // Helper macro to generate random number in [0.0, 1.0]
 #define rnd() (double)(rand())/(double)(RAND_MAX)
 
@@ -44,18 +56,22 @@
 unsigned long int nbInter;
 unsigned long int nbNoInter;
 
+// Global variable to count nb of tests where FMB and SAT disagree
+unsigned long int nbDisagree;
+
 // Helper structure to pass arguments to the Validation function
 typedef struct {
 
   FrameType type;
-  double orig[2];
-  double comp[2][2];
+  FMB_REAL orig[2];
+  FMB_REAL comp[2][2];
 
 } Param2D;
 
 // Validation function
 // Takes two Frame definition as input, run the intersection test on
 // them with FMB and SAT, and check the results are identical
+// Check also the hybrid test gives the results of FMB
 void ValidationOnePair2D(
   const Param2D paramP,
   const Param2D paramQ) {
@@ -95,24 +111,75 @@ void ValidationOnePair2D(
         that,
         tho);
 
+    // Test intersection with the hybrid test for each set of filter
+    // axes, the result must be the one of FMB, or no intersection if
+    // a filter axis separates the Frames (then SAT agrees)
+    unsigned int hybridAxes[4] = {
+
+      FMB_HYBRID_AXES_NONE,
+      FMB_HYBRID_AXES_THAT,
+      FMB_HYBRID_AXES_THO,
+      FMB_HYBRID_AXES_ALL
+
+    };
+    unsigned int axes = FMBGetHybridAxes2D();
+    for (
+      int iAxes = 4;
+      iAxes--;) {
+
+      FMBSetHybridAxes2D(hybridAxes[iAxes]);
+      bool isIntersectingHybrid =
+        FMBHybridTestIntersection2D(
+          that,
+          tho,
+          NULL);
+      if (
+        isIntersectingHybrid != isIntersectingFMB &&
+        (isIntersectingHybrid == true || isIntersectingSAT == true)) {
+
+        // Print the disagreement
+        printf("ValidationHybrid2D has failed (axes 0x%x)\n",
+          hybridAxes[iAxes]);
+        Frame2DPrint(that);
+        printf(" against ");
+        Frame2DPrint(tho);
+        printf("\n");
+
+        // Stop the validation
+        exit(0);
+
+      }
+
+    }
+
+    FMBSetHybridAxes2D(axes);
+
     // If the results are different
     if (isIntersectingFMB != isIntersectingSAT) {
 
-      // Print the disagreement
-      printf("Validation2D has failed\n");
-      Frame2DPrint(that);
-      printf(" against ");
-      Frame2DPrint(tho);
-      printf("\n");
-      printf("FMB : ");
-      if (isIntersectingFMB == false) printf("no ");
-      printf("intersection\n");
-      printf("SAT : ");
-      if (isIntersectingSAT == false) printf("no ");
-      printf("intersection\n");
-
-      // Stop the validation
-      exit(0);
+      // Update the number of disagreements
+      ++nbDisagree;
+
+      // If no disagreement is tolerated
+      if (MAX_DISAGREE_RATE == 0.0) {
+
+        // Print the disagreement
+        printf("Validation2D has failed\n");
+        Frame2DPrint(that);
+        printf(" against ");
+        Frame2DPrint(tho);
+        printf("\n");
+        printf("FMB : ");
+        if (isIntersectingFMB == false) printf("no ");
+        printf("intersection\n");
+        printf("SAT : ");
+        if (isIntersectingSAT == false) printf("no ");
+        printf("intersection\n");
+
+        // Stop the validation
+        exit(0);
+
+      }
 
     }
 
@@ -151,6 +218,7 @@ void Validate2D(void) {
   // Initialize the number of intersection and no intersection
   nbInter = 0;
   nbNoInter = 0;
+  nbDisagree = 0;
 
   // Loop on the tests
   for (
@@ -216,11 +284,176 @@ void Validate2D(void) {
 
   }
 
+  // Check the rate of disagreement
+  double rateDisagree =
+    (double)nbDisagree / (double)(nbInter + nbNoInter);
+  if (rateDisagree > MAX_DISAGREE_RATE) {
+
+    printf("Validation2D has failed\n");
+    printf("Disagreement rate with SAT %e\n", rateDisagree);
+    exit(0);
+
+  }
+
   // If we reached here it means the validation was successfull
   // Print results
   printf("Validation2D has succeed.\n");
   printf("Tested %lu intersections ", nbInter);
   printf("and %lu no intersections\n", nbNoInter);
+  printf("Disagreement rate with SAT (%s) %e\n",
+    FMB_REAL_NAME, rateDisagree);
+
+}
+
+// Create a random non degenerated Frame
+Frame2D RandomFrame2D(void) {
+
+  // Loop until we get a non degenerated Frame
+  while (true) {
+
+    // 50% chance of being a Cuboid or a Tetrahedron
+    FrameType type = (rnd() < 0.5 ? FrameCuboid : FrameTetrahedron);
+
+    // Random origin and components
+    FMB_REAL orig[2];
+    FMB_REAL comp[2][2];
+    for (
+      int iAxis = 2;
+      iAxis--;) {
+
+      orig[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+
+      for (
+        int iComp = 2;
+        iComp--;) {
+
+        comp[iComp][iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+
+      }
+
+    }
+
+    // If the determinant is not null, ie the Frame is not degenerate
+    double det =
+      comp[0][0] * comp[1][1] - comp[1][0] * comp[0][1];
+    if (fabs(det) > EPSILON) {
+
+      return
+        Frame2DCreateStatic(
+          type,
+          orig,
+          comp);
+
+    }
+
+  }
+
+}
+
+// Validation of the batch intersection test
+// Run FMBTestIntersection2DBatch on random sets of Frames and check
+// its results (intersection and bounding box) are identical to the
+// ones of FMBTestIntersection2D on each pair
+void ValidateBatch2D(void) {
+
+  // Create the set of random Frames
+  Frame2D* frames = malloc(sizeof(Frame2D) * NB_FRAMES_BATCH);
+  for (
+    int iFrame = NB_FRAMES_BATCH;
+    iFrame--;) {
+
+    frames[iFrame] = RandomFrame2D();
+
+  }
+
+  // Allocate memory for the results
+  unsigned long* isIntersecting =
+    malloc(sizeof(unsigned long) * FMBBitsetNbWords(NB_FRAMES_BATCH));
+  AABB2D* bdgBoxes = malloc(sizeof(AABB2D) * NB_FRAMES_BATCH);
+
+  // Declare a variable to count the intersections
+  unsigned long nbInterBatch = 0;
+
+  // Loop on the Frames tested against all the others
+  for (
+    int iThat = NB_FRAMES_BATCH;
+    iThat--;) {
+
+    // Run the batch intersection test
+    FMBTestIntersection2DBatch(
+      frames + iThat,
+      frames,
+      NB_FRAMES_BATCH,
+      isIntersecting,
+      bdgBoxes);
+
+    // Loop on the tested Frames
+    for (
+      int iTho = NB_FRAMES_BATCH;
+      iTho--;) {
+
+      // Run the single pair intersection test
+      AABB2D bdgBox;
+      bool isInter =
+        FMBTestIntersection2D(
+          frames + iThat,
+          frames + iTho,
+          &bdgBox);
+
+      // Check the intersection result
+      bool isInterBatch = (FMBBitsetGet(isIntersecting, iTho) == 1UL);
+      bool isSame = (isInter == isInterBatch);
+
+      // If the Frames intersect check the bounding box
+      if (isSame == true && isInter == true) {
+
+        ++nbInterBatch;
+        for (
+          int i = 2;
+          i--;) {
+
+          if (
+            bdgBox.min[i] != bdgBoxes[iTho].min[i] ||
+            bdgBox.max[i] != bdgBoxes[iTho].max[i]) {
+
+            isSame = false;
+
+          }
+
+        }
+
+      }
+
+      // If the results are different
+      if (isSame == false) {
+
+        // Print the disagreement
+        printf("ValidationBatch2D has failed\n");
+        Frame2DPrint(frames + iThat);
+        printf(" against ");
+        Frame2DPrint(frames + iTho);
+        printf("\n");
+
+        // Stop the validation
+        exit(0);
+
+      }
+
+    }
+
+  }
+
+  // Free memory
+  free(frames);
+  free(isIntersecting);
+  free(bdgBoxes);
+
+  // If we reached here it means the validation was successfull
+  // Print results
+  printf("ValidationBatch2D has succeed.\n");
+  printf("Tested %lu intersections ", nbInterBatch);
+  printf("and %lu no intersections\n",
+    (unsigned long)NB_FRAMES_BATCH * NB_FRAMES_BATCH - nbInterBatch);
 
 }
 
@@ -228,6 +461,7 @@ int main(int argc, char** argv) {
 
   printf("===== 2D static ======\n");
   Validate2D();
+  ValidateBatch2D();
 
   return 0;
 
@@ -18,6 +18,8 @@
 */
 
 #include "fmb2dt.h"
+#include "sat.h"
+#include "frameinternal.h"
 
 // ------------- Macros -------------
 
@@ -31,7 +33,48 @@
 #define SND_VAR 1
 #define THD_VAR 2
 
-#define EPSILON 0.0000001
+#define EPSILON FMB_EPSILON
+
+// Number of Frames projected at once by the batch intersection test
+#define FMB_BATCH_CHUNK 32
+
+// Number of rows of the system and of its successive eliminations for
+// each pair of types (C for Cuboid, T for Tetrahedron, that first).
+// The number of rows of the system is exact. The numbers of rows
+// after the eliminations are their maximum given by the pattern of
+// signs: eliminating a variable with p positive, n negative and z
+// null coefficients gives p.n+z rows, the rows of the constraints on
+// tho and time having a known sign and the other ones any sign
+#define FMB2DTIME_NB_ROWS_CC 10
+#define FMB2DTIME_NB_ROWS_P_CC 13
+#define FMB2DTIME_NB_ROWS_PP_CC 32
+#define FMB2DTIME_NB_ROWS_CT 9
+#define FMB2DTIME_NB_ROWS_P_CT 12
+#define FMB2DTIME_NB_ROWS_PP_CT 27
+#define FMB2DTIME_NB_ROWS_TC 9
+#define FMB2DTIME_NB_ROWS_P_TC 10
+#define FMB2DTIME_NB_ROWS_PP_TC 18
+#define FMB2DTIME_NB_ROWS_TT 8
+#define FMB2DTIME_NB_ROWS_P_TT 9
+#define FMB2DTIME_NB_ROWS_PP_TT 14
+
+// Default axes used as filters by the hybrid intersection test
+#ifndef FMB2DTIME_HYBRID_AXES
+  #define FMB2DTIME_HYBRID_AXES FMB_HYBRID_AXES_ALL
+#endif
+
+// ------------- Global variables -------------
+
+// Axes currently used as filters by the hybrid intersection test,
+// atomic as they may be changed while other threads are running it
+static _Atomic unsigned int fmbHybridAxes2DTime = FMB2DTIME_HYBRID_AXES;
+
+// Statistics of the elimination, cf FMB_ELIM_STATS, accumulated per
+// thread (cf FrameStats)
+FRAME_STATS_DEFINE(
+  FMBElimStats,
+  fmbElimStats2DTime,
+  FMBElimStatsMerge)
 
 // ------------- Functions declaration -------------
 
@@ -41,13 +84,13 @@
 // the resulting system in nbRemainRows
 // Return false if the system becomes inconsistent during elimination,
 // else return true
-bool ElimVar2DTime(
-  const double (*M)[3],
-  const double* Y,
+static bool ElimVar2DTime(
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
   const int nbRows,
   const int nbCols,
-  double (*Mp)[3],
-  double* Yp,
+  FMB_REAL (*Mp)[3],
+  FMB_REAL* Yp,
   int* const nbRemainRows);
 
 // Get the bounds of the iVar-th variable in the nbRows rows
@@ -57,10 +100,10 @@ bool ElimVar2DTime(
 // (M arrangement is [iRow][iCol])
 // May return inconsistent values (max < min), which would
 // mean the system has no solution
-void GetBoundLastVar2DTime(
+static void GetBoundLastVar2DTime(
   const int iVar,
-  const double (*M)[3],
-  const double* Y,
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
   const int nbRows,
   AABB2DTime* const bdgBox);
 
@@ -68,14 +111,135 @@ void GetBoundLastVar2DTime(
 // system M.X<=Y where the iVar-th variable is on the first column
 // and store them in the iVar-th axis of the AABB bdgBox
 // (M arrangement is [iRow][iCol])
-void GetBoundVar2DTime(
+static void GetBoundVar2DTime(
   const int iVar,
-  const double (*M)[3],
-  const double* Y,
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
   const int nbRows,
   const int nbCols,
   AABB2DTime* const bdgBox);
 
+// Solve the system of inequalities of the intersection between a
+// Frame of type thatType and the Frame thoProj of type thoType,
+// projection of tho in that's coordinates system, using the buffers
+// M, Y, Mp, Yp...
+// (cf FMBTestIntersection2DTime)
+static inline bool FMBTestIntersectionSolve2DTime(
+  const FrameType thatType,
+  const FrameType thoType,
+  const Frame2DTime* const thoProj,
+  AABB2DTime* const bdgBox,
+  FMB_REAL (*M)[3],
+  FMB_REAL* Y,
+  FMB_REAL (*Mp)[3],
+  FMB_REAL* Yp,
+  FMB_REAL (*Mpp)[3],
+  FMB_REAL* Ypp) __attribute__((always_inline));
+
+// Kernels testing the intersection for each pair of types, C for
+// Cuboid and T for Tetrahedron, the first letter being the type of
+// that and the second the type of tho
+static bool FMBTestIntersectionProj2DTimeCCGeneric(
+  const Frame2DTime* const thoProj,
+  AABB2DTime* const bdgBox);
+static bool FMBTestIntersectionProj2DTimeCTGeneric(
+  const Frame2DTime* const thoProj,
+  AABB2DTime* const bdgBox);
+static bool FMBTestIntersectionProj2DTimeTCGeneric(
+  const Frame2DTime* const thoProj,
+  AABB2DTime* const bdgBox);
+static bool FMBTestIntersectionProj2DTimeTTGeneric(
+  const Frame2DTime* const thoProj,
+  AABB2DTime* const bdgBox);
+
+// Implementations of the kernels for each FrameCPUPath
+FRAME_CPU_VARIANTS(
+  bool,
+  FMBTestIntersectionProj2DTimeCC,
+  (
+    const Frame2DTime* const thoProj,
+    AABB2DTime* const bdgBox),
+  (thoProj, bdgBox))
+FRAME_CPU_VARIANTS(
+  bool,
+  FMBTestIntersectionProj2DTimeCT,
+  (
+    const Frame2DTime* const thoProj,
+    AABB2DTime* const bdgBox),
+  (thoProj, bdgBox))
+FRAME_CPU_VARIANTS(
+  bool,
+  FMBTestIntersectionProj2DTimeTC,
+  (
+    const Frame2DTime* const thoProj,
+    AABB2DTime* const bdgBox),
+  (thoProj, bdgBox))
+FRAME_CPU_VARIANTS(
+  bool,
+  FMBTestIntersectionProj2DTimeTT,
+  (
+    const Frame2DTime* const thoProj,
+    AABB2DTime* const bdgBox),
+  (thoProj, bdgBox))
+
+// Dispatch table of the kernels, [FrameCPUPath][thatType][thoType]
+static bool (* const fmbKernels2DTime[FrameCPUNb][2][2])(
+  const Frame2DTime* const,
+  AABB2DTime* const) = {
+
+  {
+
+    {
+      FMBTestIntersectionProj2DTimeCCGeneric,
+      FMBTestIntersectionProj2DTimeCTGeneric},
+    {
+      FMBTestIntersectionProj2DTimeTCGeneric,
+      FMBTestIntersectionProj2DTimeTTGeneric}
+
+  },
+  {
+
+    {
+      FMBTestIntersectionProj2DTimeCCSSE2,
+      FMBTestIntersectionProj2DTimeCTSSE2},
+    {
+      FMBTestIntersectionProj2DTimeTCSSE2,
+      FMBTestIntersectionProj2DTimeTTSSE2}
+
+  },
+  {
+
+    {
+      FMBTestIntersectionProj2DTimeCCAVX2,
+      FMBTestIntersectionProj2DTimeCTAVX2},
+    {
+      FMBTestIntersectionProj2DTimeTCAVX2,
+      FMBTestIntersectionProj2DTimeTTAVX2}
+
+  },
+  {
+
+    {
+      FMBTestIntersectionProj2DTimeCCAVX512,
+      FMBTestIntersectionProj2DTimeCTAVX512},
+    {
+      FMBTestIntersectionProj2DTimeTCAVX512,
+      FMBTestIntersectionProj2DTimeTTAVX512}
+
+  }
+
+};
+
+// Test for intersection between a Frame of type thatType and the
+// Frame thoProj of type thoType, projection of tho in that's
+// coordinates system
+// (cf FMBTestIntersection2DTime)
+static inline bool FMBTestIntersectionProj2DTime(
+  const FrameType thatType,
+  const FrameType thoType,
+  const Frame2DTime* const thoProj,
+  AABB2DTime* const bdgBox);
+
 // ------------- Functions implementation -------------
 
 // Eliminate the first variable in the system M.X<=Y
@@ -85,13 +249,13 @@ void GetBoundVar2DTime(
 // (M arrangement is [iRow][iCol])
 // Return true if the system becomes inconsistent during elimination,
 // else return false
-bool ElimVar2DTime(
-  const double (*M)[3],
-  const double* Y,
+static bool ElimVar2DTime(
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
   const int nbRows,
   const int nbCols,
-  double (*Mp)[3],
-  double* Yp,
+  FMB_REAL (*Mp)[3],
+  FMB_REAL* Yp,
   int* const nbRemainRows) {
 
   // Initialize the number of rows in the result system
@@ -105,16 +269,16 @@ bool ElimVar2DTime(
     ++iRow) {
 
     // Shortcuts
-    const double fabsMIRowIVar = fabs(M[iRow][0]);
+    const FMB_REAL fabsMIRowIVar = fabs(M[iRow][0]);
 
     // If the coefficient for the eliminated variable is not null
     // in this row
     if (fabsMIRowIVar > EPSILON) {
 
       // Shortcuts
-      const double* MiRow = M[iRow];
+      const FMB_REAL* MiRow = M[iRow];
       const int sgnMIRowIVar = sgn(MiRow[0]);
-      const double YIRowDivideByFabsMIRowIVar = Y[iRow] / fabsMIRowIVar;
+      const FMB_REAL YIRowDivideByFabsMIRowIVar = Y[iRow] / fabsMIRowIVar;
 
       // For each following rows
       for (
@@ -129,12 +293,12 @@ bool ElimVar2DTime(
           fabs(M[jRow][0]) > EPSILON) {
 
           // Shortcuts
-          const double* MjRow = M[jRow];
-          const double fabsMjRow = fabs(MjRow[0]);
+          const FMB_REAL* MjRow = M[jRow];
+          const FMB_REAL fabsMjRow = fabs(MjRow[0]);
 
           // Declare a variable to memorize the sum of the negative
           // coefficients in the row
-          double sumNegCoeff = 0.0;
+          FMB_REAL sumNegCoeff = 0.0;
 
           // Add the sum of the two normed (relative to the eliminated
           // variable) rows into the result system. This actually
@@ -189,14 +353,14 @@ bool ElimVar2DTime(
     ++iRow) {
 
     // Shortcut
-    const double* MiRow = M[iRow];
+    const FMB_REAL* MiRow = M[iRow];
 
     // If the coefficient of the eliminated variable is null on
     // this row
     if (fabs(MiRow[0]) < EPSILON) {
 
       // Shortcut
-      double* MpnbResRows = Mp[nbResRows];
+      FMB_REAL* MpnbResRows = Mp[nbResRows];
 
       // Copy this row into the result system excluding the eliminated
       // variable
@@ -233,16 +397,16 @@ bool ElimVar2DTime(
 // (M arrangement is [iRow][iCol])
 // May return inconsistent values (max < min), which would
 // mean the system has no solution
-void GetBoundLastVar2DTime(
+static void GetBoundLastVar2DTime(
   const int iVar,
-  const double (*M)[3],
-  const double* Y,
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
   const int nbRows,
   AABB2DTime* const bdgBox) {
 
   // Shortcuts
-  double* min = bdgBox->min + iVar;
-  double* max = bdgBox->max + iVar;
+  FMB_REAL* min = bdgBox->min + iVar;
+  FMB_REAL* max = bdgBox->max + iVar;
 
   // Initialize the bounds to there maximum maximum and minimum minimum
   *min = 0.0;
@@ -255,14 +419,14 @@ void GetBoundLastVar2DTime(
     ++jRow) {
 
     // Shortcut
-    double MjRowiVar = M[jRow][0];
+    FMB_REAL MjRowiVar = M[jRow][0];
 
     // If this row has been reduced to the variable in argument
     // and it has a strictly positive coefficient
     if (MjRowiVar > EPSILON) {
 
       // Get the scaled value of Y for this row
-      double y = Y[jRow] / MjRowiVar;
+      FMB_REAL y = Y[jRow] / MjRowiVar;
 
       // If the value is lower than the current maximum bound
       if (*max > y) {
@@ -277,7 +441,7 @@ void GetBoundLastVar2DTime(
     } else if (MjRowiVar < -EPSILON) {
 
       // Get the scaled value of Y for this row
-      double y = Y[jRow] / MjRowiVar;
+      FMB_REAL y = Y[jRow] / MjRowiVar;
 
       // If the value is greater than the current minimum bound
       if (*min < y) {
@@ -297,17 +461,17 @@ void GetBoundLastVar2DTime(
 // system M.X<=Y where the iVar-th variable is on the first column
 // and store them in the iVar-th axis of the AABB bdgBox
 // (M arrangement is [iRow][iCol])
-void GetBoundVar2DTime(
+static void GetBoundVar2DTime(
   const int iVar,
-  const double (*M)[3],
-  const double* Y,
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
   const int nbRows,
   const int nbCols,
   AABB2DTime* const bdgBox) {
 
   // Shortcuts
-  double* bdgBoxMin = bdgBox->min;
-  double* bdgBoxMax = bdgBox->max;
+  FMB_REAL* bdgBoxMin = bdgBox->min;
+  FMB_REAL* bdgBoxMax = bdgBox->max;
 
   // Initialize the bounds
   bdgBoxMin[iVar] = 0.0;
@@ -320,16 +484,16 @@ void GetBoundVar2DTime(
     ++iRow) {
 
     // Shortcuts
-    const double* MIRow = M[iRow];
-    double fabsMIRowIVar = fabs(MIRow[0]);
+    const FMB_REAL* MIRow = M[iRow];
+    FMB_REAL fabsMIRowIVar = fabs(MIRow[0]);
 
     // If the coefficient of the first variable on this row is not null
     if (fabsMIRowIVar > EPSILON) {
 
       // Declare two variables to memorize the min and max of the
       // requested variable in this row
-      double min = -1.0 * Y[iRow];
-      double max = Y[iRow];
+      FMB_REAL min = -1.0 * Y[iRow];
+      FMB_REAL max = Y[iRow];
 
       // Loop on columns except the first one which is the one of the
       // requested variable
@@ -372,49 +536,54 @@ void GetBoundVar2DTime(
 
 }
 
-// Test for intersection between Frame that and Frame tho
-// Return true if the two Frames are intersecting, else false
-// If the Frame are intersecting the AABB of the intersection
-// is stored into bdgBox, else bdgBox is not modified
-// If bdgBox is null, the result AABB is not memorized (to use if
-// unnecessary and want to speed up the algorithm)
-// The resulting AABB may be larger than the smallest possible AABB
-// The resulting AABB of FMBTestIntersection(A,B) may be different
-// of the resulting AABB of FMBTestIntersection(B,A)
-// The resulting AABB is given in tho's local coordinates system
-bool FMBTestIntersection2DTime(
-  Frame2DTime* const that,
-  const Frame2DTime* const tho,
-  AABB2DTime* const bdgBox) {
-
-  // Get the projection of the Frame tho in Frame that coordinates
-  // system
-  Frame2DTime thoProj;
-  Frame2DTimeImportFrame(that, tho, &thoProj);
-
-  // Declare two variables to memorize the system to be solved M.X <= Y
-  // (M arrangement is [iRow][iCol])
-  double M[10][3];
-  double Y[10];
+// Solve the system of inequalities of the intersection between a
+// Frame of type thatType and the Frame thoProj of type thoType,
+// projection of tho in that's coordinates system
+// M, Y, Mp, Yp... are the buffers for the system and its successive
+// eliminations, sized by the caller for the pair of types
+// Always inlined, the types being constant in the callers the
+// construction of the system is fully specialized
+// (cf FMBTestIntersection2DTime)
+static inline bool FMBTestIntersectionSolve2DTime(
+  const FrameType thatType,
+  const FrameType thoType,
+  const Frame2DTime* const thoProj,
+  AABB2DTime* const bdgBox,
+  FMB_REAL (*M)[3],
+  FMB_REAL* Y,
+  FMB_REAL (*Mp)[3],
+  FMB_REAL* Yp,
+  FMB_REAL (*Mpp)[3],
+  FMB_REAL* Ypp) {
 
   // Create the inequality system
   // -V_jT-sum_iC_j,iX_i<=O_j
-  M[0][0] = -thoProj.comp[0][0];
-  M[0][1] = -thoProj.comp[1][0];
-  M[0][2] = -thoProj.speed[0];
-  Y[0] = thoProj.orig[0];
+  M[0][0] = -thoProj->comp[0][0];
+  M[0][1] = -thoProj->comp[1][0];
+  M[0][2] = -thoProj->speed[0];
+  Y[0] = thoProj->orig[0];
   if (Y[0] < neg(M[0][0]) + neg(M[0][1]) + neg(M[0][2])) {
 
+    FMB_ELIM_STATS_STAGE(
+      fmbElimStats2DTimeThread(),
+      thatType,
+      thoType,
+      FMBElimStageInit);
     return false;
 
   }
 
-  M[1][0] = -thoProj.comp[0][1];
-  M[1][1] = -thoProj.comp[1][1];
-  M[1][2] = -thoProj.speed[1];
-  Y[1] = thoProj.orig[1];
+  M[1][0] = -thoProj->comp[0][1];
+  M[1][1] = -thoProj->comp[1][1];
+  M[1][2] = -thoProj->speed[1];
+  Y[1] = thoProj->orig[1];
   if (Y[1] < neg(M[1][0]) + neg(M[1][1]) + neg(M[1][2])) {
 
+    FMB_ELIM_STATS_STAGE(
+      fmbElimStats2DTimeThread(),
+      thatType,
+      thoType,
+      FMBElimStageInit);
     return false;
 
   }
@@ -422,31 +591,41 @@ bool FMBTestIntersection2DTime(
   // Variable to memorize the nb of rows in the system
   int nbRows = 2;
 
-  if (that->type == FrameCuboid) {
+  if (thatType == FrameCuboid) {
 
     // V_jT+sum_iC_j,iX_i<=1.0-O_j
-    M[nbRows][0] = thoProj.comp[0][0];
-    M[nbRows][1] = thoProj.comp[1][0];
-    M[nbRows][2] = thoProj.speed[0];
-    Y[nbRows] = 1.0 - thoProj.orig[0];
+    M[nbRows][0] = thoProj->comp[0][0];
+    M[nbRows][1] = thoProj->comp[1][0];
+    M[nbRows][2] = thoProj->speed[0];
+    Y[nbRows] = 1.0 - thoProj->orig[0];
     if (
       Y[nbRows] < neg(M[nbRows][0]) + neg(M[nbRows][1]) +
       neg(M[nbRows][2])) {
 
+      FMB_ELIM_STATS_STAGE(
+        fmbElimStats2DTimeThread(),
+        thatType,
+        thoType,
+        FMBElimStageInit);
       return false;
 
     }
 
     ++nbRows;
 
-    M[nbRows][0] = thoProj.comp[0][1];
-    M[nbRows][1] = thoProj.comp[1][1];
-    M[nbRows][2] = thoProj.speed[1];
-    Y[nbRows] = 1.0 - thoProj.orig[1];
+    M[nbRows][0] = thoProj->comp[0][1];
+    M[nbRows][1] = thoProj->comp[1][1];
+    M[nbRows][2] = thoProj->speed[1];
+    Y[nbRows] = 1.0 - thoProj->orig[1];
     if (
       Y[nbRows] < neg(M[nbRows][0]) + neg(M[nbRows][1]) +
       neg(M[nbRows][2])) {
 
+      FMB_ELIM_STATS_STAGE(
+        fmbElimStats2DTimeThread(),
+        thatType,
+        thoType,
+        FMBElimStageInit);
       return false;
 
     }
@@ -456,14 +635,19 @@ bool FMBTestIntersection2DTime(
   } else {
 
     // sum_j(V_jT+sum_iC_j,iX_i)<=1.0-sum_iO_i
-    M[nbRows][0] = thoProj.comp[0][0] + thoProj.comp[0][1];
-    M[nbRows][1] = thoProj.comp[1][0] + thoProj.comp[1][1];
-    M[nbRows][2] = thoProj.speed[0] + thoProj.speed[1];
-    Y[nbRows] = 1.0 - thoProj.orig[0] - thoProj.orig[1];
+    M[nbRows][0] = thoProj->comp[0][0] + thoProj->comp[0][1];
+    M[nbRows][1] = thoProj->comp[1][0] + thoProj->comp[1][1];
+    M[nbRows][2] = thoProj->speed[0] + thoProj->speed[1];
+    Y[nbRows] = 1.0 - thoProj->orig[0] - thoProj->orig[1];
     if (
       Y[nbRows] < neg(M[nbRows][0]) + neg(M[nbRows][1]) +
       neg(M[nbRows][2])) {
 
+      FMB_ELIM_STATS_STAGE(
+        fmbElimStats2DTimeThread(),
+        thatType,
+        thoType,
+        FMBElimStageInit);
       return false;
 
     }
@@ -472,7 +656,7 @@ bool FMBTestIntersection2DTime(
 
   }
 
-  if (tho->type == FrameCuboid) {
+  if (thoType == FrameCuboid) {
 
     // X_i <= 1.0
     M[nbRows][0] = 1.0;
@@ -534,15 +718,8 @@ bool FMBTestIntersection2DTime(
 
   };
 
-  // Declare variables to eliminate the first variable
-  // The size of the array given in the doc is a majoring value.
-  // Instead I use a smaller value which has proven to be sufficient
-  // during tests, validation and qualification, to avoid running
-  // into the heap limit and to optimize slightly the performance
-  //double Mp[35][3];
-  //double Yp[35];
-  double Mp[13][3];
-  double Yp[13];
+  // Declare a variable to memorize the number of rows of the system
+  // after elimination of the first variable
   int nbRowsP;
 
   // Eliminate the first variable in the original system
@@ -560,19 +737,25 @@ bool FMBTestIntersection2DTime(
   if (inconsistency == true) {
 
     // The two Frames are not in intersection
+    FMB_ELIM_STATS_STAGE(
+      fmbElimStats2DTimeThread(),
+      thatType,
+      thoType,
+      FMBElimStagePass1);
     return false;
 
   }
 
-  // Declare variables to eliminate the second variable
-  // The size of the array given in the doc is a majoring value.
-  // Instead I use a smaller value which has proven to be sufficient
-  // during tests, validation and qualification, to avoid running
-  // into the heap limit and to optimize slightly the performance
-  //double Mpp[342][3];
-  //double Ypp[342];
-  double Mpp[21][3];
-  double Ypp[21];
+  // Record the size of the resulting system
+  FMB_ELIM_STATS_ROWS(
+    fmbElimStats2DTimeThread(),
+    thatType,
+    thoType,
+    0,
+    nbRowsP);
+
+  // Declare a variable to memorize the number of rows of the system
+  // after elimination of the second variable
   int nbRowsPP;
 
   // Eliminate the second variable (which is the first in the new system)
@@ -590,10 +773,23 @@ bool FMBTestIntersection2DTime(
   if (inconsistency == true) {
 
     // The two Frames are not in intersection
+    FMB_ELIM_STATS_STAGE(
+      fmbElimStats2DTimeThread(),
+      thatType,
+      thoType,
+      FMBElimStagePass2);
     return false;
 
   }
 
+  // Record the size of the resulting system
+  FMB_ELIM_STATS_ROWS(
+    fmbElimStats2DTimeThread(),
+    thatType,
+    thoType,
+    1,
+    nbRowsPP);
+
   // Get the bounds for the remaining third variable
   GetBoundLastVar2DTime(
     THD_VAR,
@@ -606,6 +802,11 @@ bool FMBTestIntersection2DTime(
   if (bdgBoxLocal.min[THD_VAR] >= bdgBoxLocal.max[THD_VAR]) {
 
     // The two Frames are not in intersection
+    FMB_ELIM_STATS_STAGE(
+      fmbElimStats2DTimeThread(),
+      thatType,
+      thoType,
+      FMBElimStageBound);
     return false;
 
   // Else, if the bounds are consistent here it means
@@ -636,6 +837,339 @@ bool FMBTestIntersection2DTime(
   }
 
   // If we've reached here the two Frames are intersecting
+  FMB_ELIM_STATS_STAGE(
+    fmbElimStats2DTimeThread(),
+    thatType,
+    thoType,
+    FMBElimStageInter);
   return true;
 
 }
+
+// Test for intersection between a Cuboid that and the
+// Cuboid thoProj, projection of tho in that's coordinates system
+static bool FMBTestIntersectionProj2DTimeCCGeneric(
+  const Frame2DTime* const thoProj,
+  AABB2DTime* const bdgBox) {
+
+  // Declare the buffers of the system and its eliminations, sized for
+  // this pair of types
+  FMB_REAL M[FMB2DTIME_NB_ROWS_CC][3];
+  FMB_REAL Y[FMB2DTIME_NB_ROWS_CC];
+  FMB_REAL Mp[FMB2DTIME_NB_ROWS_P_CC][3];
+  FMB_REAL Yp[FMB2DTIME_NB_ROWS_P_CC];
+  FMB_REAL Mpp[FMB2DTIME_NB_ROWS_PP_CC][3];
+  FMB_REAL Ypp[FMB2DTIME_NB_ROWS_PP_CC];
+
+  // Solve the system
+  return
+    FMBTestIntersectionSolve2DTime(
+      FrameCuboid,
+      FrameCuboid,
+      thoProj,
+      bdgBox,
+      M,
+      Y,
+      Mp,
+      Yp,
+      Mpp,
+      Ypp);
+
+}
+
+// Test for intersection between a Cuboid that and the
+// Tetrahedron thoProj, projection of tho in that's coordinates system
+static bool FMBTestIntersectionProj2DTimeCTGeneric(
+  const Frame2DTime* const thoProj,
+  AABB2DTime* const bdgBox) {
+
+  // Declare the buffers of the system and its eliminations, sized for
+  // this pair of types
+  FMB_REAL M[FMB2DTIME_NB_ROWS_CT][3];
+  FMB_REAL Y[FMB2DTIME_NB_ROWS_CT];
+  FMB_REAL Mp[FMB2DTIME_NB_ROWS_P_CT][3];
+  FMB_REAL Yp[FMB2DTIME_NB_ROWS_P_CT];
+  FMB_REAL Mpp[FMB2DTIME_NB_ROWS_PP_CT][3];
+  FMB_REAL Ypp[FMB2DTIME_NB_ROWS_PP_CT];
+
+  // Solve the system
+  return
+    FMBTestIntersectionSolve2DTime(
+      FrameCuboid,
+      FrameTetrahedron,
+      thoProj,
+      bdgBox,
+      M,
+      Y,
+      Mp,
+      Yp,
+      Mpp,
+      Ypp);
+
+}
+
+// Test for intersection between a Tetrahedron that and the
+// Cuboid thoProj, projection of tho in that's coordinates system
+static bool FMBTestIntersectionProj2DTimeTCGeneric(
+  const Frame2DTime* const thoProj,
+  AABB2DTime* const bdgBox) {
+
+  // Declare the buffers of the system and its eliminations, sized for
+  // this pair of types
+  FMB_REAL M[FMB2DTIME_NB_ROWS_TC][3];
+  FMB_REAL Y[FMB2DTIME_NB_ROWS_TC];
+  FMB_REAL Mp[FMB2DTIME_NB_ROWS_P_TC][3];
+  FMB_REAL Yp[FMB2DTIME_NB_ROWS_P_TC];
+  FMB_REAL Mpp[FMB2DTIME_NB_ROWS_PP_TC][3];
+  FMB_REAL Ypp[FMB2DTIME_NB_ROWS_PP_TC];
+
+  // Solve the system
+  return
+    FMBTestIntersectionSolve2DTime(
+      FrameTetrahedron,
+      FrameCuboid,
+      thoProj,
+      bdgBox,
+      M,
+      Y,
+      Mp,
+      Yp,
+      Mpp,
+      Ypp);
+
+}
+
+// Test for intersection between a Tetrahedron that and the
+// Tetrahedron thoProj, projection of tho in that's coordinates system
+static bool FMBTestIntersectionProj2DTimeTTGeneric(
+  const Frame2DTime* const thoProj,
+  AABB2DTime* const bdgBox) {
+
+  // Declare the buffers of the system and its eliminations, sized for
+  // this pair of types
+  FMB_REAL M[FMB2DTIME_NB_ROWS_TT][3];
+  FMB_REAL Y[FMB2DTIME_NB_ROWS_TT];
+  FMB_REAL Mp[FMB2DTIME_NB_ROWS_P_TT][3];
+  FMB_REAL Yp[FMB2DTIME_NB_ROWS_P_TT];
+  FMB_REAL Mpp[FMB2DTIME_NB_ROWS_PP_TT][3];
+  FMB_REAL Ypp[FMB2DTIME_NB_ROWS_PP_TT];
+
+  // Solve the system
+  return
+    FMBTestIntersectionSolve2DTime(
+      FrameTetrahedron,
+      FrameTetrahedron,
+      thoProj,
+      bdgBox,
+      M,
+      Y,
+      Mp,
+      Yp,
+      Mpp,
+      Ypp);
+
+}
+
+// Test for intersection between a Frame of type thatType and the
+// Frame thoProj of type thoType, projection of tho in that's
+// coordinates system
+// (cf FMBTestIntersection2DTime)
+static inline bool FMBTestIntersectionProj2DTime(
+  const FrameType thatType,
+  const FrameType thoType,
+  const Frame2DTime* const thoProj,
+  AABB2DTime* const bdgBox) {
+
+  // Call the kernel for this pair of types
+  return
+    fmbKernels2DTime[FrameGetCPUPath()][thatType][thoType](
+      thoProj,
+      bdgBox);
+
+}
+
+// Get the statistics of the elimination since the last reset
+// (cf frame.h)
+FMBElimStats FMBGetElimStats2DTime(void) {
+
+  FMBElimStats stats;
+  FrameStatsGet(
+    &fmbElimStats2DTime,
+    &stats);
+  return stats;
+
+}
+
+// Reset the statistics of the elimination
+void FMBResetElimStats2DTime(void) {
+
+  FrameStatsReset(&fmbElimStats2DTime);
+
+}
+
+// Test for intersection between Frame that and Frame tho
+// Return true if the two Frames are intersecting, else false
+// If the Frame are intersecting the AABB of the intersection
+// is stored into bdgBox, else bdgBox is not modified
+// If bdgBox is null, the result AABB is not memorized (to use if
+// unnecessary and want to speed up the algorithm)
+// The resulting AABB may be larger than the smallest possible AABB
+// The resulting AABB of FMBTestIntersection(A,B) may be different
+// of the resulting AABB of FMBTestIntersection(B,A)
+// The resulting AABB is given in tho's local coordinates system
+bool FMBTestIntersection2DTime(
+  const Frame2DTime* const that,
+  const Frame2DTime* const tho,
+  AABB2DTime* const bdgBox) {
+
+  // Get the projection of the Frame tho in Frame that coordinates
+  // system
+  Frame2DTime thoProj;
+  Frame2DTimeImportFrame(that, tho, &thoProj);
+
+  // Test for intersection with the projected Frame
+  return
+    FMBTestIntersectionProj2DTime(
+      that->type,
+      tho->type,
+      &thoProj,
+      bdgBox);
+
+}
+
+// Test for intersection between the Frame that and each of the nbTho
+// Frames in the array thos
+// The result for thos[i] is stored in the i-th bit of the bitset
+// isIntersecting, which must have at least FMBBitsetNbWords(nbTho)
+// words (cf frame.h)
+// If bdgBoxes is not null, the AABB of the intersection with thos[i]
+// is stored into bdgBoxes[i] if the Frames are intersecting, else
+// bdgBoxes[i] is not modified
+// The results are identical to FMBTestIntersection2DTime(that, thos + i,
+// bdgBoxes + i), but the Frames are projected by chunks sharing the
+// setup of that
+void FMBTestIntersection2DTimeBatch(
+  const Frame2DTime* const that,
+  const Frame2DTime* const thos,
+  const int nbTho,
+  unsigned long* const isIntersecting,
+  AABB2DTime* const bdgBoxes) {
+
+  // Reset the bitset
+  int nbWords = FMBBitsetNbWords(nbTho);
+  for (
+    int iWord = nbWords;
+    iWord--;) {
+
+    isIntersecting[iWord] = 0UL;
+
+  }
+
+  // Shortcut
+  const FrameType thatType = that->type;
+
+  // Declare a variable to memorize the projected Frames of the
+  // current chunk
+  Frame2DTime thosProj[FMB_BATCH_CHUNK];
+
+  // Loop on chunks of Frames
+  for (
+    int iStart = 0;
+    iStart < nbTho;
+    iStart += FMB_BATCH_CHUNK) {
+
+    // Get the number of Frames in this chunk
+    int nbChunk = nbTho - iStart;
+    if (nbChunk > FMB_BATCH_CHUNK) {
+
+      nbChunk = FMB_BATCH_CHUNK;
+
+    }
+
+    // Project the Frames of the chunk in that's coordinates system
+    Frame2DTimeImportFrames(
+      that,
+      thos + iStart,
+      nbChunk,
+      thosProj);
+
+    // Loop on the projected Frames
+    for (
+      int iChunk = 0;
+      iChunk < nbChunk;
+      ++iChunk) {
+
+      // Test the intersection
+      int iTho = iStart + iChunk;
+      bool isInter =
+        FMBTestIntersectionProj2DTime(
+          thatType,
+          thosProj[iChunk].type,
+          thosProj + iChunk,
+          (bdgBoxes != NULL ? bdgBoxes + iTho : NULL));
+
+      // Memorize the result
+      if (isInter == true) {
+
+        FMBBitsetSet(isIntersecting, iTho);
+
+      }
+
+    }
+
+  }
+
+}
+
+// Set the axes used as filters by the hybrid intersection test
+void FMBSetHybridAxes2DTime(const unsigned int axes) {
+
+  atomic_store_explicit(
+    &fmbHybridAxes2DTime,
+    axes,
+    memory_order_relaxed);
+
+}
+
+// Get the axes currently used as filters by the hybrid intersection
+// test
+unsigned int FMBGetHybridAxes2DTime(void) {
+
+  return
+    atomic_load_explicit(
+      &fmbHybridAxes2DTime,
+      memory_order_relaxed);
+
+}
+
+// Test for intersection between Frame that and Frame tho, checking
+// first the SAT axes selected by FMBSetHybridAxes2DTime
+bool FMBHybridTestIntersection2DTime(
+  const Frame2DTime* const that,
+  const Frame2DTime* const tho,
+  AABB2DTime* const bdgBox) {
+
+  // If one of the filter axes separates the Frames
+  bool isIntersection =
+    SATCheckFaces2DTime(
+      that,
+      tho,
+      atomic_load_explicit(
+        &fmbHybridAxes2DTime,
+        memory_order_relaxed));
+  if (isIntersection == false) {
+
+    // The Frames are not in intersection,
+    // terminate the test
+    return false;
+
+  }
+
+  // Else, confirm with FMB
+  return
+    FMBTestIntersection2DTime(
+      that,
+      tho,
+      bdgBox);
+
+}
@@ -25,6 +25,17 @@
 
 // ------------- Functions declaration -------------
 
+// Get the statistics of the Fourier-Motzkin elimination in
+// FMBTestIntersection2DTime since the last reset (cf frame.h), recorded
+// only if FMB_ELIM_STATS is defined at compilation and added over all
+// the threads, this function and FMBResetElimStats2DTime must not be
+// called while another thread is running FMBTestIntersection2DTime
+FMBElimStats FMBGetElimStats2DTime(void);
+
+// Reset the statistics of the Fourier-Motzkin elimination of all the
+// threads
+void FMBResetElimStats2DTime(void);
+
 // Test for intersection between Frame that and Frame tho
 // Return true if the two Frames are intersecting, else false
 // If the Frame are intersecting the AABB of the intersection
@@ -36,8 +47,55 @@
 // of the resulting AABB of FMBTestIntersection(B,A)
 // The resulting AABB is given in tho's local coordinates system
 bool FMBTestIntersection2DTime(
-  Frame2DTime* const that,
+  const Frame2DTime* const that,
   const Frame2DTime* const tho,
   AABB2DTime* const bdgBox);
 
+// Set the axes used as filters by FMBHybridTestIntersection2DTime, the
+// normals to the edges of the Frames selected by axes (cf
+// FMB_HYBRID_AXES_ALL in frame.h)
+// The default ones are FMB2DTIME_HYBRID_AXES, FMB_HYBRID_AXES_ALL unless
+// defined otherwise at compilation (for example
+// -DFMB2DTIME_HYBRID_AXES=FMB_HYBRID_AXES_THAT)
+void FMBSetHybridAxes2DTime(const unsigned int axes);
+
+// Get the axes currently used as filters by
+// FMBHybridTestIntersection2DTime
+unsigned int FMBGetHybridAxes2DTime(void);
+
+// Test for intersection between Frame that and Frame tho
+// Return true if the two Frames are intersecting, else false, and
+// store the AABB of the intersection into bdgBox, as
+// FMBTestIntersection2DTime
+// The normals to the edges selected by FMBSetHybridAxes2DTime are
+// checked first with SAT (cf SATCheckFaces2DTime), and
+// FMBTestIntersection2DTime is run only if none of them separates the
+// Frames
+// Cost: on random pairs (cf QualifyHybrid2DTime) non intersecting
+// pairs cost about 0.55 times FMBTestIntersection2DTime with all the
+// axes, while intersecting pairs cost FMBTestIntersection2DTime plus
+// the filter, about 1.15 times FMBTestIntersection2DTime
+bool FMBHybridTestIntersection2DTime(
+  const Frame2DTime* const that,
+  const Frame2DTime* const tho,
+  AABB2DTime* const bdgBox);
+
+// Test for intersection between the Frame that and each of the nbTho
+// Frames in the array thos
+// The result for thos[i] is stored in the i-th bit of the bitset
+// isIntersecting, which must have at least FMBBitsetNbWords(nbTho)
+// words (cf frame.h)
+// If bdgBoxes is not null, the AABB of the intersection with thos[i]
+// is stored into bdgBoxes[i] if the Frames are intersecting, else
+// bdgBoxes[i] is not modified
+// The results are identical to FMBTestIntersection2DTime(that, thos + i,
+// bdgBoxes + i), but the Frames are projected by chunks sharing the
+// setup of that
+void FMBTestIntersection2DTimeBatch(
+  const Frame2DTime* const that,
+  const Frame2DTime* const thos,
+  const int nbTho,
+  unsigned long* const isIntersecting,
+  AABB2DTime* const bdgBoxes);
+
 #endif
@@ -29,9 +29,9 @@
 int main(int argc, char** argv) {
 
   // Create the two objects to be tested for intersection
-  double origP2DTime[2] = {0.0, 0.0};
-  double speedP2DTime[2] = {0.0, 0.0};
-  double compP2DTime[2][2] = {
+  FMB_REAL origP2DTime[2] = {0.0, 0.0};
+  FMB_REAL speedP2DTime[2] = {0.0, 0.0};
+  FMB_REAL compP2DTime[2][2] = {
 
     {1.0, 0.0},  // First component
     {0.0, 1.0}   // Second component
@@ -44,9 +44,9 @@ int main(int argc, char** argv) {
       speedP2DTime,
       compP2DTime);
 
-  double origQ2DTime[2] = {0.0, 0.0};
-  double speedQ2DTime[2] = {0.0, 0.0};
-  double compQ2DTime[2][2] = {{1.0, 0.0}, {0.0, 1.0}};
+  FMB_REAL origQ2DTime[2] = {0.0, 0.0};
+  FMB_REAL speedQ2DTime[2] = {0.0, 0.0};
+  FMB_REAL compQ2DTime[2][2] = {{1.0, 0.0}, {0.0, 1.0}};
   Frame2DTime Q2DTime =
     Frame2DTimeCreateStatic(
       FrameCuboid,
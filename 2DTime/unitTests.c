@@ -28,13 +28,16 @@
 // Epsilon for numerical precision
 #define EPSILON 0.0001
 
+// Pi
+#define PI 3.14159265358979323846
+
 // Helper structure to pass arguments to the UnitTest function
 typedef struct {
 
   FrameType type;
-  double orig[2];
-  double comp[2][2];
-  double speed[2];
+  FMB_REAL orig[2];
+  FMB_REAL comp[2][2];
+  FMB_REAL speed[2];
 
 } Param2DTime;
 
@@ -176,6 +179,164 @@ void UnitTest2DTime(
 
 }
 
+// Check if the Frames A and B are identical (including their inverse
+// components and bounding box)
+bool IsSameFrame2DTime(
+  const Frame2DTime* const A,
+  const Frame2DTime* const B) {
+
+  for (
+    int i = 2;
+    i--;) {
+
+    if (fabs(A->orig[i] - B->orig[i]) > EPSILON) {
+
+      return false;
+
+    }
+
+    for (
+      int j = 2;
+      j--;) {
+
+      if (
+        fabs(A->comp[i][j] - B->comp[i][j]) > EPSILON ||
+        fabs(A->invComp[i][j] - B->invComp[i][j]) > EPSILON) {
+
+        return false;
+
+      }
+
+    }
+
+  }
+
+  for (
+    int i = 3;
+    i--;) {
+
+    if (
+      fabs(A->bdgBox.min[i] - B->bdgBox.min[i]) > EPSILON ||
+      fabs(A->bdgBox.max[i] - B->bdgBox.max[i]) > EPSILON) {
+
+      return false;
+
+    }
+
+  }
+
+  return true;
+
+}
+
+// Unit test of the functions modifying a Frame
+// Translate, rotate, set the components and set the motion of a Frame
+// and check the result against the same Frame created from scratch
+void UnitTestMutation2DTime(void) {
+
+  // Create the Frame to be modified
+  FMB_REAL orig[2] = {0.0, 0.0};
+  FMB_REAL speed[2] = {0.5, -0.5};
+  FMB_REAL comp[2][2] = {{1.0, 0.0}, {0.0, 1.0}};
+  Frame2DTime P =
+    Frame2DTimeCreateStatic(
+      FrameCuboid,
+      orig,
+      speed,
+      comp);
+
+  // Translate and rotate the Frame
+  FMB_REAL v[2] = {1.0, 2.0};
+  Frame2DTimeTranslate(
+    &P,
+    v);
+  Frame2DTimeRotate(
+    &P,
+    PI * 0.5);
+
+  // Create the expected Frame
+  FMB_REAL origExpected[2] = {1.0, 2.0};
+  FMB_REAL compRot[2][2] = {{0.0, 1.0}, {-1.0, 0.0}};
+  Frame2DTime Q =
+    Frame2DTimeCreateStatic(
+      FrameCuboid,
+      origExpected,
+      speed,
+      compRot);
+
+  // Check the result
+  if (IsSameFrame2DTime(&P, &Q) == false) {
+
+    printf("UnitTestMutation2DTime translate/rotate Failed\n");
+    printf("Expected : ");
+    Frame2DTimePrint(&Q);
+    printf("\n     Got : ");
+    Frame2DTimePrint(&P);
+    printf("\n");
+    exit(0);
+
+  }
+
+  // Set the components of the Frame
+  FMB_REAL compSet[2][2] = {{2.0, 0.5}, {0.0, 2.0}};
+  Frame2DTimeSetComp(
+    &P,
+    compSet);
+
+  // Create the expected Frame
+  Q =
+    Frame2DTimeCreateStatic(
+      FrameCuboid,
+      origExpected,
+      speed,
+      compSet);
+
+  // Check the result
+  if (IsSameFrame2DTime(&P, &Q) == false) {
+
+    printf("UnitTestMutation2DTime set components Failed\n");
+    printf("Expected : ");
+    Frame2DTimePrint(&Q);
+    printf("\n     Got : ");
+    Frame2DTimePrint(&P);
+    printf("\n");
+    exit(0);
+
+  }
+
+  // Set the origin and speed of the Frame
+  FMB_REAL origSet[2] = {-1.0, 0.5};
+  FMB_REAL speedSet[2] = {1.0, -2.0};
+  Frame2DTimeSetMotion(
+    &P,
+    origSet,
+    speedSet);
+
+  // Create the expected Frame
+  Q =
+    Frame2DTimeCreateStatic(
+      FrameCuboid,
+      origSet,
+      speedSet,
+      compSet);
+
+  // Check the result
+  if (IsSameFrame2DTime(&P, &Q) == false) {
+
+    printf("UnitTestMutation2DTime set motion Failed\n");
+    printf("Expected : ");
+    Frame2DTimePrint(&Q);
+    printf("\n     Got : ");
+    Frame2DTimePrint(&P);
+    printf("\n");
+    exit(0);
+
+  }
+
+  printf("UnitTestMutation2DTime Succeed\n\n");
+
+}
+
 void Test2DTime(void) {
 
   // Declare two variables to memorize the arguments to the
@@ -349,6 +510,9 @@ void Test2DTime(void) {
     true,
     &correctBdgBox);
 
+  // ----------------------------
+  UnitTestMutation2DTime();
+
   // If we reached here, it means all the unit tests succeed
   printf("All unit tests 2DTime have succeed.\n");
 
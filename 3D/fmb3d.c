@@ -18,6 +18,8 @@
 */
 
 #include "fmb3d.h"
+#include "sat.h"
+#include "frameinternal.h"
 
 // ------------- Macros -------------
 
@@ -31,7 +33,139 @@
 #define SND_VAR 1
 #define THD_VAR 2
 
-#define EPSILON 0.0000001
+#define EPSILON FMB_EPSILON
+
+// Number of Frames projected at once by the batch intersection test
+#define FMB_BATCH_CHUNK 32
+
+// Default implementation of the Fourier-Motzkin elimination
+#ifndef FMB3D_ELIM_MODE
+  #define FMB3D_ELIM_MODE FMBElimModeScalar
+#endif
+
+// Default order of elimination of the variables
+#ifndef FMB3D_ELIM_ORDER
+  #define FMB3D_ELIM_ORDER FMBElimOrderFixed
+#endif
+
+// Maximum number of rows with a non null coefficient of the
+// eliminated variable in the systems given to ElimVar3DSIMD, multiple
+// of FRAME_SIMD_WIDTH_MAX (cf the size of Mp in
+// FMBTestIntersectionProj3D)
+#define FMB3D_ELIM_MAX_ROWS 32
+
+// Default axes used as filters by the hybrid intersection test, none
+// as the filter slows down the test on random pairs (cf
+// FMBHybridTestIntersection3D)
+#ifndef FMB3D_HYBRID_AXES
+  #define FMB3D_HYBRID_AXES FMB_HYBRID_AXES_NONE
+#endif
+
+// ------------- Global variables -------------
+
+// Axes currently used as filters by the hybrid intersection test,
+// atomic as they may be changed while other threads are running it
+static _Atomic unsigned int fmbHybridAxes3D = FMB3D_HYBRID_AXES;
+
+// Implementation of the Fourier-Motzkin elimination currently used,
+// atomic for the same reason
+static _Atomic FMBElimMode fmbElimMode3D = FMB3D_ELIM_MODE;
+
+// Order of elimination of the variables currently used, atomic as it
+// may be changed while other threads are running the intersection
+// tests, each test reading it once
+static _Atomic FMBElimOrder fmbElimOrder3D = FMB3D_ELIM_ORDER;
+
+// Number of rows of the system and of its successive eliminations for
+// each pair of types (C for Cuboid, T for Tetrahedron, that first).
+// The number of rows of the system is exact. The numbers of rows
+// after the eliminations are their maximum given by the pattern of
+// signs: eliminating a variable with p positive, n negative and z
+// null coefficients gives p.n+z rows, the rows of the constraints on
+// tho (0<=X_i<=1 for a Cuboid, 0<=X_i and sum_iX_i<=1 for a
+// Tetrahedron) having a known sign and the other ones any sign. These
+// maximums hold for any order of elimination (cf
+// FMBElimOrderAdaptive): the constraints on tho are unchanged by a
+// permutation of the variables, and the rows of the constraints on
+// that with their columns permuted are still rows of any sign, hence
+// eliminating the variables in any order is eliminating them in the
+// order of the axes in another system with the same pattern of signs
+#define FMB3D_NB_ROWS_CC 12
+#define FMB3D_NB_ROWS_P_CC 20
+#define FMB3D_NB_ROWS_PP_CC 83
+#define FMB3D_NB_ROWS_CT 10
+#define FMB3D_NB_ROWS_P_CT 18
+#define FMB3D_NB_ROWS_PP_CT 73
+#define FMB3D_NB_ROWS_TC 10
+#define FMB3D_NB_ROWS_P_TC 13
+#define FMB3D_NB_ROWS_PP_TC 32
+#define FMB3D_NB_ROWS_TT 8
+#define FMB3D_NB_ROWS_P_TT 11
+#define FMB3D_NB_ROWS_PP_TT 26
+
+// Number of rows of the system solved by FMBTestIntersection3DExact
+// and of its successive eliminations. The number of rows of the
+// system is its maximum (two Cuboids). The numbers of rows after the
+// eliminations are their maximum given by the pattern of signs, the
+// variables being the world coordinates there is no known sufficient
+// smaller value
+#define FMB3D_NB_ROWS_EXACT 12
+#define FMB3D_NB_ROWS_P_EXACT 36
+#define FMB3D_NB_ROWS_PP_EXACT 324
+
+// Initial relaxation of the rows of the system solved by
+// FMBTestIntersection3DExact on touching Frames, a thousandth of the
+// tolerance of FMBTestIntersection3D (cf FMB_EPSILON in frame.h)
+#define FMB3D_EXACT_RELAX (0.001 * EPSILON)
+
+// Pruning of redundant rows between eliminations, cf FMBSetPruning3D,
+// atomic as the other settings of the intersection tests
+#ifdef FMB3D_PRUNING
+  static _Atomic bool fmbPruning3D = true;
+#else
+  static _Atomic bool fmbPruning3D = false;
+#endif
+
+// Statistics of the pruning, accumulated per thread (cf FrameStats)
+FRAME_STATS_DEFINE(
+  FMBPruneStats,
+  fmbPruneStats3D,
+  FMBPruneStatsMerge)
+
+// Statistics of the elimination, cf FMB_ELIM_STATS, accumulated per
+// thread (cf FrameStats)
+FRAME_STATS_DEFINE(
+  FMBElimStats,
+  fmbElimStats3D,
+  FMBElimStatsMerge)
+
+// Relative tolerance of the float computation of the mixed precision
+// intersection test: a float value closer than FMB3D_MIXED_EPSILON
+// times its magnitude to a threshold is considered uncertain
+// (cf FMBTestIntersection3DMixed)
+#define FMB3D_MIXED_EPSILON 0.0001f
+
+// Results of the float computation of the mixed precision
+// intersection test
+typedef enum {
+
+  FMBMixedNoInter,
+  FMBMixedInter,
+  FMBMixedUncertain
+
+} FMBMixedResult;
+
+// Add the FMBMixedStats from to the FMBMixedStats to
+static void FMBMixedStatsMerge(
+  void* const to,
+  const void* const from);
+
+// Statistics of the mixed precision intersection test, accumulated
+// per thread (cf FrameStats)
+FRAME_STATS_DEFINE(
+  FMBMixedStats,
+  fmbMixedStats3D,
+  FMBMixedStatsMerge)
 
 // ------------- Functions declaration -------------
 
@@ -39,17 +173,46 @@
 // using the Fourier-Motzkin method and return
 // the resulting system in Mp and Yp, and the number of rows of
 // the resulting system in nbRemainRows
-// Return false if the system becomes inconsistent during elimination,
-// else return true
-bool ElimVar3D(
-  const double (*M)[3],
-  const double* Y,
+// Return true if the system becomes inconsistent during elimination,
+// else return false
+// (cf fmb3dsolve.h)
+static bool ElimVar3D(
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
   const int nbRows,
   const int nbCols,
-  double (*Mp)[3],
-  double* Yp,
+  FMB_REAL (*Mp)[3],
+  FMB_REAL* Yp,
   int* const nbRemainRows);
 
+// Same as ElimVar3D, except the rows are first sorted by sign of the
+// eliminated variable and normalized, then each positive row is
+// combined with FrameSIMDWidth(path) negative rows at once, with the
+// kernel of the FrameCPUPath path (cf fmb3dsimd.h)
+// The resulting rows are the same as the ones of ElimVar3D, in a
+// different order
+static inline bool ElimVar3DSIMD(
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
+  const int nbRows,
+  const int nbCols,
+  FMB_REAL (*Mp)[3],
+  FMB_REAL* Yp,
+  int* const nbRemainRows,
+  const FrameCPUPath path);
+
+// Call ElimVar3D or ElimVar3DSIMD according to the current
+// implementation of the Fourier-Motzkin elimination
+static inline bool ElimVar3DSelect(
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
+  const int nbRows,
+  const int nbCols,
+  FMB_REAL (*Mp)[3],
+  FMB_REAL* Yp,
+  int* const nbRemainRows,
+  const FrameCPUPath path);
+
 // Get the bounds of the iVar-th variable in the nbRows rows
 // system M.X<=Y which has been reduced to only one variable
 // and store them in the iVar-th axis of the
@@ -57,10 +220,11 @@ bool ElimVar3D(
 // (M arrangement is [iRow][iCol])
 // May return inconsistent values (max < min), which would
 // mean the system has no solution
-void GetBoundLastVar3D(
+// (cf fmb3dsolve.h)
+static void GetBoundLastVar3D(
   const int iVar,
-  const double (*M)[3],
-  const double* Y,
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
   const int nbRows,
   AABB3D* const bdgBox);
 
@@ -68,228 +232,399 @@ void GetBoundLastVar3D(
 // system M.X<=Y where the iVar-th variable is on the first column
 // and store them in the iVar-th axis of the AABB bdgBox
 // (M arrangement is [iRow][iCol])
-void GetBoundVar3D(
+static void GetBoundVar3D(
   const int iVar,
-  const double (*M)[3],
-  const double* Y,
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
   const int nbRows,
   const int nbCols,
   AABB3D* const bdgBox);
 
-// ------------- Functions implementation -------------
-
-// Eliminate the first variable in the system M.X<=Y
-// using the Fourier-Motzkin method and return
-// the resulting system in Mp and Yp, and the number of rows of
-// the resulting system in nbRemainRows
-// (M arrangement is [iRow][iCol])
-// Return true if the system becomes inconsistent during elimination,
-// else return false
-bool ElimVar3D(
-  const double (*M)[3],
-  const double* Y,
+// Remove the redundant rows of the nbRows rows system M.X<=Y, moving
+// the nbKeptRows kept rows at the beginning of the system
+// (cf FMBSetPruning3D)
+static void PruneRows3D(
+  FMB_REAL (*M)[3],
+  FMB_REAL* Y,
   const int nbRows,
   const int nbCols,
-  double (*Mp)[3],
-  double* Yp,
-  int* const nbRemainRows) {
-
-  // Initialize the number of rows in the result system
-  int nbResRows = 0;
-
-  // First we process the rows where the eliminated variable is not null
-  // For each row except the last one
-  for (
-    int iRow = 0;
-    iRow < nbRows - 1;
-    ++iRow) {
-
-    // Shortcuts
-    const double fabsMIRowIVar = fabs(M[iRow][0]);
-
-    // If the coefficient for the eliminated variable is not null
-    // in this row
-    if (fabsMIRowIVar > EPSILON) {
-
-      // Shortcuts
-      const double* MiRow = M[iRow];
-      const int sgnMIRowIVar = sgn(MiRow[0]);
-      const double YIRowDivideByFabsMIRowIVar = Y[iRow] / fabsMIRowIVar;
-
-      // For each following rows
-      for (
-        int jRow = iRow + 1;
-        jRow < nbRows;
-        ++jRow) {
-
-        // If coefficients of the eliminated variable in the two rows have
-        // different signs and are not null
-        if (
-          sgnMIRowIVar != sgn(M[jRow][0]) &&
-          fabs(M[jRow][0]) > EPSILON) {
-
-          // Shortcuts
-          const double* MjRow = M[jRow];
-          const double fabsMjRow = fabs(MjRow[0]);
-
-          // Declare a variable to memorize the sum of the negative
-          // coefficients in the row
-          double sumNegCoeff = 0.0;
-
-          // Add the sum of the two normed (relative to the eliminated
-          // variable) rows into the result system. This actually
-          // eliminate the variable while keeping the constraints on
-          // others variables
-          for (
-            int iCol = 1;
-            iCol < nbCols;
-            ++iCol ) {
-
-            Mp[nbResRows][iCol - 1] =
-              MiRow[iCol] / fabsMIRowIVar +
-              MjRow[iCol] / fabsMjRow;
-
-            // Update the sum of the negative coefficient
-            sumNegCoeff += neg(Mp[nbResRows][iCol - 1]);
-
-          }
-
-          // Update the right side of the inequality
-          Yp[nbResRows] =
-            YIRowDivideByFabsMIRowIVar +
-            Y[jRow] / fabsMjRow;
-
-          // If the right side of the inequality is lower than the sum of
-          // negative coefficients in the row
-          // (Add epsilon for numerical imprecision)
-          if (Yp[nbResRows] < sumNegCoeff - EPSILON) {
-
-            // Given that X is in [0,1], the system is inconsistent
-            return true;
-
-          }
-
-          // Increment the nb of rows into the result system
-          ++nbResRows;
-
-        }
-
-      }
+  int* const nbKeptRows);
+
+// Exchange the iRow-th and jRow-th rows of the system M.X<=Y
+static inline void SwapRows3D(
+  FMB_REAL (*M)[3],
+  FMB_REAL* Y,
+  const int iRow,
+  const int jRow);
+
+// Return the index of the column among the nbCols ones of the nbRows
+// rows system M.X<=Y whose elimination gives the smallest system
+// (cf FMBElimOrderAdaptive)
+static inline int ChooseElimVar3D(
+  const FMB_REAL (*M)[3],
+  const int nbRows,
+  const int nbCols);
 
-    }
+// Exchange the iCol-th and jCol-th columns of the nbRows rows system
+// M.X<=Y
+static inline void SwapCols3D(
+  FMB_REAL (*M)[3],
+  const int nbRows,
+  const int iCol,
+  const int jCol);
+
+// Kernels testing the intersection for each pair of types, C for
+// Cuboid and T for Tetrahedron, the first letter being the type of
+// that and the second the type of tho, with the elimination of the
+// FrameCPUPath path (cf fmb3dsolve.h)
+static inline bool FMBTestIntersectionProj3DCCPath(
+  const Frame3D* const thoProj,
+  AABB3D* const bdgBox,
+  const FrameCPUPath path);
+static inline bool FMBTestIntersectionProj3DCTPath(
+  const Frame3D* const thoProj,
+  AABB3D* const bdgBox,
+  const FrameCPUPath path);
+static inline bool FMBTestIntersectionProj3DTCPath(
+  const Frame3D* const thoProj,
+  AABB3D* const bdgBox,
+  const FrameCPUPath path);
+static inline bool FMBTestIntersectionProj3DTTPath(
+  const Frame3D* const thoProj,
+  AABB3D* const bdgBox,
+  const FrameCPUPath path);
+
+// Implementations of the kernels for each FrameCPUPath
+FRAME_CPU_VARIANTS_PATH(
+  bool,
+  FMBTestIntersectionProj3DCC,
+  (
+    const Frame3D* const thoProj,
+    AABB3D* const bdgBox),
+  (thoProj, bdgBox))
+FRAME_CPU_VARIANTS_PATH(
+  bool,
+  FMBTestIntersectionProj3DCT,
+  (
+    const Frame3D* const thoProj,
+    AABB3D* const bdgBox),
+  (thoProj, bdgBox))
+FRAME_CPU_VARIANTS_PATH(
+  bool,
+  FMBTestIntersectionProj3DTC,
+  (
+    const Frame3D* const thoProj,
+    AABB3D* const bdgBox),
+  (thoProj, bdgBox))
+FRAME_CPU_VARIANTS_PATH(
+  bool,
+  FMBTestIntersectionProj3DTT,
+  (
+    const Frame3D* const thoProj,
+    AABB3D* const bdgBox),
+  (thoProj, bdgBox))
+
+// Dispatch table of the kernels, [FrameCPUPath][thatType][thoType]
+static bool (* const fmbKernels3D[FrameCPUNb][2][2])(
+  const Frame3D* const,
+  AABB3D* const) = {
+
+  {
+
+    {
+      FMBTestIntersectionProj3DCCGeneric,
+      FMBTestIntersectionProj3DCTGeneric},
+    {
+      FMBTestIntersectionProj3DTCGeneric,
+      FMBTestIntersectionProj3DTTGeneric}
+
+  },
+  {
+
+    {
+      FMBTestIntersectionProj3DCCSSE2,
+      FMBTestIntersectionProj3DCTSSE2},
+    {
+      FMBTestIntersectionProj3DTCSSE2,
+      FMBTestIntersectionProj3DTTSSE2}
+
+  },
+  {
+
+    {
+      FMBTestIntersectionProj3DCCAVX2,
+      FMBTestIntersectionProj3DCTAVX2},
+    {
+      FMBTestIntersectionProj3DTCAVX2,
+      FMBTestIntersectionProj3DTTAVX2}
+
+  },
+  {
+
+    {
+      FMBTestIntersectionProj3DCCAVX512,
+      FMBTestIntersectionProj3DCTAVX512},
+    {
+      FMBTestIntersectionProj3DTCAVX512,
+      FMBTestIntersectionProj3DTTAVX512}
 
   }
 
-  // Then we copy and compress the rows where the eliminated
-  // variable is null
-  // Loop on rows of the input system
-  for (
-    int iRow = 0;
-    iRow < nbRows;
-    ++iRow) {
-
-    // Shortcut
-    const double* MiRow = M[iRow];
-
-    // If the coefficient of the eliminated variable is null on
-    // this row
-    if (fabs(MiRow[0]) < EPSILON) {
-
-      // Shortcut
-      double* MpnbResRows = Mp[nbResRows];
+};
 
-      // Copy this row into the result system excluding the eliminated
-      // variable
-      for (
-        int iCol = 1;
-        iCol < nbCols;
-        ++iCol) {
+// Test for intersection between a Frame of type thatType and the
+// Frame thoProj of type thoType, projection of tho in that's
+// coordinates system
+// (cf FMBTestIntersection3D)
+static inline bool FMBTestIntersectionProj3D(
+  const FrameType thatType,
+  const FrameType thoType,
+  const Frame3D* const thoProj,
+  AABB3D* const bdgBox);
 
-        MpnbResRows[iCol - 1] = MiRow[iCol];
+// Add to the system M.U<=Y, starting at its nbRows-th row, the
+// inequalities defining the inside of the Frame frame, where U are
+// the world coordinates normalized in the AABB of origin orig and
+// size dim (W=orig+dim*U)
+// Return the number of rows of the system after the addition
+static int FMBExactAddFrame3D(
+  const Frame3D* const frame,
+  const FMB_REAL orig[3],
+  const FMB_REAL dim[3],
+  FMB_REAL (*M)[3],
+  FMB_REAL* Y,
+  int nbRows);
+
+// Get the exact bounds of the iAxis-th variable of the nbRows rows
+// system M.U<=Y, where U is in [0,1], by eliminating the two other
+// variables, and store them in the iAxis-th axis of bdgBox
+// Return false if the system is inconsistent, else true
+static bool FMBExactBound3D(
+  const int iAxis,
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
+  const int nbRows,
+  AABB3D* const bdgBox);
 
-      }
+// Get the exact bounds of the nbRows rows system M.U<=Y on each axis
+// and store them in bdgBox
+// Return false if the system is inconsistent, else true
+static bool FMBExactBounds3D(
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
+  const int nbRows,
+  AABB3D* const bdgBox);
 
-      Yp[nbResRows] = Y[iRow];
+// Create in row.X<=y the iRow-th inequality of the system of the
+// intersection between a Frame of type thatType and the Frame thoProj
+// of type thoType, projection of tho in that's coordinates system,
+// with the rows in the same order as FMBTestIntersectionSolve3D
+static inline void FMBGetRow3D(
+  const FrameType thatType,
+  const FrameType thoType,
+  const Frame3D* const thoProj,
+  const int iRow,
+  FMB_REAL* const row,
+  FMB_REAL* const y);
+
+// Same as ElimVar3D, where masks are the sets of rows of the original
+// system the rows of M.X<=Y are combinations of, masksP receives the
+// ones of the resulting system, and maskSep the one of the row which
+// made the system inconsistent
+static inline bool ElimVarWitness3D(
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
+  const unsigned int* masks,
+  const int nbRows,
+  const int nbCols,
+  FMB_REAL (*Mp)[3],
+  FMB_REAL* Yp,
+  unsigned int* masksP,
+  int* const nbRemainRows,
+  unsigned int* const maskSep);
+
+// Return the union of the sets of rows masks of the rows giving the
+// bounds of the last variable in the nbRows rows system M.X<=Y, as
+// found by GetBoundLastVar3D
+static unsigned int GetBoundWitness3D(
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
+  const unsigned int* masks,
+  const int nbRows);
+
+// Search the witness of the inconsistency of the nbRows rows system
+// M.X<=Y, where X is in [0,1]: the set of rows of the system which are
+// inconsistent by themselves (cf FMBTestIntersection3DCached)
+// Return true and store the set in witness if the system is
+// inconsistent, else return false
+static bool FMBGetWitness3D(
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
+  const int nbRows,
+  unsigned int* const witness);
 
-      // Increment the nb of rows into the result system
-      ++nbResRows;
+// ------------- Functions implementation -------------
 
-    }
+// Implementations of ElimVar3DSIMD for each FrameCPUPath, vectorized
+// on the width of the path (cf framesimd.h)
+#define FRAME_SIMD_PATH FRAME_SIMD_GENERIC
+#include "fmb3dsimd.h"
+#define FRAME_SIMD_PATH FRAME_SIMD_SSE2
+#include "fmb3dsimd.h"
+#define FRAME_SIMD_PATH FRAME_SIMD_AVX2
+#include "fmb3dsimd.h"
+#define FRAME_SIMD_PATH FRAME_SIMD_AVX512
+#include "fmb3dsimd.h"
+
+// Same as ElimVar3D, except the rows are first sorted by sign of the
+// eliminated variable and normalized, then each positive row is
+// combined with FrameSIMDWidth(path) negative rows at once, with the
+// kernel of the FrameCPUPath path (cf fmb3dsimd.h)
+// The path being constant in the callers, the selection of the kernel
+// is resolved at compilation
+static inline bool ElimVar3DSIMD(
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
+  const int nbRows,
+  const int nbCols,
+  FMB_REAL (*Mp)[3],
+  FMB_REAL* Yp,
+  int* const nbRemainRows,
+  const FrameCPUPath path) {
+
+  switch (path) {
+
+    case FrameCPUSSE2:
+      return
+        ElimVar3DSIMDSSE2(
+          M,
+          Y,
+          nbRows,
+          nbCols,
+          Mp,
+          Yp,
+          nbRemainRows);
+    case FrameCPUAVX2:
+      return
+        ElimVar3DSIMDAVX2(
+          M,
+          Y,
+          nbRows,
+          nbCols,
+          Mp,
+          Yp,
+          nbRemainRows);
+    case FrameCPUAVX512:
+      return
+        ElimVar3DSIMDAVX512(
+          M,
+          Y,
+          nbRows,
+          nbCols,
+          Mp,
+          Yp,
+          nbRemainRows);
+    default:
+      return
+        ElimVar3DSIMDGeneric(
+          M,
+          Y,
+          nbRows,
+          nbCols,
+          Mp,
+          Yp,
+          nbRemainRows);
 
   }
 
-  // Memorize the number of rows in the result system
-  *nbRemainRows = nbResRows;
-
-  // If we reach here the system is not inconsistent
-  return false;
-
 }
 
-// Get the bounds of the iVar-th variable in the nbRows rows
-// system M.X<=Y which has been reduced to only one variable
-// and store them in the iVar-th axis of the
-// AABB bdgBox
-// (M arrangement is [iRow][iCol])
-// May return inconsistent values (max < min), which would
-// mean the system has no solution
-void GetBoundLastVar3D(
-  const int iVar,
-  const double (*M)[3],
-  const double* Y,
+// Call ElimVar3D or ElimVar3DSIMD according to the current
+// implementation of the Fourier-Motzkin elimination
+static inline bool ElimVar3DSelect(
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
   const int nbRows,
-  AABB3D* const bdgBox) {
-
-  // Shortcuts
-  double* min = bdgBox->min + iVar;
-  double* max = bdgBox->max + iVar;
+  const int nbCols,
+  FMB_REAL (*Mp)[3],
+  FMB_REAL* Yp,
+  int* const nbRemainRows,
+  const FrameCPUPath path) {
+
+  FMBElimMode mode =
+    atomic_load_explicit(
+      &fmbElimMode3D,
+      memory_order_relaxed);
+  if (mode == FMBElimModeSIMD) {
+
+    return
+      ElimVar3DSIMD(
+        M,
+        Y,
+        nbRows,
+        nbCols,
+        Mp,
+        Yp,
+        nbRemainRows,
+        path);
 
-  // Initialize the bounds to their maximum maximum and minimum minimum
-  *min = 0.0;
-  *max = 1.0;
+  } else {
 
-  // Loop on rows
-  for (
-    int jRow = 0;
-    jRow < nbRows;
-    ++jRow) {
+    return
+      ElimVar3D(
+        M,
+        Y,
+        nbRows,
+        nbCols,
+        Mp,
+        Yp,
+        nbRemainRows);
 
-    // Shortcut
-    double MjRowiVar = M[jRow][0];
+  }
 
-    // If this row has been reduced to the variable in argument
-    // and it has a strictly positive coefficient
-    if (MjRowiVar > EPSILON) {
+}
 
-      // Get the scaled value of Y for this row
-      double y = Y[jRow] / MjRowiVar;
+// Set the implementation of the Fourier-Motzkin elimination used by
+// FMBTestIntersection3D and FMBTestIntersection3DBatch
+void FMBSetElimMode3D(const FMBElimMode mode) {
 
-      // If the value is lower than the current maximum bound
-      if (*max > y) {
+  atomic_store_explicit(
+    &fmbElimMode3D,
+    mode,
+    memory_order_relaxed);
 
-        // Update the maximum bound
-        *max = y;
+}
 
-      }
+// Get the implementation of the Fourier-Motzkin elimination currently
+// used by the intersection tests
+FMBElimMode FMBGetElimMode3D(void) {
 
-    // Else, if this row has been reduced to the variable in argument
-    // and it has a strictly negative coefficient
-    } else if (MjRowiVar < -EPSILON) {
+  return
+    atomic_load_explicit(
+      &fmbElimMode3D,
+      memory_order_relaxed);
 
-      // Get the scaled value of Y for this row
-      double y = Y[jRow] / MjRowiVar;
+}
 
-      // If the value is greater than the current minimum bound
-      if (*min < y) {
+// Set the order of elimination of the variables used by
+// FMBTestIntersection3D and FMBTestIntersection3DBatch
+void FMBSetElimOrder3D(const FMBElimOrder order) {
 
-        // Update the minimum bound
-        *min = y;
+  atomic_store_explicit(
+    &fmbElimOrder3D,
+    order,
+    memory_order_relaxed);
 
-      }
+}
 
-    }
+// Get the order of elimination of the variables currently used by
+// the intersection tests
+FMBElimOrder FMBGetElimOrder3D(void) {
 
-  }
+  return
+    atomic_load_explicit(
+      &fmbElimOrder3D,
+      memory_order_relaxed);
 
 }
 
@@ -297,17 +632,17 @@ void GetBoundLastVar3D(
 // system M.X<=Y where the iVar-th variable is on the first column
 // and store them in the iVar-th axis of the AABB bdgBox
 // (M arrangement is [iRow][iCol])
-void GetBoundVar3D(
+static void GetBoundVar3D(
   const int iVar,
-  const double (*M)[3],
-  const double* Y,
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
   const int nbRows,
   const int nbCols,
   AABB3D* const bdgBox) {
 
   // Shortcuts
-  double* bdgBoxMin = bdgBox->min;
-  double* bdgBoxMax = bdgBox->max;
+  FMB_REAL* bdgBoxMin = bdgBox->min;
+  FMB_REAL* bdgBoxMax = bdgBox->max;
 
   // Initialize the bounds
   bdgBoxMin[iVar] = 0.0;
@@ -320,16 +655,16 @@ void GetBoundVar3D(
     ++iRow) {
 
     // Shortcuts
-    const double* MIRow = M[iRow];
-    double fabsMIRowIVar = fabs(MIRow[0]);
+    const FMB_REAL* MIRow = M[iRow];
+    FMB_REAL fabsMIRowIVar = fabs(MIRow[0]);
 
     // If the coefficient of the first variable on this row is not null
     if (fabsMIRowIVar > EPSILON) {
 
       // Declare two variables to memorize the min and max of the
       // requested variable in this row
-      double min = -1.0 * Y[iRow];
-      double max = Y[iRow];
+      FMB_REAL min = -1.0 * Y[iRow];
+      FMB_REAL max = Y[iRow];
 
       // Loop on columns except the first one which is the one of the
       // requested variable
@@ -372,297 +707,1472 @@ void GetBoundVar3D(
 
 }
 
-// Test for intersection between Frame that and Frame tho
-// Return true if the two Frames are intersecting, else false
-// If the Frame are intersecting the AABB of the intersection
-// is stored into bdgBox, else bdgBox is not modified
-// If bdgBox is null, the result AABB is not memorized (to use if
-// unnecessary and want to speed up the algorithm)
-// The resulting AABB may be larger than the smallest possible AABB
-// The resulting AABB of FMBTestIntersection(A,B) may be different
-// of the resulting AABB of FMBTestIntersection(B,A)
-// The resulting AABB is given in tho's local coordinates system
-bool FMBTestIntersection3D(
-  Frame3D* const that,
-  const Frame3D* const tho,
-  AABB3D* const bdgBox) {
+// Remove the redundant rows of the nbRows rows system M.X<=Y, where
+// X is in [0,1]: rows identical to another one, rows with the same
+// coefficients as another one and a greater right side, and rows with
+// at least two non null coefficients satisfied by any X in [0,1]
+// (rows with only one non null coefficient are always kept as they
+// bound the variables)
+// The kept rows are moved at the beginning of the system and their
+// number is memorized in nbKeptRows. The removed rows are moved after
+// them instead of being discarded, so the whole system is still
+// available to get the bounds of the variables
+// (M arrangement is [iRow][iCol])
+static void PruneRows3D(
+  FMB_REAL (*M)[3],
+  FMB_REAL* Y,
+  const int nbRows,
+  const int nbCols,
+  int* const nbKeptRows) {
 
-  // Get the projection of the Frame tho in Frame that coordinates
-  // system
-  Frame3D thoProj;
-  Frame3DImportFrame(that, tho, &thoProj);
+  // Initialize the number of kept rows
+  int nbKept = 0;
 
-  // Declare two variables to memorize the system to be solved M.X <= Y
-  // (M arrangement is [iRow][iCol])
-  double M[12][3];
-  double Y[12];
+  // Declare a variable to memorize the statistics of this call, added
+  // to the ones of the thread at the end
+  FMBPruneStats stats = {
 
-  // Create the inequality system
-  // -sum_iC_j,iX_i<=O_j
-  M[0][0] = -thoProj.comp[0][0];
-  M[0][1] = -thoProj.comp[1][0];
-  M[0][2] = -thoProj.comp[2][0];
-  Y[0] = thoProj.orig[0];
-  if (Y[0] < neg(M[0][0]) + neg(M[0][1]) + neg(M[0][2])) {
+    .nbRows = nbRows,
+    .nbDuplicate = 0,
+    .nbDominated = 0,
+    .nbTrivial = 0
 
-    return false;
+  };
 
-  }
+  // Loop on the rows
+  for (
+    int iRow = 0;
+    iRow < nbRows;
+    ++iRow) {
 
-  M[1][0] = -thoProj.comp[0][1];
-  M[1][1] = -thoProj.comp[1][1];
-  M[1][2] = -thoProj.comp[2][1];
-  Y[1] = thoProj.orig[1];
-  if (Y[1] < neg(M[1][0]) + neg(M[1][1]) + neg(M[1][2])) {
+    // Shortcut
+    const FMB_REAL* MiRow = M[iRow];
 
-    return false;
+    // Get the sum of the positive coefficients and the number of
+    // non null coefficients of the row
+    FMB_REAL sumPosCoeff = 0.0;
+    int nbNonNull = 0;
+    for (
+      int iCol = nbCols;
+      iCol--;) {
 
-  }
+      if (MiRow[iCol] > 0.0) {
 
-  M[2][0] = -thoProj.comp[0][2];
-  M[2][1] = -thoProj.comp[1][2];
-  M[2][2] = -thoProj.comp[2][2];
-  Y[2] = thoProj.orig[2];
-  if (Y[2] < neg(M[2][0]) + neg(M[2][1]) + neg(M[2][2])) {
+        sumPosCoeff += MiRow[iCol];
 
-    return false;
+      }
 
-  }
+      if (fabs(MiRow[iCol]) > EPSILON) {
 
-  // Variable to memorize the nb of rows in the system
-  int nbRows = 3;
+        ++nbNonNull;
+
+      }
 
-  if (that->type == FrameCuboid) {
+    }
 
-    // sum_iC_j,iX_i<=1.0-O_j
-    M[nbRows][0] = thoProj.comp[0][0];
-    M[nbRows][1] = thoProj.comp[1][0];
-    M[nbRows][2] = thoProj.comp[2][0];
-    Y[nbRows] = 1.0 - thoProj.orig[0];
-    if (
-      Y[nbRows] < neg(M[nbRows][0]) + neg(M[nbRows][1]) +
-      neg(M[nbRows][2])) {
+    // If the row is satisfied by any X in [0,1]
+    if (nbNonNull >= 2 && sumPosCoeff <= Y[iRow]) {
 
-      return false;
+      // Remove the row (it stays at its position, after the kept rows)
+      ++(stats.nbTrivial);
+      continue;
 
     }
 
-    ++nbRows;
+    // Loop on the kept rows to search one with the same coefficients
+    bool isRemoved = false;
+    for (
+      int jRow = 0;
+      jRow < nbKept && isRemoved == false;
+      ++jRow) {
 
-    M[nbRows][0] = thoProj.comp[0][1];
-    M[nbRows][1] = thoProj.comp[1][1];
-    M[nbRows][2] = thoProj.comp[2][1];
-    Y[nbRows] = 1.0 - thoProj.orig[1];
-    if (
-      Y[nbRows] < neg(M[nbRows][0]) + neg(M[nbRows][1]) +
-      neg(M[nbRows][2])) {
+      // Check if the coefficients are the same
+      bool isSameCoeff = true;
+      for (
+        int iCol = nbCols;
+        iCol-- && isSameCoeff == true;) {
 
-      return false;
+        isSameCoeff = (M[jRow][iCol] == MiRow[iCol]);
 
-    }
+      }
 
-    ++nbRows;
+      if (isSameCoeff == true) {
 
-    M[nbRows][0] = thoProj.comp[0][2];
-    M[nbRows][1] = thoProj.comp[1][2];
-    M[nbRows][2] = thoProj.comp[2][2];
-    Y[nbRows] = 1.0 - thoProj.orig[2];
-    if (
-      Y[nbRows] < neg(M[nbRows][0]) + neg(M[nbRows][1]) +
-      neg(M[nbRows][2])) {
+        // Remove the row with the greater right side, by exchanging
+        // the two rows if it's the kept one
+        isRemoved = true;
+        if (Y[iRow] == Y[jRow]) {
 
-      return false;
+          ++(stats.nbDuplicate);
 
-    }
+        } else {
 
-    ++nbRows;
+          ++(stats.nbDominated);
 
-  } else {
+        }
 
-    // sum_j(sum_iC_j,iX_i)<=1.0-sum_iO_i
-    M[nbRows][0] =
-      thoProj.comp[0][0] + thoProj.comp[0][1] + thoProj.comp[0][2];
-    M[nbRows][1] =
-      thoProj.comp[1][0] + thoProj.comp[1][1] + thoProj.comp[1][2];
-    M[nbRows][2] =
-      thoProj.comp[2][0] + thoProj.comp[2][1] + thoProj.comp[2][2];
-    Y[nbRows] =
-      1.0 - thoProj.orig[0] - thoProj.orig[1] - thoProj.orig[2];
-    if (
-      Y[nbRows] < neg(M[nbRows][0]) + neg(M[nbRows][1]) +
-      neg(M[nbRows][2])) {
+        if (Y[iRow] < Y[jRow]) {
 
-      return false;
+          SwapRows3D(
+            M,
+            Y,
+            iRow,
+            jRow);
+
+        }
+
+      }
 
     }
 
-    ++nbRows;
+    // If the row is kept, move it after the other kept rows
+    if (isRemoved == false) {
+
+      if (iRow != nbKept) {
+
+        SwapRows3D(
+          M,
+          Y,
+          iRow,
+          nbKept);
+
+      }
+
+      ++nbKept;
+
+    }
 
   }
 
-  if (tho->type == FrameCuboid) {
+  // Update the statistics
+  FMBPruneStatsMerge(
+    fmbPruneStats3DThread(),
+    &stats);
 
-    // X_i <= 1.0
-    M[nbRows][0] = 1.0;
-    M[nbRows][1] = 0.0;
-    M[nbRows][2] = 0.0;
-    Y[nbRows] = 1.0;
-    ++nbRows;
+  // Memorize the number of kept rows
+  *nbKeptRows = nbKept;
 
-    M[nbRows][0] = 0.0;
-    M[nbRows][1] = 1.0;
-    M[nbRows][2] = 0.0;
-    Y[nbRows] = 1.0;
-    ++nbRows;
+}
 
-    M[nbRows][0] = 0.0;
-    M[nbRows][1] = 0.0;
-    M[nbRows][2] = 1.0;
-    Y[nbRows] = 1.0;
-    ++nbRows;
+// Exchange the iRow-th and jRow-th rows of the system M.X<=Y
+static inline void SwapRows3D(
+  FMB_REAL (*M)[3],
+  FMB_REAL* Y,
+  const int iRow,
+  const int jRow) {
 
-  } else {
+  for (
+    int iCol = 3;
+    iCol--;) {
 
-    // sum_iX_i<=1.0
-    M[nbRows][0] = 1.0;
-    M[nbRows][1] = 1.0;
-    M[nbRows][2] = 1.0;
-    Y[nbRows] = 1.0;
-    ++nbRows;
+    FMB_REAL tmp = M[iRow][iCol];
+    M[iRow][iCol] = M[jRow][iCol];
+    M[jRow][iCol] = tmp;
 
   }
 
-  // -X_i <= 0.0
-  M[nbRows][0] = -1.0;
-  M[nbRows][1] = 0.0;
-  M[nbRows][2] = 0.0;
-  Y[nbRows] = 0.0;
-  ++nbRows;
+  FMB_REAL tmp = Y[iRow];
+  Y[iRow] = Y[jRow];
+  Y[jRow] = tmp;
 
-  M[nbRows][0] = 0.0;
-  M[nbRows][1] = -1.0;
-  M[nbRows][2] = 0.0;
-  Y[nbRows] = 0.0;
-  ++nbRows;
+}
 
-  M[nbRows][0] = 0.0;
-  M[nbRows][1] = 0.0;
-  M[nbRows][2] = -1.0;
-  Y[nbRows] = 0.0;
-  ++nbRows;
+// Return the index of the column among the nbCols ones of the nbRows
+// rows system M.X<=Y whose elimination gives the smallest system
+// Eliminating a variable with p positive, n negative and z null
+// coefficients gives p.n+z rows, the first column is kept in case of
+// equality to stay as close as possible to the fixed order
+static inline int ChooseElimVar3D(
+  const FMB_REAL (*M)[3],
+  const int nbRows,
+  const int nbCols) {
 
-  // Solve the system
-  // Declare a AABB to memorize the bounding box of the intersection
-  // in the coordinates system of tho
-  AABB3D bdgBoxLocal = {
+  // Count the positive and negative coefficients of each column
+  int nbPos[3] = {0, 0, 0};
+  int nbNeg[3] = {0, 0, 0};
+  for (
+    int iRow = nbRows;
+    iRow--;) {
 
-    .min = {0.0, 0.0, 0.0},
-    .max = {0.0, 0.0, 0.0}
+    for (
+      int iCol = nbCols;
+      iCol--;) {
 
-  };
+      if (M[iRow][iCol] > EPSILON) {
 
-  // Declare variables to eliminate the first variable
-  // The size of the array given in the doc is a majoring value.
-  // Instead I use a smaller value which has proven to be sufficient
-  // during tests, validation and qualification, to avoid running
-  // into the heap limit and to optimize slightly the performance
-  //double Mp[48][3];
-  //double Yp[48];
-  double Mp[20][3];
-  double Yp[20];
-  int nbRowsP;
+        ++(nbPos[iCol]);
 
-  // Eliminate the first variable in the original system
-  bool inconsistency =
-    ElimVar3D(
-      M,
-      Y,
-      nbRows,
-      3,
-      Mp,
-      Yp,
-      &nbRowsP);
+      } else if (M[iRow][iCol] < -EPSILON) {
 
-  // If the system is inconsistent
-  if (inconsistency == true) {
+        ++(nbNeg[iCol]);
 
-    // The two Frames are not in intersection
-    return false;
+      }
+
+    }
 
   }
 
-  // Declare variables to eliminate the second variable
-  // The size of the array given in the doc is a majoring value.
-  // Instead I use a smaller value which has proven to be sufficient
-  // during tests, validation and qualification, to avoid running
-  // into the heap limit and to optimize slightly the performance
-  //double Mpp[624][3];
-  //double Ypp[624];
-  double Mpp[55][3];
-  double Ypp[55];
-  int nbRowsPP;
+  // Search the column giving the smallest system
+  int iColBest = 0;
+  int nbRowsBest = nbPos[0] * nbNeg[0] - nbPos[0] - nbNeg[0];
+  for (
+    int iCol = 1;
+    iCol < nbCols;
+    ++iCol) {
 
-  // Eliminate the second variable (which is the first in the new system)
-  inconsistency =
-    ElimVar3D(
-      Mp,
-      Yp,
-      nbRowsP,
-      2,
-      Mpp,
-      Ypp,
-      &nbRowsPP);
+    int nbRowsCol = nbPos[iCol] * nbNeg[iCol] - nbPos[iCol] - nbNeg[iCol];
+    if (nbRowsCol < nbRowsBest) {
 
-  // If the system is inconsistent
-  if (inconsistency == true) {
+      iColBest = iCol;
+      nbRowsBest = nbRowsCol;
 
-    // The two Frames are not in intersection
-    return false;
+    }
 
   }
 
-  // Get the bounds for the remaining third variable
-  GetBoundLastVar3D(
-    THD_VAR,
-    Mpp,
-    Ypp,
-    nbRowsPP,
-    &bdgBoxLocal);
+  return iColBest;
 
-  // If the bounds are inconsistent
-  if (bdgBoxLocal.min[THD_VAR] >= bdgBoxLocal.max[THD_VAR]) {
+}
 
-    // The two Frames are not in intersection
-    return false;
+// Exchange the iCol-th and jCol-th columns of the nbRows rows system
+// M.X<=Y
+static inline void SwapCols3D(
+  FMB_REAL (*M)[3],
+  const int nbRows,
+  const int iCol,
+  const int jCol) {
 
-  // Else, if the bounds are consistent here it means
-  // the two Frames are in intersection.
-  // If the user has requested for the resulting bounding box
-  } else if (bdgBox != NULL) {
+  for (
+    int iRow = nbRows;
+    iRow--;) {
 
-    // Get the bounds of the other variables
-    GetBoundVar3D(
-      SND_VAR,
-      Mp,
-      Yp,
-      nbRowsP,
-      2,
-      &bdgBoxLocal);
+    FMB_REAL tmp = M[iRow][iCol];
+    M[iRow][iCol] = M[iRow][jCol];
+    M[iRow][jCol] = tmp;
 
-    GetBoundVar3D(
-      FST_VAR,
-      M,
-      Y,
-      nbRows,
-      3,
-      &bdgBoxLocal);
+  }
 
-    // Memorize the result
-    *bdgBox = bdgBoxLocal;
+}
 
-  }
+// Set the use of the pruning of redundant rows between eliminations
+void FMBSetPruning3D(const bool isPruning) {
 
-  // If we've reached here the two Frames are intersecting
+  atomic_store_explicit(
+    &fmbPruning3D,
+    isPruning,
+    memory_order_relaxed);
+
+}
+
+// Get the statistics of the pruning of redundant rows since the last
+// reset
+FMBPruneStats FMBGetPruneStats3D(void) {
+
+  FMBPruneStats stats;
+  FrameStatsGet(
+    &fmbPruneStats3D,
+    &stats);
+  return stats;
+
+}
+
+// Reset the statistics of the pruning of redundant rows
+void FMBResetPruneStats3D(void) {
+
+  FrameStatsReset(&fmbPruneStats3D);
+
+}
+
+// Implementations of the specialized kernels in FMB_REAL, with
+// witness for the test with cache, and in float for the mixed
+// precision test (cf fmb3dsolve.h)
+#include "fmb3dsolve.h"
+#define FMB3D_SOLVE_WITNESS
+#include "fmb3dsolve.h"
+
+// Table of the kernels with witness, [thatType][thoType]
+static bool (* const fmbKernels3DWitness[2][2])(
+  const Frame3D* const,
+  AABB3D* const,
+  unsigned int* const,
+  const FrameCPUPath) = {
+
+  {
+    FMBTestIntersectionProj3DCCWitness,
+    FMBTestIntersectionProj3DCTWitness},
+  {
+    FMBTestIntersectionProj3DTCWitness,
+    FMBTestIntersectionProj3DTTWitness}
+
+};
+#ifndef FMB_REAL_FLOAT
+
+  #define FMB3D_SOLVE_MIXED
+  #include "fmb3dsolve.h"
+
+  // Table of the float kernels, [thatType][thoType]
+  static FMBMixedResult (* const fmbKernels3DMixed[2][2])(
+    const Frame3D* const,
+    AABB3D* const,
+    const FrameCPUPath) = {
+
+    {
+      FMBTestIntersectionProj3DCCMixed,
+      FMBTestIntersectionProj3DCTMixed},
+    {
+      FMBTestIntersectionProj3DTCMixed,
+      FMBTestIntersectionProj3DTTMixed}
+
+  };
+
+#endif
+
+// Test for intersection between a Frame of type thatType and the
+// Frame thoProj of type thoType, projection of tho in that's
+// coordinates system
+// (cf FMBTestIntersection3D)
+static inline bool FMBTestIntersectionProj3D(
+  const FrameType thatType,
+  const FrameType thoType,
+  const Frame3D* const thoProj,
+  AABB3D* const bdgBox) {
+
+  // Call the kernel for this pair of types
+  return
+    fmbKernels3D[FrameGetCPUPath()][thatType][thoType](
+      thoProj,
+      bdgBox);
+
+}
+
+// Get the statistics of the elimination since the last reset
+// (cf frame.h)
+FMBElimStats FMBGetElimStats3D(void) {
+
+  FMBElimStats stats;
+  FrameStatsGet(
+    &fmbElimStats3D,
+    &stats);
+  return stats;
+
+}
+
+// Reset the statistics of the elimination
+void FMBResetElimStats3D(void) {
+
+  FrameStatsReset(&fmbElimStats3D);
+
+}
+
+// Test for intersection between Frame that and Frame tho
+// Return true if the two Frames are intersecting, else false
+// If the Frame are intersecting the AABB of the intersection
+// is stored into bdgBox, else bdgBox is not modified
+// If bdgBox is null, the result AABB is not memorized (to use if
+// unnecessary and want to speed up the algorithm)
+// The resulting AABB may be larger than the smallest possible AABB
+// The resulting AABB of FMBTestIntersection(A,B) may be different
+// of the resulting AABB of FMBTestIntersection(B,A)
+// The resulting AABB is given in tho's local coordinates system
+bool FMBTestIntersection3D(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  AABB3D* const bdgBox) {
+
+  // Get the projection of the Frame tho in Frame that coordinates
+  // system
+  Frame3D thoProj;
+  Frame3DImportFrame(that, tho, &thoProj);
+
+  // Test for intersection with the projected Frame
+  return
+    FMBTestIntersectionProj3D(
+      that->type,
+      tho->type,
+      &thoProj,
+      bdgBox);
+
+}
+
+// Test for intersection between the Frame that and each of the nbTho
+// Frames in the array thos
+// The result for thos[i] is stored in the i-th bit of the bitset
+// isIntersecting, which must have at least FMBBitsetNbWords(nbTho)
+// words (cf frame.h)
+// If bdgBoxes is not null, the AABB of the intersection with thos[i]
+// is stored into bdgBoxes[i] if the Frames are intersecting, else
+// bdgBoxes[i] is not modified
+// The results are identical to FMBTestIntersection3D(that, thos + i,
+// bdgBoxes + i), but the Frames are projected by chunks sharing the
+// setup of that
+void FMBTestIntersection3DBatch(
+  const Frame3D* const that,
+  const Frame3D* const thos,
+  const int nbTho,
+  unsigned long* const isIntersecting,
+  AABB3D* const bdgBoxes) {
+
+  // Reset the bitset
+  int nbWords = FMBBitsetNbWords(nbTho);
+  for (
+    int iWord = nbWords;
+    iWord--;) {
+
+    isIntersecting[iWord] = 0UL;
+
+  }
+
+  // Shortcut
+  const FrameType thatType = that->type;
+
+  // Declare a variable to memorize the projected Frames of the
+  // current chunk
+  Frame3D thosProj[FMB_BATCH_CHUNK];
+
+  // Loop on chunks of Frames
+  for (
+    int iStart = 0;
+    iStart < nbTho;
+    iStart += FMB_BATCH_CHUNK) {
+
+    // Get the number of Frames in this chunk
+    int nbChunk = nbTho - iStart;
+    if (nbChunk > FMB_BATCH_CHUNK) {
+
+      nbChunk = FMB_BATCH_CHUNK;
+
+    }
+
+    // Project the Frames of the chunk in that's coordinates system
+    Frame3DImportFrames(
+      that,
+      thos + iStart,
+      nbChunk,
+      thosProj);
+
+    // Loop on the projected Frames
+    for (
+      int iChunk = 0;
+      iChunk < nbChunk;
+      ++iChunk) {
+
+      // Test the intersection
+      int iTho = iStart + iChunk;
+      bool isInter =
+        FMBTestIntersectionProj3D(
+          thatType,
+          thosProj[iChunk].type,
+          thosProj + iChunk,
+          (bdgBoxes != NULL ? bdgBoxes + iTho : NULL));
+
+      // Memorize the result
+      if (isInter == true) {
+
+        FMBBitsetSet(isIntersecting, iTho);
+
+      }
+
+    }
+
+  }
+
+}
+
+// Create in row.X<=y the iRow-th inequality of the system of the
+// intersection between a Frame of type thatType and the Frame thoProj
+// of type thoType, projection of tho in that's coordinates system,
+// with the rows in the same order as FMBTestIntersectionSolve3D
+static inline void FMBGetRow3D(
+  const FrameType thatType,
+  const FrameType thoType,
+  const Frame3D* const thoProj,
+  const int iRow,
+  FMB_REAL* const row,
+  FMB_REAL* const y) {
+
+  // Nb of rows for the inside of that and tho
+  int nbRowsThat = (thatType == FrameCuboid ? 3 : 1);
+  int nbRowsTho = (thoType == FrameCuboid ? 3 : 1);
+
+  if (iRow < 3) {
+
+    // -sum_iC_j,iX_i<=O_j
+    for (
+      int iCol = 3;
+      iCol--;) {
+
+      row[iCol] = -thoProj->comp[iCol][iRow];
+
+    }
+
+    *y = thoProj->orig[iRow];
+
+  } else if (iRow < 3 + nbRowsThat) {
+
+    int jRow = iRow - 3;
+    if (thatType == FrameCuboid) {
+
+      // sum_iC_j,iX_i<=1.0-O_j
+      for (
+        int iCol = 3;
+        iCol--;) {
+
+        row[iCol] = thoProj->comp[iCol][jRow];
+
+      }
+
+      *y = 1.0 - thoProj->orig[jRow];
+
+    } else {
+
+      // sum_j(sum_iC_j,iX_i)<=1.0-sum_iO_i
+      for (
+        int iCol = 3;
+        iCol--;) {
+
+        row[iCol] =
+          thoProj->comp[iCol][0] + thoProj->comp[iCol][1] +
+          thoProj->comp[iCol][2];
+
+      }
+
+      *y = 1.0 - thoProj->orig[0] - thoProj->orig[1] - thoProj->orig[2];
+
+    }
+
+  } else if (iRow < 3 + nbRowsThat + nbRowsTho) {
+
+    int jRow = iRow - 3 - nbRowsThat;
+    if (thoType == FrameCuboid) {
+
+      // X_i <= 1.0
+      for (
+        int iCol = 3;
+        iCol--;) {
+
+        row[iCol] = (iCol == jRow ? 1.0 : 0.0);
+
+      }
+
+    } else {
+
+      // sum_iX_i<=1.0
+      row[0] = 1.0;
+      row[1] = 1.0;
+      row[2] = 1.0;
+
+    }
+
+    *y = 1.0;
+
+  } else {
+
+    // -X_i <= 0.0
+    int jRow = iRow - 3 - nbRowsThat - nbRowsTho;
+    for (
+      int iCol = 3;
+      iCol--;) {
+
+      row[iCol] = (iCol == jRow ? -1.0 : 0.0);
+
+    }
+
+    *y = 0.0;
+
+  }
+
+}
+
+// Same as ElimVar3D, where masks are the sets of rows of the original
+// system the rows of M.X<=Y are combinations of (one bit per row),
+// masksP receives the ones of the resulting system, and maskSep the
+// one of the row which made the system inconsistent
+// Return true if the system becomes inconsistent during elimination,
+// else return false
+static inline bool ElimVarWitness3D(
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
+  const unsigned int* masks,
+  const int nbRows,
+  const int nbCols,
+  FMB_REAL (*Mp)[3],
+  FMB_REAL* Yp,
+  unsigned int* masksP,
+  int* const nbRemainRows,
+  unsigned int* const maskSep) {
+
+  // Initialize the number of rows in the result system
+  int nbResRows = 0;
+
+  // First we process the pairs of rows where the eliminated variable
+  // is not null and has different signs
+  for (
+    int iRow = 0;
+    iRow < nbRows - 1;
+    ++iRow) {
+
+    // Shortcuts
+    const FMB_REAL fabsMIRowIVar = fabs(M[iRow][0]);
+
+    if (fabsMIRowIVar > EPSILON) {
+
+      // Shortcuts, as in ElimVar3D
+      const FMB_REAL* MiRow = M[iRow];
+      const int sgnMIRowIVar = sgn(MiRow[0]);
+      const FMB_REAL YIRowDivideByFabsMIRowIVar = Y[iRow] / fabsMIRowIVar;
+      const unsigned int maskIRow = masks[iRow];
+
+      for (
+        int jRow = iRow + 1;
+        jRow < nbRows;
+        ++jRow) {
+
+        if (
+          sgnMIRowIVar != sgn(M[jRow][0]) &&
+          fabs(M[jRow][0]) > EPSILON) {
+
+          // Shortcuts
+          const FMB_REAL* MjRow = M[jRow];
+          const FMB_REAL fabsMjRowIVar = fabs(MjRow[0]);
+
+          // Add the sum of the two normed rows into the result system
+          // and memorize the rows it comes from
+          FMB_REAL sumNegCoeff = 0.0;
+          for (
+            int iCol = 1;
+            iCol < nbCols;
+            ++iCol ) {
+
+            Mp[nbResRows][iCol - 1] =
+              MiRow[iCol] / fabsMIRowIVar +
+              MjRow[iCol] / fabsMjRowIVar;
+            sumNegCoeff += neg(Mp[nbResRows][iCol - 1]);
+
+          }
+
+          Yp[nbResRows] =
+            YIRowDivideByFabsMIRowIVar +
+            Y[jRow] / fabsMjRowIVar;
+          masksP[nbResRows] = maskIRow | masks[jRow];
+
+          // If the row is inconsistent given that X is in [0,1]
+          if (Yp[nbResRows] < sumNegCoeff - EPSILON) {
+
+            *maskSep = masksP[nbResRows];
+            return true;
+
+          }
+
+          ++nbResRows;
+
+        }
+
+      }
+
+    }
+
+  }
+
+  // Then we copy the rows where the eliminated variable is null
+  for (
+    int iRow = 0;
+    iRow < nbRows;
+    ++iRow) {
+
+    if (fabs(M[iRow][0]) < EPSILON) {
+
+      for (
+        int iCol = 1;
+        iCol < nbCols;
+        ++iCol) {
+
+        Mp[nbResRows][iCol - 1] = M[iRow][iCol];
+
+      }
+
+      Yp[nbResRows] = Y[iRow];
+      masksP[nbResRows] = masks[iRow];
+      ++nbResRows;
+
+    }
+
+  }
+
+  // Memorize the number of rows in the result system
+  *nbRemainRows = nbResRows;
+
+  // If we reach here the system is not inconsistent
+  return false;
+
+}
+
+// Return the union of the sets of rows masks of the rows giving the
+// bounds of the last variable in the nbRows rows system M.X<=Y, as
+// found by GetBoundLastVar3D
+static unsigned int GetBoundWitness3D(
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
+  const unsigned int* masks,
+  const int nbRows) {
+
+  // Search the bounds as GetBoundLastVar3D and memorize the rows
+  // giving them
+  FMB_REAL min = 0.0;
+  FMB_REAL max = 1.0;
+  unsigned int maskMin = 0;
+  unsigned int maskMax = 0;
+  for (
+    int jRow = 0;
+    jRow < nbRows;
+    ++jRow) {
+
+    if (M[jRow][0] > EPSILON) {
+
+      FMB_REAL y = Y[jRow] / M[jRow][0];
+      if (max > y) {
+
+        max = y;
+        maskMax = masks[jRow];
+
+      }
+
+    } else if (M[jRow][0] < -EPSILON) {
+
+      FMB_REAL y = Y[jRow] / M[jRow][0];
+      if (min < y) {
+
+        min = y;
+        maskMin = masks[jRow];
+
+      }
+
+    }
+
+  }
+
+  return maskMin | maskMax;
+
+}
+
+// Search the witness of the inconsistency of the nbRows rows system
+// M.X<=Y, where X is in [0,1]: the set of rows of the system (one bit
+// per row) which are inconsistent by themselves
+// The system is solved as in FMBTestIntersectionSolve3D, keeping track
+// of the rows each row of the successive eliminations comes from,
+// hence the witness of a system which has no solution is always found
+// (up to numerical imprecision), and the witness of a subset of the
+// rows of a system is also a witness for this system
+// The system must have at most FMB3D_NB_ROWS_EXACT rows
+// Return true and store the set in witness if the system is
+// inconsistent, else return false
+static bool FMBGetWitness3D(
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
+  const int nbRows,
+  unsigned int* const witness) {
+
+  // Declare the buffers of the successive eliminations and the sets of
+  // rows of their rows, sized for the largest system
+  unsigned int masks[FMB3D_NB_ROWS_EXACT];
+  FMB_REAL Mp[FMB3D_NB_ROWS_P_EXACT][3];
+  FMB_REAL Yp[FMB3D_NB_ROWS_P_EXACT];
+  unsigned int masksP[FMB3D_NB_ROWS_P_EXACT];
+  FMB_REAL Mpp[FMB3D_NB_ROWS_PP_EXACT][3];
+  FMB_REAL Ypp[FMB3D_NB_ROWS_PP_EXACT];
+  unsigned int masksPP[FMB3D_NB_ROWS_PP_EXACT];
+
+  // Check the rows one by one, as in the construction of the system
+  for (
+    int iRow = 0;
+    iRow < nbRows;
+    ++iRow) {
+
+    masks[iRow] = 1U << iRow;
+    if (Y[iRow] < neg(M[iRow][0]) + neg(M[iRow][1]) + neg(M[iRow][2])) {
+
+      *witness = masks[iRow];
+      return true;
+
+    }
+
+  }
+
+  // Eliminate the first and second variables
+  int nbRowsP = 0;
+  bool inconsistency =
+    ElimVarWitness3D(
+      M,
+      Y,
+      masks,
+      nbRows,
+      3,
+      Mp,
+      Yp,
+      masksP,
+      &nbRowsP,
+      witness);
+  if (inconsistency == true) {
+
+    return true;
+
+  }
+
+  int nbRowsPP = 0;
+  inconsistency =
+    ElimVarWitness3D(
+      Mp,
+      Yp,
+      masksP,
+      nbRowsP,
+      2,
+      Mpp,
+      Ypp,
+      masksPP,
+      &nbRowsPP,
+      witness);
+  if (inconsistency == true) {
+
+    return true;
+
+  }
+
+  // Get the bounds of the third variable
+  AABB3D bdgBox;
+  GetBoundLastVar3D(
+    THD_VAR,
+    Mpp,
+    Ypp,
+    nbRowsPP,
+    &bdgBox);
+
+  // If the bounds are inconsistent
+  if (bdgBox.min[THD_VAR] >= bdgBox.max[THD_VAR]) {
+
+    *witness =
+      GetBoundWitness3D(
+        Mpp,
+        Ypp,
+        masksPP,
+        nbRowsPP);
+    return true;
+
+  }
+
+  // The system is not inconsistent
+  return false;
+
+}
+
+// Test for intersection between Frame that and Frame tho, as
+// FMBTestIntersection3D, using the witness of the separation of the
+// pair (idThat, idTho) memorized in the FMBPairCache cache
+// The witness is the set of rows of the system of the intersection
+// which had no solution at the last test. If those rows still have no
+// solution the Frames are not intersecting and only them are solved,
+// else the full test is run with the kernel keeping track of the rows
+// each row of the eliminations comes from, which gives the witness if
+// the Frames are not intersecting, memorized for the next test
+bool FMBTestIntersection3DCached(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  AABB3D* const bdgBox,
+  FMBPairCache* const cache,
+  const unsigned long idThat,
+  const unsigned long idTho) {
+
+  // Get the projection of the Frame tho in Frame that coordinates
+  // system
+  Frame3D thoProj;
+  Frame3DImportFrame(that, tho, &thoProj);
+
+  // Get the witness of the last test of the pair
+  int witness =
+    FMBPairCacheGet(
+      cache,
+      idThat,
+      idTho);
+
+  // If there is one
+  if (witness != FMB_PAIR_CACHE_NONE) {
+
+    // Get the rows of the witness
+    FMB_REAL M[FMB3D_NB_ROWS_EXACT][3];
+    FMB_REAL Y[FMB3D_NB_ROWS_EXACT];
+    int nbRowsWitness = 0;
+    for (
+      unsigned int rows = (unsigned int)witness;
+      rows != 0;
+      rows &= rows - 1) {
+
+      FMBGetRow3D(
+        that->type,
+        tho->type,
+        &thoProj,
+        __builtin_ctz(rows),
+        M[nbRowsWitness],
+        Y + nbRowsWitness);
+      ++nbRowsWitness;
+
+    }
+
+    // If the rows of the witness have still no solution
+    unsigned int witnessCheck = 0;
+    bool isSeparated =
+      FMBGetWitness3D(
+        M,
+        Y,
+        nbRowsWitness,
+        &witnessCheck);
+    if (isSeparated == true) {
+
+      // The Frames are not in intersection
+      ++(cache->nbHit);
+      return false;
+
+    }
+
+  }
+
+  // Run the full test, which gives the witness if the Frames are not
+  // intersecting
+  ++(cache->nbMiss);
+  unsigned int mask = 0;
+  bool isIntersecting =
+    fmbKernels3DWitness[that->type][tho->type](
+      &thoProj,
+      bdgBox,
+      &mask,
+      FrameCPUGeneric);
+
+  // Memorize the witness for the next test
+  FMBPairCacheSet(
+    cache,
+    idThat,
+    idTho,
+    (isIntersecting == false ? (int)mask : FMB_PAIR_CACHE_NONE));
+
+  return isIntersecting;
+
+}
+
+// Add to the system M.U<=Y, starting at its nbRows-th row, the
+// inequalities defining the inside of the Frame frame, where U are
+// the world coordinates normalized in the AABB of origin orig and
+// size dim (W=orig+dim*U)
+// Return the number of rows of the system after the addition
+static int FMBExactAddFrame3D(
+  const Frame3D* const frame,
+  const FMB_REAL orig[3],
+  const FMB_REAL dim[3],
+  FMB_REAL (*M)[3],
+  FMB_REAL* Y,
+  int nbRows) {
+
+  // Shortcut
+  const FMB_REAL (*invComp)[3] = frame->invComp;
+
+  // The local coordinates of W in frame are X=A.U+B with
+  // A_i,j=invComp_j,i*dim_j and B_i=sum_jinvComp_j,i*(orig_j-O_j)
+  FMB_REAL A[3][3];
+  FMB_REAL B[3];
+  for (
+    int i = 3;
+    i--;) {
+
+    B[i] = 0.0;
+    for (
+      int j = 3;
+      j--;) {
+
+      A[i][j] = invComp[j][i] * dim[j];
+      B[i] += invComp[j][i] * (orig[j] - frame->orig[j]);
+
+    }
+
+  }
+
+  // -X_i<=0.0, ie -A_i.U<=B_i
+  for (
+    int i = 0;
+    i < 3;
+    ++i) {
+
+    M[nbRows][0] = -A[i][0];
+    M[nbRows][1] = -A[i][1];
+    M[nbRows][2] = -A[i][2];
+    Y[nbRows] = B[i];
+    ++nbRows;
+
+  }
+
+  if (frame->type == FrameCuboid) {
+
+    // X_i<=1.0, ie A_i.U<=1.0-B_i
+    for (
+      int i = 0;
+      i < 3;
+      ++i) {
+
+      M[nbRows][0] = A[i][0];
+      M[nbRows][1] = A[i][1];
+      M[nbRows][2] = A[i][2];
+      Y[nbRows] = 1.0 - B[i];
+      ++nbRows;
+
+    }
+
+  } else {
+
+    // sum_iX_i<=1.0, ie sum_iA_i.U<=1.0-sum_iB_i
+    M[nbRows][0] = A[0][0] + A[1][0] + A[2][0];
+    M[nbRows][1] = A[0][1] + A[1][1] + A[2][1];
+    M[nbRows][2] = A[0][2] + A[1][2] + A[2][2];
+    Y[nbRows] = 1.0 - B[0] - B[1] - B[2];
+    ++nbRows;
+
+  }
+
+  // Return the number of rows
+  return nbRows;
+
+}
+
+// Get the exact bounds of the iAxis-th variable of the nbRows rows
+// system M.U<=Y, where U is in [0,1], by eliminating the two other
+// variables, and store them in the iAxis-th axis of bdgBox
+// The Fourier-Motzkin elimination being an exact projection, the
+// bounds of the last variable are the exact ones of the polytope
+// Return false if the system is inconsistent, else true
+static bool FMBExactBound3D(
+  const int iAxis,
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
+  const int nbRows,
+  AABB3D* const bdgBox) {
+
+  // Declare the buffers of the system and its eliminations
+  FMB_REAL Mr[FMB3D_NB_ROWS_EXACT][3];
+  FMB_REAL Mp[FMB3D_NB_ROWS_P_EXACT][3];
+  FMB_REAL Yp[FMB3D_NB_ROWS_P_EXACT];
+  FMB_REAL Mpp[FMB3D_NB_ROWS_PP_EXACT][3];
+  FMB_REAL Ypp[FMB3D_NB_ROWS_PP_EXACT];
+
+  // Reorder the columns of the system to put the iAxis-th variable
+  // in last position
+  const int iFst = (iAxis + 1) % 3;
+  const int iSnd = (iAxis + 2) % 3;
+  for (
+    int iRow = nbRows;
+    iRow--;) {
+
+    Mr[iRow][0] = M[iRow][iFst];
+    Mr[iRow][1] = M[iRow][iSnd];
+    Mr[iRow][2] = M[iRow][iAxis];
+
+  }
+
+  // Eliminate the first variable, the number of rows may exceed
+  // FMB3D_ELIM_MAX_ROWS hence the scalar implementation is always used
+  int nbRowsP;
+  bool inconsistency =
+    ElimVar3D(
+      Mr,
+      Y,
+      nbRows,
+      3,
+      Mp,
+      Yp,
+      &nbRowsP);
+  if (inconsistency == true) {
+
+    return false;
+
+  }
+
+  // If the user requested it, prune the redundant rows before the
+  // next elimination
+  bool isPruning =
+    atomic_load_explicit(
+      &fmbPruning3D,
+      memory_order_relaxed);
+  if (isPruning == true) {
+
+    PruneRows3D(
+      Mp,
+      Yp,
+      nbRowsP,
+      2,
+      &nbRowsP);
+
+  }
+
+  // Eliminate the second variable
+  int nbRowsPP;
+  inconsistency =
+    ElimVar3D(
+      Mp,
+      Yp,
+      nbRowsP,
+      2,
+      Mpp,
+      Ypp,
+      &nbRowsPP);
+  if (inconsistency == true) {
+
+    return false;
+
+  }
+
+  // Get the bounds of the remaining variable
+  GetBoundLastVar3D(
+    iAxis,
+    Mpp,
+    Ypp,
+    nbRowsPP,
+    bdgBox);
+
+  // Return the consistency of the bounds
+  return (bdgBox->min[iAxis] < bdgBox->max[iAxis]);
+
+}
+
+// Get the exact bounds of the nbRows rows system M.U<=Y on each axis
+// (cf FMBExactBound3D) and store them in bdgBox
+// Return false if the system is inconsistent, else true
+static bool FMBExactBounds3D(
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
+  const int nbRows,
+  AABB3D* const bdgBox) {
+
+  // Loop on the axes
+  for (
+    int iAxis = 3;
+    iAxis--;) {
+
+    // Get the exact bounds on this axis
+    bool isConsistent =
+      FMBExactBound3D(
+        iAxis,
+        M,
+        Y,
+        nbRows,
+        bdgBox);
+    if (isConsistent == false) {
+
+      return false;
+
+    }
+
+  }
+
+  // If we've reached here the system is consistent
+  return true;
+
+}
+
+// Test for intersection between Frame that and Frame tho, and get the
+// smallest AABB of their intersection in world coordinates
+// (cf fmb3d.h)
+bool FMBTestIntersection3DExact(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  AABB3D* const bdgBox) {
+
+  // Test for intersection with the default algorithm, cheaper and
+  // giving the same result
+  bool isInter =
+    FMBTestIntersection3D(
+      that,
+      tho,
+      NULL);
+  if (isInter == false || bdgBox == NULL) {
+
+    return isInter;
+
+  }
+
+  // Get the intersection of the AABBs of the two Frames, which
+  // contains their intersection, and use it to normalize the world
+  // coordinates into [0,1] as required by the elimination
+  FMB_REAL orig[3];
+  FMB_REAL dim[3];
+  for (
+    int iAxis = 3;
+    iAxis--;) {
+
+    orig[iAxis] = that->bdgBox.min[iAxis];
+    if (orig[iAxis] < tho->bdgBox.min[iAxis]) {
+
+      orig[iAxis] = tho->bdgBox.min[iAxis];
+
+    }
+
+    FMB_REAL max = that->bdgBox.max[iAxis];
+    if (max > tho->bdgBox.max[iAxis]) {
+
+      max = tho->bdgBox.max[iAxis];
+
+    }
+
+    dim[iAxis] = max - orig[iAxis];
+    if (dim[iAxis] < 0.0) {
+
+      dim[iAxis] = 0.0;
+
+    }
+
+  }
+
+  // Create the inequality system of the intersection in the
+  // normalized world coordinates
+  FMB_REAL M[FMB3D_NB_ROWS_EXACT][3];
+  FMB_REAL Y[FMB3D_NB_ROWS_EXACT];
+  int nbRows =
+    FMBExactAddFrame3D(
+      that,
+      orig,
+      dim,
+      M,
+      Y,
+      0);
+  nbRows =
+    FMBExactAddFrame3D(
+      tho,
+      orig,
+      dim,
+      M,
+      Y,
+      nbRows);
+
+  // Get the exact bounds on each axis, eliminating the two other
+  // variables
+  AABB3D bdgBoxNorm;
+  bool isConsistent =
+    FMBExactBounds3D(
+      M,
+      Y,
+      nbRows,
+      &bdgBoxNorm);
+
+  // The system may be inconsistent here only if the Frames are
+  // touching: FMBTestIntersection3D accepts them within EPSILON in
+  // that's coordinates, but the rows here are scaled by the
+  // normalization in the AABB of the intersection. In that case relax
+  // each row by delta times the sum of the absolute values of its
+  // coefficients, ie accept the points at a distance (in normalized
+  // coordinates) lower than delta from the Frames, starting from
+  // FMB3D_EXACT_RELAX and multiplying delta by 10 until the system is
+  // consistent
+  // The contact being in the AABB of the intersection, any U in [0,1]
+  // is at a distance lower than 1 from it, hence the relaxed system is
+  // consistent at the latest when delta reaches 1, else (numerical
+  // imprecision) use the whole AABB of the intersection
+  FMB_REAL YRelax[FMB3D_NB_ROWS_EXACT];
+  for (
+    FMB_REAL delta = FMB3D_EXACT_RELAX;
+    isConsistent == false && delta < 10.0;
+    delta *= 10.0) {
+
+    for (
+      int iRow = nbRows;
+      iRow--;) {
+
+      YRelax[iRow] =
+        Y[iRow] +
+        delta * (
+          fabs(M[iRow][0]) +
+          fabs(M[iRow][1]) +
+          fabs(M[iRow][2]));
+
+    }
+
+    isConsistent =
+      FMBExactBounds3D(
+        M,
+        YRelax,
+        nbRows,
+        &bdgBoxNorm);
+
+  }
+
+  if (isConsistent == false) {
+
+    for (
+      int iAxis = 3;
+      iAxis--;) {
+
+      bdgBoxNorm.min[iAxis] = 0.0;
+      bdgBoxNorm.max[iAxis] = 1.0;
+
+    }
+
+  }
+
+  // Convert the bounds to world coordinates and memorize the result
+  for (
+    int iAxis = 3;
+    iAxis--;) {
+
+    bdgBox->min[iAxis] = orig[iAxis] + dim[iAxis] * bdgBoxNorm.min[iAxis];
+    bdgBox->max[iAxis] = orig[iAxis] + dim[iAxis] * bdgBoxNorm.max[iAxis];
+
+  }
+
+  // If we've reached here the two Frames are intersecting
   return true;
 
 }
+
+// Add the FMBMixedStats from to the FMBMixedStats to
+static void FMBMixedStatsMerge(
+  void* const to,
+  const void* const from) {
+
+  FMBMixedStats* const statsTo = to;
+  const FMBMixedStats* const statsFrom = from;
+  statsTo->nbTest += statsFrom->nbTest;
+  statsTo->nbFallback += statsFrom->nbFallback;
+
+}
+
+// Test for intersection between Frame that and Frame tho with the
+// mixed precision algorithm
+// (cf fmb3d.h)
+bool FMBTestIntersection3DMixed(
+  const Frame3D* const that,
+  const Frame3D* const tho) {
+
+  // Update the statistics of the calling thread
+  FMBMixedStats* const stats = fmbMixedStats3DThread();
+  ++(stats->nbTest);
+
+#ifdef FMB_REAL_FLOAT
+
+  // If FMB_REAL is float there is nothing to fall back to
+  return
+    FMBTestIntersection3D(
+      that,
+      tho,
+      NULL);
+
+#else
+
+  // Get the projection of the Frame tho in Frame that coordinates
+  // system
+  Frame3D thoProj;
+  Frame3DImportFrame(that, tho, &thoProj);
+
+  // Test for intersection with the float instantiation of the kernel
+  // for the pair of types
+  FMBMixedResult res =
+    fmbKernels3DMixed[that->type][tho->type](
+      &thoProj,
+      NULL,
+      FrameCPUGeneric);
+
+  // If the result is certain, return it
+  if (res != FMBMixedUncertain) {
+
+    return (res == FMBMixedInter);
+
+  }
+
+  // Else, fall back to FMB_REAL
+  ++(stats->nbFallback);
+  return
+    FMBTestIntersectionProj3D(
+      that->type,
+      tho->type,
+      &thoProj,
+      NULL);
+
+#endif
+
+}
+
+// Get the statistics of the mixed precision intersection test since
+// the last reset
+FMBMixedStats FMBGetMixedStats3D(void) {
+
+  FMBMixedStats stats;
+  FrameStatsGet(
+    &fmbMixedStats3D,
+    &stats);
+  return stats;
+
+}
+
+// Reset the statistics of the mixed precision intersection test
+void FMBResetMixedStats3D(void) {
+
+  FrameStatsReset(&fmbMixedStats3D);
+
+}
+
+// Set the axes used as filters by the hybrid intersection test
+void FMBSetHybridAxes3D(const unsigned int axes) {
+
+  atomic_store_explicit(
+    &fmbHybridAxes3D,
+    axes,
+    memory_order_relaxed);
+
+}
+
+// Get the axes currently used as filters by the hybrid intersection
+// test
+unsigned int FMBGetHybridAxes3D(void) {
+
+  return
+    atomic_load_explicit(
+      &fmbHybridAxes3D,
+      memory_order_relaxed);
+
+}
+
+// Test for intersection between Frame that and Frame tho, checking
+// first the SAT axes selected by FMBSetHybridAxes3D
+bool FMBHybridTestIntersection3D(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  AABB3D* const bdgBox) {
+
+  // Get the filter axes, the test being the one of FMB if there is
+  // none
+  unsigned int axes =
+    atomic_load_explicit(
+      &fmbHybridAxes3D,
+      memory_order_relaxed);
+  if (axes == FMB_HYBRID_AXES_NONE) {
+
+    return
+      FMBTestIntersection3D(
+        that,
+        tho,
+        bdgBox);
+
+  }
+
+  // If one of the filter axes separates the Frames
+  bool isIntersection =
+    SATCheckFaces3D(
+      that,
+      tho,
+      axes);
+  if (isIntersection == false) {
+
+    // The Frames are not in intersection,
+    // terminate the test
+    return false;
+
+  }
+
+  // Else, confirm with FMB
+  return
+    FMBTestIntersection3D(
+      that,
+      tho,
+      bdgBox);
+
+}
@@ -23,8 +23,95 @@
 #include <stdbool.h>
 #include "frame.h"
 
+// ------------- Enumerations -------------
+
+// Implementation of the Fourier-Motzkin elimination used by the
+// intersection tests
+// FMBElimModeScalar: pairs of rows are combined one by one
+// FMBElimModeSIMD: rows are sorted by sign of the eliminated variable
+// and each positive row is combined with Frame3DSoASIMDWidth()
+// negative rows at once, the width of the vectors of the current
+// FrameCPUPath (cf frame.h)
+// Both give identical results
+typedef enum {
+
+  FMBElimModeScalar,
+  FMBElimModeSIMD
+
+} FMBElimMode;
+
+// ------------- Data structures -------------
+
+// Statistics of the mixed precision intersection test
+// (cf FMBTestIntersection3DMixed)
+typedef struct {
+
+  // Nb of tests
+  unsigned long nbTest;
+
+  // Nb of tests which have fallen back to FMB_REAL
+  unsigned long nbFallback;
+
+} FMBMixedStats;
+
 // ------------- Functions declaration -------------
 
+// Set the use of the pruning of redundant rows between the
+// eliminations of variables in FMBTestIntersection3D and
+// FMBTestIntersection3DBatch (rows identical to another one, rows
+// with the same coefficients as another one and a greater right side,
+// rows satisfied by any X in [0,1])
+// Not used by default, unless FMB3D_PRUNING is defined at
+// compilation
+void FMBSetPruning3D(const bool isPruning);
+
+// Get the statistics of the pruning of redundant rows since the last
+// reset, added over all the threads (cf frame.h)
+// Each thread records its statistics separately, so the intersection
+// tests can run concurrently, but this function and
+// FMBResetPruneStats3D must not be called while another thread is
+// running one
+FMBPruneStats FMBGetPruneStats3D(void);
+
+// Reset the statistics of the pruning of redundant rows of all the
+// threads
+void FMBResetPruneStats3D(void);
+
+// Get the statistics of the Fourier-Motzkin elimination in
+// FMBTestIntersection3D since the last reset (cf frame.h), recorded
+// only if FMB_ELIM_STATS is defined at compilation and added over all
+// the threads, this function and FMBResetElimStats3D must not be
+// called while another thread is running FMBTestIntersection3D
+FMBElimStats FMBGetElimStats3D(void);
+
+// Reset the statistics of the Fourier-Motzkin elimination of all the
+// threads
+void FMBResetElimStats3D(void);
+
+// Set the implementation of the Fourier-Motzkin elimination used by
+// FMBTestIntersection3D and FMBTestIntersection3DBatch
+// The default one is FMB3D_ELIM_MODE, FMBElimModeScalar unless
+// defined otherwise at compilation (for example
+// -DFMB3D_ELIM_MODE=FMBElimModeSIMD)
+void FMBSetElimMode3D(const FMBElimMode mode);
+
+// Get the implementation of the Fourier-Motzkin elimination currently
+// used by the intersection tests
+FMBElimMode FMBGetElimMode3D(void);
+
+// Set the order of elimination of the variables used by
+// FMBTestIntersection3D and FMBTestIntersection3DBatch (cf frame.h)
+// The default one is FMB3D_ELIM_ORDER, FMBElimOrderFixed unless
+// defined otherwise at compilation (for example
+// -DFMB3D_ELIM_ORDER=FMBElimOrderAdaptive)
+// It can be set while other threads are running the intersection
+// tests, each test using the order set when it starts
+void FMBSetElimOrder3D(const FMBElimOrder order);
+
+// Get the order of elimination of the variables currently used by
+// the intersection tests
+FMBElimOrder FMBGetElimOrder3D(void);
+
 // Test for intersection between Frame that and Frame tho
 // Return true if the two Frames are intersecting, else false
 // If the Frame are intersecting the AABB of the intersection
@@ -35,9 +122,141 @@
 // The resulting AABB of FMBTestIntersection(A, B) may be different
 // of the resulting AABB of FMBTestIntersection(B, A)
 // The resulting AABB is given in tho's local coordinates system
+// (cf FMBTestIntersection3DExact for the smallest AABB)
 bool FMBTestIntersection3D(
-  Frame3D* const that,
+  const Frame3D* const that,
   const Frame3D* const tho,
   AABB3D* const bdgBox);
 
+// Set the axes used as filters by FMBHybridTestIntersection3D, the
+// normals to the faces of the Frames selected by axes (cf
+// FMB_HYBRID_AXES_ALL in frame.h)
+// The default ones are FMB3D_HYBRID_AXES, FMB_HYBRID_AXES_NONE unless
+// defined otherwise at compilation (for example
+// -DFMB3D_HYBRID_AXES=FMB_HYBRID_AXES_THAT): the filter is opt-in as
+// it slows down the test on random pairs (cf
+// FMBHybridTestIntersection3D)
+void FMBSetHybridAxes3D(const unsigned int axes);
+
+// Get the axes currently used as filters by
+// FMBHybridTestIntersection3D
+unsigned int FMBGetHybridAxes3D(void);
+
+// Test for intersection between Frame that and Frame tho
+// Return true if the two Frames are intersecting, else false, and
+// store the AABB of the intersection into bdgBox, as
+// FMBTestIntersection3D
+// The normals to the faces selected by FMBSetHybridAxes3D are
+// checked first with SAT (cf SATCheckFaces3D), and
+// FMBTestIntersection3D is run only if none of them separates the
+// Frames
+// With no axes (the default) SAT is skipped and the test is
+// FMBTestIntersection3D
+// Cost: FMBTestIntersection3D rejects most of the non intersecting
+// pairs as fast as the filter, thus on random pairs (cf
+// QualifyHybrid3D) the hybrid test is about 1.4 times
+// FMBTestIntersection3D for non intersecting pairs and 1.5 times for
+// intersecting pairs with all the axes (1.6 and 1.25 times with the
+// axes of that only), the filter being worth enabling only for pairs
+// mostly separated by the normals of the faces
+bool FMBHybridTestIntersection3D(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  AABB3D* const bdgBox);
+
+// Test for intersection between Frame that and Frame tho, as
+// FMBTestIntersection3D, using the FMBPairCache cache to memorize the
+// witness of the separation of the pair, identified by idThat and
+// idTho, from one test to the next
+// The witness is the subset of the rows of the system of the
+// intersection (at most 8 of them) which has no solution. If it still
+// has no solution only this subset is solved, else the full test is
+// run, keeping track of the rows each row of the eliminations comes
+// from, and if the Frames are not intersecting the witness is the set
+// of rows of the rows found inconsistent, memorized for the next test
+// The full test uses the scalar elimination and no pruning, whatever
+// FMBSetElimMode3D and FMBSetPruning3D
+// Cost: a miss costs about as much as FMBTestIntersection3D with the
+// scalar elimination, and the witness is most often a single row, that
+// FMBTestIntersection3D rejects as fast. On pairs moving by small steps
+// (cf QualifyCache3D) this is about 0.95 times FMBTestIntersection3D
+// on the development machine, with a hit rate of 0.68
+bool FMBTestIntersection3DCached(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  AABB3D* const bdgBox,
+  FMBPairCache* const cache,
+  const unsigned long idThat,
+  const unsigned long idTho);
+
+// Test for intersection between Frame that and Frame tho
+// Return true if the two Frames are intersecting, else false, as
+// FMBTestIntersection3D
+// If the Frame are intersecting the smallest AABB of the intersection
+// in world coordinates is stored into bdgBox, else bdgBox is not
+// modified. It is the same for (A,B) and (B,A), up to numerical
+// imprecision
+// The bounds on each axis are obtained by eliminating the two other
+// axes from the system of the intersection expressed in world
+// coordinates, which gives exact bounds (up to the numerical
+// tolerance of the elimination)
+// On touching Frames, reported as intersecting by FMBTestIntersection3D
+// within its numerical tolerance, this system may have no solution. It
+// is then relaxed by the smallest power of 10 times a thousandth of
+// FMB_EPSILON giving a solution, and bdgBox is the (possibly
+// degenerate) AABB of the points this close to both Frames
+// Cost: non intersecting pairs, or a null bdgBox, cost the same as
+// FMBTestIntersection3D. Intersecting pairs cost FMBTestIntersection3D
+// plus 6 eliminations on systems of up to 36 rows, about 13 times
+// FMBTestIntersection3D with a bounding box on random pairs (1.6us
+// against 21us on the development machine)
+bool FMBTestIntersection3DExact(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  AABB3D* const bdgBox);
+
+// Test for intersection between Frame that and Frame tho
+// Return true if the two Frames are intersecting, else false, as
+// FMBTestIntersection3D without bounding box
+// The system is solved in float by the kernel of FMBTestIntersection3D
+// for the pair of types instantiated in float (with the fixed order of
+// elimination and without pruning), and solved again in FMB_REAL only
+// if one of the values compared to a threshold during the resolution
+// in float is too close to it to guarantee the result is the same as
+// in FMB_REAL (FMB_REAL being float this is the same as
+// FMBTestIntersection3D)
+bool FMBTestIntersection3DMixed(
+  const Frame3D* const that,
+  const Frame3D* const tho);
+
+// Get the statistics of the mixed precision intersection test since
+// the last reset, added over all the threads (cf frame.h)
+// Each thread records its statistics separately, so the intersection
+// tests can run concurrently, but this function and
+// FMBResetMixedStats3D must not be called while another thread is
+// running one
+FMBMixedStats FMBGetMixedStats3D(void);
+
+// Reset the statistics of the mixed precision intersection test of
+// all the threads
+void FMBResetMixedStats3D(void);
+
+// Test for intersection between the Frame that and each of the nbTho
+// Frames in the array thos
+// The result for thos[i] is stored in the i-th bit of the bitset
+// isIntersecting, which must have at least FMBBitsetNbWords(nbTho)
+// words (cf frame.h)
+// If bdgBoxes is not null, the AABB of the intersection with thos[i]
+// is stored into bdgBoxes[i] if the Frames are intersecting, else
+// bdgBoxes[i] is not modified
+// The results are identical to FMBTestIntersection3D(that, thos + i,
+// bdgBoxes + i), but the Frames are projected by chunks sharing the
+// setup of that
+void FMBTestIntersection3DBatch(
+  const Frame3D* const that,
+  const Frame3D* const thos,
+  const int nbTho,
+  unsigned long* const isIntersecting,
+  AABB3D* const bdgBoxes);
+
 #endif
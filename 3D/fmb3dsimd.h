@@ -0,0 +1,273 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Template of ElimVar3DSIMD for the FrameCPUPath selected by
+// FRAME_SIMD_PATH, included once per path by fmb3d.c (cf framesimd.h)
+
+// ------------- Includes -------------
+
+#include "framesimd.h"
+
+// ------------- Functions implementation -------------
+
+// Same as ElimVar3D, except the rows are first sorted by sign of the
+// eliminated variable and normalized, then each positive row is
+// combined with FRAME_SIMD_WIDTH negative rows at once
+// The resulting rows are the same as the ones of ElimVar3D, in a
+// different order
+FRAME_SIMD_TARGET static bool FRAME_SIMD_NAME(ElimVar3DSIMD)(
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
+  const int nbRows,
+  const int nbCols,
+  FMB_REAL (*Mp)[3],
+  FMB_REAL* Yp,
+  int* const nbRemainRows) {
+
+  // Declare variables to memorize the normalized (relative to the
+  // eliminated variable) rows where the eliminated variable has a
+  // positive coefficient, row by row
+  FMB_REAL posM[FMB3D_ELIM_MAX_ROWS][2];
+  FMB_REAL posY[FMB3D_ELIM_MAX_ROWS];
+  int nbPos = 0;
+
+  // Declare variables to memorize the normalized rows where the
+  // eliminated variable has a negative coefficient, column by column
+  // to be loaded in vectors
+  _Alignas(FRAME_SOA_ALIGN) FMB_REAL negM[2][FMB3D_ELIM_MAX_ROWS];
+  _Alignas(FRAME_SOA_ALIGN) FMB_REAL negY[FMB3D_ELIM_MAX_ROWS];
+  int nbNeg = 0;
+
+  // Sort and normalize the rows where the eliminated variable is
+  // not null
+  for (
+    int iRow = 0;
+    iRow < nbRows;
+    ++iRow) {
+
+    // Shortcut
+    const FMB_REAL* MiRow = M[iRow];
+
+    if (MiRow[0] > EPSILON) {
+
+      for (
+        int iCol = 1;
+        iCol < nbCols;
+        ++iCol) {
+
+        posM[nbPos][iCol - 1] = MiRow[iCol] / MiRow[0];
+
+      }
+
+      posY[nbPos] = Y[iRow] / MiRow[0];
+      ++nbPos;
+
+    } else if (MiRow[0] < -EPSILON) {
+
+      const FMB_REAL fabsMIRowIVar = -MiRow[0];
+      for (
+        int iCol = 1;
+        iCol < nbCols;
+        ++iCol) {
+
+        negM[iCol - 1][nbNeg] = MiRow[iCol] / fabsMIRowIVar;
+
+      }
+
+      negY[nbNeg] = Y[iRow] / fabsMIRowIVar;
+      ++nbNeg;
+
+    }
+
+  }
+
+  // Pad the negative rows up to a multiple of the vector width with
+  // rows which can't be inconsistent, they are not copied in the
+  // result system
+  for (
+    int iRow = nbNeg;
+    iRow % FRAME_SIMD_WIDTH != 0;
+    ++iRow) {
+
+    negM[0][iRow] = 0.0;
+    negM[1][iRow] = 0.0;
+    negY[iRow] = HUGE_VAL;
+
+  }
+
+  // Initialize the number of rows in the result system
+  int nbResRows = 0;
+
+  // Shortcuts
+  const int nbColsP = nbCols - 1;
+  const FrameSIMD zero = FrameSIMDZero();
+  const FrameSIMD epsilon = FrameSIMDSet1(EPSILON);
+
+  // Declare variables to memorize the combined rows before copying
+  // them into the result system
+  _Alignas(FRAME_SOA_ALIGN) FMB_REAL combM[2][FRAME_SIMD_WIDTH];
+  _Alignas(FRAME_SOA_ALIGN) FMB_REAL combY[FRAME_SIMD_WIDTH];
+
+  // Loop on the positive rows
+  for (
+    int iPos = 0;
+    iPos < nbPos;
+    ++iPos) {
+
+    // Broadcast the positive row
+    FrameSIMD posMVec[2];
+    for (
+      int iCol = nbColsP;
+      iCol--;) {
+
+      posMVec[iCol] = FrameSIMDSet1(posM[iPos][iCol]);
+
+    }
+
+    const FrameSIMD posYVec = FrameSIMDSet1(posY[iPos]);
+
+    // Loop on the groups of negative rows
+    for (
+      int iNeg = 0;
+      iNeg < nbNeg;
+      iNeg += FRAME_SIMD_WIDTH) {
+
+      // Add the two normed rows, and the sum of the negative
+      // coefficients in the resulting rows, in the same order as
+      // ElimVar3D
+      FrameSIMD sumNegCoeff = zero;
+      FrameSIMD combMVec[2];
+      for (
+        int iCol = 0;
+        iCol < nbColsP;
+        ++iCol) {
+
+        combMVec[iCol] =
+          FrameSIMDAdd(
+            posMVec[iCol],
+            FrameSIMDLoad(negM[iCol] + iNeg));
+        sumNegCoeff =
+          FrameSIMDAdd(
+            sumNegCoeff,
+            FrameSIMDMin(combMVec[iCol], zero));
+
+      }
+
+      // Update the right side of the inequality
+      const FrameSIMD combYVec =
+        FrameSIMDAdd(
+          posYVec,
+          FrameSIMDLoad(negY + iNeg));
+
+      // If the right side of the inequality is lower than the sum of
+      // negative coefficients in any of the rows
+      if (
+        FrameSIMDAnyLt(
+          combYVec,
+          FrameSIMDSub(sumNegCoeff, epsilon))) {
+
+        // Given that X is in [0,1], the system is inconsistent
+        return true;
+
+      }
+
+      // Copy the rows into the result system
+      for (
+        int iCol = nbColsP;
+        iCol--;) {
+
+        FrameSIMDStore(combM[iCol], combMVec[iCol]);
+
+      }
+
+      FrameSIMDStore(combY, combYVec);
+      int nbLanes = nbNeg - iNeg;
+      if (nbLanes > FRAME_SIMD_WIDTH) {
+
+        nbLanes = FRAME_SIMD_WIDTH;
+
+      }
+
+      for (
+        int iLane = 0;
+        iLane < nbLanes;
+        ++iLane) {
+
+        for (
+          int iCol = nbColsP;
+          iCol--;) {
+
+          Mp[nbResRows][iCol] = combM[iCol][iLane];
+
+        }
+
+        Yp[nbResRows] = combY[iLane];
+        ++nbResRows;
+
+      }
+
+    }
+
+  }
+
+  // Then we copy and compress the rows where the eliminated
+  // variable is null
+  for (
+    int iRow = 0;
+    iRow < nbRows;
+    ++iRow) {
+
+    // Shortcut
+    const FMB_REAL* MiRow = M[iRow];
+
+    // If the coefficient of the eliminated variable is null on
+    // this row
+    if (fabs(MiRow[0]) < EPSILON) {
+
+      // Copy this row into the result system excluding the eliminated
+      // variable
+      for (
+        int iCol = 1;
+        iCol < nbCols;
+        ++iCol) {
+
+        Mp[nbResRows][iCol - 1] = MiRow[iCol];
+
+      }
+
+      Yp[nbResRows] = Y[iRow];
+
+      // Increment the nb of rows into the result system
+      ++nbResRows;
+
+    }
+
+  }
+
+  // Memorize the number of rows in the result system
+  *nbRemainRows = nbResRows;
+
+  // If we reach here the system is not inconsistent
+  return false;
+
+}
+
+// ------------- Macros -------------
+
+#undef FRAME_SIMD_PATH
@@ -0,0 +1,1139 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Template of the specialized kernels of the FMB intersection test
+// (FMBTestIntersectionProj3D{CC,CT,TC,TT}Path) and the functions they
+// use, included three times by fmb3d.c: once in FMB_REAL, once in
+// FMB_REAL with FMB3D_SOLVE_WITNESS defined for the test with cache of
+// witnesses (cf FMBTestIntersection3DCached), and once in float with
+// FMB3D_SOLVE_MIXED defined for the mixed precision test (cf
+// FMBTestIntersection3DMixed), as follows:
+//   #define FMB3D_SOLVE_MIXED
+//   #include "fmb3dsolve.h"
+// The kernels with witness are suffixed with Witness and take an
+// additional argument witness, receiving the witness of the
+// separation when the Frames are not intersecting (cf
+// FMBGetWitness3D). They use the scalar elimination keeping track of
+// the rows each row of the eliminations comes from, and no pruning.
+// They use the functions of the FMB_REAL instantiation
+// The float functions are suffixed with Mixed and return a
+// FMBMixedResult, FMBMixedUncertain meaning a value was too close to
+// a threshold to be compared to it in float. They use the scalar
+// elimination, the fixed order of elimination, no pruning, no
+// statistics of the elimination and don't compute the bounding box
+
+// ------------- Macros -------------
+
+#undef FMB3D_SOLVE_REAL
+#undef FMB3D_SOLVE_NAME
+#undef FMB3D_SOLVE_HELPER
+#undef FMB3D_SOLVE_FABS
+#undef FMB3D_SOLVE_RESULT
+#undef FMB3D_SOLVE_INTER
+#undef FMB3D_SOLVE_NO_INTER
+#undef FMB3D_SOLVE_ELIM_RESULT
+#undef FMB3D_SOLVE_CONSISTENT
+#undef FMB3D_SOLVE_INCONSISTENT
+#undef FMB3D_SOLVE_STOP
+#undef FMB3D_SOLVE_UNCERTAIN
+#undef FMB3D_SOLVE_STAGE
+#undef FMB3D_SOLVE_ROWS
+#undef FMB3D_SOLVE_ELIM
+#undef FMB3D_SOLVE_WITNESS_PARAM
+#undef FMB3D_SOLVE_WITNESS_ARG
+#undef FMB3D_SOLVE_WITNESS_SET
+
+// FMB3D_SOLVE_REAL is the type of the values of the system,
+// FMB3D_SOLVE_NAME(name, suffix) the name of a kernel of the template,
+// FMB3D_SOLVE_HELPER(name) the one of a function used by the kernels,
+// FMB3D_SOLVE_RESULT the type of the result of the test
+// and FMB3D_SOLVE_ELIM_RESULT the one of the checks of the system
+// FMB3D_SOLVE_STOP(res) is the result of the test when a check
+// returns res, FMB3D_SOLVE_UNCERTAIN(v, threshold, mag) returns
+// FMBMixedUncertain if the value v, computed from values of magnitude
+// mag, is too close to threshold (mag is not evaluated in FMB_REAL)
+// FMB3D_SOLVE_ELIM eliminates a variable with the implementation of
+// the FrameCPUPath path, the sets of rows of the rows being in masks
+// and masksP with witness
+// FMB3D_SOLVE_WITNESS_PARAM and FMB3D_SOLVE_WITNESS_ARG are the
+// additional parameter and argument of the kernels with witness, and
+// FMB3D_SOLVE_WITNESS_SET(w) sets their witness to w
+#ifdef FMB3D_SOLVE_MIXED
+
+  #define FMB3D_SOLVE_REAL float
+  #define FMB3D_SOLVE_NAME(name, suffix) name##Mixed
+  #define FMB3D_SOLVE_HELPER(name) name##Mixed
+  #define FMB3D_SOLVE_FABS fabsf
+  #define FMB3D_SOLVE_RESULT FMBMixedResult
+  #define FMB3D_SOLVE_INTER FMBMixedInter
+  #define FMB3D_SOLVE_NO_INTER FMBMixedNoInter
+  #define FMB3D_SOLVE_ELIM_RESULT FMBMixedResult
+  #define FMB3D_SOLVE_CONSISTENT FMBMixedInter
+  #define FMB3D_SOLVE_INCONSISTENT FMBMixedNoInter
+  #define FMB3D_SOLVE_STOP(res) (res)
+  #define FMB3D_SOLVE_UNCERTAIN(v, threshold, mag) \
+    if (FMBMixedIsUncertain(v, threshold, mag) == true) { \
+      return FMBMixedUncertain; }
+  #define FMB3D_SOLVE_STAGE(stage)
+  #define FMB3D_SOLVE_ROWS(iPass, nbRows)
+  #define FMB3D_SOLVE_ELIM( \
+    M, Y, masks, nbRows, nbCols, Mp, Yp, masksP, nbRemain, path) \
+    ElimVar3DMixed(M, Y, nbRows, nbCols, Mp, Yp, nbRemain)
+  #define FMB3D_SOLVE_WITNESS_PARAM
+  #define FMB3D_SOLVE_WITNESS_ARG
+  #define FMB3D_SOLVE_WITNESS_SET(w)
+
+#else
+
+  #define FMB3D_SOLVE_REAL FMB_REAL
+  #define FMB3D_SOLVE_HELPER(name) name
+  #define FMB3D_SOLVE_FABS fabs
+  #define FMB3D_SOLVE_RESULT bool
+  #define FMB3D_SOLVE_INTER true
+  #define FMB3D_SOLVE_NO_INTER false
+  #define FMB3D_SOLVE_ELIM_RESULT bool
+  #define FMB3D_SOLVE_CONSISTENT false
+  #define FMB3D_SOLVE_INCONSISTENT true
+  #define FMB3D_SOLVE_STOP(res) false
+  #define FMB3D_SOLVE_UNCERTAIN(v, threshold, mag)
+  #define FMB3D_SOLVE_STAGE(stage) \
+    FMB_ELIM_STATS_STAGE( \
+      fmbElimStats3DThread(), thatType, thoType, stage)
+  #define FMB3D_SOLVE_ROWS(iPass, nbRows) \
+    FMB_ELIM_STATS_ROWS( \
+      fmbElimStats3DThread(), thatType, thoType, iPass, nbRows)
+
+  #ifdef FMB3D_SOLVE_WITNESS
+
+    #define FMB3D_SOLVE_NAME(name, suffix) name##Witness
+    #define FMB3D_SOLVE_ELIM( \
+      M, Y, masks, nbRows, nbCols, Mp, Yp, masksP, nbRemain, path) \
+      ElimVarWitness3D( \
+        M, Y, masks, nbRows, nbCols, Mp, Yp, masksP, nbRemain, witness)
+    #define FMB3D_SOLVE_WITNESS_PARAM , unsigned int* const witness
+    #define FMB3D_SOLVE_WITNESS_ARG , witness
+    #define FMB3D_SOLVE_WITNESS_SET(w) *witness = (w);
+
+  #else
+
+    #define FMB3D_SOLVE_NAME(name, suffix) name##suffix
+    #define FMB3D_SOLVE_ELIM( \
+      M, Y, masks, nbRows, nbCols, Mp, Yp, masksP, nbRemain, path) \
+      ElimVar3DSelect(M, Y, nbRows, nbCols, Mp, Yp, nbRemain, path)
+    #define FMB3D_SOLVE_WITNESS_PARAM
+    #define FMB3D_SOLVE_WITNESS_ARG
+    #define FMB3D_SOLVE_WITNESS_SET(w)
+
+  #endif
+
+#endif
+
+// ------------- Functions implementation -------------
+
+#ifdef FMB3D_SOLVE_MIXED
+
+// Return true if the float value v, result of a computation on
+// values of magnitude mag, is too close to the threshold to be
+// compared to it in float
+static inline bool FMBMixedIsUncertain(
+  const float v,
+  const float threshold,
+  const float mag) {
+
+  return (fabsf(v - threshold) <= FMB3D_MIXED_EPSILON * (mag + 1.0f));
+
+}
+
+// Return the magnitude of the values involved in the combination of
+// the rows MiRow.X<=yi and MjRow.X<=yj of nbCols columns normalized by
+// fabsMi and fabsMj (cf ElimVar3DMixed)
+static inline float GetMagElim3DMixed(
+  const float* MiRow,
+  const float fabsMi,
+  const float* MjRow,
+  const float fabsMj,
+  const float yi,
+  const float yj,
+  const int nbCols) {
+
+  float mag = fabsf(yi / fabsMi) + fabsf(yj / fabsMj);
+  for (
+    int iCol = 1;
+    iCol < nbCols;
+    ++iCol) {
+
+    mag += fabsf(MiRow[iCol] / fabsMi) + fabsf(MjRow[iCol] / fabsMj);
+
+  }
+
+  return mag;
+
+}
+
+#endif
+
+#ifndef FMB3D_SOLVE_WITNESS
+
+// Check the row M.X<=y of the initial system, X being in [0,1]
+// Return FMB3D_SOLVE_INCONSISTENT if the row can't be satisfied, else
+// FMB3D_SOLVE_CONSISTENT, or in float FMBMixedUncertain if the row is
+// too close to the inconsistency threshold to conclude
+static inline FMB3D_SOLVE_ELIM_RESULT FMB3D_SOLVE_HELPER(CheckRow3D)(
+  const FMB3D_SOLVE_REAL* M,
+  const FMB3D_SOLVE_REAL y) {
+
+  // Sum of the negative coefficients in the row
+  FMB3D_SOLVE_REAL sumNeg = neg(M[0]) + neg(M[1]) + neg(M[2]);
+
+  // If the row is too close to the inconsistency threshold to
+  // conclude (only in float)
+  FMB3D_SOLVE_UNCERTAIN(
+    y,
+    sumNeg,
+    FMB3D_SOLVE_FABS(M[0]) + FMB3D_SOLVE_FABS(M[1]) +
+    FMB3D_SOLVE_FABS(M[2]) + FMB3D_SOLVE_FABS(y))
+
+  // If the right side of the inequality is lower than the sum of
+  // negative coefficients in the row
+  if (y < sumNeg) {
+
+    return FMB3D_SOLVE_INCONSISTENT;
+
+  }
+
+  return FMB3D_SOLVE_CONSISTENT;
+
+}
+
+// Eliminate the first variable in the system M.X<=Y
+// using the Fourier-Motzkin method and return
+// the resulting system in Mp and Yp, and the number of rows of
+// the resulting system in nbRemainRows
+// (M arrangement is [iRow][iCol])
+// Return FMB3D_SOLVE_INCONSISTENT if the system becomes inconsistent
+// during elimination, else FMB3D_SOLVE_CONSISTENT, or in float
+// FMBMixedUncertain if a row is too close to the inconsistency
+// threshold to conclude
+static FMB3D_SOLVE_ELIM_RESULT FMB3D_SOLVE_HELPER(ElimVar3D)(
+  const FMB3D_SOLVE_REAL (*M)[3],
+  const FMB3D_SOLVE_REAL* Y,
+  const int nbRows,
+  const int nbCols,
+  FMB3D_SOLVE_REAL (*Mp)[3],
+  FMB3D_SOLVE_REAL* Yp,
+  int* const nbRemainRows) {
+
+  // Initialize the number of rows in the result system
+  int nbResRows = 0;
+
+  // First we process the rows where the eliminated variable is not null
+  // For each row except the last one
+  for (
+    int iRow = 0;
+    iRow < nbRows - 1;
+    ++iRow) {
+
+    // Shortcuts
+    const FMB3D_SOLVE_REAL fabsMIRowIVar = FMB3D_SOLVE_FABS(M[iRow][0]);
+
+    // If the coefficient for the eliminated variable is not null
+    // in this row
+    if (fabsMIRowIVar > EPSILON) {
+
+      // Shortcuts
+      const FMB3D_SOLVE_REAL* MiRow = M[iRow];
+      const int sgnMIRowIVar = sgn(MiRow[0]);
+      const FMB3D_SOLVE_REAL YIRowDivideByFabsMIRowIVar =
+        Y[iRow] / fabsMIRowIVar;
+
+      // For each following rows
+      for (
+        int jRow = iRow + 1;
+        jRow < nbRows;
+        ++jRow) {
+
+        // If coefficients of the eliminated variable in the two rows have
+        // different signs and are not null
+        if (
+          sgnMIRowIVar != sgn(M[jRow][0]) &&
+          FMB3D_SOLVE_FABS(M[jRow][0]) > EPSILON) {
+
+          // Shortcuts
+          const FMB3D_SOLVE_REAL* MjRow = M[jRow];
+          const FMB3D_SOLVE_REAL fabsMjRow = FMB3D_SOLVE_FABS(MjRow[0]);
+
+          // Declare a variable to memorize the sum of the negative
+          // coefficients in the row
+          FMB3D_SOLVE_REAL sumNegCoeff = 0.0;
+
+          // Add the sum of the two normed (relative to the eliminated
+          // variable) rows into the result system. This actually
+          // eliminate the variable while keeping the constraints on
+          // others variables
+          for (
+            int iCol = 1;
+            iCol < nbCols;
+            ++iCol ) {
+
+            Mp[nbResRows][iCol - 1] =
+              MiRow[iCol] / fabsMIRowIVar +
+              MjRow[iCol] / fabsMjRow;
+
+            // Update the sum of the negative coefficient
+            sumNegCoeff += neg(Mp[nbResRows][iCol - 1]);
+
+          }
+
+          // Update the right side of the inequality
+          Yp[nbResRows] =
+            YIRowDivideByFabsMIRowIVar +
+            Y[jRow] / fabsMjRow;
+
+          // If the row is too close to the inconsistency threshold to
+          // conclude (only in float)
+          FMB3D_SOLVE_UNCERTAIN(
+            Yp[nbResRows],
+            sumNegCoeff - EPSILON,
+            GetMagElim3DMixed(
+              MiRow,
+              fabsMIRowIVar,
+              MjRow,
+              fabsMjRow,
+              Y[iRow],
+              Y[jRow],
+              nbCols))
+
+          // If the right side of the inequality is lower than the sum of
+          // negative coefficients in the row
+          // (Add epsilon for numerical imprecision)
+          if (Yp[nbResRows] < sumNegCoeff - EPSILON) {
+
+            // Given that X is in [0,1], the system is inconsistent
+            return FMB3D_SOLVE_INCONSISTENT;
+
+          }
+
+          // Increment the nb of rows into the result system
+          ++nbResRows;
+
+        }
+
+      }
+
+    }
+
+  }
+
+  // Then we copy and compress the rows where the eliminated
+  // variable is null
+  // Loop on rows of the input system
+  for (
+    int iRow = 0;
+    iRow < nbRows;
+    ++iRow) {
+
+    // Shortcut
+    const FMB3D_SOLVE_REAL* MiRow = M[iRow];
+
+    // If the coefficient of the eliminated variable is null on
+    // this row
+    if (FMB3D_SOLVE_FABS(MiRow[0]) < EPSILON) {
+
+      // Shortcut
+      FMB3D_SOLVE_REAL* MpnbResRows = Mp[nbResRows];
+
+      // Copy this row into the result system excluding the eliminated
+      // variable
+      for (
+        int iCol = 1;
+        iCol < nbCols;
+        ++iCol) {
+
+        MpnbResRows[iCol - 1] = MiRow[iCol];
+
+      }
+
+      Yp[nbResRows] = Y[iRow];
+
+      // Increment the nb of rows into the result system
+      ++nbResRows;
+
+    }
+
+  }
+
+  // Memorize the number of rows in the result system
+  *nbRemainRows = nbResRows;
+
+  // If we reach here the system is not inconsistent
+  return FMB3D_SOLVE_CONSISTENT;
+
+}
+
+
+// Get the bounds of the iVar-th variable in the nbRows rows
+// system M.X<=Y which has been reduced to only one variable
+// and store them in the iVar-th axis of the
+// AABB bdgBox
+// (M arrangement is [iRow][iCol])
+// May return inconsistent values (max < min), which would
+// mean the system has no solution
+static void FMB3D_SOLVE_HELPER(GetBoundLastVar3D)(
+  const int iVar,
+  const FMB3D_SOLVE_REAL (*M)[3],
+  const FMB3D_SOLVE_REAL* Y,
+  const int nbRows,
+  AABB3D* const bdgBox) {
+
+  // Shortcuts
+  FMB_REAL* min = bdgBox->min + iVar;
+  FMB_REAL* max = bdgBox->max + iVar;
+
+  // Initialize the bounds to their maximum maximum and minimum minimum
+  *min = 0.0;
+  *max = 1.0;
+
+  // Loop on rows
+  for (
+    int jRow = 0;
+    jRow < nbRows;
+    ++jRow) {
+
+    // Shortcut
+    FMB3D_SOLVE_REAL MjRowiVar = M[jRow][0];
+
+    // If this row has been reduced to the variable in argument
+    // and it has a strictly positive coefficient
+    if (MjRowiVar > EPSILON) {
+
+      // Get the scaled value of Y for this row
+      FMB3D_SOLVE_REAL y = Y[jRow] / MjRowiVar;
+
+      // If the value is lower than the current maximum bound
+      if (*max > y) {
+
+        // Update the maximum bound
+        *max = y;
+
+      }
+
+    // Else, if this row has been reduced to the variable in argument
+    // and it has a strictly negative coefficient
+    } else if (MjRowiVar < -EPSILON) {
+
+      // Get the scaled value of Y for this row
+      FMB3D_SOLVE_REAL y = Y[jRow] / MjRowiVar;
+
+      // If the value is greater than the current minimum bound
+      if (*min < y) {
+
+        // Update the minimum bound
+        *min = y;
+
+      }
+
+    }
+
+  }
+
+}
+
+
+#endif
+
+// Solve the system of inequalities of the intersection between a
+// Frame of type thatType and the Frame thoProj of type thoType,
+// projection of tho in that's coordinates system
+// M, Y, Mp, Yp... are the buffers for the system and its successive
+// eliminations, sized by the caller for the pair of types
+// Always inlined, the types being constant in the callers the
+// construction of the system is fully specialized, as well as the
+// elimination for the FrameCPUPath path
+// (cf FMBTestIntersection3D)
+// In float the bounding box is not computed, and the elimination
+// order is the fixed one without pruning
+static inline FMB3D_SOLVE_RESULT FMB3D_SOLVE_NAME(
+  FMBTestIntersectionSolve3D, )(
+  const FrameType thatType,
+  const FrameType thoType,
+  const Frame3D* const thoProj,
+  AABB3D* const bdgBox,
+  FMB3D_SOLVE_REAL (*M)[3],
+  FMB3D_SOLVE_REAL* Y,
+  FMB3D_SOLVE_REAL (*Mp)[3],
+  FMB3D_SOLVE_REAL* Yp,
+  FMB3D_SOLVE_REAL (*Mpp)[3],
+  FMB3D_SOLVE_REAL* Ypp
+  FMB3D_SOLVE_WITNESS_PARAM,
+  const FrameCPUPath path) __attribute__((always_inline));
+static inline FMB3D_SOLVE_RESULT FMB3D_SOLVE_NAME(
+  FMBTestIntersectionSolve3D, )(
+  const FrameType thatType,
+  const FrameType thoType,
+  const Frame3D* const thoProj,
+  AABB3D* const bdgBox,
+  FMB3D_SOLVE_REAL (*M)[3],
+  FMB3D_SOLVE_REAL* Y,
+  FMB3D_SOLVE_REAL (*Mp)[3],
+  FMB3D_SOLVE_REAL* Yp,
+  FMB3D_SOLVE_REAL (*Mpp)[3],
+  FMB3D_SOLVE_REAL* Ypp
+  FMB3D_SOLVE_WITNESS_PARAM,
+  const FrameCPUPath path) {
+
+  // Declare a variable to memorize the result of the checks of the
+  // system
+  FMB3D_SOLVE_ELIM_RESULT res;
+
+#ifdef FMB3D_SOLVE_MIXED
+
+  // In float the bounding box is not computed and the elimination is
+  // the scalar one
+  (void)bdgBox;
+  (void)path;
+
+#endif
+
+#ifdef FMB3D_SOLVE_WITNESS
+
+  // The elimination recording the witness is the scalar one
+  (void)path;
+
+  // Declare the sets of rows of the original system (one bit per row)
+  // the rows of the system and its eliminations are combinations of,
+  // sized for the largest pair of types
+  unsigned int masks[FMB3D_NB_ROWS_CC];
+  unsigned int masksP[FMB3D_NB_ROWS_P_CC];
+  unsigned int masksPP[FMB3D_NB_ROWS_PP_CC];
+
+#endif
+
+  // Create the inequality system
+  // -sum_iC_j,iX_i<=O_j
+  M[0][0] = -thoProj->comp[0][0];
+  M[0][1] = -thoProj->comp[1][0];
+  M[0][2] = -thoProj->comp[2][0];
+  Y[0] = thoProj->orig[0];
+  res =
+    FMB3D_SOLVE_HELPER(CheckRow3D)(
+      M[0],
+      Y[0]);
+  if (res != FMB3D_SOLVE_CONSISTENT) {
+
+    FMB3D_SOLVE_WITNESS_SET(1U << 0)
+    FMB3D_SOLVE_STAGE(FMBElimStageInit);
+    return FMB3D_SOLVE_STOP(res);
+
+  }
+
+  M[1][0] = -thoProj->comp[0][1];
+  M[1][1] = -thoProj->comp[1][1];
+  M[1][2] = -thoProj->comp[2][1];
+  Y[1] = thoProj->orig[1];
+  res =
+    FMB3D_SOLVE_HELPER(CheckRow3D)(
+      M[1],
+      Y[1]);
+  if (res != FMB3D_SOLVE_CONSISTENT) {
+
+    FMB3D_SOLVE_WITNESS_SET(1U << 1)
+    FMB3D_SOLVE_STAGE(FMBElimStageInit);
+    return FMB3D_SOLVE_STOP(res);
+
+  }
+
+  M[2][0] = -thoProj->comp[0][2];
+  M[2][1] = -thoProj->comp[1][2];
+  M[2][2] = -thoProj->comp[2][2];
+  Y[2] = thoProj->orig[2];
+  res =
+    FMB3D_SOLVE_HELPER(CheckRow3D)(
+      M[2],
+      Y[2]);
+  if (res != FMB3D_SOLVE_CONSISTENT) {
+
+    FMB3D_SOLVE_WITNESS_SET(1U << 2)
+    FMB3D_SOLVE_STAGE(FMBElimStageInit);
+    return FMB3D_SOLVE_STOP(res);
+
+  }
+
+  // Variable to memorize the nb of rows in the system
+  int nbRows = 3;
+
+  if (thatType == FrameCuboid) {
+
+    // sum_iC_j,iX_i<=1.0-O_j
+    M[nbRows][0] = thoProj->comp[0][0];
+    M[nbRows][1] = thoProj->comp[1][0];
+    M[nbRows][2] = thoProj->comp[2][0];
+    Y[nbRows] = 1.0 - thoProj->orig[0];
+    res =
+      FMB3D_SOLVE_HELPER(CheckRow3D)(
+        M[nbRows],
+        Y[nbRows]);
+    if (res != FMB3D_SOLVE_CONSISTENT) {
+
+      FMB3D_SOLVE_WITNESS_SET(1U << nbRows)
+      FMB3D_SOLVE_STAGE(FMBElimStageInit);
+      return FMB3D_SOLVE_STOP(res);
+
+    }
+
+    ++nbRows;
+
+    M[nbRows][0] = thoProj->comp[0][1];
+    M[nbRows][1] = thoProj->comp[1][1];
+    M[nbRows][2] = thoProj->comp[2][1];
+    Y[nbRows] = 1.0 - thoProj->orig[1];
+    res =
+      FMB3D_SOLVE_HELPER(CheckRow3D)(
+        M[nbRows],
+        Y[nbRows]);
+    if (res != FMB3D_SOLVE_CONSISTENT) {
+
+      FMB3D_SOLVE_WITNESS_SET(1U << nbRows)
+      FMB3D_SOLVE_STAGE(FMBElimStageInit);
+      return FMB3D_SOLVE_STOP(res);
+
+    }
+
+    ++nbRows;
+
+    M[nbRows][0] = thoProj->comp[0][2];
+    M[nbRows][1] = thoProj->comp[1][2];
+    M[nbRows][2] = thoProj->comp[2][2];
+    Y[nbRows] = 1.0 - thoProj->orig[2];
+    res =
+      FMB3D_SOLVE_HELPER(CheckRow3D)(
+        M[nbRows],
+        Y[nbRows]);
+    if (res != FMB3D_SOLVE_CONSISTENT) {
+
+      FMB3D_SOLVE_WITNESS_SET(1U << nbRows)
+      FMB3D_SOLVE_STAGE(FMBElimStageInit);
+      return FMB3D_SOLVE_STOP(res);
+
+    }
+
+    ++nbRows;
+
+  } else {
+
+    // sum_j(sum_iC_j,iX_i)<=1.0-sum_iO_i
+    M[nbRows][0] =
+      thoProj->comp[0][0] + thoProj->comp[0][1] + thoProj->comp[0][2];
+    M[nbRows][1] =
+      thoProj->comp[1][0] + thoProj->comp[1][1] + thoProj->comp[1][2];
+    M[nbRows][2] =
+      thoProj->comp[2][0] + thoProj->comp[2][1] + thoProj->comp[2][2];
+    Y[nbRows] =
+      1.0 - thoProj->orig[0] - thoProj->orig[1] - thoProj->orig[2];
+    res =
+      FMB3D_SOLVE_HELPER(CheckRow3D)(
+        M[nbRows],
+        Y[nbRows]);
+    if (res != FMB3D_SOLVE_CONSISTENT) {
+
+      FMB3D_SOLVE_WITNESS_SET(1U << nbRows)
+      FMB3D_SOLVE_STAGE(FMBElimStageInit);
+      return FMB3D_SOLVE_STOP(res);
+
+    }
+
+    ++nbRows;
+
+  }
+
+  if (thoType == FrameCuboid) {
+
+    // X_i <= 1.0
+    M[nbRows][0] = 1.0;
+    M[nbRows][1] = 0.0;
+    M[nbRows][2] = 0.0;
+    Y[nbRows] = 1.0;
+    ++nbRows;
+
+    M[nbRows][0] = 0.0;
+    M[nbRows][1] = 1.0;
+    M[nbRows][2] = 0.0;
+    Y[nbRows] = 1.0;
+    ++nbRows;
+
+    M[nbRows][0] = 0.0;
+    M[nbRows][1] = 0.0;
+    M[nbRows][2] = 1.0;
+    Y[nbRows] = 1.0;
+    ++nbRows;
+
+  } else {
+
+    // sum_iX_i<=1.0
+    M[nbRows][0] = 1.0;
+    M[nbRows][1] = 1.0;
+    M[nbRows][2] = 1.0;
+    Y[nbRows] = 1.0;
+    ++nbRows;
+
+  }
+
+  // -X_i <= 0.0
+  M[nbRows][0] = -1.0;
+  M[nbRows][1] = 0.0;
+  M[nbRows][2] = 0.0;
+  Y[nbRows] = 0.0;
+  ++nbRows;
+
+  M[nbRows][0] = 0.0;
+  M[nbRows][1] = -1.0;
+  M[nbRows][2] = 0.0;
+  Y[nbRows] = 0.0;
+  ++nbRows;
+
+  M[nbRows][0] = 0.0;
+  M[nbRows][1] = 0.0;
+  M[nbRows][2] = -1.0;
+  Y[nbRows] = 0.0;
+  ++nbRows;
+
+#ifdef FMB3D_SOLVE_WITNESS
+
+  // Each row of the system is the set of itself
+  for (
+    int iRow = nbRows;
+    iRow--;) {
+
+    masks[iRow] = 1U << iRow;
+
+  }
+
+#endif
+
+  // Solve the system
+  // Declare a AABB to memorize the bounding box of the intersection
+  // in the coordinates system of tho
+  AABB3D bdgBoxLocal = {
+
+    .min = {0.0, 0.0, 0.0},
+    .max = {0.0, 0.0, 0.0}
+
+  };
+
+#ifndef FMB3D_SOLVE_MIXED
+
+  // Declare a variable to memorize the axis of the i-th eliminated
+  // variable, the i-th axis of bdgBoxLocal being the one of the i-th
+  // eliminated variable
+  int axes[3] = {FST_VAR, SND_VAR, THD_VAR};
+
+  // If the order of elimination is adaptive, move the variable giving
+  // the smallest system to the first column
+  bool isAdaptive =
+    (atomic_load_explicit(
+      &fmbElimOrder3D,
+      memory_order_relaxed) == FMBElimOrderAdaptive);
+
+  // If that is a Cuboid its constraints come by pairs of opposite
+  // rows, and the constraints of tho add one positive and one
+  // negative coefficient to each column, hence all the columns give
+  // the same number of rows and the first one is kept without
+  // counting
+  if (
+    isAdaptive == true &&
+    thatType == FrameTetrahedron) {
+
+    int iCol =
+      ChooseElimVar3D(
+        M,
+        nbRows,
+        3);
+    if (iCol != 0) {
+
+      SwapCols3D(
+        M,
+        nbRows,
+        0,
+        iCol);
+      axes[0] = iCol;
+      axes[iCol] = FST_VAR;
+
+    }
+
+  }
+
+#endif
+
+  // Declare a variable to memorize the number of rows of the system
+  // after elimination of the first variable
+  int nbRowsP;
+
+  // Eliminate the first variable in the original system
+  res =
+    FMB3D_SOLVE_ELIM(
+      M,
+      Y,
+      masks,
+      nbRows,
+      3,
+      Mp,
+      Yp,
+      masksP,
+      &nbRowsP,
+      path);
+
+  // If the system is inconsistent
+  if (res != FMB3D_SOLVE_CONSISTENT) {
+
+    // The two Frames are not in intersection
+    FMB3D_SOLVE_STAGE(FMBElimStagePass1);
+    return FMB3D_SOLVE_STOP(res);
+
+  }
+
+  // Record the size of the resulting system
+  FMB3D_SOLVE_ROWS(
+    0,
+    nbRowsP);
+
+  // Declare a variable to memorize the number of rows of the system
+  // used for the next elimination
+  int nbRowsPElim = nbRowsP;
+
+#if !defined(FMB3D_SOLVE_MIXED) && !defined(FMB3D_SOLVE_WITNESS)
+
+  // If the user requested it, prune the redundant rows before the
+  // next elimination
+  bool isPruning =
+    atomic_load_explicit(
+      &fmbPruning3D,
+      memory_order_relaxed);
+  if (isPruning == true) {
+
+    PruneRows3D(
+      Mp,
+      Yp,
+      nbRowsP,
+      2,
+      &nbRowsPElim);
+
+  }
+
+#endif
+
+#ifndef FMB3D_SOLVE_MIXED
+
+  // If the order of elimination is adaptive, move the variable giving
+  // the smallest system to the first column, in all the rows as the
+  // pruned ones are used for the bounding box, and in the original
+  // system too if the bounding box is requested
+  if (isAdaptive == true) {
+
+    int iCol =
+      ChooseElimVar3D(
+        Mp,
+        nbRowsPElim,
+        2);
+    if (iCol != 0) {
+
+      SwapCols3D(
+        Mp,
+        nbRowsP,
+        0,
+        iCol);
+      if (bdgBox != NULL) {
+
+        SwapCols3D(
+          M,
+          nbRows,
+          SND_VAR,
+          SND_VAR + iCol);
+
+      }
+
+      int axis = axes[SND_VAR];
+      axes[SND_VAR] = axes[SND_VAR + iCol];
+      axes[SND_VAR + iCol] = axis;
+
+    }
+
+  }
+
+#endif
+
+  // Declare a variable to memorize the number of rows of the system
+  // after elimination of the second variable
+  int nbRowsPP;
+
+  // Eliminate the second variable (which is the first in the new system)
+  res =
+    FMB3D_SOLVE_ELIM(
+      Mp,
+      Yp,
+      masksP,
+      nbRowsPElim,
+      2,
+      Mpp,
+      Ypp,
+      masksPP,
+      &nbRowsPP,
+      path);
+
+  // If the system is inconsistent
+  if (res != FMB3D_SOLVE_CONSISTENT) {
+
+    // The two Frames are not in intersection
+    FMB3D_SOLVE_STAGE(FMBElimStagePass2);
+    return FMB3D_SOLVE_STOP(res);
+
+  }
+
+  // Record the size of the resulting system
+  FMB3D_SOLVE_ROWS(
+    1,
+    nbRowsPP);
+
+  // Get the bounds for the remaining third variable
+  FMB3D_SOLVE_HELPER(GetBoundLastVar3D)(
+    THD_VAR,
+    Mpp,
+    Ypp,
+    nbRowsPP,
+    &bdgBoxLocal);
+
+  // If the bounds are too close to conclude (only in float)
+  FMB3D_SOLVE_UNCERTAIN(
+    bdgBoxLocal.min[THD_VAR],
+    bdgBoxLocal.max[THD_VAR],
+    fabs(bdgBoxLocal.min[THD_VAR]) + fabs(bdgBoxLocal.max[THD_VAR]))
+
+  // If the bounds are inconsistent
+  if (bdgBoxLocal.min[THD_VAR] >= bdgBoxLocal.max[THD_VAR]) {
+
+#ifdef FMB3D_SOLVE_WITNESS
+
+    // The witness is the union of the sets of rows of the rows giving
+    // the bounds
+    *witness =
+      GetBoundWitness3D(
+        Mpp,
+        Ypp,
+        masksPP,
+        nbRowsPP);
+
+#endif
+
+    // The two Frames are not in intersection
+    FMB3D_SOLVE_STAGE(FMBElimStageBound);
+    return FMB3D_SOLVE_NO_INTER;
+
+  }
+
+#ifndef FMB3D_SOLVE_MIXED
+
+  // Here the bounds are consistent, it means the two Frames are in
+  // intersection.
+  // If the user has requested for the resulting bounding box
+  if (bdgBox != NULL) {
+
+    // Get the bounds of the other variables
+    GetBoundVar3D(
+      SND_VAR,
+      Mp,
+      Yp,
+      nbRowsP,
+      2,
+      &bdgBoxLocal);
+
+    GetBoundVar3D(
+      FST_VAR,
+      M,
+      Y,
+      nbRows,
+      3,
+      &bdgBoxLocal);
+
+    // Memorize the result, remapped to the axes of the eliminated
+    // variables
+    for (
+      int iVar = 3;
+      iVar--;) {
+
+      bdgBox->min[axes[iVar]] = bdgBoxLocal.min[iVar];
+      bdgBox->max[axes[iVar]] = bdgBoxLocal.max[iVar];
+
+    }
+
+  }
+
+#endif
+
+  // If we've reached here the two Frames are intersecting
+  FMB3D_SOLVE_STAGE(FMBElimStageInter);
+  return FMB3D_SOLVE_INTER;
+
+}
+
+// Test for intersection between a Cuboid that and the
+// Cuboid thoProj, projection of tho in that's coordinates system
+static inline FMB3D_SOLVE_RESULT FMB3D_SOLVE_NAME(
+  FMBTestIntersectionProj3DCC, Path)(
+  const Frame3D* const thoProj,
+  AABB3D* const bdgBox
+  FMB3D_SOLVE_WITNESS_PARAM,
+  const FrameCPUPath path) {
+
+  // Declare the buffers of the system and its eliminations, sized for
+  // this pair of types
+  FMB3D_SOLVE_REAL M[FMB3D_NB_ROWS_CC][3];
+  FMB3D_SOLVE_REAL Y[FMB3D_NB_ROWS_CC];
+  FMB3D_SOLVE_REAL Mp[FMB3D_NB_ROWS_P_CC][3];
+  FMB3D_SOLVE_REAL Yp[FMB3D_NB_ROWS_P_CC];
+  FMB3D_SOLVE_REAL Mpp[FMB3D_NB_ROWS_PP_CC][3];
+  FMB3D_SOLVE_REAL Ypp[FMB3D_NB_ROWS_PP_CC];
+
+  // Solve the system
+  return
+    FMB3D_SOLVE_NAME(FMBTestIntersectionSolve3D, )(
+      FrameCuboid,
+      FrameCuboid,
+      thoProj,
+      bdgBox,
+      M,
+      Y,
+      Mp,
+      Yp,
+      Mpp,
+      Ypp
+      FMB3D_SOLVE_WITNESS_ARG,
+      path);
+
+}
+
+// Test for intersection between a Cuboid that and the
+// Tetrahedron thoProj, projection of tho in that's coordinates system
+static inline FMB3D_SOLVE_RESULT FMB3D_SOLVE_NAME(
+  FMBTestIntersectionProj3DCT, Path)(
+  const Frame3D* const thoProj,
+  AABB3D* const bdgBox
+  FMB3D_SOLVE_WITNESS_PARAM,
+  const FrameCPUPath path) {
+
+  // Declare the buffers of the system and its eliminations, sized for
+  // this pair of types
+  FMB3D_SOLVE_REAL M[FMB3D_NB_ROWS_CT][3];
+  FMB3D_SOLVE_REAL Y[FMB3D_NB_ROWS_CT];
+  FMB3D_SOLVE_REAL Mp[FMB3D_NB_ROWS_P_CT][3];
+  FMB3D_SOLVE_REAL Yp[FMB3D_NB_ROWS_P_CT];
+  FMB3D_SOLVE_REAL Mpp[FMB3D_NB_ROWS_PP_CT][3];
+  FMB3D_SOLVE_REAL Ypp[FMB3D_NB_ROWS_PP_CT];
+
+  // Solve the system
+  return
+    FMB3D_SOLVE_NAME(FMBTestIntersectionSolve3D, )(
+      FrameCuboid,
+      FrameTetrahedron,
+      thoProj,
+      bdgBox,
+      M,
+      Y,
+      Mp,
+      Yp,
+      Mpp,
+      Ypp
+      FMB3D_SOLVE_WITNESS_ARG,
+      path);
+
+}
+
+// Test for intersection between a Tetrahedron that and the
+// Cuboid thoProj, projection of tho in that's coordinates system
+static inline FMB3D_SOLVE_RESULT FMB3D_SOLVE_NAME(
+  FMBTestIntersectionProj3DTC, Path)(
+  const Frame3D* const thoProj,
+  AABB3D* const bdgBox
+  FMB3D_SOLVE_WITNESS_PARAM,
+  const FrameCPUPath path) {
+
+  // Declare the buffers of the system and its eliminations, sized for
+  // this pair of types
+  FMB3D_SOLVE_REAL M[FMB3D_NB_ROWS_TC][3];
+  FMB3D_SOLVE_REAL Y[FMB3D_NB_ROWS_TC];
+  FMB3D_SOLVE_REAL Mp[FMB3D_NB_ROWS_P_TC][3];
+  FMB3D_SOLVE_REAL Yp[FMB3D_NB_ROWS_P_TC];
+  FMB3D_SOLVE_REAL Mpp[FMB3D_NB_ROWS_PP_TC][3];
+  FMB3D_SOLVE_REAL Ypp[FMB3D_NB_ROWS_PP_TC];
+
+  // Solve the system
+  return
+    FMB3D_SOLVE_NAME(FMBTestIntersectionSolve3D, )(
+      FrameTetrahedron,
+      FrameCuboid,
+      thoProj,
+      bdgBox,
+      M,
+      Y,
+      Mp,
+      Yp,
+      Mpp,
+      Ypp
+      FMB3D_SOLVE_WITNESS_ARG,
+      path);
+
+}
+
+// Test for intersection between a Tetrahedron that and the
+// Tetrahedron thoProj, projection of tho in that's coordinates system
+static inline FMB3D_SOLVE_RESULT FMB3D_SOLVE_NAME(
+  FMBTestIntersectionProj3DTT, Path)(
+  const Frame3D* const thoProj,
+  AABB3D* const bdgBox
+  FMB3D_SOLVE_WITNESS_PARAM,
+  const FrameCPUPath path) {
+
+  // Declare the buffers of the system and its eliminations, sized for
+  // this pair of types
+  FMB3D_SOLVE_REAL M[FMB3D_NB_ROWS_TT][3];
+  FMB3D_SOLVE_REAL Y[FMB3D_NB_ROWS_TT];
+  FMB3D_SOLVE_REAL Mp[FMB3D_NB_ROWS_P_TT][3];
+  FMB3D_SOLVE_REAL Yp[FMB3D_NB_ROWS_P_TT];
+  FMB3D_SOLVE_REAL Mpp[FMB3D_NB_ROWS_PP_TT][3];
+  FMB3D_SOLVE_REAL Ypp[FMB3D_NB_ROWS_PP_TT];
+
+  // Solve the system
+  return
+    FMB3D_SOLVE_NAME(FMBTestIntersectionSolve3D, )(
+      FrameTetrahedron,
+      FrameTetrahedron,
+      thoProj,
+      bdgBox,
+      M,
+      Y,
+      Mp,
+      Yp,
+      Mpp,
+      Ypp
+      FMB3D_SOLVE_WITNESS_ARG,
+      path);
+
+}
+
+// ------------- Macros -------------
+
+#undef FMB3D_SOLVE_MIXED
+#undef FMB3D_SOLVE_WITNESS
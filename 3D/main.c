@@ -29,8 +29,8 @@
 int main(int argc, char** argv) {
 
   // Create the two objects to be tested for intersection
-  double origP3D[3] = {0.0, 0.0, 0.0};
-  double compP3D[3][3] = {
+  FMB_REAL origP3D[3] = {0.0, 0.0, 0.0};
+  FMB_REAL compP3D[3][3] = {
 
     {1.0, 0.0, 0.0},  // First component
     {0.0, 1.0, 0.0},  // Second component
@@ -43,8 +43,8 @@ int main(int argc, char** argv) {
       origP3D,
       compP3D);
 
-  double origQ3D[3] = {0.0, 0.0, 0.0};
-  double compQ3D[3][3] = {
+  FMB_REAL origQ3D[3] = {0.0, 0.0, 0.0};
+  FMB_REAL compQ3D[3][3] = {
 
     {1.0, 0.0, 0.0},
     {0.0, 1.0, 0.0},
@@ -21,13 +21,17 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdbool.h>
+#include <math.h>
+#include <string.h>
 #include <time.h>
-#include <sys/time.h>
 
 // Include FMB and SAT algorithm library
 #include "fmb3d.h"
 #include "sat.h"
 
+// Include the benchmark harness
+#include "bench.h"
+
 // Epsilon to detect degenerated triangles
 #define EPSILON 0.1
 
@@ -40,9 +44,15 @@
 // Nb of tests per run
 #define NB_TESTS 500000
 
-// Nb of times the test is run on one pair of frame, used to
-// slow down the processus and be able to measure time
-#define NB_REPEAT_3D 800
+// Nb of Frames in the set used to qualify the batch test
+#define NB_FRAMES_BATCH 1000
+
+// Nb of steps of the motion of the pairs of Frames, and maximum
+// translation and rotation (in radians) per step, used to qualify the
+// tests with a cache of the witnesses of separation
+#define NB_STEPS_CACHE 100
+#define MAX_TRANSLATION_CACHE 1.0
+#define MAX_ROTATION_CACHE 0.02
 
 // Helper macro to generate random number in [0.0, 1.0]
 #define rnd() (double)(rand())/(double)(RAND_MAX)
@@ -51,8 +61,8 @@
 typedef struct {
 
   FrameType type;
-  double orig[3];
-  double comp[3][3];
+  FMB_REAL orig[3];
+  FMB_REAL comp[3][3];
 
 } Param3D;
 
@@ -62,52 +72,48 @@ typedef enum {
   typeQualif_nearCaseOnly
 } TypeQualif;
 
-// Global variables to count nb of tests resulting in intersection
-// and no intersection, and min/max/total time of execution for each
-double minInter;
-double maxInter;
-double sumInter;
-unsigned long countInter;
-double minNoInter;
-double maxNoInter;
-double sumNoInter;
-unsigned long countNoInter;
-
-double minInterCC;
-double maxInterCC;
-double sumInterCC;
-unsigned long countInterCC;
-double minNoInterCC;
-double maxNoInterCC;
-double sumNoInterCC;
-unsigned long countNoInterCC;
-
-double minInterCT;
-double maxInterCT;
-double sumInterCT;
-unsigned long countInterCT;
-double minNoInterCT;
-double maxNoInterCT;
-double sumNoInterCT;
-unsigned long countNoInterCT;
-
-double minInterTC;
-double maxInterTC;
-double sumInterTC;
-unsigned long countInterTC;
-double minNoInterTC;
-double maxNoInterTC;
-double sumNoInterTC;
-unsigned long countNoInterTC;
-
-double minInterTT;
-double maxInterTT;
-double sumInterTT;
-unsigned long countInterTT;
-double minNoInterTT;
-double maxNoInterTT;
-double sumNoInterTT;
-unsigned long countNoInterTT;
+// Global variables to memorize the distributions of the ratio of
+// execution time FMB/SAT, [iCase][iInter], iCase being 0 for all the
+// pairs and 1 + 2 * typeThat + typeTho for each pair of types, iInter
+// being 0 for the pairs in intersection and 1 for the others
+BenchDist* ratios[5][2];
+
+// Wrappers of the intersection tests with the signature expected by
+// the benchmark harness
+bool QualifTestFMB(
+  const void* const that,
+  const void* const tho) {
+
+  return
+    FMBTestIntersection3D(
+      that,
+      tho,
+      NULL);
+
+}
+
+bool QualifTestSAT(
+  const void* const that,
+  const void* const tho) {
+
+  return
+    SATTestIntersection3D(
+      that,
+      tho);
+
+}
+
+bool QualifTestHybrid(
+  const void* const that,
+  const void* const tho) {
+
+  return
+    FMBHybridTestIntersection3D(
+      that,
+      tho,
+      NULL);
+
+}
 
 // Qualification function
 // Takes two Frame definition as input, run the intersection test on
@@ -153,349 +159,65 @@ void Qualification3DStatic(
 
   }
 
+  // Configuration of the measurements, the time of each test being
+  // the median over repeated samples after warmup
+  BenchConfig config = BenchConfigDefault();
+
   // Loop on pairs of Frames
   for (
     int iPair = 2;
     iPair--;) {
 
-    // Declare an array to memorize the results of the repeated
-    // test on the same pair,
-    // to prevent optimization from the compiler to remove the for loop
-    bool isIntersectingFMB[NB_REPEAT_3D] = {false};
-
-    // Start measuring time
-    struct timeval start;
-    gettimeofday(&start, NULL);
-
-    // Run the FMB intersection test
-    for (
-      int i = NB_REPEAT_3D;
-      i--;) {
-
-      isIntersectingFMB[i] =
-        FMBTestIntersection3D(
-          that,
-          tho,
-          NULL);
-
-    }
-
-    // Stop measuring time
-    struct timeval stop;
-    gettimeofday(&stop, NULL);
-
-    // Calculate the delay of execution
-    unsigned long deltausFMB = 0;
-    if (stop.tv_sec < start.tv_sec) {
-
-      printf("time warps, try again\n");
-      exit(0);
-
-    }
-
-    if (stop.tv_sec > start.tv_sec + 1) {
-
-      printf("deltausFMB >> 1s, decrease NB_REPEAT\n");
-      exit(0);
-
-    }
-
-    if (stop.tv_usec < start.tv_usec) {
-
-      deltausFMB = stop.tv_sec - start.tv_sec;
-      deltausFMB += stop.tv_usec + 1000000 - start.tv_usec;
-
-    } else {
-
-      deltausFMB = stop.tv_usec - start.tv_usec;
-
-    }
-
-    // Declare an array to memorize the results of the repeated
-    // test on the same pair,
-    // to prevent optimization from the compiler to remove the for loop
-    bool isIntersectingSAT[NB_REPEAT_3D] = {false};
-
-    // Start measuring time
-    gettimeofday(&start, NULL);
-
-    // Run the FMB intersection test
-    for (
-      int i = NB_REPEAT_3D;
-      i--;) {
-
-      isIntersectingSAT[i] =
-        SATTestIntersection3D(
-          that,
-          tho);
-
-    }
-
-    // Stop measuring time
-    gettimeofday(&stop, NULL);
-
-    // Calculate the delay of execution
-    unsigned long deltausSAT = 0;
-    if (stop.tv_sec < start.tv_sec) {
-
-      printf("time warps, try again\n");
-      exit(0);
-
-    }
-
-    if (stop.tv_sec > start.tv_sec + 1) {
-
-      printf("deltausSAT >> 1s, decrease NB_REPEAT\n");
+    // Measure the FMB and SAT intersection tests on the pair
+    BenchStats statsFMB;
+    bool isIntersectingFMB =
+      BenchMeasurePair(
+        &config,
+        QualifTestFMB,
+        that,
+        tho,
+        &statsFMB);
+    BenchStats statsSAT;
+    bool isIntersectingSAT =
+      BenchMeasurePair(
+        &config,
+        QualifTestSAT,
+        that,
+        tho,
+        &statsSAT);
+
+    // If FMB and SAT disagrees
+    if (isIntersectingFMB != isIntersectingSAT) {
+
+      printf("Qualification has failed\n");
+      Frame3DPrint(that);
+      printf(" against ");
+      Frame3DPrint(tho);
+      printf("\n");
+      printf("FMB : ");
+      if (isIntersectingFMB == false) printf("no ");
+      printf("intersection\n");
+      printf("SAT : ");
+      if (isIntersectingSAT == false) printf("no ");
+      printf("intersection\n");
+
+      // Stop the qualification test
       exit(0);
 
     }
 
-    if (stop.tv_usec < start.tv_usec) {
-
-      deltausSAT = stop.tv_sec - start.tv_sec;
-      deltausSAT += stop.tv_usec + 1000000 - start.tv_usec;
-
-    } else {
-
-      deltausSAT = stop.tv_usec - start.tv_usec;
-
-    }
-
-    // If the delays are greater than 10ms
-    if (deltausFMB >= 10 && deltausSAT >= 10) {
-
-      // If FMB and SAT disagrees
-      if (isIntersectingFMB[0] != isIntersectingSAT[0]) {
-
-        printf("Qualification has failed\n");
-        Frame3DPrint(that);
-        printf(" against ");
-        Frame3DPrint(tho);
-        printf("\n");
-        printf("FMB : ");
-        if (isIntersectingFMB[0] == false) printf("no ");
-        printf("intersection\n");
-        printf("SAT : ");
-        if (isIntersectingSAT[0] == false) printf("no ");
-        printf("intersection\n");
-
-        // Stop the qualification test
-        exit(0);
-
-      }
-
-      // Get the ratio of execution time
-      double ratio = ((double)deltausFMB) / ((double)deltausSAT);
-
-      // If the Frames intersect
-      if (isIntersectingSAT[0] == true) {
-
-        // Update the counters
-        if (countInter == 0) {
-
-          minInter = ratio;
-          maxInter = ratio;
-
-        } else {
-
-          if (minInter > ratio) minInter = ratio;
-          if (maxInter < ratio) maxInter = ratio;
-
-        }
-
-        sumInter += ratio;
-        ++countInter;
-
-        if (
-          paramP.type == FrameCuboid &&
-          paramQ.type == FrameCuboid) {
-
-          if (countInterCC == 0) {
-
-            minInterCC = ratio;
-            maxInterCC = ratio;
-
-          } else {
-
-            if (minInterCC > ratio) minInterCC = ratio;
-            if (maxInterCC < ratio) maxInterCC = ratio;
-
-          }
-
-          sumInterCC += ratio;
-          ++countInterCC;
-
-        } else if (
-          paramP.type == FrameCuboid &&
-          paramQ.type == FrameTetrahedron) {
-
-          if (countInterCT == 0) {
-
-            minInterCT = ratio;
-            maxInterCT = ratio;
-
-          } else {
-
-            if (minInterCT > ratio) minInterCT = ratio;
-            if (maxInterCT < ratio) maxInterCT = ratio;
-
-          }
-
-          sumInterCT += ratio;
-          ++countInterCT;
-
-        } else if (
-          paramP.type == FrameTetrahedron &&
-          paramQ.type == FrameCuboid) {
-
-          if (countInterTC == 0) {
-
-            minInterTC = ratio;
-            maxInterTC = ratio;
-
-          } else {
-
-            if (minInterTC > ratio) minInterTC = ratio;
-            if (maxInterTC < ratio) maxInterTC = ratio;
-
-          }
-
-          sumInterTC += ratio;
-          ++countInterTC;
-
-        } else if (
-          paramP.type == FrameTetrahedron &&
-          paramQ.type == FrameTetrahedron) {
-
-          if (countInterTT == 0) {
-
-            minInterTT = ratio;
-            maxInterTT = ratio;
-
-          } else {
-
-            if (minInterTT > ratio) minInterTT = ratio;
-            if (maxInterTT < ratio) maxInterTT = ratio;
-
-          }
-
-          sumInterTT += ratio;
-          ++countInterTT;
-
-        }
-
-      // Else, the Frames do not intersect
-      } else {
-
-        // Update the counters
-        if (countNoInter == 0) {
-
-          minNoInter = ratio;
-          maxNoInter = ratio;
-
-        } else {
-
-          if (minNoInter > ratio) minNoInter = ratio;
-          if (maxNoInter < ratio) maxNoInter = ratio;
-
-        }
-
-        sumNoInter += ratio;
-        ++countNoInter;
-
-        if (
-          paramP.type == FrameCuboid &&
-          paramQ.type == FrameCuboid) {
-
-          if (countNoInterCC == 0) {
-
-            minNoInterCC = ratio;
-            maxNoInterCC = ratio;
-
-          } else {
-
-            if (minNoInterCC > ratio) minNoInterCC = ratio;
-            if (maxNoInterCC < ratio) maxNoInterCC = ratio;
-
-          }
-
-          sumNoInterCC += ratio;
-          ++countNoInterCC;
-
-        } else if (
-          paramP.type == FrameCuboid &&
-          paramQ.type == FrameTetrahedron) {
-
-          if (countNoInterCT == 0) {
-
-            minNoInterCT = ratio;
-            maxNoInterCT = ratio;
-
-          } else {
-
-            if (minNoInterCT > ratio) minNoInterCT = ratio;
-            if (maxNoInterCT < ratio) maxNoInterCT = ratio;
-
-          }
-
-          sumNoInterCT += ratio;
-          ++countNoInterCT;
-
-        } else if (
-          paramP.type == FrameTetrahedron &&
-          paramQ.type == FrameCuboid) {
-
-          if (countNoInterTC == 0) {
-
-            minNoInterTC = ratio;
-            maxNoInterTC = ratio;
-
-          } else {
-
-            if (minNoInterTC > ratio) minNoInterTC = ratio;
-            if (maxNoInterTC < ratio) maxNoInterTC = ratio;
-
-          }
-
-          sumNoInterTC += ratio;
-          ++countNoInterTC;
-
-        } else if (
-          paramP.type == FrameTetrahedron &&
-          paramQ.type == FrameTetrahedron) {
-
-          if (countNoInterTT == 0) {
-
-            minNoInterTT = ratio;
-            maxNoInterTT = ratio;
-
-          } else {
+    // Get the ratio of execution time
+    double ratio = statsFMB.median / statsSAT.median;
 
-            if (minNoInterTT > ratio) minNoInterTT = ratio;
-            if (maxNoInterTT < ratio) maxNoInterTT = ratio;
-
-          }
-
-          sumNoInterTT += ratio;
-          ++countNoInterTT;
-
-        }
-
-      }
-
-    // Else, if time of execution for FMB was less than 10ms
-    } else if (deltausFMB < 10) {
-
-      printf("deltausFMB < 10ms, increase NB_REPEAT\n");
-      exit(0);
-
-    // Else, if time of execution for SAT was less than 10ms
-    } else if (deltausSAT < 10) {
-
-      printf("deltausSAT < 10ms, increase NB_REPEAT\n");
-      exit(0);
-
-    }
+    // Update the distributions for all the pairs and for the pair of
+    // types
+    int iInter = (isIntersectingSAT == true ? 0 : 1);
+    BenchDistAdd(
+      ratios[0][iInter],
+      ratio);
+    BenchDistAdd(
+      ratios[1 + 2 * paramP.type + paramQ.type][iInter],
+      ratio);
 
     // Flip the pair of Frames
     that = &Q;
@@ -539,6 +261,21 @@ void Qualify3DStatic(TypeQualif typeQualif) {
 
   }
 
+  // Create the distributions
+  for (
+    int iCase = 5;
+    iCase--;) {
+
+    for (
+      int iInter = 2;
+      iInter--;) {
+
+      ratios[iCase][iInter] = BenchDistCreate();
+
+    }
+
+  }
+
   // Loop on runs
   for (
     int iRun = 0;
@@ -548,51 +285,20 @@ void Qualify3DStatic(TypeQualif typeQualif) {
     // Ratio intersection/no intersection for the displayed results
     double ratioInter = 0.1 + 0.8 * (double)iRun / (double)(NB_RUNS - 1);
 
-    // Initialize counters
-    minInter = 0.0;
-    maxInter = 0.0;
-    sumInter = 0.0;
-    countInter = 0;
-    minNoInter = 0.0;
-    maxNoInter = 0.0;
-    sumNoInter = 0.0;
-    countNoInter = 0;
-
-    minInterCC = 0.0;
-    maxInterCC = 0.0;
-    sumInterCC = 0.0;
-    countInterCC = 0;
-    minNoInterCC = 0.0;
-    maxNoInterCC = 0.0;
-    sumNoInterCC = 0.0;
-    countNoInterCC = 0;
-
-    minInterCT = 0.0;
-    maxInterCT = 0.0;
-    sumInterCT = 0.0;
-    countInterCT = 0;
-    minNoInterCT = 0.0;
-    maxNoInterCT = 0.0;
-    sumNoInterCT = 0.0;
-    countNoInterCT = 0;
-
-    minInterTC = 0.0;
-    maxInterTC = 0.0;
-    sumInterTC = 0.0;
-    countInterTC = 0;
-    minNoInterTC = 0.0;
-    maxNoInterTC = 0.0;
-    sumNoInterTC = 0.0;
-    countNoInterTC = 0;
-
-    minInterTT = 0.0;
-    maxInterTT = 0.0;
-    sumInterTT = 0.0;
-    countInterTT = 0;
-    minNoInterTT = 0.0;
-    maxNoInterTT = 0.0;
-    sumNoInterTT = 0.0;
-    countNoInterTT = 0;
+    // Reset the distributions
+    for (
+      int iCase = 5;
+      iCase--;) {
+
+      for (
+        int iInter = 2;
+        iInter--;) {
+
+        BenchDistReset(ratios[iCase][iInter]);
+
+      }
+
+    }
 
     // Declare two variables to memorize the arguments to the
     // Qualification function
@@ -673,222 +379,26 @@ void Qualify3DStatic(TypeQualif typeQualif) {
     }
 
     // Save the results
-    if (iRun == 0) {
-
-      fprintf(fp, "percPairInter,");
-      fprintf(fp, "countInterTo,countNoInterTo,");
-      fprintf(fp, "minInterTo,avgInterTo,maxInterTo,");
-      fprintf(fp, "minNoInterTo,avgNoInterTo,maxNoInterTo,");
-      fprintf(fp, "minTotalTo,avgTotalTo,maxTotalTo\n");
-
-      fprintf(fpCC, "percPairInter,");
-      fprintf(fpCC, "countInterCC,countNoInterCC,");
-      fprintf(fpCC, "minInterCC,avgInterCC,maxInterCC,");
-      fprintf(fpCC, "minNoInterCC,avgNoInterCC,maxNoInterCC,");
-      fprintf(fpCC, "minTotalCC,avgTotalCC,maxTotalCC\n");
-
-      fprintf(fpCT, "percPairInter,");
-      fprintf(fpCT, "countInterCT,countNoInterCT,");
-      fprintf(fpCT, "minInterCT,avgInterCT,maxInterCT,");
-      fprintf(fpCT, "minNoInterCT,avgNoInterCT,maxNoInterCT,");
-      fprintf(fpCT, "minTotalCT,avgTotalCT,maxTotalCT\n");
-
-      fprintf(fpTC, "percPairInter,");
-      fprintf(fpTC, "countInterTC,countNoInterTC,");
-      fprintf(fpTC, "minInterTC,avgInterTC,maxInterTC,");
-      fprintf(fpTC, "minNoInterTC,avgNoInterTC,maxNoInterTC,");
-      fprintf(fpTC, "minTotalTC,avgTotalTC,maxTotalTC\n");
-
-      fprintf(fpTT, "percPairInter,");
-      fprintf(fpTT, "countInterTT,countNoInterTT,");
-      fprintf(fpTT, "minInterTT,avgInterTT,maxInterTT,");
-      fprintf(fpTT, "minNoInterTT,avgNoInterTT,maxNoInterTT,");
-      fprintf(fpTT, "minTotalTT,avgTotalTT,maxTotalTT\n");
-
-    }
-
-    fprintf(
-      fp,
-      "%.1f,",
-      ratioInter);
-    fprintf(
-      fp,
-      "%lu,%lu,",
-      countInter,
-      countNoInter);
-    double avgInter = sumInter / (double)countInter;
-    fprintf(
-      fp,
-      "%f,%f,%f,",
-      minInter,
-      avgInter,
-      maxInter);
-    double avgNoInter = sumNoInter / (double)countNoInter;
-    fprintf(
-      fp,
-      "%f,%f,%f,",
-      minNoInter,
-      avgNoInter,
-      maxNoInter);
-    double avg =
-      ratioInter * avgInter + (1.0 - ratioInter) * avgNoInter;
-    fprintf(
-      fp,
-      "%f,%f,%f",
-      (minNoInter < minInter ? minNoInter : minInter),
-      avg,
-      (maxNoInter > maxInter ? maxNoInter : maxInter));
-    if (iRun < NB_RUNS - 1) {
-
-      fprintf(fp, "\n");
-
-    }
-
-    fprintf(
-      fpCC,
-      "%.1f,",
-      ratioInter);
-    fprintf(
-      fpCC,
-      "%lu,%lu,",
-      countInterCC,
-      countNoInterCC);
-    double avgInterCC = sumInterCC / (double)countInterCC;
-    fprintf(
-      fpCC,
-      "%f,%f,%f,",
-      minInterCC,
-      avgInterCC,
-      maxInterCC);
-    double avgNoInterCC = sumNoInterCC / (double)countNoInterCC;
-    fprintf(
-      fpCC,
-      "%f,%f,%f,",
-      minNoInterCC,
-      avgNoInterCC,
-      maxNoInterCC);
-    double avgCC =
-      ratioInter * avgInterCC + (1.0 - ratioInter) * avgNoInterCC;
-    fprintf(
-      fpCC,
-      "%f,%f,%f",
-      (minNoInterCC < minInterCC ? minNoInterCC : minInterCC),
-      avgCC,
-      (maxNoInterCC > maxInterCC ? maxNoInterCC : maxInterCC));
-    if (iRun < NB_RUNS - 1) {
-
-      fprintf(fpCC, "\n");
-
-    }
-
-    fprintf(
-      fpCT,
-      "%.1f,",
-      ratioInter);
-    fprintf(
-      fpCT,
-      "%lu,%lu,",
-      countInterCT,
-      countNoInterCT);
-    double avgInterCT = sumInterCT / (double)countInterCT;
-    fprintf(
-      fpCT,
-      "%f,%f,%f,",
-      minInterCT,
-      avgInterCT,
-      maxInterCT);
-    double avgNoInterCT = sumNoInterCT / (double)countNoInterCT;
-    fprintf(
-      fpCT,
-      "%f,%f,%f,",
-      minNoInterCT,
-      avgNoInterCT,
-      maxNoInterCT);
-    double avgCT =
-      ratioInter * avgInterCT + (1.0 - ratioInter) * avgNoInterCT;
-    fprintf(
-      fpCT,
-      "%f,%f,%f",
-      (minNoInterCT < minInterCT ? minNoInterCT : minInterCT),
-      avgCT,
-      (maxNoInterCT > maxInterCT ? maxNoInterCT : maxInterCT));
-    if (iRun < NB_RUNS - 1) {
-
-      fprintf(fpCT, "\n");
-
-    }
-
-    fprintf(
-      fpTC,
-      "%.1f,",
-      ratioInter);
-    fprintf(
-      fpTC,
-      "%lu,%lu,",
-      countInterTC,
-      countNoInterTC);
-    double avgInterTC = sumInterTC / (double)countInterTC;
-    fprintf(
-      fpTC,
-      "%f,%f,%f,",
-      minInterTC,
-      avgInterTC,
-      maxInterTC);
-    double avgNoInterTC = sumNoInterTC / (double)countNoInterTC;
-    fprintf(
-      fpTC,
-      "%f,%f,%f,",
-      minNoInterTC,
-      avgNoInterTC,
-      maxNoInterTC);
-    double avgTC =
-      ratioInter * avgInterTC + (1.0 - ratioInter) * avgNoInterTC;
-    fprintf(
-      fpTC,
-      "%f,%f,%f",
-      (minNoInterTC < minInterTC ? minNoInterTC : minInterTC),
-      avgTC,
-      (maxNoInterTC > maxInterTC ? maxNoInterTC : maxInterTC));
-    if (iRun < NB_RUNS - 1) {
-
-      fprintf(fpTC, "\n");
-
-    }
-
-    fprintf(
-      fpTT,
-      "%.1f,",
-      ratioInter);
-    fprintf(
-      fpTT,
-      "%lu,%lu,",
-      countInterTT,
-      countNoInterTT);
-    double avgInterTT = sumInterTT / (double)countInterTT;
-    fprintf(
-      fpTT,
-      "%f,%f,%f,",
-      minInterTT,
-      avgInterTT,
-      maxInterTT);
-    double avgNoInterTT = sumNoInterTT / (double)countNoInterTT;
-    fprintf(
-      fpTT,
-      "%f,%f,%f,",
-      minNoInterTT,
-      avgNoInterTT,
-      maxNoInterTT);
-    double avgTT =
-      ratioInter * avgInterTT + (1.0 - ratioInter) * avgNoInterTT;
-    fprintf(
-      fpTT,
-      "%f,%f,%f",
-      (minNoInterTT < minInterTT ? minNoInterTT : minInterTT),
-      avgTT,
-      (maxNoInterTT > maxInterTT ? maxNoInterTT : maxInterTT));
-    if (iRun < NB_RUNS - 1) {
-
-      fprintf(fpTT, "\n");
+    FILE* fps[5] = {fp, fpCC, fpCT, fpTC, fpTT};
+    const char* suffixes[5] = {"To", "CC", "CT", "TC", "TT"};
+    for (
+      int iCase = 0;
+      iCase < 5;
+      ++iCase) {
+
+      if (iRun == 0) {
+
+        BenchPrintQualifHeader(
+          fps[iCase],
+          suffixes[iCase]);
+
+      }
+
+      BenchPrintQualif(
+        fps[iCase],
+        ratioInter,
+        ratios[iCase][0],
+        ratios[iCase][1]);
 
     }
 
@@ -901,26 +411,1509 @@ void Qualify3DStatic(TypeQualif typeQualif) {
   fclose(fpTC);
   fclose(fpTT);
 
+  // Free the distributions
+  for (
+    int iCase = 5;
+    iCase--;) {
+
+    for (
+      int iInter = 2;
+      iInter--;) {
+
+      BenchDistFree(ratios[iCase] + iInter);
+
+    }
+
+  }
+
 }
 
-int main(int argc, char** argv) {
+// Qualification of the batch intersection test against the single
+// pair one. Measure the time per pair to test one Frame against a set
+// of NB_FRAMES_BATCH Frames, first by calling FMBTestIntersection3D
+// on each pair, second by calling FMBTestIntersection3DBatch once
+// Results are printed and saved in ../Results/qualification3DBatch.txt
+void QualifyBatch3D(void) {
 
-  TypeQualif typeQualif = typeQualif_all;
+  // Open the file to save the results
+  FILE* fp = fopen("../Results/qualification3DBatch.txt", "w");
+  fprintf(fp, "run\tscalar\tbatch\n");
 
+  // Create the set of random non degenerated Frames
+  Frame3D* frames = malloc(sizeof(Frame3D) * NB_FRAMES_BATCH);
   for (
-    int iArg = 0;
-    iArg < argc;
-    ++iArg) {
+    int iFrame = NB_FRAMES_BATCH;
+    iFrame--;) {
 
-    if (strcmp(argv[iArg], "-nearCaseOnly") == 0) {
+    bool isDegenerated = true;
+    while (isDegenerated == true) {
 
-      typeQualif = typeQualif_nearCaseOnly;
+      FrameType type = (rnd() < 0.5 ? FrameCuboid : FrameTetrahedron);
+      FMB_REAL orig[3];
+      FMB_REAL comp[3][3];
+      for (
+        int iAxis = 3;
+        iAxis--;) {
+
+        orig[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+
+        for (
+          int iComp = 3;
+          iComp--;) {
+
+          comp[iComp][iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+
+        }
+
+      }
+
+      double det =
+        comp[0][0] * (comp[1][1] * comp[2][2] -
+        comp[1][2] * comp[2][1]) -
+        comp[1][0] * (comp[0][1] * comp[2][2] -
+        comp[0][2] * comp[2][1]) +
+        comp[2][0] * (comp[0][1] * comp[1][2] -
+        comp[0][2] * comp[1][1]);
+      if (fabs(det) > EPSILON) {
+
+        frames[iFrame] =
+          Frame3DCreateStatic(
+            type,
+            orig,
+            comp);
+        isDegenerated = false;
+
+      }
 
     }
 
   }
 
-  Qualify3DStatic(typeQualif);
+  // Allocate memory for the results
+  bool* isIntersectingScalar = malloc(sizeof(bool) * NB_FRAMES_BATCH);
+  unsigned long* isIntersectingBatch =
+    malloc(sizeof(unsigned long) * FMBBitsetNbWords(NB_FRAMES_BATCH));
+
+  // Declare variables to sum the time per pair over all the runs
+  double sumScalar = 0.0;
+  double sumBatch = 0.0;
+
+  // Loop on runs
+  for (
+    int iRun = 0;
+    iRun < NB_RUNS;
+    ++iRun) {
+
+    // Start measuring time
+    double start = BenchGetNs();
+
+    // Run the single pair intersection test on all the pairs
+    for (
+      int iThat = NB_FRAMES_BATCH;
+      iThat--;) {
+
+      for (
+        int iTho = NB_FRAMES_BATCH;
+        iTho--;) {
+
+        isIntersectingScalar[iTho] =
+          FMBTestIntersection3D(
+            frames + iThat,
+            frames + iTho,
+            NULL);
+
+      }
+
+    }
+
+    // Calculate the delay of execution
+    double deltansScalar = BenchGetNs() - start;
+
+    // Start measuring time
+    start = BenchGetNs();
+
+    // Run the batch intersection test on all the pairs
+    for (
+      int iThat = NB_FRAMES_BATCH;
+      iThat--;) {
+
+      FMBTestIntersection3DBatch(
+        frames + iThat,
+        frames,
+        NB_FRAMES_BATCH,
+        isIntersectingBatch,
+        NULL);
+
+    }
+
+    // Calculate the delay of execution
+    double deltansBatch = BenchGetNs() - start;
+
+    // Check the results of the last tested Frame against the
+    // set are the same, also prevents the compiler from optimizing
+    // away the loops
+    for (
+      int iTho = NB_FRAMES_BATCH;
+      iTho--;) {
+
+      bool isInterBatch =
+        (FMBBitsetGet(isIntersectingBatch, iTho) == 1UL);
+      if (isIntersectingScalar[iTho] != isInterBatch) {
+
+        printf("Scalar and batch tests disagree\n");
+        exit(0);
+
+      }
+
+    }
+
+    // Convert the delays to nanoseconds per pair
+    double nsScalar =
+      deltansScalar /
+      ((double)NB_FRAMES_BATCH * (double)NB_FRAMES_BATCH);
+    double nsBatch =
+      deltansBatch /
+      ((double)NB_FRAMES_BATCH * (double)NB_FRAMES_BATCH);
+    sumScalar += nsScalar;
+    sumBatch += nsBatch;
+
+    // Print and save the results of the run
+    printf("run %d: scalar %fns/pair, batch %fns/pair\n",
+      iRun, nsScalar, nsBatch);
+    fprintf(fp, "%d\t%f\t%f\n", iRun, nsScalar, nsBatch);
+
+  }
+
+  // Print the average results
+  printf("Average per pair: scalar %fns, batch %fns (ratio %f)\n",
+    sumScalar / (double)NB_RUNS,
+    sumBatch / (double)NB_RUNS,
+    sumBatch / sumScalar);
+
+  // Free memory and close the file
+  free(frames);
+  free(isIntersectingScalar);
+  free(isIntersectingBatch);
+  fclose(fp);
+
+}
+
+// Qualification of the SAT intersection test on precomputed geometries
+// against the one on Frames. Measure the time per pair to test all
+// the pairs of a set of NB_FRAMES_BATCH Frames, first with
+// SATTestIntersection3D, second with SATTestIntersection3DPrecomputed
+// (the creation of the geometries of the Frames is included)
+// Results are printed and saved in ../Results/qualification3DSATFrame.txt
+void QualifySATFrame3D(void) {
+
+  // Open the file to save the results
+  FILE* fp = fopen("../Results/qualification3DSATFrame.txt", "w");
+  fprintf(fp, "run\tsat\tprecomputed\n");
+
+  // Create the set of random non degenerated Frames
+  Frame3D* frames = malloc(sizeof(Frame3D) * NB_FRAMES_BATCH);
+  for (
+    int iFrame = NB_FRAMES_BATCH;
+    iFrame--;) {
+
+    bool isDegenerated = true;
+    while (isDegenerated == true) {
+
+      FrameType type = (rnd() < 0.5 ? FrameCuboid : FrameTetrahedron);
+      FMB_REAL orig[3];
+      FMB_REAL comp[3][3];
+      for (
+        int iAxis = 3;
+        iAxis--;) {
+
+        orig[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+
+        for (
+          int iComp = 3;
+          iComp--;) {
+
+          comp[iComp][iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+
+        }
+
+      }
+
+      double det =
+        comp[0][0] * (comp[1][1] * comp[2][2] -
+        comp[1][2] * comp[2][1]) -
+        comp[1][0] * (comp[0][1] * comp[2][2] -
+        comp[0][2] * comp[2][1]) +
+        comp[2][0] * (comp[0][1] * comp[1][2] -
+        comp[0][2] * comp[1][1]);
+      if (fabs(det) > EPSILON) {
+
+        frames[iFrame] =
+          Frame3DCreateStatic(
+            type,
+            orig,
+            comp);
+        isDegenerated = false;
+
+      }
+
+    }
+
+  }
+
+  // Allocate memory for the geometries of the Frames
+  SATFrame3D* satFrames = malloc(sizeof(SATFrame3D) * NB_FRAMES_BATCH);
+
+  // Declare variables to sum the time per pair over all the runs
+  double sumSAT = 0.0;
+  double sumPrecomputed = 0.0;
+
+  // Loop on runs
+  for (
+    int iRun = 0;
+    iRun < NB_RUNS;
+    ++iRun) {
+
+    // Start measuring time
+    double start = BenchGetNs();
+
+    // Run the intersection test on all the pairs
+    unsigned long nbInterSAT = 0;
+    for (
+      int iThat = NB_FRAMES_BATCH;
+      iThat--;) {
+
+      for (
+        int iTho = NB_FRAMES_BATCH;
+        iTho--;) {
+
+        if (
+          SATTestIntersection3D(
+            frames + iThat,
+            frames + iTho) == true) {
+
+          ++nbInterSAT;
+
+        }
+
+      }
+
+    }
+
+    // Calculate the delay of execution
+    double deltansSAT = BenchGetNs() - start;
+
+    // Start measuring time
+    start = BenchGetNs();
+
+    // Create the geometries and run the intersection test on all the
+    // pairs
+    for (
+      int iFrame = NB_FRAMES_BATCH;
+      iFrame--;) {
+
+      satFrames[iFrame] = SATFrame3DCreate(frames + iFrame);
+
+    }
+
+    unsigned long nbInterPrecomputed = 0;
+    for (
+      int iThat = NB_FRAMES_BATCH;
+      iThat--;) {
+
+      for (
+        int iTho = NB_FRAMES_BATCH;
+        iTho--;) {
+
+        if (
+          SATTestIntersection3DPrecomputed(
+            satFrames + iThat,
+            satFrames + iTho) == true) {
+
+          ++nbInterPrecomputed;
+
+        }
+
+      }
+
+    }
+
+    // Calculate the delay of execution
+    double deltansPrecomputed = BenchGetNs() - start;
+
+    // Check the results are the same, also prevents the compiler from
+    // optimizing away the loops
+    if (nbInterSAT != nbInterPrecomputed) {
+
+      printf("SAT tests on Frames and precomputed geometries disagree\n");
+      exit(0);
+
+    }
+
+    // Convert the delays to nanoseconds per pair
+    double nsSAT =
+      deltansSAT /
+      ((double)NB_FRAMES_BATCH * (double)NB_FRAMES_BATCH);
+    double nsPrecomputed =
+      deltansPrecomputed /
+      ((double)NB_FRAMES_BATCH * (double)NB_FRAMES_BATCH);
+    sumSAT += nsSAT;
+    sumPrecomputed += nsPrecomputed;
+
+    // Print and save the results of the run
+    printf("run %d: sat %fns/pair, precomputed %fns/pair\n",
+      iRun, nsSAT, nsPrecomputed);
+    fprintf(fp, "%d\t%f\t%f\n", iRun, nsSAT, nsPrecomputed);
+
+  }
+
+  // Print the average results
+  printf("Average per pair: sat %fns, precomputed %fns (ratio %f)\n",
+    sumSAT / (double)NB_RUNS,
+    sumPrecomputed / (double)NB_RUNS,
+    sumPrecomputed / sumSAT);
+
+  // Free memory and close the file
+  free(frames);
+  free(satFrames);
+  fclose(fp);
+
+}
+
+// Qualification of the vectorized Fourier-Motzkin elimination against
+// the scalar one. For random pairs of Frames, measure the median
+// time of the intersection test with each implementation and
+// average the time per test for each pair of types (CC, CT, TC, TT)
+// Results are printed and saved in ../Results/qualification3DElim.txt
+void QualifyElim3D(void) {
+
+  // Initialise the random generator
+  srandom(time(NULL));
+
+  // Declare variables to sum the time per test (in ns) for each
+  // pair of types, [iTypeThat][iTypeTho]
+  double sumScalar[2][2] = {{0.0, 0.0}, {0.0, 0.0}};
+  double sumSIMD[2][2] = {{0.0, 0.0}, {0.0, 0.0}};
+  unsigned long count[2][2] = {{0, 0}, {0, 0}};
+
+  // Configuration of the measurements, and result of the last test
+  BenchConfig config = BenchConfigDefault();
+  bool isIntersecting = false;
+
+  // Loop on tests
+  for (
+    unsigned long iTest = NB_FRAMES_BATCH * NB_RUNS;
+    iTest--;) {
+
+    // Create two random non degenerated Frames
+    Frame3D frames[2];
+    for (
+      int iFrame = 2;
+      iFrame--;) {
+
+      bool isDegenerated = true;
+      while (isDegenerated == true) {
+
+        FrameType type = (rnd() < 0.5 ? FrameCuboid : FrameTetrahedron);
+        FMB_REAL orig[3];
+        FMB_REAL comp[3][3];
+        for (
+          int iAxis = 3;
+          iAxis--;) {
+
+          orig[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+
+          for (
+            int iComp = 3;
+            iComp--;) {
+
+            comp[iComp][iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+
+          }
+
+        }
+
+        double det =
+          comp[0][0] * (comp[1][1] * comp[2][2] -
+          comp[1][2] * comp[2][1]) -
+          comp[1][0] * (comp[0][1] * comp[2][2] -
+          comp[0][2] * comp[2][1]) +
+          comp[2][0] * (comp[0][1] * comp[1][2] -
+          comp[0][2] * comp[1][1]);
+        if (fabs(det) > EPSILON) {
+
+          frames[iFrame] =
+            Frame3DCreateStatic(
+              type,
+              orig,
+              comp);
+          isDegenerated = false;
+
+        }
+
+      }
+
+    }
+
+    // Measure the time with each implementation
+    double deltans[2] = {0.0, 0.0};
+    FMBElimMode modes[2] = {FMBElimModeScalar, FMBElimModeSIMD};
+    for (
+      int iMode = 2;
+      iMode--;) {
+
+      FMBSetElimMode3D(modes[iMode]);
+
+      // Measure the median time of the FMB intersection test
+      BenchStats stats;
+      isIntersecting =
+        BenchMeasurePair(
+          &config,
+          QualifTestFMB,
+          frames,
+          frames + 1,
+          &stats);
+      deltans[iMode] = stats.median / BenchGetCyclesPerNs();
+
+    }
+
+    // Update the sums
+    int iThat = (frames[0].type == FrameCuboid ? 0 : 1);
+    int iTho = (frames[1].type == FrameCuboid ? 0 : 1);
+    sumScalar[iThat][iTho] += deltans[0];
+    sumSIMD[iThat][iTho] += deltans[1];
+    ++(count[iThat][iTho]);
+
+  }
+
+  // Restore the default implementation
+  FMBSetElimMode3D(FMBElimModeScalar);
+
+  // Print and save the results
+  FILE* fp = fopen("../Results/qualification3DElim.txt", "w");
+  fprintf(fp, "pair\tscalar\tsimd\tratio\n");
+  printf("Time per test (ns), SIMD width %d, result %d\n",
+    Frame3DSoASIMDWidth(), isIntersecting);
+  const char* labels[2][2] = {{"CC", "CT"}, {"TC", "TT"}};
+  for (
+    int iThat = 0;
+    iThat < 2;
+    ++iThat) {
+
+    for (
+      int iTho = 0;
+      iTho < 2;
+      ++iTho) {
+
+      double avgScalar =
+        sumScalar[iThat][iTho] / (double)(count[iThat][iTho]);
+      double avgSIMD = sumSIMD[iThat][iTho] / (double)(count[iThat][iTho]);
+      printf("%s: scalar %f, simd %f, ratio %f\n",
+        labels[iThat][iTho], avgScalar, avgSIMD, avgSIMD / avgScalar);
+      fprintf(fp, "%s\t%f\t%f\t%f\n",
+        labels[iThat][iTho], avgScalar, avgSIMD, avgSIMD / avgScalar);
+
+    }
+
+  }
+
+  fclose(fp);
+
+}
+
+// Qualification of the pruning of redundant rows between eliminations
+// For random pairs of Frames, measure the median time of
+// the intersection test (without bounding box) without and with pruning
+// and average the time per test for each pair of types (CC, CT, TC,
+// TT)
+// Results are printed and saved in ../Results/qualification3DPrune.txt
+void QualifyPrune3D(void) {
+
+  // Initialise the random generator
+  srandom(time(NULL));
+
+  // Declare variables to sum the time per test (in ns) for each
+  // pair of types, [iTypeThat][iTypeTho]
+  double sumNoPrune[2][2] = {{0.0, 0.0}, {0.0, 0.0}};
+  double sumPrune[2][2] = {{0.0, 0.0}, {0.0, 0.0}};
+  unsigned long count[2][2] = {{0, 0}, {0, 0}};
+
+  // Configuration of the measurements, and result of the last test
+  BenchConfig config = BenchConfigDefault();
+  bool isIntersecting = false;
+
+  // Reset the statistics of the pruning
+  FMBResetPruneStats3D();
+
+  // Loop on tests
+  for (
+    unsigned long iTest = NB_FRAMES_BATCH * NB_RUNS;
+    iTest--;) {
+
+    // Create two random non degenerated Frames
+    Frame3D frames[2];
+    for (
+      int iFrame = 2;
+      iFrame--;) {
+
+      bool isDegenerated = true;
+      while (isDegenerated == true) {
+
+        FrameType type = (rnd() < 0.5 ? FrameCuboid : FrameTetrahedron);
+        FMB_REAL orig[3];
+        FMB_REAL comp[3][3];
+        for (
+          int iAxis = 3;
+          iAxis--;) {
+
+          orig[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+
+          for (
+            int iComp = 3;
+            iComp--;) {
+
+            comp[iComp][iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+
+          }
+
+        }
+
+        double det =
+          comp[0][0] * (comp[1][1] * comp[2][2] -
+          comp[1][2] * comp[2][1]) -
+          comp[1][0] * (comp[0][1] * comp[2][2] -
+          comp[0][2] * comp[2][1]) +
+          comp[2][0] * (comp[0][1] * comp[1][2] -
+          comp[0][2] * comp[1][1]);
+        if (fabs(det) > EPSILON) {
+
+          frames[iFrame] =
+            Frame3DCreateStatic(
+              type,
+              orig,
+              comp);
+          isDegenerated = false;
+
+        }
+
+      }
+
+    }
+
+    // Measure the time without and with pruning
+    double deltans[2] = {0.0, 0.0};
+    for (
+      int iPrune = 2;
+      iPrune--;) {
+
+      FMBSetPruning3D(iPrune == 1);
+
+      // Measure the median time of the FMB intersection test
+      BenchStats stats;
+      isIntersecting =
+        BenchMeasurePair(
+          &config,
+          QualifTestFMB,
+          frames,
+          frames + 1,
+          &stats);
+      deltans[iPrune] = stats.median / BenchGetCyclesPerNs();
+
+    }
+
+    // Update the sums
+    int iThat = (frames[0].type == FrameCuboid ? 0 : 1);
+    int iTho = (frames[1].type == FrameCuboid ? 0 : 1);
+    sumNoPrune[iThat][iTho] += deltans[0];
+    sumPrune[iThat][iTho] += deltans[1];
+    ++(count[iThat][iTho]);
+
+  }
+
+  // Restore the default setting
+  FMBSetPruning3D(false);
+
+  // Print and save the results
+  FILE* fp = fopen("../Results/qualification3DPrune.txt", "w");
+  fprintf(fp, "pair\tnoprune\tprune\tratio\n");
+  printf("Time per test (ns), result %d\n", isIntersecting);
+  const char* labels[2][2] = {{"CC", "CT"}, {"TC", "TT"}};
+  for (
+    int iThat = 0;
+    iThat < 2;
+    ++iThat) {
+
+    for (
+      int iTho = 0;
+      iTho < 2;
+      ++iTho) {
+
+      double avgNoPrune =
+        sumNoPrune[iThat][iTho] / (double)(count[iThat][iTho]);
+      double avgPrune =
+        sumPrune[iThat][iTho] / (double)(count[iThat][iTho]);
+      printf("%s: no pruning %f, pruning %f, ratio %f\n",
+        labels[iThat][iTho], avgNoPrune, avgPrune, avgPrune / avgNoPrune);
+      fprintf(fp, "%s\t%f\t%f\t%f\n",
+        labels[iThat][iTho], avgNoPrune, avgPrune, avgPrune / avgNoPrune);
+
+    }
+
+  }
+
+  // Print the statistics of the pruning
+  FMBPruneStats stats = FMBGetPruneStats3D();
+  printf("Examined %lu rows, removed %lu: ", stats.nbRows,
+    stats.nbDuplicate + stats.nbDominated + stats.nbTrivial);
+  printf("%lu duplicate, %lu dominated, %lu trivial\n",
+    stats.nbDuplicate, stats.nbDominated, stats.nbTrivial);
+
+  fclose(fp);
+
+}
+
+// Qualification of the adaptive order of elimination of the variables
+// For random pairs of Frames, measure the median time of
+// the intersection test (without bounding box) with the fixed and
+// adaptive orders, and get the average and worst time per test for
+// each pair of types (CC, CT, TC, TT)
+// Results are printed and saved in ../Results/qualification3DOrder.txt
+void QualifyOrder3D(void) {
+
+  // Initialise the random generator
+  srandom(time(NULL));
+
+  // Declare variables to sum and memorize the maximum of the time per
+  // test (in ns) for each order and pair of types,
+  // [iOrder][iTypeThat][iTypeTho]
+  double sum[2][2][2] = {{{0.0, 0.0}, {0.0, 0.0}}, {{0.0, 0.0}, {0.0, 0.0}}};
+  double max[2][2][2] = {{{0.0, 0.0}, {0.0, 0.0}}, {{0.0, 0.0}, {0.0, 0.0}}};
+  unsigned long count[2][2] = {{0, 0}, {0, 0}};
+
+  // Configuration of the measurements, and result of the last test
+  BenchConfig config = BenchConfigDefault();
+  bool isIntersecting = false;
+
+  // Loop on tests
+  for (
+    unsigned long iTest = NB_FRAMES_BATCH * NB_RUNS;
+    iTest--;) {
+
+    // Create two random non degenerated Frames
+    Frame3D frames[2];
+    for (
+      int iFrame = 2;
+      iFrame--;) {
+
+      bool isDegenerated = true;
+      while (isDegenerated == true) {
+
+        FrameType type = (rnd() < 0.5 ? FrameCuboid : FrameTetrahedron);
+        FMB_REAL orig[3];
+        FMB_REAL comp[3][3];
+        for (
+          int iAxis = 3;
+          iAxis--;) {
+
+          orig[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+
+          for (
+            int iComp = 3;
+            iComp--;) {
+
+            comp[iComp][iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+
+          }
+
+        }
+
+        double det =
+          comp[0][0] * (comp[1][1] * comp[2][2] -
+          comp[1][2] * comp[2][1]) -
+          comp[1][0] * (comp[0][1] * comp[2][2] -
+          comp[0][2] * comp[2][1]) +
+          comp[2][0] * (comp[0][1] * comp[1][2] -
+          comp[0][2] * comp[1][1]);
+        if (fabs(det) > EPSILON) {
+
+          frames[iFrame] =
+            Frame3DCreateStatic(
+              type,
+              orig,
+              comp);
+          isDegenerated = false;
+
+        }
+
+      }
+
+    }
+
+    // Measure the time with the fixed and adaptive orders
+    double deltans[2] = {0.0, 0.0};
+    for (
+      int iOrder = 2;
+      iOrder--;) {
+
+      FMBSetElimOrder3D(
+        iOrder == 1 ? FMBElimOrderAdaptive : FMBElimOrderFixed);
+
+      // Measure the median time of the FMB intersection test
+      BenchStats stats;
+      isIntersecting =
+        BenchMeasurePair(
+          &config,
+          QualifTestFMB,
+          frames,
+          frames + 1,
+          &stats);
+      deltans[iOrder] = stats.median / BenchGetCyclesPerNs();
+
+    }
+
+    // Update the sums and maximums
+    int iThat = (frames[0].type == FrameCuboid ? 0 : 1);
+    int iTho = (frames[1].type == FrameCuboid ? 0 : 1);
+    for (
+      int iOrder = 2;
+      iOrder--;) {
+
+      sum[iOrder][iThat][iTho] += deltans[iOrder];
+      if (max[iOrder][iThat][iTho] < deltans[iOrder]) {
+
+        max[iOrder][iThat][iTho] = deltans[iOrder];
+
+      }
+
+    }
+
+    ++(count[iThat][iTho]);
+
+  }
+
+  // Restore the default setting
+  FMBSetElimOrder3D(FMBElimOrderFixed);
+
+  // Print and save the results
+  FILE* fp = fopen("../Results/qualification3DOrder.txt", "w");
+  fprintf(fp, "pair\tavgfixed\tavgadaptive\tratio\t");
+  fprintf(fp, "maxfixed\tmaxadaptive\tratio\n");
+  printf("Time per test (ns), result %d\n", isIntersecting);
+  const char* labels[2][2] = {{"CC", "CT"}, {"TC", "TT"}};
+  for (
+    int iThat = 0;
+    iThat < 2;
+    ++iThat) {
+
+    for (
+      int iTho = 0;
+      iTho < 2;
+      ++iTho) {
+
+      double avgFixed =
+        sum[0][iThat][iTho] / (double)(count[iThat][iTho]);
+      double avgAdaptive =
+        sum[1][iThat][iTho] / (double)(count[iThat][iTho]);
+      double maxFixed = max[0][iThat][iTho];
+      double maxAdaptive = max[1][iThat][iTho];
+      printf("%s: average fixed %f, adaptive %f, ratio %f\n",
+        labels[iThat][iTho], avgFixed, avgAdaptive, avgAdaptive / avgFixed);
+      printf("%s: worst fixed %f, adaptive %f, ratio %f\n",
+        labels[iThat][iTho], maxFixed, maxAdaptive, maxAdaptive / maxFixed);
+      fprintf(fp, "%s\t%f\t%f\t%f\t%f\t%f\t%f\n",
+        labels[iThat][iTho], avgFixed, avgAdaptive, avgAdaptive / avgFixed,
+        maxFixed, maxAdaptive, maxAdaptive / maxFixed);
+
+    }
+
+  }
+
+  fclose(fp);
+
+}
+
+// Qualification of the vectorized projections of the vertices in the
+// SAT intersection test
+// For random pairs of Frames, measure the median time of the SAT
+// intersection test with the scalar projection, the vectorized
+// projection on one axis at a time, and the vectorized projection on
+// several axes at once, and get the average time per test for each
+// pair of types (CC, CT, TC, TT)
+// Results are printed and saved in ../Results/qualification3DSATCheck.txt
+void QualifySATCheck3D(void) {
+
+  // Initialise the random generator
+  srandom(time(NULL));
+
+  // Declare variables to sum the time per test (in ns) for each
+  // implementation and pair of types, [iMode][iTypeThat][iTypeTho]
+  double sum[3][2][2] = {
+
+    {{0.0, 0.0}, {0.0, 0.0}},
+    {{0.0, 0.0}, {0.0, 0.0}},
+    {{0.0, 0.0}, {0.0, 0.0}}
+
+  };
+  unsigned long count[2][2] = {{0, 0}, {0, 0}};
+
+  // Implementations of the projection, in the order of sum
+  SATCheckMode checkModes[3] = {
+
+    SATCheckModeScalar,
+    SATCheckModeSIMD,
+    SATCheckModeSIMDAxes
+
+  };
+
+  // Memorize the current implementation of the projection
+  SATCheckMode mode = SATGetCheckMode();
+
+  // Configuration of the measurements, and result of the last test
+  BenchConfig config = BenchConfigDefault();
+  bool isIntersecting = false;
+
+  // Loop on tests
+  for (
+    unsigned long iTest = NB_FRAMES_BATCH * NB_RUNS;
+    iTest--;) {
+
+    // Create two random non degenerated Frames
+    Frame3D frames[2];
+    for (
+      int iFrame = 2;
+      iFrame--;) {
+
+      bool isDegenerated = true;
+      while (isDegenerated == true) {
+
+        FrameType type = (rnd() < 0.5 ? FrameCuboid : FrameTetrahedron);
+        FMB_REAL orig[3];
+        FMB_REAL comp[3][3];
+        for (
+          int iAxis = 3;
+          iAxis--;) {
+
+          orig[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+
+          for (
+            int iComp = 3;
+            iComp--;) {
+
+            comp[iComp][iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+
+          }
+
+        }
+
+        double det =
+          comp[0][0] * (comp[1][1] * comp[2][2] -
+          comp[1][2] * comp[2][1]) -
+          comp[1][0] * (comp[0][1] * comp[2][2] -
+          comp[0][2] * comp[2][1]) +
+          comp[2][0] * (comp[0][1] * comp[1][2] -
+          comp[0][2] * comp[1][1]);
+        if (fabs(det) > EPSILON) {
+
+          frames[iFrame] =
+            Frame3DCreateStatic(
+              type,
+              orig,
+              comp);
+          isDegenerated = false;
+
+        }
+
+      }
+
+    }
+
+    // Measure the median time of the SAT intersection test with each
+    // implementation and update the sums
+    int iThat = (frames[0].type == FrameCuboid ? 0 : 1);
+    int iTho = (frames[1].type == FrameCuboid ? 0 : 1);
+    for (
+      int iMode = 3;
+      iMode--;) {
+
+      SATSetCheckMode(checkModes[iMode]);
+      BenchStats stats;
+      isIntersecting =
+        BenchMeasurePair(
+          &config,
+          QualifTestSAT,
+          frames,
+          frames + 1,
+          &stats);
+      sum[iMode][iThat][iTho] += stats.median / BenchGetCyclesPerNs();
+
+    }
+
+    ++(count[iThat][iTho]);
+
+  }
+
+  // Restore the implementation of the projection
+  SATSetCheckMode(mode);
+
+  // Print and save the results
+  FILE* fp = fopen("../Results/qualification3DSATCheck.txt", "w");
+  fprintf(fp, "pair	avgscalar	avgsimd	ratio	avgsimdaxes	ratio\n");
+  printf("Time per test (ns), SIMD width %d, result %d\n",
+    Frame3DSoASIMDWidth(), isIntersecting);
+  const char* labels[2][2] = {{"CC", "CT"}, {"TC", "TT"}};
+  for (
+    int iThat = 0;
+    iThat < 2;
+    ++iThat) {
+
+    for (
+      int iTho = 0;
+      iTho < 2;
+      ++iTho) {
+
+      double avg[3];
+      for (
+        int iMode = 3;
+        iMode--;) {
+
+        avg[iMode] = sum[iMode][iThat][iTho] / (double)(count[iThat][iTho]);
+
+      }
+
+      printf("%s: scalar %f, SIMD %f (ratio %f), SIMD axes %f (ratio %f)\n",
+        labels[iThat][iTho], avg[0], avg[1], avg[1] / avg[0],
+        avg[2], avg[2] / avg[0]);
+      fprintf(fp, "%s\t%f\t%f\t%f\t%f\t%f\n",
+        labels[iThat][iTho], avg[0], avg[1], avg[1] / avg[0],
+        avg[2], avg[2] / avg[0]);
+
+    }
+
+  }
+
+  fclose(fp);
+
+}
+
+// Qualification of the tests with a cache of the witnesses of
+// separation against the tests without cache. NB_FRAMES_BATCH random
+// pairs of Frames move at constant speed during NB_STEPS_CACHE steps,
+// and each pair is tested at each step with FMB and SAT, with and
+// without cache. Measure the time per test of each of the four tests
+// (the motion of the Frames is not included)
+// Results are printed and saved in ../Results/qualification3DCache.txt
+void QualifyCache3D(void) {
+
+  // Open the file to save the results
+  FILE* fp = fopen("../Results/qualification3DCache.txt", "w");
+  fprintf(fp, "run\tfmb\tfmbcached\tsat\tsatcached\thitfmb\thitsat\n");
+
+  // Create the set of random non degenerated pairs of Frames, and
+  // their motion per step
+  Frame3D* framesInit = malloc(sizeof(Frame3D) * 2 * NB_FRAMES_BATCH);
+  Frame3D* frames = malloc(sizeof(Frame3D) * 2 * NB_FRAMES_BATCH);
+  FMB_REAL (*speeds)[3] = malloc(sizeof(FMB_REAL[3]) * 2 * NB_FRAMES_BATCH);
+  FMB_REAL (*axes)[3] = malloc(sizeof(FMB_REAL[3]) * 2 * NB_FRAMES_BATCH);
+  FMB_REAL* thetas = malloc(sizeof(FMB_REAL) * 2 * NB_FRAMES_BATCH);
+  for (
+    int iFrame = 2 * NB_FRAMES_BATCH;
+    iFrame--;) {
+
+    bool isDegenerated = true;
+    while (isDegenerated == true) {
+
+      FrameType type = (rnd() < 0.5 ? FrameCuboid : FrameTetrahedron);
+      FMB_REAL orig[3];
+      FMB_REAL comp[3][3];
+      for (
+        int iAxis = 3;
+        iAxis--;) {
+
+        orig[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+
+        for (
+          int iComp = 3;
+          iComp--;) {
+
+          comp[iComp][iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+
+        }
+
+      }
+
+      double det =
+        comp[0][0] * (comp[1][1] * comp[2][2] -
+        comp[1][2] * comp[2][1]) -
+        comp[1][0] * (comp[0][1] * comp[2][2] -
+        comp[0][2] * comp[2][1]) +
+        comp[2][0] * (comp[0][1] * comp[1][2] -
+        comp[0][2] * comp[1][1]);
+      if (fabs(det) > EPSILON) {
+
+        framesInit[iFrame] =
+          Frame3DCreateStatic(
+            type,
+            orig,
+            comp);
+        isDegenerated = false;
+
+      }
+
+    }
+
+    for (
+      int iAxis = 3;
+      iAxis--;) {
+
+      speeds[iFrame][iAxis] = (2.0 * rnd() - 1.0) * MAX_TRANSLATION_CACHE;
+      axes[iFrame][iAxis] = 2.0 * rnd() - 1.0;
+
+    }
+
+    thetas[iFrame] = (2.0 * rnd() - 1.0) * MAX_ROTATION_CACHE;
+
+  }
+
+  // Create the caches
+  FMBPairCache* cacheFMB = FMBPairCacheCreate(4 * NB_FRAMES_BATCH);
+  FMBPairCache* cacheSAT = FMBPairCacheCreate(4 * NB_FRAMES_BATCH);
+
+  // Declare variables to sum the time per test over all the runs,
+  // [iTest] with iTest 0: FMB, 1: FMB cached, 2: SAT, 3: SAT cached
+  double sum[4] = {0.0, 0.0, 0.0, 0.0};
+
+  // Loop on runs
+  for (
+    int iRun = 0;
+    iRun < NB_RUNS;
+    ++iRun) {
+
+    // Clear the caches
+    FMBPairCacheClear(cacheFMB);
+    FMBPairCacheClear(cacheSAT);
+
+    // Loop on the tests
+    double ns[4] = {0.0, 0.0, 0.0, 0.0};
+    unsigned long nbInter[4] = {0, 0, 0, 0};
+    for (
+      int iTest = 4;
+      iTest--;) {
+
+      // Reset the Frames to their initial position
+      memcpy(
+        frames,
+        framesInit,
+        sizeof(Frame3D) * 2 * NB_FRAMES_BATCH);
+
+      // Loop on the steps
+      double deltans = 0.0;
+      for (
+        int iStep = NB_STEPS_CACHE;
+        iStep--;) {
+
+        // Start measuring time
+        double start = BenchGetNs();
+
+        // Run the intersection test on all the pairs
+        for (
+          int iPair = NB_FRAMES_BATCH;
+          iPair--;) {
+
+          const Frame3D* that = frames + 2 * iPair;
+          const Frame3D* tho = that + 1;
+          bool isInter = false;
+          if (iTest == 0) {
+
+            isInter =
+              FMBTestIntersection3D(
+                that,
+                tho,
+                NULL);
+
+          } else if (iTest == 1) {
+
+            isInter =
+              FMBTestIntersection3DCached(
+                that,
+                tho,
+                NULL,
+                cacheFMB,
+                2 * iPair,
+                2 * iPair + 1);
+
+          } else if (iTest == 2) {
+
+            isInter =
+              SATTestIntersection3D(
+                that,
+                tho);
+
+          } else {
+
+            isInter =
+              SATTestIntersection3DCached(
+                that,
+                tho,
+                cacheSAT,
+                2 * iPair,
+                2 * iPair + 1);
+
+          }
+
+          if (isInter == true) {
+
+            ++(nbInter[iTest]);
+
+          }
+
+        }
+
+        // Calculate the delay of execution
+        deltans += BenchGetNs() - start;
+
+        // Move the Frames
+        for (
+          int iFrame = 2 * NB_FRAMES_BATCH;
+          iFrame--;) {
+
+          Frame3DTranslate(
+            frames + iFrame,
+            speeds[iFrame]);
+          Frame3DRotate(
+            frames + iFrame,
+            axes[iFrame],
+            thetas[iFrame]);
+
+        }
+
+      }
+
+      // Convert the delay to nanoseconds per test
+      ns[iTest] =
+        deltans / ((double)NB_FRAMES_BATCH * (double)NB_STEPS_CACHE);
+      sum[iTest] += ns[iTest];
+
+    }
+
+    // Check the results are the same with and without cache, also
+    // prevents the compiler from optimizing away the loops
+    if (
+      nbInter[0] != nbInter[1] ||
+      nbInter[2] != nbInter[3]) {
+
+      printf("Tests with and without cache disagree\n");
+      exit(0);
+
+    }
+
+    // Print and save the results of the run
+    double nbTest = (double)NB_FRAMES_BATCH * (double)NB_STEPS_CACHE;
+    double hitFMB = (double)(cacheFMB->nbHit) / nbTest;
+    double hitSAT = (double)(cacheSAT->nbHit) / nbTest;
+    printf("run %d: fmb %fns, cached %fns, sat %fns, cached %fns, ",
+      iRun, ns[0], ns[1], ns[2], ns[3]);
+    printf("hit rate fmb %f, sat %f\n", hitFMB, hitSAT);
+    fprintf(fp, "%d\t%f\t%f\t%f\t%f\t%f\t%f\n",
+      iRun, ns[0], ns[1], ns[2], ns[3], hitFMB, hitSAT);
+
+  }
+
+  // Print the average results
+  printf("Average per test: fmb %fns, cached %fns (ratio %f)\n",
+    sum[0] / (double)NB_RUNS,
+    sum[1] / (double)NB_RUNS,
+    sum[1] / sum[0]);
+  printf("Average per test: sat %fns, cached %fns (ratio %f)\n",
+    sum[2] / (double)NB_RUNS,
+    sum[3] / (double)NB_RUNS,
+    sum[3] / sum[2]);
+
+  // Free memory and close the file
+  FMBPairCacheFree(&cacheFMB);
+  FMBPairCacheFree(&cacheSAT);
+  free(framesInit);
+  free(frames);
+  free(speeds);
+  free(axes);
+  free(thetas);
+  fclose(fp);
+
+}
+
+// Create a random non degenerated Frame for the qualification of the
+// hybrid intersection test
+Frame3D QualifRandomFrame3D(void) {
+
+  // Loop until we get a non degenerated Frame
+  while (true) {
+
+    // 50% chance of being a Cuboid or a Tetrahedron
+    FrameType type = (rnd() < 0.5 ? FrameCuboid : FrameTetrahedron);
+
+    // Random origin and components
+    FMB_REAL orig[3];
+    FMB_REAL comp[3][3];
+    for (
+      int iAxis = 3;
+      iAxis--;) {
+
+      orig[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+
+      for (
+        int iComp = 3;
+        iComp--;) {
+
+        comp[iComp][iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+
+      }
+
+    }
+
+    // If the determinant is not null, ie the Frame is not degenerate
+    double det =
+      comp[0][0] * (comp[1][1] * comp[2][2] -
+      comp[1][2] * comp[2][1]) -
+      comp[1][0] * (comp[0][1] * comp[2][2] -
+      comp[0][2] * comp[2][1]) +
+      comp[2][0] * (comp[0][1] * comp[1][2] -
+      comp[0][2] * comp[1][1]);
+    if (fabs(det) > EPSILON) {
+
+      return
+        Frame3DCreateStatic(
+          type,
+          orig,
+          comp);
+
+    }
+
+  }
+
+}
+
+// Qualification of the hybrid intersection test against FMB and SAT
+// For random pairs of Frames, and for random pairs of Frames whose
+// AABBs intersect (nearCaseOnly, as after a broadphase), measure the
+// median time of FMBTestIntersection3D, SATTestIntersection3D,
+// and FMBHybridTestIntersection3D with the normals to the faces of
+// both Frames and of that only as filter axes, and get the average
+// time per test for the pairs in intersection and the others
+// Results are printed and saved in
+// ../Results/qualification3DHybrid.txt
+void QualifyHybrid3D(void) {
+
+  // Initialise the random generator
+  srandom(time(NULL));
+
+  // Open the file to save the results
+  FILE* fp = fopen("../Results/qualification3DHybrid.txt", "w");
+  fprintf(fp, "dist\tinter\tfmb\tsat\thybridall\thybridthat\n");
+
+  // Tests to measure, and the filter axes of the hybrid tests
+  BenchPairTest tests[4] = {
+
+    QualifTestFMB,
+    QualifTestSAT,
+    QualifTestHybrid,
+    QualifTestHybrid
+
+  };
+  unsigned int hybridAxes[4] = {
+
+    FMB_HYBRID_AXES_ALL,
+    FMB_HYBRID_AXES_ALL,
+    FMB_HYBRID_AXES_ALL,
+    FMB_HYBRID_AXES_THAT
+
+  };
+  const char* labelDists[2] = {"random", "nearcaseonly"};
+  const char* labelInters[2] = {"inter", "nointer"};
+
+  // Memorize the current filter axes
+  unsigned int axes = FMBGetHybridAxes3D();
+
+  // Configuration of the measurements
+  BenchConfig config = BenchConfigDefault();
+
+  // Loop on the distributions of pairs
+  for (
+    int iDist = 0;
+    iDist < 2;
+    ++iDist) {
+
+    // Declare variables to sum the time per test (in ns) for the pairs
+    // in intersection and the others, [iInter][iTest]
+    double sum[2][4] = {{0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0}};
+    unsigned long count[2] = {0, 0};
+
+    // Loop on pairs
+    for (
+      unsigned long iPair = NB_FRAMES_BATCH * NB_RUNS;
+      iPair--;) {
+
+      // Create two random Frames, with intersecting AABBs for the
+      // nearCaseOnly distribution
+      Frame3D frames[2];
+      bool isNear = false;
+      while (isNear == false) {
+
+        frames[0] = QualifRandomFrame3D();
+        frames[1] = QualifRandomFrame3D();
+        if (iDist == 0) {
+
+          break;
+
+        }
+
+        // Check if the AABBs of the Frames intersect
+        isNear =
+          AABBTestIntersection3D(
+            &(frames[0].bdgBox),
+            &(frames[1].bdgBox));
+
+      }
+
+      // Measure the median time of each test, the last one measured
+      // being FMB
+      bool isIntersecting = false;
+      double deltans[4];
+      for (
+        int iTest = 4;
+        iTest--;) {
+
+        FMBSetHybridAxes3D(hybridAxes[iTest]);
+        BenchStats stats;
+        isIntersecting =
+          BenchMeasurePair(
+            &config,
+            tests[iTest],
+            frames,
+            frames + 1,
+            &stats);
+        deltans[iTest] = stats.median / BenchGetCyclesPerNs();
+
+      }
+
+      // Update the sums
+      int iInter = (isIntersecting == true ? 0 : 1);
+      for (
+        int iTest = 4;
+        iTest--;) {
+
+        sum[iInter][iTest] += deltans[iTest];
+
+      }
+
+      ++(count[iInter]);
+
+    }
+
+    // Print and save the results
+    printf("Time per test (ns), %s pairs\n", labelDists[iDist]);
+    for (
+      int iInter = 0;
+      iInter < 2;
+      ++iInter) {
+
+      double avg[4] = {0.0, 0.0, 0.0, 0.0};
+      for (
+        int iTest = 4;
+        iTest--;) {
+
+        if (count[iInter] > 0) {
+
+          avg[iTest] = sum[iInter][iTest] / (double)(count[iInter]);
+
+        }
+
+      }
+
+      printf("%s (%lu pairs): FMB %f, SAT %f, ",
+        labelInters[iInter], count[iInter], avg[0], avg[1]);
+      printf("hybrid all %f, hybrid that %f\n", avg[2], avg[3]);
+      fprintf(fp, "%s\t%s\t%f\t%f\t%f\t%f\n",
+        labelDists[iDist], labelInters[iInter],
+        avg[0], avg[1], avg[2], avg[3]);
+
+    }
+
+  }
+
+  // Restore the filter axes
+  FMBSetHybridAxes3D(axes);
+
+  // Close the file
+  fclose(fp);
+
+}
+
+int main(int argc, char** argv) {
+
+  TypeQualif typeQualif = typeQualif_all;
+
+  for (
+    int iArg = 0;
+    iArg < argc;
+    ++iArg) {
+
+    if (strcmp(argv[iArg], "-nearCaseOnly") == 0) {
+
+      typeQualif = typeQualif_nearCaseOnly;
+
+    } else if (strcmp(argv[iArg], "-batch") == 0) {
+
+      QualifyBatch3D();
+      return 0;
+
+    } else if (strcmp(argv[iArg], "-hybrid") == 0) {
+
+      QualifyHybrid3D();
+      return 0;
+
+    } else if (strcmp(argv[iArg], "-elim") == 0) {
+
+      QualifyElim3D();
+      return 0;
+
+    } else if (strcmp(argv[iArg], "-prune") == 0) {
+
+      QualifyPrune3D();
+      return 0;
+
+    } else if (strcmp(argv[iArg], "-order") == 0) {
+
+      QualifyOrder3D();
+      return 0;
+
+    } else if (strcmp(argv[iArg], "-cache") == 0) {
+
+      QualifyCache3D();
+      return 0;
+
+    } else if (strcmp(argv[iArg], "-satframe") == 0) {
+
+      QualifySATFrame3D();
+      return 0;
+
+    } else if (strcmp(argv[iArg], "-satcheck") == 0) {
+
+      QualifySATCheck3D();
+      return 0;
+
+    }
+
+  }
+
+  Qualify3DStatic(typeQualif);
+
+#ifdef FMB_ELIM_STATS
+
+  // Print the statistics of the elimination
+  FMBElimStats elimStats = FMBGetElimStats3D();
+  FMBElimStatsPrint(
+    &elimStats,
+    stdout);
+
+#endif
 
   return 0;
 
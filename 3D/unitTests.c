@@ -28,12 +28,15 @@
 // Epsilon for numerical precision
 #define EPSILON 0.0001
 
+// Pi
+#define PI 3.14159265358979323846
+
 // Helper structure to pass arguments to the UnitTest function
 typedef struct {
 
   FrameType type;
-  double orig[3];
-  double comp[3][3];
+  FMB_REAL orig[3];
+  FMB_REAL comp[3][3];
 
 } Param3D;
 
@@ -86,8 +89,16 @@ void UnitTest3D(
         tho,
         &bdgBoxLocal);
 
+    // Run the mixed precision intersection test
+    bool isIntersectingMixed =
+      FMBTestIntersection3DMixed(
+        that,
+        tho);
+
     // If the test hasn't given the expected answer about intersection
-    if (isIntersecting != correctAnswer) {
+    if (
+      isIntersecting != correctAnswer ||
+      isIntersectingMixed != correctAnswer) {
 
       // Display information about the failure
       printf(" Failed\n");
@@ -203,6 +214,342 @@ void UnitTest3D(
 
 }
 
+// Check if the Frames A and B are identical (including their inverse
+// components and bounding box)
+bool IsSameFrame3D(
+  const Frame3D* const A,
+  const Frame3D* const B) {
+
+  for (
+    int i = 3;
+    i--;) {
+
+    if (fabs(A->orig[i] - B->orig[i]) > EPSILON) {
+
+      return false;
+
+    }
+
+    for (
+      int j = 3;
+      j--;) {
+
+      if (
+        fabs(A->comp[i][j] - B->comp[i][j]) > EPSILON ||
+        fabs(A->invComp[i][j] - B->invComp[i][j]) > EPSILON) {
+
+        return false;
+
+      }
+
+    }
+
+  }
+
+  for (
+    int i = 3;
+    i--;) {
+
+    if (
+      fabs(A->bdgBox.min[i] - B->bdgBox.min[i]) > EPSILON ||
+      fabs(A->bdgBox.max[i] - B->bdgBox.max[i]) > EPSILON) {
+
+      return false;
+
+    }
+
+  }
+
+  return true;
+
+}
+
+// Unit test of the functions modifying a Frame
+// Translate, rotate and set the components of a Frame and check the
+// result against the same Frame created from scratch
+void UnitTestMutation3D(void) {
+
+  // Create the Frame to be modified
+  FMB_REAL orig[3] = {0.0, 0.0, 0.0};
+  FMB_REAL comp[3][3] = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+  Frame3D P =
+    Frame3DCreateStatic(
+      FrameCuboid,
+      orig,
+      comp);
+
+  // Translate and rotate the Frame
+  FMB_REAL v[3] = {1.0, 2.0, 3.0};
+  Frame3DTranslate(
+    &P,
+    v);
+  FMB_REAL axis[3] = {0.0, 0.0, 2.0};
+  Frame3DRotate(
+    &P,
+    axis,
+    PI * 0.5);
+
+  // Create the expected Frame
+  FMB_REAL origExpected[3] = {1.0, 2.0, 3.0};
+  FMB_REAL compRot[3][3] = {{0.0, 1.0, 0.0}, {-1.0, 0.0, 0.0}, {0.0, 0.0, 1.0}};
+  Frame3D Q =
+    Frame3DCreateStatic(
+      FrameCuboid,
+      origExpected,
+      compRot);
+
+  // Check the result
+  if (IsSameFrame3D(&P, &Q) == false) {
+
+    printf("UnitTestMutation3D translate/rotate Failed\n");
+    printf("Expected : ");
+    Frame3DPrint(&Q);
+    printf("\n     Got : ");
+    Frame3DPrint(&P);
+    printf("\n");
+    exit(0);
+
+  }
+
+  // Set the components of the Frame
+  FMB_REAL compSet[3][3] = {{2.0, 0.5, 0.0}, {0.0, 2.0, 0.0}, {0.0, 0.5, 2.0}};
+  Frame3DSetComp(
+    &P,
+    compSet);
+
+  // Create the expected Frame
+  Q =
+    Frame3DCreateStatic(
+      FrameCuboid,
+      origExpected,
+      compSet);
+
+  // Check the result
+  if (IsSameFrame3D(&P, &Q) == false) {
+
+    printf("UnitTestMutation3D set components Failed\n");
+    printf("Expected : ");
+    Frame3DPrint(&Q);
+    printf("\n     Got : ");
+    Frame3DPrint(&P);
+    printf("\n");
+    exit(0);
+
+  }
+
+  printf("UnitTestMutation3D Succeed\n\n");
+
+}
+
+// Unit test of the exact AABB of the intersection
+// Takes two Frame definitions, the correct answer in term of
+// intersection/no intersection and the correct smallest bounding box
+// in world coordinates
+// Run FMBTestIntersection3DExact on (P,Q) and (Q,P) and check against
+// the correct results
+void UnitTestExact3D(
+  const Param3D paramP,
+  const Param3D paramQ,
+  const bool correctAnswer,
+  const AABB3D* const correctBdgBox) {
+
+  // Create the two Frames
+  Frame3D P =
+    Frame3DCreateStatic(
+      paramP.type,
+      paramP.orig,
+      paramP.comp);
+
+  Frame3D Q =
+    Frame3DCreateStatic(
+      paramQ.type,
+      paramQ.orig,
+      paramQ.comp);
+
+  // Helper variables to loop on the pair (that, tho) and (tho, that)
+  Frame3D* that = &P;
+  Frame3D* tho = &Q;
+
+  // Loop on pairs of Frames
+  for (
+    int iPair = 2;
+    iPair--;) {
+
+    // Run the exact intersection test
+    AABB3D bdgBox;
+    bool isIntersecting =
+      FMBTestIntersection3DExact(
+        that,
+        tho,
+        &bdgBox);
+
+    // If the test hasn't given the expected answer about intersection
+    if (isIntersecting != correctAnswer) {
+
+      printf("UnitTestExact3D Failed\n");
+      printf("Expected : ");
+      if (correctAnswer == false) printf("no ");
+      printf("intersection\n");
+      printf("Got : ");
+      if (isIntersecting == false) printf("no ");
+      printf("intersection\n");
+      exit(0);
+
+    }
+
+    // If the Frames are intersecting, check the bounding box
+    if (isIntersecting == true) {
+
+      for (
+        int iAxis = 3;
+        iAxis--;) {
+
+        if (
+          fabs(bdgBox.min[iAxis] - correctBdgBox->min[iAxis]) > EPSILON ||
+          fabs(bdgBox.max[iAxis] - correctBdgBox->max[iAxis]) > EPSILON) {
+
+          printf("UnitTestExact3D Failed\n");
+          printf("Expected : ");
+          AABB3DPrint(correctBdgBox);
+          printf("\n     Got : ");
+          AABB3DPrint(&bdgBox);
+          printf("\n");
+          exit(0);
+
+        }
+
+      }
+
+    }
+
+    // Flip the pair of Frames
+    that = &Q;
+    tho = &P;
+
+  }
+
+}
+
+// Unit tests of the exact AABB of the intersection on cases where the
+// default AABB is not the smallest one
+void TestExact3D(void) {
+
+  // Two overlapping axis aligned cubes
+  Param3D paramP = {
+
+    .type = FrameCuboid,
+    .orig = {0.0, 0.0, 0.0},
+    .comp = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}
+
+  };
+  Param3D paramQ = {
+
+    .type = FrameCuboid,
+    .orig = {0.5, 0.25, -0.5},
+    .comp = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}
+
+  };
+  AABB3D correctBdgBox = {
+
+    .min = {0.5, 0.25, 0.0},
+    .max = {1.0, 1.0, 0.5}
+
+  };
+  UnitTestExact3D(
+    paramP,
+    paramQ,
+    true,
+    &correctBdgBox);
+
+  // Corner of a cube inside a tetrahedron
+  paramP.type = FrameTetrahedron;
+  paramQ = (Param3D) {
+
+    .type = FrameCuboid,
+    .orig = {0.25, 0.25, 0.25},
+    .comp = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}
+
+  };
+  correctBdgBox = (AABB3D) {
+
+    .min = {0.25, 0.25, 0.25},
+    .max = {0.5, 0.5, 0.5}
+
+  };
+  UnitTestExact3D(
+    paramP,
+    paramQ,
+    true,
+    &correctBdgBox);
+
+  // Cube rotated by 45 degrees around z against an axis aligned cube
+  paramP.type = FrameCuboid;
+  paramQ = (Param3D) {
+
+    .type = FrameCuboid,
+    .orig = {1.0, 0.0, 0.5},
+    .comp = {{0.5, 0.5, 0.0}, {-0.5, 0.5, 0.0}, {0.0, 0.0, 1.0}}
+
+  };
+  correctBdgBox = (AABB3D) {
+
+    .min = {0.5, 0.0, 0.5},
+    .max = {1.0, 1.0, 1.0}
+
+  };
+  UnitTestExact3D(
+    paramP,
+    paramQ,
+    true,
+    &correctBdgBox);
+
+  // Edge of the rotated cube touching the face of the axis aligned cube
+  // (intersecting as for FMBTestIntersection3D, the AABB is degenerate)
+  paramQ.orig[0] = 1.5;
+  correctBdgBox = (AABB3D) {
+
+    .min = {1.0, 0.5, 0.5},
+    .max = {1.0, 0.5, 1.0}
+
+  };
+  UnitTestExact3D(
+    paramP,
+    paramQ,
+    true,
+    &correctBdgBox);
+
+  // Two axis aligned cubes touching by their faces
+  paramQ = (Param3D) {
+
+    .type = FrameCuboid,
+    .orig = {1.0, 0.25, 0.5},
+    .comp = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}}
+
+  };
+  correctBdgBox = (AABB3D) {
+
+    .min = {1.0, 0.25, 0.5},
+    .max = {1.0, 1.0, 1.0}
+
+  };
+  UnitTestExact3D(
+    paramP,
+    paramQ,
+    true,
+    &correctBdgBox);
+
+  // No intersection
+  paramQ.orig[0] = 2.0;
+  UnitTestExact3D(
+    paramP,
+    paramQ,
+    false,
+    NULL);
+
+  printf("UnitTestExact3D Succeed\n\n");
+
+}
+
 void Test3D(void) {
 
   // Declare two variables to memorize the arguments to the
@@ -514,15 +861,83 @@ void Test3D(void) {
     true,
     &correctBdgBox);
 
+  // ----------------------------
+  UnitTestMutation3D();
+
+  // ----------------------------
+  TestExact3D();
+
   // If we reached here, it means all the unit tests succeed
   printf("All unit tests 3D have succeed.\n");
 
 }
 
+// Run the unit tests with each implementation of the hot paths
+// supported by the CPU (cf FrameGetCPUPath)
+void TestCPUPath3D(void) {
+
+  // Memorize the current path to restore it at the end
+  const FrameCPUPath curPath = FrameGetCPUPath();
+  const FrameCPUPath bestPath = FrameGetBestCPUPath();
+
+  // Check that unsupported paths are rejected
+  if (
+    FrameSetCPUPath(FrameCPUNb) == true ||
+    curPath > bestPath) {
+
+    printf("TestCPUPath3D Failed\n");
+    printf("Unsupported path accepted\n");
+    exit(0);
+
+  }
+
+  // Loop on the supported paths
+  for (
+    int iPath = bestPath + 1;
+    iPath--;) {
+
+    if (FrameSetCPUPath((FrameCPUPath)iPath) == false) {
+
+      printf("TestCPUPath3D Failed\n");
+      printf(
+        "Supported path %s rejected\n",
+        FrameGetCPUPathName((FrameCPUPath)iPath));
+      exit(0);
+
+    }
+
+    // Check the width of the vectors of the path, one FMB_REAL for the
+    // generic path and wider for the others
+    int width = Frame3DSoASIMDWidth();
+    if (
+      FRAME_SOA_PAD % width != 0 ||
+      (iPath == FrameCPUGeneric) != (width == 1)) {
+
+      printf("TestCPUPath3D Failed\n");
+      printf(
+        "Width %d of the path %s\n",
+        width,
+        FrameGetCPUPathName((FrameCPUPath)iPath));
+      exit(0);
+
+    }
+
+    printf(
+      "Unit tests with path %s, SIMD width %d\n",
+      FrameGetCPUPathName(FrameGetCPUPath()),
+      width);
+    Test3D();
+
+  }
+
+  FrameSetCPUPath(curPath);
+
+}
+
 // Main function
 int main(int argc, char** argv) {
 
-  Test3D();
+  TestCPUPath3D();
 
   return 0;
 
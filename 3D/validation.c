@@ -36,6 +36,65 @@
 // Nb of tests of the validation
 #define NB_TESTS 1000000
 
+// Nb of Frames in the set used to validate the batch test
+#define NB_FRAMES_BATCH 1000
+
+// Nb of pairs of Frames, nb of steps of their motion, and maximum
+// translation and rotation (in radians) per step, used to validate the
+// tests with a cache of the witnesses of separation
+#define NB_PAIRS_CACHE 1000
+#define NB_STEPS_CACHE 100
+#define MAX_TRANSLATION_CACHE 1.0
+#define MAX_ROTATION_CACHE 0.02
+
+// Nb of pairs of touching Frames, and nb of steps of the bisection
+// bringing them into contact, used to validate the exact test on
+// touching Frames
+#define NB_TESTS_TOUCH 100000
+#define NB_BISECT_TOUCH 100
+
+// Tolerance, relative to the magnitude of the values, of the
+// difference between the vectorized and scalar projections
+#ifdef FMB_REAL_FLOAT
+  #define SOA_TOLERANCE 1e-5
+#else
+  #define SOA_TOLERANCE 1e-12
+#endif
+
+// Tolerance of the difference between the exact AABBs of (A,B) and
+// (B,A), of the inclusion of the exact AABB in the default one, and
+// of the overlap of the AABBs given by the fixed and adaptive orders
+// of elimination: the tolerance of the intersection tests scaled to
+// the range of the coordinates
+#define EXACT_TOLERANCE (FMB_EPSILON * RANGE_AXIS)
+
+// Minimum ratio of the determinant of the components of a Frame to
+// the product of their norms for the AABBs of the exact test to be
+// checked: below the tolerance of the intersection tests the Frame is
+// flat at the precision of FMB_REAL and its inverse components, hence
+// the AABBs, are too imprecise to compare
+#define EXACT_MIN_REL_DET FMB_EPSILON
+
+// Maximum rate of disagreement between FMB and SAT, null in double
+// precision, in float precision both may be wrong on Frames closer
+// than the precision
+#ifdef FMB_REAL_FLOAT
+  #define MAX_DISAGREE_RATE 0.001
+#else
+  #define MAX_DISAGREE_RATE 0.0
+#endif
+
+// Maximum rate of disagreement between the fixed and adaptive orders
+// of elimination: the two orders round differently, and on ill
+// conditioned Frames (RandomFrame3D only rejects the nearly null
+// determinants) the difference may exceed the tolerance even in double
+// precision
+#ifdef FMB_REAL_FLOAT
+  #define MAX_DISAGREE_RATE_ORDER 0.001
+#else
+  #define MAX_DISAGREE_RATE_ORDER 0.00001
+#endif
+
 // Helper macro to generate random number in [0.0, 1.0]
 #define rnd() (double)(rand())/(double)(RAND_MAX)
 
@@ -44,18 +103,22 @@
 unsigned long int nbInter;
 unsigned long int nbNoInter;
 
+// Global variable to count nb of tests where FMB and SAT disagree
+unsigned long int nbDisagree;
+
 // Helper structure to pass arguments to the Validation function
 typedef struct {
 
   FrameType type;
-  double orig[3];
-  double comp[3][3];
+  FMB_REAL orig[3];
+  FMB_REAL comp[3][3];
 
 } Param3D;
 
 // Validation function
 // Takes two Frame definition as input, run the intersection test on
 // them with FMB and SAT, and check the results are identical
+// Check also the hybrid test gives the results of FMB
 void ValidationOnePair3D(
   const Param3D paramP,
   const Param3D paramQ) {
@@ -95,24 +158,75 @@ void ValidationOnePair3D(
         that,
         tho);
 
+    // Test intersection with the hybrid test for each set of filter
+    // axes, the result must be the one of FMB, or no intersection if
+    // a filter axis separates the Frames (then SAT agrees)
+    unsigned int hybridAxes[4] = {
+
+      FMB_HYBRID_AXES_NONE,
+      FMB_HYBRID_AXES_THAT,
+      FMB_HYBRID_AXES_THO,
+      FMB_HYBRID_AXES_ALL
+
+    };
+    unsigned int axes = FMBGetHybridAxes3D();
+    for (
+      int iAxes = 4;
+      iAxes--;) {
+
+      FMBSetHybridAxes3D(hybridAxes[iAxes]);
+      bool isIntersectingHybrid =
+        FMBHybridTestIntersection3D(
+          that,
+          tho,
+          NULL);
+      if (
+        isIntersectingHybrid != isIntersectingFMB &&
+        (isIntersectingHybrid == true || isIntersectingSAT == true)) {
+
+        // Print the disagreement
+        printf("ValidationHybrid3D has failed (axes 0x%x)\n",
+          hybridAxes[iAxes]);
+        Frame3DPrint(that);
+        printf(" against ");
+        Frame3DPrint(tho);
+        printf("\n");
+
+        // Stop the validation
+        exit(EXIT_FAILURE);
+
+      }
+
+    }
+
+    FMBSetHybridAxes3D(axes);
+
     // If the results are different
     if (isIntersectingFMB != isIntersectingSAT) {
 
-      // Print the disagreement
-      printf("Validation3D has failed\n");
-      Frame3DPrint(that);
-      printf(" against ");
-      Frame3DPrint(tho);
-      printf("\n");
-      printf("FMB : ");
-      if (isIntersectingFMB == false) printf("no ");
-      printf("intersection\n");
-      printf("SAT : ");
-      if (isIntersectingSAT == false) printf("no ");
-      printf("intersection\n");
+      // Update the number of disagreements
+      ++nbDisagree;
 
-      // Stop the validation
-      exit(0);
+      // If no disagreement is tolerated
+      if (MAX_DISAGREE_RATE == 0.0) {
+
+        // Print the disagreement
+        printf("Validation3D has failed\n");
+        Frame3DPrint(that);
+        printf(" against ");
+        Frame3DPrint(tho);
+        printf("\n");
+        printf("FMB : ");
+        if (isIntersectingFMB == false) printf("no ");
+        printf("intersection\n");
+        printf("SAT : ");
+        if (isIntersectingSAT == false) printf("no ");
+        printf("intersection\n");
+
+        // Stop the validation
+        exit(EXIT_FAILURE);
+
+      }
 
     }
 
@@ -140,9 +254,6 @@ void ValidationOnePair3D(
 
 void Validate3D(void) {
 
-  // Initialise the random generator
-  srandom(time(NULL));
-
   // Declare two variables to memorize the arguments to the
   // Validation function
   Param3D paramP;
@@ -151,6 +262,7 @@ void Validate3D(void) {
   // Initialize the number of intersection and no intersection
   nbInter = 0;
   nbNoInter = 0;
+  nbDisagree = 0;
 
   // Loop on the tests
   for (
@@ -224,18 +336,1477 @@ void Validate3D(void) {
 
   }
 
+  // Check the rate of disagreement
+  double rateDisagree =
+    (double)nbDisagree / (double)(nbInter + nbNoInter);
+  if (rateDisagree > MAX_DISAGREE_RATE) {
+
+    printf("Validation3D has failed\n");
+    printf("Disagreement rate with SAT %e\n", rateDisagree);
+    exit(EXIT_FAILURE);
+
+  }
+
   // If we reached here it means the validation was successfull
   // Print results
   printf("Validation3D has succeed.\n");
   printf("Tested %lu intersections ", nbInter);
   printf("and %lu no intersections\n", nbNoInter);
+  printf("Disagreement rate with SAT (%s) %e\n",
+    FMB_REAL_NAME, rateDisagree);
 
 }
 
-int main(int argc, char** argv) {
+// Create a random non degenerated Frame
+Frame3D RandomFrame3D(void) {
+
+  // Loop until we get a non degenerated Frame
+  while (true) {
+
+    // 50% chance of being a Cuboid or a Tetrahedron
+    FrameType type = (rnd() < 0.5 ? FrameCuboid : FrameTetrahedron);
+
+    // Random origin and components
+    FMB_REAL orig[3];
+    FMB_REAL comp[3][3];
+    for (
+      int iAxis = 3;
+      iAxis--;) {
+
+      orig[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+
+      for (
+        int iComp = 3;
+        iComp--;) {
+
+        comp[iComp][iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+
+      }
+
+    }
+
+    // If the determinant is not null, ie the Frame is not degenerate
+    double det =
+      comp[0][0] * (comp[1][1] * comp[2][2] -
+      comp[1][2] * comp[2][1]) -
+      comp[1][0] * (comp[0][1] * comp[2][2] -
+      comp[0][2] * comp[2][1]) +
+      comp[2][0] * (comp[0][1] * comp[1][2] -
+      comp[0][2] * comp[1][1]);
+    if (fabs(det) > EPSILON) {
+
+      return
+        Frame3DCreateStatic(
+          type,
+          orig,
+          comp);
+
+    }
+
+  }
+
+}
+
+// Return true if the Frame frame is flat at the precision of FMB_REAL
+// (cf EXACT_MIN_REL_DET)
+bool IsFlatFrame3D(const Frame3D* const frame) {
+
+  // Shortcut
+  const FMB_REAL (*comp)[3] = frame->comp;
+
+  double det =
+    comp[0][0] * (comp[1][1] * comp[2][2] -
+    comp[1][2] * comp[2][1]) -
+    comp[1][0] * (comp[0][1] * comp[2][2] -
+    comp[0][2] * comp[2][1]) +
+    comp[2][0] * (comp[0][1] * comp[1][2] -
+    comp[0][2] * comp[1][1]);
+  double norms = 1.0;
+  for (
+    int iComp = 3;
+    iComp--;) {
+
+    norms *=
+      sqrt(
+        comp[iComp][0] * comp[iComp][0] +
+        comp[iComp][1] * comp[iComp][1] +
+        comp[iComp][2] * comp[iComp][2]);
+
+  }
+
+  return (fabs(det) < EXACT_MIN_REL_DET * norms);
+
+}
+
+// Validation of the batch intersection test
+// Run FMBTestIntersection3DBatch on random sets of Frames and check
+// its results (intersection and bounding box) are identical to the
+// ones of FMBTestIntersection3D on each pair
+void ValidateBatch3D(void) {
+
+  // Create the set of random Frames
+  Frame3D* frames = malloc(sizeof(Frame3D) * NB_FRAMES_BATCH);
+  for (
+    int iFrame = NB_FRAMES_BATCH;
+    iFrame--;) {
+
+    frames[iFrame] = RandomFrame3D();
+
+  }
+
+  // Allocate memory for the results
+  unsigned long* isIntersecting =
+    malloc(sizeof(unsigned long) * FMBBitsetNbWords(NB_FRAMES_BATCH));
+  AABB3D* bdgBoxes = malloc(sizeof(AABB3D) * NB_FRAMES_BATCH);
+
+  // Declare a variable to count the intersections
+  unsigned long nbInterBatch = 0;
+
+  // Loop on the Frames tested against all the others
+  for (
+    int iThat = NB_FRAMES_BATCH;
+    iThat--;) {
+
+    // Run the batch intersection test
+    FMBTestIntersection3DBatch(
+      frames + iThat,
+      frames,
+      NB_FRAMES_BATCH,
+      isIntersecting,
+      bdgBoxes);
+
+    // Loop on the tested Frames
+    for (
+      int iTho = NB_FRAMES_BATCH;
+      iTho--;) {
+
+      // Run the single pair intersection test
+      AABB3D bdgBox;
+      bool isInter =
+        FMBTestIntersection3D(
+          frames + iThat,
+          frames + iTho,
+          &bdgBox);
+
+      // Check the intersection result
+      bool isInterBatch = (FMBBitsetGet(isIntersecting, iTho) == 1UL);
+      bool isSame = (isInter == isInterBatch);
+
+      // If the Frames intersect check the bounding box
+      if (isSame == true && isInter == true) {
+
+        ++nbInterBatch;
+        for (
+          int i = 3;
+          i--;) {
+
+          if (
+            bdgBox.min[i] != bdgBoxes[iTho].min[i] ||
+            bdgBox.max[i] != bdgBoxes[iTho].max[i]) {
+
+            isSame = false;
+
+          }
+
+        }
+
+      }
+
+      // If the results are different
+      if (isSame == false) {
+
+        // Print the disagreement
+        printf("ValidationBatch3D has failed\n");
+        Frame3DPrint(frames + iThat);
+        printf(" against ");
+        Frame3DPrint(frames + iTho);
+        printf("\n");
+
+        // Stop the validation
+        exit(EXIT_FAILURE);
+
+      }
+
+    }
+
+  }
+
+  // Free memory
+  free(frames);
+  free(isIntersecting);
+  free(bdgBoxes);
+
+  // If we reached here it means the validation was successfull
+  // Print results
+  printf("ValidationBatch3D has succeed.\n");
+  printf("Tested %lu intersections ", nbInterBatch);
+  printf("and %lu no intersections\n",
+    (unsigned long)NB_FRAMES_BATCH * NB_FRAMES_BATCH - nbInterBatch);
+
+}
+
+// Validation of the projection of a Frame3DSoA
+// Project a set of random Frames with Frame3DSoAImportFrames and
+// check the results are identical to the ones of Frame3DImportFrame,
+// or at least within SOA_TOLERANCE if the compiler has contracted the
+// operations into FMA instructions
+void ValidateSoA3D(void) {
+
+  // Create the set of random Frames, with a number of Frames which is
+  // not a multiple of FRAME_SOA_PAD to check the padding
+  int nbFrame = NB_FRAMES_BATCH + 1;
+  Frame3D* frames = malloc(sizeof(Frame3D) * nbFrame);
+  Frame3DSoA* soa = Frame3DSoACreate(nbFrame);
+  Frame3DSoA* soaProj = Frame3DSoACreate(nbFrame);
+  for (
+    int iFrame = nbFrame;
+    iFrame--;) {
+
+    frames[iFrame] = RandomFrame3D();
+    Frame3DSoASet(
+      soa,
+      iFrame,
+      frames + iFrame);
+
+  }
+
+  // Declare variables to count the identical values and memorize
+  // the maximum error
+  unsigned long nbIdentical = 0;
+  unsigned long nbValues = 0;
+  double maxError = 0.0;
+
+  // Loop on the Frames used as reference
+  for (
+    int iThat = nbFrame;
+    iThat--;) {
+
+    // Project all the Frames with the vectorized function
+    Frame3DSoAImportFrames(
+      frames + iThat,
+      soa,
+      soaProj);
+
+    // Loop on the projected Frames
+    for (
+      int iTho = nbFrame;
+      iTho--;) {
+
+      // Project the Frame with the scalar function
+      Frame3D proj;
+      Frame3DImportFrame(
+        frames + iThat,
+        frames + iTho,
+        &proj);
+
+      // Get the Frame projected by the vectorized function
+      Frame3D projSoA;
+      Frame3DSoAGet(
+        soaProj,
+        iTho,
+        &projSoA);
+
+      // Compare the origin and components
+      bool isSame = (frames[iTho].type == projSoA.type);
+      for (
+        int i = 3;
+        i--;) {
+
+        double values[4][2] = {
+
+          {proj.orig[i], projSoA.orig[i]},
+          {proj.comp[0][i], projSoA.comp[0][i]},
+          {proj.comp[1][i], projSoA.comp[1][i]},
+          {proj.comp[2][i], projSoA.comp[2][i]}
+
+        };
+
+        for (
+          int iVal = 4;
+          iVal--;) {
+
+          ++nbValues;
+          double error = fabs(values[iVal][0] - values[iVal][1]);
+          if (error == 0.0) {
+
+            ++nbIdentical;
+
+          }
+
+          if (error > maxError) {
+
+            maxError = error;
+
+          }
+
+          if (error > SOA_TOLERANCE * (1.0 + fabs(values[iVal][0]))) {
+
+            isSame = false;
+
+          }
+
+        }
+
+      }
+
+      // If the results are different
+      if (isSame == false) {
+
+        // Print the disagreement
+        printf("ValidationSoA3D has failed\n");
+        Frame3DPrint(frames + iThat);
+        printf(" against ");
+        Frame3DPrint(frames + iTho);
+        printf("\n");
+
+        // Stop the validation
+        exit(EXIT_FAILURE);
+
+      }
+
+    }
+
+  }
+
+  // Free memory
+  free(frames);
+  Frame3DSoAFree(&soa);
+  Frame3DSoAFree(&soaProj);
+
+  // If we reached here it means the validation was successfull
+  // Print results
+  printf("ValidationSoA3D has succeed (SIMD width %d).\n",
+    Frame3DSoASIMDWidth());
+  printf("%lu identical values out of %lu, max error %e\n",
+    nbIdentical, nbValues, maxError);
+
+}
+
+// Validation of the vectorized Fourier-Motzkin elimination
+// Run FMBTestIntersection3D on random pairs of Frames with the scalar
+// and vectorized elimination and check the results (intersection and
+// bounding box) are identical
+void ValidateElimSIMD3D(void) {
+
+  // Declare a variable to count the intersections
+  unsigned long nbInter = 0;
+
+  // Loop on the tests
+  for (
+    unsigned long iTest = NB_TESTS;
+    iTest--;) {
+
+    // Create two random Frames
+    Frame3D that = RandomFrame3D();
+    Frame3D tho = RandomFrame3D();
+
+    // Run the intersection test with the two implementations
+    AABB3D bdgBoxScalar;
+    FMBSetElimMode3D(FMBElimModeScalar);
+    bool isInterScalar =
+      FMBTestIntersection3D(
+        &that,
+        &tho,
+        &bdgBoxScalar);
+
+    AABB3D bdgBoxSIMD;
+    FMBSetElimMode3D(FMBElimModeSIMD);
+    bool isInterSIMD =
+      FMBTestIntersection3D(
+        &that,
+        &tho,
+        &bdgBoxSIMD);
+
+    // Check the results
+    bool isSame = (isInterScalar == isInterSIMD);
+    if (isSame == true && isInterScalar == true) {
+
+      ++nbInter;
+      for (
+        int i = 3;
+        i--;) {
+
+        if (
+          bdgBoxScalar.min[i] != bdgBoxSIMD.min[i] ||
+          bdgBoxScalar.max[i] != bdgBoxSIMD.max[i]) {
+
+          isSame = false;
+
+        }
+
+      }
+
+    }
+
+    // If the results are different
+    if (isSame == false) {
+
+      // Print the disagreement
+      printf("ValidationElimSIMD3D has failed\n");
+      Frame3DPrint(&that);
+      printf(" against ");
+      Frame3DPrint(&tho);
+      printf("\n");
+
+      // Stop the validation
+      exit(EXIT_FAILURE);
+
+    }
+
+  }
+
+  // Restore the default implementation
+  FMBSetElimMode3D(FMBElimModeScalar);
+
+  // If we reached here it means the validation was successfull
+  // Print results
+  printf("ValidationElimSIMD3D has succeed.\n");
+  printf("Tested %lu intersections ", nbInter);
+  printf("and %lu no intersections\n", NB_TESTS - nbInter);
+
+}
+
+// Validation of the pruning of redundant rows
+// Run FMBTestIntersection3D on random pairs of Frames with and
+// without pruning (and without bounding box, which enables more
+// pruning) and check the intersection results are identical.
+// Print the largest difference between the resulting bounding boxes
+// and the statistics of the pruning
+void ValidatePruning3D(void) {
+
+  // Declare variables to count the intersections and memorize the
+  // largest difference of bounding boxes
+  unsigned long nbInter = 0;
+  double maxDiffBdgBox = 0.0;
+
+  // Reset the statistics of the pruning
+  FMBResetPruneStats3D();
+
+  // Loop on the tests
+  for (
+    unsigned long iTest = NB_TESTS;
+    iTest--;) {
+
+    // Create two random Frames
+    Frame3D that = RandomFrame3D();
+    Frame3D tho = RandomFrame3D();
+
+    // Run the intersection test without and with pruning
+    AABB3D bdgBox;
+    FMBSetPruning3D(false);
+    bool isInter =
+      FMBTestIntersection3D(
+        &that,
+        &tho,
+        &bdgBox);
+
+    AABB3D bdgBoxPruned;
+    FMBSetPruning3D(true);
+    bool isInterPruned =
+      FMBTestIntersection3D(
+        &that,
+        &tho,
+        &bdgBoxPruned);
+
+    // Run the intersection test with pruning without bounding box
+    bool isInterPrunedNoBdgBox =
+      FMBTestIntersection3D(
+        &that,
+        &tho,
+        NULL);
+
+    // If the results are different
+    if (
+      isInter != isInterPruned ||
+      isInter != isInterPrunedNoBdgBox) {
+
+      // Print the disagreement
+      printf("ValidationPruning3D has failed\n");
+      Frame3DPrint(&that);
+      printf(" against ");
+      Frame3DPrint(&tho);
+      printf("\n");
+
+      // Stop the validation
+      exit(EXIT_FAILURE);
+
+    }
+
+    // Update the largest difference of bounding boxes
+    if (isInter == true) {
+
+      ++nbInter;
+      for (
+        int i = 3;
+        i--;) {
+
+        double diff = fabs(bdgBox.min[i] - bdgBoxPruned.min[i]);
+        if (diff > maxDiffBdgBox) {
+
+          maxDiffBdgBox = diff;
+
+        }
+
+        diff = fabs(bdgBox.max[i] - bdgBoxPruned.max[i]);
+        if (diff > maxDiffBdgBox) {
+
+          maxDiffBdgBox = diff;
+
+        }
+
+      }
+
+    }
+
+  }
+
+  // Restore the default setting
+  FMBSetPruning3D(false);
+
+  // If we reached here it means the validation was successfull
+  // Print results
+  FMBPruneStats stats = FMBGetPruneStats3D();
+  printf("ValidationPruning3D has succeed.\n");
+  printf("Tested %lu intersections ", nbInter);
+  printf("and %lu no intersections\n", NB_TESTS - nbInter);
+  printf("Max difference of bounding boxes %e\n", maxDiffBdgBox);
+  printf("Examined %lu rows, removed %lu: ", stats.nbRows,
+    stats.nbDuplicate + stats.nbDominated + stats.nbTrivial);
+  printf("%lu duplicate, %lu dominated, %lu trivial\n",
+    stats.nbDuplicate, stats.nbDominated, stats.nbTrivial);
+
+}
+
+// Validation of the adaptive order of elimination of the variables
+// Run FMBTestIntersection3D on random pairs of Frames with the fixed
+// and adaptive orders, with and without bounding box, and check the
+// intersection results are identical and the two bounding boxes,
+// which both contain the intersection, overlap
+// Print the ratio of the total volumes of the adaptive and fixed
+// bounding boxes
+void ValidateElimOrder3D(void) {
+
+  // Declare variables to count the intersections and disagreements,
+  // and memorize the sums of volumes
+  unsigned long nbInter = 0;
+  unsigned long nbDisagreeOrder = 0;
+  double sumVolAdaptive = 0.0;
+  double sumVol = 0.0;
+
+  // Loop on the tests
+  for (
+    unsigned long iTest = NB_TESTS;
+    iTest--;) {
+
+    // Create two random Frames
+    Frame3D that = RandomFrame3D();
+    Frame3D tho = RandomFrame3D();
+
+    // Run the intersection test with the fixed and adaptive orders
+    AABB3D bdgBox;
+    FMBSetElimOrder3D(FMBElimOrderFixed);
+    bool isInter =
+      FMBTestIntersection3D(
+        &that,
+        &tho,
+        &bdgBox);
+
+    AABB3D bdgBoxAdaptive;
+    FMBSetElimOrder3D(FMBElimOrderAdaptive);
+    bool isInterAdaptive =
+      FMBTestIntersection3D(
+        &that,
+        &tho,
+        &bdgBoxAdaptive);
+    bool isInterAdaptiveNoBdgBox =
+      FMBTestIntersection3D(
+        &that,
+        &tho,
+        NULL);
+
+    // Check the results, the results of ill conditioned Frames, or in
+    // float precision of Frames closer than the precision, may be
+    // different
+    bool isValid = (isInterAdaptive == isInterAdaptiveNoBdgBox);
+    bool isSame = (isInter == isInterAdaptive);
+    if (
+      isSame == true &&
+      isInter == true) {
+
+      ++nbInter;
+      double volAdaptive = 1.0;
+      double vol = 1.0;
+      for (
+        int i = 3;
+        i--;) {
+
+        if (
+          bdgBoxAdaptive.min[i] > bdgBox.max[i] + EXACT_TOLERANCE ||
+          bdgBox.min[i] > bdgBoxAdaptive.max[i] + EXACT_TOLERANCE) {
+
+          isSame = false;
+
+        }
+
+        volAdaptive *= bdgBoxAdaptive.max[i] - bdgBoxAdaptive.min[i];
+        vol *= bdgBox.max[i] - bdgBox.min[i];
+
+      }
+
+      sumVolAdaptive += volAdaptive;
+      sumVol += vol;
+
+    }
+
+    if (isSame == false) {
+
+      ++nbDisagreeOrder;
+      isValid = isValid && (MAX_DISAGREE_RATE_ORDER > 0.0);
+
+    }
+
+    // If the results are invalid
+    if (isValid == false) {
+
+      // Print the disagreement
+      printf("ValidationElimOrder3D has failed\n");
+      Frame3DPrint(&that);
+      printf(" against ");
+      Frame3DPrint(&tho);
+      printf("\n");
+
+      // Stop the validation
+      exit(EXIT_FAILURE);
+
+    }
+
+  }
+
+  // Restore the default setting
+  FMBSetElimOrder3D(FMBElimOrderFixed);
+
+  // Check the rate of disagreement
+  double rateDisagree = (double)nbDisagreeOrder / (double)NB_TESTS;
+  if (rateDisagree > MAX_DISAGREE_RATE_ORDER) {
+
+    printf("ValidationElimOrder3D has failed\n");
+    printf("Disagreement rate %e\n", rateDisagree);
+    exit(EXIT_FAILURE);
+
+  }
+
+  // If we reached here it means the validation was successfull
+  // Print results
+  printf("ValidationElimOrder3D has succeed.\n");
+  printf("Tested %lu intersections ", nbInter);
+  printf("and %lu no intersections\n", NB_TESTS - nbInter);
+  if (sumVol > 0.0) {
+
+    printf("Total volume of the adaptive AABBs relative to the fixed ones %f\n",
+      sumVolAdaptive / sumVol);
+
+  }
+
+}
+
+// Validation of the tests with a cache of the witnesses of separation
+// Move randomly NB_PAIRS_CACHE pairs of Frames by small steps and at
+// each step check the results of FMBTestIntersection3DCached and
+// SATTestIntersection3DCached are the ones of FMBTestIntersection3D
+// and SATTestIntersection3D
+// Print the rates of hit of the caches
+void ValidateCached3D(void) {
+
+  // Create the pairs of Frames and the caches
+  Frame3D* frames = malloc(sizeof(Frame3D) * 2 * NB_PAIRS_CACHE);
+  for (
+    int iFrame = 2 * NB_PAIRS_CACHE;
+    iFrame--;) {
+
+    frames[iFrame] = RandomFrame3D();
+
+  }
+
+  FMBPairCache* cacheFMB = FMBPairCacheCreate(4 * NB_PAIRS_CACHE);
+  FMBPairCache* cacheSAT = FMBPairCacheCreate(4 * NB_PAIRS_CACHE);
+
+  // Declare variables to count the intersections and disagreements
+  unsigned long nbInter = 0;
+  unsigned long nbDisagreeCache = 0;
+
+  // Loop on the steps
+  for (
+    int iStep = NB_STEPS_CACHE;
+    iStep--;) {
+
+    // Loop on the pairs
+    for (
+      int iPair = NB_PAIRS_CACHE;
+      iPair--;) {
+
+      // Shortcuts
+      Frame3D* that = frames + 2 * iPair;
+      Frame3D* tho = that + 1;
+
+      // Run the intersection tests with and without cache
+      AABB3D bdgBox;
+      bool isInter =
+        FMBTestIntersection3D(
+          that,
+          tho,
+          &bdgBox);
+      AABB3D bdgBoxCached;
+      bool isInterCached =
+        FMBTestIntersection3DCached(
+          that,
+          tho,
+          &bdgBoxCached,
+          cacheFMB,
+          2 * iPair,
+          2 * iPair + 1);
+      bool isInterSAT =
+        SATTestIntersection3D(
+          that,
+          tho);
+      bool isInterSATCached =
+        SATTestIntersection3DCached(
+          that,
+          tho,
+          cacheSAT,
+          2 * iPair,
+          2 * iPair + 1);
+
+      // Check the results, in float precision the results of Frames
+      // closer than the precision may be different
+      bool isSame =
+        (isInter == isInterCached && isInterSAT == isInterSATCached);
+      if (
+        isSame == true &&
+        isInter == true) {
+
+        ++nbInter;
+        for (
+          int i = 3;
+          i--;) {
+
+          if (
+            bdgBox.min[i] != bdgBoxCached.min[i] ||
+            bdgBox.max[i] != bdgBoxCached.max[i]) {
+
+            isSame = false;
+
+          }
+
+        }
+
+      }
+
+      if (isSame == false) {
+
+        ++nbDisagreeCache;
+        if (MAX_DISAGREE_RATE == 0.0) {
+
+          // Print the disagreement
+          printf("ValidationCached3D has failed\n");
+          Frame3DPrint(that);
+          printf(" against ");
+          Frame3DPrint(tho);
+          printf("\n");
+
+          // Stop the validation
+          exit(EXIT_FAILURE);
+
+        }
+
+      }
+
+      // Move the Frames of the pair
+      for (
+        int iFrame = 2;
+        iFrame--;) {
+
+        FMB_REAL v[3];
+        FMB_REAL axis[3];
+        for (
+          int i = 3;
+          i--;) {
+
+          v[i] = (2.0 * rnd() - 1.0) * MAX_TRANSLATION_CACHE;
+          axis[i] = 2.0 * rnd() - 1.0;
+
+        }
+
+        Frame3DTranslate(
+          that + iFrame,
+          v);
+        Frame3DRotate(
+          that + iFrame,
+          axis,
+          (2.0 * rnd() - 1.0) * MAX_ROTATION_CACHE);
+
+      }
+
+    }
+
+  }
+
+  // Check the rate of disagreement
+  unsigned long nbTest = (unsigned long)NB_PAIRS_CACHE * NB_STEPS_CACHE;
+  double rateDisagree = (double)nbDisagreeCache / (double)nbTest;
+  if (rateDisagree > MAX_DISAGREE_RATE) {
+
+    printf("ValidationCached3D has failed\n");
+    printf("Disagreement rate %e\n", rateDisagree);
+    exit(EXIT_FAILURE);
+
+  }
+
+  // If we reached here it means the validation was successfull
+  // Print results
+  printf("ValidationCached3D has succeed.\n");
+  printf("Tested %lu intersections ", nbInter);
+  printf("and %lu no intersections\n", nbTest - nbInter);
+  printf("Hit rate FMB %f, SAT %f\n",
+    (double)(cacheFMB->nbHit) / (double)nbTest,
+    (double)(cacheSAT->nbHit) / (double)nbTest);
+
+  // Free memory
+  FMBPairCacheFree(&cacheFMB);
+  FMBPairCacheFree(&cacheSAT);
+  free(frames);
+
+}
+
+// Validation of the SAT intersection test on precomputed geometries
+// Run SATTestIntersection3DPrecomputed on all the pairs of a set of
+// random Frames and check its results are identical to the ones of
+// SATTestIntersection3D
+void ValidateSATFrame3D(void) {
+
+  // Create the set of random Frames and their geometries
+  Frame3D* frames = malloc(sizeof(Frame3D) * NB_FRAMES_BATCH);
+  SATFrame3D* satFrames = malloc(sizeof(SATFrame3D) * NB_FRAMES_BATCH);
+  for (
+    int iFrame = NB_FRAMES_BATCH;
+    iFrame--;) {
+
+    frames[iFrame] = RandomFrame3D();
+    satFrames[iFrame] = SATFrame3DCreate(frames + iFrame);
+
+  }
+
+  // Declare a variable to count the intersections
+  unsigned long nbInter = 0;
+
+  // Loop on the pairs of Frames
+  for (
+    int iThat = NB_FRAMES_BATCH;
+    iThat--;) {
+
+    for (
+      int iTho = NB_FRAMES_BATCH;
+      iTho--;) {
+
+      // Run the intersection tests
+      bool isInter =
+        SATTestIntersection3D(
+          frames + iThat,
+          frames + iTho);
+      bool isInterPrecomputed =
+        SATTestIntersection3DPrecomputed(
+          satFrames + iThat,
+          satFrames + iTho);
+
+      // If the results are different
+      if (isInter != isInterPrecomputed) {
+
+        // Print the disagreement
+        printf("ValidationSATFrame3D has failed\n");
+        Frame3DPrint(frames + iThat);
+        printf(" against ");
+        Frame3DPrint(frames + iTho);
+        printf("\n");
+
+        // Stop the validation
+        exit(EXIT_FAILURE);
+
+      }
+
+      if (isInter == true) {
+
+        ++nbInter;
+
+      }
+
+    }
+
+  }
+
+  // Free memory
+  free(frames);
+  free(satFrames);
+
+  // If we reached here it means the validation was successfull
+  // Print results
+  printf("ValidationSATFrame3D has succeed.\n");
+  printf("Tested %lu intersections ", nbInter);
+  printf("and %lu no intersections\n",
+    (unsigned long)NB_FRAMES_BATCH * NB_FRAMES_BATCH - nbInter);
+
+}
+
+// Validation of the vectorized projections of the vertices in the SAT
+// intersection test
+// Run SATTestIntersection3D with each implementation of the projection
+// on all the pairs of a set of random Frames and check their results
+// are identical to the ones of the scalar projection
+void ValidateSATCheck3D(void) {
+
+  // Create the set of random Frames
+  Frame3D* frames = malloc(sizeof(Frame3D) * NB_FRAMES_BATCH);
+  for (
+    int iFrame = NB_FRAMES_BATCH;
+    iFrame--;) {
+
+    frames[iFrame] = RandomFrame3D();
+
+  }
+
+  // Memorize the current implementation of the projection
+  SATCheckMode mode = SATGetCheckMode();
+
+  // Declare a variable to count the intersections
+  unsigned long nbInter = 0;
+
+  // Loop on the pairs of Frames
+  for (
+    int iThat = NB_FRAMES_BATCH;
+    iThat--;) {
+
+    for (
+      int iTho = NB_FRAMES_BATCH;
+      iTho--;) {
+
+      // Run the intersection test with the scalar projection
+      SATSetCheckMode(SATCheckModeScalar);
+      bool isInter =
+        SATTestIntersection3D(
+          frames + iThat,
+          frames + iTho);
+
+      // Loop on the vectorized projections
+      SATCheckMode checkModes[2] = {
+
+        SATCheckModeSIMD,
+        SATCheckModeSIMDAxes
+
+      };
+      for (
+        int iMode = 2;
+        iMode--;) {
+
+        // Run the intersection test
+        SATSetCheckMode(checkModes[iMode]);
+        bool isInterCheck =
+          SATTestIntersection3D(
+            frames + iThat,
+            frames + iTho);
+
+        // If the results are different
+        if (isInter != isInterCheck) {
+
+          // Print the disagreement
+          printf("ValidationSATCheck3D has failed (mode %d)\n",
+            checkModes[iMode]);
+          Frame3DPrint(frames + iThat);
+          printf(" against ");
+          Frame3DPrint(frames + iTho);
+          printf("\n");
+
+          // Stop the validation
+          exit(EXIT_FAILURE);
+
+        }
+
+      }
+
+      if (isInter == true) {
+
+        ++nbInter;
+
+      }
+
+    }
+
+  }
+
+  // Restore the implementation of the projection
+  SATSetCheckMode(mode);
+
+  // Free memory
+  free(frames);
+
+  // If we reached here it means the validation was successfull
+  // Print results
+  printf("ValidationSATCheck3D has succeed.\n");
+  printf("Tested %lu intersections ", nbInter);
+  printf("and %lu no intersections\n",
+    (unsigned long)NB_FRAMES_BATCH * NB_FRAMES_BATCH - nbInter);
+
+}
+
+// Validation of the exact AABB of the intersection
+// Run FMBTestIntersection3DExact on random pairs of Frames in both
+// orders and check the intersection results are the ones of
+// FMBTestIntersection3D, the AABBs of (A,B) and (B,A) are identical
+// and included in the AABB given by FMBTestIntersection3D, unless one
+// of the Frames is flat (cf IsFlatFrame3D)
+// Print the average ratio of the volumes of the exact and default
+// AABBs
+void ValidateExact3D(void) {
+
+  // Declare variables to count the intersections, the intersections of
+  // flat Frames and memorize the sum of ratios of volumes
+  unsigned long nbInter = 0;
+  unsigned long nbFlat = 0;
+  unsigned long nbDisagreeExact = 0;
+  double sumRatio = 0.0;
+
+  // Loop on the tests
+  for (
+    unsigned long iTest = NB_TESTS;
+    iTest--;) {
+
+    // Create two random Frames
+    Frame3D that = RandomFrame3D();
+    Frame3D tho = RandomFrame3D();
+
+    // Run the intersection tests
+    AABB3D bdgBoxLocal;
+    bool isInter =
+      FMBTestIntersection3D(
+        &that,
+        &tho,
+        &bdgBoxLocal);
+
+    AABB3D bdgBoxAB;
+    bool isInterAB =
+      FMBTestIntersection3DExact(
+        &that,
+        &tho,
+        &bdgBoxAB);
+
+    AABB3D bdgBoxBA;
+    bool isInterBA =
+      FMBTestIntersection3DExact(
+        &tho,
+        &that,
+        &bdgBoxBA);
+
+    // Check the results, in float precision the results of Frames
+    // closer than the precision may be different
+    bool isValid = true;
+    if (isInter != isInterAB || isInter != isInterBA) {
+
+      ++nbDisagreeExact;
+      isValid = (MAX_DISAGREE_RATE > 0.0);
+
+    } else if (
+      isInter == true &&
+      (IsFlatFrame3D(&that) == true || IsFlatFrame3D(&tho) == true)) {
+
+      ++nbFlat;
+
+    } else if (isInter == true) {
+
+      ++nbInter;
+
+      // Get the default AABB in world coordinates
+      AABB3D bdgBox;
+      Frame3DExportBdgBox(
+        &tho,
+        &bdgBoxLocal,
+        &bdgBox);
+
+      double volExact = 1.0;
+      double vol = 1.0;
+      bool isBoxValid = true;
+      for (
+        int i = 3;
+        i--;) {
+
+        if (
+          fabs(bdgBoxAB.min[i] - bdgBoxBA.min[i]) > EXACT_TOLERANCE ||
+          fabs(bdgBoxAB.max[i] - bdgBoxBA.max[i]) > EXACT_TOLERANCE ||
+          bdgBoxAB.min[i] < bdgBox.min[i] - EXACT_TOLERANCE ||
+          bdgBoxAB.max[i] > bdgBox.max[i] + EXACT_TOLERANCE) {
+
+          isBoxValid = false;
+
+        }
+
+        volExact *= bdgBoxAB.max[i] - bdgBoxAB.min[i];
+        vol *= bdgBox.max[i] - bdgBox.min[i];
+
+      }
+
+      // In float precision the AABBs of Frames closer than the
+      // precision may be different
+      if (isBoxValid == false) {
+
+        ++nbDisagreeExact;
+        isValid = (MAX_DISAGREE_RATE > 0.0);
+
+      }
+
+      if (vol > 0.0) {
+
+        sumRatio += volExact / vol;
+
+      }
+
+    }
+
+    // If the results are invalid
+    if (isValid == false) {
+
+      // Print the disagreement
+      printf("ValidationExact3D has failed\n");
+      Frame3DPrint(&that);
+      printf(" against ");
+      Frame3DPrint(&tho);
+      printf("\n");
+
+      // Stop the validation
+      exit(EXIT_FAILURE);
+
+    }
+
+  }
+
+  // Check the rate of disagreement
+  double rateDisagree = (double)nbDisagreeExact / (double)NB_TESTS;
+  if (rateDisagree > MAX_DISAGREE_RATE) {
+
+    printf("ValidationExact3D has failed\n");
+    printf("Disagreement rate %e\n", rateDisagree);
+    exit(EXIT_FAILURE);
+
+  }
+
+  // If we reached here it means the validation was successfull
+  // Print results
+  printf("ValidationExact3D has succeed.\n");
+  printf("Tested %lu intersections ", nbInter);
+  printf("(and %lu of flat Frames) ", nbFlat);
+  printf("and %lu no intersections\n", NB_TESTS - nbInter - nbFlat);
+  printf("Disagreement rate %e\n", rateDisagree);
+  if (nbInter > 0) {
+
+    printf("Average volume of the exact AABB relative to the default one %f\n",
+      sumRatio / (double)nbInter);
+
+  }
+
+}
+
+// Validation of the exact intersection test on touching Frames
+// Translate a random Frame tho, starting from the center of a random
+// Frame that, along a random direction by bisection until the last
+// position where FMBTestIntersection3D still reports an intersection,
+// and check FMBTestIntersection3DExact gives the results of
+// FMBTestIntersection3D on (A,B) and (B,A), and an AABB included in the
+// default one unless one of the Frames is flat (cf IsFlatFrame3D)
+void ValidateExactTouching3D(void) {
+
+  // Declare variables to count the touching pairs, the touching pairs
+  // of flat Frames and the pairs where FMBTestIntersection3D gives
+  // different results on (A,B) and (B,A)
+  unsigned long nbTouch = 0;
+  unsigned long nbFlat = 0;
+  unsigned long nbDisagreeTouch = 0;
+
+  // Declare a variable to count the touching pairs whose exact AABB is
+  // not included in the default one
+  unsigned long nbDisagreeBox = 0;
+
+  // Loop on the tests
+  for (
+    unsigned long iTest = NB_TESTS_TOUCH;
+    iTest--;) {
+
+    // Create two random Frames
+    Frame3D that = RandomFrame3D();
+    Frame3D tho = RandomFrame3D();
+
+    // Get the center of that and a random direction
+    FMB_REAL center[3];
+    FMB_REAL dir[3];
+    for (
+      int i = 3;
+      i--;) {
+
+      center[i] =
+        that.orig[i] +
+        0.25 * (that.comp[0][i] + that.comp[1][i] + that.comp[2][i]);
+      dir[i] = -1.0 + 2.0 * rnd();
+
+    }
+
+    // Bisect the translation of tho along the direction, the Frames
+    // being in intersection at 0 and separated at 10 * RANGE_AXIS
+    double low = 0.0;
+    double high = 10.0 * RANGE_AXIS;
+    FMB_REAL orig[3];
+    for (
+      int iStep = NB_BISECT_TOUCH + 1;
+      iStep--;) {
+
+      double t = (iStep > 0 ? 0.5 * (low + high) : low);
+      for (
+        int i = 3;
+        i--;) {
+
+        orig[i] = center[i] + t * dir[i];
+
+      }
+
+      tho =
+        Frame3DCreateStatic(
+          tho.type,
+          orig,
+          tho.comp);
+      bool isInter =
+        FMBTestIntersection3D(
+          &that,
+          &tho,
+          NULL);
+      if (iStep > 0) {
+
+        if (isInter == true) {
+
+          low = t;
+
+        } else {
+
+          high = t;
+
+        }
+
+      }
+
+    }
+
+    // Run the intersection tests at the contact
+    AABB3D bdgBoxLocal;
+    bool isInterAB =
+      FMBTestIntersection3D(
+        &that,
+        &tho,
+        &bdgBoxLocal);
+    bool isInterBA =
+      FMBTestIntersection3D(
+        &tho,
+        &that,
+        NULL);
+
+    AABB3D bdgBoxAB;
+    bool isInterExactAB =
+      FMBTestIntersection3DExact(
+        &that,
+        &tho,
+        &bdgBoxAB);
+
+    AABB3D bdgBoxBA;
+    bool isInterExactBA =
+      FMBTestIntersection3DExact(
+        &tho,
+        &that,
+        &bdgBoxBA);
+
+    // Check the results. The contact being bisected on (A,B),
+    // FMBTestIntersection3D may give a different result on (B,A)
+    // within the numerical imprecision, in which case the default AABB
+    // is not reliable and only the results are checked
+    bool isValid =
+      (isInterAB == isInterExactAB && isInterBA == isInterExactBA);
+    if (isInterAB != isInterBA) {
+
+      ++nbDisagreeTouch;
+
+    } else if (
+      isValid == true &&
+      isInterAB == true &&
+      (IsFlatFrame3D(&that) == true || IsFlatFrame3D(&tho) == true)) {
+
+      ++nbFlat;
+
+    } else if (
+      isValid == true &&
+      isInterAB == true) {
+
+      ++nbTouch;
+
+      // Get the default AABB in world coordinates
+      AABB3D bdgBox;
+      Frame3DExportBdgBox(
+        &tho,
+        &bdgBoxLocal,
+        &bdgBox);
+
+      for (
+        int i = 3;
+        i--;) {
+
+        if (
+          bdgBoxAB.min[i] > bdgBoxAB.max[i] ||
+          bdgBoxAB.min[i] < bdgBox.min[i] - EXACT_TOLERANCE ||
+          bdgBoxAB.max[i] > bdgBox.max[i] + EXACT_TOLERANCE) {
+
+          isValid = false;
+
+        }
+
+      }
+
+      // In float precision, the set of the points closer than the
+      // precision to two Frames touching by nearly parallel faces is
+      // a thin but large slice, whose AABBs given by the two tests may
+      // be different
+      if (isValid == false) {
+
+        ++nbDisagreeBox;
+        isValid = (MAX_DISAGREE_RATE > 0.0);
+
+      }
+
+    }
+
+    // If the results are invalid
+    if (isValid == false) {
+
+      // Print the disagreement
+      printf("ValidationExactTouching3D has failed\n");
+      Frame3DPrint(&that);
+      printf(" against ");
+      Frame3DPrint(&tho);
+      printf("\n");
+
+      // Stop the validation
+      exit(EXIT_FAILURE);
+
+    }
+
+  }
+
+  // Check the rate of disagreement
+  double rateDisagree = (double)nbDisagreeBox / (double)NB_TESTS_TOUCH;
+  if (rateDisagree > MAX_DISAGREE_RATE) {
+
+    printf("ValidationExactTouching3D has failed\n");
+    printf("Disagreement rate %e\n", rateDisagree);
+    exit(EXIT_FAILURE);
+
+  }
+
+  // If we reached here it means the validation was successfull
+  // Print results
+  printf("ValidationExactTouching3D has succeed.\n");
+  printf("Tested %lu touching pairs (and %lu of flat Frames), ",
+    nbTouch, nbFlat);
+  printf("%lu pairs touching only in one order\n", nbDisagreeTouch);
+  printf("Disagreement rate of the AABBs %e\n", rateDisagree);
+
+}
+
+// Validation of the mixed precision intersection test
+// Run FMBTestIntersection3DMixed on random pairs of Frames and check
+// its results are the ones of FMBTestIntersection3D
+// Print the rate of disagreement and the rate of fall back to FMB_REAL
+void ValidateMixed3D(void) {
+
+  // Declare a variable to count the disagreements
+  unsigned long nbDisagreeMixed = 0;
+
+  // Reset the statistics of the mixed precision test
+  FMBResetMixedStats3D();
+
+  // Loop on the tests
+  for (
+    unsigned long iTest = NB_TESTS;
+    iTest--;) {
+
+    // Create two random Frames
+    Frame3D that = RandomFrame3D();
+    Frame3D tho = RandomFrame3D();
+
+    // Run the intersection tests
+    bool isInter =
+      FMBTestIntersection3D(
+        &that,
+        &tho,
+        NULL);
+    bool isInterMixed =
+      FMBTestIntersection3DMixed(
+        &that,
+        &tho);
+
+    // Update the number of disagreements
+    if (isInter != isInterMixed) {
+
+      ++nbDisagreeMixed;
+
+    }
+
+  }
+
+  // Check the rate of disagreement
+  FMBMixedStats stats = FMBGetMixedStats3D();
+  double rateDisagree = (double)nbDisagreeMixed / (double)NB_TESTS;
+  if (rateDisagree > MAX_DISAGREE_RATE) {
+
+    printf("ValidationMixed3D has failed\n");
+    printf("Disagreement rate with %s %e\n", FMB_REAL_NAME, rateDisagree);
+    exit(EXIT_FAILURE);
+
+  }
+
+  // If we reached here it means the validation was successfull
+  // Print results
+  printf("ValidationMixed3D has succeed.\n");
+  printf("Disagreement rate with %s %e, ", FMB_REAL_NAME, rateDisagree);
+  printf("fall back rate %e\n",
+    (double)(stats.nbFallback) / (double)(stats.nbTest));
+
+}
+
+int main(int argc, char** argv) {
+
+  // Initialise the random generator with the seed in argument if any,
+  // else with the current time, and print it to reproduce the run
+  unsigned int seed = (unsigned int)time(NULL);
+  if (argc > 1) {
+
+    seed = (unsigned int)strtoul(argv[1], NULL, 10);
+
+  }
+
+  printf("Seed %u\n", seed);
+  srandom(seed);
 
   printf("===== 3D static ======\n");
   Validate3D();
+  ValidateBatch3D();
+  ValidatePruning3D();
+  ValidateElimOrder3D();
+  ValidateCached3D();
+  ValidateSATFrame3D();
+  ValidateSATCheck3D();
+  ValidateExact3D();
+  ValidateExactTouching3D();
+  ValidateMixed3D();
+  ValidateSoA3D();
+  ValidateElimSIMD3D();
 
   return 0;
 
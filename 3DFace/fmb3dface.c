@@ -18,6 +18,7 @@
 */
 
 #include "fmb3dface.h"
+#include "frameinternal.h"
 
 // ------------- Macros -------------
 
@@ -31,7 +32,16 @@
 #define SND_VAR 1
 #define THD_VAR 2
 
-#define EPSILON 0.0000001
+#define EPSILON FMB_EPSILON
+
+// ------------- Global variables -------------
+
+// Statistics of the elimination, cf FMB_ELIM_STATS, accumulated per
+// thread (cf FrameStats)
+FRAME_STATS_DEFINE(
+  FMBElimStats,
+  fmbElimStats3DFace,
+  FMBElimStatsMerge)
 
 // ------------- Functions declaration -------------
 
@@ -41,13 +51,13 @@
 // the resulting system in nbRemainRows
 // Return false if the system becomes inconsistent during elimination,
 // else return true
-bool ElimVar3D(
-  const double (*M)[2],
-  const double* Y,
+static bool ElimVar3DFace(
+  const FMB_REAL (*M)[2],
+  const FMB_REAL* Y,
   const int nbRows,
   const int nbCols,
-  double (*Mp)[2],
-  double* Yp,
+  FMB_REAL (*Mp)[2],
+  FMB_REAL* Yp,
   int* const nbRemainRows);
 
 // Get the bounds of the iVar-th variable in the nbRows rows
@@ -57,10 +67,10 @@ bool ElimVar3D(
 // (M arrangement is [iRow][iCol])
 // May return inconsistent values (max < min), which would
 // mean the system has no solution
-void GetBoundLastVar3D(
+static void GetBoundLastVar3DFace(
   const int iVar,
-  const double (*M)[2],
-  const double* Y,
+  const FMB_REAL (*M)[2],
+  const FMB_REAL* Y,
   const int nbRows,
   AABB2D* const bdgBox);
 
@@ -68,14 +78,41 @@ void GetBoundLastVar3D(
 // system M.X<=Y where the iVar-th variable is on the first column
 // and store them in the iVar-th axis of the AABB bdgBox
 // (M arrangement is [iRow][iCol])
-void GetBoundVar3D(
+static void GetBoundVar3DFace(
   const int iVar,
-  const double (*M)[2],
-  const double* Y,
+  const FMB_REAL (*M)[2],
+  const FMB_REAL* Y,
   const int nbRows,
   const int nbCols,
   AABB2D* const bdgBox);
 
+// Implementations of FMBTestIntersection3DFace for each FrameCPUPath
+static bool FMBTestIntersection3DFaceGeneric(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  AABB2D* const bdgBox);
+FRAME_CPU_VARIANTS(
+  bool,
+  FMBTestIntersection3DFace,
+  (
+    const Frame3D* const that,
+    const Frame3D* const tho,
+    AABB2D* const bdgBox),
+  (that, tho, bdgBox))
+
+// Dispatch table of the implementations, [FrameCPUPath]
+static bool (* const fmbTestIntersection3DFaceCPU[FrameCPUNb])(
+  const Frame3D* const,
+  const Frame3D* const,
+  AABB2D* const) = {
+
+  FMBTestIntersection3DFaceGeneric,
+  FMBTestIntersection3DFaceSSE2,
+  FMBTestIntersection3DFaceAVX2,
+  FMBTestIntersection3DFaceAVX512
+
+};
+
 // ------------- Functions implementation -------------
 
 // Eliminate the first variable in the system M.X<=Y
@@ -85,13 +122,13 @@ void GetBoundVar3D(
 // (M arrangement is [iRow][iCol])
 // Return true if the system becomes inconsistent during elimination,
 // else return false
-bool ElimVar3D(
-  const double (*M)[2],
-  const double* Y,
+static bool ElimVar3DFace(
+  const FMB_REAL (*M)[2],
+  const FMB_REAL* Y,
   const int nbRows,
   const int nbCols,
-  double (*Mp)[2],
-  double* Yp,
+  FMB_REAL (*Mp)[2],
+  FMB_REAL* Yp,
   int* const nbRemainRows) {
 
   // Initialize the number of rows in the result system
@@ -105,16 +142,16 @@ bool ElimVar3D(
     ++iRow) {
 
     // Shortcuts
-    const double fabsMIRowIVar = fabs(M[iRow][0]);
+    const FMB_REAL fabsMIRowIVar = fabs(M[iRow][0]);
 
     // If the coefficient for the eliminated variable is not null
     // in this row
     if (fabsMIRowIVar > EPSILON) {
 
       // Shortcuts
-      const double* MiRow = M[iRow];
+      const FMB_REAL* MiRow = M[iRow];
       const int sgnMIRowIVar = sgn(MiRow[0]);
-      const double YIRowDivideByFabsMIRowIVar = Y[iRow] / fabsMIRowIVar;
+      const FMB_REAL YIRowDivideByFabsMIRowIVar = Y[iRow] / fabsMIRowIVar;
 
       // For each following rows
       for (
@@ -129,12 +166,12 @@ bool ElimVar3D(
           fabs(M[jRow][0]) > EPSILON) {
 
           // Shortcuts
-          const double* MjRow = M[jRow];
-          const double fabsMjRow = fabs(MjRow[0]);
+          const FMB_REAL* MjRow = M[jRow];
+          const FMB_REAL fabsMjRow = fabs(MjRow[0]);
 
           // Declare a variable to memorize the sum of the negative
           // coefficients in the row
-          double sumNegCoeff = 0.0;
+          FMB_REAL sumNegCoeff = 0.0;
 
           // Add the sum of the two normed (relative to the eliminated
           // variable) rows into the result system. This actually
@@ -189,14 +226,14 @@ bool ElimVar3D(
     ++iRow) {
 
     // Shortcut
-    const double* MiRow = M[iRow];
+    const FMB_REAL* MiRow = M[iRow];
 
     // If the coefficient of the eliminated variable is null on
     // this row
     if (fabs(MiRow[0]) < EPSILON) {
 
       // Shortcut
-      double* MpnbResRows = Mp[nbResRows];
+      FMB_REAL* MpnbResRows = Mp[nbResRows];
 
       // Copy this row into the result system excluding the eliminated
       // variable
@@ -233,16 +270,16 @@ bool ElimVar3D(
 // (M arrangement is [iRow][iCol])
 // May return inconsistent values (max < min), which would
 // mean the system has no solution
-void GetBoundLastVar3D(
+static void GetBoundLastVar3DFace(
   const int iVar,
-  const double (*M)[2],
-  const double* Y,
+  const FMB_REAL (*M)[2],
+  const FMB_REAL* Y,
   const int nbRows,
   AABB2D* const bdgBox) {
 
   // Shortcuts
-  double* min = bdgBox->min + iVar;
-  double* max = bdgBox->max + iVar;
+  FMB_REAL* min = bdgBox->min + iVar;
+  FMB_REAL* max = bdgBox->max + iVar;
 
   // Initialize the bounds to their maximum maximum and minimum minimum
   *min = 0.0;
@@ -255,14 +292,14 @@ void GetBoundLastVar3D(
     ++jRow) {
 
     // Shortcut
-    double MjRowiVar = M[jRow][0];
+    FMB_REAL MjRowiVar = M[jRow][0];
 
     // If this row has been reduced to the variable in argument
     // and it has a strictly positive coefficient
     if (MjRowiVar > EPSILON) {
 
       // Get the scaled value of Y for this row
-      double y = Y[jRow] / MjRowiVar;
+      FMB_REAL y = Y[jRow] / MjRowiVar;
 
       // If the value is lower than the current maximum bound
       if (*max > y) {
@@ -277,7 +314,7 @@ void GetBoundLastVar3D(
     } else if (MjRowiVar < -EPSILON) {
 
       // Get the scaled value of Y for this row
-      double y = Y[jRow] / MjRowiVar;
+      FMB_REAL y = Y[jRow] / MjRowiVar;
 
       // If the value is greater than the current minimum bound
       if (*min < y) {
@@ -297,17 +334,17 @@ void GetBoundLastVar3D(
 // system M.X<=Y where the iVar-th variable is on the first column
 // and store them in the iVar-th axis of the AABB bdgBox
 // (M arrangement is [iRow][iCol])
-void GetBoundVar3D(
+static void GetBoundVar3DFace(
   const int iVar,
-  const double (*M)[2],
-  const double* Y,
+  const FMB_REAL (*M)[2],
+  const FMB_REAL* Y,
   const int nbRows,
   const int nbCols,
   AABB2D* const bdgBox) {
 
   // Shortcuts
-  double* bdgBoxMin = bdgBox->min;
-  double* bdgBoxMax = bdgBox->max;
+  FMB_REAL* bdgBoxMin = bdgBox->min;
+  FMB_REAL* bdgBoxMax = bdgBox->max;
 
   // Initialize the bounds
   bdgBoxMin[iVar] = 0.0;
@@ -320,16 +357,16 @@ void GetBoundVar3D(
     ++iRow) {
 
     // Shortcuts
-    const double* MIRow = M[iRow];
-    double fabsMIRowIVar = fabs(MIRow[0]);
+    const FMB_REAL* MIRow = M[iRow];
+    FMB_REAL fabsMIRowIVar = fabs(MIRow[0]);
 
     // If the coefficient of the first variable on this row is not null
     if (fabsMIRowIVar > EPSILON) {
 
       // Declare two variables to memorize the min and max of the
       // requested variable in this row
-      double min = -1.0 * Y[iRow];
-      double max = Y[iRow];
+      FMB_REAL min = -1.0 * Y[iRow];
+      FMB_REAL max = Y[iRow];
 
       // Loop on columns except the first one which is the one of the
       // requested variable
@@ -382,8 +419,8 @@ void GetBoundVar3D(
 // The resulting AABB of FMBTestIntersection(A,B) may be different
 // of the resulting AABB of FMBTestIntersection(B,A)
 // The resulting AABB is given in tho's local coordinates system
-bool FMBTestIntersection3DFace(
-  Frame3D* const that,
+static bool FMBTestIntersection3DFaceGeneric(
+  const Frame3D* const that,
   const Frame3D* const tho,
   AABB2D* const bdgBox) {
 
@@ -394,8 +431,8 @@ bool FMBTestIntersection3DFace(
 
   // Declare two variables to memorize the system to be solved M.X <= Y
   // (M arrangement is [iRow][iCol])
-  double M[12][2];
-  double Y[12];
+  FMB_REAL M[12][2];
+  FMB_REAL Y[12];
 
   // Create the inequality system
   // -sum_iC_j,iX_i<=O_j
@@ -404,6 +441,11 @@ bool FMBTestIntersection3DFace(
   Y[0] = thoProj.orig[0];
   if (Y[0] < neg(M[0][0]) + neg(M[0][1])) {
 
+    FMB_ELIM_STATS_STAGE(
+      fmbElimStats3DFaceThread(),
+      that->type,
+      tho->type,
+      FMBElimStageInit);
     return false;
 
   }
@@ -413,6 +455,11 @@ bool FMBTestIntersection3DFace(
   Y[1] = thoProj.orig[1];
   if (Y[1] < neg(M[1][0]) + neg(M[1][1])) {
 
+    FMB_ELIM_STATS_STAGE(
+      fmbElimStats3DFaceThread(),
+      that->type,
+      tho->type,
+      FMBElimStageInit);
     return false;
 
   }
@@ -422,6 +469,11 @@ bool FMBTestIntersection3DFace(
   Y[2] = thoProj.orig[2];
   if (Y[2] < neg(M[2][0]) + neg(M[2][1])) {
 
+    FMB_ELIM_STATS_STAGE(
+      fmbElimStats3DFaceThread(),
+      that->type,
+      tho->type,
+      FMBElimStageInit);
     return false;
 
   }
@@ -437,6 +489,11 @@ bool FMBTestIntersection3DFace(
     Y[nbRows] = 1.0 - thoProj.orig[0];
     if (Y[nbRows] < neg(M[nbRows][0]) + neg(M[nbRows][1])) {
 
+      FMB_ELIM_STATS_STAGE(
+        fmbElimStats3DFaceThread(),
+        that->type,
+        tho->type,
+        FMBElimStageInit);
       return false;
 
     }
@@ -448,6 +505,11 @@ bool FMBTestIntersection3DFace(
     Y[nbRows] = 1.0 - thoProj.orig[1];
     if (Y[nbRows] < neg(M[nbRows][0]) + neg(M[nbRows][1])) {
 
+      FMB_ELIM_STATS_STAGE(
+        fmbElimStats3DFaceThread(),
+        that->type,
+        tho->type,
+        FMBElimStageInit);
       return false;
 
     }
@@ -466,6 +528,11 @@ bool FMBTestIntersection3DFace(
       1.0 - thoProj.orig[0] - thoProj.orig[1];
     if (Y[nbRows] < neg(M[nbRows][0]) + neg(M[nbRows][1])) {
 
+      FMB_ELIM_STATS_STAGE(
+        fmbElimStats3DFaceThread(),
+        that->type,
+        tho->type,
+        FMBElimStageInit);
       return false;
 
     }
@@ -480,6 +547,11 @@ bool FMBTestIntersection3DFace(
   Y[nbRows] = -thoProj.orig[2];
   if (Y[nbRows] < neg(M[nbRows][0]) + neg(M[nbRows][1])) {
 
+    FMB_ELIM_STATS_STAGE(
+      fmbElimStats3DFaceThread(),
+      that->type,
+      tho->type,
+      FMBElimStageInit);
     return false;
 
   }
@@ -540,15 +612,15 @@ bool FMBTestIntersection3DFace(
   // Instead I use a smaller value which has proven to be sufficient
   // during tests, validation and qualification, to avoid running
   // into the heap limit and to optimize slightly the performance
-  //double Mp[48][2];
-  //double Yp[48];
-  double Mp[20][2];
-  double Yp[20];
+  //FMB_REAL Mp[48][2];
+  //FMB_REAL Yp[48];
+  FMB_REAL Mp[20][2];
+  FMB_REAL Yp[20];
   int nbRowsP;
 
   // Eliminate the first variable in the original system
   bool inconsistency =
-    ElimVar3D(
+    ElimVar3DFace(
       M,
       Y,
       nbRows,
@@ -561,12 +633,25 @@ bool FMBTestIntersection3DFace(
   if (inconsistency == true) {
 
     // The two Frames are not in intersection
+    FMB_ELIM_STATS_STAGE(
+      fmbElimStats3DFaceThread(),
+      that->type,
+      tho->type,
+      FMBElimStagePass1);
     return false;
 
   }
 
+  // Record the size of the resulting system
+  FMB_ELIM_STATS_ROWS(
+    fmbElimStats3DFaceThread(),
+    that->type,
+    tho->type,
+    0,
+    nbRowsP);
+
   // Get the bounds for the remaining third variable
-  GetBoundLastVar3D(
+  GetBoundLastVar3DFace(
     SND_VAR,
     Mp,
     Yp,
@@ -577,6 +662,11 @@ bool FMBTestIntersection3DFace(
   if (bdgBoxLocal.min[SND_VAR] >= bdgBoxLocal.max[SND_VAR]) {
 
     // The two Frames are not in intersection
+    FMB_ELIM_STATS_STAGE(
+      fmbElimStats3DFaceThread(),
+      that->type,
+      tho->type,
+      FMBElimStageBound);
     return false;
 
   // Else, if the bounds are consistent here it means
@@ -585,7 +675,7 @@ bool FMBTestIntersection3DFace(
   } else if (bdgBox != NULL) {
 
     // Get the bounds of the other variables
-    GetBoundVar3D(
+    GetBoundVar3DFace(
       FST_VAR,
       M,
       Y,
@@ -599,12 +689,51 @@ bool FMBTestIntersection3DFace(
   }
 
   // If we've reached here the two Frames are intersecting
+  FMB_ELIM_STATS_STAGE(
+    fmbElimStats3DFaceThread(),
+    that->type,
+    tho->type,
+    FMBElimStageInter);
   return true;
 
 }
 
+// Get the statistics of the elimination since the last reset
+// (cf frame.h)
+FMBElimStats FMBGetElimStats3DFace(void) {
+
+  FMBElimStats stats;
+  FrameStatsGet(
+    &fmbElimStats3DFace,
+    &stats);
+  return stats;
+
+}
+
+// Reset the statistics of the elimination
+void FMBResetElimStats3DFace(void) {
+
+  FrameStatsReset(&fmbElimStats3DFace);
+
+}
+
+// Test for intersection with the current implementation
+// (cf FrameGetCPUPath)
+bool FMBTestIntersection3DFace(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  AABB2D* const bdgBox) {
+
+  return
+    fmbTestIntersection3DFaceCPU[FrameGetCPUPath()](
+      that,
+      tho,
+      bdgBox);
+
+}
+
 bool FMBHybridTestIntersection3DFace(
-  Frame3D* const that,
+  const Frame3D* const that,
   const Frame3D* const tho,
   AABB2D* const bdgBox) {
 
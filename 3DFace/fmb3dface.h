@@ -17,8 +17,8 @@
     along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
-#ifndef __FMB3D_H_
-#define __FMB3D_H_
+#ifndef __FMB3DFACE_H_
+#define __FMB3DFACE_H_
 
 #include <stdbool.h>
 #include "frame.h"
@@ -26,6 +26,17 @@
 
 // ------------- Functions declaration -------------
 
+// Get the statistics of the Fourier-Motzkin elimination in
+// FMBTestIntersection3DFace since the last reset (cf frame.h), recorded
+// only if FMB_ELIM_STATS is defined at compilation and added over all
+// the threads, this function and FMBResetElimStats3DFace must not be
+// called while another thread is running FMBTestIntersection3DFace
+FMBElimStats FMBGetElimStats3DFace(void);
+
+// Reset the statistics of the Fourier-Motzkin elimination of all the
+// threads
+void FMBResetElimStats3DFace(void);
+
 // Test for intersection between Frame that and Frame tho, both faces
 // Return true if the two Frames are intersecting, else false
 // If the Frame are intersecting the AABB of the intersection
@@ -37,12 +48,12 @@
 // of the resulting AABB of FMBTestIntersection(B, A)
 // The resulting AABB is given in tho's local coordinates system
 bool FMBTestIntersection3DFace(
-  Frame3D* const that,
+  const Frame3D* const that,
   const Frame3D* const tho,
   AABB2D* const bdgBox);
 
 bool FMBHybridTestIntersection3DFace(
-  Frame3D* const that,
+  const Frame3D* const that,
   const Frame3D* const tho,
   AABB2D* const bdgBox);
 
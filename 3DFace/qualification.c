@@ -22,13 +22,15 @@
 #include <stdio.h>
 #include <stdbool.h>
 #include <time.h>
-#include <sys/time.h>
 #include <math.h>
 
 // Include FMB and SAT algorithm library
 #include "fmb3dface.h"
 #include "sat.h"
 
+// Include the benchmark harness
+#include "bench.h"
+
 // Epsilon to detect degenerated triangles
 #define EPSILON 0.1
 
@@ -41,10 +43,6 @@
 // Nb of tests per run
 #define NB_TESTS 5000 //500000
 
-// Nb of times the test is run on one pair of frame, used to
-// slow down the processus and be able to measure time
-#define NB_REPEAT_3D 1500 //1000
-
 // Helper macro to generate random number in [0.0, 1.0]
 #define rnd() (double)(rand())/(double)(RAND_MAX)
 
@@ -52,8 +50,8 @@
 typedef struct {
 
   FrameType type;
-  double orig[3];
-  double comp[3][3];
+  FMB_REAL orig[3];
+  FMB_REAL comp[3][3];
 
 } Param3D;
 
@@ -63,52 +61,36 @@ typedef enum {
   typeQualif_nearCaseOnly
 } TypeQualif;
 
-// Global variables to count nb of tests resulting in intersection
-// and no intersection, and min/max/total time of execution for each
-double minInter;
-double maxInter;
-double sumInter;
-unsigned long countInter;
-double minNoInter;
-double maxNoInter;
-double sumNoInter;
-unsigned long countNoInter;
-
-double minInterCC;
-double maxInterCC;
-double sumInterCC;
-unsigned long countInterCC;
-double minNoInterCC;
-double maxNoInterCC;
-double sumNoInterCC;
-unsigned long countNoInterCC;
-
-double minInterCT;
-double maxInterCT;
-double sumInterCT;
-unsigned long countInterCT;
-double minNoInterCT;
-double maxNoInterCT;
-double sumNoInterCT;
-unsigned long countNoInterCT;
-
-double minInterTC;
-double maxInterTC;
-double sumInterTC;
-unsigned long countInterTC;
-double minNoInterTC;
-double maxNoInterTC;
-double sumNoInterTC;
-unsigned long countNoInterTC;
-
-double minInterTT;
-double maxInterTT;
-double sumInterTT;
-unsigned long countInterTT;
-double minNoInterTT;
-double maxNoInterTT;
-double sumNoInterTT;
-unsigned long countNoInterTT;
+// Global variables to memorize the distributions of the ratio of
+// execution time FMB/SAT, [iCase][iInter], iCase being 0 for all the
+// pairs and 1 + 2 * typeThat + typeTho for each pair of types, iInter
+// being 0 for the pairs in intersection and 1 for the others
+BenchDist* ratios[5][2];
+
+// Wrappers of the intersection tests with the signature expected by
+// the benchmark harness
+bool QualifTestFMB(
+  const void* const that,
+  const void* const tho) {
+
+  return
+    FMBTestIntersection3DFace(
+      that,
+      tho,
+      NULL);
+
+}
+
+bool QualifTestSAT(
+  const void* const that,
+  const void* const tho) {
+
+  return
+    SATTestIntersection3DFace(
+      that,
+      tho);
+
+}
 
 // Qualification function
 // Takes two Frame definition as input, run the intersection test on
@@ -156,350 +138,65 @@ void Qualification3DStatic(
 
   }
 
+  // Configuration of the measurements, the time of each test being
+  // the median over repeated samples after warmup
+  BenchConfig config = BenchConfigDefault();
+
   // Loop on pairs of Frames
   for (
     int iPair = 2;
     iPair--;) {
 
-    // Declare an array to memorize the results of the repeated
-    // test on the same pair,
-    // to prevent optimization from the compiler to remove the for loop
-    bool isIntersectingFMB[NB_REPEAT_3D] = {false};
-
-    // Start measuring time
-    struct timeval start;
-    gettimeofday(&start, NULL);
-
-    // Run the FMB intersection test
-    for (
-      int i = NB_REPEAT_3D;
-      i--;) {
-
-      isIntersectingFMB[i] =
-        FMBTestIntersection3DFace(
-        //FMBHybridTestIntersection3DFace(
-          that,
-          tho,
-          NULL);
-
-    }
-
-    // Stop measuring time
-    struct timeval stop;
-    gettimeofday(&stop, NULL);
-
-    // Calculate the delay of execution
-    unsigned long deltausFMB = 0;
-    if (stop.tv_sec < start.tv_sec) {
-
-      printf("time warps, try again\n");
-      exit(0);
-
-    }
-
-    if (stop.tv_sec > start.tv_sec + 1) {
-
-      printf("deltausFMB >> 1s, decrease NB_REPEAT\n");
+    // Measure the FMB and SAT intersection tests on the pair
+    BenchStats statsFMB;
+    bool isIntersectingFMB =
+      BenchMeasurePair(
+        &config,
+        QualifTestFMB,
+        that,
+        tho,
+        &statsFMB);
+    BenchStats statsSAT;
+    bool isIntersectingSAT =
+      BenchMeasurePair(
+        &config,
+        QualifTestSAT,
+        that,
+        tho,
+        &statsSAT);
+
+    // If FMB and SAT disagrees
+    if (isIntersectingFMB != isIntersectingSAT) {
+
+      printf("Qualification has failed\n");
+      Frame3DPrint(that);
+      printf(" against ");
+      Frame3DPrint(tho);
+      printf("\n");
+      printf("FMB : ");
+      if (isIntersectingFMB == false) printf("no ");
+      printf("intersection\n");
+      printf("SAT : ");
+      if (isIntersectingSAT == false) printf("no ");
+      printf("intersection\n");
+
+      // Stop the qualification test
       exit(0);
 
     }
 
-    if (stop.tv_usec < start.tv_usec) {
-
-      deltausFMB = stop.tv_sec - start.tv_sec;
-      deltausFMB += stop.tv_usec + 1000000 - start.tv_usec;
-
-    } else {
-
-      deltausFMB = stop.tv_usec - start.tv_usec;
-
-    }
-
-    // Declare an array to memorize the results of the repeated
-    // test on the same pair,
-    // to prevent optimization from the compiler to remove the for loop
-    bool isIntersectingSAT[NB_REPEAT_3D] = {false};
-
-    // Start measuring time
-    gettimeofday(&start, NULL);
-
-    // Run the FMB intersection test
-    for (
-      int i = NB_REPEAT_3D;
-      i--;) {
-
-      isIntersectingSAT[i] =
-        SATTestIntersection3DFace(
-          that,
-          tho);
-
-    }
-
-    // Stop measuring time
-    gettimeofday(&stop, NULL);
-
-    // Calculate the delay of execution
-    unsigned long deltausSAT = 0;
-    if (stop.tv_sec < start.tv_sec) {
-
-      printf("time warps, try again\n");
-      exit(0);
-
-    }
-
-    if (stop.tv_sec > start.tv_sec + 1) {
-
-      printf("deltausSAT >> 1s, decrease NB_REPEAT\n");
-      exit(0);
-
-    }
-
-    if (stop.tv_usec < start.tv_usec) {
-
-      deltausSAT = stop.tv_sec - start.tv_sec;
-      deltausSAT += stop.tv_usec + 1000000 - start.tv_usec;
-
-    } else {
-
-      deltausSAT = stop.tv_usec - start.tv_usec;
-
-    }
-
-    // If the delays are greater than 10ms
-    if (deltausFMB >= 10 && deltausSAT >= 10) {
-
-      // If FMB and SAT disagrees
-      if (isIntersectingFMB[0] != isIntersectingSAT[0]) {
-
-        printf("Qualification has failed\n");
-        Frame3DPrint(that);
-        printf(" against ");
-        Frame3DPrint(tho);
-        printf("\n");
-        printf("FMB : ");
-        if (isIntersectingFMB[0] == false) printf("no ");
-        printf("intersection\n");
-        printf("SAT : ");
-        if (isIntersectingSAT[0] == false) printf("no ");
-        printf("intersection\n");
-
-        // Stop the qualification test
-        exit(0);
-
-      }
-
-      // Get the ratio of execution time
-      double ratio = ((double)deltausFMB) / ((double)deltausSAT);
-
-      // If the Frames intersect
-      if (isIntersectingSAT[0] == true) {
-
-        // Update the counters
-        if (countInter == 0) {
-
-          minInter = ratio;
-          maxInter = ratio;
-
-        } else {
-
-          if (minInter > ratio) minInter = ratio;
-          if (maxInter < ratio) maxInter = ratio;
-
-        }
-
-        sumInter += ratio;
-        ++countInter;
-
-        if (
-          paramP.type == FrameCuboid &&
-          paramQ.type == FrameCuboid) {
-
-          if (countInterCC == 0) {
-
-            minInterCC = ratio;
-            maxInterCC = ratio;
-
-          } else {
-
-            if (minInterCC > ratio) minInterCC = ratio;
-            if (maxInterCC < ratio) maxInterCC = ratio;
-
-          }
-
-          sumInterCC += ratio;
-          ++countInterCC;
-
-        } else if (
-          paramP.type == FrameCuboid &&
-          paramQ.type == FrameTetrahedron) {
-
-          if (countInterCT == 0) {
-
-            minInterCT = ratio;
-            maxInterCT = ratio;
-
-          } else {
-
-            if (minInterCT > ratio) minInterCT = ratio;
-            if (maxInterCT < ratio) maxInterCT = ratio;
-
-          }
-
-          sumInterCT += ratio;
-          ++countInterCT;
-
-        } else if (
-          paramP.type == FrameTetrahedron &&
-          paramQ.type == FrameCuboid) {
-
-          if (countInterTC == 0) {
-
-            minInterTC = ratio;
-            maxInterTC = ratio;
-
-          } else {
-
-            if (minInterTC > ratio) minInterTC = ratio;
-            if (maxInterTC < ratio) maxInterTC = ratio;
-
-          }
-
-          sumInterTC += ratio;
-          ++countInterTC;
-
-        } else if (
-          paramP.type == FrameTetrahedron &&
-          paramQ.type == FrameTetrahedron) {
-
-          if (countInterTT == 0) {
-
-            minInterTT = ratio;
-            maxInterTT = ratio;
-
-          } else {
-
-            if (minInterTT > ratio) minInterTT = ratio;
-            if (maxInterTT < ratio) maxInterTT = ratio;
+    // Get the ratio of execution time
+    double ratio = statsFMB.median / statsSAT.median;
 
-          }
-
-          sumInterTT += ratio;
-          ++countInterTT;
-
-        }
-
-      // Else, the Frames do not intersect
-      } else {
-
-        // Update the counters
-        if (countNoInter == 0) {
-
-          minNoInter = ratio;
-          maxNoInter = ratio;
-
-        } else {
-
-          if (minNoInter > ratio) minNoInter = ratio;
-          if (maxNoInter < ratio) maxNoInter = ratio;
-
-        }
-
-        sumNoInter += ratio;
-        ++countNoInter;
-
-        if (
-          paramP.type == FrameCuboid &&
-          paramQ.type == FrameCuboid) {
-
-          if (countNoInterCC == 0) {
-
-            minNoInterCC = ratio;
-            maxNoInterCC = ratio;
-
-          } else {
-
-            if (minNoInterCC > ratio) minNoInterCC = ratio;
-            if (maxNoInterCC < ratio) maxNoInterCC = ratio;
-
-          }
-
-          sumNoInterCC += ratio;
-          ++countNoInterCC;
-
-        } else if (
-          paramP.type == FrameCuboid &&
-          paramQ.type == FrameTetrahedron) {
-
-          if (countNoInterCT == 0) {
-
-            minNoInterCT = ratio;
-            maxNoInterCT = ratio;
-
-          } else {
-
-            if (minNoInterCT > ratio) minNoInterCT = ratio;
-            if (maxNoInterCT < ratio) maxNoInterCT = ratio;
-
-          }
-
-          sumNoInterCT += ratio;
-          ++countNoInterCT;
-
-        } else if (
-          paramP.type == FrameTetrahedron &&
-          paramQ.type == FrameCuboid) {
-
-          if (countNoInterTC == 0) {
-
-            minNoInterTC = ratio;
-            maxNoInterTC = ratio;
-
-          } else {
-
-            if (minNoInterTC > ratio) minNoInterTC = ratio;
-            if (maxNoInterTC < ratio) maxNoInterTC = ratio;
-
-          }
-
-          sumNoInterTC += ratio;
-          ++countNoInterTC;
-
-        } else if (
-          paramP.type == FrameTetrahedron &&
-          paramQ.type == FrameTetrahedron) {
-
-          if (countNoInterTT == 0) {
-
-            minNoInterTT = ratio;
-            maxNoInterTT = ratio;
-
-          } else {
-
-            if (minNoInterTT > ratio) minNoInterTT = ratio;
-            if (maxNoInterTT < ratio) maxNoInterTT = ratio;
-
-          }
-
-          sumNoInterTT += ratio;
-          ++countNoInterTT;
-
-        }
-
-      }
-
-    // Else, if time of execution for FMB was less than 10ms
-    } else if (deltausFMB < 10) {
-
-      printf("deltausFMB < 10ms, increase NB_REPEAT\n");
-      exit(0);
-
-    // Else, if time of execution for SAT was less than 10ms
-    } else if (deltausSAT < 10) {
-
-      printf("deltausSAT < 10ms, increase NB_REPEAT\n");
-      exit(0);
-
-    }
+    // Update the distributions for all the pairs and for the pair of
+    // types
+    int iInter = (isIntersectingSAT == true ? 0 : 1);
+    BenchDistAdd(
+      ratios[0][iInter],
+      ratio);
+    BenchDistAdd(
+      ratios[1 + 2 * paramP.type + paramQ.type][iInter],
+      ratio);
 
     // Flip the pair of Frames
     that = &Q;
@@ -543,6 +240,21 @@ void Qualify3DStatic(TypeQualif typeQualif) {
 
   }
 
+  // Create the distributions
+  for (
+    int iCase = 5;
+    iCase--;) {
+
+    for (
+      int iInter = 2;
+      iInter--;) {
+
+      ratios[iCase][iInter] = BenchDistCreate();
+
+    }
+
+  }
+
   // Loop on runs
   for (
     int iRun = 0;
@@ -552,51 +264,20 @@ void Qualify3DStatic(TypeQualif typeQualif) {
     // Ratio intersection/no intersection for the displayed results
     double ratioInter = 0.1 + 0.8 * (double)iRun / (double)(NB_RUNS - 1);
 
-    // Initialize counters
-    minInter = 0.0;
-    maxInter = 0.0;
-    sumInter = 0.0;
-    countInter = 0;
-    minNoInter = 0.0;
-    maxNoInter = 0.0;
-    sumNoInter = 0.0;
-    countNoInter = 0;
-
-    minInterCC = 0.0;
-    maxInterCC = 0.0;
-    sumInterCC = 0.0;
-    countInterCC = 0;
-    minNoInterCC = 0.0;
-    maxNoInterCC = 0.0;
-    sumNoInterCC = 0.0;
-    countNoInterCC = 0;
-
-    minInterCT = 0.0;
-    maxInterCT = 0.0;
-    sumInterCT = 0.0;
-    countInterCT = 0;
-    minNoInterCT = 0.0;
-    maxNoInterCT = 0.0;
-    sumNoInterCT = 0.0;
-    countNoInterCT = 0;
-
-    minInterTC = 0.0;
-    maxInterTC = 0.0;
-    sumInterTC = 0.0;
-    countInterTC = 0;
-    minNoInterTC = 0.0;
-    maxNoInterTC = 0.0;
-    sumNoInterTC = 0.0;
-    countNoInterTC = 0;
-
-    minInterTT = 0.0;
-    maxInterTT = 0.0;
-    sumInterTT = 0.0;
-    countInterTT = 0;
-    minNoInterTT = 0.0;
-    maxNoInterTT = 0.0;
-    sumNoInterTT = 0.0;
-    countNoInterTT = 0;
+    // Reset the distributions
+    for (
+      int iCase = 5;
+      iCase--;) {
+
+      for (
+        int iInter = 2;
+        iInter--;) {
+
+        BenchDistReset(ratios[iCase][iInter]);
+
+      }
+
+    }
 
     // Declare two variables to memorize the arguments to the
     // Qualification function
@@ -673,222 +354,26 @@ void Qualify3DStatic(TypeQualif typeQualif) {
     }
 
     // Save the results
-    if (iRun == 0) {
-
-      fprintf(fp, "percPairInter,");
-      fprintf(fp, "countInterTo,countNoInterTo,");
-      fprintf(fp, "minInterTo,avgInterTo,maxInterTo,");
-      fprintf(fp, "minNoInterTo,avgNoInterTo,maxNoInterTo,");
-      fprintf(fp, "minTotalTo,avgTotalTo,maxTotalTo\n");
-
-      fprintf(fpCC, "percPairInter,");
-      fprintf(fpCC, "countInterCC,countNoInterCC,");
-      fprintf(fpCC, "minInterCC,avgInterCC,maxInterCC,");
-      fprintf(fpCC, "minNoInterCC,avgNoInterCC,maxNoInterCC,");
-      fprintf(fpCC, "minTotalCC,avgTotalCC,maxTotalCC\n");
-
-      fprintf(fpCT, "percPairInter,");
-      fprintf(fpCT, "countInterCT,countNoInterCT,");
-      fprintf(fpCT, "minInterCT,avgInterCT,maxInterCT,");
-      fprintf(fpCT, "minNoInterCT,avgNoInterCT,maxNoInterCT,");
-      fprintf(fpCT, "minTotalCT,avgTotalCT,maxTotalCT\n");
-
-      fprintf(fpTC, "percPairInter,");
-      fprintf(fpTC, "countInterTC,countNoInterTC,");
-      fprintf(fpTC, "minInterTC,avgInterTC,maxInterTC,");
-      fprintf(fpTC, "minNoInterTC,avgNoInterTC,maxNoInterTC,");
-      fprintf(fpTC, "minTotalTC,avgTotalTC,maxTotalTC\n");
-
-      fprintf(fpTT, "percPairInter,");
-      fprintf(fpTT, "countInterTT,countNoInterTT,");
-      fprintf(fpTT, "minInterTT,avgInterTT,maxInterTT,");
-      fprintf(fpTT, "minNoInterTT,avgNoInterTT,maxNoInterTT,");
-      fprintf(fpTT, "minTotalTT,avgTotalTT,maxTotalTT\n");
-
-    }
-
-    fprintf(
-      fp,
-      "%.1f,",
-      ratioInter);
-    fprintf(
-      fp,
-      "%lu,%lu,",
-      countInter,
-      countNoInter);
-    double avgInter = sumInter / (double)countInter;
-    fprintf(
-      fp,
-      "%f,%f,%f,",
-      minInter,
-      avgInter,
-      maxInter);
-    double avgNoInter = sumNoInter / (double)countNoInter;
-    fprintf(
-      fp,
-      "%f,%f,%f,",
-      minNoInter,
-      avgNoInter,
-      maxNoInter);
-    double avg =
-      ratioInter * avgInter + (1.0 - ratioInter) * avgNoInter;
-    fprintf(
-      fp,
-      "%f,%f,%f",
-      (minNoInter < minInter ? minNoInter : minInter),
-      avg,
-      (maxNoInter > maxInter ? maxNoInter : maxInter));
-    if (iRun < NB_RUNS - 1) {
-
-      fprintf(fp, "\n");
-
-    }
-
-    fprintf(
-      fpCC,
-      "%.1f,",
-      ratioInter);
-    fprintf(
-      fpCC,
-      "%lu,%lu,",
-      countInterCC,
-      countNoInterCC);
-    double avgInterCC = sumInterCC / (double)countInterCC;
-    fprintf(
-      fpCC,
-      "%f,%f,%f,",
-      minInterCC,
-      avgInterCC,
-      maxInterCC);
-    double avgNoInterCC = sumNoInterCC / (double)countNoInterCC;
-    fprintf(
-      fpCC,
-      "%f,%f,%f,",
-      minNoInterCC,
-      avgNoInterCC,
-      maxNoInterCC);
-    double avgCC =
-      ratioInter * avgInterCC + (1.0 - ratioInter) * avgNoInterCC;
-    fprintf(
-      fpCC,
-      "%f,%f,%f",
-      (minNoInterCC < minInterCC ? minNoInterCC : minInterCC),
-      avgCC,
-      (maxNoInterCC > maxInterCC ? maxNoInterCC : maxInterCC));
-    if (iRun < NB_RUNS - 1) {
-
-      fprintf(fpCC, "\n");
-
-    }
-
-    fprintf(
-      fpCT,
-      "%.1f,",
-      ratioInter);
-    fprintf(
-      fpCT,
-      "%lu,%lu,",
-      countInterCT,
-      countNoInterCT);
-    double avgInterCT = sumInterCT / (double)countInterCT;
-    fprintf(
-      fpCT,
-      "%f,%f,%f,",
-      minInterCT,
-      avgInterCT,
-      maxInterCT);
-    double avgNoInterCT = sumNoInterCT / (double)countNoInterCT;
-    fprintf(
-      fpCT,
-      "%f,%f,%f,",
-      minNoInterCT,
-      avgNoInterCT,
-      maxNoInterCT);
-    double avgCT =
-      ratioInter * avgInterCT + (1.0 - ratioInter) * avgNoInterCT;
-    fprintf(
-      fpCT,
-      "%f,%f,%f",
-      (minNoInterCT < minInterCT ? minNoInterCT : minInterCT),
-      avgCT,
-      (maxNoInterCT > maxInterCT ? maxNoInterCT : maxInterCT));
-    if (iRun < NB_RUNS - 1) {
-
-      fprintf(fpCT, "\n");
+    FILE* fps[5] = {fp, fpCC, fpCT, fpTC, fpTT};
+    const char* suffixes[5] = {"To", "CC", "CT", "TC", "TT"};
+    for (
+      int iCase = 0;
+      iCase < 5;
+      ++iCase) {
 
-    }
+      if (iRun == 0) {
 
-    fprintf(
-      fpTC,
-      "%.1f,",
-      ratioInter);
-    fprintf(
-      fpTC,
-      "%lu,%lu,",
-      countInterTC,
-      countNoInterTC);
-    double avgInterTC = sumInterTC / (double)countInterTC;
-    fprintf(
-      fpTC,
-      "%f,%f,%f,",
-      minInterTC,
-      avgInterTC,
-      maxInterTC);
-    double avgNoInterTC = sumNoInterTC / (double)countNoInterTC;
-    fprintf(
-      fpTC,
-      "%f,%f,%f,",
-      minNoInterTC,
-      avgNoInterTC,
-      maxNoInterTC);
-    double avgTC =
-      ratioInter * avgInterTC + (1.0 - ratioInter) * avgNoInterTC;
-    fprintf(
-      fpTC,
-      "%f,%f,%f",
-      (minNoInterTC < minInterTC ? minNoInterTC : minInterTC),
-      avgTC,
-      (maxNoInterTC > maxInterTC ? maxNoInterTC : maxInterTC));
-    if (iRun < NB_RUNS - 1) {
-
-      fprintf(fpTC, "\n");
+        BenchPrintQualifHeader(
+          fps[iCase],
+          suffixes[iCase]);
 
-    }
+      }
 
-    fprintf(
-      fpTT,
-      "%.1f,",
-      ratioInter);
-    fprintf(
-      fpTT,
-      "%lu,%lu,",
-      countInterTT,
-      countNoInterTT);
-    double avgInterTT = sumInterTT / (double)countInterTT;
-    fprintf(
-      fpTT,
-      "%f,%f,%f,",
-      minInterTT,
-      avgInterTT,
-      maxInterTT);
-    double avgNoInterTT = sumNoInterTT / (double)countNoInterTT;
-    fprintf(
-      fpTT,
-      "%f,%f,%f,",
-      minNoInterTT,
-      avgNoInterTT,
-      maxNoInterTT);
-    double avgTT =
-      ratioInter * avgInterTT + (1.0 - ratioInter) * avgNoInterTT;
-    fprintf(
-      fpTT,
-      "%f,%f,%f",
-      (minNoInterTT < minInterTT ? minNoInterTT : minInterTT),
-      avgTT,
-      (maxNoInterTT > maxInterTT ? maxNoInterTT : maxInterTT));
-    if (iRun < NB_RUNS - 1) {
-
-      fprintf(fpTT, "\n");
+      BenchPrintQualif(
+        fps[iCase],
+        ratioInter,
+        ratios[iCase][0],
+        ratios[iCase][1]);
 
     }
 
@@ -901,6 +386,21 @@ void Qualify3DStatic(TypeQualif typeQualif) {
   fclose(fpTC);
   fclose(fpTT);
 
+  // Free the distributions
+  for (
+    int iCase = 5;
+    iCase--;) {
+
+    for (
+      int iInter = 2;
+      iInter--;) {
+
+      BenchDistFree(ratios[iCase] + iInter);
+
+    }
+
+  }
+
 }
 
 int main(int argc, char** argv) {
@@ -922,6 +422,16 @@ int main(int argc, char** argv) {
 
   Qualify3DStatic(typeQualif);
 
+#ifdef FMB_ELIM_STATS
+
+  // Print the statistics of the elimination
+  FMBElimStats elimStats = FMBGetElimStats3DFace();
+  FMBElimStatsPrint(
+    &elimStats,
+    stdout);
+
+#endif
+
   return 0;
 
 }
@@ -32,8 +32,8 @@
 typedef struct {
 
   FrameType type;
-  double orig[3];
-  double comp[3][3];
+  FMB_REAL orig[3];
+  FMB_REAL comp[3][3];
 
 } Param3D;
 
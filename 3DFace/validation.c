@@ -37,6 +37,15 @@
 // Nb of tests of the validation
 #define NB_TESTS 1000000
 
+// Maximum rate of disagreement between FMB and SAT, null in double
+// precision, in float precision both may be wrong on Frames closer
+// than the precision
+#ifdef FMB_REAL_FLOAT
+  #define MAX_DISAGREE_RATE 0.001
+#else
+  #define MAX_DISAGREE_RATE 0.0
+#endif
+
 // Helper macro to generate random number in [0.0, 1.0]
 #define rnd() (double)(rand())/(double)(RAND_MAX)
 
@@ -45,18 +54,23 @@
 unsigned long int nbInter;
 unsigned long int nbNoInter;
 
+// Global variable to count nb of tests where FMB and SAT disagree
+unsigned long int nbDisagree;
+
 // Helper structure to pass arguments to the Validation function
 typedef struct {
 
   FrameType type;
-  double orig[3];
-  double comp[3][3];
+  FMB_REAL orig[3];
+  FMB_REAL comp[3][3];
 
 } Param3D;
 
 // Validation function
 // Takes two Frame definition as input, run the intersection test on
-// them with FMB and SAT, and check the results are identical
+// them with FMB and SAT, and check the results are identical, and
+// identical for SAT with the scalar and vectorized projections of the
+// vertices
 void ValidationOnePair3D(
   const Param3D paramP,
   const Param3D paramQ) {
@@ -98,24 +112,68 @@ void ValidationOnePair3D(
         that,
         tho);
 
+    // Test intersection with SAT and each vectorized projection of
+    // the vertices, and check the results are identical
+    SATCheckMode checkModes[2] = {
+
+      SATCheckModeSIMD,
+      SATCheckModeSIMDAxes
+
+    };
+    for (
+      int iMode = 2;
+      iMode--;) {
+
+      SATCheckMode mode = SATGetCheckMode();
+      SATSetCheckMode(checkModes[iMode]);
+      bool isIntersectingCheck =
+        SATTestIntersection3DFace(
+          that,
+          tho);
+      SATSetCheckMode(mode);
+      if (isIntersectingSAT != isIntersectingCheck) {
+
+        // Print the disagreement
+        printf("ValidationSATCheck3DFace has failed (mode %d)\n",
+          checkModes[iMode]);
+        Frame3DPrint(that);
+        printf(" against ");
+        Frame3DPrint(tho);
+        printf("\n");
+
+        // Stop the validation
+        exit(0);
+
+      }
+
+    }
+
     // If the results are different
     if (isIntersectingFMB != isIntersectingSAT) {
 
-      // Print the disagreement
-      printf("Validation3D has failed\n");
-      Frame3DPrint(that);
-      printf(" against ");
-      Frame3DPrint(tho);
-      printf("\n");
-      printf("FMB : ");
-      if (isIntersectingFMB == false) printf("no ");
-      printf("intersection\n");
-      printf("SAT : ");
-      if (isIntersectingSAT == false) printf("no ");
-      printf("intersection\n");
-
-      // Stop the validation
-      exit(0);
+      // Update the number of disagreements
+      ++nbDisagree;
+
+      // If no disagreement is tolerated
+      if (MAX_DISAGREE_RATE == 0.0) {
+
+        // Print the disagreement
+        printf("Validation3D has failed\n");
+        Frame3DPrint(that);
+        printf(" against ");
+        Frame3DPrint(tho);
+        printf("\n");
+        printf("FMB : ");
+        if (isIntersectingFMB == false) printf("no ");
+        printf("intersection\n");
+        printf("SAT : ");
+        if (isIntersectingSAT == false) printf("no ");
+        printf("intersection\n");
+
+        // Stop the validation
+        exit(0);
+
+      }
 
     }
 
@@ -154,6 +212,7 @@ void Validate3D(void) {
   // Initialize the number of intersection and no intersection
   nbInter = 0;
   nbNoInter = 0;
+  nbDisagree = 0;
 
   // Loop on the tests
   for (
@@ -223,11 +282,24 @@ void Validate3D(void) {
 
   }
 
+  // Check the rate of disagreement
+  double rateDisagree =
+    (double)nbDisagree / (double)(nbInter + nbNoInter);
+  if (rateDisagree > MAX_DISAGREE_RATE) {
+
+    printf("Validation3DFace has failed\n");
+    printf("Disagreement rate with SAT %e\n", rateDisagree);
+    exit(0);
+
+  }
+
   // If we reached here it means the validation was successfull
   // Print results
   printf("Validation3DFace has succeed.\n");
   printf("Tested %lu intersections ", nbInter);
   printf("and %lu no intersections\n", nbNoInter);
+  printf("Disagreement rate with SAT (%s) %e\n",
+    FMB_REAL_NAME, rateDisagree);
 
 }
 
@@ -18,6 +18,8 @@
 */
 
 #include "fmb3dt.h"
+#include "sat.h"
+#include "frameinternal.h"
 
 // ------------- Macros -------------
 
@@ -32,7 +34,109 @@
 #define THD_VAR 2
 #define FOR_VAR 3
 
-#define EPSILON 0.0000001
+#define EPSILON FMB_EPSILON
+
+// Number of Frames projected at once by the batch intersection test
+#define FMB_BATCH_CHUNK 32
+
+// Default order of elimination of the variables
+#ifndef FMB3DTIME_ELIM_ORDER
+  #define FMB3DTIME_ELIM_ORDER FMBElimOrderFixed
+#endif
+
+// Number of rows of the system and of its successive eliminations for
+// each pair of types (C for Cuboid, T for Tetrahedron, that first).
+// The number of rows of the system is exact. The numbers of rows
+// after the first and second eliminations are their maximum given by
+// the pattern of signs: eliminating a variable with p positive, n
+// negative and z null coefficients gives p.n+z rows, the rows of the
+// constraints on tho and time having a known sign and the other ones
+// any sign. These maximums hold for any order of elimination of the
+// spatial variables (cf FMBElimOrderAdaptive): the constraints on tho
+// are unchanged by a permutation of the spatial variables, and the
+// rows of the constraints on that with their columns permuted are
+// still rows of any sign, hence eliminating the spatial variables in
+// any order is eliminating them in the order of the axes in another
+// system with the same pattern of signs. The maximum number of rows
+// after the third elimination is much larger than what is actually
+// reached (1724 for CC, 1334 for CT), hence for CC and CT its buffer
+// is sized with the value which has proven to be sufficient during
+// tests, validation and qualification, and the number of rows is
+// checked before the elimination, whatever the order, to use a larger
+// allocated buffer if needed (cf FMBTestIntersectionSolve3DTime)
+#define FMB3DTIME_NB_ROWS_CC 14
+#define FMB3DTIME_NB_ROWS_P_CC 22
+#define FMB3DTIME_NB_ROWS_PP_CC 85
+#define FMB3DTIME_NB_ROWS_PPP_CC 560
+#define FMB3DTIME_NB_ROWS_CT 12
+#define FMB3DTIME_NB_ROWS_P_CT 20
+#define FMB3DTIME_NB_ROWS_PP_CT 75
+#define FMB3DTIME_NB_ROWS_PPP_CT 560
+#define FMB3DTIME_NB_ROWS_TC 12
+#define FMB3DTIME_NB_ROWS_P_TC 15
+#define FMB3DTIME_NB_ROWS_PP_TC 34
+#define FMB3DTIME_NB_ROWS_PPP_TC 258
+#define FMB3DTIME_NB_ROWS_TT 10
+#define FMB3DTIME_NB_ROWS_P_TT 13
+#define FMB3DTIME_NB_ROWS_PP_TT 28
+#define FMB3DTIME_NB_ROWS_PPP_TT 171
+
+// Default axes used as filters by the hybrid intersection test, none
+// as the filter slows down the test on random pairs (cf
+// FMBHybridTestIntersection3DTime)
+#ifndef FMB3DTIME_HYBRID_AXES
+  #define FMB3DTIME_HYBRID_AXES FMB_HYBRID_AXES_NONE
+#endif
+
+// Default tolerances (distance and time) and maximum number of
+// bisections of the continuous collision detection of rotating bodies
+#ifndef FMB3DTIME_CCD_TOLERANCE
+  #define FMB3DTIME_CCD_TOLERANCE 1e-3
+#endif
+#ifndef FMB3DTIME_CCD_TIME_TOLERANCE
+  #define FMB3DTIME_CCD_TIME_TOLERANCE (1.0 / 64.0)
+#endif
+#ifndef FMB3DTIME_CCD_MAX_DEPTH
+  #define FMB3DTIME_CCD_MAX_DEPTH 16
+#endif
+
+// ------------- Global variables -------------
+
+// Axes currently used as filters by the hybrid intersection test,
+// atomic as they may be changed while other threads are running it
+static _Atomic unsigned int fmbHybridAxes3DTime = FMB3DTIME_HYBRID_AXES;
+
+// Pruning of redundant rows between eliminations, cf FMBSetPruning3DTime,
+// atomic as the other settings of the intersection tests
+#ifdef FMB3DTIME_PRUNING
+  static _Atomic bool fmbPruning3DTime = true;
+#else
+  static _Atomic bool fmbPruning3DTime = false;
+#endif
+
+// Statistics of the pruning, accumulated per thread (cf FrameStats)
+FRAME_STATS_DEFINE(
+  FMBPruneStats,
+  fmbPruneStats3DTime,
+  FMBPruneStatsMerge)
+
+// Statistics of the elimination, cf FMB_ELIM_STATS, accumulated per
+// thread (cf FrameStats)
+FRAME_STATS_DEFINE(
+  FMBElimStats,
+  fmbElimStats3DTime,
+  FMBElimStatsMerge)
+
+// Order of elimination of the variables currently used, atomic as it
+// may be changed while other threads are running the intersection
+// tests, each test reading it once
+static _Atomic FMBElimOrder fmbElimOrder3DTime = FMB3DTIME_ELIM_ORDER;
+
+// Tolerances and maximum number of bisections of the continuous
+// collision detection currently used
+static FMB_REAL fmbCCDTolerance3DTime = FMB3DTIME_CCD_TOLERANCE;
+static FMB_REAL fmbCCDTimeTolerance3DTime = FMB3DTIME_CCD_TIME_TOLERANCE;
+static int fmbCCDMaxDepth3DTime = FMB3DTIME_CCD_MAX_DEPTH;
 
 // ------------- Functions declaration -------------
 
@@ -42,13 +146,13 @@
 // the resulting system in nbRemainRows
 // Return false if the system becomes inconsistent during elimination,
 // else return true
-bool ElimVar3DTime(
-  const double (*M)[4],
-  const double* Y,
+static bool ElimVar3DTime(
+  const FMB_REAL (*M)[4],
+  const FMB_REAL* Y,
   const int nbRows,
   const int nbCols,
-  double (*Mp)[4],
-  double* Yp,
+  FMB_REAL (*Mp)[4],
+  FMB_REAL* Yp,
   int* const nbRemainRows);
 
 // Get the bounds of the iVar-th variable in the nbRows rows
@@ -58,10 +162,10 @@ bool ElimVar3DTime(
 // (M arrangement is [iRow][iCol])
 // May return inconsistent values (max < min), which would
 // mean the system has no solution
-void GetBoundLastVar3DTime(
+static void GetBoundLastVar3DTime(
   const int iVar,
-  const double (*M)[4],
-  const double* Y,
+  const FMB_REAL (*M)[4],
+  const FMB_REAL* Y,
   const int nbRows,
   AABB3DTime* const bdgBox);
 
@@ -69,14 +173,215 @@ void GetBoundLastVar3DTime(
 // system M.X<=Y where the iVar-th variable is on the first column
 // and store them in the iVar-th axis of the AABB bdgBox
 // (M arrangement is [iRow][iCol])
-void GetBoundVar3DTime(
+static void GetBoundVar3DTime(
   const int iVar,
-  const double (*M)[4],
-  const double* Y,
+  const FMB_REAL (*M)[4],
+  const FMB_REAL* Y,
   const int nbRows,
   const int nbCols,
   AABB3DTime* const bdgBox);
 
+// Remove the redundant rows of the nbRows rows system M.X<=Y, moving
+// the nbKeptRows kept rows at the beginning of the system
+// (cf FMBSetPruning3DTime)
+static void PruneRows3DTime(
+  FMB_REAL (*M)[4],
+  FMB_REAL* Y,
+  const int nbRows,
+  const int nbCols,
+  int* const nbKeptRows);
+
+// Exchange the iRow-th and jRow-th rows of the system M.X<=Y
+static inline void SwapRows3DTime(
+  FMB_REAL (*M)[4],
+  FMB_REAL* Y,
+  const int iRow,
+  const int jRow);
+
+// Return the index of the column among the nbVar first ones of the
+// nbRows rows system M.X<=Y whose elimination gives the smallest
+// system (cf FMBElimOrderAdaptive)
+static inline int ChooseElimVar3DTime(
+  const FMB_REAL (*M)[4],
+  const int nbRows,
+  const int nbVar);
+
+// Exchange the iCol-th and jCol-th columns of the nbRows rows system
+// M.X<=Y
+static inline void SwapCols3DTime(
+  FMB_REAL (*M)[4],
+  const int nbRows,
+  const int iCol,
+  const int jCol);
+
+// Return the number of rows of the system resulting from the
+// elimination of the first variable in the nbRows rows system M.X<=Y
+static inline int GetNbRowsElim3DTime(
+  const FMB_REAL (*M)[4],
+  const int nbRows);
+
+// Solve the system of inequalities of the intersection between a
+// Frame of type thatType and the Frame thoProj of type thoType,
+// projection of tho in that's coordinates system, using the buffers
+// M, Y, Mp, Yp...
+// If tContact is not null the time of first contact is stored into it
+// (cf FMBTestIntersection3DTime, FMBTestFirstContact3DTime)
+static inline bool FMBTestIntersectionSolve3DTime(
+  const FrameType thatType,
+  const FrameType thoType,
+  const Frame3DTime* const thoProj,
+  AABB3DTime* const bdgBox,
+  FMB_REAL* const tContact,
+  FMB_REAL (*M)[4],
+  FMB_REAL* Y,
+  FMB_REAL (*Mp)[4],
+  FMB_REAL* Yp,
+  FMB_REAL (*Mpp)[4],
+  FMB_REAL* Ypp,
+  FMB_REAL (*Mppp)[4],
+  FMB_REAL* Yppp,
+  const int nbRowsPPPMax) __attribute__((always_inline));
+
+// Kernels testing the intersection for each pair of types, C for
+// Cuboid and T for Tetrahedron, the first letter being the type of
+// that and the second the type of tho, and getting the time of first
+// contact if tContact is not null
+static bool FMBTestIntersectionProj3DTimeCCGeneric(
+  const Frame3DTime* const thoProj,
+  AABB3DTime* const bdgBox,
+  FMB_REAL* const tContact);
+static bool FMBTestIntersectionProj3DTimeCTGeneric(
+  const Frame3DTime* const thoProj,
+  AABB3DTime* const bdgBox,
+  FMB_REAL* const tContact);
+static bool FMBTestIntersectionProj3DTimeTCGeneric(
+  const Frame3DTime* const thoProj,
+  AABB3DTime* const bdgBox,
+  FMB_REAL* const tContact);
+static bool FMBTestIntersectionProj3DTimeTTGeneric(
+  const Frame3DTime* const thoProj,
+  AABB3DTime* const bdgBox,
+  FMB_REAL* const tContact);
+
+// Implementations of the kernels for each FrameCPUPath
+FRAME_CPU_VARIANTS(
+  bool,
+  FMBTestIntersectionProj3DTimeCC,
+  (
+    const Frame3DTime* const thoProj,
+    AABB3DTime* const bdgBox,
+    FMB_REAL* const tContact),
+  (thoProj, bdgBox, tContact))
+FRAME_CPU_VARIANTS(
+  bool,
+  FMBTestIntersectionProj3DTimeCT,
+  (
+    const Frame3DTime* const thoProj,
+    AABB3DTime* const bdgBox,
+    FMB_REAL* const tContact),
+  (thoProj, bdgBox, tContact))
+FRAME_CPU_VARIANTS(
+  bool,
+  FMBTestIntersectionProj3DTimeTC,
+  (
+    const Frame3DTime* const thoProj,
+    AABB3DTime* const bdgBox,
+    FMB_REAL* const tContact),
+  (thoProj, bdgBox, tContact))
+FRAME_CPU_VARIANTS(
+  bool,
+  FMBTestIntersectionProj3DTimeTT,
+  (
+    const Frame3DTime* const thoProj,
+    AABB3DTime* const bdgBox,
+    FMB_REAL* const tContact),
+  (thoProj, bdgBox, tContact))
+
+// Dispatch table of the kernels, [FrameCPUPath][thatType][thoType]
+static bool (* const fmbKernels3DTime[FrameCPUNb][2][2])(
+  const Frame3DTime* const,
+  AABB3DTime* const,
+  FMB_REAL* const) = {
+
+  {
+
+    {
+      FMBTestIntersectionProj3DTimeCCGeneric,
+      FMBTestIntersectionProj3DTimeCTGeneric},
+    {
+      FMBTestIntersectionProj3DTimeTCGeneric,
+      FMBTestIntersectionProj3DTimeTTGeneric}
+
+  },
+  {
+
+    {
+      FMBTestIntersectionProj3DTimeCCSSE2,
+      FMBTestIntersectionProj3DTimeCTSSE2},
+    {
+      FMBTestIntersectionProj3DTimeTCSSE2,
+      FMBTestIntersectionProj3DTimeTTSSE2}
+
+  },
+  {
+
+    {
+      FMBTestIntersectionProj3DTimeCCAVX2,
+      FMBTestIntersectionProj3DTimeCTAVX2},
+    {
+      FMBTestIntersectionProj3DTimeTCAVX2,
+      FMBTestIntersectionProj3DTimeTTAVX2}
+
+  },
+  {
+
+    {
+      FMBTestIntersectionProj3DTimeCCAVX512,
+      FMBTestIntersectionProj3DTimeCTAVX512},
+    {
+      FMBTestIntersectionProj3DTimeTCAVX512,
+      FMBTestIntersectionProj3DTimeTTAVX512}
+
+  }
+
+};
+
+// Test for intersection between a Frame of type thatType and the
+// Frame thoProj of type thoType, projection of tho in that's
+// coordinates system
+// (cf FMBTestIntersection3DTime)
+static inline bool FMBTestIntersectionProj3DTime(
+  const FrameType thatType,
+  const FrameType thoType,
+  const Frame3DTime* const thoProj,
+  AABB3DTime* const bdgBox);
+
+// Get the Frame frame containing the body that during the sub-step
+// [tStart, tEnd] of its current step, or if isInner is true the Frame
+// contained by the body during the whole sub-step, and the largest
+// distance dev along each axis between a point of the body and the
+// same point with the components of the middle of the sub-step
+// Return false if the body is too thin for the latter to exist, else
+// true
+static bool FMBCCDBodyGetSubStep3DTime(
+  const FMBCCDBody3DTime* const that,
+  const FMB_REAL tStart,
+  const FMB_REAL tEnd,
+  const bool isInner,
+  Frame3DTime* const frame,
+  FMB_REAL* const dev);
+
+// Get the time of first contact between the bodies that and tho
+// during the sub-step [tStart, tEnd] of their current step, at depth
+// depth of the bisection (cf FMBCCDTestFirstContact3DTime)
+static bool FMBCCDBisect3DTime(
+  const FMBCCDBody3DTime* const that,
+  const FMBCCDBody3DTime* const tho,
+  const FMB_REAL tStart,
+  const FMB_REAL tEnd,
+  const int depth,
+  FMB_REAL* const tContact);
+
 // ------------- Functions implementation -------------
 
 // Eliminate the first variable in the system M.X<=Y
@@ -86,13 +391,13 @@ void GetBoundVar3DTime(
 // (M arrangement is [iRow][iCol])
 // Return true if the system becomes inconsistent during elimination,
 // else return false
-bool ElimVar3DTime(
-  const double (*M)[4],
-  const double* Y,
+static bool ElimVar3DTime(
+  const FMB_REAL (*M)[4],
+  const FMB_REAL* Y,
   const int nbRows,
   const int nbCols,
-  double (*Mp)[4],
-  double* Yp,
+  FMB_REAL (*Mp)[4],
+  FMB_REAL* Yp,
   int* const nbRemainRows) {
 
   // Initialize the number of rows in the result system
@@ -106,16 +411,16 @@ bool ElimVar3DTime(
     ++iRow) {
 
     // Shortcuts
-    const double fabsMIRowIVar = fabs(M[iRow][0]);
+    const FMB_REAL fabsMIRowIVar = fabs(M[iRow][0]);
 
     // If the coefficient for the eliminated variable is not null
     // in this row
     if (fabsMIRowIVar > EPSILON) {
 
       // Shortcuts
-      const double* MiRow = M[iRow];
+      const FMB_REAL* MiRow = M[iRow];
       const int sgnMIRowIVar = sgn(MiRow[0]);
-      const double YIRowDivideByFabsMIRowIVar = Y[iRow] / fabsMIRowIVar;
+      const FMB_REAL YIRowDivideByFabsMIRowIVar = Y[iRow] / fabsMIRowIVar;
 
       // For each following rows
       for (
@@ -130,12 +435,12 @@ bool ElimVar3DTime(
           fabs(M[jRow][0]) > EPSILON) {
 
           // Shortcuts
-          const double* MjRow = M[jRow];
-          const double fabsMjRow = fabs(MjRow[0]);
+          const FMB_REAL* MjRow = M[jRow];
+          const FMB_REAL fabsMjRow = fabs(MjRow[0]);
 
           // Declare a variable to memorize the sum of the negative
           // coefficients in the row
-          double sumNegCoeff = 0.0;
+          FMB_REAL sumNegCoeff = 0.0;
 
           // Add the sum of the two normed (relative to the eliminated
           // variable) rows into the result system. This actually
@@ -190,14 +495,14 @@ bool ElimVar3DTime(
     ++iRow) {
 
     // Shortcut
-    const double* MiRow = M[iRow];
+    const FMB_REAL* MiRow = M[iRow];
 
     // If the coefficient of the eliminated variable is null on
     // this row
     if (fabs(MiRow[0]) < EPSILON) {
 
       // Shortcut
-      double* MpnbResRows = Mp[nbResRows];
+      FMB_REAL* MpnbResRows = Mp[nbResRows];
 
       // Copy this row into the result system excluding the eliminated
       // variable
@@ -235,16 +540,16 @@ bool ElimVar3DTime(
 // per row, the one in argument
 // May return inconsistent values (max < min), which would
 // mean the system has no solution
-void GetBoundLastVar3DTime(
+static void GetBoundLastVar3DTime(
   const int iVar,
-  const double (*M)[4],
-  const double* Y,
+  const FMB_REAL (*M)[4],
+  const FMB_REAL* Y,
   const int nbRows,
   AABB3DTime* const bdgBox) {
 
   // Shortcuts
-  double* min = bdgBox->min + iVar;
-  double* max = bdgBox->max + iVar;
+  FMB_REAL* min = bdgBox->min + iVar;
+  FMB_REAL* max = bdgBox->max + iVar;
 
   // Initialize the bounds to there maximum maximum and minimum minimum
   *min = 0.0;
@@ -257,14 +562,14 @@ void GetBoundLastVar3DTime(
     ++jRow) {
 
     // Shortcut
-    double MjRowiVar = M[jRow][0];
+    FMB_REAL MjRowiVar = M[jRow][0];
 
     // If this row has been reduced to the variable in argument
     // and it has a strictly positive coefficient
     if (MjRowiVar > EPSILON) {
 
       // Get the scaled value of Y for this row
-      double y = Y[jRow] / MjRowiVar;
+      FMB_REAL y = Y[jRow] / MjRowiVar;
 
       // If the value is lower than the current maximum bound
       if (*max > y) {
@@ -279,7 +584,7 @@ void GetBoundLastVar3DTime(
     } else if (MjRowiVar < -EPSILON) {
 
       // Get the scaled value of Y for this row
-      double y = Y[jRow] / MjRowiVar;
+      FMB_REAL y = Y[jRow] / MjRowiVar;
 
       // If the value is greater than the current minimum bound
       if (*min < y) {
@@ -291,6 +596,14 @@ void GetBoundLastVar3DTime(
 
     }
 
+    // If the bounds are already inconsistent, the other rows can't
+    // make them consistent
+    if (*min >= *max) {
+
+      return;
+
+    }
+
   }
 
 }
@@ -299,17 +612,17 @@ void GetBoundLastVar3DTime(
 // system M.X<=Y where the iVar-th variable is on the first column
 // and store them in the iVar-th axis of the AABB bdgBox
 // (M arrangement is [iRow][iCol])
-void GetBoundVar3DTime(
+static void GetBoundVar3DTime(
   const int iVar,
-  const double (*M)[4],
-  const double* Y,
+  const FMB_REAL (*M)[4],
+  const FMB_REAL* Y,
   const int nbRows,
   const int nbCols,
   AABB3DTime* const bdgBox) {
 
   // Shortcuts
-  double* bdgBoxMin = bdgBox->min;
-  double* bdgBoxMax = bdgBox->max;
+  FMB_REAL* bdgBoxMin = bdgBox->min;
+  FMB_REAL* bdgBoxMax = bdgBox->max;
 
   // Initialize the bounds
   bdgBoxMin[iVar] = 0.0;
@@ -322,16 +635,16 @@ void GetBoundVar3DTime(
     ++iRow) {
 
     // Shortcuts
-    const double* MIRow = M[iRow];
-    double fabsMIRowIVar = fabs(MIRow[0]);
+    const FMB_REAL* MIRow = M[iRow];
+    FMB_REAL fabsMIRowIVar = fabs(MIRow[0]);
 
     // If the coefficient of the first variable on this row is not null
     if (fabsMIRowIVar > EPSILON) {
 
       // Declare two variables to memorize the min and max of the
       // requested variable in this row
-      double min = -1.0 * Y[iRow];
-      double max = Y[iRow];
+      FMB_REAL min = -1.0 * Y[iRow];
+      FMB_REAL max = Y[iRow];
 
       // Loop on columns except the first one which is the one of the
       // requested variable
@@ -374,62 +687,413 @@ void GetBoundVar3DTime(
 
 }
 
-// Test for intersection between Frame that and Frame tho
-// Return true if the two Frames are intersecting, else false
-// If the Frame are intersecting the AABB of the intersection
-// is stored into bdgBox, else bdgBox is not modified
-// If bdgBox is null, the result AABB is not memorized (to use if
-// unnecessary and want to speed up the algorithm)
-// The resulting AABB may be larger than the smallest possible AABB
-// The resulting AABB of FMBTestIntersection(A,B) may be different
-// of the resulting AABB of FMBTestIntersection(B,A)
-// The resulting AABB is given in tho's local coordinates system
-bool FMBTestIntersection3DTime(
-  Frame3DTime* const that,
-  const Frame3DTime* const tho,
-  AABB3DTime* const bdgBox) {
+// Remove the redundant rows of the nbRows rows system M.X<=Y, where
+// X is in [0,1]: rows identical to another one, rows with the same
+// coefficients as another one and a greater right side, and rows with
+// at least two non null coefficients satisfied by any X in [0,1]
+// (rows with only one non null coefficient are always kept as they
+// bound the variables)
+// The kept rows are moved at the beginning of the system and their
+// number is memorized in nbKeptRows. The removed rows are moved after
+// them instead of being discarded, so the whole system is still
+// available to get the bounds of the variables
+// (M arrangement is [iRow][iCol])
+static void PruneRows3DTime(
+  FMB_REAL (*M)[4],
+  FMB_REAL* Y,
+  const int nbRows,
+  const int nbCols,
+  int* const nbKeptRows) {
 
-  // Get the projection of the Frame tho in Frame that coordinates
-  // system
-  Frame3DTime thoProj;
-  Frame3DTimeImportFrame(that, tho, &thoProj);
+  // Initialize the number of kept rows
+  int nbKept = 0;
+
+  // Declare a variable to memorize the statistics of this call, added
+  // to the ones of the thread at the end
+  FMBPruneStats stats = {
+
+    .nbRows = nbRows,
+    .nbDuplicate = 0,
+    .nbDominated = 0,
+    .nbTrivial = 0
+
+  };
+
+  // Loop on the rows
+  for (
+    int iRow = 0;
+    iRow < nbRows;
+    ++iRow) {
+
+    // Shortcut
+    const FMB_REAL* MiRow = M[iRow];
+
+    // Get the sum of the positive coefficients and the number of
+    // non null coefficients of the row
+    FMB_REAL sumPosCoeff = 0.0;
+    int nbNonNull = 0;
+    for (
+      int iCol = nbCols;
+      iCol--;) {
+
+      if (MiRow[iCol] > 0.0) {
+
+        sumPosCoeff += MiRow[iCol];
+
+      }
+
+      if (fabs(MiRow[iCol]) > EPSILON) {
+
+        ++nbNonNull;
+
+      }
+
+    }
+
+    // If the row is satisfied by any X in [0,1]
+    if (nbNonNull >= 2 && sumPosCoeff <= Y[iRow]) {
+
+      // Remove the row (it stays at its position, after the kept rows)
+      ++(stats.nbTrivial);
+      continue;
+
+    }
+
+    // Loop on the kept rows to search one with the same coefficients
+    bool isRemoved = false;
+    for (
+      int jRow = 0;
+      jRow < nbKept && isRemoved == false;
+      ++jRow) {
+
+      // Check if the coefficients are the same
+      bool isSameCoeff = true;
+      for (
+        int iCol = nbCols;
+        iCol-- && isSameCoeff == true;) {
+
+        isSameCoeff = (M[jRow][iCol] == MiRow[iCol]);
+
+      }
+
+      if (isSameCoeff == true) {
+
+        // Remove the row with the greater right side, by exchanging
+        // the two rows if it's the kept one
+        isRemoved = true;
+        if (Y[iRow] == Y[jRow]) {
+
+          ++(stats.nbDuplicate);
+
+        } else {
+
+          ++(stats.nbDominated);
+
+        }
+
+        if (Y[iRow] < Y[jRow]) {
+
+          SwapRows3DTime(
+            M,
+            Y,
+            iRow,
+            jRow);
+
+        }
+
+      }
+
+    }
+
+    // If the row is kept, move it after the other kept rows
+    if (isRemoved == false) {
+
+      if (iRow != nbKept) {
+
+        SwapRows3DTime(
+          M,
+          Y,
+          iRow,
+          nbKept);
+
+      }
+
+      ++nbKept;
+
+    }
+
+  }
+
+  // Update the statistics
+  FMBPruneStatsMerge(
+    fmbPruneStats3DTimeThread(),
+    &stats);
+
+  // Memorize the number of kept rows
+  *nbKeptRows = nbKept;
+
+}
+
+// Exchange the iRow-th and jRow-th rows of the system M.X<=Y
+static inline void SwapRows3DTime(
+  FMB_REAL (*M)[4],
+  FMB_REAL* Y,
+  const int iRow,
+  const int jRow) {
+
+  for (
+    int iCol = 4;
+    iCol--;) {
+
+    FMB_REAL tmp = M[iRow][iCol];
+    M[iRow][iCol] = M[jRow][iCol];
+    M[jRow][iCol] = tmp;
+
+  }
+
+  FMB_REAL tmp = Y[iRow];
+  Y[iRow] = Y[jRow];
+  Y[jRow] = tmp;
+
+}
+
+// Return the index of the column among the nbVar first ones of the
+// nbRows rows system M.X<=Y whose elimination gives the smallest
+// system
+// Eliminating a variable with p positive, n negative and z null
+// coefficients gives p.n+z rows, the first column is kept in case of
+// equality to stay as close as possible to the fixed order
+static inline int ChooseElimVar3DTime(
+  const FMB_REAL (*M)[4],
+  const int nbRows,
+  const int nbVar) {
+
+  // Count the positive and negative coefficients of each column
+  int nbPos[3] = {0, 0, 0};
+  int nbNeg[3] = {0, 0, 0};
+  for (
+    int iRow = nbRows;
+    iRow--;) {
+
+    for (
+      int iCol = nbVar;
+      iCol--;) {
+
+      if (M[iRow][iCol] > EPSILON) {
+
+        ++(nbPos[iCol]);
+
+      } else if (M[iRow][iCol] < -EPSILON) {
+
+        ++(nbNeg[iCol]);
+
+      }
+
+    }
+
+  }
+
+  // Search the column giving the smallest system
+  int iColBest = 0;
+  int nbRowsBest = nbPos[0] * nbNeg[0] - nbPos[0] - nbNeg[0];
+  for (
+    int iCol = 1;
+    iCol < nbVar;
+    ++iCol) {
+
+    int nbRowsCol = nbPos[iCol] * nbNeg[iCol] - nbPos[iCol] - nbNeg[iCol];
+    if (nbRowsCol < nbRowsBest) {
+
+      iColBest = iCol;
+      nbRowsBest = nbRowsCol;
+
+    }
 
-  // Declare two variables to memorize the system to be solved M.X <= Y
-  // (M arrangement is [iRow][iCol])
-  double M[14][4];
-  double Y[14];
+  }
+
+  return iColBest;
+
+}
+
+// Exchange the iCol-th and jCol-th columns of the nbRows rows system
+// M.X<=Y
+static inline void SwapCols3DTime(
+  FMB_REAL (*M)[4],
+  const int nbRows,
+  const int iCol,
+  const int jCol) {
+
+  for (
+    int iRow = nbRows;
+    iRow--;) {
+
+    FMB_REAL tmp = M[iRow][iCol];
+    M[iRow][iCol] = M[iRow][jCol];
+    M[iRow][jCol] = tmp;
+
+  }
+
+}
+
+// Return the number of rows of the system resulting from the
+// elimination of the first variable in the nbRows rows system M.X<=Y
+// (cf ElimVar3DTime)
+static inline int GetNbRowsElim3DTime(
+  const FMB_REAL (*M)[4],
+  const int nbRows) {
+
+  // Count the positive, negative and null coefficients of the
+  // eliminated variable
+  int nbPos = 0;
+  int nbNeg = 0;
+  int nbNull = 0;
+  for (
+    int iRow = nbRows;
+    iRow--;) {
+
+    if (M[iRow][0] > EPSILON) {
+
+      ++nbPos;
+
+    } else if (M[iRow][0] < -EPSILON) {
+
+      ++nbNeg;
+
+    } else if (fabs(M[iRow][0]) < EPSILON) {
+
+      ++nbNull;
+
+    }
+
+  }
+
+  return nbPos * nbNeg + nbNull;
+
+}
+
+// Set the use of the pruning of redundant rows between eliminations
+void FMBSetPruning3DTime(const bool isPruning) {
+
+  atomic_store_explicit(
+    &fmbPruning3DTime,
+    isPruning,
+    memory_order_relaxed);
+
+}
+
+// Get the statistics of the pruning of redundant rows since the last
+// reset
+FMBPruneStats FMBGetPruneStats3DTime(void) {
+
+  FMBPruneStats stats;
+  FrameStatsGet(
+    &fmbPruneStats3DTime,
+    &stats);
+  return stats;
+
+}
+
+// Reset the statistics of the pruning of redundant rows
+void FMBResetPruneStats3DTime(void) {
+
+  FrameStatsReset(&fmbPruneStats3DTime);
+
+}
+
+// Set the order of elimination of the spatial variables used by
+// FMBTestIntersection3DTime, FMBTestFirstContact3DTime and
+// FMBTestIntersection3DTimeBatch
+void FMBSetElimOrder3DTime(const FMBElimOrder order) {
+
+  atomic_store_explicit(
+    &fmbElimOrder3DTime,
+    order,
+    memory_order_relaxed);
+
+}
+
+// Get the order of elimination of the spatial variables currently
+// used by the intersection tests
+FMBElimOrder FMBGetElimOrder3DTime(void) {
+
+  return
+    atomic_load_explicit(
+      &fmbElimOrder3DTime,
+      memory_order_relaxed);
+
+}
+
+// Solve the system of inequalities of the intersection between a
+// Frame of type thatType and the Frame thoProj of type thoType,
+// projection of tho in that's coordinates system
+// M, Y, Mp, Yp... are the buffers for the system and its successive
+// eliminations, sized by the caller for the pair of types
+// Always inlined, the types being constant in the callers the
+// construction of the system is fully specialized
+// If tContact is not null the time of first contact is stored into it
+// (cf FMBTestIntersection3DTime, FMBTestFirstContact3DTime)
+static inline bool FMBTestIntersectionSolve3DTime(
+  const FrameType thatType,
+  const FrameType thoType,
+  const Frame3DTime* const thoProj,
+  AABB3DTime* const bdgBox,
+  FMB_REAL* const tContact,
+  FMB_REAL (*M)[4],
+  FMB_REAL* Y,
+  FMB_REAL (*Mp)[4],
+  FMB_REAL* Yp,
+  FMB_REAL (*Mpp)[4],
+  FMB_REAL* Ypp,
+  FMB_REAL (*Mppp)[4],
+  FMB_REAL* Yppp,
+  const int nbRowsPPPMax) {
 
   // Create the inequality system
   // -V_jT-sum_iC_j,iX_i<=O_j
-  M[0][0] = -thoProj.comp[0][0];
-  M[0][1] = -thoProj.comp[1][0];
-  M[0][2] = -thoProj.comp[2][0];
-  M[0][3] = -thoProj.speed[0];
-  Y[0] = thoProj.orig[0];
+  M[0][0] = -thoProj->comp[0][0];
+  M[0][1] = -thoProj->comp[1][0];
+  M[0][2] = -thoProj->comp[2][0];
+  M[0][3] = -thoProj->speed[0];
+  Y[0] = thoProj->orig[0];
   if (Y[0] < neg(M[0][0]) + neg(M[0][1]) + neg(M[0][2]) + neg(M[0][3])) {
 
+    FMB_ELIM_STATS_STAGE(
+      fmbElimStats3DTimeThread(),
+      thatType,
+      thoType,
+      FMBElimStageInit);
     return false;
 
   }
 
-  M[1][0] = -thoProj.comp[0][1];
-  M[1][1] = -thoProj.comp[1][1];
-  M[1][2] = -thoProj.comp[2][1];
-  M[1][3] = -thoProj.speed[1];
-  Y[1] = thoProj.orig[1];
+  M[1][0] = -thoProj->comp[0][1];
+  M[1][1] = -thoProj->comp[1][1];
+  M[1][2] = -thoProj->comp[2][1];
+  M[1][3] = -thoProj->speed[1];
+  Y[1] = thoProj->orig[1];
   if (Y[1] < neg(M[1][0]) + neg(M[1][1]) + neg(M[1][2]) + neg(M[1][3])) {
 
+    FMB_ELIM_STATS_STAGE(
+      fmbElimStats3DTimeThread(),
+      thatType,
+      thoType,
+      FMBElimStageInit);
     return false;
 
   }
 
-  M[2][0] = -thoProj.comp[0][2];
-  M[2][1] = -thoProj.comp[1][2];
-  M[2][2] = -thoProj.comp[2][2];
-  M[2][3] = -thoProj.speed[2];
-  Y[2] = thoProj.orig[2];
+  M[2][0] = -thoProj->comp[0][2];
+  M[2][1] = -thoProj->comp[1][2];
+  M[2][2] = -thoProj->comp[2][2];
+  M[2][3] = -thoProj->speed[2];
+  Y[2] = thoProj->orig[2];
   if (Y[2] < neg(M[2][0]) + neg(M[2][1]) + neg(M[2][2]) + neg(M[2][3])) {
 
+    FMB_ELIM_STATS_STAGE(
+      fmbElimStats3DTimeThread(),
+      thatType,
+      thoType,
+      FMBElimStageInit);
     return false;
 
   }
@@ -437,48 +1101,63 @@ bool FMBTestIntersection3DTime(
   // Variable to memorize the nb of rows in the system
   int nbRows = 3;
 
-  if (that->type == FrameCuboid) {
+  if (thatType == FrameCuboid) {
 
     // V_jT+sum_iC_j,iX_i<=1.0-O_j
-    M[nbRows][0] = thoProj.comp[0][0];
-    M[nbRows][1] = thoProj.comp[1][0];
-    M[nbRows][2] = thoProj.comp[2][0];
-    M[nbRows][3] = thoProj.speed[0];
-    Y[nbRows] = 1.0 - thoProj.orig[0];
+    M[nbRows][0] = thoProj->comp[0][0];
+    M[nbRows][1] = thoProj->comp[1][0];
+    M[nbRows][2] = thoProj->comp[2][0];
+    M[nbRows][3] = thoProj->speed[0];
+    Y[nbRows] = 1.0 - thoProj->orig[0];
     if (
       Y[nbRows] < neg(M[nbRows][0]) + neg(M[nbRows][1]) +
       neg(M[nbRows][2]) + neg(M[nbRows][3])) {
 
+      FMB_ELIM_STATS_STAGE(
+        fmbElimStats3DTimeThread(),
+        thatType,
+        thoType,
+        FMBElimStageInit);
       return false;
 
     }
 
     ++nbRows;
 
-    M[nbRows][0] = thoProj.comp[0][1];
-    M[nbRows][1] = thoProj.comp[1][1];
-    M[nbRows][2] = thoProj.comp[2][1];
-    M[nbRows][3] = thoProj.speed[1];
-    Y[nbRows] = 1.0 - thoProj.orig[1];
+    M[nbRows][0] = thoProj->comp[0][1];
+    M[nbRows][1] = thoProj->comp[1][1];
+    M[nbRows][2] = thoProj->comp[2][1];
+    M[nbRows][3] = thoProj->speed[1];
+    Y[nbRows] = 1.0 - thoProj->orig[1];
     if (
       Y[nbRows] < neg(M[nbRows][0]) + neg(M[nbRows][1]) +
       neg(M[nbRows][2]) + neg(M[nbRows][3])) {
 
+      FMB_ELIM_STATS_STAGE(
+        fmbElimStats3DTimeThread(),
+        thatType,
+        thoType,
+        FMBElimStageInit);
       return false;
 
     }
 
     ++nbRows;
 
-    M[nbRows][0] = thoProj.comp[0][2];
-    M[nbRows][1] = thoProj.comp[1][2];
-    M[nbRows][2] = thoProj.comp[2][2];
-    M[nbRows][3] = thoProj.speed[2];
-    Y[nbRows] = 1.0 - thoProj.orig[2];
+    M[nbRows][0] = thoProj->comp[0][2];
+    M[nbRows][1] = thoProj->comp[1][2];
+    M[nbRows][2] = thoProj->comp[2][2];
+    M[nbRows][3] = thoProj->speed[2];
+    Y[nbRows] = 1.0 - thoProj->orig[2];
     if (
       Y[nbRows] < neg(M[nbRows][0]) + neg(M[nbRows][1]) +
       neg(M[nbRows][2]) + neg(M[nbRows][3])) {
 
+      FMB_ELIM_STATS_STAGE(
+        fmbElimStats3DTimeThread(),
+        thatType,
+        thoType,
+        FMBElimStageInit);
       return false;
 
     }
@@ -489,17 +1168,22 @@ bool FMBTestIntersection3DTime(
 
     // sum_j(V_jT+sum_iC_j,iX_i)<=1.0-sum_iO_i
     M[nbRows][0] =
-      thoProj.comp[0][0] + thoProj.comp[0][1] + thoProj.comp[0][2];
+      thoProj->comp[0][0] + thoProj->comp[0][1] + thoProj->comp[0][2];
     M[nbRows][1] =
-      thoProj.comp[1][0] + thoProj.comp[1][1] + thoProj.comp[1][2];
+      thoProj->comp[1][0] + thoProj->comp[1][1] + thoProj->comp[1][2];
     M[nbRows][2] =
-      thoProj.comp[2][0] + thoProj.comp[2][1] + thoProj.comp[2][2];
-    M[nbRows][3] = thoProj.speed[0] + thoProj.speed[1] + thoProj.speed[2];
-    Y[nbRows] = 1.0 - thoProj.orig[0] - thoProj.orig[1] - thoProj.orig[2];
+      thoProj->comp[2][0] + thoProj->comp[2][1] + thoProj->comp[2][2];
+    M[nbRows][3] = thoProj->speed[0] + thoProj->speed[1] + thoProj->speed[2];
+    Y[nbRows] = 1.0 - thoProj->orig[0] - thoProj->orig[1] - thoProj->orig[2];
     if (
       Y[nbRows] < neg(M[nbRows][0]) + neg(M[nbRows][1]) +
       neg(M[nbRows][2]) + neg(M[nbRows][3])) {
 
+      FMB_ELIM_STATS_STAGE(
+        fmbElimStats3DTimeThread(),
+        thatType,
+        thoType,
+        FMBElimStageInit);
       return false;
 
     }
@@ -508,7 +1192,7 @@ bool FMBTestIntersection3DTime(
 
   }
 
-  if (tho->type == FrameCuboid) {
+  if (thoType == FrameCuboid) {
 
     // X_i <= 1.0
     M[nbRows][0] = 1.0;
@@ -591,15 +1275,49 @@ bool FMBTestIntersection3DTime(
 
   };
 
-  // Declare variables to eliminate the first variable
-  // The size of the array given in the doc is a majoring value.
-  // Instead I use a smaller value which has proven to be sufficient
-  // during tests, validation and qualification, to avoid running
-  // into the heap limit and to optimize slightly the performance
-  //double Mp[63][4];
-  //double Yp[63];
-  double Mp[22][4];
-  double Yp[22];
+  // Declare a variable to memorize the axis of the i-th eliminated
+  // variable, the i-th axis of bdgBoxLocal being the one of the i-th
+  // eliminated variable
+  // Time is always eliminated last to get the time of first contact
+  int axes[4] = {FST_VAR, SND_VAR, THD_VAR, FOR_VAR};
+
+  // If the order of elimination is adaptive, move the spatial
+  // variable giving the smallest system to the first column
+  bool isAdaptive =
+    (atomic_load_explicit(
+      &fmbElimOrder3DTime,
+      memory_order_relaxed) == FMBElimOrderAdaptive);
+
+  // If that is a Cuboid its constraints come by pairs of opposite
+  // rows, and the constraints of tho add one positive and one
+  // negative coefficient to each column, hence all the columns give
+  // the same number of rows and the first one is kept without
+  // counting
+  if (
+    isAdaptive == true &&
+    thatType == FrameTetrahedron) {
+
+    int iCol =
+      ChooseElimVar3DTime(
+        M,
+        nbRows,
+        3);
+    if (iCol != 0) {
+
+      SwapCols3DTime(
+        M,
+        nbRows,
+        0,
+        iCol);
+      axes[0] = iCol;
+      axes[iCol] = FST_VAR;
+
+    }
+
+  }
+
+  // Declare a variable to memorize the number of rows of the system
+  // after elimination of the first variable
   int nbRowsP;
 
   // Eliminate the first variable in the original system
@@ -617,19 +1335,82 @@ bool FMBTestIntersection3DTime(
   if (inconsistency == true) {
 
     // The two Frames are not in intersection
+    FMB_ELIM_STATS_STAGE(
+      fmbElimStats3DTimeThread(),
+      thatType,
+      thoType,
+      FMBElimStagePass1);
     return false;
 
   }
 
-  // Declare variables to eliminate the second variable
-  // The size of the array given in the doc is a majoring value.
-  // Instead I use a smaller value which has proven to be sufficient
-  // during tests, validation and qualification, to avoid running
-  // into the heap limit and to optimize slightly the performance
-  //double Mpp[1056][4];
-  //double Ypp[1056];
-  double Mpp[57][4];
-  double Ypp[57];
+  // Record the size of the resulting system
+  FMB_ELIM_STATS_ROWS(
+    fmbElimStats3DTimeThread(),
+    thatType,
+    thoType,
+    0,
+    nbRowsP);
+
+  // If the user requested it, prune the redundant rows before the
+  // next elimination
+  // The bounds of the third variable are calculated from all the rows
+  // resulting of the next elimination, hence pruning is done here
+  // only if the bounding box is not requested, to keep it identical
+  int nbRowsPElim = nbRowsP;
+  bool isPruning =
+    atomic_load_explicit(
+      &fmbPruning3DTime,
+      memory_order_relaxed);
+  if (isPruning == true && bdgBox == NULL) {
+
+    PruneRows3DTime(
+      Mp,
+      Yp,
+      nbRowsP,
+      3,
+      &nbRowsPElim);
+
+  }
+
+  // If the order of elimination is adaptive, move the spatial
+  // variable giving the smallest system to the first column, in all
+  // the rows as the pruned ones are used for the bounding box, and in
+  // the original system too if the bounding box is requested
+  if (isAdaptive == true) {
+
+    int iCol =
+      ChooseElimVar3DTime(
+        Mp,
+        nbRowsPElim,
+        2);
+    if (iCol != 0) {
+
+      SwapCols3DTime(
+        Mp,
+        nbRowsP,
+        0,
+        iCol);
+      if (bdgBox != NULL) {
+
+        SwapCols3DTime(
+          M,
+          nbRows,
+          SND_VAR,
+          SND_VAR + iCol);
+
+      }
+
+      int axis = axes[SND_VAR];
+      axes[SND_VAR] = axes[SND_VAR + iCol];
+      axes[SND_VAR + iCol] = axis;
+
+    }
+
+  }
+
+  // Declare a variable to memorize the number of rows of the system
+  // after elimination of the second variable
   int nbRowsPP;
 
   // Eliminate the second variable (which is the first in the new system)
@@ -637,7 +1418,7 @@ bool FMBTestIntersection3DTime(
     ElimVar3DTime(
       Mp,
       Yp,
-      nbRowsP,
+      nbRowsPElim,
       3,
       Mpp,
       Ypp,
@@ -647,19 +1428,64 @@ bool FMBTestIntersection3DTime(
   if (inconsistency == true) {
 
     // The two Frames are not in intersection
+    FMB_ELIM_STATS_STAGE(
+      fmbElimStats3DTimeThread(),
+      thatType,
+      thoType,
+      FMBElimStagePass2);
     return false;
 
   }
 
-  // Declare variables to eliminate the third variable
-  // The size of the array given in the doc is a majoring value.
-  // Instead I use a smaller value which has proven to be sufficient
-  // during tests, validation and qualification, to avoid running
-  // into the heap limit and to optimize slightly the performance
-  //double Mppp[279840][4];
-  //double Yppp[279840];
-  double Mppp[560][4];
-  double Yppp[560];
+  // Record the size of the resulting system
+  FMB_ELIM_STATS_ROWS(
+    fmbElimStats3DTimeThread(),
+    thatType,
+    thoType,
+    1,
+    nbRowsPP);
+
+  // If the user requested it, prune the redundant rows before the
+  // next elimination
+  int nbRowsPPElim = nbRowsPP;
+  if (isPruning == true) {
+
+    PruneRows3DTime(
+      Mpp,
+      Ypp,
+      nbRowsPP,
+      2,
+      &nbRowsPPElim);
+
+  }
+
+  // If the system resulting from the elimination of the third
+  // variable is larger than the buffer sized for the pair of types,
+  // allocate a buffer large enough (cf FMB3DTIME_NB_ROWS_PPP_CC)
+  FMB_REAL (*MpppAlloc)[4] = NULL;
+  FMB_REAL* YpppAlloc = NULL;
+  int nbRowsPPPMaxElim =
+    GetNbRowsElim3DTime(
+      Mpp,
+      nbRowsPPElim);
+  if (nbRowsPPPMaxElim > nbRowsPPPMax) {
+
+    MpppAlloc = malloc(sizeof(FMB_REAL[4]) * nbRowsPPPMaxElim);
+    YpppAlloc = malloc(sizeof(FMB_REAL) * nbRowsPPPMaxElim);
+    if (MpppAlloc == NULL || YpppAlloc == NULL) {
+
+      printf("FMBTestIntersectionSolve3DTime: failed to allocate memory\n");
+      exit(0);
+
+    }
+
+    Mppp = MpppAlloc;
+    Yppp = YpppAlloc;
+
+  }
+
+  // Declare a variable to memorize the number of rows of the system
+  // after elimination of the third variable
   int nbRowsPPP;
 
   // Eliminate the third variable (which is the first in the new system)
@@ -667,7 +1493,7 @@ bool FMBTestIntersection3DTime(
     ElimVar3DTime(
       Mpp,
       Ypp,
-      nbRowsPP,
+      nbRowsPPElim,
       2,
       Mppp,
       Yppp,
@@ -677,10 +1503,25 @@ bool FMBTestIntersection3DTime(
   if (inconsistency == true) {
 
     // The two Frames are not in intersection
+    free(MpppAlloc);
+    free(YpppAlloc);
+    FMB_ELIM_STATS_STAGE(
+      fmbElimStats3DTimeThread(),
+      thatType,
+      thoType,
+      FMBElimStagePass3);
     return false;
 
   }
 
+  // Record the size of the resulting system
+  FMB_ELIM_STATS_ROWS(
+    fmbElimStats3DTimeThread(),
+    thatType,
+    thoType,
+    2,
+    nbRowsPPP);
+
   // Get the bounds for the remaining fourth variable
   GetBoundLastVar3DTime(
     FOR_VAR,
@@ -689,16 +1530,37 @@ bool FMBTestIntersection3DTime(
     nbRowsPPP,
     &bdgBoxLocal);
 
+  // The system resulting from the elimination of the third variable is
+  // not used anymore
+  free(MpppAlloc);
+  free(YpppAlloc);
+
   // If the bounds are inconsistent
   if (bdgBoxLocal.min[FOR_VAR] >= bdgBoxLocal.max[FOR_VAR]) {
 
     // The two Frames are not in intersection
+    FMB_ELIM_STATS_STAGE(
+      fmbElimStats3DTimeThread(),
+      thatType,
+      thoType,
+      FMBElimStageBound);
     return false;
 
+  }
+
   // Else, if the bounds are consistent here it means
   // the two Frames are in intersection.
+  // Time being the last variable, its bounds are the ones of the
+  // projection of the intersection on the time axis, the lower one is
+  // the time of first contact
+  if (tContact != NULL) {
+
+    *tContact = bdgBoxLocal.min[FOR_VAR];
+
+  }
+
   // If the user has requested for the resulting bounding box
-  } else if (bdgBox != NULL) {
+  if (bdgBox != NULL) {
 
     // Get the bounds of the other variables
     GetBoundVar3DTime(
@@ -725,12 +1587,1058 @@ bool FMBTestIntersection3DTime(
       4,
       &bdgBoxLocal);
 
-    // Memorize the result
-    *bdgBox = bdgBoxLocal;
+    // Memorize the result, remapped to the axes of the eliminated
+    // variables
+    for (
+      int iVar = 4;
+      iVar--;) {
+
+      bdgBox->min[axes[iVar]] = bdgBoxLocal.min[iVar];
+      bdgBox->max[axes[iVar]] = bdgBoxLocal.max[iVar];
+
+    }
 
   }
 
   // If we've reached here the two Frames are intersecting
+  FMB_ELIM_STATS_STAGE(
+    fmbElimStats3DTimeThread(),
+    thatType,
+    thoType,
+    FMBElimStageInter);
   return true;
 
 }
+
+// Test for intersection between a Cuboid that and the
+// Cuboid thoProj, projection of tho in that's coordinates system
+static bool FMBTestIntersectionProj3DTimeCCGeneric(
+  const Frame3DTime* const thoProj,
+  AABB3DTime* const bdgBox,
+  FMB_REAL* const tContact) {
+
+  // Declare the buffers of the system and its eliminations, sized for
+  // this pair of types
+  FMB_REAL M[FMB3DTIME_NB_ROWS_CC][4];
+  FMB_REAL Y[FMB3DTIME_NB_ROWS_CC];
+  FMB_REAL Mp[FMB3DTIME_NB_ROWS_P_CC][4];
+  FMB_REAL Yp[FMB3DTIME_NB_ROWS_P_CC];
+  FMB_REAL Mpp[FMB3DTIME_NB_ROWS_PP_CC][4];
+  FMB_REAL Ypp[FMB3DTIME_NB_ROWS_PP_CC];
+  FMB_REAL Mppp[FMB3DTIME_NB_ROWS_PPP_CC][4];
+  FMB_REAL Yppp[FMB3DTIME_NB_ROWS_PPP_CC];
+
+  // Solve the system
+  return
+    FMBTestIntersectionSolve3DTime(
+      FrameCuboid,
+      FrameCuboid,
+      thoProj,
+      bdgBox,
+      tContact,
+      M,
+      Y,
+      Mp,
+      Yp,
+      Mpp,
+      Ypp,
+      Mppp,
+      Yppp,
+      FMB3DTIME_NB_ROWS_PPP_CC);
+
+}
+
+// Test for intersection between a Cuboid that and the
+// Tetrahedron thoProj, projection of tho in that's coordinates system
+static bool FMBTestIntersectionProj3DTimeCTGeneric(
+  const Frame3DTime* const thoProj,
+  AABB3DTime* const bdgBox,
+  FMB_REAL* const tContact) {
+
+  // Declare the buffers of the system and its eliminations, sized for
+  // this pair of types
+  FMB_REAL M[FMB3DTIME_NB_ROWS_CT][4];
+  FMB_REAL Y[FMB3DTIME_NB_ROWS_CT];
+  FMB_REAL Mp[FMB3DTIME_NB_ROWS_P_CT][4];
+  FMB_REAL Yp[FMB3DTIME_NB_ROWS_P_CT];
+  FMB_REAL Mpp[FMB3DTIME_NB_ROWS_PP_CT][4];
+  FMB_REAL Ypp[FMB3DTIME_NB_ROWS_PP_CT];
+  FMB_REAL Mppp[FMB3DTIME_NB_ROWS_PPP_CT][4];
+  FMB_REAL Yppp[FMB3DTIME_NB_ROWS_PPP_CT];
+
+  // Solve the system
+  return
+    FMBTestIntersectionSolve3DTime(
+      FrameCuboid,
+      FrameTetrahedron,
+      thoProj,
+      bdgBox,
+      tContact,
+      M,
+      Y,
+      Mp,
+      Yp,
+      Mpp,
+      Ypp,
+      Mppp,
+      Yppp,
+      FMB3DTIME_NB_ROWS_PPP_CT);
+
+}
+
+// Test for intersection between a Tetrahedron that and the
+// Cuboid thoProj, projection of tho in that's coordinates system
+static bool FMBTestIntersectionProj3DTimeTCGeneric(
+  const Frame3DTime* const thoProj,
+  AABB3DTime* const bdgBox,
+  FMB_REAL* const tContact) {
+
+  // Declare the buffers of the system and its eliminations, sized for
+  // this pair of types
+  FMB_REAL M[FMB3DTIME_NB_ROWS_TC][4];
+  FMB_REAL Y[FMB3DTIME_NB_ROWS_TC];
+  FMB_REAL Mp[FMB3DTIME_NB_ROWS_P_TC][4];
+  FMB_REAL Yp[FMB3DTIME_NB_ROWS_P_TC];
+  FMB_REAL Mpp[FMB3DTIME_NB_ROWS_PP_TC][4];
+  FMB_REAL Ypp[FMB3DTIME_NB_ROWS_PP_TC];
+  FMB_REAL Mppp[FMB3DTIME_NB_ROWS_PPP_TC][4];
+  FMB_REAL Yppp[FMB3DTIME_NB_ROWS_PPP_TC];
+
+  // Solve the system
+  return
+    FMBTestIntersectionSolve3DTime(
+      FrameTetrahedron,
+      FrameCuboid,
+      thoProj,
+      bdgBox,
+      tContact,
+      M,
+      Y,
+      Mp,
+      Yp,
+      Mpp,
+      Ypp,
+      Mppp,
+      Yppp,
+      FMB3DTIME_NB_ROWS_PPP_TC);
+
+}
+
+// Test for intersection between a Tetrahedron that and the
+// Tetrahedron thoProj, projection of tho in that's coordinates system
+static bool FMBTestIntersectionProj3DTimeTTGeneric(
+  const Frame3DTime* const thoProj,
+  AABB3DTime* const bdgBox,
+  FMB_REAL* const tContact) {
+
+  // Declare the buffers of the system and its eliminations, sized for
+  // this pair of types
+  FMB_REAL M[FMB3DTIME_NB_ROWS_TT][4];
+  FMB_REAL Y[FMB3DTIME_NB_ROWS_TT];
+  FMB_REAL Mp[FMB3DTIME_NB_ROWS_P_TT][4];
+  FMB_REAL Yp[FMB3DTIME_NB_ROWS_P_TT];
+  FMB_REAL Mpp[FMB3DTIME_NB_ROWS_PP_TT][4];
+  FMB_REAL Ypp[FMB3DTIME_NB_ROWS_PP_TT];
+  FMB_REAL Mppp[FMB3DTIME_NB_ROWS_PPP_TT][4];
+  FMB_REAL Yppp[FMB3DTIME_NB_ROWS_PPP_TT];
+
+  // Solve the system
+  return
+    FMBTestIntersectionSolve3DTime(
+      FrameTetrahedron,
+      FrameTetrahedron,
+      thoProj,
+      bdgBox,
+      tContact,
+      M,
+      Y,
+      Mp,
+      Yp,
+      Mpp,
+      Ypp,
+      Mppp,
+      Yppp,
+      FMB3DTIME_NB_ROWS_PPP_TT);
+
+}
+
+// Test for intersection between a Frame of type thatType and the
+// Frame thoProj of type thoType, projection of tho in that's
+// coordinates system
+// (cf FMBTestIntersection3DTime)
+static inline bool FMBTestIntersectionProj3DTime(
+  const FrameType thatType,
+  const FrameType thoType,
+  const Frame3DTime* const thoProj,
+  AABB3DTime* const bdgBox) {
+
+  // Call the kernel for this pair of types
+  return
+    fmbKernels3DTime[FrameGetCPUPath()][thatType][thoType](
+      thoProj,
+      bdgBox,
+      NULL);
+
+}
+
+// Get the statistics of the elimination since the last reset
+// (cf frame.h)
+FMBElimStats FMBGetElimStats3DTime(void) {
+
+  FMBElimStats stats;
+  FrameStatsGet(
+    &fmbElimStats3DTime,
+    &stats);
+  return stats;
+
+}
+
+// Reset the statistics of the elimination
+void FMBResetElimStats3DTime(void) {
+
+  FrameStatsReset(&fmbElimStats3DTime);
+
+}
+
+// Test for intersection between Frame that and Frame tho
+// Return true if the two Frames are intersecting, else false
+// If the Frame are intersecting the AABB of the intersection
+// is stored into bdgBox, else bdgBox is not modified
+// If bdgBox is null, the result AABB is not memorized (to use if
+// unnecessary and want to speed up the algorithm)
+// The resulting AABB may be larger than the smallest possible AABB
+// The resulting AABB of FMBTestIntersection(A,B) may be different
+// of the resulting AABB of FMBTestIntersection(B,A)
+// The resulting AABB is given in tho's local coordinates system
+bool FMBTestIntersection3DTime(
+  const Frame3DTime* const that,
+  const Frame3DTime* const tho,
+  AABB3DTime* const bdgBox) {
+
+  // Get the projection of the Frame tho in Frame that coordinates
+  // system
+  Frame3DTime thoProj;
+  Frame3DTimeImportFrame(that, tho, &thoProj);
+
+  // Test for intersection with the projected Frame
+  return
+    FMBTestIntersectionProj3DTime(
+      that->type,
+      tho->type,
+      &thoProj,
+      bdgBox);
+
+}
+
+// Get the time of first contact between Frame that and Frame tho
+// Return true if the two Frames are intersecting and store the
+// earliest time in [0,1] at which they intersect into tContact, else
+// return false and tContact is not modified
+// Time being eliminated last, its bounds are exact and obtained
+// without the bounds of the spatial variables, hence it is cheaper
+// than FMBTestIntersection3DTime with a bounding box
+bool FMBTestFirstContact3DTime(
+  const Frame3DTime* const that,
+  const Frame3DTime* const tho,
+  FMB_REAL* const tContact) {
+
+  // Get the projection of the Frame tho in Frame that coordinates
+  // system
+  Frame3DTime thoProj;
+  Frame3DTimeImportFrame(that, tho, &thoProj);
+
+  // Test for intersection with the projected Frame and get the time
+  // of first contact
+  return
+    fmbKernels3DTime[FrameGetCPUPath()][that->type][tho->type](
+      &thoProj,
+      NULL,
+      tContact);
+
+}
+
+// Test for intersection between the Frame that and each of the nbTho
+// Frames in the array thos
+// The result for thos[i] is stored in the i-th bit of the bitset
+// isIntersecting, which must have at least FMBBitsetNbWords(nbTho)
+// words (cf frame.h)
+// If bdgBoxes is not null, the AABB of the intersection with thos[i]
+// is stored into bdgBoxes[i] if the Frames are intersecting, else
+// bdgBoxes[i] is not modified
+// The results are identical to FMBTestIntersection3DTime(that, thos + i,
+// bdgBoxes + i), but the Frames are projected by chunks sharing the
+// setup of that
+void FMBTestIntersection3DTimeBatch(
+  const Frame3DTime* const that,
+  const Frame3DTime* const thos,
+  const int nbTho,
+  unsigned long* const isIntersecting,
+  AABB3DTime* const bdgBoxes) {
+
+  // Reset the bitset
+  int nbWords = FMBBitsetNbWords(nbTho);
+  for (
+    int iWord = nbWords;
+    iWord--;) {
+
+    isIntersecting[iWord] = 0UL;
+
+  }
+
+  // Shortcut
+  const FrameType thatType = that->type;
+
+  // Declare a variable to memorize the projected Frames of the
+  // current chunk
+  Frame3DTime thosProj[FMB_BATCH_CHUNK];
+
+  // Loop on chunks of Frames
+  for (
+    int iStart = 0;
+    iStart < nbTho;
+    iStart += FMB_BATCH_CHUNK) {
+
+    // Get the number of Frames in this chunk
+    int nbChunk = nbTho - iStart;
+    if (nbChunk > FMB_BATCH_CHUNK) {
+
+      nbChunk = FMB_BATCH_CHUNK;
+
+    }
+
+    // Project the Frames of the chunk in that's coordinates system
+    Frame3DTimeImportFrames(
+      that,
+      thos + iStart,
+      nbChunk,
+      thosProj);
+
+    // Loop on the projected Frames
+    for (
+      int iChunk = 0;
+      iChunk < nbChunk;
+      ++iChunk) {
+
+      // Test the intersection
+      int iTho = iStart + iChunk;
+      bool isInter =
+        FMBTestIntersectionProj3DTime(
+          thatType,
+          thosProj[iChunk].type,
+          thosProj + iChunk,
+          (bdgBoxes != NULL ? bdgBoxes + iTho : NULL));
+
+      // Memorize the result
+      if (isInter == true) {
+
+        FMBBitsetSet(isIntersecting, iTho);
+
+      }
+
+    }
+
+  }
+
+}
+
+// Set the axes used as filters by the hybrid intersection test
+void FMBSetHybridAxes3DTime(const unsigned int axes) {
+
+  atomic_store_explicit(
+    &fmbHybridAxes3DTime,
+    axes,
+    memory_order_relaxed);
+
+}
+
+// Get the axes currently used as filters by the hybrid intersection
+// test
+unsigned int FMBGetHybridAxes3DTime(void) {
+
+  return
+    atomic_load_explicit(
+      &fmbHybridAxes3DTime,
+      memory_order_relaxed);
+
+}
+
+// Test for intersection between Frame that and Frame tho, checking
+// first the SAT axes selected by FMBSetHybridAxes3DTime
+bool FMBHybridTestIntersection3DTime(
+  const Frame3DTime* const that,
+  const Frame3DTime* const tho,
+  AABB3DTime* const bdgBox) {
+
+  // Get the filter axes, the test being the one of FMB if there is
+  // none
+  unsigned int axes =
+    atomic_load_explicit(
+      &fmbHybridAxes3DTime,
+      memory_order_relaxed);
+  if (axes == FMB_HYBRID_AXES_NONE) {
+
+    return
+      FMBTestIntersection3DTime(
+        that,
+        tho,
+        bdgBox);
+
+  }
+
+  // If one of the filter axes separates the Frames
+  bool isIntersection =
+    SATCheckFaces3DTime(
+      that,
+      tho,
+      axes);
+  if (isIntersection == false) {
+
+    // The Frames are not in intersection,
+    // terminate the test
+    return false;
+
+  }
+
+  // Else, confirm with FMB
+  return
+    FMBTestIntersection3DTime(
+      that,
+      tho,
+      bdgBox);
+
+}
+
+// Create a body of FrameType type for the continuous collision
+// detection, at rest at position orig with components comp
+FMBCCDBody3DTime FMBCCDBodyCreate3DTime(
+  const FrameType type,
+  const FMB_REAL orig[3],
+  const FMB_REAL comp[3][3]) {
+
+  // Create the new body
+  FMBCCDBody3DTime that;
+  FMB_REAL speed[3] = {0.0, 0.0, 0.0};
+  that.frame =
+    Frame3DTimeCreateStatic(
+      type,
+      orig,
+      speed,
+      comp);
+
+  // The current step ends at the initial pose
+  for (
+    int iAxis = 3;
+    iAxis--;) {
+
+    that.origEnd[iAxis] = orig[iAxis];
+
+    for (
+      int iComp = 3;
+      iComp--;) {
+
+      that.compEnd[iComp][iAxis] = comp[iComp][iAxis];
+
+    }
+
+  }
+
+  that.isRotating = false;
+
+  // Return the new body
+  return that;
+
+}
+
+// Advance the body that to the next step, ending at the pose
+// (orig, comp)
+void FMBCCDBodyStep3DTime(
+  FMBCCDBody3DTime* const that,
+  const FMB_REAL orig[3],
+  const FMB_REAL comp[3][3]) {
+
+  // Get the displacement of the origin during the new step
+  FMB_REAL speed[3];
+  for (
+    int iAxis = 3;
+    iAxis--;) {
+
+    speed[iAxis] = orig[iAxis] - that->origEnd[iAxis];
+
+  }
+
+  // Move the Frame to the end of the previous step. The inverse
+  // components are recomputed only if the components have changed
+  Frame3DTimeSetComp(
+    &(that->frame),
+    that->compEnd);
+  Frame3DTimeSetMotion(
+    &(that->frame),
+    that->origEnd,
+    speed);
+
+  // Memorize the end of the new step, and check if the components
+  // change during it
+  that->isRotating = false;
+  for (
+    int iAxis = 3;
+    iAxis--;) {
+
+    that->origEnd[iAxis] = orig[iAxis];
+
+    for (
+      int iComp = 3;
+      iComp--;) {
+
+      that->compEnd[iComp][iAxis] = comp[iComp][iAxis];
+      if (comp[iComp][iAxis] != that->frame.comp[iComp][iAxis]) {
+
+        that->isRotating = true;
+
+      }
+
+    }
+
+  }
+
+}
+
+// Set the tolerance of the continuous collision detection
+void FMBSetCCDTolerance3DTime(const FMB_REAL tolerance) {
+
+  fmbCCDTolerance3DTime = tolerance;
+
+}
+
+// Get the tolerance of the continuous collision detection
+FMB_REAL FMBGetCCDTolerance3DTime(void) {
+
+  return fmbCCDTolerance3DTime;
+
+}
+
+// Set the time tolerance of the continuous collision detection
+void FMBSetCCDTimeTolerance3DTime(const FMB_REAL tolerance) {
+
+  fmbCCDTimeTolerance3DTime = tolerance;
+
+}
+
+// Get the time tolerance of the continuous collision detection
+FMB_REAL FMBGetCCDTimeTolerance3DTime(void) {
+
+  return fmbCCDTimeTolerance3DTime;
+
+}
+
+// Set the maximum number of bisections of a step
+void FMBSetCCDMaxDepth3DTime(const int depth) {
+
+  fmbCCDMaxDepth3DTime = depth;
+
+}
+
+// Get the maximum number of bisections of a step
+int FMBGetCCDMaxDepth3DTime(void) {
+
+  return fmbCCDMaxDepth3DTime;
+
+}
+
+// Get the Frame frame containing the body that during the sub-step
+// [tStart, tEnd] of its current step, or if isInner is true the Frame
+// contained by the body during the whole sub-step, and the largest
+// distance dev along each axis between a point of the body and the
+// same point with the components of the middle of the sub-step
+// Return false if the body is too thin for the latter to exist, else
+// true
+static bool FMBCCDBodyGetSubStep3DTime(
+  const FMBCCDBody3DTime* const that,
+  const FMB_REAL tStart,
+  const FMB_REAL tEnd,
+  const bool isInner,
+  Frame3DTime* const frame,
+  FMB_REAL* const dev) {
+
+  // Shortcuts
+  const Frame3DTime* bodyFrame = &(that->frame);
+  FMB_REAL dt = tEnd - tStart;
+
+  // Get the origin at the beginning of the sub-step and the
+  // displacement during the sub-step
+  FMB_REAL orig[3];
+  FMB_REAL speed[3];
+  for (
+    int iAxis = 3;
+    iAxis--;) {
+
+    orig[iAxis] =
+      bodyFrame->orig[iAxis] + tStart * bodyFrame->speed[iAxis];
+    speed[iAxis] = dt * bodyFrame->speed[iAxis];
+
+  }
+
+  // If the body doesn't rotate
+  if (that->isRotating == false) {
+
+    // Move a copy of the Frame of the body, which keeps its inverse
+    // components
+    *frame = *bodyFrame;
+    Frame3DTimeSetMotion(
+      frame,
+      orig,
+      speed);
+    dev[0] = 0.0;
+    dev[1] = 0.0;
+    dev[2] = 0.0;
+
+    return true;
+
+  }
+
+  // Get the components in the middle of the sub-step, and the largest
+  // distance between a point of the body and the same point with these
+  // components, reached at the ends of the sub-step (the coordinates
+  // of the points in the Frame being in [0,1])
+  FMB_REAL tMid = 0.5 * (tStart + tEnd);
+  FMB_REAL comp[3][3];
+  for (
+    int iAxis = 3;
+    iAxis--;) {
+
+    dev[iAxis] = 0.0;
+
+    for (
+      int iComp = 3;
+      iComp--;) {
+
+      FMB_REAL delta =
+        that->compEnd[iComp][iAxis] - bodyFrame->comp[iComp][iAxis];
+      comp[iComp][iAxis] = bodyFrame->comp[iComp][iAxis] + tMid * delta;
+      dev[iAxis] += 0.5 * dt * fabs(delta);
+
+    }
+
+  }
+
+  // Get the cross products of the components, normals to the faces
+  FMB_REAL normals[3][3];
+  for (
+    int iComp = 3;
+    iComp--;) {
+
+    const FMB_REAL* u = comp[(iComp + 1) % 3];
+    const FMB_REAL* v = comp[(iComp + 2) % 3];
+    normals[iComp][0] = u[1] * v[2] - u[2] * v[1];
+    normals[iComp][1] = u[2] * v[0] - u[0] * v[2];
+    normals[iComp][2] = u[0] * v[1] - u[1] * v[0];
+
+  }
+
+  FMB_REAL det =
+    fabs(
+      comp[0][0] * normals[0][0] +
+      comp[0][1] * normals[0][1] +
+      comp[0][2] * normals[0][2]);
+
+  // Enlarge the Frame to contain the points at a distance less than
+  // dev along each axis of the Frame with these components, which
+  // then contains the body during the whole sub-step, or shrink it to
+  // the points farther than dev from its faces, which is then
+  // contained by the body during the whole sub-step (the faces of the
+  // body never cross these points while deviating from the ones of the
+  // Frame)
+  FMB_REAL side = (isInner == true ? -1.0 : 1.0);
+  if (bodyFrame->type == FrameCuboid) {
+
+    // Push each pair of opposite faces by the extent of the
+    // deviation along their normal, which is the ratio of the
+    // component crossing them given by the normal
+    FMB_REAL ratio[3];
+    for (
+      int iComp = 3;
+      iComp--;) {
+
+      ratio[iComp] =
+        side *
+        (dev[0] * fabs(normals[iComp][0]) +
+        dev[1] * fabs(normals[iComp][1]) +
+        dev[2] * fabs(normals[iComp][2])) / det;
+
+      // If the opposite faces cross, there is no inner Frame
+      if (1.0 + 2.0 * ratio[iComp] <= 0.0) {
+
+        return false;
+
+      }
+
+    }
+
+    for (
+      int iComp = 3;
+      iComp--;) {
+
+      for (
+        int iAxis = 3;
+        iAxis--;) {
+
+        orig[iAxis] -= ratio[iComp] * comp[iComp][iAxis];
+        comp[iComp][iAxis] *= 1.0 + 2.0 * ratio[iComp];
+
+      }
+
+    }
+
+  } else {
+
+    // Get the normal to the fourth face, and the areas (doubled) of
+    // the faces opposite to each vertex (comp[iComp] for the face
+    // normal to normals[iComp], the origin for the fourth face)
+    FMB_REAL u[3];
+    FMB_REAL v[3];
+    for (
+      int iAxis = 3;
+      iAxis--;) {
+
+      u[iAxis] = comp[1][iAxis] - comp[0][iAxis];
+      v[iAxis] = comp[2][iAxis] - comp[0][iAxis];
+
+    }
+
+    FMB_REAL normalOpp[3] = {
+      u[1] * v[2] - u[2] * v[1],
+      u[2] * v[0] - u[0] * v[2],
+      u[0] * v[1] - u[1] * v[0]};
+    FMB_REAL area[3];
+    for (
+      int iComp = 3;
+      iComp--;) {
+
+      area[iComp] =
+        sqrt(
+          normals[iComp][0] * normals[iComp][0] +
+          normals[iComp][1] * normals[iComp][1] +
+          normals[iComp][2] * normals[iComp][2]);
+
+    }
+
+    FMB_REAL areaOpp =
+      sqrt(
+        normalOpp[0] * normalOpp[0] +
+        normalOpp[1] * normalOpp[1] +
+        normalOpp[2] * normalOpp[2]);
+    FMB_REAL sumArea = area[0] + area[1] + area[2] + areaOpp;
+
+    // Get the largest extent of the deviation along the normals
+    FMB_REAL extent =
+      (dev[0] * fabs(normalOpp[0]) +
+      dev[1] * fabs(normalOpp[1]) +
+      dev[2] * fabs(normalOpp[2])) / areaOpp;
+    for (
+      int iComp = 3;
+      iComp--;) {
+
+      FMB_REAL extentFace =
+        (dev[0] * fabs(normals[iComp][0]) +
+        dev[1] * fabs(normals[iComp][1]) +
+        dev[2] * fabs(normals[iComp][2])) / area[iComp];
+      if (extent < extentFace) {
+
+        extent = extentFace;
+
+      }
+
+    }
+
+    // Push all the faces by this extent, by scaling the tetrahedron
+    // around the center of its inscribed sphere, whose radius is
+    // det / sumArea
+    FMB_REAL scale = 1.0 + side * extent * sumArea / det;
+
+    // If the faces cross, there is no inner Frame
+    if (scale <= 0.0) {
+
+      return false;
+
+    }
+    for (
+      int iAxis = 3;
+      iAxis--;) {
+
+      FMB_REAL center =
+        (area[0] * comp[0][iAxis] +
+        area[1] * comp[1][iAxis] +
+        area[2] * comp[2][iAxis]) / sumArea;
+      orig[iAxis] -= (scale - 1.0) * center;
+
+      for (
+        int iComp = 3;
+        iComp--;) {
+
+        comp[iComp][iAxis] *= scale;
+
+      }
+
+    }
+
+  }
+
+  // Create the Frame
+  *frame =
+    Frame3DTimeCreateStatic(
+      bodyFrame->type,
+      orig,
+      speed,
+      comp);
+
+  return true;
+
+}
+
+// Get the time of first contact between the bodies that and tho
+// during the sub-step [tStart, tEnd] of their current step, at depth
+// depth of the bisection
+static bool FMBCCDBisect3DTime(
+  const FMBCCDBody3DTime* const that,
+  const FMBCCDBody3DTime* const tho,
+  const FMB_REAL tStart,
+  const FMB_REAL tEnd,
+  const int depth,
+  FMB_REAL* const tContact) {
+
+  // Get the Frames containing the bodies during the sub-step
+  Frame3DTime thatFrame;
+  Frame3DTime thoFrame;
+  FMB_REAL thatDev[3];
+  FMB_REAL thoDev[3];
+  FMBCCDBodyGetSubStep3DTime(
+    that,
+    tStart,
+    tEnd,
+    false,
+    &thatFrame,
+    thatDev);
+  FMBCCDBodyGetSubStep3DTime(
+    tho,
+    tStart,
+    tEnd,
+    false,
+    &thoFrame,
+    thoDev);
+
+  // Loop on the axes
+  FMB_REAL dev = 0.0;
+  for (
+    int iAxis = 3;
+    iAxis--;) {
+
+    // If the bounding boxes of the Frames don't intersect
+    if (
+      thatFrame.bdgBox.max[iAxis] < thoFrame.bdgBox.min[iAxis] ||
+      thoFrame.bdgBox.max[iAxis] < thatFrame.bdgBox.min[iAxis]) {
+
+      // The bodies are not in contact during the sub-step
+      return false;
+
+    }
+
+    // Update the largest deviation
+    if (dev < thatDev[iAxis]) {
+
+      dev = thatDev[iAxis];
+
+    }
+
+    if (dev < thoDev[iAxis]) {
+
+      dev = thoDev[iAxis];
+
+    }
+
+  }
+
+  // Get the time of first contact of the Frames during the sub-step
+  // If there is none, the bodies are not in contact during the
+  // sub-step
+  FMB_REAL t;
+  bool isContact =
+    FMBTestFirstContact3DTime(
+      &thatFrame,
+      &thoFrame,
+      &t);
+  if (isContact == false) {
+
+    return false;
+
+  }
+
+  // If the sub-step can't be bisected anymore
+  if (depth >= fmbCCDMaxDepth3DTime) {
+
+    // The bodies are considered in contact at the time of first
+    // contact of the Frames
+    *tContact = tStart + (tEnd - tStart) * t;
+    return true;
+
+  }
+
+  // If the sub-step is shorter than the time tolerance
+  if (tEnd - tStart <= fmbCCDTimeTolerance3DTime) {
+
+    // The bodies are considered in contact at the time of first
+    // contact of the Frames if the Frames are close enough to the
+    // bodies, or if the Frames contained by the bodies during the
+    // sub-step come into contact, which proves the bodies come into
+    // contact before the end of the sub-step
+    // The deviation alone doesn't bound the error on the time: bodies
+    // approaching slowly may stay closer than the deviation during a
+    // long time before coming into contact
+    bool isContactInner = (dev <= fmbCCDTolerance3DTime);
+    if (isContactInner == false) {
+
+      Frame3DTime thatInner;
+      Frame3DTime thoInner;
+      FMB_REAL tInner;
+      isContactInner =
+        FMBCCDBodyGetSubStep3DTime(
+          that,
+          tStart,
+          tEnd,
+          true,
+          &thatInner,
+          thatDev) &&
+        FMBCCDBodyGetSubStep3DTime(
+          tho,
+          tStart,
+          tEnd,
+          true,
+          &thoInner,
+          thoDev) &&
+        FMBTestFirstContact3DTime(
+          &thatInner,
+          &thoInner,
+          &tInner);
+
+    }
+
+    if (isContactInner == true) {
+
+      *tContact = tStart + (tEnd - tStart) * t;
+      return true;
+
+    }
+
+  }
+
+  // Else, bisect the sub-step, searching first in the first half to get
+  // the earliest contact. The bodies being contained by the Frames, the
+  // first half can be skipped if the Frames come into contact after it
+  FMB_REAL tMid = 0.5 * (tStart + tEnd);
+  if (t < 0.5) {
+
+    isContact =
+      FMBCCDBisect3DTime(
+        that,
+        tho,
+        tStart,
+        tMid,
+        depth + 1,
+        tContact);
+    if (isContact == true) {
+
+      return true;
+
+    }
+
+  }
+
+  return
+    FMBCCDBisect3DTime(
+      that,
+      tho,
+      tMid,
+      tEnd,
+      depth + 1,
+      tContact);
+
+}
+
+// Get the time of first contact between the bodies that and tho during
+// their current step
+bool FMBCCDTestFirstContact3DTime(
+  const FMBCCDBody3DTime* const that,
+  const FMBCCDBody3DTime* const tho,
+  FMB_REAL* const tContact) {
+
+  // If none of the bodies rotates, their Frames move exactly as them
+  if (
+    that->isRotating == false &&
+    tho->isRotating == false) {
+
+    return
+      FMBTestFirstContact3DTime(
+        &(that->frame),
+        &(tho->frame),
+        tContact);
+
+  }
+
+  // Else, bisect the step
+  return
+    FMBCCDBisect3DTime(
+      that,
+      tho,
+      0.0,
+      1.0,
+      0,
+      tContact);
+
+}
+
+// Get the time of first contact during the current step of each of the
+// nbPair pairs of bodies pairs
+int FMBCCDTestPairs3DTime(
+  const FMBCCDBody3DTime* const bodies,
+  const FMBCCDPair* const pairs,
+  const int nbPair,
+  unsigned long* const isContact,
+  FMB_REAL* const tContacts) {
+
+  // Reset the bitset
+  int nbWords = FMBBitsetNbWords(nbPair);
+  for (
+    int iWord = nbWords;
+    iWord--;) {
+
+    isContact[iWord] = 0UL;
+
+  }
+
+  // Loop on the pairs
+  int nbContact = 0;
+  for (
+    int iPair = 0;
+    iPair < nbPair;
+    ++iPair) {
+
+    // If the bodies come into contact
+    bool isContactPair =
+      FMBCCDTestFirstContact3DTime(
+        bodies + pairs[iPair].iThat,
+        bodies + pairs[iPair].iTho,
+        tContacts + iPair);
+    if (isContactPair == true) {
+
+      // Memorize the result
+      FMBBitsetSet(
+        isContact,
+        iPair);
+      ++nbContact;
+
+    }
+
+  }
+
+  // Return the number of pairs in contact
+  return nbContact;
+
+}
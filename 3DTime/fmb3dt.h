@@ -23,8 +23,85 @@
 #include <stdbool.h>
 #include "frame.h"
 
+// ------------- Data structures -------------
+
+// Moving 3D Frame advanced step by step along a sequence of poses for
+// the continuous collision detection (cf FMBCCDBodyStep3DTime)
+// During a step the origin and the components move linearly from
+// their value at the beginning of the step to their value at its end
+typedef struct {
+
+  // Frame at the beginning of the current step, its speed being the
+  // displacement of the origin during the step
+  Frame3DTime frame;
+
+  // Origin and components at the end of the current step
+  FMB_REAL origEnd[3];
+  FMB_REAL compEnd[3][3];
+
+  // Flag to memorize if the components change during the step
+  bool isRotating;
+
+} FMBCCDBody3DTime;
+
+// Pair of bodies tested by FMBCCDTestPairs3DTime, given by their index
+// in the array of bodies
+typedef struct {
+
+  int iThat;
+  int iTho;
+
+} FMBCCDPair;
+
 // ------------- Functions declaration -------------
 
+// Set the use of the pruning of redundant rows between the
+// eliminations of variables in FMBTestIntersection3DTime and
+// FMBTestIntersection3DTimeBatch (rows identical to another one, rows
+// with the same coefficients as another one and a greater right side,
+// rows satisfied by any X in [0,1])
+// Not used by default, unless FMB3DTIME_PRUNING is defined at
+// compilation
+void FMBSetPruning3DTime(const bool isPruning);
+
+// Get the statistics of the pruning of redundant rows since the last
+// reset, added over all the threads (cf frame.h)
+// Each thread records its statistics separately, so the intersection
+// tests can run concurrently, but this function and
+// FMBResetPruneStats3DTime must not be called while another thread is
+// running one
+FMBPruneStats FMBGetPruneStats3DTime(void);
+
+// Reset the statistics of the pruning of redundant rows of all the
+// threads
+void FMBResetPruneStats3DTime(void);
+
+// Set the order of elimination of the spatial variables used by
+// FMBTestIntersection3DTime, FMBTestFirstContact3DTime and
+// FMBTestIntersection3DTimeBatch (cf frame.h), time being always
+// eliminated last
+// The default one is FMB3DTIME_ELIM_ORDER, FMBElimOrderFixed unless
+// defined otherwise at compilation (for example
+// -DFMB3DTIME_ELIM_ORDER=FMBElimOrderAdaptive)
+// It can be set while other threads are running the intersection
+// tests, each test using the order set when it starts
+void FMBSetElimOrder3DTime(const FMBElimOrder order);
+
+// Get the order of elimination of the spatial variables currently
+// used by the intersection tests
+FMBElimOrder FMBGetElimOrder3DTime(void);
+
+// Get the statistics of the Fourier-Motzkin elimination in
+// FMBTestIntersection3DTime since the last reset (cf frame.h), recorded
+// only if FMB_ELIM_STATS is defined at compilation and added over all
+// the threads, this function and FMBResetElimStats3DTime must not be
+// called while another thread is running FMBTestIntersection3DTime
+FMBElimStats FMBGetElimStats3DTime(void);
+
+// Reset the statistics of the Fourier-Motzkin elimination of all the
+// threads
+void FMBResetElimStats3DTime(void);
+
 // Test for intersection between Frame that and Frame tho
 // Return true if the two Frames are intersecting, else false
 // If the Frame are intersecting the AABB of the intersection
@@ -36,8 +113,180 @@
 // of the resulting AABB of FMBTestIntersection(B,A)
 // The resulting AABB is given in tho's local coordinates system
 bool FMBTestIntersection3DTime(
-  Frame3DTime* const that,
+  const Frame3DTime* const that,
   const Frame3DTime* const tho,
   AABB3DTime* const bdgBox);
 
+// Set the axes used as filters by FMBHybridTestIntersection3DTime, the
+// normals to the faces of the Frames selected by axes (cf
+// FMB_HYBRID_AXES_ALL in frame.h)
+// The default ones are FMB3DTIME_HYBRID_AXES, FMB_HYBRID_AXES_NONE
+// unless defined otherwise at compilation (for example
+// -DFMB3DTIME_HYBRID_AXES=FMB_HYBRID_AXES_THAT): the filter is opt-in
+// as it slows down the test on random pairs (cf
+// FMBHybridTestIntersection3DTime)
+void FMBSetHybridAxes3DTime(const unsigned int axes);
+
+// Get the axes currently used as filters by
+// FMBHybridTestIntersection3DTime
+unsigned int FMBGetHybridAxes3DTime(void);
+
+// Test for intersection between Frame that and Frame tho
+// Return true if the two Frames are intersecting, else false, and
+// store the AABB of the intersection into bdgBox, as
+// FMBTestIntersection3DTime
+// The normals to the faces selected by FMBSetHybridAxes3DTime are
+// checked first with SAT (cf SATCheckFaces3DTime), and
+// FMBTestIntersection3DTime is run only if none of them separates the
+// Frames
+// With no axes (the default) SAT is skipped and the test is
+// FMBTestIntersection3DTime
+// Cost: FMBTestIntersection3DTime rejects most of the non
+// intersecting pairs as fast as the filter, thus on random pairs (cf
+// QualifyHybrid3DTime) the hybrid test is about 1.15 times
+// FMBTestIntersection3DTime for non intersecting pairs and 1.13 times
+// for intersecting pairs with all the axes, the filter being worth
+// enabling only for pairs mostly separated by the normals of the
+// faces
+bool FMBHybridTestIntersection3DTime(
+  const Frame3DTime* const that,
+  const Frame3DTime* const tho,
+  AABB3DTime* const bdgBox);
+
+// Get the time of first contact between Frame that and Frame tho
+// Return true if the two Frames are intersecting and store the
+// earliest time in [0,1] at which they intersect into tContact, else
+// return false and tContact is not modified
+// The result is identical to bdgBox.min[3] after
+// FMBTestIntersection3DTime(that, tho, &bdgBox), but time being the
+// last eliminated variable, the bounds of the spatial variables are
+// not calculated, and the pruning (if used) is applied at each
+// elimination
+bool FMBTestFirstContact3DTime(
+  const Frame3DTime* const that,
+  const Frame3DTime* const tho,
+  FMB_REAL* const tContact);
+
+// Create a body of FrameType type for the continuous collision
+// detection, at rest at position orig with components comp
+// ([iComp][iAxis])
+FMBCCDBody3DTime FMBCCDBodyCreate3DTime(
+  const FrameType type,
+  const FMB_REAL orig[3],
+  const FMB_REAL comp[3][3]);
+
+// Advance the body that to the next step, which starts at the pose
+// ending the previous step and ends at the pose (orig, comp)
+// The Frame of the body is updated incrementally: its inverse
+// components are recomputed only if the components at the beginning
+// of the new step differ from the ones at the beginning of the
+// previous step, ie if the body rotated during the previous step
+void FMBCCDBodyStep3DTime(
+  FMBCCDBody3DTime* const that,
+  const FMB_REAL orig[3],
+  const FMB_REAL comp[3][3]);
+
+// Set the tolerance of the continuous collision detection of rotating
+// bodies (cf FMBCCDTestFirstContact3DTime), as a distance
+// The default one is FMB3DTIME_CCD_TOLERANCE, 1e-3 unless defined
+// otherwise at compilation
+void FMBSetCCDTolerance3DTime(const FMB_REAL tolerance);
+
+// Get the tolerance of the continuous collision detection
+FMB_REAL FMBGetCCDTolerance3DTime(void);
+
+// Set the time tolerance of the continuous collision detection of
+// rotating bodies (cf FMBCCDTestFirstContact3DTime), as a fraction of
+// the step
+// The default one is FMB3DTIME_CCD_TIME_TOLERANCE, 1/64 unless defined
+// otherwise at compilation
+void FMBSetCCDTimeTolerance3DTime(const FMB_REAL tolerance);
+
+// Get the time tolerance of the continuous collision detection
+FMB_REAL FMBGetCCDTimeTolerance3DTime(void);
+
+// Set the maximum number of bisections of a step in the continuous
+// collision detection of rotating bodies (cf
+// FMBCCDTestFirstContact3DTime)
+// The default one is FMB3DTIME_CCD_MAX_DEPTH, 16 unless defined
+// otherwise at compilation
+void FMBSetCCDMaxDepth3DTime(const int depth);
+
+// Get the maximum number of bisections of a step
+int FMBGetCCDMaxDepth3DTime(void);
+
+// Get the time of first contact between the bodies that and tho during
+// their current step
+// Return true if the two bodies come into contact and store the
+// earliest time in [0,1] of the step at which they intersect into
+// tContact, else return false and tContact is not modified
+// If none of the bodies rotates during the step, the result is the one
+// of FMBTestFirstContact3DTime on their Frames. Else the step is
+// bisected, each sub-step being tested with FMBTestFirstContact3DTime
+// on Frames with the components of the middle of the sub-step,
+// enlarged to contain the bodies during the whole sub-step. The
+// sub-steps where these Frames are not in contact are skipped, the
+// other ones are bisected, searching the earliest contact first, until
+// the sub-step is shorter than the time tolerance (cf
+// FMBSetCCDTimeTolerance3DTime) and either the components vary by less
+// than the tolerance (cf FMBSetCCDTolerance3DTime) within the sub-step
+// or the same Frames shrunk to be contained by the bodies during the
+// whole sub-step come into contact, or until the maximum depth is
+// reached (cf FMBSetCCDMaxDepth3DTime)
+// The result is conservative: a contact is never missed, and the time
+// of first contact is never later than the exact one. It is earlier by
+// at most the time tolerance, unless the bodies come closer than the
+// tolerance before coming into contact (or never come into contact),
+// or the maximum depth is reached, the bodies being then reported in
+// contact as soon as they are closer than the deviation of their
+// components during the last sub-step. The time error is not bounded
+// by the distance: bodies approaching slowly may stay close during a
+// long time before coming into contact
+// The points of the bodies moving linearly during a step, a rotation
+// is approximated by its chord, the body shrinking slightly in the
+// middle of the step, so the steps must be small enough for this to
+// be negligible
+// Cost: on random rotating pairs (cf QualifyCCD3DTime) about 7 times
+// FMBTestFirstContact3DTime, the enlarged Frames coming into contact
+// more often and the contacts being bisected down to the time
+// tolerance
+bool FMBCCDTestFirstContact3DTime(
+  const FMBCCDBody3DTime* const that,
+  const FMBCCDBody3DTime* const tho,
+  FMB_REAL* const tContact);
+
+// Get the time of first contact during the current step of each of the
+// nbPair pairs of bodies pairs, indices in the array of bodies bodies
+// The result for pairs[i] is stored in the i-th bit of the bitset
+// isContact, which must have at least FMBBitsetNbWords(nbPair) words
+// (cf frame.h), and its time of first contact into tContacts[i] if the
+// bodies come into contact, else tContacts[i] is not modified
+// Return the number of pairs of bodies coming into contact
+// The results are identical to FMBCCDTestFirstContact3DTime on each
+// pair
+int FMBCCDTestPairs3DTime(
+  const FMBCCDBody3DTime* const bodies,
+  const FMBCCDPair* const pairs,
+  const int nbPair,
+  unsigned long* const isContact,
+  FMB_REAL* const tContacts);
+
+// Test for intersection between the Frame that and each of the nbTho
+// Frames in the array thos
+// The result for thos[i] is stored in the i-th bit of the bitset
+// isIntersecting, which must have at least FMBBitsetNbWords(nbTho)
+// words (cf frame.h)
+// If bdgBoxes is not null, the AABB of the intersection with thos[i]
+// is stored into bdgBoxes[i] if the Frames are intersecting, else
+// bdgBoxes[i] is not modified
+// The results are identical to FMBTestIntersection3DTime(that, thos + i,
+// bdgBoxes + i), but the Frames are projected by chunks sharing the
+// setup of that
+void FMBTestIntersection3DTimeBatch(
+  const Frame3DTime* const that,
+  const Frame3DTime* const thos,
+  const int nbTho,
+  unsigned long* const isIntersecting,
+  AABB3DTime* const bdgBoxes);
+
 #endif
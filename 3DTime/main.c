@@ -29,9 +29,9 @@
 int main(int argc, char** argv) {
 
   // Create the two objects to be tested for intersection
-  double origP3DTime[3] = {0.0, 0.0, 0.0};
-  double speedP3DTime[3] = {0.0, 0.0, 0.0};
-  double compP3DTime[3][3] = {
+  FMB_REAL origP3DTime[3] = {0.0, 0.0, 0.0};
+  FMB_REAL speedP3DTime[3] = {0.0, 0.0, 0.0};
+  FMB_REAL compP3DTime[3][3] = {
 
     {1.0, 0.0, 0.0},  // First component
     {0.0, 1.0, 0.0},  // Second component
@@ -45,9 +45,9 @@ int main(int argc, char** argv) {
       speedP3DTime,
       compP3DTime);
 
-  double origQ3DTime[3] = {0.0, 0.0, 0.0};
-  double speedQ3DTime[3] = {0.0, 0.0, 0.0};
-  double compQ3DTime[3][3] =
+  FMB_REAL origQ3DTime[3] = {0.0, 0.0, 0.0};
+  FMB_REAL speedQ3DTime[3] = {0.0, 0.0, 0.0};
+  FMB_REAL compQ3DTime[3][3] =
     {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
   Frame3DTime Q3DTime =
     Frame3DTimeCreateStatic(
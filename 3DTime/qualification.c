@@ -21,13 +21,17 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdbool.h>
+#include <math.h>
+#include <string.h>
 #include <time.h>
-#include <sys/time.h>
 
 // Include FMB and SAT algorithm library
 #include "fmb3dt.h"
 #include "sat.h"
 
+// Include the benchmark harness
+#include "bench.h"
+
 // Epsilon to detect degenerated triangles
 #define EPSILON 0.1
 
@@ -40,9 +44,14 @@
 // Nb of tests per run
 #define NB_TESTS 500000
 
-// Nb of times the test is run on one pair of frame, used to
-// slow down the processus and be able to measure time
-#define NB_REPEAT_3D 800
+// Nb of Frames in the set used to qualify the batch test
+#define NB_FRAMES_BATCH 1000
+
+// Nb of steps, largest displacement and rotation of the bodies during
+// a step in the qualification of the continuous collision detection
+#define NB_CCD_STEPS 16
+#define CCD_MAX_MOVE 10.0
+#define CCD_MAX_ANGLE 0.05
 
 // Helper macro to generate random number in [0.0, 1.0]
 #define rnd() (double)(rand())/(double)(RAND_MAX)
@@ -51,58 +60,54 @@
 typedef struct {
 
   FrameType type;
-  double orig[3];
-  double comp[3][3];
-  double speed[3];
+  FMB_REAL orig[3];
+  FMB_REAL comp[3][3];
+  FMB_REAL speed[3];
 
 } Param3DTime;
 
-// Global variables to count nb of tests resulting in intersection
-// and no intersection, and min/max/total time of execution for each
-double minInter;
-double maxInter;
-double sumInter;
-unsigned long countInter;
-double minNoInter;
-double maxNoInter;
-double sumNoInter;
-unsigned long countNoInter;
-
-double minInterCC;
-double maxInterCC;
-double sumInterCC;
-unsigned long countInterCC;
-double minNoInterCC;
-double maxNoInterCC;
-double sumNoInterCC;
-unsigned long countNoInterCC;
-
-double minInterCT;
-double maxInterCT;
-double sumInterCT;
-unsigned long countInterCT;
-double minNoInterCT;
-double maxNoInterCT;
-double sumNoInterCT;
-unsigned long countNoInterCT;
-
-double minInterTC;
-double maxInterTC;
-double sumInterTC;
-unsigned long countInterTC;
-double minNoInterTC;
-double maxNoInterTC;
-double sumNoInterTC;
-unsigned long countNoInterTC;
-
-double minInterTT;
-double maxInterTT;
-double sumInterTT;
-unsigned long countInterTT;
-double minNoInterTT;
-double maxNoInterTT;
-double sumNoInterTT;
-unsigned long countNoInterTT;
+// Global variables to memorize the distributions of the ratio of
+// execution time FMB/SAT, [iCase][iInter], iCase being 0 for all the
+// pairs and 1 + 2 * typeThat + typeTho for each pair of types, iInter
+// being 0 for the pairs in intersection and 1 for the others
+BenchDist* ratios[5][2];
+
+// Wrappers of the intersection tests with the signature expected by
+// the benchmark harness
+bool QualifTestFMB(
+  const void* const that,
+  const void* const tho) {
+
+  return
+    FMBTestIntersection3DTime(
+      that,
+      tho,
+      NULL);
+
+}
+
+bool QualifTestSAT(
+  const void* const that,
+  const void* const tho) {
+
+  return
+    SATTestIntersection3DTime(
+      that,
+      tho);
+
+}
+
+bool QualifTestHybrid(
+  const void* const that,
+  const void* const tho) {
+
+  return
+    FMBHybridTestIntersection3DTime(
+      that,
+      tho,
+      NULL);
+
+}
 
 // Qualification function
 // Takes two Frame definition as input, run the intersection test on
@@ -130,738 +135,1265 @@ void Qualification3DDynamic(
   Frame3DTime* that = &P;
   Frame3DTime* tho = &Q;
 
+  // Configuration of the measurements, the time of each test being
+  // the median over repeated samples after warmup
+  BenchConfig config = BenchConfigDefault();
+
   // Loop on pairs of Frames
   for (
     int iPair = 2;
     iPair--;) {
 
-    // Declare an array to memorize the results of the repeated
-    // test on the same pair,
-    // to prevent optimization from the compiler to remove the for loop
-    bool isIntersectingFMB[NB_REPEAT_3D] = {false};
+    // Measure the FMB and SAT intersection tests on the pair
+    BenchStats statsFMB;
+    bool isIntersectingFMB =
+      BenchMeasurePair(
+        &config,
+        QualifTestFMB,
+        that,
+        tho,
+        &statsFMB);
+    BenchStats statsSAT;
+    bool isIntersectingSAT =
+      BenchMeasurePair(
+        &config,
+        QualifTestSAT,
+        that,
+        tho,
+        &statsSAT);
+
+    // If FMB and SAT disagrees
+    if (isIntersectingFMB != isIntersectingSAT) {
+
+      printf("Qualification has failed\n");
+      Frame3DTimePrint(that);
+      printf(" against ");
+      Frame3DTimePrint(tho);
+      printf("\n");
+      printf("FMB : ");
+      if (isIntersectingFMB == false) printf("no ");
+      printf("intersection\n");
+      printf("SAT : ");
+      if (isIntersectingSAT == false) printf("no ");
+      printf("intersection\n");
+
+      // Stop the qualification test
+      exit(0);
 
-    // Start measuring time
-    struct timeval start;
-    gettimeofday(&start, NULL);
+    }
+
+    // Get the ratio of execution time
+    double ratio = statsFMB.median / statsSAT.median;
+
+    // Update the distributions for all the pairs and for the pair of
+    // types
+    int iInter = (isIntersectingSAT == true ? 0 : 1);
+    BenchDistAdd(
+      ratios[0][iInter],
+      ratio);
+    BenchDistAdd(
+      ratios[1 + 2 * paramP.type + paramQ.type][iInter],
+      ratio);
+
+    // Flip the pair of Frames
+    that = &Q;
+    tho = &P;
+
+  }
+
+}
+
+void Qualify3DDynamic(void) {
+
+  // Initialise the random generator
+  srandom(time(NULL));
+
+  // Open the files to save the results
+  FILE* fp = fopen("../Results/qualification3DTime.txt", "w");
+  FILE* fpCC = fopen("../Results/qualification3DTimeCC.txt", "w");
+  FILE* fpCT = fopen("../Results/qualification3DTimeCT.txt", "w");
+  FILE* fpTC = fopen("../Results/qualification3DTimeTC.txt", "w");
+  FILE* fpTT = fopen("../Results/qualification3DTimeTT.txt", "w");
+
+  // Create the distributions
+  for (
+    int iCase = 5;
+    iCase--;) {
 
-    // Run the FMB intersection test
     for (
-      int i = NB_REPEAT_3D;
-      i--;) {
+      int iInter = 2;
+      iInter--;) {
 
-      isIntersectingFMB[i] =
-        FMBTestIntersection3DTime(
-          that,
-          tho,
-          NULL);
+      ratios[iCase][iInter] = BenchDistCreate();
 
     }
 
-    // Stop measuring time
-    struct timeval stop;
-    gettimeofday(&stop, NULL);
+  }
 
-    // Calculate the delay of execution
-    unsigned long deltausFMB = 0;
-    if (stop.tv_sec < start.tv_sec) {
+  // Loop on runs
+  for (
+    int iRun = 0;
+    iRun < NB_RUNS;
+    ++iRun) {
 
-      printf("time warps, try again\n");
-      exit(0);
+    // Ratio intersection/no intersection for the displayed results
+    double ratioInter = 0.1 + 0.8 * (double)iRun / (double)(NB_RUNS - 1);
+
+    // Reset the distributions
+    for (
+      int iCase = 5;
+      iCase--;) {
+
+      for (
+        int iInter = 2;
+        iInter--;) {
+
+        BenchDistReset(ratios[iCase][iInter]);
+
+      }
 
     }
 
-    if (stop.tv_sec > start.tv_sec + 1) {
+    // Declare two variables to memorize the arguments to the
+    // Qualification function
+    Param3DTime paramP;
+    Param3DTime paramQ;
 
-      printf("deltausFMB >> 1s, decrease NB_REPEAT\n");
-      exit(0);
+    // Loop on the number of tests
+    for (
+      unsigned long iTest = NB_TESTS;
+      iTest--;) {
+
+      // Create two random Frame definitions
+      Param3DTime* param = &paramP;
+      for (
+        int iParam = 2;
+        iParam--;) {
+
+        // 50% chance of being a Cuboid or a Tetrahedron
+        if (rnd() < 0.5) {
+
+          param->type = FrameCuboid;
+
+        } else {
+
+          param->type = FrameTetrahedron;
+
+        }
+
+        for (
+          int iAxis = 3;
+          iAxis--;) {
+
+          param->orig[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+          param->speed[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+
+          for (
+            int iComp = 3;
+            iComp--;) {
+
+            param->comp[iComp][iAxis] =
+              -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+
+          }
+
+        }
+
+        param = &paramQ;
+
+      }
+
+      // Calculate the determinant of the Frames' components matrix
+      double detP =
+        paramP.comp[0][0] * (paramP.comp[1][1] * paramP.comp[2][2] -
+        paramP.comp[1][2] * paramP.comp[2][1]) -
+        paramP.comp[1][0] * (paramP.comp[0][1] * paramP.comp[2][2] -
+        paramP.comp[0][2] * paramP.comp[2][1]) +
+        paramP.comp[2][0] * (paramP.comp[0][1] * paramP.comp[1][2] -
+        paramP.comp[0][2] * paramP.comp[1][1]);
+
+      double detQ =
+        paramQ.comp[0][0] * (paramQ.comp[1][1] * paramQ.comp[2][2] -
+        paramQ.comp[1][2] * paramQ.comp[2][1]) -
+        paramQ.comp[1][0] * (paramQ.comp[0][1] * paramQ.comp[2][2] -
+        paramQ.comp[0][2] * paramQ.comp[2][1]) +
+        paramQ.comp[2][0] * (paramQ.comp[0][1] * paramQ.comp[1][2] -
+        paramQ.comp[0][2] * paramQ.comp[1][1]);
+
+      // If the determinants are not null, ie the Frame are not degenerate
+      if (fabs(detP) > EPSILON && fabs(detQ) > EPSILON) {
+
+        // Run the validation on the two Frames
+        Qualification3DDynamic(
+          paramP,
+          paramQ);
+
+      }
 
     }
 
-    if (stop.tv_usec < start.tv_usec) {
+    // Save the results
+    FILE* fps[5] = {fp, fpCC, fpCT, fpTC, fpTT};
+    const char* suffixes[5] = {"To", "CC", "CT", "TC", "TT"};
+    for (
+      int iCase = 0;
+      iCase < 5;
+      ++iCase) {
+
+      if (iRun == 0) {
 
-      deltausFMB = stop.tv_sec - start.tv_sec;
-      deltausFMB += stop.tv_usec + 1000000 - start.tv_usec;
+        BenchPrintQualifHeader(
+          fps[iCase],
+          suffixes[iCase]);
 
-    } else {
+      }
 
-      deltausFMB = stop.tv_usec - start.tv_usec;
+      BenchPrintQualif(
+        fps[iCase],
+        ratioInter,
+        ratios[iCase][0],
+        ratios[iCase][1]);
 
     }
 
-    // Declare an array to memorize the results of the repeated
-    // test on the same pair,
-    // to prevent optimization from the compiler to remove the for loop
-    bool isIntersectingSAT[NB_REPEAT_3D] = {false};
+  }
 
-    // Start measuring time
-    gettimeofday(&start, NULL);
+  // Close the files
+  fclose(fp);
+  fclose(fpCC);
+  fclose(fpCT);
+  fclose(fpTC);
+  fclose(fpTT);
+
+  // Free the distributions
+  for (
+    int iCase = 5;
+    iCase--;) {
 
-    // Run the FMB intersection test
     for (
-      int i = NB_REPEAT_3D;
-      i--;) {
+      int iInter = 2;
+      iInter--;) {
 
-      isIntersectingSAT[i] =
-        SATTestIntersection3DTime(
-          that,
-          tho);
+      BenchDistFree(ratios[iCase] + iInter);
 
     }
 
-    // Stop measuring time
-    gettimeofday(&stop, NULL);
+  }
 
-    // Calculate the delay of execution
-    unsigned long deltausSAT = 0;
-    if (stop.tv_sec < start.tv_sec) {
+}
 
-      printf("time warps, try again\n");
-      exit(0);
+// Qualification of the batch intersection test against the single
+// pair one. Measure the time per pair to test one Frame against a set
+// of NB_FRAMES_BATCH Frames, first by calling FMBTestIntersection3DTime
+// on each pair, second by calling FMBTestIntersection3DTimeBatch once
+// Results are printed and saved in ../Results/qualification3DTimeBatch.txt
+void QualifyBatch3DTime(void) {
+
+  // Open the file to save the results
+  FILE* fp = fopen("../Results/qualification3DTimeBatch.txt", "w");
+  fprintf(fp, "run\tscalar\tbatch\n");
+
+  // Create the set of random non degenerated Frames
+  Frame3DTime* frames = malloc(sizeof(Frame3DTime) * NB_FRAMES_BATCH);
+  for (
+    int iFrame = NB_FRAMES_BATCH;
+    iFrame--;) {
+
+    bool isDegenerated = true;
+    while (isDegenerated == true) {
+
+      FrameType type = (rnd() < 0.5 ? FrameCuboid : FrameTetrahedron);
+      FMB_REAL orig[3];
+      FMB_REAL speed[3];
+      FMB_REAL comp[3][3];
+      for (
+        int iAxis = 3;
+        iAxis--;) {
+
+        orig[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+        speed[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+
+        for (
+          int iComp = 3;
+          iComp--;) {
+
+          comp[iComp][iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+
+        }
+
+      }
+
+      double det =
+        comp[0][0] * (comp[1][1] * comp[2][2] -
+        comp[1][2] * comp[2][1]) -
+        comp[1][0] * (comp[0][1] * comp[2][2] -
+        comp[0][2] * comp[2][1]) +
+        comp[2][0] * (comp[0][1] * comp[1][2] -
+        comp[0][2] * comp[1][1]);
+      if (fabs(det) > EPSILON) {
+
+        frames[iFrame] =
+          Frame3DTimeCreateStatic(
+            type,
+            orig,
+          speed,
+            comp);
+        isDegenerated = false;
+
+      }
 
     }
 
-    if (stop.tv_sec > start.tv_sec + 1) {
+  }
 
-      printf("deltausSAT >> 1s, decrease NB_REPEAT\n");
-      exit(0);
+  // Allocate memory for the results
+  bool* isIntersectingScalar = malloc(sizeof(bool) * NB_FRAMES_BATCH);
+  unsigned long* isIntersectingBatch =
+    malloc(sizeof(unsigned long) * FMBBitsetNbWords(NB_FRAMES_BATCH));
+
+  // Declare variables to sum the time per pair over all the runs
+  double sumScalar = 0.0;
+  double sumBatch = 0.0;
+
+  // Loop on runs
+  for (
+    int iRun = 0;
+    iRun < NB_RUNS;
+    ++iRun) {
+
+    // Start measuring time
+    double start = BenchGetNs();
+
+    // Run the single pair intersection test on all the pairs
+    for (
+      int iThat = NB_FRAMES_BATCH;
+      iThat--;) {
+
+      for (
+        int iTho = NB_FRAMES_BATCH;
+        iTho--;) {
+
+        isIntersectingScalar[iTho] =
+          FMBTestIntersection3DTime(
+            frames + iThat,
+            frames + iTho,
+            NULL);
+
+      }
 
     }
 
-    if (stop.tv_usec < start.tv_usec) {
+    // Calculate the delay of execution
+    double deltansScalar = BenchGetNs() - start;
 
-      deltausSAT = stop.tv_sec - start.tv_sec;
-      deltausSAT += stop.tv_usec + 1000000 - start.tv_usec;
+    // Start measuring time
+    start = BenchGetNs();
 
-    } else {
+    // Run the batch intersection test on all the pairs
+    for (
+      int iThat = NB_FRAMES_BATCH;
+      iThat--;) {
 
-      deltausSAT = stop.tv_usec - start.tv_usec;
+      FMBTestIntersection3DTimeBatch(
+        frames + iThat,
+        frames,
+        NB_FRAMES_BATCH,
+        isIntersectingBatch,
+        NULL);
 
     }
 
-    // If the delays are greater than 10ms
-    if (deltausFMB >= 10 && deltausSAT >= 10) {
-
-      // If FMB and SAT disagrees
-      if (isIntersectingFMB[0] != isIntersectingSAT[0]) {
-
-        printf("Qualification has failed\n");
-        Frame3DTimePrint(that);
-        printf(" against ");
-        Frame3DTimePrint(tho);
-        printf("\n");
-        printf("FMB : ");
-        if (isIntersectingFMB[0] == false) printf("no ");
-        printf("intersection\n");
-        printf("SAT : ");
-        if (isIntersectingSAT[0] == false) printf("no ");
-        printf("intersection\n");
-
-        // Stop the qualification test
-        exit(0);
+    // Calculate the delay of execution
+    double deltansBatch = BenchGetNs() - start;
 
-      }
+    // Check the results of the last tested Frame against the
+    // set are the same, also prevents the compiler from optimizing
+    // away the loops
+    for (
+      int iTho = NB_FRAMES_BATCH;
+      iTho--;) {
 
-      // Get the ratio of execution time
-      double ratio = ((double)deltausFMB) / ((double)deltausSAT);
+      bool isInterBatch =
+        (FMBBitsetGet(isIntersectingBatch, iTho) == 1UL);
+      if (isIntersectingScalar[iTho] != isInterBatch) {
 
-      // If the Frames intersect
-      if (isIntersectingSAT[0] == true) {
+        printf("Scalar and batch tests disagree\n");
+        exit(0);
 
-        // Update the counters
-        if (countInter == 0) {
+      }
 
-          minInter = ratio;
-          maxInter = ratio;
+    }
 
-        } else {
+    // Convert the delays to nanoseconds per pair
+    double nsScalar =
+      deltansScalar /
+      ((double)NB_FRAMES_BATCH * (double)NB_FRAMES_BATCH);
+    double nsBatch =
+      deltansBatch /
+      ((double)NB_FRAMES_BATCH * (double)NB_FRAMES_BATCH);
+    sumScalar += nsScalar;
+    sumBatch += nsBatch;
+
+    // Print and save the results of the run
+    printf("run %d: scalar %fns/pair, batch %fns/pair\n",
+      iRun, nsScalar, nsBatch);
+    fprintf(fp, "%d\t%f\t%f\n", iRun, nsScalar, nsBatch);
 
-          if (minInter > ratio) minInter = ratio;
-          if (maxInter < ratio) maxInter = ratio;
+  }
 
-        }
+  // Print the average results
+  printf("Average per pair: scalar %fns, batch %fns (ratio %f)\n",
+    sumScalar / (double)NB_RUNS,
+    sumBatch / (double)NB_RUNS,
+    sumBatch / sumScalar);
 
-        sumInter += ratio;
-        ++countInter;
+  // Free memory and close the file
+  free(frames);
+  free(isIntersectingScalar);
+  free(isIntersectingBatch);
+  fclose(fp);
 
-        if (
-          paramP.type == FrameCuboid &&
-          paramQ.type == FrameCuboid) {
+}
 
-          if (countInterCC == 0) {
+// Qualification of the pruning of redundant rows between eliminations
+// For random pairs of Frames, measure the median time of
+// the intersection test (without bounding box) without and with pruning
+// and average the time per test for each pair of types (CC, CT, TC,
+// TT)
+// Results are printed and saved in ../Results/qualification3DTimePrune.txt
+void QualifyPrune3DTime(void) {
 
-            minInterCC = ratio;
-            maxInterCC = ratio;
+  // Initialise the random generator
+  srandom(time(NULL));
 
-          } else {
+  // Declare variables to sum the time per test (in ns) for each
+  // pair of types, [iTypeThat][iTypeTho]
+  double sumNoPrune[2][2] = {{0.0, 0.0}, {0.0, 0.0}};
+  double sumPrune[2][2] = {{0.0, 0.0}, {0.0, 0.0}};
+  unsigned long count[2][2] = {{0, 0}, {0, 0}};
 
-            if (minInterCC > ratio) minInterCC = ratio;
-            if (maxInterCC < ratio) maxInterCC = ratio;
+  // Configuration of the measurements, and result of the last test
+  BenchConfig config = BenchConfigDefault();
+  bool isIntersecting = false;
 
-          }
+  // Reset the statistics of the pruning
+  FMBResetPruneStats3DTime();
 
-          sumInterCC += ratio;
-          ++countInterCC;
+  // Loop on tests
+  for (
+    unsigned long iTest = NB_FRAMES_BATCH * NB_RUNS;
+    iTest--;) {
 
-        } else if (
-          paramP.type == FrameCuboid &&
-          paramQ.type == FrameTetrahedron) {
+    // Create two random non degenerated Frames
+    Frame3DTime frames[2];
+    for (
+      int iFrame = 2;
+      iFrame--;) {
+
+      bool isDegenerated = true;
+      while (isDegenerated == true) {
 
-          if (countInterCT == 0) {
+        FrameType type = (rnd() < 0.5 ? FrameCuboid : FrameTetrahedron);
+        FMB_REAL orig[3];
+        FMB_REAL speed[3];
+        FMB_REAL comp[3][3];
+        for (
+          int iAxis = 3;
+          iAxis--;) {
 
-            minInterCT = ratio;
-            maxInterCT = ratio;
+          orig[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+          speed[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
 
-          } else {
+          for (
+            int iComp = 3;
+            iComp--;) {
 
-            if (minInterCT > ratio) minInterCT = ratio;
-            if (maxInterCT < ratio) maxInterCT = ratio;
+            comp[iComp][iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
 
           }
 
-          sumInterCT += ratio;
-          ++countInterCT;
+        }
 
-        } else if (
-          paramP.type == FrameTetrahedron &&
-          paramQ.type == FrameCuboid) {
+        double det =
+          comp[0][0] * (comp[1][1] * comp[2][2] -
+          comp[1][2] * comp[2][1]) -
+          comp[1][0] * (comp[0][1] * comp[2][2] -
+          comp[0][2] * comp[2][1]) +
+          comp[2][0] * (comp[0][1] * comp[1][2] -
+          comp[0][2] * comp[1][1]);
+        if (fabs(det) > EPSILON) {
+
+          frames[iFrame] =
+            Frame3DTimeCreateStatic(
+              type,
+              orig,
+              speed,
+              comp);
+          isDegenerated = false;
 
-          if (countInterTC == 0) {
+        }
 
-            minInterTC = ratio;
-            maxInterTC = ratio;
+      }
 
-          } else {
+    }
 
-            if (minInterTC > ratio) minInterTC = ratio;
-            if (maxInterTC < ratio) maxInterTC = ratio;
+    // Measure the time without and with pruning
+    double deltans[2] = {0.0, 0.0};
+    for (
+      int iPrune = 2;
+      iPrune--;) {
+
+      FMBSetPruning3DTime(iPrune == 1);
+
+      // Measure the median time of the FMB intersection test
+      BenchStats stats;
+      isIntersecting =
+        BenchMeasurePair(
+          &config,
+          QualifTestFMB,
+          frames,
+          frames + 1,
+          &stats);
+      deltans[iPrune] = stats.median / BenchGetCyclesPerNs();
 
-          }
+    }
 
-          sumInterTC += ratio;
-          ++countInterTC;
+    // Update the sums
+    int iThat = (frames[0].type == FrameCuboid ? 0 : 1);
+    int iTho = (frames[1].type == FrameCuboid ? 0 : 1);
+    sumNoPrune[iThat][iTho] += deltans[0];
+    sumPrune[iThat][iTho] += deltans[1];
+    ++(count[iThat][iTho]);
 
-        } else if (
-          paramP.type == FrameTetrahedron &&
-          paramQ.type == FrameTetrahedron) {
+  }
 
-          if (countInterTT == 0) {
+  // Restore the default setting
+  FMBSetPruning3DTime(false);
 
-            minInterTT = ratio;
-            maxInterTT = ratio;
+  // Print and save the results
+  FILE* fp = fopen("../Results/qualification3DTimePrune.txt", "w");
+  fprintf(fp, "pair\tnoprune\tprune\tratio\n");
+  printf("Time per test (ns), result %d\n", isIntersecting);
+  const char* labels[2][2] = {{"CC", "CT"}, {"TC", "TT"}};
+  for (
+    int iThat = 0;
+    iThat < 2;
+    ++iThat) {
 
-          } else {
+    for (
+      int iTho = 0;
+      iTho < 2;
+      ++iTho) {
+
+      double avgNoPrune =
+        sumNoPrune[iThat][iTho] / (double)(count[iThat][iTho]);
+      double avgPrune =
+        sumPrune[iThat][iTho] / (double)(count[iThat][iTho]);
+      printf("%s: no pruning %f, pruning %f, ratio %f\n",
+        labels[iThat][iTho], avgNoPrune, avgPrune, avgPrune / avgNoPrune);
+      fprintf(fp, "%s\t%f\t%f\t%f\n",
+        labels[iThat][iTho], avgNoPrune, avgPrune, avgPrune / avgNoPrune);
 
-            if (minInterTT > ratio) minInterTT = ratio;
-            if (maxInterTT < ratio) maxInterTT = ratio;
+    }
 
-          }
+  }
 
-          sumInterTT += ratio;
-          ++countInterTT;
+  // Print the statistics of the pruning
+  FMBPruneStats stats = FMBGetPruneStats3DTime();
+  printf("Examined %lu rows, removed %lu: ", stats.nbRows,
+    stats.nbDuplicate + stats.nbDominated + stats.nbTrivial);
+  printf("%lu duplicate, %lu dominated, %lu trivial\n",
+    stats.nbDuplicate, stats.nbDominated, stats.nbTrivial);
 
-        }
+  fclose(fp);
 
-      // Else, the Frames do not intersect
-      } else {
+}
 
-        // Update the counters
-        if (countNoInter == 0) {
+// Qualification of the adaptive order of elimination of the variables
+// For random pairs of Frames, measure the median time of
+// the intersection test (without bounding box) with the fixed and
+// adaptive orders, and get the average and worst time per test for
+// each pair of types (CC, CT, TC, TT)
+// Results are printed and saved in ../Results/qualification3DTimeOrder.txt
+void QualifyOrder3DTime(void) {
 
-          minNoInter = ratio;
-          maxNoInter = ratio;
+  // Initialise the random generator
+  srandom(time(NULL));
 
-        } else {
+  // Declare variables to sum and memorize the maximum of the time per
+  // test (in ns) for each order and pair of types,
+  // [iOrder][iTypeThat][iTypeTho]
+  double sum[2][2][2] = {{{0.0, 0.0}, {0.0, 0.0}}, {{0.0, 0.0}, {0.0, 0.0}}};
+  double max[2][2][2] = {{{0.0, 0.0}, {0.0, 0.0}}, {{0.0, 0.0}, {0.0, 0.0}}};
+  unsigned long count[2][2] = {{0, 0}, {0, 0}};
 
-          if (minNoInter > ratio) minNoInter = ratio;
-          if (maxNoInter < ratio) maxNoInter = ratio;
+  // Configuration of the measurements, and result of the last test
+  BenchConfig config = BenchConfigDefault();
+  bool isIntersecting = false;
 
-        }
+  // Loop on tests
+  for (
+    unsigned long iTest = NB_FRAMES_BATCH * NB_RUNS;
+    iTest--;) {
 
-        sumNoInter += ratio;
-        ++countNoInter;
+    // Create two random non degenerated Frames
+    Frame3DTime frames[2];
+    for (
+      int iFrame = 2;
+      iFrame--;) {
 
-        if (
-          paramP.type == FrameCuboid &&
-          paramQ.type == FrameCuboid) {
+      bool isDegenerated = true;
+      while (isDegenerated == true) {
 
-          if (countNoInterCC == 0) {
+        FrameType type = (rnd() < 0.5 ? FrameCuboid : FrameTetrahedron);
+        FMB_REAL orig[3];
+        FMB_REAL speed[3];
+        FMB_REAL comp[3][3];
+        for (
+          int iAxis = 3;
+          iAxis--;) {
 
-            minNoInterCC = ratio;
-            maxNoInterCC = ratio;
+          orig[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+          speed[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
 
-          } else {
+          for (
+            int iComp = 3;
+            iComp--;) {
 
-            if (minNoInterCC > ratio) minNoInterCC = ratio;
-            if (maxNoInterCC < ratio) maxNoInterCC = ratio;
+            comp[iComp][iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
 
           }
 
-          sumNoInterCC += ratio;
-          ++countNoInterCC;
+        }
 
-        } else if (
-          paramP.type == FrameCuboid &&
-          paramQ.type == FrameTetrahedron) {
+        double det =
+          comp[0][0] * (comp[1][1] * comp[2][2] -
+          comp[1][2] * comp[2][1]) -
+          comp[1][0] * (comp[0][1] * comp[2][2] -
+          comp[0][2] * comp[2][1]) +
+          comp[2][0] * (comp[0][1] * comp[1][2] -
+          comp[0][2] * comp[1][1]);
+        if (fabs(det) > EPSILON) {
+
+          frames[iFrame] =
+            Frame3DTimeCreateStatic(
+              type,
+              orig,
+              speed,
+              comp);
+          isDegenerated = false;
 
-          if (countNoInterCT == 0) {
+        }
 
-            minNoInterCT = ratio;
-            maxNoInterCT = ratio;
+      }
 
-          } else {
+    }
 
-            if (minNoInterCT > ratio) minNoInterCT = ratio;
-            if (maxNoInterCT < ratio) maxNoInterCT = ratio;
+    // Measure the time with the fixed and adaptive orders
+    double deltans[2] = {0.0, 0.0};
+    for (
+      int iOrder = 2;
+      iOrder--;) {
+
+      FMBSetElimOrder3DTime(
+        iOrder == 1 ? FMBElimOrderAdaptive : FMBElimOrderFixed);
+
+      // Measure the median time of the FMB intersection test
+      BenchStats stats;
+      isIntersecting =
+        BenchMeasurePair(
+          &config,
+          QualifTestFMB,
+          frames,
+          frames + 1,
+          &stats);
+      deltans[iOrder] = stats.median / BenchGetCyclesPerNs();
 
-          }
+    }
 
-          sumNoInterCT += ratio;
-          ++countNoInterCT;
+    // Update the sums and maximums
+    int iThat = (frames[0].type == FrameCuboid ? 0 : 1);
+    int iTho = (frames[1].type == FrameCuboid ? 0 : 1);
+    for (
+      int iOrder = 2;
+      iOrder--;) {
+
+      sum[iOrder][iThat][iTho] += deltans[iOrder];
+      if (max[iOrder][iThat][iTho] < deltans[iOrder]) {
 
-        } else if (
-          paramP.type == FrameTetrahedron &&
-          paramQ.type == FrameCuboid) {
+        max[iOrder][iThat][iTho] = deltans[iOrder];
 
-          if (countNoInterTC == 0) {
+      }
 
-            minNoInterTC = ratio;
-            maxNoInterTC = ratio;
+    }
 
-          } else {
+    ++(count[iThat][iTho]);
 
-            if (minNoInterTC > ratio) minNoInterTC = ratio;
-            if (maxNoInterTC < ratio) maxNoInterTC = ratio;
+  }
 
-          }
+  // Restore the default setting
+  FMBSetElimOrder3DTime(FMBElimOrderFixed);
 
-          sumNoInterTC += ratio;
-          ++countNoInterTC;
+  // Print and save the results
+  FILE* fp = fopen("../Results/qualification3DTimeOrder.txt", "w");
+  fprintf(fp, "pair\tavgfixed\tavgadaptive\tratio\t");
+  fprintf(fp, "maxfixed\tmaxadaptive\tratio\n");
+  printf("Time per test (ns), result %d\n", isIntersecting);
+  const char* labels[2][2] = {{"CC", "CT"}, {"TC", "TT"}};
+  for (
+    int iThat = 0;
+    iThat < 2;
+    ++iThat) {
 
-        } else if (
-          paramP.type == FrameTetrahedron &&
-          paramQ.type == FrameTetrahedron) {
+    for (
+      int iTho = 0;
+      iTho < 2;
+      ++iTho) {
+
+      double avgFixed =
+        sum[0][iThat][iTho] / (double)(count[iThat][iTho]);
+      double avgAdaptive =
+        sum[1][iThat][iTho] / (double)(count[iThat][iTho]);
+      double maxFixed = max[0][iThat][iTho];
+      double maxAdaptive = max[1][iThat][iTho];
+      printf("%s: average fixed %f, adaptive %f, ratio %f\n",
+        labels[iThat][iTho], avgFixed, avgAdaptive, avgAdaptive / avgFixed);
+      printf("%s: worst fixed %f, adaptive %f, ratio %f\n",
+        labels[iThat][iTho], maxFixed, maxAdaptive, maxAdaptive / maxFixed);
+      fprintf(fp, "%s\t%f\t%f\t%f\t%f\t%f\t%f\n",
+        labels[iThat][iTho], avgFixed, avgAdaptive, avgAdaptive / avgFixed,
+        maxFixed, maxAdaptive, maxAdaptive / maxFixed);
 
-          if (countNoInterTT == 0) {
+    }
 
-            minNoInterTT = ratio;
-            maxNoInterTT = ratio;
+  }
 
-          } else {
+  fclose(fp);
 
-            if (minNoInterTT > ratio) minNoInterTT = ratio;
-            if (maxNoInterTT < ratio) maxNoInterTT = ratio;
+}
 
-          }
+// Create a random non degenerated Frame for the qualification of the
+// hybrid intersection test
+Frame3DTime QualifRandomFrame3DTime(void) {
 
-          sumNoInterTT += ratio;
-          ++countNoInterTT;
+  // Loop until we get a non degenerated Frame
+  while (true) {
 
-        }
+    // 50% chance of being a Cuboid or a Tetrahedron
+    FrameType type = (rnd() < 0.5 ? FrameCuboid : FrameTetrahedron);
 
-      }
+    // Random origin, speed and components
+    FMB_REAL orig[3];
+    FMB_REAL speed[3];
+    FMB_REAL comp[3][3];
+    for (
+      int iAxis = 3;
+      iAxis--;) {
 
-    // Else, if time of execution for FMB was less than 10ms
-    } else if (deltausFMB < 10) {
+      orig[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+      speed[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
 
-      printf("deltausFMB < 10ms, increase NB_REPEAT\n");
-      exit(0);
+      for (
+        int iComp = 3;
+        iComp--;) {
 
-    // Else, if time of execution for SAT was less than 10ms
-    } else if (deltausSAT < 10) {
+        comp[iComp][iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
 
-      printf("deltausSAT < 10ms, increase NB_REPEAT\n");
-      exit(0);
+      }
 
     }
 
-    // Flip the pair of Frames
-    that = &Q;
-    tho = &P;
+    // If the determinant is not null, ie the Frame is not degenerate
+    double det =
+      comp[0][0] * (comp[1][1] * comp[2][2] -
+      comp[1][2] * comp[2][1]) -
+      comp[1][0] * (comp[0][1] * comp[2][2] -
+      comp[0][2] * comp[2][1]) +
+      comp[2][0] * (comp[0][1] * comp[1][2] -
+      comp[0][2] * comp[1][1]);
+    if (fabs(det) > EPSILON) {
+
+      return
+        Frame3DTimeCreateStatic(
+          type,
+          orig,
+          speed,
+          comp);
+
+    }
 
   }
 
 }
 
-void Qualify3DDynamic(void) {
+// Qualification of the hybrid intersection test against FMB and SAT
+// For random pairs of Frames, and for random pairs of Frames whose
+// AABBs intersect (nearCaseOnly, as after a broadphase), measure the
+// median time of FMBTestIntersection3DTime, SATTestIntersection3DTime,
+// and FMBHybridTestIntersection3DTime with the normals to the faces of
+// both Frames and of that only as filter axes, and get the average
+// time per test for the pairs in intersection and the others
+// Results are printed and saved in
+// ../Results/qualification3DTimeHybrid.txt
+void QualifyHybrid3DTime(void) {
 
   // Initialise the random generator
   srandom(time(NULL));
 
-  // Open the files to save the results
-  FILE* fp = fopen("../Results/qualification3DTime.txt", "w");
-  FILE* fpCC = fopen("../Results/qualification3DTimeCC.txt", "w");
-  FILE* fpCT = fopen("../Results/qualification3DTimeCT.txt", "w");
-  FILE* fpTC = fopen("../Results/qualification3DTimeTC.txt", "w");
-  FILE* fpTT = fopen("../Results/qualification3DTimeTT.txt", "w");
+  // Open the file to save the results
+  FILE* fp = fopen("../Results/qualification3DTimeHybrid.txt", "w");
+  fprintf(fp, "dist\tinter\tfmb\tsat\thybridall\thybridthat\n");
 
-  // Loop on runs
-  for (
-    int iRun = 0;
-    iRun < NB_RUNS;
-    ++iRun) {
+  // Tests to measure, and the filter axes of the hybrid tests
+  BenchPairTest tests[4] = {
 
-    // Ratio intersection/no intersection for the displayed results
-    double ratioInter = 0.1 + 0.8 * (double)iRun / (double)(NB_RUNS - 1);
+    QualifTestFMB,
+    QualifTestSAT,
+    QualifTestHybrid,
+    QualifTestHybrid
 
-    // Initialize counters
-    minInter = 0.0;
-    maxInter = 0.0;
-    sumInter = 0.0;
-    countInter = 0;
-    minNoInter = 0.0;
-    maxNoInter = 0.0;
-    sumNoInter = 0.0;
-    countNoInter = 0;
-
-    minInterCC = 0.0;
-    maxInterCC = 0.0;
-    sumInterCC = 0.0;
-    countInterCC = 0;
-    minNoInterCC = 0.0;
-    maxNoInterCC = 0.0;
-    sumNoInterCC = 0.0;
-    countNoInterCC = 0;
-
-    minInterCT = 0.0;
-    maxInterCT = 0.0;
-    sumInterCT = 0.0;
-    countInterCT = 0;
-    minNoInterCT = 0.0;
-    maxNoInterCT = 0.0;
-    sumNoInterCT = 0.0;
-    countNoInterCT = 0;
-
-    minInterTC = 0.0;
-    maxInterTC = 0.0;
-    sumInterTC = 0.0;
-    countInterTC = 0;
-    minNoInterTC = 0.0;
-    maxNoInterTC = 0.0;
-    sumNoInterTC = 0.0;
-    countNoInterTC = 0;
-
-    minInterTT = 0.0;
-    maxInterTT = 0.0;
-    sumInterTT = 0.0;
-    countInterTT = 0;
-    minNoInterTT = 0.0;
-    maxNoInterTT = 0.0;
-    sumNoInterTT = 0.0;
-    countNoInterTT = 0;
+  };
+  unsigned int hybridAxes[4] = {
 
-    // Declare two variables to memorize the arguments to the
-    // Qualification function
-    Param3DTime paramP;
-    Param3DTime paramQ;
+    FMB_HYBRID_AXES_ALL,
+    FMB_HYBRID_AXES_ALL,
+    FMB_HYBRID_AXES_ALL,
+    FMB_HYBRID_AXES_THAT
 
-    // Loop on the number of tests
+  };
+  const char* labelDists[2] = {"random", "nearcaseonly"};
+  const char* labelInters[2] = {"inter", "nointer"};
+
+  // Memorize the current filter axes
+  unsigned int axes = FMBGetHybridAxes3DTime();
+
+  // Configuration of the measurements
+  BenchConfig config = BenchConfigDefault();
+
+  // Loop on the distributions of pairs
+  for (
+    int iDist = 0;
+    iDist < 2;
+    ++iDist) {
+
+    // Declare variables to sum the time per test (in ns) for the pairs
+    // in intersection and the others, [iInter][iTest]
+    double sum[2][4] = {{0.0, 0.0, 0.0, 0.0}, {0.0, 0.0, 0.0, 0.0}};
+    unsigned long count[2] = {0, 0};
+
+    // Loop on pairs
     for (
-      unsigned long iTest = NB_TESTS;
-      iTest--;) {
+      unsigned long iPair = NB_FRAMES_BATCH * NB_RUNS;
+      iPair--;) {
 
-      // Create two random Frame definitions
-      Param3DTime* param = &paramP;
+      // Create two random Frames, with intersecting AABBs for the
+      // nearCaseOnly distribution
+      Frame3DTime frames[2];
+      bool isNear = false;
+      while (isNear == false) {
+
+        frames[0] = QualifRandomFrame3DTime();
+        frames[1] = QualifRandomFrame3DTime();
+        if (iDist == 0) {
+
+          break;
+
+        }
+
+        // Check if the AABBs of the Frames over their move intersect
+        isNear = true;
+        for (
+          int iAxis = 3;
+          iAxis--;) {
+
+          if (
+            frames[0].bdgBox.max[iAxis] < frames[1].bdgBox.min[iAxis] ||
+            frames[1].bdgBox.max[iAxis] < frames[0].bdgBox.min[iAxis]) {
+
+            isNear = false;
+
+          }
+
+        }
+
+      }
+
+      // Measure the median time of each test, the last one measured
+      // being FMB
+      bool isIntersecting = false;
+      double deltans[4];
       for (
-        int iParam = 2;
-        iParam--;) {
+        int iTest = 4;
+        iTest--;) {
+
+        FMBSetHybridAxes3DTime(hybridAxes[iTest]);
+        BenchStats stats;
+        isIntersecting =
+          BenchMeasurePair(
+            &config,
+            tests[iTest],
+            frames,
+            frames + 1,
+            &stats);
+        deltans[iTest] = stats.median / BenchGetCyclesPerNs();
 
-        // 50% chance of being a Cuboid or a Tetrahedron
-        if (rnd() < 0.5) {
+      }
 
-          param->type = FrameCuboid;
+      // Update the sums
+      int iInter = (isIntersecting == true ? 0 : 1);
+      for (
+        int iTest = 4;
+        iTest--;) {
 
-        } else {
+        sum[iInter][iTest] += deltans[iTest];
 
-          param->type = FrameTetrahedron;
+      }
+
+      ++(count[iInter]);
+
+    }
+
+    // Print and save the results
+    printf("Time per test (ns), %s pairs\n", labelDists[iDist]);
+    for (
+      int iInter = 0;
+      iInter < 2;
+      ++iInter) {
+
+      double avg[4] = {0.0, 0.0, 0.0, 0.0};
+      for (
+        int iTest = 4;
+        iTest--;) {
+
+        if (count[iInter] > 0) {
+
+          avg[iTest] = sum[iInter][iTest] / (double)(count[iInter]);
 
         }
 
+      }
+
+      printf("%s (%lu pairs): FMB %f, SAT %f, ",
+        labelInters[iInter], count[iInter], avg[0], avg[1]);
+      printf("hybrid all %f, hybrid that %f\n", avg[2], avg[3]);
+      fprintf(fp, "%s\t%s\t%f\t%f\t%f\t%f\n",
+        labelDists[iDist], labelInters[iInter],
+        avg[0], avg[1], avg[2], avg[3]);
+
+    }
+
+  }
+
+  // Restore the filter axes
+  FMBSetHybridAxes3DTime(axes);
+
+  // Close the file
+  fclose(fp);
+
+}
+
+// Qualification of the continuous collision detection
+// Move a set of NB_FRAMES_BATCH random bodies along NB_CCD_STEPS steps,
+// without and with rotation, and get the time of first contact of
+// NB_FRAMES_BATCH random pairs of bodies at each step, first by
+// creating the Frames of the bodies from scratch for each step and
+// calling FMBTestFirstContact3DTime on each pair (which ignores the
+// rotation during the step), second by calling FMBCCDBodyStep3DTime on
+// each body and FMBCCDTestPairs3DTime on the pairs. Measure the time
+// per body of the update and the time per pair of the test
+// Results are printed and saved in ../Results/qualification3DTimeCCD.txt
+void QualifyCCD3DTime(void) {
+
+  // Initialise the random generator
+  srandom(time(NULL));
+
+  // Open the file to save the results
+  FILE* fp = fopen("../Results/qualification3DTimeCCD.txt", "w");
+  fprintf(fp, "motion\tupdaterebuild\tupdateccd\t");
+  fprintf(fp, "testrebuild\ttestccd\tcontactrebuild\tcontactccd\n");
+
+  // Allocate memory for the poses of the bodies at each step, the
+  // bodies, their Frames, and the pairs
+  int nbPose = NB_FRAMES_BATCH * (NB_CCD_STEPS + 1);
+  FMB_REAL (*origs)[3] = malloc(sizeof(FMB_REAL[3]) * nbPose);
+  FMB_REAL (*comps)[3][3] = malloc(sizeof(FMB_REAL[3][3]) * nbPose);
+  FrameType* types = malloc(sizeof(FrameType) * NB_FRAMES_BATCH);
+  FMBCCDBody3DTime* bodies =
+    malloc(sizeof(FMBCCDBody3DTime) * NB_FRAMES_BATCH);
+  Frame3DTime* frames = malloc(sizeof(Frame3DTime) * NB_FRAMES_BATCH);
+  FMBCCDPair* pairs = malloc(sizeof(FMBCCDPair) * NB_FRAMES_BATCH);
+  unsigned long* isContact =
+    malloc(sizeof(unsigned long) * FMBBitsetNbWords(NB_FRAMES_BATCH));
+  FMB_REAL* tContacts = malloc(sizeof(FMB_REAL) * NB_FRAMES_BATCH);
+
+  // Create the random pairs
+  for (
+    int iPair = NB_FRAMES_BATCH;
+    iPair--;) {
+
+    pairs[iPair].iThat = (int)(rnd() * (NB_FRAMES_BATCH - 1));
+    pairs[iPair].iTho =
+      (pairs[iPair].iThat + 1 +
+      (int)(rnd() * (NB_FRAMES_BATCH - 2))) % NB_FRAMES_BATCH;
+
+  }
+
+  // Loop on the motions, without and with rotation
+  for (
+    int iMotion = 0;
+    iMotion < 2;
+    ++iMotion) {
+
+    // Create the poses of the bodies
+    for (
+      int iBody = NB_FRAMES_BATCH;
+      iBody--;) {
+
+      Frame3DTime frame = QualifRandomFrame3DTime();
+      types[iBody] = frame.type;
+
+      for (
+        int iStep = 0;
+        iStep <= NB_CCD_STEPS;
+        ++iStep) {
+
+        // Memorize the pose
+        int iPose = iStep * NB_FRAMES_BATCH + iBody;
         for (
           int iAxis = 3;
           iAxis--;) {
 
-          param->orig[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
-          param->speed[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+          origs[iPose][iAxis] = frame.orig[iAxis];
 
           for (
             int iComp = 3;
             iComp--;) {
 
-            param->comp[iComp][iAxis] =
-              -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+            comps[iPose][iComp][iAxis] = frame.comp[iComp][iAxis];
 
           }
 
         }
 
-        param = &paramQ;
+        // Move the Frame to the next pose
+        FMB_REAL move[3];
+        FMB_REAL axis[3];
+        for (
+          int iAxis = 3;
+          iAxis--;) {
 
-      }
+          move[iAxis] = CCD_MAX_MOVE * (-1.0 + 2.0 * rnd());
+          axis[iAxis] = -1.0 + 2.0 * rnd();
 
-      // Calculate the determinant of the Frames' components matrix
-      double detP =
-        paramP.comp[0][0] * (paramP.comp[1][1] * paramP.comp[2][2] -
-        paramP.comp[1][2] * paramP.comp[2][1]) -
-        paramP.comp[1][0] * (paramP.comp[0][1] * paramP.comp[2][2] -
-        paramP.comp[0][2] * paramP.comp[2][1]) +
-        paramP.comp[2][0] * (paramP.comp[0][1] * paramP.comp[1][2] -
-        paramP.comp[0][2] * paramP.comp[1][1]);
+        }
 
-      double detQ =
-        paramQ.comp[0][0] * (paramQ.comp[1][1] * paramQ.comp[2][2] -
-        paramQ.comp[1][2] * paramQ.comp[2][1]) -
-        paramQ.comp[1][0] * (paramQ.comp[0][1] * paramQ.comp[2][2] -
-        paramQ.comp[0][2] * paramQ.comp[2][1]) +
-        paramQ.comp[2][0] * (paramQ.comp[0][1] * paramQ.comp[1][2] -
-        paramQ.comp[0][2] * paramQ.comp[1][1]);
+        Frame3DTimeTranslate(
+          &frame,
+          move);
+        if (iMotion == 1) {
 
-      // If the determinants are not null, ie the Frame are not degenerate
-      if (fabs(detP) > EPSILON && fabs(detQ) > EPSILON) {
+          Frame3DTimeRotate(
+            &frame,
+            axis,
+            CCD_MAX_ANGLE * (-1.0 + 2.0 * rnd()));
 
-        // Run the validation on the two Frames
-        Qualification3DDynamic(
-          paramP,
-          paramQ);
+        }
 
       }
 
     }
 
-    // Save the results
-    if (iRun == 0) {
-
-      fprintf(fp, "percPairInter,");
-      fprintf(fp, "countInterTo,countNoInterTo,");
-      fprintf(fp, "minInterTo,avgInterTo,maxInterTo,");
-      fprintf(fp, "minNoInterTo,avgNoInterTo,maxNoInterTo,");
-      fprintf(fp, "minTotalTo,avgTotalTo,maxTotalTo\n");
-
-      fprintf(fpCC, "percPairInter,");
-      fprintf(fpCC, "countInterCC,countNoInterCC,");
-      fprintf(fpCC, "minInterCC,avgInterCC,maxInterCC,");
-      fprintf(fpCC, "minNoInterCC,avgNoInterCC,maxNoInterCC,");
-      fprintf(fpCC, "minTotalCC,avgTotalCC,maxTotalCC\n");
-
-      fprintf(fpCT, "percPairInter,");
-      fprintf(fpCT, "countInterCT,countNoInterCT,");
-      fprintf(fpCT, "minInterCT,avgInterCT,maxInterCT,");
-      fprintf(fpCT, "minNoInterCT,avgNoInterCT,maxNoInterCT,");
-      fprintf(fpCT, "minTotalCT,avgTotalCT,maxTotalCT\n");
-
-      fprintf(fpTC, "percPairInter,");
-      fprintf(fpTC, "countInterTC,countNoInterTC,");
-      fprintf(fpTC, "minInterTC,avgInterTC,maxInterTC,");
-      fprintf(fpTC, "minNoInterTC,avgNoInterTC,maxNoInterTC,");
-      fprintf(fpTC, "minTotalTC,avgTotalTC,maxTotalTC\n");
-
-      fprintf(fpTT, "percPairInter,");
-      fprintf(fpTT, "countInterTT,countNoInterTT,");
-      fprintf(fpTT, "minInterTT,avgInterTT,maxInterTT,");
-      fprintf(fpTT, "minNoInterTT,avgNoInterTT,maxNoInterTT,");
-      fprintf(fpTT, "minTotalTT,avgTotalTT,maxTotalTT\n");
+    // Declare variables to sum the times over all the runs, and count
+    // the contacts
+    double sumUpdate[2] = {0.0, 0.0};
+    double sumTest[2] = {0.0, 0.0};
+    unsigned long nbContact[2] = {0, 0};
 
-    }
+    // Loop on runs
+    for (
+      int iRun = 0;
+      iRun < NB_RUNS;
+      ++iRun) {
 
-    fprintf(
-      fp,
-      "%.1f,",
-      ratioInter);
-    fprintf(
-      fp,
-      "%lu,%lu,",
-      countInter,
-      countNoInter);
-    double avgInter = sumInter / (double)countInter;
-    fprintf(
-      fp,
-      "%f,%f,%f,",
-      minInter,
-      avgInter,
-      maxInter);
-    double avgNoInter = sumNoInter / (double)countNoInter;
-    fprintf(
-      fp,
-      "%f,%f,%f,",
-      minNoInter,
-      avgNoInter,
-      maxNoInter);
-    double avg =
-      ratioInter * avgInter + (1.0 - ratioInter) * avgNoInter;
-    fprintf(
-      fp,
-      "%f,%f,%f",
-      (minNoInter < minInter ? minNoInter : minInter),
-      avg,
-      (maxNoInter > maxInter ? maxNoInter : maxInter));
-    if (iRun < NB_RUNS - 1) {
-
-      fprintf(fp, "\n");
+      // Create the bodies at their initial pose
+      for (
+        int iBody = NB_FRAMES_BATCH;
+        iBody--;) {
 
-    }
+        bodies[iBody] =
+          FMBCCDBodyCreate3DTime(
+            types[iBody],
+            origs[iBody],
+            comps[iBody]);
 
-    fprintf(
-      fpCC,
-      "%.1f,",
-      ratioInter);
-    fprintf(
-      fpCC,
-      "%lu,%lu,",
-      countInterCC,
-      countNoInterCC);
-    double avgInterCC = sumInterCC / (double)countInterCC;
-    fprintf(
-      fpCC,
-      "%f,%f,%f,",
-      minInterCC,
-      avgInterCC,
-      maxInterCC);
-    double avgNoInterCC = sumNoInterCC / (double)countNoInterCC;
-    fprintf(
-      fpCC,
-      "%f,%f,%f,",
-      minNoInterCC,
-      avgNoInterCC,
-      maxNoInterCC);
-    double avgCC =
-      ratioInter * avgInterCC + (1.0 - ratioInter) * avgNoInterCC;
-    fprintf(
-      fpCC,
-      "%f,%f,%f",
-      (minNoInterCC < minInterCC ? minNoInterCC : minInterCC),
-      avgCC,
-      (maxNoInterCC > maxInterCC ? maxNoInterCC : maxInterCC));
-    if (iRun < NB_RUNS - 1) {
-
-      fprintf(fpCC, "\n");
+      }
 
-    }
+      // Loop on the steps
+      for (
+        int iStep = 0;
+        iStep < NB_CCD_STEPS;
+        ++iStep) {
 
-    fprintf(
-      fpCT,
-      "%.1f,",
-      ratioInter);
-    fprintf(
-      fpCT,
-      "%lu,%lu,",
-      countInterCT,
-      countNoInterCT);
-    double avgInterCT = sumInterCT / (double)countInterCT;
-    fprintf(
-      fpCT,
-      "%f,%f,%f,",
-      minInterCT,
-      avgInterCT,
-      maxInterCT);
-    double avgNoInterCT = sumNoInterCT / (double)countNoInterCT;
-    fprintf(
-      fpCT,
-      "%f,%f,%f,",
-      minNoInterCT,
-      avgNoInterCT,
-      maxNoInterCT);
-    double avgCT =
-      ratioInter * avgInterCT + (1.0 - ratioInter) * avgNoInterCT;
-    fprintf(
-      fpCT,
-      "%f,%f,%f",
-      (minNoInterCT < minInterCT ? minNoInterCT : minInterCT),
-      avgCT,
-      (maxNoInterCT > maxInterCT ? maxNoInterCT : maxInterCT));
-    if (iRun < NB_RUNS - 1) {
-
-      fprintf(fpCT, "\n");
+        const FMB_REAL (*origStart)[3] = origs + iStep * NB_FRAMES_BATCH;
+        const FMB_REAL (*origEnd)[3] = origStart + NB_FRAMES_BATCH;
+        FMB_REAL (*compStart)[3][3] = comps + iStep * NB_FRAMES_BATCH;
+        FMB_REAL (*compEnd)[3][3] = compStart + NB_FRAMES_BATCH;
 
-    }
+        // Create the Frames from scratch
+        double start = BenchGetNs();
+        for (
+          int iBody = NB_FRAMES_BATCH;
+          iBody--;) {
 
-    fprintf(
-      fpTC,
-      "%.1f,",
-      ratioInter);
-    fprintf(
-      fpTC,
-      "%lu,%lu,",
-      countInterTC,
-      countNoInterTC);
-    double avgInterTC = sumInterTC / (double)countInterTC;
-    fprintf(
-      fpTC,
-      "%f,%f,%f,",
-      minInterTC,
-      avgInterTC,
-      maxInterTC);
-    double avgNoInterTC = sumNoInterTC / (double)countNoInterTC;
-    fprintf(
-      fpTC,
-      "%f,%f,%f,",
-      minNoInterTC,
-      avgNoInterTC,
-      maxNoInterTC);
-    double avgTC =
-      ratioInter * avgInterTC + (1.0 - ratioInter) * avgNoInterTC;
-    fprintf(
-      fpTC,
-      "%f,%f,%f",
-      (minNoInterTC < minInterTC ? minNoInterTC : minInterTC),
-      avgTC,
-      (maxNoInterTC > maxInterTC ? maxNoInterTC : maxInterTC));
-    if (iRun < NB_RUNS - 1) {
-
-      fprintf(fpTC, "\n");
+          FMB_REAL speed[3];
+          for (
+            int iAxis = 3;
+            iAxis--;) {
 
-    }
+            speed[iAxis] = origEnd[iBody][iAxis] - origStart[iBody][iAxis];
+
+          }
+
+          frames[iBody] =
+            Frame3DTimeCreateStatic(
+              types[iBody],
+              origStart[iBody],
+              speed,
+              compStart[iBody]);
+
+        }
+
+        sumUpdate[0] += BenchGetNs() - start;
+
+        // Get the time of first contact of each pair
+        start = BenchGetNs();
+        for (
+          int iPair = NB_FRAMES_BATCH;
+          iPair--;) {
+
+          bool isContactPair =
+            FMBTestFirstContact3DTime(
+              frames + pairs[iPair].iThat,
+              frames + pairs[iPair].iTho,
+              tContacts + iPair);
+          if (isContactPair == true) {
+
+            ++(nbContact[0]);
+
+          }
+
+        }
+
+        sumTest[0] += BenchGetNs() - start;
+
+        // Step the bodies
+        start = BenchGetNs();
+        for (
+          int iBody = NB_FRAMES_BATCH;
+          iBody--;) {
+
+          FMBCCDBodyStep3DTime(
+            bodies + iBody,
+            origEnd[iBody],
+            compEnd[iBody]);
+
+        }
 
-    fprintf(
-      fpTT,
-      "%.1f,",
-      ratioInter);
-    fprintf(
-      fpTT,
-      "%lu,%lu,",
-      countInterTT,
-      countNoInterTT);
-    double avgInterTT = sumInterTT / (double)countInterTT;
-    fprintf(
-      fpTT,
-      "%f,%f,%f,",
-      minInterTT,
-      avgInterTT,
-      maxInterTT);
-    double avgNoInterTT = sumNoInterTT / (double)countNoInterTT;
-    fprintf(
-      fpTT,
-      "%f,%f,%f,",
-      minNoInterTT,
-      avgNoInterTT,
-      maxNoInterTT);
-    double avgTT =
-      ratioInter * avgInterTT + (1.0 - ratioInter) * avgNoInterTT;
-    fprintf(
-      fpTT,
-      "%f,%f,%f",
-      (minNoInterTT < minInterTT ? minNoInterTT : minInterTT),
-      avgTT,
-      (maxNoInterTT > maxInterTT ? maxNoInterTT : maxInterTT));
-    if (iRun < NB_RUNS - 1) {
-
-      fprintf(fpTT, "\n");
+        sumUpdate[1] += BenchGetNs() - start;
+
+        // Get the time of first contact of each pair
+        start = BenchGetNs();
+        nbContact[1] +=
+          FMBCCDTestPairs3DTime(
+            bodies,
+            pairs,
+            NB_FRAMES_BATCH,
+            isContact,
+            tContacts);
+        sumTest[1] += BenchGetNs() - start;
+
+      }
 
     }
 
+    // Convert the times to nanoseconds per body and per pair
+    double nb = (double)NB_RUNS * (double)NB_CCD_STEPS * NB_FRAMES_BATCH;
+    const char* label = (iMotion == 0 ? "translation" : "rotation");
+    printf("%s: update per body rebuild %fns, ccd %fns\n",
+      label, sumUpdate[0] / nb, sumUpdate[1] / nb);
+    printf("%s: test per pair rebuild %fns, ccd %fns\n",
+      label, sumTest[0] / nb, sumTest[1] / nb);
+    printf("%s: contacts rebuild %lu, ccd %lu\n",
+      label, nbContact[0], nbContact[1]);
+    fprintf(fp, "%s\t%f\t%f\t%f\t%f\t%lu\t%lu\n",
+      label, sumUpdate[0] / nb, sumUpdate[1] / nb,
+      sumTest[0] / nb, sumTest[1] / nb, nbContact[0], nbContact[1]);
+
   }
 
-  // Close the files
+  // Free memory and close the file
+  free(origs);
+  free(comps);
+  free(types);
+  free(bodies);
+  free(frames);
+  free(pairs);
+  free(isContact);
+  free(tContacts);
   fclose(fp);
-  fclose(fpCC);
-  fclose(fpCT);
-  fclose(fpTC);
-  fclose(fpTT);
 
 }
 
 int main(int argc, char** argv) {
 
+  // If the user requested the qualification of the batch test or
+  // the pruning
+  for (
+    int iArg = 0;
+    iArg < argc;
+    ++iArg) {
+
+    if (strcmp(argv[iArg], "-batch") == 0) {
+
+      QualifyBatch3DTime();
+      return 0;
+
+    } else if (strcmp(argv[iArg], "-hybrid") == 0) {
+
+      QualifyHybrid3DTime();
+      return 0;
+
+    } else if (strcmp(argv[iArg], "-ccd") == 0) {
+
+      QualifyCCD3DTime();
+      return 0;
+
+    } else if (strcmp(argv[iArg], "-prune") == 0) {
+
+      QualifyPrune3DTime();
+      return 0;
+
+    } else if (strcmp(argv[iArg], "-order") == 0) {
+
+      QualifyOrder3DTime();
+      return 0;
+
+    }
+
+  }
+
   Qualify3DDynamic();
 
+#ifdef FMB_ELIM_STATS
+
+  // Print the statistics of the elimination
+  FMBElimStats elimStats = FMBGetElimStats3DTime();
+  FMBElimStatsPrint(
+    &elimStats,
+    stdout);
+
+#endif
+
   return 0;
 
 }
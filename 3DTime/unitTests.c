@@ -28,13 +28,16 @@
 // Epsilon for numerical precision
 #define EPSILON 0.0001
 
+// Pi
+#define PI 3.14159265358979323846
+
 // Helper structure to pass arguments to the UnitTest function
 typedef struct {
 
   FrameType type;
-  double orig[3];
-  double comp[3][3];
-  double speed[3];
+  FMB_REAL orig[3];
+  FMB_REAL comp[3][3];
+  FMB_REAL speed[3];
 
 } Param3DTime;
 
@@ -176,6 +179,532 @@ void UnitTest3DTime(
 
 }
 
+// Check if the Frames A and B are identical (including their inverse
+// components and bounding box)
+bool IsSameFrame3DTime(
+  const Frame3DTime* const A,
+  const Frame3DTime* const B) {
+
+  for (
+    int i = 3;
+    i--;) {
+
+    if (fabs(A->orig[i] - B->orig[i]) > EPSILON) {
+
+      return false;
+
+    }
+
+    for (
+      int j = 3;
+      j--;) {
+
+      if (
+        fabs(A->comp[i][j] - B->comp[i][j]) > EPSILON ||
+        fabs(A->invComp[i][j] - B->invComp[i][j]) > EPSILON) {
+
+        return false;
+
+      }
+
+    }
+
+  }
+
+  for (
+    int i = 4;
+    i--;) {
+
+    if (
+      fabs(A->bdgBox.min[i] - B->bdgBox.min[i]) > EPSILON ||
+      fabs(A->bdgBox.max[i] - B->bdgBox.max[i]) > EPSILON) {
+
+      return false;
+
+    }
+
+  }
+
+  return true;
+
+}
+
+// Unit test of the functions modifying a Frame
+// Translate, rotate, set the components and set the motion of a Frame
+// and check the result against the same Frame created from scratch
+void UnitTestMutation3DTime(void) {
+
+  // Create the Frame to be modified
+  FMB_REAL orig[3] = {0.0, 0.0, 0.0};
+  FMB_REAL speed[3] = {0.5, -0.5, -0.5};
+  FMB_REAL comp[3][3] = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+  Frame3DTime P =
+    Frame3DTimeCreateStatic(
+      FrameCuboid,
+      orig,
+      speed,
+      comp);
+
+  // Translate and rotate the Frame
+  FMB_REAL v[3] = {1.0, 2.0, 3.0};
+  Frame3DTimeTranslate(
+    &P,
+    v);
+  FMB_REAL axis[3] = {0.0, 0.0, 2.0};
+  Frame3DTimeRotate(
+    &P,
+    axis,
+    PI * 0.5);
+
+  // Create the expected Frame
+  FMB_REAL origExpected[3] = {1.0, 2.0, 3.0};
+  FMB_REAL compRot[3][3] = {{0.0, 1.0, 0.0}, {-1.0, 0.0, 0.0}, {0.0, 0.0, 1.0}};
+  Frame3DTime Q =
+    Frame3DTimeCreateStatic(
+      FrameCuboid,
+      origExpected,
+      speed,
+      compRot);
+
+  // Check the result
+  if (IsSameFrame3DTime(&P, &Q) == false) {
+
+    printf("UnitTestMutation3DTime translate/rotate Failed\n");
+    printf("Expected : ");
+    Frame3DTimePrint(&Q);
+    printf("\n     Got : ");
+    Frame3DTimePrint(&P);
+    printf("\n");
+    exit(0);
+
+  }
+
+  // Set the components of the Frame
+  FMB_REAL compSet[3][3] = {{2.0, 0.5, 0.0}, {0.0, 2.0, 0.0}, {0.0, 0.5, 2.0}};
+  Frame3DTimeSetComp(
+    &P,
+    compSet);
+
+  // Create the expected Frame
+  Q =
+    Frame3DTimeCreateStatic(
+      FrameCuboid,
+      origExpected,
+      speed,
+      compSet);
+
+  // Check the result
+  if (IsSameFrame3DTime(&P, &Q) == false) {
+
+    printf("UnitTestMutation3DTime set components Failed\n");
+    printf("Expected : ");
+    Frame3DTimePrint(&Q);
+    printf("\n     Got : ");
+    Frame3DTimePrint(&P);
+    printf("\n");
+    exit(0);
+
+  }
+
+  // Set the origin and speed of the Frame
+  FMB_REAL origSet[3] = {-1.0, 0.5, 2.0};
+  FMB_REAL speedSet[3] = {1.0, 1.0, -2.0};
+  Frame3DTimeSetMotion(
+    &P,
+    origSet,
+    speedSet);
+
+  // Create the expected Frame
+  Q =
+    Frame3DTimeCreateStatic(
+      FrameCuboid,
+      origSet,
+      speedSet,
+      compSet);
+
+  // Check the result
+  if (IsSameFrame3DTime(&P, &Q) == false) {
+
+    printf("UnitTestMutation3DTime set motion Failed\n");
+    printf("Expected : ");
+    Frame3DTimePrint(&Q);
+    printf("\n     Got : ");
+    Frame3DTimePrint(&P);
+    printf("\n");
+    exit(0);
+
+  }
+
+  printf("UnitTestMutation3DTime Succeed\n\n");
+
+}
+
+// Unit test of the time of first contact
+// Check FMBTestFirstContact3DTime on the Frames P and Q against the
+// correct answer and time of first contact, and against the bounding
+// box of FMBTestIntersection3DTime
+void UnitTestFirstContact3DTime(
+  const Param3DTime paramP,
+  const Param3DTime paramQ,
+  const bool correctAnswer,
+  const double correctTime) {
+
+  // Create the two Frames
+  Frame3DTime P =
+    Frame3DTimeCreateStatic(
+      paramP.type,
+      paramP.orig,
+      paramP.speed,
+      paramP.comp);
+  Frame3DTime Q =
+    Frame3DTimeCreateStatic(
+      paramQ.type,
+      paramQ.orig,
+      paramQ.speed,
+      paramQ.comp);
+
+  // Get the time of first contact, and the bounding box of the
+  // intersection
+  FMB_REAL tContact = -1.0;
+  bool isInter =
+    FMBTestFirstContact3DTime(
+      &P,
+      &Q,
+      &tContact);
+  AABB3DTime bdgBox;
+  bool isInterBdgBox =
+    FMBTestIntersection3DTime(
+      &P,
+      &Q,
+      &bdgBox);
+
+  // Check the results
+  if (
+    isInter != correctAnswer ||
+    isInter != isInterBdgBox ||
+    (isInter == true &&
+    (fabs(tContact - correctTime) > EPSILON ||
+    tContact != bdgBox.min[3]))) {
+
+    printf("UnitTestFirstContact3DTime Failed\n");
+    Frame3DTimePrint(&P);
+    printf(" against ");
+    Frame3DTimePrint(&Q);
+    printf("\nExpected %d at %f, got %d at %f\n",
+      correctAnswer, correctTime, isInter, tContact);
+    exit(0);
+
+  }
+
+}
+
+void TestFirstContact3DTime(void) {
+
+  // Static unit Cuboid at the origin
+  Param3DTime paramP = {
+
+    .type = FrameCuboid,
+    .orig = {0.0, 0.0, 0.0},
+    .comp = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}},
+    .speed = {0.0, 0.0, 0.0}
+
+  };
+
+  // Cuboid coming along the first axis, in contact at t=0.5
+  Param3DTime paramQ = {
+
+    .type = FrameCuboid,
+    .orig = {3.0, 0.5, 0.5},
+    .comp = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}},
+    .speed = {-4.0, 0.0, 0.0}
+
+  };
+  UnitTestFirstContact3DTime(
+    paramP,
+    paramQ,
+    true,
+    0.5);
+
+  // Tetrahedron coming along the second axis, in contact at t=0.75
+  paramQ.type = FrameTetrahedron;
+  paramQ.orig[0] = 0.25;
+  paramQ.orig[1] = 2.5;
+  paramQ.speed[0] = 0.0;
+  paramQ.speed[1] = -2.0;
+  UnitTestFirstContact3DTime(
+    paramP,
+    paramQ,
+    true,
+    0.75);
+
+  // Same with the Frames exchanged
+  UnitTestFirstContact3DTime(
+    paramQ,
+    paramP,
+    true,
+    0.75);
+
+  // Tetrahedron intersecting at t=0 and moving away
+  paramQ.orig[1] = 0.5;
+  paramQ.speed[1] = 2.0;
+  UnitTestFirstContact3DTime(
+    paramP,
+    paramQ,
+    true,
+    0.0);
+
+  // Tetrahedron too slow to reach the Cuboid
+  paramQ.orig[1] = 2.5;
+  paramQ.speed[1] = -1.0;
+  UnitTestFirstContact3DTime(
+    paramP,
+    paramQ,
+    false,
+    0.0);
+
+  // Both moving, in contact at t=0.25
+  paramP.speed[2] = 2.0;
+  paramQ.type = FrameCuboid;
+  paramQ.orig[1] = 0.0;
+  paramQ.orig[2] = 2.0;
+  paramQ.speed[1] = 0.0;
+  paramQ.speed[2] = -2.0;
+  UnitTestFirstContact3DTime(
+    paramP,
+    paramQ,
+    true,
+    0.25);
+
+  printf("UnitTestFirstContact3DTime Succeed\n\n");
+
+}
+
+// Unit test of the continuous collision detection
+// Check FMBCCDTestFirstContact3DTime on the bodies P and Q during their
+// current step, in both orders, against the correct answer and time
+// of first contact, up to tolerance
+void UnitTestCCD3DTime(
+  const FMBCCDBody3DTime* const P,
+  const FMBCCDBody3DTime* const Q,
+  const bool correctAnswer,
+  const double correctTime,
+  const double tolerance) {
+
+  // Get the time of first contact
+  FMB_REAL tContact = -1.0;
+  bool isContact =
+    FMBCCDTestFirstContact3DTime(
+      P,
+      Q,
+      &tContact);
+  FMB_REAL tContactSwap = -1.0;
+  bool isContactSwap =
+    FMBCCDTestFirstContact3DTime(
+      Q,
+      P,
+      &tContactSwap);
+
+  // Check the results
+  if (
+    isContact != correctAnswer ||
+    isContactSwap != correctAnswer ||
+    (isContact == true &&
+    (fabs(tContact - correctTime) > tolerance ||
+    fabs(tContactSwap - correctTime) > tolerance))) {
+
+    printf("UnitTestCCD3DTime Failed\n");
+    Frame3DTimePrint(&(P->frame));
+    printf(" against ");
+    Frame3DTimePrint(&(Q->frame));
+    printf("\nExpected %d at %f, got %d at %f and %d at %f\n",
+      correctAnswer, correctTime, isContact, tContact,
+      isContactSwap, tContactSwap);
+    exit(0);
+
+  }
+
+}
+
+void TestCCD3DTime(void) {
+
+  // Unit Cuboid at the origin, at rest
+  FMB_REAL origP[3] = {0.0, 0.0, 0.0};
+  FMB_REAL compUnit[3][3] = {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+  FMBCCDBody3DTime P =
+    FMBCCDBodyCreate3DTime(
+      FrameCuboid,
+      origP,
+      compUnit);
+
+  // Unit Cuboid coming along the first axis
+  FMB_REAL origQ[3] = {3.0, 0.5, 0.5};
+  FMBCCDBody3DTime Q =
+    FMBCCDBodyCreate3DTime(
+      FrameCuboid,
+      origQ,
+      compUnit);
+
+  // First step, Q stops before P
+  FMBCCDBodyStep3DTime(
+    &P,
+    origP,
+    compUnit);
+  origQ[0] = 2.0;
+  FMBCCDBodyStep3DTime(
+    &Q,
+    origQ,
+    compUnit);
+  UnitTestCCD3DTime(
+    &P,
+    &Q,
+    false,
+    0.0,
+    EPSILON);
+
+  // Second step, Q reaches P at t=0.25
+  FMBCCDBodyStep3DTime(
+    &P,
+    origP,
+    compUnit);
+  origQ[0] = -2.0;
+  FMBCCDBodyStep3DTime(
+    &Q,
+    origQ,
+    compUnit);
+  UnitTestCCD3DTime(
+    &P,
+    &Q,
+    true,
+    0.25,
+    EPSILON);
+
+  // The result of the batch is the same
+  FMBCCDBody3DTime bodies[2] = {P, Q};
+  FMBCCDPair pairs[2] = {{.iThat = 0, .iTho = 1}, {.iThat = 1, .iTho = 0}};
+  unsigned long isContact[1];
+  FMB_REAL tContacts[2] = {-1.0, -1.0};
+  int nbContact =
+    FMBCCDTestPairs3DTime(
+      bodies,
+      pairs,
+      2,
+      isContact,
+      tContacts);
+  if (
+    nbContact != 2 ||
+    FMBBitsetGet(isContact, 0) == false ||
+    FMBBitsetGet(isContact, 1) == false ||
+    fabs(tContacts[0] - 0.25) > EPSILON ||
+    fabs(tContacts[1] - 0.25) > EPSILON) {
+
+    printf("UnitTestCCD3DTime pairs Failed\n");
+    printf("Expected 2 contacts at 0.25, got %d at %f %f\n",
+      nbContact, tContacts[0], tContacts[1]);
+    exit(0);
+
+  }
+
+  // Bar rotating by a quarter turn around the third axis, whose end
+  // crosses a small Cuboid in the middle of the step only. The points
+  // moving linearly, the first contact is at t~=0.3857
+  FMB_REAL compBarStart[3][3] =
+    {{1.0, 0.0, 0.0}, {0.0, 0.1, 0.0}, {0.0, 0.0, 0.1}};
+  FMB_REAL compBarEnd[3][3] =
+    {{0.0, 1.0, 0.0}, {-0.1, 0.0, 0.0}, {0.0, 0.0, 0.1}};
+  P =
+    FMBCCDBodyCreate3DTime(
+      FrameCuboid,
+      origP,
+      compBarStart);
+  FMBCCDBodyStep3DTime(
+    &P,
+    origP,
+    compBarEnd);
+  FMB_REAL origSmall[3] = {0.4, 0.4, 0.0};
+  FMB_REAL compSmall[3][3] =
+    {{0.1, 0.0, 0.0}, {0.0, 0.1, 0.0}, {0.0, 0.0, 0.1}};
+  Q =
+    FMBCCDBodyCreate3DTime(
+      FrameTetrahedron,
+      origSmall,
+      compSmall);
+  FMBCCDBodyStep3DTime(
+    &Q,
+    origSmall,
+    compSmall);
+  UnitTestCCD3DTime(
+    &P,
+    &Q,
+    true,
+    0.3857,
+    FMBGetCCDTimeTolerance3DTime());
+
+  // Without bisection the components of the middle of the step are
+  // used over the whole step
+  int maxDepth = FMBGetCCDMaxDepth3DTime();
+  FMBSetCCDMaxDepth3DTime(0);
+  UnitTestCCD3DTime(
+    &P,
+    &Q,
+    true,
+    0.0,
+    EPSILON);
+  FMBSetCCDMaxDepth3DTime(maxDepth);
+
+  // The next step starts from the end of the rotation, the bar moving
+  // away from the Cuboid
+  FMB_REAL origAway[3] = {-1.0, 0.0, 0.0};
+  FMBCCDBodyStep3DTime(
+    &P,
+    origAway,
+    compBarEnd);
+  UnitTestCCD3DTime(
+    &P,
+    &Q,
+    false,
+    0.0,
+    EPSILON);
+
+  // Cube rotating so little that its components vary by less than the
+  // tolerance during the step, approached so slowly by a small
+  // Tetrahedron that it is closer than the tolerance during most of the
+  // step. The first contact is at t~=0.6358, and the time of first
+  // contact is bounded by the time tolerance, not by the distance
+  FMB_REAL compRotStart[3][3] =
+    {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+  FMB_REAL compRotEnd[3][3] =
+    {{0.9999982, 0.0019, 0.0}, {-0.0019, 0.9999982, 0.0}, {0.0, 0.0, 1.0}};
+  P =
+    FMBCCDBodyCreate3DTime(
+      FrameCuboid,
+      origP,
+      compRotStart);
+  FMBCCDBodyStep3DTime(
+    &P,
+    origP,
+    compRotEnd);
+  FMB_REAL origSlowStart[3] = {1.002, 0.45, 0.45};
+  FMB_REAL origSlowEnd[3] = {0.998, 0.45, 0.45};
+  Q =
+    FMBCCDBodyCreate3DTime(
+      FrameTetrahedron,
+      origSlowStart,
+      compSmall);
+  FMBCCDBodyStep3DTime(
+    &Q,
+    origSlowEnd,
+    compSmall);
+  UnitTestCCD3DTime(
+    &P,
+    &Q,
+    true,
+    0.6358,
+    FMBGetCCDTimeTolerance3DTime());
+
+  printf("UnitTestCCD3DTime Succeed\n\n");
+
+}
+
 void Test3DTime(void) {
 
   // Declare two variables to memorize the arguments to the
@@ -349,6 +878,15 @@ void Test3DTime(void) {
     true,
     &correctBdgBox);
 
+  // ----------------------------
+  UnitTestMutation3DTime();
+
+  // ----------------------------
+  TestFirstContact3DTime();
+
+  // ----------------------------
+  TestCCD3DTime();
+
   // If we reached here, it means all the unit tests succeed
   printf("All unit tests 3DTime have succeed.\n");
 
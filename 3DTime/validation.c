@@ -36,6 +36,47 @@
 // Nb of tests of the validation
 #define NB_TESTS 1000000
 
+// Nb of Frames in the set used to validate the batch test
+#define NB_FRAMES_BATCH 1000
+
+// Maximum rate of disagreement between FMB and SAT, null in double
+// precision, in float precision both may be wrong on Frames closer
+// than the precision
+#ifdef FMB_REAL_FLOAT
+  #define MAX_DISAGREE_RATE 0.001
+#else
+  #define MAX_DISAGREE_RATE 0.0
+#endif
+
+// Maximum rate of disagreement between the fixed and adaptive orders
+// of elimination: the two orders round differently, and on ill
+// conditioned Frames (RandomFrame3DTime only rejects the nearly null
+// determinants) the difference may exceed the tolerance even in double
+// precision
+#ifdef FMB_REAL_FLOAT
+  #define MAX_DISAGREE_RATE_ORDER 0.001
+#else
+  #define MAX_DISAGREE_RATE_ORDER 0.00001
+#endif
+
+// Tolerance of the overlap of the bounding boxes given by the fixed
+// and adaptive orders of elimination, and of the difference of their
+// times of first contact
+#ifdef FMB_REAL_FLOAT
+  #define ORDER_TOLERANCE 1e-2
+#else
+  #define ORDER_TOLERANCE 1e-6
+#endif
+
+// Nb of steps of each pair of bodies, nb of pairs of rotating bodies,
+// largest rotation during a step, and nb of poses sampled during a
+// step of rotating bodies, in the validation of the continuous
+// collision detection
+#define NB_CCD_STEPS 4
+#define NB_CCD_TESTS_ROT 10000
+#define CCD_MAX_ANGLE 0.1
+#define NB_CCD_SAMPLES 64
+
 // Helper macro to generate random number in [0.0, 1.0]
 #define rnd() (double)(rand())/(double)(RAND_MAX)
 
@@ -44,19 +85,23 @@
 unsigned long int nbInter;
 unsigned long int nbNoInter;
 
+// Global variable to count nb of tests where FMB and SAT disagree
+unsigned long int nbDisagree;
+
 // Helper structure to pass arguments to the Validation function
 typedef struct {
 
   FrameType type;
-  double orig[3];
-  double comp[3][3];
-  double speed[3];
+  FMB_REAL orig[3];
+  FMB_REAL comp[3][3];
+  FMB_REAL speed[3];
 
 } Param3DTime;
 
 // Validation function
 // Takes two Frame definition as input, run the intersection test on
 // them with FMB and SAT, and check the results are identical
+// Check also the hybrid test gives the results of FMB
 void ValidationOnePair3DTime(
   const Param3DTime paramP,
   const Param3DTime paramQ) {
@@ -98,24 +143,75 @@ void ValidationOnePair3DTime(
         that,
         tho);
 
+    // Test intersection with the hybrid test for each set of filter
+    // axes, the result must be the one of FMB, or no intersection if
+    // a filter axis separates the Frames (then SAT agrees)
+    unsigned int hybridAxes[4] = {
+
+      FMB_HYBRID_AXES_NONE,
+      FMB_HYBRID_AXES_THAT,
+      FMB_HYBRID_AXES_THO,
+      FMB_HYBRID_AXES_ALL
+
+    };
+    unsigned int axes = FMBGetHybridAxes3DTime();
+    for (
+      int iAxes = 4;
+      iAxes--;) {
+
+      FMBSetHybridAxes3DTime(hybridAxes[iAxes]);
+      bool isIntersectingHybrid =
+        FMBHybridTestIntersection3DTime(
+          that,
+          tho,
+          NULL);
+      if (
+        isIntersectingHybrid != isIntersectingFMB &&
+        (isIntersectingHybrid == true || isIntersectingSAT == true)) {
+
+        // Print the disagreement
+        printf("ValidationHybrid3DTime has failed (axes 0x%x)\n",
+          hybridAxes[iAxes]);
+        Frame3DTimePrint(that);
+        printf(" against ");
+        Frame3DTimePrint(tho);
+        printf("\n");
+
+        // Stop the validation
+        exit(0);
+
+      }
+
+    }
+
+    FMBSetHybridAxes3DTime(axes);
+
     // If the results are different
     if (isIntersectingFMB != isIntersectingSAT) {
 
-      // Print the disagreement
-      printf("Validation3D has failed\n");
-      Frame3DTimePrint(that);
-      printf(" against ");
-      Frame3DTimePrint(tho);
-      printf("\n");
-      printf("FMB : ");
-      if (isIntersectingFMB == false) printf("no ");
-      printf("intersection\n");
-      printf("SAT : ");
-      if (isIntersectingSAT == false) printf("no ");
-      printf("intersection\n");
+      // Update the number of disagreements
+      ++nbDisagree;
 
-      // Stop the validation
-      exit(0);
+      // If no disagreement is tolerated
+      if (MAX_DISAGREE_RATE == 0.0) {
+
+        // Print the disagreement
+        printf("Validation3D has failed\n");
+        Frame3DTimePrint(that);
+        printf(" against ");
+        Frame3DTimePrint(tho);
+        printf("\n");
+        printf("FMB : ");
+        if (isIntersectingFMB == false) printf("no ");
+        printf("intersection\n");
+        printf("SAT : ");
+        if (isIntersectingSAT == false) printf("no ");
+        printf("intersection\n");
+
+        // Stop the validation
+        exit(0);
+
+      }
 
     }
 
@@ -154,6 +250,7 @@ void Validate3DTime(void) {
   // Initialize the number of intersection and no intersection
   nbInter = 0;
   nbNoInter = 0;
+  nbDisagree = 0;
 
   // Loop on the tests
   for (
@@ -228,11 +325,929 @@ void Validate3DTime(void) {
 
   }
 
+  // Check the rate of disagreement
+  double rateDisagree =
+    (double)nbDisagree / (double)(nbInter + nbNoInter);
+  if (rateDisagree > MAX_DISAGREE_RATE) {
+
+    printf("Validation3DTime has failed\n");
+    printf("Disagreement rate with SAT %e\n", rateDisagree);
+    exit(0);
+
+  }
+
   // If we reached here it means the validation was successfull
   // Print results
   printf("Validation3DTime has succeed.\n");
   printf("Tested %lu intersections ", nbInter);
   printf("and %lu no intersections\n", nbNoInter);
+  printf("Disagreement rate with SAT (%s) %e\n",
+    FMB_REAL_NAME, rateDisagree);
+
+}
+
+// Create a random non degenerated Frame
+Frame3DTime RandomFrame3DTime(void) {
+
+  // Loop until we get a non degenerated Frame
+  while (true) {
+
+    // 50% chance of being a Cuboid or a Tetrahedron
+    FrameType type = (rnd() < 0.5 ? FrameCuboid : FrameTetrahedron);
+
+    // Random origin and components
+    FMB_REAL orig[3];
+    FMB_REAL speed[3];
+    FMB_REAL comp[3][3];
+    for (
+      int iAxis = 3;
+      iAxis--;) {
+
+      orig[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+      speed[iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+
+      for (
+        int iComp = 3;
+        iComp--;) {
+
+        comp[iComp][iAxis] = -RANGE_AXIS + 2.0 * rnd() * RANGE_AXIS;
+
+      }
+
+    }
+
+    // If the determinant is not null, ie the Frame is not degenerate
+    double det =
+      comp[0][0] * (comp[1][1] * comp[2][2] -
+      comp[1][2] * comp[2][1]) -
+      comp[1][0] * (comp[0][1] * comp[2][2] -
+      comp[0][2] * comp[2][1]) +
+      comp[2][0] * (comp[0][1] * comp[1][2] -
+      comp[0][2] * comp[1][1]);
+    if (fabs(det) > EPSILON) {
+
+      return
+        Frame3DTimeCreateStatic(
+          type,
+          orig,
+        speed,
+          comp);
+
+    }
+
+  }
+
+}
+
+// Validation of the batch intersection test
+// Run FMBTestIntersection3DTimeBatch on random sets of Frames and check
+// its results (intersection and bounding box) are identical to the
+// ones of FMBTestIntersection3DTime on each pair
+void ValidateBatch3DTime(void) {
+
+  // Create the set of random Frames
+  Frame3DTime* frames = malloc(sizeof(Frame3DTime) * NB_FRAMES_BATCH);
+  for (
+    int iFrame = NB_FRAMES_BATCH;
+    iFrame--;) {
+
+    frames[iFrame] = RandomFrame3DTime();
+
+  }
+
+  // Allocate memory for the results
+  unsigned long* isIntersecting =
+    malloc(sizeof(unsigned long) * FMBBitsetNbWords(NB_FRAMES_BATCH));
+  AABB3DTime* bdgBoxes = malloc(sizeof(AABB3DTime) * NB_FRAMES_BATCH);
+
+  // Declare a variable to count the intersections
+  unsigned long nbInterBatch = 0;
+
+  // Loop on the Frames tested against all the others
+  for (
+    int iThat = NB_FRAMES_BATCH;
+    iThat--;) {
+
+    // Run the batch intersection test
+    FMBTestIntersection3DTimeBatch(
+      frames + iThat,
+      frames,
+      NB_FRAMES_BATCH,
+      isIntersecting,
+      bdgBoxes);
+
+    // Loop on the tested Frames
+    for (
+      int iTho = NB_FRAMES_BATCH;
+      iTho--;) {
+
+      // Run the single pair intersection test
+      AABB3DTime bdgBox;
+      bool isInter =
+        FMBTestIntersection3DTime(
+          frames + iThat,
+          frames + iTho,
+          &bdgBox);
+
+      // Check the intersection result
+      bool isInterBatch = (FMBBitsetGet(isIntersecting, iTho) == 1UL);
+      bool isSame = (isInter == isInterBatch);
+
+      // If the Frames intersect check the bounding box
+      if (isSame == true && isInter == true) {
+
+        ++nbInterBatch;
+        for (
+          int i = 4;
+          i--;) {
+
+          if (
+            bdgBox.min[i] != bdgBoxes[iTho].min[i] ||
+            bdgBox.max[i] != bdgBoxes[iTho].max[i]) {
+
+            isSame = false;
+
+          }
+
+        }
+
+      }
+
+      // If the results are different
+      if (isSame == false) {
+
+        // Print the disagreement
+        printf("ValidationBatch3DTime has failed\n");
+        Frame3DTimePrint(frames + iThat);
+        printf(" against ");
+        Frame3DTimePrint(frames + iTho);
+        printf("\n");
+
+        // Stop the validation
+        exit(0);
+
+      }
+
+    }
+
+  }
+
+  // Free memory
+  free(frames);
+  free(isIntersecting);
+  free(bdgBoxes);
+
+  // If we reached here it means the validation was successfull
+  // Print results
+  printf("ValidationBatch3DTime has succeed.\n");
+  printf("Tested %lu intersections ", nbInterBatch);
+  printf("and %lu no intersections\n",
+    (unsigned long)NB_FRAMES_BATCH * NB_FRAMES_BATCH - nbInterBatch);
+
+}
+
+// Validation of the pruning of redundant rows
+// Run FMBTestIntersection3DTime on random pairs of Frames with and
+// without pruning (and without bounding box, which enables more
+// pruning) and check the intersection results are identical.
+// Print the largest difference between the resulting bounding boxes
+// and the statistics of the pruning
+void ValidatePruning3DTime(void) {
+
+  // Declare variables to count the intersections and memorize the
+  // largest difference of bounding boxes
+  unsigned long nbInter = 0;
+  double maxDiffBdgBox = 0.0;
+
+  // Reset the statistics of the pruning
+  FMBResetPruneStats3DTime();
+
+  // Loop on the tests
+  for (
+    unsigned long iTest = NB_TESTS;
+    iTest--;) {
+
+    // Create two random Frames
+    Frame3DTime that = RandomFrame3DTime();
+    Frame3DTime tho = RandomFrame3DTime();
+
+    // Run the intersection test without and with pruning
+    AABB3DTime bdgBox;
+    FMBSetPruning3DTime(false);
+    bool isInter =
+      FMBTestIntersection3DTime(
+        &that,
+        &tho,
+        &bdgBox);
+
+    AABB3DTime bdgBoxPruned;
+    FMBSetPruning3DTime(true);
+    bool isInterPruned =
+      FMBTestIntersection3DTime(
+        &that,
+        &tho,
+        &bdgBoxPruned);
+
+    // Run the intersection test with pruning without bounding box
+    bool isInterPrunedNoBdgBox =
+      FMBTestIntersection3DTime(
+        &that,
+        &tho,
+        NULL);
+
+    // If the results are different
+    if (
+      isInter != isInterPruned ||
+      isInter != isInterPrunedNoBdgBox) {
+
+      // Print the disagreement
+      printf("ValidationPruning3DTime has failed\n");
+      Frame3DTimePrint(&that);
+      printf(" against ");
+      Frame3DTimePrint(&tho);
+      printf("\n");
+
+      // Stop the validation
+      exit(0);
+
+    }
+
+    // Update the largest difference of bounding boxes
+    if (isInter == true) {
+
+      ++nbInter;
+      for (
+        int i = 4;
+        i--;) {
+
+        double diff = fabs(bdgBox.min[i] - bdgBoxPruned.min[i]);
+        if (diff > maxDiffBdgBox) {
+
+          maxDiffBdgBox = diff;
+
+        }
+
+        diff = fabs(bdgBox.max[i] - bdgBoxPruned.max[i]);
+        if (diff > maxDiffBdgBox) {
+
+          maxDiffBdgBox = diff;
+
+        }
+
+      }
+
+    }
+
+  }
+
+  // Restore the default setting
+  FMBSetPruning3DTime(false);
+
+  // If we reached here it means the validation was successfull
+  // Print results
+  FMBPruneStats stats = FMBGetPruneStats3DTime();
+  printf("ValidationPruning3DTime has succeed.\n");
+  printf("Tested %lu intersections ", nbInter);
+  printf("and %lu no intersections\n", NB_TESTS - nbInter);
+  printf("Max difference of bounding boxes %e\n", maxDiffBdgBox);
+  printf("Examined %lu rows, removed %lu: ", stats.nbRows,
+    stats.nbDuplicate + stats.nbDominated + stats.nbTrivial);
+  printf("%lu duplicate, %lu dominated, %lu trivial\n",
+    stats.nbDuplicate, stats.nbDominated, stats.nbTrivial);
+
+}
+
+// Validation of the adaptive order of elimination of the variables
+// Run FMBTestIntersection3DTime and FMBTestFirstContact3DTime on
+// random pairs of Frames with the fixed and adaptive orders and check
+// the intersection results and the times of first contact are
+// identical and the two bounding boxes, which both contain the
+// intersection, overlap
+// Print the ratio of the total volumes of the adaptive and fixed
+// bounding boxes
+void ValidateElimOrder3DTime(void) {
+
+  // Declare variables to count the intersections and disagreements,
+  // and memorize the sums of volumes
+  unsigned long nbInter = 0;
+  unsigned long nbDisagreeOrder = 0;
+  double sumVolAdaptive = 0.0;
+  double sumVol = 0.0;
+
+  // Loop on the tests
+  for (
+    unsigned long iTest = NB_TESTS;
+    iTest--;) {
+
+    // Create two random Frames
+    Frame3DTime that = RandomFrame3DTime();
+    Frame3DTime tho = RandomFrame3DTime();
+
+    // Run the intersection tests with the fixed and adaptive orders
+    AABB3DTime bdgBox;
+    FMB_REAL tContact = 0.0;
+    FMBSetElimOrder3DTime(FMBElimOrderFixed);
+    bool isInter =
+      FMBTestIntersection3DTime(
+        &that,
+        &tho,
+        &bdgBox);
+    FMBTestFirstContact3DTime(
+      &that,
+      &tho,
+      &tContact);
+
+    AABB3DTime bdgBoxAdaptive;
+    FMB_REAL tContactAdaptive = 0.0;
+    FMBSetElimOrder3DTime(FMBElimOrderAdaptive);
+    bool isInterAdaptive =
+      FMBTestIntersection3DTime(
+        &that,
+        &tho,
+        &bdgBoxAdaptive);
+    bool isInterContactAdaptive =
+      FMBTestFirstContact3DTime(
+        &that,
+        &tho,
+        &tContactAdaptive);
+
+    // Check the results, the results of ill conditioned Frames, or in
+    // float precision of Frames closer than the precision, may be
+    // different
+    bool isValid = (isInterAdaptive == isInterContactAdaptive);
+    bool isSame = (isInter == isInterAdaptive);
+    if (
+      isSame == true &&
+      isInter == true) {
+
+      ++nbInter;
+      if (fabs(tContact - tContactAdaptive) > ORDER_TOLERANCE) {
+
+        isSame = false;
+
+      }
+
+      double volAdaptive = 1.0;
+      double vol = 1.0;
+      for (
+        int i = 4;
+        i--;) {
+
+        if (
+          bdgBoxAdaptive.min[i] > bdgBox.max[i] + ORDER_TOLERANCE ||
+          bdgBox.min[i] > bdgBoxAdaptive.max[i] + ORDER_TOLERANCE) {
+
+          isSame = false;
+
+        }
+
+        volAdaptive *= bdgBoxAdaptive.max[i] - bdgBoxAdaptive.min[i];
+        vol *= bdgBox.max[i] - bdgBox.min[i];
+
+      }
+
+      sumVolAdaptive += volAdaptive;
+      sumVol += vol;
+
+    }
+
+    if (isSame == false) {
+
+      ++nbDisagreeOrder;
+      isValid = isValid && (MAX_DISAGREE_RATE_ORDER > 0.0);
+
+    }
+
+    // If the results are invalid
+    if (isValid == false) {
+
+      // Print the disagreement
+      printf("ValidationElimOrder3DTime has failed\n");
+      Frame3DTimePrint(&that);
+      printf(" against ");
+      Frame3DTimePrint(&tho);
+      printf("\n");
+
+      // Stop the validation
+      exit(0);
+
+    }
+
+  }
+
+  // Restore the default setting
+  FMBSetElimOrder3DTime(FMBElimOrderFixed);
+
+  // Check the rate of disagreement
+  double rateDisagree = (double)nbDisagreeOrder / (double)NB_TESTS;
+  if (rateDisagree > MAX_DISAGREE_RATE_ORDER) {
+
+    printf("ValidationElimOrder3DTime has failed\n");
+    printf("Disagreement rate %e\n", rateDisagree);
+    exit(0);
+
+  }
+
+  // If we reached here it means the validation was successfull
+  // Print results
+  printf("ValidationElimOrder3DTime has succeed.\n");
+  printf("Tested %lu intersections ", nbInter);
+  printf("and %lu no intersections\n", NB_TESTS - nbInter);
+  if (sumVol > 0.0) {
+
+    printf("Total volume of the adaptive AABBs relative to the fixed ones %f\n",
+      sumVolAdaptive / sumVol);
+
+  }
+
+}
+
+// Validation of the time of first contact
+// Run FMBTestFirstContact3DTime on random pairs of Frames, without
+// and with pruning, and check the results are identical to the
+// intersection and the lower bound of time of the bounding box given
+// by FMBTestIntersection3DTime
+void ValidateFirstContact3DTime(void) {
+
+  // Declare variables to count the intersections and memorize the
+  // largest difference of time with pruning
+  unsigned long nbInterContact = 0;
+  double maxDiffTime = 0.0;
+
+  // Loop on the tests
+  for (
+    unsigned long iTest = NB_TESTS;
+    iTest--;) {
+
+    // Create two random Frames
+    Frame3DTime that = RandomFrame3DTime();
+    Frame3DTime tho = RandomFrame3DTime();
+
+    // Run the intersection test and the first contact query
+    AABB3DTime bdgBox;
+    bool isInter =
+      FMBTestIntersection3DTime(
+        &that,
+        &tho,
+        &bdgBox);
+    FMB_REAL tContact;
+    bool isInterContact =
+      FMBTestFirstContact3DTime(
+        &that,
+        &tho,
+        &tContact);
+    FMBSetPruning3DTime(true);
+    FMB_REAL tContactPruned;
+    bool isInterContactPruned =
+      FMBTestFirstContact3DTime(
+        &that,
+        &tho,
+        &tContactPruned);
+    FMBSetPruning3DTime(false);
+
+    // If the results are different
+    if (
+      isInter != isInterContact ||
+      isInter != isInterContactPruned ||
+      (isInter == true && tContact != bdgBox.min[3])) {
+
+      // Print the disagreement
+      printf("ValidationFirstContact3DTime has failed\n");
+      Frame3DTimePrint(&that);
+      printf(" against ");
+      Frame3DTimePrint(&tho);
+      printf("\n");
+
+      // Stop the validation
+      exit(0);
+
+    }
+
+    // Update the largest difference of time with pruning
+    if (isInter == true) {
+
+      ++nbInterContact;
+      double diff = fabs(tContact - tContactPruned);
+      if (diff > maxDiffTime) {
+
+        maxDiffTime = diff;
+
+      }
+
+    }
+
+  }
+
+  // If we reached here it means the validation was successfull
+  // Print results
+  printf("ValidationFirstContact3DTime has succeed.\n");
+  printf("Tested %lu intersections ", nbInterContact);
+  printf("and %lu no intersections\n", NB_TESTS - nbInterContact);
+  printf("Max difference of time with pruning %e\n", maxDiffTime);
+
+}
+
+// Validation of the vectorized projections of the vertices in the SAT
+// intersection test
+// Run SATTestIntersection3DTime with each implementation of the projection
+// on random pairs of Frames and check their results are identical to
+// the ones of the scalar projection
+void ValidateSATCheck3DTime(void) {
+
+  // Memorize the current implementation of the projection
+  SATCheckMode mode = SATGetCheckMode();
+
+  // Declare a variable to count the intersections
+  unsigned long nbInterCheck = 0;
+
+  // Loop on the tests
+  for (
+    unsigned long iTest = NB_TESTS;
+    iTest--;) {
+
+    // Create two random Frames
+    Frame3DTime that = RandomFrame3DTime();
+    Frame3DTime tho = RandomFrame3DTime();
+
+    // Run the intersection test with the scalar projection
+    SATSetCheckMode(SATCheckModeScalar);
+    bool isInter =
+      SATTestIntersection3DTime(
+        &that,
+        &tho);
+
+    // Loop on the vectorized projections
+    SATCheckMode checkModes[2] = {
+
+      SATCheckModeSIMD,
+      SATCheckModeSIMDAxes
+
+    };
+    for (
+      int iMode = 2;
+      iMode--;) {
+
+      // Run the intersection test
+      SATSetCheckMode(checkModes[iMode]);
+      bool isInterCheck =
+        SATTestIntersection3DTime(
+          &that,
+          &tho);
+
+      // If the results are different
+      if (isInter != isInterCheck) {
+
+        // Print the disagreement
+        printf("ValidationSATCheck3DTime has failed (mode %d)\n",
+          checkModes[iMode]);
+        Frame3DTimePrint(&that);
+        printf(" against ");
+        Frame3DTimePrint(&tho);
+        printf("\n");
+
+        // Stop the validation
+        exit(0);
+
+      }
+
+    }
+
+    if (isInter == true) {
+
+      ++nbInterCheck;
+
+    }
+
+  }
+
+  // Restore the implementation of the projection
+  SATSetCheckMode(mode);
+
+  // If we reached here it means the validation was successfull
+  // Print results
+  printf("ValidationSATCheck3DTime has succeed.\n");
+  printf("Tested %lu intersections ", nbInterCheck);
+  printf("and %lu no intersections\n", NB_TESTS - nbInterCheck);
+
+}
+
+// Validation of the continuous collision detection
+// Step pairs of random bodies moving without rotation and check the
+// results of FMBCCDTestFirstContact3DTime and FMBCCDTestPairs3DTime
+// are identical to the ones of FMBTestFirstContact3DTime on the Frames
+// created from scratch for each step
+// Then step pairs of random rotating bodies and compare their first
+// contact to the first of NB_CCD_SAMPLES poses sampled during the step
+// where they intersect, and check the contact is detected no later
+// than this pose (the detection being conservative). Print the rate
+// of contacts detected while none of the sampled poses intersect, the
+// largest advance of the time of first contact on the sampled one,
+// and the rate of advances greater than the time tolerance plus the
+// interval between samples (bodies closer than the tolerance before
+// coming into contact, cf FMBCCDTestFirstContact3DTime)
+void ValidateCCD3DTime(void) {
+
+  // Declare a variable to count the contacts
+  unsigned long nbContact = 0;
+
+  // Loop on the pairs of bodies moving without rotation
+  for (
+    unsigned long iTest = NB_TESTS / NB_CCD_STEPS;
+    iTest--;) {
+
+    // Create two random bodies
+    FMBCCDBody3DTime bodies[2];
+    for (
+      int iBody = 2;
+      iBody--;) {
+
+      Frame3DTime frame = RandomFrame3DTime();
+      bodies[iBody] =
+        FMBCCDBodyCreate3DTime(
+          frame.type,
+          frame.orig,
+          frame.comp);
+
+    }
+
+    // Loop on the steps
+    for (
+      int iStep = NB_CCD_STEPS;
+      iStep--;) {
+
+      // Move the bodies to a random position, and create their Frames
+      // for this step from scratch
+      Frame3DTime frames[2];
+      for (
+        int iBody = 2;
+        iBody--;) {
+
+        FMB_REAL orig[3];
+        FMB_REAL speed[3];
+        for (
+          int iAxis = 3;
+          iAxis--;) {
+
+          orig[iAxis] =
+            bodies[iBody].origEnd[iAxis] - RANGE_AXIS +
+            2.0 * rnd() * RANGE_AXIS;
+          speed[iAxis] = orig[iAxis] - bodies[iBody].origEnd[iAxis];
+
+        }
+
+        frames[iBody] =
+          Frame3DTimeCreateStatic(
+            bodies[iBody].frame.type,
+            bodies[iBody].origEnd,
+            speed,
+            bodies[iBody].compEnd);
+        FMBCCDBodyStep3DTime(
+          bodies + iBody,
+          orig,
+          bodies[iBody].compEnd);
+
+      }
+
+      // Get the times of first contact
+      FMB_REAL tContact = -1.0;
+      bool isContact =
+        FMBTestFirstContact3DTime(
+          frames,
+          frames + 1,
+          &tContact);
+      FMB_REAL tContactCCD = -1.0;
+      bool isContactCCD =
+        FMBCCDTestFirstContact3DTime(
+          bodies,
+          bodies + 1,
+          &tContactCCD);
+      FMBCCDPair pair = {.iThat = 0, .iTho = 1};
+      unsigned long isContactPairs[1];
+      FMB_REAL tContactPairs = -1.0;
+      int nbContactPairs =
+        FMBCCDTestPairs3DTime(
+          bodies,
+          &pair,
+          1,
+          isContactPairs,
+          &tContactPairs);
+
+      // If the results are different
+      if (
+        isContact != isContactCCD ||
+        isContact != FMBBitsetGet(isContactPairs, 0) ||
+        nbContactPairs != (isContact == true ? 1 : 0) ||
+        (isContact == true &&
+        (tContact != tContactCCD ||
+        tContact != tContactPairs))) {
+
+        // Print the disagreement
+        printf("ValidationCCD3DTime has failed\n");
+        Frame3DTimePrint(frames);
+        printf(" against ");
+        Frame3DTimePrint(frames + 1);
+        printf("\n");
+
+        // Stop the validation
+        exit(0);
+
+      }
+
+      if (isContact == true) {
+
+        ++nbContact;
+
+      }
+
+    }
+
+  }
+
+  // Declare variables to count the contacts of the rotating bodies
+  // and the disagreements with the sampled poses
+  unsigned long nbContactRot = 0;
+  unsigned long nbMiss = 0;
+  unsigned long nbExtra = 0;
+  unsigned long nbAdvance = 0;
+  double maxAdvance = 0.0;
+  double maxAdvanceTolerance =
+    FMBGetCCDTimeTolerance3DTime() + 1.0 / (double)NB_CCD_SAMPLES;
+
+  // Loop on the pairs of rotating bodies
+  for (
+    unsigned long iTest = NB_CCD_TESTS_ROT;
+    iTest--;) {
+
+    // Create two random bodies and move them during one step with a
+    // random rotation
+    FMBCCDBody3DTime bodies[2];
+    for (
+      int iBody = 2;
+      iBody--;) {
+
+      Frame3DTime frame = RandomFrame3DTime();
+      bodies[iBody] =
+        FMBCCDBodyCreate3DTime(
+          frame.type,
+          frame.orig,
+          frame.comp);
+      FMB_REAL axis[3];
+      FMB_REAL orig[3];
+      for (
+        int iAxis = 3;
+        iAxis--;) {
+
+        axis[iAxis] = -1.0 + 2.0 * rnd();
+        orig[iAxis] = frame.orig[iAxis] + frame.speed[iAxis];
+
+      }
+
+      Frame3DTimeRotate(
+        &frame,
+        axis,
+        CCD_MAX_ANGLE * (-1.0 + 2.0 * rnd()));
+      FMBCCDBodyStep3DTime(
+        bodies + iBody,
+        orig,
+        frame.comp);
+
+    }
+
+    // Get the time of first contact
+    FMB_REAL tContact = -1.0;
+    bool isContact =
+      FMBCCDTestFirstContact3DTime(
+        bodies,
+        bodies + 1,
+        &tContact);
+
+    // Search the first sampled pose where the bodies intersect
+    bool isContactSample = false;
+    double tContactSample = 0.0;
+    for (
+      int iSample = 0;
+      iSample <= NB_CCD_SAMPLES && isContactSample == false;
+      ++iSample) {
+
+      // Create the Frames at rest at the sampled pose
+      double t = (double)iSample / (double)NB_CCD_SAMPLES;
+      Frame3DTime frames[2];
+      for (
+        int iBody = 2;
+        iBody--;) {
+
+        const Frame3DTime* frame = &(bodies[iBody].frame);
+        FMB_REAL orig[3];
+        FMB_REAL speed[3] = {0.0, 0.0, 0.0};
+        FMB_REAL comp[3][3];
+        for (
+          int iAxis = 3;
+          iAxis--;) {
+
+          orig[iAxis] = frame->orig[iAxis] + t * frame->speed[iAxis];
+
+          for (
+            int iComp = 3;
+            iComp--;) {
+
+            comp[iComp][iAxis] =
+              frame->comp[iComp][iAxis] + t *
+              (bodies[iBody].compEnd[iComp][iAxis] -
+              frame->comp[iComp][iAxis]);
+
+          }
+
+        }
+
+        frames[iBody] =
+          Frame3DTimeCreateStatic(
+            frame->type,
+            orig,
+            speed,
+            comp);
+
+      }
+
+      isContactSample =
+        FMBTestIntersection3DTime(
+          frames,
+          frames + 1,
+          NULL);
+      tContactSample = t;
+
+    }
+
+    // Update the counters
+    if (isContact == true) {
+
+      ++nbContactRot;
+
+    }
+
+    if (
+      isContactSample == true &&
+      (isContact == false || tContact > tContactSample)) {
+
+      ++nbMiss;
+
+    }
+
+    if (
+      isContactSample == false &&
+      isContact == true) {
+
+      ++nbExtra;
+
+    }
+
+    if (
+      isContactSample == true &&
+      isContact == true &&
+      tContactSample - tContact > maxAdvance) {
+
+      maxAdvance = tContactSample - tContact;
+
+    }
+
+    if (
+      isContactSample == true &&
+      isContact == true &&
+      tContactSample - tContact > maxAdvanceTolerance) {
+
+      ++nbAdvance;
+
+    }
+
+  }
+
+  // If the rate of contacts missed or detected late is above the
+  // threshold
+  double rateMiss = (double)nbMiss / (double)NB_CCD_TESTS_ROT;
+  if (rateMiss > MAX_DISAGREE_RATE) {
+
+    printf("ValidationCCD3DTime has failed\n");
+    printf("Rate of contacts missed or detected late %e\n", rateMiss);
+
+    // Stop the validation
+    exit(0);
+
+  }
+
+  // If we reached here it means the validation was successfull
+  // Print results
+  printf("ValidationCCD3DTime has succeed.\n");
+  printf("Tested %lu contacts ", nbContact);
+  printf("and %lu no contacts\n",
+    NB_TESTS / NB_CCD_STEPS * NB_CCD_STEPS - nbContact);
+  printf("Rotating bodies: %lu contacts ", nbContactRot);
+  printf("and %lu no contacts\n", NB_CCD_TESTS_ROT - nbContactRot);
+  printf("Rate of contacts missed %e and detected %e relatively to ",
+    rateMiss,
+    (double)nbExtra / (double)NB_CCD_TESTS_ROT);
+  printf("%d sampled poses, max advance %e\n",
+    NB_CCD_SAMPLES, maxAdvance);
+  printf("Rate of advances greater than the time tolerance %e\n",
+    (double)nbAdvance / (double)NB_CCD_TESTS_ROT);
 
 }
 
@@ -240,6 +1255,12 @@ int main(int argc, char** argv) {
 
   printf("===== 3D dynamic ======\n");
   Validate3DTime();
+  ValidateBatch3DTime();
+  ValidatePruning3DTime();
+  ValidateElimOrder3DTime();
+  ValidateFirstContact3DTime();
+  ValidateSATCheck3DTime();
+  ValidateCCD3DTime();
 
   return 0;
 
@@ -0,0 +1,747 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "bench.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+  #include <x86intrin.h>
+#endif
+
+// ------------- Macros -------------
+
+// Minimum absolute value of the determinant of the components of the
+// Frames generated by BenchGenRandom and BenchGenNearCase
+#define BENCH_MIN_DET 0.1
+
+// Ratio between the short component and the other ones of the flat
+// Frames generated by BenchGenDegenerate
+#define BENCH_FLAT_RATIO 0.001
+
+// Maximum distance between the indices of the faces of a pair
+// generated by BenchGenMesh
+#define BENCH_MESH_NEIGHBOUR 16
+
+// Duration of the calibration of the cycle counter, in nanoseconds
+#define BENCH_CALIB_NS 20000000.0
+
+// Helper macro to generate random number in [0.0, 1.0]
+#define rnd() (double)(rand())/(double)(RAND_MAX)
+
+// ------------- Global variables -------------
+
+// Names of the generators, indexed by BenchGen
+static const char* const benchGenNames[BenchGenNb] = {
+
+  "random",
+  "nearcase",
+  "degenerate",
+  "mesh"
+
+};
+
+// ------------- Functions declaration -------------
+
+// Compare two doubles for qsort
+static int BenchCmpDouble(
+  const void* const a,
+  const void* const b);
+
+// Return the determinant of the nbDim first rows and columns of comp
+static double BenchGetDet(
+  const int nbDim,
+  const FMB_REAL comp[3][3]);
+
+// Generate a random Frame with BenchGenRandom into param
+static void BenchGenRandomParam(
+  const int nbDim,
+  const bool isMoving,
+  const FMB_REAL range,
+  BenchParam* const param);
+
+// Move the origin of Q to a random position in the AABB of P
+static void BenchMoveNear(
+  const int nbDim,
+  const BenchParam* const P,
+  BenchParam* const Q);
+
+// ------------- Functions implementation -------------
+
+// Return the current time of a monotonic clock, in nanoseconds
+double BenchGetNs(void) {
+
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (double)(t.tv_sec) * 1e9 + (double)(t.tv_nsec);
+
+}
+
+// Return the current value of the cycle counter
+uint64_t BenchGetCycles(void) {
+
+#if defined(__x86_64__) || defined(__i386__)
+
+  // Prevent the reordering of the instructions around the read of the
+  // counter
+  _mm_lfence();
+  uint64_t cycles = __rdtsc();
+  _mm_lfence();
+  return cycles;
+
+#else
+
+  return (uint64_t)BenchGetNs();
+
+#endif
+
+}
+
+// Return the nb of cycles of BenchGetCycles per nanosecond
+double BenchGetCyclesPerNs(void) {
+
+  static double cyclesPerNs = 0.0;
+  if (cyclesPerNs == 0.0) {
+
+    double startNs = BenchGetNs();
+    uint64_t startCycles = BenchGetCycles();
+    double stopNs = startNs;
+    while (stopNs - startNs < BENCH_CALIB_NS) {
+
+      stopNs = BenchGetNs();
+
+    }
+
+    uint64_t stopCycles = BenchGetCycles();
+    cyclesPerNs =
+      (double)(stopCycles - startCycles) / (stopNs - startNs);
+
+  }
+
+  return cyclesPerNs;
+
+}
+
+// Return the default configuration of the measurements
+BenchConfig BenchConfigDefault(void) {
+
+  BenchConfig config = {
+
+    .nbWarmup = 8,
+    .nbSample = 16,
+    .nbRepeat = 50
+
+  };
+  return config;
+
+}
+
+// Measure the execution time of test on the pair (that, tho) according
+// to config and store the summary of the samples, in cycles per call,
+// into stats
+// Return the result of the test
+bool BenchMeasurePair(
+  const BenchConfig* const config,
+  const BenchPairTest test,
+  const void* const that,
+  const void* const tho,
+  BenchStats* const stats) {
+
+  bool result = false;
+
+  // Warmup
+  for (
+    int i = config->nbWarmup;
+    i--;) {
+
+    result = test(that, tho);
+    BenchDoNotOptimize(result);
+
+  }
+
+  // Get the samples
+  double samples[BENCH_MAX_SAMPLE];
+  int nbSample = config->nbSample;
+  if (nbSample > BENCH_MAX_SAMPLE) {
+
+    nbSample = BENCH_MAX_SAMPLE;
+
+  }
+
+  for (
+    int iSample = nbSample;
+    iSample--;) {
+
+    uint64_t start = BenchGetCycles();
+    for (
+      int i = config->nbRepeat;
+      i--;) {
+
+      result = test(that, tho);
+      BenchDoNotOptimize(result);
+
+    }
+
+    uint64_t stop = BenchGetCycles();
+    samples[iSample] =
+      (double)(stop - start) / (double)(config->nbRepeat);
+
+  }
+
+  *stats =
+    BenchGetStats(
+      samples,
+      nbSample);
+
+  return result;
+
+}
+
+// Create an empty distribution
+BenchDist* BenchDistCreate(void) {
+
+  BenchDist* that = malloc(sizeof(BenchDist));
+  if (that == NULL) {
+
+    return NULL;
+
+  }
+
+  that->nb = 0;
+  that->capacity = 0;
+  that->values = NULL;
+  return that;
+
+}
+
+// Free the memory used by the distribution that
+void BenchDistFree(BenchDist** that) {
+
+  if (that == NULL || *that == NULL) {
+
+    return;
+
+  }
+
+  free((*that)->values);
+  free(*that);
+  *that = NULL;
+
+}
+
+// Remove all the values of the distribution that
+void BenchDistReset(BenchDist* const that) {
+
+  that->nb = 0;
+
+}
+
+// Add the value v to the distribution that
+void BenchDistAdd(
+  BenchDist* const that,
+  const double v) {
+
+  // Double the size of the array of values if it's full
+  if (that->nb == that->capacity) {
+
+    unsigned long capacity =
+      (that->capacity == 0 ? 1024 : that->capacity * 2);
+    double* values =
+      realloc(
+        that->values,
+        sizeof(double) * capacity);
+    if (values == NULL) {
+
+      return;
+
+    }
+
+    that->values = values;
+    that->capacity = capacity;
+
+  }
+
+  that->values[that->nb] = v;
+  ++(that->nb);
+
+}
+
+// Return the summary of the distribution that
+BenchStats BenchDistGetStats(const BenchDist* const that) {
+
+  if (that->nb == 0) {
+
+    BenchStats stats = {0};
+    return stats;
+
+  }
+
+  // Sort a copy of the values to keep the order of addition
+  double* values = malloc(sizeof(double) * that->nb);
+  memcpy(values, that->values, sizeof(double) * that->nb);
+  BenchStats stats =
+    BenchGetStats(
+      values,
+      that->nb);
+  free(values);
+  return stats;
+
+}
+
+// Compare two doubles for qsort
+static int BenchCmpDouble(
+  const void* const a,
+  const void* const b) {
+
+  double va = *(const double*)a;
+  double vb = *(const double*)b;
+  return (va > vb) - (va < vb);
+
+}
+
+// Return the summary of the nb values, which are sorted in place
+BenchStats BenchGetStats(
+  double* const values,
+  const unsigned long nb) {
+
+  BenchStats stats = {0};
+  if (nb == 0) {
+
+    return stats;
+
+  }
+
+  stats.nb = nb;
+  qsort(values, nb, sizeof(double), BenchCmpDouble);
+  stats.min = values[0];
+  stats.max = values[nb - 1];
+  double sum = 0.0;
+  for (
+    unsigned long i = nb;
+    i--;) {
+
+    sum += values[i];
+
+  }
+
+  stats.mean = sum / (double)nb;
+  stats.median =
+    0.5 * (values[(nb - 1) / 2] + values[nb / 2]);
+  unsigned long iP99 = (unsigned long)ceil(0.99 * (double)nb);
+  stats.p99 = values[iP99 - 1];
+
+  // Median absolute deviation, reusing the array of values
+  for (
+    unsigned long i = nb;
+    i--;) {
+
+    values[i] = fabs(values[i] - stats.median);
+
+  }
+
+  qsort(values, nb, sizeof(double), BenchCmpDouble);
+  stats.mad =
+    0.5 * (values[(nb - 1) / 2] + values[nb / 2]);
+
+  return stats;
+
+}
+
+// Return the determinant of the nbDim first rows and columns of comp
+static double BenchGetDet(
+  const int nbDim,
+  const FMB_REAL comp[3][3]) {
+
+  if (nbDim == 2) {
+
+    return comp[0][0] * comp[1][1] - comp[0][1] * comp[1][0];
+
+  }
+
+  return
+    comp[0][0] * (comp[1][1] * comp[2][2] -
+    comp[1][2] * comp[2][1]) -
+    comp[1][0] * (comp[0][1] * comp[2][2] -
+    comp[0][2] * comp[2][1]) +
+    comp[2][0] * (comp[0][1] * comp[1][2] -
+    comp[0][2] * comp[1][1]);
+
+}
+
+// Generate a random Frame with BenchGenRandom into param
+static void BenchGenRandomParam(
+  const int nbDim,
+  const bool isMoving,
+  const FMB_REAL range,
+  BenchParam* const param) {
+
+  memset(param, 0, sizeof(BenchParam));
+  do {
+
+    // 50% chance of being a Cuboid or a Tetrahedron
+    param->type = (rnd() < 0.5 ? FrameCuboid : FrameTetrahedron);
+    for (
+      int iAxis = nbDim;
+      iAxis--;) {
+
+      param->orig[iAxis] = -range + 2.0 * rnd() * range;
+      if (isMoving == true) {
+
+        param->speed[iAxis] = -range + 2.0 * rnd() * range;
+
+      }
+
+      for (
+        int iComp = nbDim;
+        iComp--;) {
+
+        param->comp[iComp][iAxis] = -range + 2.0 * rnd() * range;
+
+      }
+
+    }
+
+  } while (fabs(BenchGetDet(nbDim, param->comp)) < BENCH_MIN_DET);
+
+}
+
+// Move the origin of Q to a random position in the AABB of P
+static void BenchMoveNear(
+  const int nbDim,
+  const BenchParam* const P,
+  BenchParam* const Q) {
+
+  for (
+    int iAxis = nbDim;
+    iAxis--;) {
+
+    // Get the extent of P on this axis
+    FMB_REAL min = P->orig[iAxis];
+    FMB_REAL max = P->orig[iAxis];
+    for (
+      int iComp = nbDim;
+      iComp--;) {
+
+      if (P->comp[iComp][iAxis] < 0.0) {
+
+        min += P->comp[iComp][iAxis];
+
+      } else {
+
+        max += P->comp[iComp][iAxis];
+
+      }
+
+    }
+
+    Q->orig[iAxis] = min + rnd() * (max - min);
+
+  }
+
+}
+
+// Generate with gen a random pair of Frames into P and Q
+void BenchGenPair(
+  const BenchGen gen,
+  const int nbDim,
+  const bool isMoving,
+  const FMB_REAL range,
+  const BenchMesh* const mesh,
+  BenchParam* const P,
+  BenchParam* const Q) {
+
+  if (gen == BenchGenRandom) {
+
+    BenchGenRandomParam(nbDim, isMoving, range, P);
+    BenchGenRandomParam(nbDim, isMoving, range, Q);
+
+  } else if (
+    gen == BenchGenNearCase ||
+    (gen == BenchGenMesh && mesh == NULL)) {
+
+    BenchGenRandomParam(nbDim, isMoving, range, P);
+    BenchGenRandomParam(nbDim, isMoving, range, Q);
+    BenchMoveNear(nbDim, P, Q);
+
+  } else if (gen == BenchGenDegenerate) {
+
+    BenchGenRandomParam(nbDim, isMoving, range, P);
+
+    // Half of the pairs are Cuboids sharing a face, Q being P
+    // translated by its first component
+    if (rnd() < 0.5) {
+
+      P->type = FrameCuboid;
+      *Q = *P;
+      for (
+        int iAxis = nbDim;
+        iAxis--;) {
+
+        Q->orig[iAxis] += P->comp[0][iAxis];
+
+      }
+
+    // The other half are flat Frames near each other
+    } else {
+
+      BenchGenRandomParam(nbDim, isMoving, range, Q);
+      for (
+        int iAxis = nbDim;
+        iAxis--;) {
+
+        P->comp[nbDim - 1][iAxis] *= BENCH_FLAT_RATIO;
+        Q->comp[0][iAxis] *= BENCH_FLAT_RATIO;
+
+      }
+
+      BenchMoveNear(nbDim, P, Q);
+
+    }
+
+  } else if (gen == BenchGenMesh) {
+
+    // Get a random face and one of its neighbours in the file, the
+    // faces of a mesh being usually stored in spatially coherent
+    // order
+    int iP = (int)(rnd() * (double)(mesh->nb - 1));
+    int iQ =
+      iP + 1 + (int)(rnd() * (double)(BENCH_MESH_NEIGHBOUR - 1));
+    if (rnd() < 0.5) {
+
+      iQ = iP - (iQ - iP);
+
+    }
+
+    if (iQ < 0) {
+
+      iQ = 0;
+
+    } else if (iQ >= mesh->nb) {
+
+      iQ = mesh->nb - 1;
+
+    }
+
+    const Frame3D* frames[2] = {mesh->frames + iP, mesh->frames + iQ};
+    BenchParam* params[2] = {P, Q};
+    for (
+      int iFrame = 2;
+      iFrame--;) {
+
+      BenchParam* param = params[iFrame];
+      const Frame3D* frame = frames[iFrame];
+      memset(param, 0, sizeof(BenchParam));
+      param->type = frame->type;
+      for (
+        int iAxis = 3;
+        iAxis--;) {
+
+        param->orig[iAxis] = frame->orig[iAxis];
+        for (
+          int iComp = 3;
+          iComp--;) {
+
+          param->comp[iComp][iAxis] = frame->comp[iComp][iAxis];
+
+        }
+
+      }
+
+      // Moving Frames get a speed of the order of their size
+      if (isMoving == true) {
+
+        for (
+          int iAxis = nbDim;
+          iAxis--;) {
+
+          param->speed[iAxis] =
+            (2.0 * rnd() - 1.0) * param->comp[0][iAxis];
+
+        }
+
+      }
+
+    }
+
+  }
+
+}
+
+// Return the name of the generator gen
+const char* BenchGenGetName(const BenchGen gen) {
+
+  if (gen < BenchGenRandom || gen >= BenchGenNb) {
+
+    return "unknown";
+
+  }
+
+  return benchGenNames[gen];
+
+}
+
+// Return the generator named name, or BenchGenNb if there is none
+BenchGen BenchGenGetByName(const char* const name) {
+
+  for (
+    int iGen = BenchGenNb;
+    iGen--;) {
+
+    if (strcmp(name, benchGenNames[iGen]) == 0) {
+
+      return (BenchGen)iGen;
+
+    }
+
+  }
+
+  return BenchGenNb;
+
+}
+
+// Print on fp the header of the CSV output of BenchPrintCSV
+void BenchPrintCSVHeader(FILE* const fp) {
+
+  fprintf(fp, "case,nb,");
+  fprintf(fp, "minCycles,medianCycles,p99Cycles,madCycles,");
+  fprintf(fp, "meanCycles,maxCycles,medianNs,p99Ns\n");
+
+}
+
+// Print on fp the summary stats of the case named name as a CSV line
+void BenchPrintCSV(
+  FILE* const fp,
+  const char* const name,
+  const BenchStats* const stats) {
+
+  double cyclesPerNs = BenchGetCyclesPerNs();
+  fprintf(
+    fp,
+    "%s,%lu,%f,%f,%f,%f,%f,%f,%f,%f\n",
+    name,
+    stats->nb,
+    stats->min,
+    stats->median,
+    stats->p99,
+    stats->mad,
+    stats->mean,
+    stats->max,
+    stats->median / cyclesPerNs,
+    stats->p99 / cyclesPerNs);
+
+}
+
+// Print on fp the summary stats of the case named name as a JSON
+// object on one line
+void BenchPrintJSON(
+  FILE* const fp,
+  const char* const name,
+  const BenchStats* const stats) {
+
+  double cyclesPerNs = BenchGetCyclesPerNs();
+  fprintf(
+    fp,
+    "{\"case\": \"%s\", \"nb\": %lu, "
+    "\"minCycles\": %f, \"medianCycles\": %f, \"p99Cycles\": %f, "
+    "\"madCycles\": %f, \"meanCycles\": %f, \"maxCycles\": %f, "
+    "\"medianNs\": %f, \"p99Ns\": %f}\n",
+    name,
+    stats->nb,
+    stats->min,
+    stats->median,
+    stats->p99,
+    stats->mad,
+    stats->mean,
+    stats->max,
+    stats->median / cyclesPerNs,
+    stats->p99 / cyclesPerNs);
+
+}
+
+// Print on fp the header of the qualification results
+void BenchPrintQualifHeader(
+  FILE* const fp,
+  const char* const suffix) {
+
+  fprintf(fp, "percPairInter,");
+  fprintf(fp, "countInter%s,countNoInter%s,", suffix, suffix);
+  fprintf(
+    fp,
+    "minInter%s,avgInter%s,maxInter%s,",
+    suffix,
+    suffix,
+    suffix);
+  fprintf(
+    fp,
+    "minNoInter%s,avgNoInter%s,maxNoInter%s,",
+    suffix,
+    suffix,
+    suffix);
+  fprintf(
+    fp,
+    "minTotal%s,avgTotal%s,maxTotal%s\n",
+    suffix,
+    suffix,
+    suffix);
+
+}
+
+// Print on fp a line of the qualification results
+void BenchPrintQualif(
+  FILE* const fp,
+  const double percInter,
+  const BenchDist* const inter,
+  const BenchDist* const noInter) {
+
+  BenchStats statsInter = BenchDistGetStats(inter);
+  BenchStats statsNoInter = BenchDistGetStats(noInter);
+  fprintf(
+    fp,
+    "%.1f,",
+    percInter);
+  fprintf(
+    fp,
+    "%lu,%lu,",
+    statsInter.nb,
+    statsNoInter.nb);
+  fprintf(
+    fp,
+    "%f,%f,%f,",
+    statsInter.min,
+    statsInter.mean,
+    statsInter.max);
+  fprintf(
+    fp,
+    "%f,%f,%f,",
+    statsNoInter.min,
+    statsNoInter.mean,
+    statsNoInter.max);
+  double avg =
+    percInter * statsInter.mean + (1.0 - percInter) * statsNoInter.mean;
+  fprintf(
+    fp,
+    "%f,%f,%f\n",
+    (statsNoInter.min < statsInter.min ?
+      statsNoInter.min : statsInter.min),
+    avg,
+    (statsNoInter.max > statsInter.max ?
+      statsNoInter.max : statsInter.max));
+
+}
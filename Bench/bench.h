@@ -0,0 +1,250 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __BENCH_H_
+#define __BENCH_H_
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "frame.h"
+
+// Harness measuring the execution time of the intersection tests: each
+// measurement is a warmup followed by nbSample samples, a sample being
+// the number of cycles (rdtsc on x86, a monotonic clock elsewhere) of
+// nbRepeat consecutive calls divided by nbRepeat, and the samples are
+// summarized by their median, 99th percentile and median absolute
+// deviation, robust to the interruptions of the process
+
+// ------------- Macros -------------
+
+// Maximum nb of samples per measurement
+#define BENCH_MAX_SAMPLE 256
+
+// Prevent the compiler from optimizing away the computation of the
+// value x, without writing it to memory
+#define BenchDoNotOptimize(x) __asm__ volatile("" : : "g"(x) : "memory")
+
+// ------------- Enumerations -------------
+
+// Generators of pairs of Frames
+// BenchGenRandom: origin and components uniformly distributed in
+// [-range, range]
+// BenchGenNearCase: as BenchGenRandom, but the second Frame is moved
+// near the first one so that their AABBs intersect, as the pairs left
+// by a broadphase
+// BenchGenDegenerate: near case pairs of flat Frames (one component
+// 1000 times shorter than the others) and of Frames sharing a face
+// BenchGenMesh: Tetrahedrons of neighbour triangles of a mesh (cf
+// BenchMesh)
+typedef enum {
+
+  BenchGenRandom,
+  BenchGenNearCase,
+  BenchGenDegenerate,
+  BenchGenMesh,
+  BenchGenNb
+
+} BenchGen;
+
+// ------------- Data structures -------------
+
+// Parameters of a measurement
+typedef struct {
+
+  // Nb of calls before the first sample
+  int nbWarmup;
+
+  // Nb of samples, at most BENCH_MAX_SAMPLE
+  int nbSample;
+
+  // Nb of calls per sample
+  int nbRepeat;
+
+} BenchConfig;
+
+// Summary of a distribution of values
+typedef struct {
+
+  // Nb of values
+  unsigned long nb;
+
+  // Minimum, maximum and mean
+  double min;
+  double max;
+  double mean;
+
+  // Median, 99th percentile (nearest rank) and median absolute
+  // deviation from the median
+  double median;
+  double p99;
+  double mad;
+
+} BenchStats;
+
+// Distribution of values, growing as needed
+typedef struct {
+
+  // Nb of values and size of the array values
+  unsigned long nb;
+  unsigned long capacity;
+
+  // Values
+  double* values;
+
+} BenchDist;
+
+// Parameters of a Frame generated by the pair generators, in 3D,
+// lower dimensions using the first components
+typedef struct {
+
+  FrameType type;
+  FMB_REAL orig[3];
+  FMB_REAL speed[3];
+  FMB_REAL comp[3][3];
+
+} BenchParam;
+
+// Triangular mesh used by BenchGenMesh, as the Tetrahedrons of its
+// faces (cf PLYMeshCreateFrames3D in Bunny/ply.h)
+typedef struct {
+
+  // Nb of Tetrahedrons
+  int nb;
+
+  // Tetrahedrons, in the order of the faces in the file
+  Frame3D* frames;
+
+} BenchMesh;
+
+// Pair test measured by BenchMeasurePair, that and tho pointing to the
+// Frames of the pair
+typedef bool (*BenchPairTest)(
+  const void* const that,
+  const void* const tho);
+
+// ------------- Functions declaration -------------
+
+// Return the current time of a monotonic clock, in nanoseconds
+double BenchGetNs(void);
+
+// Return the current value of the cycle counter (rdtsc on x86, else
+// BenchGetNs())
+uint64_t BenchGetCycles(void);
+
+// Return the nb of cycles of BenchGetCycles per nanosecond, calibrated
+// against BenchGetNs at the first call
+double BenchGetCyclesPerNs(void);
+
+// Return the default configuration of the measurements: 8 calls of
+// warmup, 16 samples of 50 calls
+BenchConfig BenchConfigDefault(void);
+
+// Measure the execution time of test on the pair (that, tho) according
+// to config and store the summary of the samples, in cycles per call,
+// into stats
+// Return the result of the test
+bool BenchMeasurePair(
+  const BenchConfig* const config,
+  const BenchPairTest test,
+  const void* const that,
+  const void* const tho,
+  BenchStats* const stats);
+
+// Create an empty distribution
+BenchDist* BenchDistCreate(void);
+
+// Free the memory used by the distribution that
+void BenchDistFree(BenchDist** that);
+
+// Remove all the values of the distribution that
+void BenchDistReset(BenchDist* const that);
+
+// Add the value v to the distribution that
+void BenchDistAdd(
+  BenchDist* const that,
+  const double v);
+
+// Return the summary of the distribution that, null if it's empty
+BenchStats BenchDistGetStats(const BenchDist* const that);
+
+// Return the summary of the nb values, which are sorted in place
+BenchStats BenchGetStats(
+  double* const values,
+  const unsigned long nb);
+
+// Generate with gen a random pair of Frames of nbDim dimensions into P
+// and Q, moving if isMoving is true, with coordinates in
+// [-range, range] (except for BenchGenMesh)
+// mesh is used only by BenchGenMesh, which falls back to
+// BenchGenNearCase if it is null
+// Frames of BenchGenRandom and BenchGenNearCase whose components'
+// determinant is lower than 0.1 are regenerated
+void BenchGenPair(
+  const BenchGen gen,
+  const int nbDim,
+  const bool isMoving,
+  const FMB_REAL range,
+  const BenchMesh* const mesh,
+  BenchParam* const P,
+  BenchParam* const Q);
+
+// Return the name of the generator gen: "random", "nearcase",
+// "degenerate" or "mesh"
+const char* BenchGenGetName(const BenchGen gen);
+
+// Return the generator named name, or BenchGenNb if there is none
+BenchGen BenchGenGetByName(const char* const name);
+
+// Print on fp the header of the CSV output of BenchPrintCSV
+void BenchPrintCSVHeader(FILE* const fp);
+
+// Print on fp the summary stats, in cycles, of the case named name as
+// a CSV line: name, nb, then min, median, p99, mad, mean and max in
+// cycles, then median and p99 in nanoseconds
+void BenchPrintCSV(
+  FILE* const fp,
+  const char* const name,
+  const BenchStats* const stats);
+
+// Print on fp the summary stats, in cycles, of the case named name as
+// a JSON object on one line (JSON Lines), with the same fields as
+// BenchPrintCSV
+void BenchPrintJSON(
+  FILE* const fp,
+  const char* const name,
+  const BenchStats* const stats);
+
+// Print on fp the header of the qualification results (cf
+// BenchPrintQualif), suffix being appended to the names of the
+// columns
+void BenchPrintQualifHeader(
+  FILE* const fp,
+  const char* const suffix);
+
+// Print on fp a line of the qualification results: percInter, nb of
+// values of inter and noInter, min/mean/max of inter, of noInter, and
+// of both (the mean being weighted by percInter)
+void BenchPrintQualif(
+  FILE* const fp,
+  const double percInter,
+  const BenchDist* const inter,
+  const BenchDist* const noInter);
+
+#endif
@@ -0,0 +1,669 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Include standard libraries
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+// Include FMB and SAT algorithm library, the benchmark harness and the
+// PLY loader for the mesh generator
+#include "fmb2d.h"
+#include "fmb2dt.h"
+#include "fmb3d.h"
+#include "fmb3dt.h"
+#include "fmb3dface.h"
+#include "sat.h"
+#include "ply.h"
+#include "bench.h"
+#include "perfcounter.h"
+
+// Range of values for the random generation of Frames
+#define RANGE_AXIS 100.0
+
+// Default nb of pairs per generator and variant
+#define NB_PAIRS 10000
+
+// Scale applied to the mesh, to get Frames of the size of the random
+// ones
+#define MESH_SCALE 1000.0
+
+// Nb of variants of the intersection test
+#define NB_VARIANTS 5
+
+// Description of a variant of the intersection test
+typedef struct {
+
+  // Name of the variant
+  const char* name;
+
+  // Dimension and type of Frames
+  int nbDim;
+  bool isMoving;
+  bool isFace;
+
+  // Tests with FMB and SAT
+  BenchPairTest test[2];
+
+} Variant;
+
+// Frames of any variant
+typedef union {
+
+  Frame2D f2D;
+  Frame2DTime f2DTime;
+  Frame3D f3D;
+  Frame3DTime f3DTime;
+
+} AnyFrame;
+
+// Wrappers of the tests with the signature of BenchPairTest, the
+// bounding box not being computed
+bool TestFMB2D(
+  const void* const that,
+  const void* const tho) {
+
+  return FMBTestIntersection2D(that, tho, NULL);
+
+}
+
+bool TestSAT2D(
+  const void* const that,
+  const void* const tho) {
+
+  return SATTestIntersection2D(that, tho);
+
+}
+
+bool TestFMB2DTime(
+  const void* const that,
+  const void* const tho) {
+
+  return FMBTestIntersection2DTime(that, tho, NULL);
+
+}
+
+bool TestSAT2DTime(
+  const void* const that,
+  const void* const tho) {
+
+  return SATTestIntersection2DTime(that, tho);
+
+}
+
+bool TestFMB3D(
+  const void* const that,
+  const void* const tho) {
+
+  return FMBTestIntersection3D(that, tho, NULL);
+
+}
+
+bool TestSAT3D(
+  const void* const that,
+  const void* const tho) {
+
+  return SATTestIntersection3D(that, tho);
+
+}
+
+bool TestFMB3DTime(
+  const void* const that,
+  const void* const tho) {
+
+  return FMBTestIntersection3DTime(that, tho, NULL);
+
+}
+
+bool TestSAT3DTime(
+  const void* const that,
+  const void* const tho) {
+
+  return SATTestIntersection3DTime(that, tho);
+
+}
+
+bool TestFMB3DFace(
+  const void* const that,
+  const void* const tho) {
+
+  return FMBTestIntersection3DFace(that, tho, NULL);
+
+}
+
+bool TestSAT3DFace(
+  const void* const that,
+  const void* const tho) {
+
+  return SATTestIntersection3DFace(that, tho);
+
+}
+
+// Variants of the intersection test
+const Variant variants[NB_VARIANTS] = {
+
+  {"2D", 2, false, false, {TestFMB2D, TestSAT2D}},
+  {"2DTime", 2, true, false, {TestFMB2DTime, TestSAT2DTime}},
+  {"3D", 3, false, false, {TestFMB3D, TestSAT3D}},
+  {"3DTime", 3, true, false, {TestFMB3DTime, TestSAT3DTime}},
+  {"3DFace", 3, false, true, {TestFMB3DFace, TestSAT3DFace}}
+
+};
+
+// Names of the algorithms and pairs of types
+const char* const algoNames[2] = {"FMB", "SAT"};
+const char* const typeNames[2][2] = {{"CC", "CT"}, {"TC", "TT"}};
+const char* const interNames[2] = {"inter", "nointer"};
+
+// Create the Frame of the variant variant from param into frame
+void CreateFrame(
+  const Variant* const variant,
+  const BenchParam* const param,
+  AnyFrame* const frame) {
+
+  if (variant->nbDim == 2) {
+
+    FMB_REAL orig[2] = {param->orig[0], param->orig[1]};
+    FMB_REAL speed[2] = {param->speed[0], param->speed[1]};
+    FMB_REAL comp[2][2] = {
+
+      {param->comp[0][0], param->comp[0][1]},
+      {param->comp[1][0], param->comp[1][1]}
+
+    };
+    if (variant->isMoving == true) {
+
+      frame->f2DTime =
+        Frame2DTimeCreateStatic(
+          param->type,
+          orig,
+          speed,
+          comp);
+
+    } else {
+
+      frame->f2D =
+        Frame2DCreateStatic(
+          param->type,
+          orig,
+          comp);
+
+    }
+
+  } else if (variant->isMoving == true) {
+
+    frame->f3DTime =
+      Frame3DTimeCreateStatic(
+        param->type,
+        param->orig,
+        param->speed,
+        param->comp);
+
+  } else {
+
+    frame->f3D =
+      Frame3DCreateStatic(
+        param->type,
+        param->orig,
+        param->comp);
+    frame->f3D.isFace = variant->isFace;
+
+  }
+
+}
+
+// Benchmark the FMB and SAT tests of the variant variant on nbPair
+// pairs generated by gen, and print the results of each case
+// (algorithm, pair of types, intersection or not) on stdout and in
+// fpCSV and fpJSON
+// The samples of one case are the median time of each of its pairs
+// If counters is not null, the performance counters over
+// config->nbRepeat calls per pair are also measured and printed on
+// stdout and in fpPerf
+void BenchVariant(
+  const Variant* const variant,
+  const BenchGen gen,
+  const BenchMesh* const mesh,
+  const BenchConfig* const config,
+  const int nbPair,
+  PerfCounterGroup* const counters,
+  FILE* const fpCSV,
+  FILE* const fpJSON,
+  FILE* const fpPerf) {
+
+  // Create the distributions of each case [algo][thatType][thoType]
+  // [inter/nointer]
+  BenchDist* dists[2][2][2][2];
+  for (
+    int i = 16;
+    i--;) {
+
+    (&(dists[0][0][0][0]))[i] = BenchDistCreate();
+
+  }
+
+  // Reset the aggregated values of the performance counters
+  PerfCounterStats perfStats[2];
+  for (
+    int iAlgo = 2;
+    iAlgo--;) {
+
+    PerfCounterStatsReset(perfStats + iAlgo);
+
+  }
+
+  // Loop on the pairs
+  for (
+    int iPair = nbPair;
+    iPair--;) {
+
+    // Create the pair
+    BenchParam paramP;
+    BenchParam paramQ;
+    BenchGenPair(
+      gen,
+      variant->nbDim,
+      variant->isMoving,
+      RANGE_AXIS,
+      mesh,
+      &paramP,
+      &paramQ);
+    AnyFrame P;
+    AnyFrame Q;
+    CreateFrame(
+      variant,
+      &paramP,
+      &P);
+    CreateFrame(
+      variant,
+      &paramQ,
+      &Q);
+
+    // Measure the two algorithms, the case being the one given by
+    // SAT for both
+    BenchStats stats[2];
+    bool isInter[2];
+    for (
+      int iAlgo = 2;
+      iAlgo--;) {
+
+      isInter[iAlgo] =
+        BenchMeasurePair(
+          config,
+          variant->test[iAlgo],
+          &P,
+          &Q,
+          stats + iAlgo);
+
+    }
+
+    int iInter = (isInter[1] == true ? 0 : 1);
+    for (
+      int iAlgo = 2;
+      iAlgo--;) {
+
+      BenchDistAdd(
+        dists[iAlgo][paramP.type][paramQ.type][iInter],
+        stats[iAlgo].median);
+
+    }
+
+    // Measure the performance counters if requested
+    if (counters != NULL) {
+
+      for (
+        int iAlgo = 2;
+        iAlgo--;) {
+
+        PerfCounterMeasurePair(
+          counters,
+          variant->test[iAlgo],
+          &P,
+          &Q,
+          paramP.type,
+          paramQ.type,
+          config->nbRepeat,
+          perfStats + iAlgo);
+
+      }
+
+    }
+
+  }
+
+  // Print the results
+  for (
+    int iAlgo = 0;
+    iAlgo < 2;
+    ++iAlgo) {
+
+    for (
+      int i = 0;
+      i < 8;
+      ++i) {
+
+      int thatType = i / 4;
+      int thoType = (i / 2) % 2;
+      int iInter = i % 2;
+      BenchDist* dist = dists[iAlgo][thatType][thoType][iInter];
+      if (dist->nb == 0) {
+
+        continue;
+
+      }
+
+      char name[100];
+      sprintf(
+        name,
+        "%s/%s/%s/%s/%s",
+        variant->name,
+        algoNames[iAlgo],
+        typeNames[thatType][thoType],
+        interNames[iInter],
+        BenchGenGetName(gen));
+      BenchStats stats = BenchDistGetStats(dist);
+      printf(
+        "%-36s nb %6lu median %8.1f cycles (%7.1f ns) p99 %8.1f "
+        "mad %6.1f\n",
+        name,
+        stats.nb,
+        stats.median,
+        stats.median / BenchGetCyclesPerNs(),
+        stats.p99,
+        stats.mad);
+      BenchPrintCSV(
+        fpCSV,
+        name,
+        &stats);
+      BenchPrintJSON(
+        fpJSON,
+        name,
+        &stats);
+
+    }
+
+  }
+
+  // Print the performance counters
+  if (counters != NULL) {
+
+    for (
+      int iAlgo = 0;
+      iAlgo < 2;
+      ++iAlgo) {
+
+      char label[100];
+      sprintf(
+        label,
+        "%s/%s/%s",
+        variant->name,
+        algoNames[iAlgo],
+        BenchGenGetName(gen));
+      PerfCounterStatsPrint(
+        perfStats + iAlgo,
+        counters,
+        stdout,
+        label);
+      PerfCounterStatsPrintCSV(
+        perfStats + iAlgo,
+        counters,
+        fpPerf,
+        label);
+
+    }
+
+  }
+
+  for (
+    int i = 16;
+    i--;) {
+
+    BenchDistFree(&(&(dists[0][0][0][0]))[i]);
+
+  }
+
+}
+
+// Main function
+// Options:
+// -gen <random|nearcase|degenerate|mesh> : generator of pairs (all by
+// default)
+// -variant <2D|2DTime|3D|3DTime|3DFace> : variant of the test (all by
+// default)
+// -nbPair <n> : nb of pairs per generator and variant
+// -warmup <n>, -sample <n>, -repeat <n> : configuration of the
+// measurements (cf BenchConfig)
+// -mesh <path> : PLY file of the mesh generator
+// -csv <path>, -json <path> : output files
+// -perf <path> : measure the performance counters too, and save them
+// in the CSV file path
+int main(int argc, char** argv) {
+
+  // Default options
+  BenchGen gen = BenchGenNb;
+  const char* variantName = NULL;
+  int nbPair = NB_PAIRS;
+  BenchConfig config = BenchConfigDefault();
+  const char* pathMesh = "../Bunny/bun_zipper.ply";
+  const char* pathCSV = "../Results/benchmark.csv";
+  const char* pathJSON = "../Results/benchmark.json";
+  const char* pathPerf = NULL;
+
+  // Parse the arguments
+  for (
+    int iArg = 1;
+    iArg < argc - 1;
+    iArg += 2) {
+
+    if (strcmp(argv[iArg], "-gen") == 0) {
+
+      gen = BenchGenGetByName(argv[iArg + 1]);
+
+    } else if (strcmp(argv[iArg], "-variant") == 0) {
+
+      variantName = argv[iArg + 1];
+
+    } else if (strcmp(argv[iArg], "-nbPair") == 0) {
+
+      nbPair = atoi(argv[iArg + 1]);
+
+    } else if (strcmp(argv[iArg], "-warmup") == 0) {
+
+      config.nbWarmup = atoi(argv[iArg + 1]);
+
+    } else if (strcmp(argv[iArg], "-sample") == 0) {
+
+      config.nbSample = atoi(argv[iArg + 1]);
+
+    } else if (strcmp(argv[iArg], "-repeat") == 0) {
+
+      config.nbRepeat = atoi(argv[iArg + 1]);
+
+    } else if (strcmp(argv[iArg], "-mesh") == 0) {
+
+      pathMesh = argv[iArg + 1];
+
+    } else if (strcmp(argv[iArg], "-csv") == 0) {
+
+      pathCSV = argv[iArg + 1];
+
+    } else if (strcmp(argv[iArg], "-json") == 0) {
+
+      pathJSON = argv[iArg + 1];
+
+    } else if (strcmp(argv[iArg], "-perf") == 0) {
+
+      pathPerf = argv[iArg + 1];
+
+    } else {
+
+      printf("Unknown option %s\n", argv[iArg]);
+      return 1;
+
+    }
+
+  }
+
+  // Initialise the random generator
+  srandom(time(NULL));
+
+  // Load the mesh for the mesh generator, if it can't be loaded the
+  // generator falls back to near cases
+  BenchMesh mesh = {0, NULL};
+  PLYMesh* ply = NULL;
+  if (gen == BenchGenMesh || gen == BenchGenNb) {
+
+    ply =
+      PLYMeshLoad(
+        pathMesh,
+        MESH_SCALE);
+    if (ply != NULL) {
+
+      mesh.nb = ply->nbFace;
+      mesh.frames = malloc(sizeof(Frame3D) * (ply->nbFace + 1));
+      PLYMeshCreateFrames3D(
+        ply,
+        NULL,
+        NULL,
+        mesh.frames);
+
+    }
+
+  }
+
+  // Open the output files
+  FILE* fpCSV = fopen(pathCSV, "w");
+  FILE* fpJSON = fopen(pathJSON, "w");
+  if (fpCSV == NULL || fpJSON == NULL) {
+
+    printf("Can't open the output files\n");
+    return 1;
+
+  }
+
+  BenchPrintCSVHeader(fpCSV);
+
+  // Open the performance counters if requested
+  PerfCounterGroup perfCounters;
+  PerfCounterGroup* counters = NULL;
+  FILE* fpPerf = NULL;
+  if (pathPerf != NULL) {
+
+    if (PerfCounterOpen(&perfCounters) == false) {
+
+      printf("No performance counter available\n");
+      return 1;
+
+    }
+
+    fpPerf = fopen(pathPerf, "w");
+    if (fpPerf == NULL) {
+
+      printf("Can't open %s\n", pathPerf);
+      return 1;
+
+    }
+
+    PerfCounterPrintCSVHeader(fpPerf);
+    counters = &perfCounters;
+    printf("Performance counters:");
+    for (
+      int iCounter = 0;
+      iCounter < PerfCounterNb;
+      ++iCounter) {
+
+      printf(
+        " %s %s",
+        PerfCounterGetName((PerfCounterId)iCounter),
+        (PerfCounterIsAvailable(
+          counters,
+          (PerfCounterId)iCounter) == true ? "yes" : "no"));
+
+    }
+
+    printf("\n");
+
+  }
+  printf(
+    "%s, path %s, %.3f cycles/ns, %d warmup, %d samples of %d calls\n",
+    FMB_REAL_NAME,
+    FrameGetCPUPathName(FrameGetCPUPath()),
+    BenchGetCyclesPerNs(),
+    config.nbWarmup,
+    config.nbSample,
+    config.nbRepeat);
+
+  // Loop on the generators and variants
+  for (
+    int iGen = 0;
+    iGen < BenchGenNb;
+    ++iGen) {
+
+    if (gen != BenchGenNb && gen != (BenchGen)iGen) {
+
+      continue;
+
+    }
+
+    for (
+      int iVariant = 0;
+      iVariant < NB_VARIANTS;
+      ++iVariant) {
+
+      if (
+        variantName != NULL &&
+        strcmp(variantName, variants[iVariant].name) != 0) {
+
+        continue;
+
+      }
+
+      BenchVariant(
+        variants + iVariant,
+        (BenchGen)iGen,
+        (mesh.frames != NULL ? &mesh : NULL),
+        &config,
+        nbPair,
+        counters,
+        fpCSV,
+        fpJSON,
+        fpPerf);
+
+    }
+
+  }
+
+  // Free memory and close the files
+  fclose(fpCSV);
+  fclose(fpJSON);
+  if (counters != NULL) {
+
+    fclose(fpPerf);
+    PerfCounterClose(counters);
+
+  }
+
+  free(mesh.frames);
+  PLYMeshFree(&ply);
+
+  return 0;
+
+}
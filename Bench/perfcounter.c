@@ -0,0 +1,559 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "perfcounter.h"
+#include <string.h>
+#ifdef __linux__
+  #include <unistd.h>
+  #include <sys/ioctl.h>
+  #include <sys/syscall.h>
+  #include <linux/perf_event.h>
+#endif
+
+// ------------- Global variables -------------
+
+// Names of the counters, indexed by PerfCounterId
+static const char* const perfCounterNames[PerfCounterNb] = {
+
+  "cycles",
+  "instructions",
+  "branchMisses",
+  "L1DMisses",
+  "LLCMisses",
+  "taskClockNs"
+
+};
+
+// Names of the pairs of types and results
+static const char* const perfCounterTypeNames[2][2] = {
+
+  {"CC", "CT"},
+  {"TC", "TT"}
+
+};
+
+static const char* const perfCounterInterNames[2] = {
+
+  "inter",
+  "nointer"
+
+};
+
+// ------------- Functions declaration -------------
+
+#ifdef __linux__
+
+// Open the counter of type type and configuration config
+// Return its file descriptor, -1 if it's unavailable
+static int PerfCounterOpenEvent(
+  const uint32_t type,
+  const uint64_t config);
+
+#endif
+
+// Return the sum of the counter id in sums divided by nb, -1 if it's
+// unavailable in counters
+static double PerfCounterGetPerCall(
+  const PerfCounterGroup* const counters,
+  const PerfCounterId id,
+  const double* const sums,
+  const unsigned long nb);
+
+// ------------- Functions implementation -------------
+
+#ifdef __linux__
+
+// Open the counter of type type and configuration config
+// Return its file descriptor, -1 if it's unavailable
+static int PerfCounterOpenEvent(
+  const uint32_t type,
+  const uint64_t config) {
+
+  struct perf_event_attr attr;
+  memset(
+    &attr,
+    0,
+    sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = type;
+  attr.config = config;
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+
+  // pid 0 and cpu -1: the calling thread on any cpu
+  long fd =
+    syscall(
+      SYS_perf_event_open,
+      &attr,
+      0,
+      -1,
+      -1,
+      PERF_FLAG_FD_CLOEXEC);
+
+  return (int)fd;
+
+}
+
+#endif
+
+// Open the counters of the group that for the calling thread
+// Return true if at least one counter is available, false else
+bool PerfCounterOpen(PerfCounterGroup* const that) {
+
+  bool isAvailable = false;
+  for (
+    int iCounter = PerfCounterNb;
+    iCounter--;) {
+
+    that->fds[iCounter] = -1;
+
+  }
+
+#ifdef __linux__
+
+  // Type and configuration of each counter
+  const uint32_t types[PerfCounterNb] = {
+
+    PERF_TYPE_HARDWARE,
+    PERF_TYPE_HARDWARE,
+    PERF_TYPE_HARDWARE,
+    PERF_TYPE_HW_CACHE,
+    PERF_TYPE_HARDWARE,
+    PERF_TYPE_SOFTWARE
+
+  };
+  const uint64_t configs[PerfCounterNb] = {
+
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_BRANCH_MISSES,
+    PERF_COUNT_HW_CACHE_L1D |
+      (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+      (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_SW_TASK_CLOCK
+
+  };
+
+  for (
+    int iCounter = PerfCounterNb;
+    iCounter--;) {
+
+    that->fds[iCounter] =
+      PerfCounterOpenEvent(
+        types[iCounter],
+        configs[iCounter]);
+    if (that->fds[iCounter] >= 0) {
+
+      isAvailable = true;
+
+    }
+
+  }
+
+#endif
+
+  return isAvailable;
+
+}
+
+// Close the counters of the group that
+void PerfCounterClose(PerfCounterGroup* const that) {
+
+  for (
+    int iCounter = PerfCounterNb;
+    iCounter--;) {
+
+#ifdef __linux__
+
+    if (that->fds[iCounter] >= 0) {
+
+      close(that->fds[iCounter]);
+
+    }
+
+#endif
+
+    that->fds[iCounter] = -1;
+
+  }
+
+}
+
+// Return true if the counter id of the group that is available, false
+// else
+bool PerfCounterIsAvailable(
+  const PerfCounterGroup* const that,
+  const PerfCounterId id) {
+
+  return (that->fds[id] >= 0);
+
+}
+
+// Return the name of the counter id
+const char* PerfCounterGetName(const PerfCounterId id) {
+
+  if (id < 0 || id >= PerfCounterNb) {
+
+    return NULL;
+
+  }
+
+  return perfCounterNames[id];
+
+}
+
+// Reset and enable the counters of the group that
+void PerfCounterStart(PerfCounterGroup* const that) {
+
+#ifdef __linux__
+
+  for (
+    int iCounter = PerfCounterNb;
+    iCounter--;) {
+
+    if (that->fds[iCounter] >= 0) {
+
+      ioctl(
+        that->fds[iCounter],
+        PERF_EVENT_IOC_RESET,
+        0);
+      ioctl(
+        that->fds[iCounter],
+        PERF_EVENT_IOC_ENABLE,
+        0);
+
+    }
+
+  }
+
+#else
+
+  (void)that;
+
+#endif
+
+}
+
+// Disable the counters of the group that and store their values since
+// the last call to PerfCounterStart into values, unavailable counters
+// are set to 0
+void PerfCounterStop(
+  PerfCounterGroup* const that,
+  PerfCounterValues* const values) {
+
+  for (
+    int iCounter = 0;
+    iCounter < PerfCounterNb;
+    ++iCounter) {
+
+    values->values[iCounter] = 0;
+
+#ifdef __linux__
+
+    if (that->fds[iCounter] >= 0) {
+
+      ioctl(
+        that->fds[iCounter],
+        PERF_EVENT_IOC_DISABLE,
+        0);
+      uint64_t value = 0;
+      if (
+        read(
+          that->fds[iCounter],
+          &value,
+          sizeof(value)) == (ssize_t)sizeof(value)) {
+
+        values->values[iCounter] = value;
+
+      }
+
+    }
+
+#endif
+
+  }
+
+}
+
+// Reset the aggregated values that
+void PerfCounterStatsReset(PerfCounterStats* const that) {
+
+  memset(
+    that,
+    0,
+    sizeof(PerfCounterStats));
+
+}
+
+// Add the values of a measurement over nbCall calls to the test on
+// pairs of type (thatType, thoType) with result isInter to the
+// aggregated values that
+void PerfCounterStatsAdd(
+  PerfCounterStats* const that,
+  const FrameType thatType,
+  const FrameType thoType,
+  const bool isInter,
+  const PerfCounterValues* const values,
+  const unsigned long nbCall) {
+
+  int iInter = (isInter == true ? 0 : 1);
+  that->nbCall[thatType][thoType][iInter] += nbCall;
+  for (
+    int iCounter = PerfCounterNb;
+    iCounter--;) {
+
+    that->sums[thatType][thoType][iInter][iCounter] +=
+      (double)(values->values[iCounter]);
+
+  }
+
+}
+
+// Measure the counters of the group counters over nbRepeat calls to
+// test on the pair (that, tho) of types (thatType, thoType) and add
+// them to stats
+// Return the result of the test
+bool PerfCounterMeasurePair(
+  PerfCounterGroup* const counters,
+  const BenchPairTest test,
+  const void* const that,
+  const void* const tho,
+  const FrameType thatType,
+  const FrameType thoType,
+  const int nbRepeat,
+  PerfCounterStats* const stats) {
+
+  // Call the test once out of the measurement to get its result and
+  // warm the caches
+  bool result = test(that, tho);
+  BenchDoNotOptimize(result);
+
+  PerfCounterStart(counters);
+  for (
+    int i = nbRepeat;
+    i--;) {
+
+    bool res = test(that, tho);
+    BenchDoNotOptimize(res);
+
+  }
+
+  PerfCounterValues values;
+  PerfCounterStop(
+    counters,
+    &values);
+
+  PerfCounterStatsAdd(
+    stats,
+    thatType,
+    thoType,
+    result,
+    &values,
+    nbRepeat);
+
+  return result;
+
+}
+
+// Return the sum of the counter id in sums divided by nb, -1 if it's
+// unavailable in counters
+static double PerfCounterGetPerCall(
+  const PerfCounterGroup* const counters,
+  const PerfCounterId id,
+  const double* const sums,
+  const unsigned long nb) {
+
+  if (PerfCounterIsAvailable(counters, id) == false || nb == 0) {
+
+    return -1.0;
+
+  }
+
+  return sums[id] / (double)nb;
+
+}
+
+// Print on fp the header of the CSV output of PerfCounterStatsPrintCSV
+void PerfCounterPrintCSVHeader(FILE* const fp) {
+
+  fprintf(fp, "case,nbCall");
+  for (
+    int iCounter = 0;
+    iCounter < PerfCounterNb;
+    ++iCounter) {
+
+    fprintf(fp, ",%s", perfCounterNames[iCounter]);
+
+  }
+
+  fprintf(fp, "\n");
+
+}
+
+// Print on fp the aggregated values that as CSV lines
+void PerfCounterStatsPrintCSV(
+  const PerfCounterStats* const that,
+  const PerfCounterGroup* const counters,
+  FILE* const fp,
+  const char* const label) {
+
+  for (
+    int i = 0;
+    i < 8;
+    ++i) {
+
+    int thatType = i / 4;
+    int thoType = (i / 2) % 2;
+    int iInter = i % 2;
+    unsigned long nb = that->nbCall[thatType][thoType][iInter];
+    if (nb == 0) {
+
+      continue;
+
+    }
+
+    fprintf(
+      fp,
+      "%s/%s/%s,%lu",
+      label,
+      perfCounterTypeNames[thatType][thoType],
+      perfCounterInterNames[iInter],
+      nb);
+    for (
+      int iCounter = 0;
+      iCounter < PerfCounterNb;
+      ++iCounter) {
+
+      fprintf(
+        fp,
+        ",%f",
+        PerfCounterGetPerCall(
+          counters,
+          (PerfCounterId)iCounter,
+          that->sums[thatType][thoType][iInter],
+          nb));
+
+    }
+
+    fprintf(fp, "\n");
+
+  }
+
+}
+
+// Print on fp a readable summary of the aggregated values that
+void PerfCounterStatsPrint(
+  const PerfCounterStats* const that,
+  const PerfCounterGroup* const counters,
+  FILE* const fp,
+  const char* const label) {
+
+  for (
+    int i = 0;
+    i < 8;
+    ++i) {
+
+    int thatType = i / 4;
+    int thoType = (i / 2) % 2;
+    int iInter = i % 2;
+    unsigned long nb = that->nbCall[thatType][thoType][iInter];
+    if (nb == 0) {
+
+      continue;
+
+    }
+
+    const double* sums = that->sums[thatType][thoType][iInter];
+    fprintf(
+      fp,
+      "%s/%s/%s calls %lu",
+      label,
+      perfCounterTypeNames[thatType][thoType],
+      perfCounterInterNames[iInter],
+      nb);
+    for (
+      int iCounter = 0;
+      iCounter < PerfCounterNb;
+      ++iCounter) {
+
+      if (
+        PerfCounterIsAvailable(
+          counters,
+          (PerfCounterId)iCounter) == true) {
+
+        fprintf(
+          fp,
+          " %s %.1f",
+          perfCounterNames[iCounter],
+          sums[iCounter] / (double)nb);
+
+      }
+
+    }
+
+    // Ratios, if the counters are available
+    if (
+      PerfCounterIsAvailable(counters, PerfCounterCycles) == true &&
+      PerfCounterIsAvailable(counters, PerfCounterInstructions) == true &&
+      sums[PerfCounterCycles] > 0.0) {
+
+      fprintf(
+        fp,
+        " IPC %.2f",
+        sums[PerfCounterInstructions] / sums[PerfCounterCycles]);
+
+    }
+
+    if (
+      PerfCounterIsAvailable(counters, PerfCounterInstructions) == true &&
+      sums[PerfCounterInstructions] > 0.0) {
+
+      const PerfCounterId ids[3] = {
+
+        PerfCounterBranchMisses,
+        PerfCounterL1DMisses,
+        PerfCounterLLCMisses
+
+      };
+      for (
+        int iId = 0;
+        iId < 3;
+        ++iId) {
+
+        if (PerfCounterIsAvailable(counters, ids[iId]) == true) {
+
+          fprintf(
+            fp,
+            " %sPKI %.2f",
+            perfCounterNames[ids[iId]],
+            1000.0 * sums[ids[iId]] / sums[PerfCounterInstructions]);
+
+        }
+
+      }
+
+    }
+
+    fprintf(fp, "\n");
+
+  }
+
+}
@@ -0,0 +1,162 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __PERFCOUNTER_H_
+#define __PERFCOUNTER_H_
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "frame.h"
+#include "bench.h"
+
+// Instrumentation of the intersection tests with the hardware
+// performance counters of Linux (perf_event_open), counting the events
+// of the calling thread in user space only. The counters are read
+// around a call or a batch of calls and aggregated per pair of types
+// of Frames (CC, CT, TC, TT) and per result of the test. Counters
+// unavailable on the platform (other OS, virtual machine,
+// perf_event_paranoid) are reported as such and ignored.
+
+// ------------- Enumerations -------------
+
+// Events counted
+// PerfCounterTaskClock is a software event (time in nanoseconds),
+// available even when the hardware events are not
+typedef enum {
+
+  PerfCounterCycles,
+  PerfCounterInstructions,
+  PerfCounterBranchMisses,
+  PerfCounterL1DMisses,
+  PerfCounterLLCMisses,
+  PerfCounterTaskClock,
+  PerfCounterNb
+
+} PerfCounterId;
+
+// ------------- Data structures -------------
+
+// Set of opened counters
+typedef struct {
+
+  // File descriptors of the counters, -1 if unavailable
+  int fds[PerfCounterNb];
+
+} PerfCounterGroup;
+
+// Values of the counters over one measurement
+typedef struct {
+
+  uint64_t values[PerfCounterNb];
+
+} PerfCounterValues;
+
+// Aggregated values of the counters, [thatType][thoType][iInter],
+// iInter being 0 for the pairs in intersection and 1 for the others
+typedef struct {
+
+  // Nb of calls to the test
+  unsigned long nbCall[2][2][2];
+
+  // Sum of the values of each counter
+  double sums[2][2][2][PerfCounterNb];
+
+} PerfCounterStats;
+
+// ------------- Functions declaration -------------
+
+// Open the counters of the group that for the calling thread
+// Return true if at least one counter is available, false else
+bool PerfCounterOpen(PerfCounterGroup* const that);
+
+// Close the counters of the group that
+void PerfCounterClose(PerfCounterGroup* const that);
+
+// Return true if the counter id of the group that is available, false
+// else
+bool PerfCounterIsAvailable(
+  const PerfCounterGroup* const that,
+  const PerfCounterId id);
+
+// Return the name of the counter id
+const char* PerfCounterGetName(const PerfCounterId id);
+
+// Reset and enable the counters of the group that
+void PerfCounterStart(PerfCounterGroup* const that);
+
+// Disable the counters of the group that and store their values since
+// the last call to PerfCounterStart into values, unavailable counters
+// are set to 0
+void PerfCounterStop(
+  PerfCounterGroup* const that,
+  PerfCounterValues* const values);
+
+// Reset the aggregated values that
+void PerfCounterStatsReset(PerfCounterStats* const that);
+
+// Add the values of a measurement over nbCall calls to the test on
+// pairs of type (thatType, thoType) with result isInter to the
+// aggregated values that
+// Can be used per call (nbCall = 1), per repeated calls or per batch
+void PerfCounterStatsAdd(
+  PerfCounterStats* const that,
+  const FrameType thatType,
+  const FrameType thoType,
+  const bool isInter,
+  const PerfCounterValues* const values,
+  const unsigned long nbCall);
+
+// Measure the counters of the group counters over nbRepeat calls to
+// test on the pair (that, tho) of types (thatType, thoType) and add
+// them to stats
+// Return the result of the test
+bool PerfCounterMeasurePair(
+  PerfCounterGroup* const counters,
+  const BenchPairTest test,
+  const void* const that,
+  const void* const tho,
+  const FrameType thatType,
+  const FrameType thoType,
+  const int nbRepeat,
+  PerfCounterStats* const stats);
+
+// Print on fp the header of the CSV output of PerfCounterStatsPrintCSV
+void PerfCounterPrintCSVHeader(FILE* const fp);
+
+// Print on fp the aggregated values that as CSV lines, one per pair of
+// types and result, the name of each line being label followed by the
+// pair of types and the result, and the values being per call
+// (-1 for the unavailable counters of the group counters)
+void PerfCounterStatsPrintCSV(
+  const PerfCounterStats* const that,
+  const PerfCounterGroup* const counters,
+  FILE* const fp,
+  const char* const label);
+
+// Print on fp a readable summary of the aggregated values that, per
+// pair of types and result: the values per call, the instructions per
+// cycle and the branch and cache misses per thousand instructions
+void PerfCounterStatsPrint(
+  const PerfCounterStats* const that,
+  const PerfCounterGroup* const counters,
+  FILE* const fp,
+  const char* const label);
+
+#endif
@@ -0,0 +1,1199 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "broadphase.h"
+
+// ------------- Functions declaration -------------
+
+// Return true if the endpoint a is before the endpoint b: lower
+// position, or same position with a being a min endpoint and b a max
+// one (bounding boxes in contact are considered intersecting)
+static inline bool SAPEndpointIsBefore(
+  const SAPEndpoint* const a,
+  const SAPEndpoint* const b);
+
+// Comparison function of endpoints for qsort
+static int SAPEndpointCmp(
+  const void* a,
+  const void* b);
+
+// Sort the nbEndpoint endpoints, with qsort if isFullSort is true,
+// else with an insertion sort from their previous order, and add the
+// number of swaps of the insertion sort to nbSwap
+static void SAPSortEndpoints(
+  SAPEndpoint* const endpoints,
+  const int nbEndpoint,
+  const bool isFullSort,
+  unsigned long* const nbSwap);
+
+// Get the axis along which the variance of the centers of the
+// bounding boxes of the nbFrame Frames frames is the largest, and
+// the variance along each axis in var
+static int SAP3DGetAxisMaxVar(
+  const Frame3D* const frames,
+  const int nbFrame,
+  FMB_REAL var[3]);
+
+// Allocate the arrays of the SAP3D that for nbFrame Frames and set
+// the endpoints of the Frames frames in their index order
+static void SAP3DInit(
+  SAP3D* const that,
+  const Frame3D* const frames,
+  const int nbFrame);
+
+// Get the axis along which the variance of the centers of the
+// bounding boxes of the nbFrame Frames frames is the largest among
+// the spatial axes, and
+// the variance along each axis in var
+static int SAP2DTimeGetAxisMaxVar(
+  const Frame2DTime* const frames,
+  const int nbFrame,
+  FMB_REAL var[2]);
+
+// Allocate the arrays of the SAP2DTime that for nbFrame Frames and set
+// the endpoints of the Frames frames in their index order
+static void SAP2DTimeInit(
+  SAP2DTime* const that,
+  const Frame2DTime* const frames,
+  const int nbFrame);
+
+// Get the axis along which the variance of the centers of the
+// bounding boxes of the nbFrame Frames frames is the largest among
+// the spatial axes, and
+// the variance along each axis in var
+static int SAP3DTimeGetAxisMaxVar(
+  const Frame3DTime* const frames,
+  const int nbFrame,
+  FMB_REAL var[3]);
+
+// Allocate the arrays of the SAP3DTime that for nbFrame Frames and set
+// the endpoints of the Frames frames in their index order
+static void SAP3DTimeInit(
+  SAP3DTime* const that,
+  const Frame3DTime* const frames,
+  const int nbFrame);
+
+// ------------- Functions implementation -------------
+
+// Return true if the endpoint a is before the endpoint b
+static inline bool SAPEndpointIsBefore(
+  const SAPEndpoint* const a,
+  const SAPEndpoint* const b) {
+
+  return
+    a->val < b->val ||
+    (a->val == b->val && a->isMax == false && b->isMax == true);
+
+}
+
+// Comparison function of endpoints for qsort
+static int SAPEndpointCmp(
+  const void* a,
+  const void* b) {
+
+  if (SAPEndpointIsBefore(a, b) == true) {
+
+    return -1;
+
+  } else if (SAPEndpointIsBefore(b, a) == true) {
+
+    return 1;
+
+  }
+
+  return 0;
+
+}
+
+// Sort the nbEndpoint endpoints
+static void SAPSortEndpoints(
+  SAPEndpoint* const endpoints,
+  const int nbEndpoint,
+  const bool isFullSort,
+  unsigned long* const nbSwap) {
+
+  // If the endpoints need a full sort
+  if (isFullSort == true) {
+
+    qsort(
+      endpoints,
+      nbEndpoint,
+      sizeof(SAPEndpoint),
+      SAPEndpointCmp);
+
+  // Else, resort them from their previous order
+  } else {
+
+    for (
+      int iEndpoint = 1;
+      iEndpoint < nbEndpoint;
+      ++iEndpoint) {
+
+      SAPEndpoint endpoint = endpoints[iEndpoint];
+      int jEndpoint = iEndpoint;
+      while (
+        jEndpoint > 0 &&
+        SAPEndpointIsBefore(
+          &endpoint,
+          endpoints + jEndpoint - 1) == true) {
+
+        endpoints[jEndpoint] = endpoints[jEndpoint - 1];
+        --jEndpoint;
+        ++(*nbSwap);
+
+      }
+
+      endpoints[jEndpoint] = endpoint;
+
+    }
+
+  }
+
+}
+
+// Get the axis along which the variance of the centers of the
+// bounding boxes of the nbFrame Frames frames is the largest
+static int SAP3DGetAxisMaxVar(
+  const Frame3D* const frames,
+  const int nbFrame,
+  FMB_REAL var[3]) {
+
+  // If there is no Frame, all the variances are null
+  if (nbFrame == 0) {
+
+    var[0] = var[1] = var[2] = 0.0;
+    return 0;
+
+  }
+
+  // Declare variables to sum the centers and their square
+  FMB_REAL sum[3] = {0.0, 0.0, 0.0};
+  FMB_REAL sumSq[3] = {0.0, 0.0, 0.0};
+
+  // Loop on the Frames
+  for (
+    int iFrame = nbFrame;
+    iFrame--;) {
+
+    // Shortcut
+    const AABB3D* bdgBox = &(frames[iFrame].bdgBox);
+
+    for (
+      int iAxis = 3;
+      iAxis--;) {
+
+      FMB_REAL center = 0.5 * (bdgBox->min[iAxis] + bdgBox->max[iAxis]);
+      sum[iAxis] += center;
+      sumSq[iAxis] += center * center;
+
+    }
+
+  }
+
+  // Calculate the variances and get the axis with the largest one
+  int axis = 0;
+  for (
+    int iAxis = 3;
+    iAxis--;) {
+
+    FMB_REAL mean = sum[iAxis] / (FMB_REAL)nbFrame;
+    var[iAxis] = sumSq[iAxis] / (FMB_REAL)nbFrame - mean * mean;
+
+  }
+
+  for (
+    int iAxis = 1;
+    iAxis < 3;
+    ++iAxis) {
+
+    if (var[iAxis] > var[axis]) {
+
+      axis = iAxis;
+
+    }
+
+  }
+
+  return axis;
+
+}
+
+// Allocate the arrays of the SAP3D that for nbFrame Frames and set
+// the endpoints of the Frames frames in their index order
+static void SAP3DInit(
+  SAP3D* const that,
+  const Frame3D* const frames,
+  const int nbFrame) {
+
+  // Free the arrays of the previous set of Frames
+  free(that->endpoints);
+  free(that->active);
+  free(that->posActive);
+  free(that->activeBdgBox);
+
+  // Allocate memory for the new set of Frames
+  that->nbFrame = nbFrame;
+  that->endpoints = malloc(sizeof(SAPEndpoint) * 2 * (nbFrame + 1));
+  that->active = malloc(sizeof(int) * (nbFrame + 1));
+  that->posActive = malloc(sizeof(int) * (nbFrame + 1));
+  that->activeBdgBox = malloc(sizeof(AABB3D) * (nbFrame + 1));
+  if (
+    that->endpoints == NULL ||
+    that->active == NULL ||
+    that->posActive == NULL ||
+    that->activeBdgBox == NULL) {
+
+    printf("SAP3DInit: failed to allocate memory\n");
+    exit(0);
+
+  }
+
+  // Set the endpoints
+  for (
+    int iFrame = nbFrame;
+    iFrame--;) {
+
+    SAPEndpoint* endpoint = that->endpoints + 2 * iFrame;
+    endpoint[0].iFrame = iFrame;
+    endpoint[0].isMax = false;
+    endpoint[0].val = frames[iFrame].bdgBox.min[that->axis];
+    endpoint[1].iFrame = iFrame;
+    endpoint[1].isMax = true;
+    endpoint[1].val = frames[iFrame].bdgBox.max[that->axis];
+
+  }
+
+}
+
+// Create a new SAP3D, empty until the first call to SAP3DUpdate
+SAP3D* SAP3DCreate(void) {
+
+  // Allocate memory for the SAP3D
+  SAP3D* that = malloc(sizeof(SAP3D));
+  if (that == NULL) {
+
+    printf("SAP3DCreate: failed to allocate memory\n");
+    exit(0);
+
+  }
+
+  // Initialize the properties
+  that->nbFrame = 0;
+  that->axis = 0;
+  that->endpoints = NULL;
+  that->active = NULL;
+  that->posActive = NULL;
+  that->activeBdgBox = NULL;
+  that->nbSwap = 0;
+  that->nbCandidate = 0;
+  that->nbIntersection = 0;
+
+  // Return the new SAP3D
+  return that;
+
+}
+
+// Free the memory used by the SAP3D that
+void SAP3DFree(SAP3D** that) {
+
+  if (that == NULL || *that == NULL) {
+
+    return;
+
+  }
+
+  free((*that)->endpoints);
+  free((*that)->active);
+  free((*that)->posActive);
+  free((*that)->activeBdgBox);
+  free(*that);
+  *that = NULL;
+
+}
+
+// Update the SAP3D that with the nbFrame Frames frames
+void SAP3DUpdate(
+  SAP3D* const that,
+  const Frame3D* const frames,
+  const int nbFrame) {
+
+  // Reset the statistics
+  that->nbSwap = 0;
+
+  // Get the axis of largest variance
+  FMB_REAL var[3];
+  int axis =
+    SAP3DGetAxisMaxVar(
+      frames,
+      nbFrame,
+      var);
+
+  // Declare a flag to memorize if the endpoints need a full sort
+  bool isFullSort = false;
+
+  // If the axis of largest variance is significantly better than
+  // the current sweep axis
+  if (
+    axis != that->axis &&
+    var[axis] > SAP_AXIS_SWITCH_RATIO * var[that->axis]) {
+
+    // Change the sweep axis
+    that->axis = axis;
+    isFullSort = true;
+
+  }
+
+  // If the set of Frames has changed, reset the endpoints
+  if (nbFrame != that->nbFrame || that->endpoints == NULL) {
+
+    SAP3DInit(
+      that,
+      frames,
+      nbFrame);
+    isFullSort = true;
+
+  // Else, update the position of the endpoints
+  } else {
+
+    for (
+      int iEndpoint = 2 * nbFrame;
+      iEndpoint--;) {
+
+      SAPEndpoint* endpoint = that->endpoints + iEndpoint;
+      const AABB3D* bdgBox = &(frames[endpoint->iFrame].bdgBox);
+      endpoint->val =
+        (endpoint->isMax ? bdgBox->max : bdgBox->min)[that->axis];
+
+    }
+
+  }
+
+  // Sort the endpoints
+  SAPSortEndpoints(
+    that->endpoints,
+    2 * nbFrame,
+    isFullSort,
+    &(that->nbSwap));
+
+}
+
+// Sweep the endpoints of the SAP3D that and run the narrow phase on
+// the pairs of Frames whose bounding boxes intersect
+unsigned long SAP3DCollide(
+  SAP3D* const that,
+  const Frame3D* const frames,
+  const SAP3DCallback callback,
+  void* const data) {
+
+  // Reset the statistics
+  that->nbCandidate = 0;
+  that->nbIntersection = 0;
+
+  // Shortcuts
+  int* active = that->active;
+  int* posActive = that->posActive;
+  AABB3D* activeBdgBox = that->activeBdgBox;
+  const SAPEndpoint* endpoints = that->endpoints;
+
+  // Get the two axes other than the sweep axis
+  const int axisA = (that->axis + 1) % 3;
+  const int axisB = (that->axis + 2) % 3;
+
+  // Declare a variable to memorize the number of active Frames
+  int nbActive = 0;
+
+  // Loop on the endpoints
+  for (
+    int iEndpoint = 0;
+    iEndpoint < 2 * that->nbFrame;
+    ++iEndpoint) {
+
+    // Shortcut
+    const int iFrame = endpoints[iEndpoint].iFrame;
+
+    // If it's the min endpoint of the Frame
+    if (endpoints[iEndpoint].isMax == false) {
+
+      // Shortcut
+      const AABB3D* bdgBox = &(frames[iFrame].bdgBox);
+
+      // Loop on the active Frames, which intersect the Frame along
+      // the sweep axis
+      for (
+        int iActive = 0;
+        iActive < nbActive;
+        ++iActive) {
+
+        // Shortcut
+        const int jFrame = active[iActive];
+
+        // If the bounding boxes intersect (the test is done inline
+        // rather than with AABBTestIntersection3D as it's the
+        // bottleneck of the sweep, and it's useless to check the sweep
+        // axis)
+        const AABB3D* activeBox = activeBdgBox + iActive;
+        bool isIntersectingAABB =
+          bdgBox->min[axisA] <= activeBox->max[axisA] &&
+          activeBox->min[axisA] <= bdgBox->max[axisA] &&
+          bdgBox->min[axisB] <= activeBox->max[axisB] &&
+          activeBox->min[axisB] <= bdgBox->max[axisB];
+        if (isIntersectingAABB == true) {
+
+          ++(that->nbCandidate);
+
+          // Run the narrow phase, in the index order of the Frames
+          const int iMin = (iFrame < jFrame ? iFrame : jFrame);
+          const int iMax = (iFrame < jFrame ? jFrame : iFrame);
+          bool isIntersecting =
+            FMBTestIntersection3D(
+              frames + iMin,
+              frames + iMax,
+              NULL);
+
+          // If the Frames intersect
+          if (isIntersecting == true) {
+
+            ++(that->nbIntersection);
+            if (callback != NULL) {
+
+              callback(
+                iMin,
+                iMax,
+                data);
+
+            }
+
+          }
+
+        }
+
+      }
+
+      // Add the Frame to the active Frames
+      active[nbActive] = iFrame;
+      activeBdgBox[nbActive] = *bdgBox;
+      posActive[iFrame] = nbActive;
+      ++nbActive;
+
+    // Else it's the max endpoint of the Frame
+    } else {
+
+      // Remove the Frame from the active Frames, replacing it with
+      // the last one
+      const int iActive = posActive[iFrame];
+      --nbActive;
+      active[iActive] = active[nbActive];
+      activeBdgBox[iActive] = activeBdgBox[nbActive];
+      posActive[active[iActive]] = iActive;
+
+    }
+
+  }
+
+  // Return the number of intersecting pairs
+  return that->nbIntersection;
+
+}
+
+// Get the axis along which the variance of the centers of the
+// bounding boxes of the nbFrame Frames frames is the largest among
+// the spatial axes (all the boxes covering [0,1] along the time axis)
+static int SAP2DTimeGetAxisMaxVar(
+  const Frame2DTime* const frames,
+  const int nbFrame,
+  FMB_REAL var[2]) {
+
+  // If there is no Frame, all the variances are null
+  if (nbFrame == 0) {
+
+    var[0] = var[1] = 0.0;
+    return 0;
+
+  }
+
+  // Declare variables to sum the centers and their square
+  FMB_REAL sum[2] = {0.0, 0.0};
+  FMB_REAL sumSq[2] = {0.0, 0.0};
+
+  // Loop on the Frames
+  for (
+    int iFrame = nbFrame;
+    iFrame--;) {
+
+    // Shortcut
+    const AABB2DTime* bdgBox = &(frames[iFrame].bdgBox);
+
+    for (
+      int iAxis = 2;
+      iAxis--;) {
+
+      FMB_REAL center = 0.5 * (bdgBox->min[iAxis] + bdgBox->max[iAxis]);
+      sum[iAxis] += center;
+      sumSq[iAxis] += center * center;
+
+    }
+
+  }
+
+  // Calculate the variances and get the axis with the largest one
+  int axis = 0;
+  for (
+    int iAxis = 2;
+    iAxis--;) {
+
+    FMB_REAL mean = sum[iAxis] / (FMB_REAL)nbFrame;
+    var[iAxis] = sumSq[iAxis] / (FMB_REAL)nbFrame - mean * mean;
+
+  }
+
+  for (
+    int iAxis = 1;
+    iAxis < 2;
+    ++iAxis) {
+
+    if (var[iAxis] > var[axis]) {
+
+      axis = iAxis;
+
+    }
+
+  }
+
+  return axis;
+
+}
+
+// Allocate the arrays of the SAP2DTime that for nbFrame Frames and set
+// the endpoints of the Frames frames in their index order
+static void SAP2DTimeInit(
+  SAP2DTime* const that,
+  const Frame2DTime* const frames,
+  const int nbFrame) {
+
+  // Free the arrays of the previous set of Frames
+  free(that->endpoints);
+  free(that->active);
+  free(that->posActive);
+  free(that->activeBdgBox);
+
+  // Allocate memory for the new set of Frames
+  that->nbFrame = nbFrame;
+  that->endpoints = malloc(sizeof(SAPEndpoint) * 2 * (nbFrame + 1));
+  that->active = malloc(sizeof(int) * (nbFrame + 1));
+  that->posActive = malloc(sizeof(int) * (nbFrame + 1));
+  that->activeBdgBox = malloc(sizeof(AABB2DTime) * (nbFrame + 1));
+  if (
+    that->endpoints == NULL ||
+    that->active == NULL ||
+    that->posActive == NULL ||
+    that->activeBdgBox == NULL) {
+
+    printf("SAP2DTimeInit: failed to allocate memory\n");
+    exit(0);
+
+  }
+
+  // Set the endpoints
+  for (
+    int iFrame = nbFrame;
+    iFrame--;) {
+
+    SAPEndpoint* endpoint = that->endpoints + 2 * iFrame;
+    endpoint[0].iFrame = iFrame;
+    endpoint[0].isMax = false;
+    endpoint[0].val = frames[iFrame].bdgBox.min[that->axis];
+    endpoint[1].iFrame = iFrame;
+    endpoint[1].isMax = true;
+    endpoint[1].val = frames[iFrame].bdgBox.max[that->axis];
+
+  }
+
+}
+
+// Create a new SAP2DTime, empty until the first call to SAP2DTimeUpdate
+SAP2DTime* SAP2DTimeCreate(void) {
+
+  // Allocate memory for the SAP2DTime
+  SAP2DTime* that = malloc(sizeof(SAP2DTime));
+  if (that == NULL) {
+
+    printf("SAP2DTimeCreate: failed to allocate memory\n");
+    exit(0);
+
+  }
+
+  // Initialize the properties
+  that->nbFrame = 0;
+  that->axis = 0;
+  that->endpoints = NULL;
+  that->active = NULL;
+  that->posActive = NULL;
+  that->activeBdgBox = NULL;
+  that->nbSwap = 0;
+  that->nbCandidate = 0;
+  that->nbIntersection = 0;
+
+  // Return the new SAP2DTime
+  return that;
+
+}
+
+// Free the memory used by the SAP2DTime that
+void SAP2DTimeFree(SAP2DTime** that) {
+
+  if (that == NULL || *that == NULL) {
+
+    return;
+
+  }
+
+  free((*that)->endpoints);
+  free((*that)->active);
+  free((*that)->posActive);
+  free((*that)->activeBdgBox);
+  free(*that);
+  *that = NULL;
+
+}
+
+// Update the SAP2DTime that with the nbFrame Frames frames
+void SAP2DTimeUpdate(
+  SAP2DTime* const that,
+  const Frame2DTime* const frames,
+  const int nbFrame) {
+
+  // Reset the statistics
+  that->nbSwap = 0;
+
+  // Get the axis of largest variance
+  FMB_REAL var[2];
+  int axis =
+    SAP2DTimeGetAxisMaxVar(
+      frames,
+      nbFrame,
+      var);
+
+  // Declare a flag to memorize if the endpoints need a full sort
+  bool isFullSort = false;
+
+  // If the axis of largest variance is significantly better than
+  // the current sweep axis
+  if (
+    axis != that->axis &&
+    var[axis] > SAP_AXIS_SWITCH_RATIO * var[that->axis]) {
+
+    // Change the sweep axis
+    that->axis = axis;
+    isFullSort = true;
+
+  }
+
+  // If the set of Frames has changed, reset the endpoints
+  if (nbFrame != that->nbFrame || that->endpoints == NULL) {
+
+    SAP2DTimeInit(
+      that,
+      frames,
+      nbFrame);
+    isFullSort = true;
+
+  // Else, update the position of the endpoints
+  } else {
+
+    for (
+      int iEndpoint = 2 * nbFrame;
+      iEndpoint--;) {
+
+      SAPEndpoint* endpoint = that->endpoints + iEndpoint;
+      const AABB2DTime* bdgBox = &(frames[endpoint->iFrame].bdgBox);
+      endpoint->val =
+        (endpoint->isMax ? bdgBox->max : bdgBox->min)[that->axis];
+
+    }
+
+  }
+
+  // Sort the endpoints
+  SAPSortEndpoints(
+    that->endpoints,
+    2 * nbFrame,
+    isFullSort,
+    &(that->nbSwap));
+
+}
+
+// Sweep the endpoints of the SAP2DTime that and run the narrow phase on
+// the pairs of Frames whose bounding boxes intersect
+unsigned long SAP2DTimeCollide(
+  SAP2DTime* const that,
+  const Frame2DTime* const frames,
+  const SAP3DCallback callback,
+  void* const data) {
+
+  // Reset the statistics
+  that->nbCandidate = 0;
+  that->nbIntersection = 0;
+
+  // Shortcuts
+  int* active = that->active;
+  int* posActive = that->posActive;
+  AABB2DTime* activeBdgBox = that->activeBdgBox;
+  const SAPEndpoint* endpoints = that->endpoints;
+
+  // Get the spatial axis other than the sweep axis
+  const int axisA = 1 - that->axis;
+
+  // Declare a variable to memorize the number of active Frames
+  int nbActive = 0;
+
+  // Loop on the endpoints
+  for (
+    int iEndpoint = 0;
+    iEndpoint < 2 * that->nbFrame;
+    ++iEndpoint) {
+
+    // Shortcut
+    const int iFrame = endpoints[iEndpoint].iFrame;
+
+    // If it's the min endpoint of the Frame
+    if (endpoints[iEndpoint].isMax == false) {
+
+      // Shortcut
+      const AABB2DTime* bdgBox = &(frames[iFrame].bdgBox);
+
+      // Loop on the active Frames, which intersect the Frame along
+      // the sweep axis
+      for (
+        int iActive = 0;
+        iActive < nbActive;
+        ++iActive) {
+
+        // Shortcut
+        const int jFrame = active[iActive];
+
+        // If the bounding boxes intersect (the test is done inline
+        // rather than with AABBTestIntersection2DTime as it's the
+        // bottleneck of the sweep, it's useless to check the sweep
+        // axis, and the boxes all cover [0,1] along the time axis)
+        const AABB2DTime* activeBox = activeBdgBox + iActive;
+        bool isIntersectingAABB =
+          bdgBox->min[axisA] <= activeBox->max[axisA] &&
+          activeBox->min[axisA] <= bdgBox->max[axisA];
+        if (isIntersectingAABB == true) {
+
+          ++(that->nbCandidate);
+
+          // Run the narrow phase, in the index order of the Frames
+          const int iMin = (iFrame < jFrame ? iFrame : jFrame);
+          const int iMax = (iFrame < jFrame ? jFrame : iFrame);
+          bool isIntersecting =
+            FMBTestIntersection2DTime(
+              frames + iMin,
+              frames + iMax,
+              NULL);
+
+          // If the Frames intersect
+          if (isIntersecting == true) {
+
+            ++(that->nbIntersection);
+            if (callback != NULL) {
+
+              callback(
+                iMin,
+                iMax,
+                data);
+
+            }
+
+          }
+
+        }
+
+      }
+
+      // Add the Frame to the active Frames
+      active[nbActive] = iFrame;
+      activeBdgBox[nbActive] = *bdgBox;
+      posActive[iFrame] = nbActive;
+      ++nbActive;
+
+    // Else it's the max endpoint of the Frame
+    } else {
+
+      // Remove the Frame from the active Frames, replacing it with
+      // the last one
+      const int iActive = posActive[iFrame];
+      --nbActive;
+      active[iActive] = active[nbActive];
+      activeBdgBox[iActive] = activeBdgBox[nbActive];
+      posActive[active[iActive]] = iActive;
+
+    }
+
+  }
+
+  // Return the number of intersecting pairs
+  return that->nbIntersection;
+
+}
+
+// Get the axis along which the variance of the centers of the
+// bounding boxes of the nbFrame Frames frames is the largest among
+// the spatial axes (all the boxes covering [0,1] along the time axis)
+static int SAP3DTimeGetAxisMaxVar(
+  const Frame3DTime* const frames,
+  const int nbFrame,
+  FMB_REAL var[3]) {
+
+  // If there is no Frame, all the variances are null
+  if (nbFrame == 0) {
+
+    var[0] = var[1] = var[2] = 0.0;
+    return 0;
+
+  }
+
+  // Declare variables to sum the centers and their square
+  FMB_REAL sum[3] = {0.0, 0.0, 0.0};
+  FMB_REAL sumSq[3] = {0.0, 0.0, 0.0};
+
+  // Loop on the Frames
+  for (
+    int iFrame = nbFrame;
+    iFrame--;) {
+
+    // Shortcut
+    const AABB3DTime* bdgBox = &(frames[iFrame].bdgBox);
+
+    for (
+      int iAxis = 3;
+      iAxis--;) {
+
+      FMB_REAL center = 0.5 * (bdgBox->min[iAxis] + bdgBox->max[iAxis]);
+      sum[iAxis] += center;
+      sumSq[iAxis] += center * center;
+
+    }
+
+  }
+
+  // Calculate the variances and get the axis with the largest one
+  int axis = 0;
+  for (
+    int iAxis = 3;
+    iAxis--;) {
+
+    FMB_REAL mean = sum[iAxis] / (FMB_REAL)nbFrame;
+    var[iAxis] = sumSq[iAxis] / (FMB_REAL)nbFrame - mean * mean;
+
+  }
+
+  for (
+    int iAxis = 1;
+    iAxis < 3;
+    ++iAxis) {
+
+    if (var[iAxis] > var[axis]) {
+
+      axis = iAxis;
+
+    }
+
+  }
+
+  return axis;
+
+}
+
+// Allocate the arrays of the SAP3DTime that for nbFrame Frames and set
+// the endpoints of the Frames frames in their index order
+static void SAP3DTimeInit(
+  SAP3DTime* const that,
+  const Frame3DTime* const frames,
+  const int nbFrame) {
+
+  // Free the arrays of the previous set of Frames
+  free(that->endpoints);
+  free(that->active);
+  free(that->posActive);
+  free(that->activeBdgBox);
+
+  // Allocate memory for the new set of Frames
+  that->nbFrame = nbFrame;
+  that->endpoints = malloc(sizeof(SAPEndpoint) * 2 * (nbFrame + 1));
+  that->active = malloc(sizeof(int) * (nbFrame + 1));
+  that->posActive = malloc(sizeof(int) * (nbFrame + 1));
+  that->activeBdgBox = malloc(sizeof(AABB3DTime) * (nbFrame + 1));
+  if (
+    that->endpoints == NULL ||
+    that->active == NULL ||
+    that->posActive == NULL ||
+    that->activeBdgBox == NULL) {
+
+    printf("SAP3DTimeInit: failed to allocate memory\n");
+    exit(0);
+
+  }
+
+  // Set the endpoints
+  for (
+    int iFrame = nbFrame;
+    iFrame--;) {
+
+    SAPEndpoint* endpoint = that->endpoints + 2 * iFrame;
+    endpoint[0].iFrame = iFrame;
+    endpoint[0].isMax = false;
+    endpoint[0].val = frames[iFrame].bdgBox.min[that->axis];
+    endpoint[1].iFrame = iFrame;
+    endpoint[1].isMax = true;
+    endpoint[1].val = frames[iFrame].bdgBox.max[that->axis];
+
+  }
+
+}
+
+// Create a new SAP3DTime, empty until the first call to SAP3DTimeUpdate
+SAP3DTime* SAP3DTimeCreate(void) {
+
+  // Allocate memory for the SAP3DTime
+  SAP3DTime* that = malloc(sizeof(SAP3DTime));
+  if (that == NULL) {
+
+    printf("SAP3DTimeCreate: failed to allocate memory\n");
+    exit(0);
+
+  }
+
+  // Initialize the properties
+  that->nbFrame = 0;
+  that->axis = 0;
+  that->endpoints = NULL;
+  that->active = NULL;
+  that->posActive = NULL;
+  that->activeBdgBox = NULL;
+  that->nbSwap = 0;
+  that->nbCandidate = 0;
+  that->nbIntersection = 0;
+
+  // Return the new SAP3DTime
+  return that;
+
+}
+
+// Free the memory used by the SAP3DTime that
+void SAP3DTimeFree(SAP3DTime** that) {
+
+  if (that == NULL || *that == NULL) {
+
+    return;
+
+  }
+
+  free((*that)->endpoints);
+  free((*that)->active);
+  free((*that)->posActive);
+  free((*that)->activeBdgBox);
+  free(*that);
+  *that = NULL;
+
+}
+
+// Update the SAP3DTime that with the nbFrame Frames frames
+void SAP3DTimeUpdate(
+  SAP3DTime* const that,
+  const Frame3DTime* const frames,
+  const int nbFrame) {
+
+  // Reset the statistics
+  that->nbSwap = 0;
+
+  // Get the axis of largest variance
+  FMB_REAL var[3];
+  int axis =
+    SAP3DTimeGetAxisMaxVar(
+      frames,
+      nbFrame,
+      var);
+
+  // Declare a flag to memorize if the endpoints need a full sort
+  bool isFullSort = false;
+
+  // If the axis of largest variance is significantly better than
+  // the current sweep axis
+  if (
+    axis != that->axis &&
+    var[axis] > SAP_AXIS_SWITCH_RATIO * var[that->axis]) {
+
+    // Change the sweep axis
+    that->axis = axis;
+    isFullSort = true;
+
+  }
+
+  // If the set of Frames has changed, reset the endpoints
+  if (nbFrame != that->nbFrame || that->endpoints == NULL) {
+
+    SAP3DTimeInit(
+      that,
+      frames,
+      nbFrame);
+    isFullSort = true;
+
+  // Else, update the position of the endpoints
+  } else {
+
+    for (
+      int iEndpoint = 2 * nbFrame;
+      iEndpoint--;) {
+
+      SAPEndpoint* endpoint = that->endpoints + iEndpoint;
+      const AABB3DTime* bdgBox = &(frames[endpoint->iFrame].bdgBox);
+      endpoint->val =
+        (endpoint->isMax ? bdgBox->max : bdgBox->min)[that->axis];
+
+    }
+
+  }
+
+  // Sort the endpoints
+  SAPSortEndpoints(
+    that->endpoints,
+    2 * nbFrame,
+    isFullSort,
+    &(that->nbSwap));
+
+}
+
+// Sweep the endpoints of the SAP3DTime that and run the narrow phase on
+// the pairs of Frames whose bounding boxes intersect
+unsigned long SAP3DTimeCollide(
+  SAP3DTime* const that,
+  const Frame3DTime* const frames,
+  const SAP3DCallback callback,
+  void* const data) {
+
+  // Reset the statistics
+  that->nbCandidate = 0;
+  that->nbIntersection = 0;
+
+  // Shortcuts
+  int* active = that->active;
+  int* posActive = that->posActive;
+  AABB3DTime* activeBdgBox = that->activeBdgBox;
+  const SAPEndpoint* endpoints = that->endpoints;
+
+  // Get the two spatial axes other than the sweep axis
+  const int axisA = (that->axis + 1) % 3;
+  const int axisB = (that->axis + 2) % 3;
+
+  // Declare a variable to memorize the number of active Frames
+  int nbActive = 0;
+
+  // Loop on the endpoints
+  for (
+    int iEndpoint = 0;
+    iEndpoint < 2 * that->nbFrame;
+    ++iEndpoint) {
+
+    // Shortcut
+    const int iFrame = endpoints[iEndpoint].iFrame;
+
+    // If it's the min endpoint of the Frame
+    if (endpoints[iEndpoint].isMax == false) {
+
+      // Shortcut
+      const AABB3DTime* bdgBox = &(frames[iFrame].bdgBox);
+
+      // Loop on the active Frames, which intersect the Frame along
+      // the sweep axis
+      for (
+        int iActive = 0;
+        iActive < nbActive;
+        ++iActive) {
+
+        // Shortcut
+        const int jFrame = active[iActive];
+
+        // If the bounding boxes intersect (the test is done inline
+        // rather than with AABBTestIntersection3DTime as it's the
+        // bottleneck of the sweep, it's useless to check the sweep
+        // axis, and the boxes all cover [0,1] along the time axis)
+        const AABB3DTime* activeBox = activeBdgBox + iActive;
+        bool isIntersectingAABB =
+          bdgBox->min[axisA] <= activeBox->max[axisA] &&
+          activeBox->min[axisA] <= bdgBox->max[axisA] &&
+          bdgBox->min[axisB] <= activeBox->max[axisB] &&
+          activeBox->min[axisB] <= bdgBox->max[axisB];
+        if (isIntersectingAABB == true) {
+
+          ++(that->nbCandidate);
+
+          // Run the narrow phase, in the index order of the Frames
+          const int iMin = (iFrame < jFrame ? iFrame : jFrame);
+          const int iMax = (iFrame < jFrame ? jFrame : iFrame);
+          bool isIntersecting =
+            FMBTestIntersection3DTime(
+              frames + iMin,
+              frames + iMax,
+              NULL);
+
+          // If the Frames intersect
+          if (isIntersecting == true) {
+
+            ++(that->nbIntersection);
+            if (callback != NULL) {
+
+              callback(
+                iMin,
+                iMax,
+                data);
+
+            }
+
+          }
+
+        }
+
+      }
+
+      // Add the Frame to the active Frames
+      active[nbActive] = iFrame;
+      activeBdgBox[nbActive] = *bdgBox;
+      posActive[iFrame] = nbActive;
+      ++nbActive;
+
+    // Else it's the max endpoint of the Frame
+    } else {
+
+      // Remove the Frame from the active Frames, replacing it with
+      // the last one
+      const int iActive = posActive[iFrame];
+      --nbActive;
+      active[iActive] = active[nbActive];
+      activeBdgBox[iActive] = activeBdgBox[nbActive];
+      posActive[active[iActive]] = iActive;
+
+    }
+
+  }
+
+  // Return the number of intersecting pairs
+  return that->nbIntersection;
+
+}
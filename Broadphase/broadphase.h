@@ -0,0 +1,253 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __BROADPHASE_H_
+#define __BROADPHASE_H_
+
+#include <stdbool.h>
+#include "frame.h"
+#include "fmb2dt.h"
+#include "fmb3d.h"
+#include "fmb3dt.h"
+
+// ------------- Macros -------------
+
+// Ratio of the variance of the bounding boxes' centers along an axis
+// over the one along the current sweep axis above which the sweep
+// axis is changed. Changing the axis requires a full sort of the
+// endpoints, hence the hysteresis to keep the benefit of the temporal
+// coherence when the variances are similar
+#define SAP_AXIS_SWITCH_RATIO 1.2
+
+// ------------- Data structures -------------
+
+// Endpoint of the bounding box of a Frame along the sweep axis
+typedef struct {
+
+  // Position of the endpoint along the sweep axis
+  FMB_REAL val;
+
+  // Index of the Frame
+  int iFrame;
+
+  // Flag to memorize if it's the max endpoint (else the min one)
+  bool isMax;
+
+} SAPEndpoint;
+
+// Sweep and prune over the bounding boxes of a set of Frame3D
+typedef struct {
+
+  // Number of Frames
+  int nbFrame;
+
+  // Sweep axis
+  int axis;
+
+  // Endpoints of the bounding boxes along the sweep axis, sorted by
+  // increasing position (2 per Frame)
+  SAPEndpoint* endpoints;
+
+  // Indices of the Frames whose interval contains the current
+  // position during the sweep, and position of each Frame in this
+  // array
+  int* active;
+  int* posActive;
+
+  // Copy of the bounding boxes of the active Frames, in the same order
+  // as active, to avoid reading the Frames (larger, and scattered in
+  // memory) when looping on the active Frames
+  AABB3D* activeBdgBox;
+
+  // Statistics of the last update and collision
+  // Nb of exchanges of endpoints during the last sort
+  unsigned long nbSwap;
+
+  // Nb of pairs whose bounding boxes intersect, given to the narrow
+  // phase
+  unsigned long nbCandidate;
+
+  // Nb of pairs detected in intersection by the narrow phase
+  unsigned long nbIntersection;
+
+} SAP3D;
+
+// Sweep and prune over the bounding boxes of a set of Frame2DTime, which
+// cover the displacement of the Frames during [0,1] (cf
+// Frame2DTimeCreateStatic), as SAP3D
+typedef struct {
+
+  // Number of Frames
+  int nbFrame;
+
+  // Sweep axis, one of the spatial axes
+  int axis;
+
+  // Endpoints of the bounding boxes along the sweep axis, sorted by
+  // increasing position (2 per Frame)
+  SAPEndpoint* endpoints;
+
+  // Indices of the Frames whose interval contains the current
+  // position during the sweep, and position of each Frame in this
+  // array
+  int* active;
+  int* posActive;
+
+  // Copy of the bounding boxes of the active Frames, in the same order
+  // as active
+  AABB2DTime* activeBdgBox;
+
+  // Statistics of the last update and collision, as SAP3D
+  unsigned long nbSwap;
+  unsigned long nbCandidate;
+  unsigned long nbIntersection;
+
+} SAP2DTime;
+
+// Sweep and prune over the bounding boxes of a set of Frame3DTime, which
+// cover the displacement of the Frames during [0,1] (cf
+// Frame3DTimeCreateStatic), as SAP3D
+typedef struct {
+
+  // Number of Frames
+  int nbFrame;
+
+  // Sweep axis, one of the spatial axes
+  int axis;
+
+  // Endpoints of the bounding boxes along the sweep axis, sorted by
+  // increasing position (2 per Frame)
+  SAPEndpoint* endpoints;
+
+  // Indices of the Frames whose interval contains the current
+  // position during the sweep, and position of each Frame in this
+  // array
+  int* active;
+  int* posActive;
+
+  // Copy of the bounding boxes of the active Frames, in the same order
+  // as active
+  AABB3DTime* activeBdgBox;
+
+  // Statistics of the last update and collision, as SAP3D
+  unsigned long nbSwap;
+  unsigned long nbCandidate;
+  unsigned long nbIntersection;
+
+} SAP3DTime;
+
+// Function called on each pair of intersecting Frames (iFrame <
+// jFrame), data is the user data given to SAP3DCollide (or
+// SAP2DTimeCollide, SAP3DTimeCollide)
+typedef void (*SAP3DCallback)(
+  const int iFrame,
+  const int jFrame,
+  void* const data);
+
+// ------------- Functions declaration -------------
+
+// Create a new SAP3D, empty until the first call to SAP3DUpdate
+SAP3D* SAP3DCreate(void);
+
+// Free the memory used by the SAP3D that
+void SAP3DFree(SAP3D** that);
+
+// Update the SAP3D that with the nbFrame Frames frames
+// The bounding boxes of the Frames must be up to date (which is the
+// case if they are modified only with the functions of frame.h)
+// If the number of Frames is unchanged since the last update, the
+// Frames are supposed to be the same ones, maybe moved, and the
+// endpoints are resorted from their previous order with an insertion
+// sort, which is close to linear if the Frames moved little. Else the
+// endpoints are fully sorted
+// The sweep axis is the one along which the variance of the centers
+// of the bounding boxes is the largest (with an hysteresis, cf
+// SAP_AXIS_SWITCH_RATIO)
+void SAP3DUpdate(
+  SAP3D* const that,
+  const Frame3D* const frames,
+  const int nbFrame);
+
+// Sweep the endpoints of the SAP3D that, run FMBTestIntersection3D on
+// each pair of Frames whose bounding boxes intersect, and call
+// callback (if not null) with the user data data on each pair of
+// intersecting Frames
+// frames must be the ones given to the last call to SAP3DUpdate
+// Return the number of pairs of intersecting Frames
+unsigned long SAP3DCollide(
+  SAP3D* const that,
+  const Frame3D* const frames,
+  const SAP3DCallback callback,
+  void* const data);
+
+// Create a new SAP2DTime, empty until the first call to SAP2DTimeUpdate
+SAP2DTime* SAP2DTimeCreate(void);
+
+// Free the memory used by the SAP2DTime that
+void SAP2DTimeFree(SAP2DTime** that);
+
+// Update the SAP2DTime that with the nbFrame Frames frames, as
+// SAP3DUpdate
+// The sweep axis is chosen among the spatial axes, all the bounding
+// boxes covering the same interval of time
+void SAP2DTimeUpdate(
+  SAP2DTime* const that,
+  const Frame2DTime* const frames,
+  const int nbFrame);
+
+// Sweep the endpoints of the SAP2DTime that, run
+// FMBTestIntersection2DTime on each pair of Frames whose bounding boxes
+// intersect, and call callback (if not null) with the user data data
+// on each pair of Frames intersecting during [0,1]
+// frames must be the ones given to the last call to SAP2DTimeUpdate
+// Return the number of pairs of intersecting Frames
+unsigned long SAP2DTimeCollide(
+  SAP2DTime* const that,
+  const Frame2DTime* const frames,
+  const SAP3DCallback callback,
+  void* const data);
+
+// Create a new SAP3DTime, empty until the first call to SAP3DTimeUpdate
+SAP3DTime* SAP3DTimeCreate(void);
+
+// Free the memory used by the SAP3DTime that
+void SAP3DTimeFree(SAP3DTime** that);
+
+// Update the SAP3DTime that with the nbFrame Frames frames, as
+// SAP3DUpdate
+// The sweep axis is chosen among the spatial axes, all the bounding
+// boxes covering the same interval of time
+void SAP3DTimeUpdate(
+  SAP3DTime* const that,
+  const Frame3DTime* const frames,
+  const int nbFrame);
+
+// Sweep the endpoints of the SAP3DTime that, run
+// FMBTestIntersection3DTime on each pair of Frames whose bounding boxes
+// intersect, and call callback (if not null) with the user data data
+// on each pair of Frames intersecting during [0,1]
+// frames must be the ones given to the last call to SAP3DTimeUpdate
+// Return the number of pairs of intersecting Frames
+unsigned long SAP3DTimeCollide(
+  SAP3DTime* const that,
+  const Frame3DTime* const frames,
+  const SAP3DCallback callback,
+  void* const data);
+
+#endif
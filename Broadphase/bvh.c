@@ -0,0 +1,650 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "bvh.h"
+
+// ------------- Functions declaration -------------
+
+// Return true if the AABB that and tho intersect (inline version of
+// AABBTestIntersection3D, which is the bottleneck of the traversal)
+static inline bool BVH3DIsOverlapping(
+  const AABB3D* const that,
+  const AABB3D* const tho);
+
+// Return half the surface area of the AABB that
+static inline FMB_REAL BVH3DGetArea(const AABB3D* const that);
+
+// Extend the AABB that to include the AABB tho
+static inline void BVH3DExtend(
+  AABB3D* const that,
+  const AABB3D* const tho);
+
+// Create recursively the node of the BVH3D that over the nbFrame
+// Frames starting at iFirst in that->iFrames, given the centers of the
+// bounding boxes bdgBoxes of the Frames
+// Return the index of the created node
+static int BVH3DBuildNode(
+  BVH3D* const that,
+  const AABB3D* const bdgBoxes,
+  const FMB_REAL (*centers)[3],
+  const int iFirst,
+  const int nbFrame,
+  const int depth);
+
+// ------------- Functions implementation -------------
+
+// Return true if the AABB that and tho intersect
+static inline bool BVH3DIsOverlapping(
+  const AABB3D* const that,
+  const AABB3D* const tho) {
+
+  return
+    that->min[0] <= tho->max[0] && tho->min[0] <= that->max[0] &&
+    that->min[1] <= tho->max[1] && tho->min[1] <= that->max[1] &&
+    that->min[2] <= tho->max[2] && tho->min[2] <= that->max[2];
+
+}
+
+// Return half the surface area of the AABB that
+static inline FMB_REAL BVH3DGetArea(const AABB3D* const that) {
+
+  FMB_REAL dx = that->max[0] - that->min[0];
+  FMB_REAL dy = that->max[1] - that->min[1];
+  FMB_REAL dz = that->max[2] - that->min[2];
+  return dx * dy + dy * dz + dz * dx;
+
+}
+
+// Extend the AABB that to include the AABB tho
+static inline void BVH3DExtend(
+  AABB3D* const that,
+  const AABB3D* const tho) {
+
+  for (
+    int iAxis = 3;
+    iAxis--;) {
+
+    if (that->min[iAxis] > tho->min[iAxis]) {
+
+      that->min[iAxis] = tho->min[iAxis];
+
+    }
+
+    if (that->max[iAxis] < tho->max[iAxis]) {
+
+      that->max[iAxis] = tho->max[iAxis];
+
+    }
+
+  }
+
+}
+
+// Create recursively the node of the BVH3D that over the nbFrame
+// Frames starting at iFirst in that->iFrames
+static int BVH3DBuildNode(
+  BVH3D* const that,
+  const AABB3D* const bdgBoxes,
+  const FMB_REAL (*centers)[3],
+  const int iFirst,
+  const int nbFrame,
+  const int depth) {
+
+  // Shortcut
+  int* iFrames = that->iFrames + iFirst;
+
+  // Create the node
+  int iNode = that->nbNode;
+  ++(that->nbNode);
+  BVH3DNode* node = that->nodes + iNode;
+
+  // Update the depth of the tree
+  if (that->depth < depth) {
+
+    that->depth = depth;
+
+  }
+
+  // Get the bounding box of the node and the bounding box of the
+  // centers of its Frames
+  node->bdgBox = bdgBoxes[iFrames[0]];
+  FMB_REAL centerMin[3];
+  FMB_REAL centerMax[3];
+  for (
+    int iAxis = 3;
+    iAxis--;) {
+
+    centerMin[iAxis] = centerMax[iAxis] = centers[iFrames[0]][iAxis];
+
+  }
+
+  for (
+    int iFrame = 1;
+    iFrame < nbFrame;
+    ++iFrame) {
+
+    BVH3DExtend(
+      &(node->bdgBox),
+      bdgBoxes + iFrames[iFrame]);
+    for (
+      int iAxis = 3;
+      iAxis--;) {
+
+      FMB_REAL center = centers[iFrames[iFrame]][iAxis];
+      if (centerMin[iAxis] > center) {
+
+        centerMin[iAxis] = center;
+
+      }
+
+      if (centerMax[iAxis] < center) {
+
+        centerMax[iAxis] = center;
+
+      }
+
+    }
+
+  }
+
+  // If there are few enough Frames, the node is a leaf
+  if (nbFrame <= BVH3D_LEAF_SIZE) {
+
+    node->iChild = iFirst;
+    node->nbFrame = nbFrame;
+    return iNode;
+
+  }
+
+  // Declare variables to memorize the best split: axis, index of the
+  // last bin in the first child, and cost
+  int bestAxis = -1;
+  int bestBin = 0;
+  FMB_REAL bestCost = 0.0;
+
+  // Loop on the axes
+  for (
+    int iAxis = 3;
+    iAxis--;) {
+
+    // If the centers are all the same along this axis, skip it
+    FMB_REAL range = centerMax[iAxis] - centerMin[iAxis];
+    if (range <= 0.0) {
+
+      continue;
+
+    }
+
+    // Distribute the Frames in the bins according to their center
+    int nbInBin[BVH3D_NB_BIN] = {0};
+    AABB3D bdgBoxBin[BVH3D_NB_BIN];
+    for (
+      int iFrame = nbFrame;
+      iFrame--;) {
+
+      int iBin =
+        (int)((FMB_REAL)BVH3D_NB_BIN *
+        (centers[iFrames[iFrame]][iAxis] - centerMin[iAxis]) / range);
+      if (iBin >= BVH3D_NB_BIN) {
+
+        iBin = BVH3D_NB_BIN - 1;
+
+      }
+
+      if (nbInBin[iBin] == 0) {
+
+        bdgBoxBin[iBin] = bdgBoxes[iFrames[iFrame]];
+
+      } else {
+
+        BVH3DExtend(
+          bdgBoxBin + iBin,
+          bdgBoxes + iFrames[iFrame]);
+
+      }
+
+      ++(nbInBin[iBin]);
+
+    }
+
+    // Get the surface area of the bins after each bin
+    FMB_REAL areaAfter[BVH3D_NB_BIN];
+    int nbAfter[BVH3D_NB_BIN];
+    AABB3D bdgBoxAfter;
+    int nb = 0;
+    for (
+      int iBin = BVH3D_NB_BIN;
+      iBin-- > 1;) {
+
+      if (nbInBin[iBin] > 0) {
+
+        if (nb == 0) {
+
+          bdgBoxAfter = bdgBoxBin[iBin];
+
+        } else {
+
+          BVH3DExtend(
+            &bdgBoxAfter,
+            bdgBoxBin + iBin);
+
+        }
+
+        nb += nbInBin[iBin];
+
+      }
+
+      nbAfter[iBin - 1] = nb;
+      areaAfter[iBin - 1] = (nb > 0 ? BVH3DGetArea(&bdgBoxAfter) : 0.0);
+
+    }
+
+    // Sweep the bins and evaluate the cost of the split after each bin
+    AABB3D bdgBoxBefore;
+    nb = 0;
+    for (
+      int iBin = 0;
+      iBin < BVH3D_NB_BIN - 1;
+      ++iBin) {
+
+      if (nbInBin[iBin] > 0) {
+
+        if (nb == 0) {
+
+          bdgBoxBefore = bdgBoxBin[iBin];
+
+        } else {
+
+          BVH3DExtend(
+            &bdgBoxBefore,
+            bdgBoxBin + iBin);
+
+        }
+
+        nb += nbInBin[iBin];
+
+      }
+
+      // If both children are non empty
+      if (nb > 0 && nbAfter[iBin] > 0) {
+
+        FMB_REAL cost =
+          (FMB_REAL)nb * BVH3DGetArea(&bdgBoxBefore) +
+          (FMB_REAL)(nbAfter[iBin]) * areaAfter[iBin];
+        if (bestAxis == -1 || cost < bestCost) {
+
+          bestAxis = iAxis;
+          bestBin = iBin;
+          bestCost = cost;
+
+        }
+
+      }
+
+    }
+
+  }
+
+  // Partition the Frames according to the best split, or in two
+  // halves if all the centers are the same
+  int nbFirst = nbFrame / 2;
+  if (bestAxis != -1) {
+
+    FMB_REAL range = centerMax[bestAxis] - centerMin[bestAxis];
+    int iLast = nbFrame - 1;
+    nbFirst = 0;
+    while (nbFirst <= iLast) {
+
+      int iBin =
+        (int)((FMB_REAL)BVH3D_NB_BIN *
+        (centers[iFrames[nbFirst]][bestAxis] - centerMin[bestAxis]) /
+        range);
+      if (iBin <= bestBin) {
+
+        ++nbFirst;
+
+      } else {
+
+        int tmp = iFrames[nbFirst];
+        iFrames[nbFirst] = iFrames[iLast];
+        iFrames[iLast] = tmp;
+        --iLast;
+
+      }
+
+    }
+
+  }
+
+  // Create the children, the first one follows the node
+  node->nbFrame = 0;
+  BVH3DBuildNode(
+    that,
+    bdgBoxes,
+    centers,
+    iFirst,
+    nbFirst,
+    depth + 1);
+  int iSecond =
+    BVH3DBuildNode(
+      that,
+      bdgBoxes,
+      centers,
+      iFirst + nbFirst,
+      nbFrame - nbFirst,
+      depth + 1);
+
+  // The nodes array is allocated once for all, so node is still valid
+  node->iChild = iSecond;
+
+  // Return the index of the node
+  return iNode;
+
+}
+
+// Create a new BVH3D over the bounding boxes of the nbFrame Frames
+// frames
+BVH3D* BVH3DCreate(
+  const Frame3D* const frames,
+  const int nbFrame) {
+
+  // Allocate memory, a binary tree with at least one Frame per leaf
+  // has less than twice as many nodes as Frames
+  BVH3D* that = malloc(sizeof(BVH3D));
+  if (that == NULL) {
+
+    printf("BVH3DCreate: failed to allocate memory\n");
+    exit(0);
+
+  }
+
+  that->nbFrame = nbFrame;
+  that->nbNode = 0;
+  that->depth = 0;
+  that->nbNodeTest = 0;
+  that->nbCandidate = 0;
+  that->nbIntersection = 0;
+  that->nodes = malloc(sizeof(BVH3DNode) * 2 * (nbFrame + 1));
+  that->iFrames = malloc(sizeof(int) * (nbFrame + 1));
+  AABB3D* bdgBoxes = malloc(sizeof(AABB3D) * (nbFrame + 1));
+  FMB_REAL (*centers)[3] = malloc(sizeof(FMB_REAL[3]) * (nbFrame + 1));
+  if (
+    that->nodes == NULL ||
+    that->iFrames == NULL ||
+    bdgBoxes == NULL ||
+    centers == NULL) {
+
+    printf("BVH3DCreate: failed to allocate memory\n");
+    exit(0);
+
+  }
+
+  // Copy the bounding boxes of the Frames, to avoid reading the
+  // Frames during the construction, and get their center
+  for (
+    int iFrame = nbFrame;
+    iFrame--;) {
+
+    that->iFrames[iFrame] = iFrame;
+    bdgBoxes[iFrame] = frames[iFrame].bdgBox;
+    for (
+      int iAxis = 3;
+      iAxis--;) {
+
+      centers[iFrame][iAxis] =
+        0.5 * (bdgBoxes[iFrame].min[iAxis] + bdgBoxes[iFrame].max[iAxis]);
+
+    }
+
+  }
+
+  // Build the tree from the root
+  if (nbFrame > 0) {
+
+    BVH3DBuildNode(
+      that,
+      bdgBoxes,
+      (const FMB_REAL (*)[3])centers,
+      0,
+      nbFrame,
+      1);
+
+  }
+
+  // Free memory
+  free(bdgBoxes);
+  free(centers);
+
+  // Return the new BVH3D
+  return that;
+
+}
+
+// Free the memory used by the BVH3D that
+void BVH3DFree(BVH3D** that) {
+
+  if (that == NULL || *that == NULL) {
+
+    return;
+
+  }
+
+  free((*that)->nodes);
+  free((*that)->iFrames);
+  free(*that);
+  *that = NULL;
+
+}
+
+// Update the bounding boxes of the nodes of the BVH3D that after the
+// Frames frames have moved
+void BVH3DRefit(
+  BVH3D* const that,
+  const Frame3D* const frames) {
+
+  // Loop on the nodes in reverse order, the children of a node are
+  // after it in the flattened tree, so they are updated before it
+  for (
+    int iNode = that->nbNode;
+    iNode--;) {
+
+    // Shortcut
+    BVH3DNode* node = that->nodes + iNode;
+
+    // If the node is a leaf
+    if (node->nbFrame > 0) {
+
+      // Get the bounding box of its Frames
+      const int* iFrames = that->iFrames + node->iChild;
+      node->bdgBox = frames[iFrames[0]].bdgBox;
+      for (
+        int iFrame = 1;
+        iFrame < node->nbFrame;
+        ++iFrame) {
+
+        BVH3DExtend(
+          &(node->bdgBox),
+          &(frames[iFrames[iFrame]].bdgBox));
+
+      }
+
+    // Else the node has two children
+    } else {
+
+      // Get the bounding box of its children
+      node->bdgBox = that->nodes[iNode + 1].bdgBox;
+      BVH3DExtend(
+        &(node->bdgBox),
+        &(that->nodes[node->iChild].bdgBox));
+
+    }
+
+  }
+
+}
+
+// Traverse simultaneously the BVH3D that and tho, run the narrow
+// phase test on each pair of Frames whose bounding boxes intersect,
+// and call callback on each pair of intersecting Frames
+unsigned long BVH3DCollide(
+  BVH3D* const that,
+  const Frame3D* const thatFrames,
+  const BVH3D* const tho,
+  const Frame3D* const thoFrames,
+  const BVH3DTest test,
+  const BVH3DCallback callback,
+  void* const data) {
+
+  // Reset the statistics
+  that->nbNodeTest = 0;
+  that->nbCandidate = 0;
+  that->nbIntersection = 0;
+
+  // If one of the trees is empty, there is no intersection
+  if (that->nbNode == 0 || tho->nbNode == 0) {
+
+    return 0;
+
+  }
+
+  // Allocate the stack of pairs of nodes to visit. Each visited pair
+  // of internal nodes pushes two pairs and pops one, and at most one
+  // pair per level of the two trees is waiting in the stack
+  int (*stack)[2] = malloc(sizeof(int[2]) * (that->depth + tho->depth + 1));
+  if (stack == NULL) {
+
+    printf("BVH3DCollide: failed to allocate memory\n");
+    exit(0);
+
+  }
+
+  // Start with the pair of roots
+  int nbStack = 1;
+  stack[0][0] = 0;
+  stack[0][1] = 0;
+
+  // Loop until there is no more pair of nodes to visit
+  while (nbStack > 0) {
+
+    // Pop the pair of nodes
+    --nbStack;
+    const BVH3DNode* thatNode = that->nodes + stack[nbStack][0];
+    const BVH3DNode* thoNode = tho->nodes + stack[nbStack][1];
+
+    // If the bounding boxes of the nodes don't intersect, skip them
+    ++(that->nbNodeTest);
+    if (
+      BVH3DIsOverlapping(
+        &(thatNode->bdgBox),
+        &(thoNode->bdgBox)) == false) {
+
+      continue;
+
+    }
+
+    // If both nodes are leaves
+    if (thatNode->nbFrame > 0 && thoNode->nbFrame > 0) {
+
+      // Loop on the pairs of Frames of the two leaves
+      const int* iThatFrames = that->iFrames + thatNode->iChild;
+      const int* iThoFrames = tho->iFrames + thoNode->iChild;
+      for (
+        int iThat = 0;
+        iThat < thatNode->nbFrame;
+        ++iThat) {
+
+        const Frame3D* thatFrame = thatFrames + iThatFrames[iThat];
+        for (
+          int iTho = 0;
+          iTho < thoNode->nbFrame;
+          ++iTho) {
+
+          const Frame3D* thoFrame = thoFrames + iThoFrames[iTho];
+
+          // If the bounding boxes of the Frames intersect
+          if (
+            BVH3DIsOverlapping(
+              &(thatFrame->bdgBox),
+              &(thoFrame->bdgBox)) == true) {
+
+            // Run the narrow phase
+            ++(that->nbCandidate);
+            bool isIntersecting =
+              test(
+                thatFrame,
+                thoFrame,
+                NULL);
+
+            // If the Frames intersect
+            if (isIntersecting == true) {
+
+              ++(that->nbIntersection);
+              if (callback != NULL) {
+
+                callback(
+                  iThatFrames[iThat],
+                  iThoFrames[iTho],
+                  data);
+
+              }
+
+            }
+
+          }
+
+        }
+
+      }
+
+    // Else, descend in the node of that if tho's one is a leaf or if
+    // that's one is the largest
+    } else if (
+      thoNode->nbFrame > 0 ||
+      (thatNode->nbFrame == 0 &&
+      BVH3DGetArea(&(thatNode->bdgBox)) >=
+      BVH3DGetArea(&(thoNode->bdgBox)))) {
+
+      int iThatNode = thatNode - that->nodes;
+      stack[nbStack][0] = iThatNode + 1;
+      stack[nbStack][1] = thoNode - tho->nodes;
+      stack[nbStack + 1][0] = thatNode->iChild;
+      stack[nbStack + 1][1] = thoNode - tho->nodes;
+      nbStack += 2;
+
+    // Else, descend in the node of tho
+    } else {
+
+      int iThoNode = thoNode - tho->nodes;
+      stack[nbStack][0] = thatNode - that->nodes;
+      stack[nbStack][1] = iThoNode + 1;
+      stack[nbStack + 1][0] = thatNode - that->nodes;
+      stack[nbStack + 1][1] = thoNode->iChild;
+      nbStack += 2;
+
+    }
+
+  }
+
+  // Free memory
+  free(stack);
+
+  // Return the number of intersecting pairs
+  return that->nbIntersection;
+
+}
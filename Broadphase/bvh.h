@@ -0,0 +1,138 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __BVH_H_
+#define __BVH_H_
+
+#include <stdbool.h>
+#include "frame.h"
+
+// ------------- Macros -------------
+
+// Max number of Frames in a leaf of the BVH3D
+#define BVH3D_LEAF_SIZE 4
+
+// Number of bins per axis used to evaluate the surface area heuristic
+// when splitting a node
+#define BVH3D_NB_BIN 16
+
+// ------------- Data structures -------------
+
+// Node of a BVH3D
+typedef struct {
+
+  // Bounding box of the Frames in the node
+  AABB3D bdgBox;
+
+  // If the node is a leaf, index in BVH3D.iFrames of its first Frame,
+  // else index of its second child (the first child is the node
+  // following this one in BVH3D.nodes)
+  int iChild;
+
+  // Number of Frames in the node if it's a leaf, else 0
+  int nbFrame;
+
+} BVH3DNode;
+
+// Bounding volume hierarchy over the bounding boxes of a set of
+// Frame3D, flattened in depth first order
+typedef struct {
+
+  // Number of Frames
+  int nbFrame;
+
+  // Nodes (the root is the first one) and their number
+  BVH3DNode* nodes;
+  int nbNode;
+
+  // Max depth of the tree (1 for a single leaf)
+  int depth;
+
+  // Indices of the Frames, ordered such as the Frames of each leaf are
+  // contiguous
+  int* iFrames;
+
+  // Statistics of the last collision
+  // Nb of pairs of nodes whose bounding boxes have been tested
+  unsigned long nbNodeTest;
+
+  // Nb of pairs of Frames whose bounding boxes intersect, given to
+  // the narrow phase
+  unsigned long nbCandidate;
+
+  // Nb of pairs detected in intersection by the narrow phase
+  unsigned long nbIntersection;
+
+} BVH3D;
+
+// Narrow phase test used by BVH3DCollide, with the same signature as
+// FMBTestIntersection3D (bdgBox is always null)
+typedef bool (*BVH3DTest)(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  AABB3D* const bdgBox);
+
+// Function called on each pair of intersecting Frames, iFrame is the
+// index of the Frame in the first set and jFrame the one in the second
+// set, data is the user data given to BVH3DCollide
+typedef void (*BVH3DCallback)(
+  const int iFrame,
+  const int jFrame,
+  void* const data);
+
+// ------------- Functions declaration -------------
+
+// Create a new BVH3D over the bounding boxes of the nbFrame Frames
+// frames
+// The nodes are split with the surface area heuristic evaluated on
+// BVH3D_NB_BIN bins along each axis, until they contain at most
+// BVH3D_LEAF_SIZE Frames
+BVH3D* BVH3DCreate(
+  const Frame3D* const frames,
+  const int nbFrame);
+
+// Free the memory used by the BVH3D that
+void BVH3DFree(BVH3D** that);
+
+// Update the bounding boxes of the nodes of the BVH3D that after the
+// Frames frames (the ones given at creation) have moved, keeping the
+// structure of the tree
+// The efficiency of the tree degrades if the Frames move a lot
+// relatively to each other, in which case it's better to create a
+// new one
+void BVH3DRefit(
+  BVH3D* const that,
+  const Frame3D* const frames);
+
+// Traverse simultaneously the BVH3D that over the Frames thatFrames
+// and the BVH3D tho over the Frames thoFrames, run the narrow phase
+// test on each pair of Frames (one from each set) whose bounding
+// boxes intersect, and call callback (if not null) with the user data
+// data on each pair of intersecting Frames
+// Return the number of pairs of intersecting Frames
+unsigned long BVH3DCollide(
+  BVH3D* const that,
+  const Frame3D* const thatFrames,
+  const BVH3D* const tho,
+  const Frame3D* const thoFrames,
+  const BVH3DTest test,
+  const BVH3DCallback callback,
+  void* const data);
+
+#endif
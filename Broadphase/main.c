@@ -0,0 +1,113 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Include standard libraries
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+
+// Include the broadphase library
+#include "broadphase.h"
+
+// Nb of Frames in the example
+#define NB_FRAMES 4
+
+// Function called on each pair of intersecting Frames
+void PrintPair(
+  const int iFrame,
+  const int jFrame,
+  void* const data) {
+
+  // Unused argument
+  (void)data;
+
+  printf("Frames #%d and #%d are intersecting\n", iFrame, jFrame);
+
+}
+
+// Main function
+int main(int argc, char** argv) {
+
+  // Create a set of unit cubes along the first axis
+  FMB_REAL orig[NB_FRAMES][3] = {
+
+    {0.0, 0.0, 0.0},
+    {0.5, 0.5, 0.0},
+    {3.0, 0.0, 0.0},
+    {3.5, 0.0, 0.5}
+
+  };
+  FMB_REAL comp[3][3] = {
+
+    {1.0, 0.0, 0.0},
+    {0.0, 1.0, 0.0},
+    {0.0, 0.0, 1.0}
+
+  };
+  Frame3D frames[NB_FRAMES];
+  for (
+    int iFrame = NB_FRAMES;
+    iFrame--;) {
+
+    frames[iFrame] =
+      Frame3DCreateStatic(
+        FrameCuboid,
+        orig[iFrame],
+        comp);
+
+  }
+
+  // Create the sweep and prune and detect the intersecting Frames
+  SAP3D* sap = SAP3DCreate();
+  SAP3DUpdate(
+    sap,
+    frames,
+    NB_FRAMES);
+  unsigned long nbInter =
+    SAP3DCollide(
+      sap,
+      frames,
+      PrintPair,
+      NULL);
+  printf("%lu intersections\n", nbInter);
+
+  // Move the second Frame next to the third one, update the sweep
+  // and prune and detect the intersecting Frames again
+  FMB_REAL v[3] = {2.0, -0.5, 0.0};
+  Frame3DTranslate(
+    frames + 1,
+    v);
+  SAP3DUpdate(
+    sap,
+    frames,
+    NB_FRAMES);
+  nbInter =
+    SAP3DCollide(
+      sap,
+      frames,
+      PrintPair,
+      NULL);
+  printf("%lu intersections\n", nbInter);
+
+  // Free memory
+  SAP3DFree(&sap);
+
+  return 0;
+
+}
@@ -0,0 +1,664 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+#include "pool.h"
+
+// ------------- Data structures -------------
+
+// User data of the jobs of FMBPoolTestPairs3D and
+// FMBPoolTestOneVsMany3D
+typedef struct {
+
+  // Pool running the job
+  FMBPool* pool;
+
+  // Sets of Frames, pairs (null for a one-vs-many job, in which case
+  // thatFrames is the single Frame) and intersection test
+  const Frame3D* thatFrames;
+  const Frame3D* thoFrames;
+  const FMBPair* pairs;
+  FMBPoolTest3D test;
+
+} FMBPoolTestJob;
+
+// ------------- Functions declaration -------------
+
+// Main function of the threads of the workers #1 to #nbThread-1,
+// worker is the FMBPoolWorker of the thread
+static void* FMBPoolThreadMain(void* worker);
+
+// Run the chunks of the current job from the deque of the worker
+// #iThread of the FMBPool that, then steal and run chunks of the
+// other workers until there is none left
+static void FMBPoolWork(
+  FMBPool* const that,
+  const int iThread);
+
+// Steal half of the remaining chunks of another worker and put them
+// in the deque of the worker #iThread of the FMBPool that
+// Return false if all the other workers have no chunk left
+static bool FMBPoolSteal(
+  FMBPool* const that,
+  const int iThread);
+
+// Add the index iPair at the end of the buffer of results of the
+// worker worker
+static inline void FMBPoolAddResult(
+  FMBPoolWorker* const worker,
+  const int iPair);
+
+// Merge the buffers of results of the workers of the FMBPool that
+// into results, sorted by increasing index
+// Return the number of results
+static int FMBPoolMergeResults(
+  const FMBPool* const that,
+  int* const results);
+
+// Job function of FMBPoolTestPairs3D
+static void FMBPoolTestPairsFun(
+  const int iStart,
+  const int iEnd,
+  const int iThread,
+  void* const data);
+
+// Job function of FMBPoolTestOneVsMany3D
+static void FMBPoolTestOneVsManyFun(
+  const int iStart,
+  const int iEnd,
+  const int iThread,
+  void* const data);
+
+// Comparison function for qsort on int
+static int FMBPoolCmpInt(
+  const void* a,
+  const void* b);
+
+// ------------- Functions implementation -------------
+
+// Create a new FMBPool of nbThread threads (including the calling
+// one)
+FMBPool* FMBPoolCreate(const int nbThread) {
+
+  // Allocate memory
+  FMBPool* that = malloc(sizeof(FMBPool));
+  if (that == NULL) {
+
+    printf("FMBPoolCreate: failed to allocate memory\n");
+    exit(0);
+
+  }
+
+  that->nbThread = (nbThread < 1 ? 1 : nbThread);
+  that->threads = malloc(sizeof(pthread_t) * that->nbThread);
+  that->workers = malloc(sizeof(FMBPoolWorker) * that->nbThread);
+  if (that->threads == NULL || that->workers == NULL) {
+
+    printf("FMBPoolCreate: failed to allocate memory\n");
+    exit(0);
+
+  }
+
+  // Initialise the synchronisation and the job
+  pthread_mutex_init(&(that->lock), NULL);
+  pthread_cond_init(&(that->condStart), NULL);
+  pthread_cond_init(&(that->condEnd), NULL);
+  that->iJob = 0;
+  that->nbRunning = 0;
+  that->isStopping = false;
+  that->fun = NULL;
+  that->data = NULL;
+  that->nb = 0;
+  that->chunkSize = 1;
+
+  // Initialise the workers
+  for (
+    int iThread = that->nbThread;
+    iThread--;) {
+
+    FMBPoolWorker* worker = that->workers + iThread;
+    worker->pool = that;
+    worker->iThread = iThread;
+    pthread_mutex_init(&(worker->lock), NULL);
+    worker->head = 0;
+    worker->tail = 0;
+    worker->results = NULL;
+    worker->nbResult = 0;
+    worker->sizeResult = 0;
+    worker->nbSteal = 0;
+
+  }
+
+  // Create the threads of the workers other than the calling one
+  for (
+    int iThread = 1;
+    iThread < that->nbThread;
+    ++iThread) {
+
+    int ret =
+      pthread_create(
+        that->threads + iThread,
+        NULL,
+        FMBPoolThreadMain,
+        that->workers + iThread);
+    if (ret != 0) {
+
+      printf("FMBPoolCreate: failed to create thread\n");
+      exit(0);
+
+    }
+
+  }
+
+  // Return the new FMBPool
+  return that;
+
+}
+
+// Stop the threads and free the memory used by the FMBPool that
+void FMBPoolFree(FMBPool** that) {
+
+  if (that == NULL || *that == NULL) {
+
+    return;
+
+  }
+
+  // Stop the threads and wait for them
+  pthread_mutex_lock(&((*that)->lock));
+  (*that)->isStopping = true;
+  pthread_cond_broadcast(&((*that)->condStart));
+  pthread_mutex_unlock(&((*that)->lock));
+  for (
+    int iThread = 1;
+    iThread < (*that)->nbThread;
+    ++iThread) {
+
+    pthread_join(
+      (*that)->threads[iThread],
+      NULL);
+
+  }
+
+  // Free memory
+  for (
+    int iThread = (*that)->nbThread;
+    iThread--;) {
+
+    pthread_mutex_destroy(&((*that)->workers[iThread].lock));
+    free((*that)->workers[iThread].results);
+
+  }
+
+  pthread_mutex_destroy(&((*that)->lock));
+  pthread_cond_destroy(&((*that)->condStart));
+  pthread_cond_destroy(&((*that)->condEnd));
+  free((*that)->threads);
+  free((*that)->workers);
+  free(*that);
+  *that = NULL;
+
+}
+
+// Main function of the threads of the workers #1 to #nbThread-1
+static void* FMBPoolThreadMain(void* worker) {
+
+  // Shortcuts
+  FMBPool* that = ((FMBPoolWorker*)worker)->pool;
+  int iThread = ((FMBPoolWorker*)worker)->iThread;
+
+  // Index of the last job run by this thread
+  unsigned long iJob = 0;
+
+  pthread_mutex_lock(&(that->lock));
+  while (true) {
+
+    // Wait for a new job or the stop of the pool
+    while (that->iJob == iJob && that->isStopping == false) {
+
+      pthread_cond_wait(
+        &(that->condStart),
+        &(that->lock));
+
+    }
+
+    if (that->isStopping == true) {
+
+      break;
+
+    }
+
+    iJob = that->iJob;
+    pthread_mutex_unlock(&(that->lock));
+
+    // Run the job
+    FMBPoolWork(
+      that,
+      iThread);
+
+    // Signal the end of the job for this thread
+    pthread_mutex_lock(&(that->lock));
+    --(that->nbRunning);
+    if (that->nbRunning == 0) {
+
+      pthread_cond_signal(&(that->condEnd));
+
+    }
+
+  }
+
+  pthread_mutex_unlock(&(that->lock));
+  return NULL;
+
+}
+
+// Run fun with the user data data on the range of indices [0, nb)
+// split in chunks of chunkSize indices, using all the threads of the
+// FMBPool that
+void FMBPoolRun(
+  FMBPool* const that,
+  const int nb,
+  const int chunkSize,
+  const FMBPoolFun fun,
+  void* const data) {
+
+  // Reset the results of the previous job, also for an empty job whose
+  // results are merged by the callers as any other
+  for (
+    int iThread = that->nbThread;
+    iThread--;) {
+
+    that->workers[iThread].nbResult = 0;
+
+  }
+
+  if (nb <= 0) {
+
+    return;
+
+  }
+
+  // Set the job
+  that->fun = fun;
+  that->data = data;
+  that->nb = nb;
+  that->chunkSize = (chunkSize < 1 ? 1 : chunkSize);
+
+  // Distribute the chunks evenly among the workers, as contiguous
+  // ranges to keep the locality of the indices
+  int nbChunk = (nb + that->chunkSize - 1) / that->chunkSize;
+  for (
+    int iThread = that->nbThread;
+    iThread--;) {
+
+    FMBPoolWorker* worker = that->workers + iThread;
+    worker->head =
+      (int)((long)nbChunk * iThread / that->nbThread);
+    worker->tail =
+      (int)((long)nbChunk * (iThread + 1) / that->nbThread);
+
+  }
+
+  // Start the other threads
+  pthread_mutex_lock(&(that->lock));
+  ++(that->iJob);
+  that->nbRunning = that->nbThread - 1;
+  pthread_cond_broadcast(&(that->condStart));
+  pthread_mutex_unlock(&(that->lock));
+
+  // The calling thread is the worker #0
+  FMBPoolWork(
+    that,
+    0);
+
+  // Wait for the other threads
+  pthread_mutex_lock(&(that->lock));
+  while (that->nbRunning > 0) {
+
+    pthread_cond_wait(
+      &(that->condEnd),
+      &(that->lock));
+
+  }
+
+  pthread_mutex_unlock(&(that->lock));
+
+}
+
+// Run the chunks of the current job from the deque of the worker
+// #iThread of the FMBPool that, then steal and run chunks of the
+// other workers until there is none left
+static void FMBPoolWork(
+  FMBPool* const that,
+  const int iThread) {
+
+  // Shortcut
+  FMBPoolWorker* worker = that->workers + iThread;
+
+  while (true) {
+
+    // Pop the next chunk from the head of the deque
+    int iChunk = -1;
+    pthread_mutex_lock(&(worker->lock));
+    if (worker->head < worker->tail) {
+
+      iChunk = worker->head;
+      ++(worker->head);
+
+    }
+
+    pthread_mutex_unlock(&(worker->lock));
+
+    // If there was a chunk, run it
+    if (iChunk >= 0) {
+
+      int iStart = iChunk * that->chunkSize;
+      int iEnd = iStart + that->chunkSize;
+      if (iEnd > that->nb) {
+
+        iEnd = that->nb;
+
+      }
+
+      that->fun(
+        iStart,
+        iEnd,
+        iThread,
+        that->data);
+
+    // Else, steal chunks from another worker, and stop if there are
+    // none left. As no chunk is ever added to the job, once all the
+    // deques are empty the remaining chunks are being run
+    } else if (
+      FMBPoolSteal(
+        that,
+        iThread) == false) {
+
+      return;
+
+    }
+
+  }
+
+}
+
+// Steal half of the remaining chunks of another worker and put them
+// in the deque of the worker #iThread of the FMBPool that
+static bool FMBPoolSteal(
+  FMBPool* const that,
+  const int iThread) {
+
+  // Loop on the other workers, starting with the next one to spread
+  // the steals
+  for (
+    int iVictim = 1;
+    iVictim < that->nbThread;
+    ++iVictim) {
+
+    FMBPoolWorker* victim =
+      that->workers + (iThread + iVictim) % that->nbThread;
+
+    // Take the second half of the remaining chunks of the victim
+    pthread_mutex_lock(&(victim->lock));
+    int tail = victim->tail;
+    int nbLeft = tail - victim->head;
+    int head = tail - (nbLeft + 1) / 2;
+    if (nbLeft > 0) {
+
+      victim->tail = head;
+
+    }
+
+    pthread_mutex_unlock(&(victim->lock));
+
+    // If chunks have been stolen, move them to the worker's deque
+    if (nbLeft > 0) {
+
+      FMBPoolWorker* worker = that->workers + iThread;
+      pthread_mutex_lock(&(worker->lock));
+      worker->head = head;
+      worker->tail = tail;
+      ++(worker->nbSteal);
+      pthread_mutex_unlock(&(worker->lock));
+      return true;
+
+    }
+
+  }
+
+  // There was nothing to steal
+  return false;
+
+}
+
+// Add the index iPair at the end of the buffer of results of the
+// worker worker
+static inline void FMBPoolAddResult(
+  FMBPoolWorker* const worker,
+  const int iPair) {
+
+  // Grow the buffer if necessary
+  if (worker->nbResult == worker->sizeResult) {
+
+    worker->sizeResult =
+      (worker->sizeResult == 0 ?
+      FMB_POOL_CHUNK_SIZE : 2 * worker->sizeResult);
+    worker->results =
+      realloc(
+        worker->results,
+        sizeof(int) * worker->sizeResult);
+    if (worker->results == NULL) {
+
+      printf("FMBPoolAddResult: failed to allocate memory\n");
+      exit(0);
+
+    }
+
+  }
+
+  worker->results[worker->nbResult] = iPair;
+  ++(worker->nbResult);
+
+}
+
+// Comparison function for qsort on int
+static int FMBPoolCmpInt(
+  const void* a,
+  const void* b) {
+
+  int ia = *(const int*)a;
+  int ib = *(const int*)b;
+  return (ia > ib) - (ia < ib);
+
+}
+
+// Merge the buffers of results of the workers of the FMBPool that
+// into results, sorted by increasing index
+static int FMBPoolMergeResults(
+  const FMBPool* const that,
+  int* const results) {
+
+  // The job is over, so the buffers can be read without lock
+  int nbResult = 0;
+  for (
+    int iThread = 0;
+    iThread < that->nbThread;
+    ++iThread) {
+
+    const FMBPoolWorker* worker = that->workers + iThread;
+    if (worker->nbResult > 0) {
+
+      memcpy(
+        results + nbResult,
+        worker->results,
+        sizeof(int) * worker->nbResult);
+      nbResult += worker->nbResult;
+
+    }
+
+  }
+
+  // The chunks have been run in any order by the workers, sort the
+  // results
+  if (that->nbThread > 1) {
+
+    qsort(
+      results,
+      nbResult,
+      sizeof(int),
+      FMBPoolCmpInt);
+
+  }
+
+  return nbResult;
+
+}
+
+// Job function of FMBPoolTestPairs3D
+static void FMBPoolTestPairsFun(
+  const int iStart,
+  const int iEnd,
+  const int iThread,
+  void* const data) {
+
+  // Shortcuts
+  const FMBPoolTestJob* job = data;
+  FMBPoolWorker* worker = job->pool->workers + iThread;
+
+  // Loop on the pairs of the range
+  for (
+    int iPair = iStart;
+    iPair < iEnd;
+    ++iPair) {
+
+    bool isIntersecting =
+      job->test(
+        job->thatFrames + job->pairs[iPair].iThat,
+        job->thoFrames + job->pairs[iPair].iTho,
+        NULL);
+    if (isIntersecting == true) {
+
+      FMBPoolAddResult(
+        worker,
+        iPair);
+
+    }
+
+  }
+
+}
+
+// Job function of FMBPoolTestOneVsMany3D
+static void FMBPoolTestOneVsManyFun(
+  const int iStart,
+  const int iEnd,
+  const int iThread,
+  void* const data) {
+
+  // Shortcuts
+  const FMBPoolTestJob* job = data;
+  FMBPoolWorker* worker = job->pool->workers + iThread;
+
+  // Loop on the Frames of the range
+  for (
+    int iTho = iStart;
+    iTho < iEnd;
+    ++iTho) {
+
+    bool isIntersecting =
+      job->test(
+        job->thatFrames,
+        job->thoFrames + iTho,
+        NULL);
+    if (isIntersecting == true) {
+
+      FMBPoolAddResult(
+        worker,
+        iTho);
+
+    }
+
+  }
+
+}
+
+// Run test on the nbPair pairs of Frames using all the threads of the
+// FMBPool that
+int FMBPoolTestPairs3D(
+  FMBPool* const that,
+  const Frame3D* const thatFrames,
+  const Frame3D* const thoFrames,
+  const FMBPair* const pairs,
+  const int nbPair,
+  const FMBPoolTest3D test,
+  int* const iIntersecting) {
+
+  FMBPoolTestJob job = {
+
+    .pool = that,
+    .thatFrames = thatFrames,
+    .thoFrames = thoFrames,
+    .pairs = pairs,
+    .test = test
+
+  };
+  FMBPoolRun(
+    that,
+    nbPair,
+    FMB_POOL_CHUNK_SIZE,
+    FMBPoolTestPairsFun,
+    &job);
+  return
+    FMBPoolMergeResults(
+      that,
+      iIntersecting);
+
+}
+
+// Run test on the nbTho pairs of Frames (frame, thos[i]) using all the
+// threads of the FMBPool that
+int FMBPoolTestOneVsMany3D(
+  FMBPool* const that,
+  const Frame3D* const frame,
+  const Frame3D* const thos,
+  const int nbTho,
+  const FMBPoolTest3D test,
+  int* const iIntersecting) {
+
+  FMBPoolTestJob job = {
+
+    .pool = that,
+    .thatFrames = frame,
+    .thoFrames = thos,
+    .pairs = NULL,
+    .test = test
+
+  };
+  FMBPoolRun(
+    that,
+    nbTho,
+    FMB_POOL_CHUNK_SIZE,
+    FMBPoolTestOneVsManyFun,
+    &job);
+  return
+    FMBPoolMergeResults(
+      that,
+      iIntersecting);
+
+}
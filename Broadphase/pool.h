@@ -0,0 +1,193 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef __POOL_H_
+#define __POOL_H_
+
+#include <stdbool.h>
+#include <pthread.h>
+#include "frame.h"
+
+// ------------- Macros -------------
+
+// Default number of pairs per chunk for FMBPoolTestPairs3D and
+// FMBPoolTestOneVsMany3D. A chunk is the unit of work stolen between
+// threads: small enough to balance the load, large enough for the
+// cost of the lock to be negligible relatively to the tests
+#define FMB_POOL_CHUNK_SIZE 64
+
+// Size of a cache line, used to pad the workers and avoid false
+// sharing of their deques and result buffers
+#define FMB_POOL_CACHE_LINE 64
+
+// ------------- Data structures -------------
+
+// Pair of Frames to test, index of the Frame in the first set and in
+// the second set
+typedef struct {
+
+  int iThat;
+  int iTho;
+
+} FMBPair;
+
+// Function run by the FMBPool on the range of indices [iStart, iEnd)
+// of a job, iThread is the index of the thread running it (in
+// [0, nbThread)) and data the user data given to FMBPoolRun
+typedef void (*FMBPoolFun)(
+  const int iStart,
+  const int iEnd,
+  const int iThread,
+  void* const data);
+
+// Intersection test run by FMBPoolTestPairs3D and
+// FMBPoolTestOneVsMany3D, with the same signature as
+// FMBTestIntersection3D (bdgBox is always null)
+// FMBTestIntersection3D and SATTestIntersection3D can be used, the
+// only shared state they modify is the statistics of the pruning and
+// of the elimination of FMB, which each thread records separately (cf
+// FMBGetPruneStats3D, FMBGetElimStats3D)
+typedef bool (*FMBPoolTest3D)(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  AABB3D* const bdgBox);
+
+struct FMBPool;
+
+// Worker of a FMBPool
+typedef struct {
+
+  // Pool owning the worker and index of the worker in the pool
+  struct FMBPool* pool;
+  int iThread;
+
+  // Deque of the chunks of the current job not yet run by the worker,
+  // [head, tail), the worker pops from the head and the other workers
+  // steal from the tail
+  pthread_mutex_t lock;
+  int head;
+  int tail;
+
+  // Buffer of the results of the worker for the current job, its
+  // number of results and its size
+  int* results;
+  int nbResult;
+  int sizeResult;
+
+  // Nb of steals by the worker since the creation of the pool
+  unsigned long nbSteal;
+
+  // Padding to keep the workers on separate cache lines
+  char pad[FMB_POOL_CACHE_LINE];
+
+} FMBPoolWorker;
+
+// Pool of threads running jobs split into chunks of contiguous indices
+// with work stealing
+// The calling thread is the worker #0, the other nbThread - 1 workers
+// are threads created with the pool and waiting for jobs
+typedef struct FMBPool {
+
+  // Nb of threads, including the calling one
+  int nbThread;
+
+  // Threads of the workers #1 to #nbThread-1
+  pthread_t* threads;
+
+  // Workers
+  FMBPoolWorker* workers;
+
+  // Synchronisation of the start and end of the jobs
+  pthread_mutex_t lock;
+  pthread_cond_t condStart;
+  pthread_cond_t condEnd;
+
+  // Index of the current job, incremented at each new job
+  unsigned long iJob;
+
+  // Nb of threads still running the current job
+  int nbRunning;
+
+  // Flag to stop the threads
+  bool isStopping;
+
+  // Current job: function, user data, nb of indices and nb of indices
+  // per chunk
+  FMBPoolFun fun;
+  void* data;
+  int nb;
+  int chunkSize;
+
+} FMBPool;
+
+// ------------- Functions declaration -------------
+
+// Create a new FMBPool of nbThread threads (including the calling
+// one, so 1 means no other thread)
+FMBPool* FMBPoolCreate(const int nbThread);
+
+// Stop the threads and free the memory used by the FMBPool that
+void FMBPoolFree(FMBPool** that);
+
+// Run fun with the user data data on the range of indices [0, nb)
+// split in chunks of chunkSize indices, using all the threads of the
+// FMBPool that, and return when all the chunks have been run
+// The chunks are distributed evenly among the workers at start, and a
+// worker without chunk left steals half the remaining ones of another
+// worker
+// fun is run concurrently on disjoint ranges and must be thread safe
+// for those
+void FMBPoolRun(
+  FMBPool* const that,
+  const int nb,
+  const int chunkSize,
+  const FMBPoolFun fun,
+  void* const data);
+
+// Run test on the nbPair pairs of Frames (thatFrames[pairs[i].iThat],
+// thoFrames[pairs[i].iTho]) using all the threads of the FMBPool that
+// The indices i of the intersecting pairs are stored in increasing
+// order in iIntersecting, which must have at least nbPair elements
+// Each thread stores its results in its own buffer, merged at the end
+// of the job
+// Return the number of intersecting pairs
+int FMBPoolTestPairs3D(
+  FMBPool* const that,
+  const Frame3D* const thatFrames,
+  const Frame3D* const thoFrames,
+  const FMBPair* const pairs,
+  const int nbPair,
+  const FMBPoolTest3D test,
+  int* const iIntersecting);
+
+// Run test on the nbTho pairs of Frames (frame, thos[i]) using all the
+// threads of the FMBPool that
+// The indices i of the intersecting pairs are stored in increasing
+// order in iIntersecting, which must have at least nbTho elements
+// Return the number of intersecting pairs
+int FMBPoolTestOneVsMany3D(
+  FMBPool* const that,
+  const Frame3D* const frame,
+  const Frame3D* const thos,
+  const int nbTho,
+  const FMBPoolTest3D test,
+  int* const iIntersecting);
+
+#endif
@@ -0,0 +1,760 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Include standard libraries
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <math.h>
+#include <time.h>
+
+// Include the broadphase library and the benchmark harness
+#include "broadphase.h"
+#include "bench.h"
+
+// Epsilon to detect degenerated Frames
+#define EPSILON 0.1
+
+// Size of the cube containing the origins of the Frames for the
+// smallest scene, the size of the other scenes is scaled to keep the
+// density of Frames constant
+#define RANGE_SCENE 40.0
+
+// Range of values for the components of the Frames
+#define RANGE_COMP 1.0
+
+// Max displacement of a Frame per step
+#define RANGE_MOVE 0.1
+
+// Range of values for the initial speed of the moving Frames, the
+// speed then varies by up to RANGE_MOVE per step
+#define RANGE_SPEED 0.5
+
+// Nb of steps per scene
+#define NB_STEPS 10
+
+// Nb of scenes and nb of Frames per scene
+#define NB_SCENES 3
+const int nbFramesScene[NB_SCENES] = {1000, 10000, 100000};
+
+// Max nb of Frames for the brute force test, above it's too slow
+#define NB_FRAMES_MAX_BRUTE 10000
+
+// Helper macro to generate random number in [0.0, 1.0]
+#define rnd() (double)(rand())/(double)(RAND_MAX)
+
+// Return a random Frame3D of size about RANGE_COMP located in the
+// cube [0, range]^3
+Frame3D RandomFrame3D(const double range) {
+
+  // Loop until we get a non degenerated Frame
+  while (true) {
+
+    // 50% chance of being a Cuboid or a Tetrahedron
+    FrameType type = (rnd() < 0.5 ? FrameCuboid : FrameTetrahedron);
+
+    // Random origin and components
+    FMB_REAL orig[3];
+    FMB_REAL comp[3][3];
+    for (
+      int iAxis = 3;
+      iAxis--;) {
+
+      orig[iAxis] = rnd() * range;
+
+      for (
+        int iComp = 3;
+        iComp--;) {
+
+        comp[iComp][iAxis] = -RANGE_COMP + 2.0 * rnd() * RANGE_COMP;
+
+      }
+
+    }
+
+    // If the determinant is not null, ie the Frame is not degenerate
+    double det =
+      comp[0][0] * (comp[1][1] * comp[2][2] -
+      comp[1][2] * comp[2][1]) -
+      comp[1][0] * (comp[0][1] * comp[2][2] -
+      comp[0][2] * comp[2][1]) +
+      comp[2][0] * (comp[0][1] * comp[1][2] -
+      comp[0][2] * comp[1][1]);
+    if (fabs(det) > EPSILON * RANGE_COMP) {
+
+      return
+        Frame3DCreateStatic(
+          type,
+          orig,
+          comp);
+
+    }
+
+  }
+
+}
+
+// Return a random Frame2DTime of size about RANGE_COMP located in the
+// square [0, range]^2 and moving at a speed up to RANGE_SPEED along
+// each axis
+Frame2DTime RandomFrame2DTime(const double range) {
+
+  // Loop until we get a non degenerated Frame
+  while (true) {
+
+    // 50% chance of being a Cuboid or a Tetrahedron
+    FrameType type = (rnd() < 0.5 ? FrameCuboid : FrameTetrahedron);
+
+    // Random origin, speed and components
+    FMB_REAL orig[2];
+    FMB_REAL speed[2];
+    FMB_REAL comp[2][2];
+    for (
+      int iAxis = 2;
+      iAxis--;) {
+
+      orig[iAxis] = rnd() * range;
+      speed[iAxis] = -RANGE_SPEED + 2.0 * rnd() * RANGE_SPEED;
+
+      for (
+        int iComp = 2;
+        iComp--;) {
+
+        comp[iComp][iAxis] = -RANGE_COMP + 2.0 * rnd() * RANGE_COMP;
+
+      }
+
+    }
+
+    // If the determinant is not null, ie the Frame is not degenerate
+    double det = comp[0][0] * comp[1][1] - comp[1][0] * comp[0][1];
+    if (fabs(det) > EPSILON * RANGE_COMP) {
+
+      return
+        Frame2DTimeCreateStatic(
+          type,
+          orig,
+          speed,
+          comp);
+
+    }
+
+  }
+
+}
+
+// Return a random Frame3DTime of size about RANGE_COMP located in the
+// cube [0, range]^3 and moving at a speed up to RANGE_SPEED along
+// each axis
+Frame3DTime RandomFrame3DTime(const double range) {
+
+  // Loop until we get a non degenerated Frame
+  while (true) {
+
+    // 50% chance of being a Cuboid or a Tetrahedron
+    FrameType type = (rnd() < 0.5 ? FrameCuboid : FrameTetrahedron);
+
+    // Random origin, speed and components
+    FMB_REAL orig[3];
+    FMB_REAL speed[3];
+    FMB_REAL comp[3][3];
+    for (
+      int iAxis = 3;
+      iAxis--;) {
+
+      orig[iAxis] = rnd() * range;
+      speed[iAxis] = -RANGE_SPEED + 2.0 * rnd() * RANGE_SPEED;
+
+      for (
+        int iComp = 3;
+        iComp--;) {
+
+        comp[iComp][iAxis] = -RANGE_COMP + 2.0 * rnd() * RANGE_COMP;
+
+      }
+
+    }
+
+    // If the determinant is not null, ie the Frame is not degenerate
+    double det =
+      comp[0][0] * (comp[1][1] * comp[2][2] -
+      comp[1][2] * comp[2][1]) -
+      comp[1][0] * (comp[0][1] * comp[2][2] -
+      comp[0][2] * comp[2][1]) +
+      comp[2][0] * (comp[0][1] * comp[1][2] -
+      comp[0][2] * comp[1][1]);
+    if (fabs(det) > EPSILON * RANGE_COMP) {
+
+      return
+        Frame3DTimeCreateStatic(
+          type,
+          orig,
+          speed,
+          comp);
+
+    }
+
+  }
+
+}
+
+// Return the time in microseconds elapsed since start, start being in
+// nanoseconds as returned by BenchGetNs
+double GetDeltaus(const double start) {
+
+  return (BenchGetNs() - start) / 1000.0;
+
+}
+
+// Qualification of the sweep and prune on scenes of increasing number
+// of Frames moving randomly, at constant density
+// Measure the time per step of the update of the endpoints and of the
+// collision, and compare with the brute force test of all the pairs
+// (bounding boxes then FMB) for the smallest scenes
+void QualifyBroadphase(void) {
+
+  // Open the file to save the results
+  FILE* fp = fopen("../Results/qualificationBroadphase.txt", "w");
+  fprintf(fp,
+    "nbFrame\tupdate\tcollide\tnbSwap\tnbCandidate\tnbInter\tbrute\n");
+
+  // Loop on the scenes
+  for (
+    int iScene = 0;
+    iScene < NB_SCENES;
+    ++iScene) {
+
+    // Create the random scene
+    int nbFrame = nbFramesScene[iScene];
+    double range =
+      RANGE_SCENE * cbrt((double)nbFrame / (double)nbFramesScene[0]);
+    Frame3D* frames = malloc(sizeof(Frame3D) * nbFrame);
+    for (
+      int iFrame = nbFrame;
+      iFrame--;) {
+
+      frames[iFrame] = RandomFrame3D(range);
+
+    }
+
+    // Create the sweep and prune and run a first update to have
+    // the endpoints sorted before the measure
+    SAP3D* sap = SAP3DCreate();
+    SAP3DUpdate(
+      sap,
+      frames,
+      nbFrame);
+
+    // Declare variables to sum the time and statistics per step
+    double sumUpdate = 0.0;
+    double sumCollide = 0.0;
+    unsigned long sumSwap = 0;
+    unsigned long sumCandidate = 0;
+    unsigned long sumInter = 0;
+
+    // Loop on the steps
+    for (
+      int iStep = NB_STEPS;
+      iStep--;) {
+
+      // Move the Frames randomly
+      for (
+        int iFrame = nbFrame;
+        iFrame--;) {
+
+        FMB_REAL v[3];
+        for (
+          int iAxis = 3;
+          iAxis--;) {
+
+          v[iAxis] = -RANGE_MOVE + 2.0 * rnd() * RANGE_MOVE;
+
+        }
+
+        Frame3DTranslate(
+          frames + iFrame,
+          v);
+
+      }
+
+      // Measure the update of the endpoints
+      double start = BenchGetNs();
+      SAP3DUpdate(
+        sap,
+        frames,
+        nbFrame);
+      sumUpdate += GetDeltaus(start);
+
+      // Measure the collision
+      start = BenchGetNs();
+      SAP3DCollide(
+        sap,
+        frames,
+        NULL,
+        NULL);
+      sumCollide += GetDeltaus(start);
+
+      sumSwap += sap->nbSwap;
+      sumCandidate += sap->nbCandidate;
+      sumInter += sap->nbIntersection;
+
+    }
+
+    // If the scene is small enough, measure the brute force test on
+    // the last step
+    double timeBrute = -1.0;
+    if (nbFrame <= NB_FRAMES_MAX_BRUTE) {
+
+      double start = BenchGetNs();
+      unsigned long nbInterBrute = 0;
+      for (
+        int iFrame = 0;
+        iFrame < nbFrame;
+        ++iFrame) {
+
+        for (
+          int jFrame = iFrame + 1;
+          jFrame < nbFrame;
+          ++jFrame) {
+
+          if (
+            AABBTestIntersection3D(
+              &(frames[iFrame].bdgBox),
+              &(frames[jFrame].bdgBox)) == true &&
+            FMBTestIntersection3D(
+              frames + iFrame,
+              frames + jFrame,
+              NULL) == true) {
+
+            ++nbInterBrute;
+
+          }
+
+        }
+
+      }
+
+      timeBrute = GetDeltaus(start);
+
+      // Check the result against the sweep and prune
+      if (nbInterBrute != sap->nbIntersection) {
+
+        printf("Brute force and sweep and prune disagree ");
+        printf("(%lu, %lu)\n", nbInterBrute, sap->nbIntersection);
+
+      }
+
+    }
+
+    // Display and save the results (time in ms per step)
+    double timeUpdate = sumUpdate / (double)NB_STEPS / 1000.0;
+    double timeCollide = sumCollide / (double)NB_STEPS / 1000.0;
+    printf("%d Frames: update %.3fms, collide %.3fms, ",
+      nbFrame, timeUpdate, timeCollide);
+    printf("swaps %lu, candidates %lu, intersections %lu",
+      sumSwap / NB_STEPS, sumCandidate / NB_STEPS, sumInter / NB_STEPS);
+    if (timeBrute >= 0.0) {
+
+      printf(", brute force %.3fms", timeBrute / 1000.0);
+
+    }
+
+    printf("\n");
+    fprintf(fp, "%d\t%.3f\t%.3f\t%lu\t%lu\t%lu\t%.3f\n",
+      nbFrame, timeUpdate, timeCollide, sumSwap / NB_STEPS,
+      sumCandidate / NB_STEPS, sumInter / NB_STEPS, timeBrute / 1000.0);
+
+    // Free memory
+    SAP3DFree(&sap);
+    free(frames);
+
+  }
+
+  // Close the file
+  fclose(fp);
+
+}
+
+// Qualification of the sweep and prune on scenes of increasing number
+// of Frames moving with a randomly varying speed, at constant density,
+// as QualifyBroadphase
+// Measure the time per step of the update of the endpoints and of the
+// collision, and compare with the brute force test of all the pairs
+// (swept bounding boxes then FMB) for the smallest scenes
+void QualifyBroadphase2DTime(void) {
+
+  // Open the file to save the results
+  FILE* fp = fopen("../Results/qualificationBroadphase2DTime.txt", "w");
+  fprintf(fp,
+    "nbFrame\tupdate\tcollide\tnbSwap\tnbCandidate\tnbInter\tbrute\n");
+
+  // Loop on the scenes
+  for (
+    int iScene = 0;
+    iScene < NB_SCENES;
+    ++iScene) {
+
+    // Create the random scene
+    int nbFrame = nbFramesScene[iScene];
+    double range =
+      RANGE_SCENE * sqrt((double)nbFrame / (double)nbFramesScene[0]);
+    Frame2DTime* frames = malloc(sizeof(Frame2DTime) * nbFrame);
+    for (
+      int iFrame = nbFrame;
+      iFrame--;) {
+
+      frames[iFrame] = RandomFrame2DTime(range);
+
+    }
+
+    // Create the sweep and prune and run a first update to have
+    // the endpoints sorted before the measure
+    SAP2DTime* sap = SAP2DTimeCreate();
+    SAP2DTimeUpdate(
+      sap,
+      frames,
+      nbFrame);
+
+    // Declare variables to sum the time and statistics per step
+    double sumUpdate = 0.0;
+    double sumCollide = 0.0;
+    unsigned long sumSwap = 0;
+    unsigned long sumCandidate = 0;
+    unsigned long sumInter = 0;
+
+    // Loop on the steps
+    for (
+      int iStep = NB_STEPS;
+      iStep--;) {
+
+      // Move the Frames to their position at the end of the previous
+      // step and vary their speed randomly
+      for (
+        int iFrame = nbFrame;
+        iFrame--;) {
+
+        FMB_REAL orig[2];
+        FMB_REAL speed[2];
+        for (
+          int iAxis = 2;
+          iAxis--;) {
+
+          orig[iAxis] =
+            frames[iFrame].orig[iAxis] + frames[iFrame].speed[iAxis];
+          speed[iAxis] =
+            frames[iFrame].speed[iAxis] - RANGE_MOVE +
+            2.0 * rnd() * RANGE_MOVE;
+
+        }
+
+        Frame2DTimeSetMotion(
+          frames + iFrame,
+          orig,
+          speed);
+
+      }
+
+      // Measure the update of the endpoints
+      double start = BenchGetNs();
+      SAP2DTimeUpdate(
+        sap,
+        frames,
+        nbFrame);
+      sumUpdate += GetDeltaus(start);
+
+      // Measure the collision
+      start = BenchGetNs();
+      SAP2DTimeCollide(
+        sap,
+        frames,
+        NULL,
+        NULL);
+      sumCollide += GetDeltaus(start);
+
+      sumSwap += sap->nbSwap;
+      sumCandidate += sap->nbCandidate;
+      sumInter += sap->nbIntersection;
+
+    }
+
+    // If the scene is small enough, measure the brute force test on
+    // the last step
+    double timeBrute = -1.0;
+    if (nbFrame <= NB_FRAMES_MAX_BRUTE) {
+
+      double start = BenchGetNs();
+      unsigned long nbInterBrute = 0;
+      for (
+        int iFrame = 0;
+        iFrame < nbFrame;
+        ++iFrame) {
+
+        for (
+          int jFrame = iFrame + 1;
+          jFrame < nbFrame;
+          ++jFrame) {
+
+          if (
+            AABBTestIntersection2DTime(
+              &(frames[iFrame].bdgBox),
+              &(frames[jFrame].bdgBox)) == true &&
+            FMBTestIntersection2DTime(
+              frames + iFrame,
+              frames + jFrame,
+              NULL) == true) {
+
+            ++nbInterBrute;
+
+          }
+
+        }
+
+      }
+
+      timeBrute = GetDeltaus(start);
+
+      // Check the result against the sweep and prune
+      if (nbInterBrute != sap->nbIntersection) {
+
+        printf("Brute force and sweep and prune disagree ");
+        printf("(%lu, %lu)\n", nbInterBrute, sap->nbIntersection);
+
+      }
+
+    }
+
+    // Display and save the results (time in ms per step)
+    double timeUpdate = sumUpdate / (double)NB_STEPS / 1000.0;
+    double timeCollide = sumCollide / (double)NB_STEPS / 1000.0;
+    printf("%d Frames: update %.3fms, collide %.3fms, ",
+      nbFrame, timeUpdate, timeCollide);
+    printf("swaps %lu, candidates %lu, intersections %lu",
+      sumSwap / NB_STEPS, sumCandidate / NB_STEPS, sumInter / NB_STEPS);
+    if (timeBrute >= 0.0) {
+
+      printf(", brute force %.3fms", timeBrute / 1000.0);
+
+    }
+
+    printf("\n");
+    fprintf(fp, "%d\t%.3f\t%.3f\t%lu\t%lu\t%lu\t%.3f\n",
+      nbFrame, timeUpdate, timeCollide, sumSwap / NB_STEPS,
+      sumCandidate / NB_STEPS, sumInter / NB_STEPS, timeBrute / 1000.0);
+
+    // Free memory
+    SAP2DTimeFree(&sap);
+    free(frames);
+
+  }
+
+  // Close the file
+  fclose(fp);
+
+}
+
+// Qualification of the sweep and prune on scenes of increasing number
+// of Frames moving with a randomly varying speed, at constant density,
+// as QualifyBroadphase
+// Measure the time per step of the update of the endpoints and of the
+// collision, and compare with the brute force test of all the pairs
+// (swept bounding boxes then FMB) for the smallest scenes
+void QualifyBroadphase3DTime(void) {
+
+  // Open the file to save the results
+  FILE* fp = fopen("../Results/qualificationBroadphase3DTime.txt", "w");
+  fprintf(fp,
+    "nbFrame\tupdate\tcollide\tnbSwap\tnbCandidate\tnbInter\tbrute\n");
+
+  // Loop on the scenes
+  for (
+    int iScene = 0;
+    iScene < NB_SCENES;
+    ++iScene) {
+
+    // Create the random scene
+    int nbFrame = nbFramesScene[iScene];
+    double range =
+      RANGE_SCENE * cbrt((double)nbFrame / (double)nbFramesScene[0]);
+    Frame3DTime* frames = malloc(sizeof(Frame3DTime) * nbFrame);
+    for (
+      int iFrame = nbFrame;
+      iFrame--;) {
+
+      frames[iFrame] = RandomFrame3DTime(range);
+
+    }
+
+    // Create the sweep and prune and run a first update to have
+    // the endpoints sorted before the measure
+    SAP3DTime* sap = SAP3DTimeCreate();
+    SAP3DTimeUpdate(
+      sap,
+      frames,
+      nbFrame);
+
+    // Declare variables to sum the time and statistics per step
+    double sumUpdate = 0.0;
+    double sumCollide = 0.0;
+    unsigned long sumSwap = 0;
+    unsigned long sumCandidate = 0;
+    unsigned long sumInter = 0;
+
+    // Loop on the steps
+    for (
+      int iStep = NB_STEPS;
+      iStep--;) {
+
+      // Move the Frames to their position at the end of the previous
+      // step and vary their speed randomly
+      for (
+        int iFrame = nbFrame;
+        iFrame--;) {
+
+        FMB_REAL orig[3];
+        FMB_REAL speed[3];
+        for (
+          int iAxis = 3;
+          iAxis--;) {
+
+          orig[iAxis] =
+            frames[iFrame].orig[iAxis] + frames[iFrame].speed[iAxis];
+          speed[iAxis] =
+            frames[iFrame].speed[iAxis] - RANGE_MOVE +
+            2.0 * rnd() * RANGE_MOVE;
+
+        }
+
+        Frame3DTimeSetMotion(
+          frames + iFrame,
+          orig,
+          speed);
+
+      }
+
+      // Measure the update of the endpoints
+      double start = BenchGetNs();
+      SAP3DTimeUpdate(
+        sap,
+        frames,
+        nbFrame);
+      sumUpdate += GetDeltaus(start);
+
+      // Measure the collision
+      start = BenchGetNs();
+      SAP3DTimeCollide(
+        sap,
+        frames,
+        NULL,
+        NULL);
+      sumCollide += GetDeltaus(start);
+
+      sumSwap += sap->nbSwap;
+      sumCandidate += sap->nbCandidate;
+      sumInter += sap->nbIntersection;
+
+    }
+
+    // If the scene is small enough, measure the brute force test on
+    // the last step
+    double timeBrute = -1.0;
+    if (nbFrame <= NB_FRAMES_MAX_BRUTE) {
+
+      double start = BenchGetNs();
+      unsigned long nbInterBrute = 0;
+      for (
+        int iFrame = 0;
+        iFrame < nbFrame;
+        ++iFrame) {
+
+        for (
+          int jFrame = iFrame + 1;
+          jFrame < nbFrame;
+          ++jFrame) {
+
+          if (
+            AABBTestIntersection3DTime(
+              &(frames[iFrame].bdgBox),
+              &(frames[jFrame].bdgBox)) == true &&
+            FMBTestIntersection3DTime(
+              frames + iFrame,
+              frames + jFrame,
+              NULL) == true) {
+
+            ++nbInterBrute;
+
+          }
+
+        }
+
+      }
+
+      timeBrute = GetDeltaus(start);
+
+      // Check the result against the sweep and prune
+      if (nbInterBrute != sap->nbIntersection) {
+
+        printf("Brute force and sweep and prune disagree ");
+        printf("(%lu, %lu)\n", nbInterBrute, sap->nbIntersection);
+
+      }
+
+    }
+
+    // Display and save the results (time in ms per step)
+    double timeUpdate = sumUpdate / (double)NB_STEPS / 1000.0;
+    double timeCollide = sumCollide / (double)NB_STEPS / 1000.0;
+    printf("%d Frames: update %.3fms, collide %.3fms, ",
+      nbFrame, timeUpdate, timeCollide);
+    printf("swaps %lu, candidates %lu, intersections %lu",
+      sumSwap / NB_STEPS, sumCandidate / NB_STEPS, sumInter / NB_STEPS);
+    if (timeBrute >= 0.0) {
+
+      printf(", brute force %.3fms", timeBrute / 1000.0);
+
+    }
+
+    printf("\n");
+    fprintf(fp, "%d\t%.3f\t%.3f\t%lu\t%lu\t%lu\t%.3f\n",
+      nbFrame, timeUpdate, timeCollide, sumSwap / NB_STEPS,
+      sumCandidate / NB_STEPS, sumInter / NB_STEPS, timeBrute / 1000.0);
+
+    // Free memory
+    SAP3DTimeFree(&sap);
+    free(frames);
+
+  }
+
+  // Close the file
+  fclose(fp);
+
+}
+
+int main(int argc, char** argv) {
+
+  // Initialise the random generator
+  srand(time(NULL));
+
+  // Run the qualification
+  QualifyBroadphase();
+  QualifyBroadphase2DTime();
+  QualifyBroadphase3DTime();
+
+  return 0;
+
+}
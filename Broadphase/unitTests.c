@@ -0,0 +1,1374 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Include standard libraries
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <math.h>
+
+// Include the broadphase library
+#include "broadphase.h"
+#include "bvh.h"
+#include "pool.h"
+
+// Max nb of Frames in the unit tests
+#define NB_FRAMES_MAX 8
+
+// Nb of Frames per set in the unit tests of the BVH3D
+#define NB_FRAMES_BVH 50
+
+// Nb of indices of the jobs in the unit tests of the FMBPool
+#define NB_INDEX_POOL 1000
+
+// Structure to memorize the pairs reported by SAP3DCollide
+typedef struct {
+
+  bool isIntersecting[NB_FRAMES_MAX][NB_FRAMES_MAX];
+
+} Pairs;
+
+// Function called on each pair of intersecting Frames, memorize the
+// pair in the Pairs data
+void MemorizePair(
+  const int iFrame,
+  const int jFrame,
+  void* const data) {
+
+  Pairs* pairs = data;
+  if (pairs->isIntersecting[iFrame][jFrame] == true || iFrame >= jFrame) {
+
+    printf("UnitTestSAP3D pair (%d, %d) reported twice or unordered Failed\n",
+      iFrame, jFrame);
+    exit(0);
+
+  }
+
+  pairs->isIntersecting[iFrame][jFrame] = true;
+
+}
+
+// Create nbFrame unit cubes at the origins orig
+void CreateCubes(
+  const int nbFrame,
+  const FMB_REAL orig[][3],
+  Frame3D* const frames) {
+
+  FMB_REAL comp[3][3] = {
+
+    {1.0, 0.0, 0.0},
+    {0.0, 1.0, 0.0},
+    {0.0, 0.0, 1.0}
+
+  };
+  for (
+    int iFrame = nbFrame;
+    iFrame--;) {
+
+    frames[iFrame] =
+      Frame3DCreateStatic(
+        FrameCuboid,
+        orig[iFrame],
+        comp);
+
+  }
+
+}
+
+// Unit test function
+// Update the SAP3D sap with the nbFrame Frames frames, run the
+// collision and check the reported pairs are the nbPair pairs
+// expected (expected[iPair][0] < expected[iPair][1])
+void UnitTestSAP3D(
+  SAP3D* const sap,
+  const Frame3D* const frames,
+  const int nbFrame,
+  const int nbPair,
+  const int expected[][2]) {
+
+  // Update the sweep and prune and run the collision
+  Pairs pairs = {0};
+  SAP3DUpdate(
+    sap,
+    frames,
+    nbFrame);
+  unsigned long nbInter =
+    SAP3DCollide(
+      sap,
+      frames,
+      MemorizePair,
+      &pairs);
+
+  // Check the number of reported pairs
+  if (nbInter != (unsigned long)nbPair) {
+
+    printf("UnitTestSAP3D Failed\n");
+    printf("Expected %d pairs, got %lu\n", nbPair, nbInter);
+    exit(0);
+
+  }
+
+  // Check the reported pairs
+  for (
+    int iPair = nbPair;
+    iPair--;) {
+
+    if (
+      pairs.isIntersecting[expected[iPair][0]][expected[iPair][1]] ==
+      false) {
+
+      printf("UnitTestSAP3D Failed\n");
+      printf("Expected pair (%d, %d) not reported\n",
+        expected[iPair][0], expected[iPair][1]);
+      exit(0);
+
+    }
+
+  }
+
+  // Check the endpoints are sorted
+  for (
+    int iEndpoint = 1;
+    iEndpoint < 2 * nbFrame;
+    ++iEndpoint) {
+
+    if (sap->endpoints[iEndpoint - 1].val > sap->endpoints[iEndpoint].val) {
+
+      printf("UnitTestSAP3D Failed\n");
+      printf("Endpoints are not sorted\n");
+      exit(0);
+
+    }
+
+  }
+
+}
+
+void TestSAP3D(void) {
+
+  // Create the sweep and prune
+  SAP3D* sap = SAP3DCreate();
+
+  // ----------------------------
+  // Set of cubes spread along the first axis, two pairs intersecting
+  FMB_REAL orig[4][3] = {
+
+    {0.0, 0.0, 0.0},
+    {0.5, 0.5, 0.0},
+    {3.0, 0.0, 0.0},
+    {3.5, 0.0, 0.5}
+
+  };
+  Frame3D frames[NB_FRAMES_MAX];
+  CreateCubes(
+    4,
+    orig,
+    frames);
+  int expected[3][2] = {{0, 1}, {2, 3}};
+  UnitTestSAP3D(
+    sap,
+    frames,
+    4,
+    2,
+    expected);
+  if (sap->axis != 0) {
+
+    printf("UnitTestSAP3D Failed\n");
+    printf("Expected sweep axis 0, got %d\n", sap->axis);
+    exit(0);
+
+  }
+
+  printf("UnitTestSAP3D static Succeed\n");
+
+  // ----------------------------
+  // Move the second cube next to the third one
+  FMB_REAL v[3] = {2.0, -0.5, 0.0};
+  Frame3DTranslate(
+    frames + 1,
+    v);
+  int expectedMoved[3][2] = {{1, 2}, {1, 3}, {2, 3}};
+  UnitTestSAP3D(
+    sap,
+    frames,
+    4,
+    3,
+    expectedMoved);
+  if (sap->nbSwap == 0) {
+
+    printf("UnitTestSAP3D Failed\n");
+    printf("Expected the endpoints to be resorted incrementally\n");
+    exit(0);
+
+  }
+
+  printf("UnitTestSAP3D incremental Succeed\n");
+
+  // ----------------------------
+  // Cubes overlapping along the first axis but not the others
+  FMB_REAL origNoInter[3][3] = {
+
+    {0.0, 0.0, 0.0},
+    {0.5, 2.0, 0.0},
+    {0.2, 0.0, 4.0}
+
+  };
+  CreateCubes(
+    3,
+    origNoInter,
+    frames);
+  UnitTestSAP3D(
+    sap,
+    frames,
+    3,
+    0,
+    expected);
+  if (sap->nbCandidate != 0) {
+
+    printf("UnitTestSAP3D Failed\n");
+    printf("Expected no candidate pair, got %lu\n", sap->nbCandidate);
+    exit(0);
+
+  }
+
+  // The third axis has the largest variance
+  if (sap->axis != 2) {
+
+    printf("UnitTestSAP3D Failed\n");
+    printf("Expected sweep axis 2, got %d\n", sap->axis);
+    exit(0);
+
+  }
+
+  printf("UnitTestSAP3D sweep axis Succeed\n");
+
+  // ----------------------------
+  // Bounding boxes intersecting but not the Frames
+  FMB_REAL origTetra[3] = {0.0, 0.0, 0.0};
+  FMB_REAL compTetra[3][3] = {
+
+    {1.0, 0.0, 0.0},
+    {0.0, 1.0, 0.0},
+    {0.0, 0.0, 1.0}
+
+  };
+  frames[0] =
+    Frame3DCreateStatic(
+      FrameTetrahedron,
+      origTetra,
+      compTetra);
+  FMB_REAL origCube[3] = {0.8, 0.8, 0.8};
+  FMB_REAL compCube[3][3] = {
+
+    {0.5, 0.0, 0.0},
+    {0.0, 0.5, 0.0},
+    {0.0, 0.0, 0.5}
+
+  };
+  frames[1] =
+    Frame3DCreateStatic(
+      FrameCuboid,
+      origCube,
+      compCube);
+  UnitTestSAP3D(
+    sap,
+    frames,
+    2,
+    0,
+    expected);
+  if (sap->nbCandidate != 1) {
+
+    printf("UnitTestSAP3D Failed\n");
+    printf("Expected one candidate pair, got %lu\n", sap->nbCandidate);
+    exit(0);
+
+  }
+
+  printf("UnitTestSAP3D narrow phase Succeed\n");
+
+  // Free memory
+  SAP3DFree(&sap);
+
+  // If we reached here, it means all the unit tests succeed
+  printf("All unit tests SAP3D have succeed.\n");
+
+}
+
+// Unit test function
+// Update the SAP2DTime sap with the nbFrame Frames frames, run the
+// collision and check the reported pairs are the nbPair pairs
+// expected (expected[iPair][0] < expected[iPair][1]), and the number
+// of candidate pairs is nbCandidate
+void UnitTestSAP2DTime(
+  SAP2DTime* const sap,
+  const Frame2DTime* const frames,
+  const int nbFrame,
+  const int nbPair,
+  const int expected[][2],
+  const unsigned long nbCandidate) {
+
+  // Update the sweep and prune and run the collision
+  Pairs pairs = {0};
+  SAP2DTimeUpdate(
+    sap,
+    frames,
+    nbFrame);
+  unsigned long nbInter =
+    SAP2DTimeCollide(
+      sap,
+      frames,
+      MemorizePair,
+      &pairs);
+
+  // Check the number of reported pairs and candidates
+  if (
+    nbInter != (unsigned long)nbPair ||
+    sap->nbCandidate != nbCandidate) {
+
+    printf("UnitTestSAP2DTime Failed\n");
+    printf("Expected %d pairs and %lu candidates, got %lu and %lu\n",
+      nbPair, nbCandidate, nbInter, sap->nbCandidate);
+    exit(0);
+
+  }
+
+  // Check the reported pairs
+  for (
+    int iPair = nbPair;
+    iPair--;) {
+
+    if (
+      pairs.isIntersecting[expected[iPair][0]][expected[iPair][1]] ==
+      false) {
+
+      printf("UnitTestSAP2DTime Failed\n");
+      printf("Expected pair (%d, %d) not reported\n",
+        expected[iPair][0], expected[iPair][1]);
+      exit(0);
+
+    }
+
+  }
+
+  // Check the endpoints are sorted
+  for (
+    int iEndpoint = 1;
+    iEndpoint < 2 * nbFrame;
+    ++iEndpoint) {
+
+    if (sap->endpoints[iEndpoint - 1].val > sap->endpoints[iEndpoint].val) {
+
+      printf("UnitTestSAP2DTime Failed\n");
+      printf("Endpoints are not sorted\n");
+      exit(0);
+
+    }
+
+  }
+
+}
+
+void TestSAP2DTime(void) {
+
+  // Create the sweep and prune
+  SAP2DTime* sap = SAP2DTimeCreate();
+
+  // ----------------------------
+  // Cube 0 moving along the first axis through the static cube 1, cube
+  // 2 static away from the others, cube 3 moving along the second axis
+  // and crossing the path of cube 0 after it has passed
+  FMB_REAL orig[4][2] = {
+
+    {0.0, 0.0},
+    {2.5, 0.0},
+    {7.0, 3.0},
+    {-0.5, -3.0}
+
+  };
+  FMB_REAL speed[4][2] = {
+
+    {3.0, 0.0},
+    {0.0, 0.0},
+    {0.0, 0.0},
+    {0.0, 3.0}
+
+  };
+  FMB_REAL comp[2][2] = {
+
+    {1.0, 0.0},
+    {0.0, 1.0}
+
+  };
+  Frame2DTime frames[NB_FRAMES_MAX];
+  for (
+    int iFrame = 4;
+    iFrame--;) {
+
+    frames[iFrame] =
+      Frame2DTimeCreateStatic(
+        FrameCuboid,
+        orig[iFrame],
+        speed[iFrame],
+        comp);
+
+  }
+
+  // The bounding boxes of cubes 0 and 1 intersect only once the motion
+  // of cube 0 is taken into account
+  if (
+    AABBTestIntersection2DTime(
+      &(frames[0].bdgBox),
+      &(frames[1].bdgBox)) == false) {
+
+    printf("UnitTestSAP2DTime Failed\n");
+    printf("Expected the bounding boxes to intersect\n");
+    exit(0);
+
+  }
+
+  // Pair (0, 3) is a candidate but doesn't intersect
+  int expected[3][2] = {{0, 1}};
+  UnitTestSAP2DTime(
+    sap,
+    frames,
+    4,
+    1,
+    expected,
+    2);
+  if (sap->axis != 0) {
+
+    printf("UnitTestSAP2DTime Failed\n");
+    printf("Expected sweep axis 0, got %d\n", sap->axis);
+    exit(0);
+
+  }
+
+  printf("UnitTestSAP2DTime moving Succeed\n");
+
+  // ----------------------------
+  // Move cube 3 into the path of cubes 0 and 1
+  FMB_REAL origMoved[2] = {2.0, -3.0};
+  Frame2DTimeSetMotion(
+    frames + 3,
+    origMoved,
+    speed[3]);
+  int expectedMoved[3][2] = {{0, 1}, {0, 3}, {1, 3}};
+  UnitTestSAP2DTime(
+    sap,
+    frames,
+    4,
+    3,
+    expectedMoved,
+    3);
+  if (sap->nbSwap == 0) {
+
+    printf("UnitTestSAP2DTime Failed\n");
+    printf("Expected the endpoints to be resorted incrementally\n");
+    exit(0);
+
+  }
+
+  printf("UnitTestSAP2DTime incremental Succeed\n");
+
+  // Free memory
+  SAP2DTimeFree(&sap);
+
+  // If we reached here, it means all the unit tests succeed
+  printf("All unit tests SAP2DTime have succeed.\n");
+
+}
+
+// Unit test function
+// Update the SAP3DTime sap with the nbFrame Frames frames, run the
+// collision and check the reported pairs are the nbPair pairs
+// expected (expected[iPair][0] < expected[iPair][1]), and the number
+// of candidate pairs is nbCandidate
+void UnitTestSAP3DTime(
+  SAP3DTime* const sap,
+  const Frame3DTime* const frames,
+  const int nbFrame,
+  const int nbPair,
+  const int expected[][2],
+  const unsigned long nbCandidate) {
+
+  // Update the sweep and prune and run the collision
+  Pairs pairs = {0};
+  SAP3DTimeUpdate(
+    sap,
+    frames,
+    nbFrame);
+  unsigned long nbInter =
+    SAP3DTimeCollide(
+      sap,
+      frames,
+      MemorizePair,
+      &pairs);
+
+  // Check the number of reported pairs and candidates
+  if (
+    nbInter != (unsigned long)nbPair ||
+    sap->nbCandidate != nbCandidate) {
+
+    printf("UnitTestSAP3DTime Failed\n");
+    printf("Expected %d pairs and %lu candidates, got %lu and %lu\n",
+      nbPair, nbCandidate, nbInter, sap->nbCandidate);
+    exit(0);
+
+  }
+
+  // Check the reported pairs
+  for (
+    int iPair = nbPair;
+    iPair--;) {
+
+    if (
+      pairs.isIntersecting[expected[iPair][0]][expected[iPair][1]] ==
+      false) {
+
+      printf("UnitTestSAP3DTime Failed\n");
+      printf("Expected pair (%d, %d) not reported\n",
+        expected[iPair][0], expected[iPair][1]);
+      exit(0);
+
+    }
+
+  }
+
+  // Check the endpoints are sorted
+  for (
+    int iEndpoint = 1;
+    iEndpoint < 2 * nbFrame;
+    ++iEndpoint) {
+
+    if (sap->endpoints[iEndpoint - 1].val > sap->endpoints[iEndpoint].val) {
+
+      printf("UnitTestSAP3DTime Failed\n");
+      printf("Endpoints are not sorted\n");
+      exit(0);
+
+    }
+
+  }
+
+}
+
+void TestSAP3DTime(void) {
+
+  // Create the sweep and prune
+  SAP3DTime* sap = SAP3DTimeCreate();
+
+  // ----------------------------
+  // Cube 0 moving along the first axis through the static cube 1, cube
+  // 2 static away from the others, cube 3 moving along the second axis
+  // and crossing the path of cube 0 after it has passed
+  FMB_REAL orig[4][3] = {
+
+    {0.0, 0.0, 0.0},
+    {2.5, 0.0, 0.0},
+    {7.0, 0.0, 3.0},
+    {-0.5, -3.0, 0.0}
+
+  };
+  FMB_REAL speed[4][3] = {
+
+    {3.0, 0.0, 0.0},
+    {0.0, 0.0, 0.0},
+    {0.0, 0.0, 0.0},
+    {0.0, 3.0, 0.0}
+
+  };
+  FMB_REAL comp[3][3] = {
+
+    {1.0, 0.0, 0.0},
+    {0.0, 1.0, 0.0},
+    {0.0, 0.0, 1.0}
+
+  };
+  Frame3DTime frames[NB_FRAMES_MAX];
+  for (
+    int iFrame = 4;
+    iFrame--;) {
+
+    frames[iFrame] =
+      Frame3DTimeCreateStatic(
+        FrameCuboid,
+        orig[iFrame],
+        speed[iFrame],
+        comp);
+
+  }
+
+  // The bounding boxes of cubes 0 and 1 intersect only once the motion
+  // of cube 0 is taken into account
+  if (
+    AABBTestIntersection3DTime(
+      &(frames[0].bdgBox),
+      &(frames[1].bdgBox)) == false) {
+
+    printf("UnitTestSAP3DTime Failed\n");
+    printf("Expected the bounding boxes to intersect\n");
+    exit(0);
+
+  }
+
+  // Pair (0, 3) is a candidate but doesn't intersect
+  int expected[3][2] = {{0, 1}};
+  UnitTestSAP3DTime(
+    sap,
+    frames,
+    4,
+    1,
+    expected,
+    2);
+  if (sap->axis != 0) {
+
+    printf("UnitTestSAP3DTime Failed\n");
+    printf("Expected sweep axis 0, got %d\n", sap->axis);
+    exit(0);
+
+  }
+
+  printf("UnitTestSAP3DTime moving Succeed\n");
+
+  // ----------------------------
+  // Move cube 3 into the path of cubes 0 and 1
+  FMB_REAL origMoved[3] = {2.0, -3.0, 0.0};
+  Frame3DTimeSetMotion(
+    frames + 3,
+    origMoved,
+    speed[3]);
+  int expectedMoved[3][2] = {{0, 1}, {0, 3}, {1, 3}};
+  UnitTestSAP3DTime(
+    sap,
+    frames,
+    4,
+    3,
+    expectedMoved,
+    3);
+  if (sap->nbSwap == 0) {
+
+    printf("UnitTestSAP3DTime Failed\n");
+    printf("Expected the endpoints to be resorted incrementally\n");
+    exit(0);
+
+  }
+
+  printf("UnitTestSAP3DTime incremental Succeed\n");
+
+  // Free memory
+  SAP3DTimeFree(&sap);
+
+  // If we reached here, it means all the unit tests succeed
+  printf("All unit tests SAP3DTime have succeed.\n");
+
+}
+
+// Function called on each pair of intersecting Frames by
+// BVH3DCollide, memorize the pair in the matrix of flags data
+void MemorizePairBVH(
+  const int iFrame,
+  const int jFrame,
+  void* const data) {
+
+  bool* isIntersecting = data;
+  if (isIntersecting[iFrame * NB_FRAMES_BVH + jFrame] == true) {
+
+    printf("UnitTestBVH3D pair (%d, %d) reported twice Failed\n",
+      iFrame, jFrame);
+    exit(0);
+
+  }
+
+  isIntersecting[iFrame * NB_FRAMES_BVH + jFrame] = true;
+
+}
+
+// Return true if the AABB tho is included in the AABB that
+bool IsIncluded(
+  const AABB3D* const that,
+  const AABB3D* const tho) {
+
+  for (
+    int iAxis = 3;
+    iAxis--;) {
+
+    if (
+      tho->min[iAxis] < that->min[iAxis] ||
+      tho->max[iAxis] > that->max[iAxis]) {
+
+      return false;
+
+    }
+
+  }
+
+  return true;
+
+}
+
+// Unit test function
+// Check the structure of the BVH3D bvh over the Frames frames: each
+// Frame is in exactly one leaf, the leaves are not too large, and the
+// bounding box of each node includes the ones of its children
+void UnitTestBVH3DStructure(
+  const BVH3D* const bvh,
+  const Frame3D* const frames) {
+
+  int nbRef[NB_FRAMES_BVH] = {0};
+  for (
+    int iNode = bvh->nbNode;
+    iNode--;) {
+
+    const BVH3DNode* node = bvh->nodes + iNode;
+    if (node->nbFrame > 0) {
+
+      if (node->nbFrame > BVH3D_LEAF_SIZE) {
+
+        printf("UnitTestBVH3DStructure Failed\n");
+        printf("Leaf #%d has %d Frames\n", iNode, node->nbFrame);
+        exit(0);
+
+      }
+
+      for (
+        int iFrame = node->nbFrame;
+        iFrame--;) {
+
+        int jFrame = bvh->iFrames[node->iChild + iFrame];
+        ++(nbRef[jFrame]);
+        if (IsIncluded(&(node->bdgBox), &(frames[jFrame].bdgBox)) == false) {
+
+          printf("UnitTestBVH3DStructure Failed\n");
+          printf("Frame #%d not in its leaf's box\n", jFrame);
+          exit(0);
+
+        }
+
+      }
+
+    } else if (
+      node->iChild <= iNode + 1 ||
+      node->iChild >= bvh->nbNode ||
+      IsIncluded(&(node->bdgBox), &(bvh->nodes[iNode + 1].bdgBox)) ==
+      false ||
+      IsIncluded(&(node->bdgBox), &(bvh->nodes[node->iChild].bdgBox)) ==
+      false) {
+
+      printf("UnitTestBVH3DStructure Failed\n");
+      printf("Node #%d has invalid children\n", iNode);
+      exit(0);
+
+    }
+
+  }
+
+  for (
+    int iFrame = NB_FRAMES_BVH;
+    iFrame--;) {
+
+    if (nbRef[iFrame] != 1) {
+
+      printf("UnitTestBVH3DStructure Failed\n");
+      printf("Frame #%d is in %d leaves\n", iFrame, nbRef[iFrame]);
+      exit(0);
+
+    }
+
+  }
+
+}
+
+// Unit test function
+// Collide the BVH3D that and tho over the Frames thatFrames and
+// thoFrames and check the result against the brute force test
+void UnitTestBVH3DCollide(
+  BVH3D* const that,
+  const Frame3D* const thatFrames,
+  const BVH3D* const tho,
+  const Frame3D* const thoFrames) {
+
+  bool isIntersecting[NB_FRAMES_BVH * NB_FRAMES_BVH] = {false};
+  unsigned long nbInter =
+    BVH3DCollide(
+      that,
+      thatFrames,
+      tho,
+      thoFrames,
+      FMBTestIntersection3D,
+      MemorizePairBVH,
+      isIntersecting);
+  unsigned long nbInterBrute = 0;
+  for (
+    int iThat = NB_FRAMES_BVH;
+    iThat--;) {
+
+    for (
+      int iTho = NB_FRAMES_BVH;
+      iTho--;) {
+
+      bool isIntersectingBrute =
+        FMBTestIntersection3D(
+          thatFrames + iThat,
+          thoFrames + iTho,
+          NULL);
+      if (isIntersectingBrute == true) {
+
+        ++nbInterBrute;
+
+      }
+
+      if (
+        isIntersectingBrute !=
+        isIntersecting[iThat * NB_FRAMES_BVH + iTho]) {
+
+        printf("UnitTestBVH3DCollide Failed\n");
+        printf("Pair (%d, %d): brute force %d, BVH %d\n",
+          iThat, iTho, isIntersectingBrute,
+          isIntersecting[iThat * NB_FRAMES_BVH + iTho]);
+        exit(0);
+
+      }
+
+    }
+
+  }
+
+  if (nbInter != nbInterBrute || nbInter == 0) {
+
+    printf("UnitTestBVH3DCollide Failed\n");
+    printf("Nb of intersections: brute force %lu, BVH %lu\n",
+      nbInterBrute, nbInter);
+    exit(0);
+
+  }
+
+  // The traversal must have pruned some pairs
+  if (that->nbCandidate >= NB_FRAMES_BVH * NB_FRAMES_BVH) {
+
+    printf("UnitTestBVH3DCollide Failed\n");
+    printf("No pair pruned by the BVH\n");
+    exit(0);
+
+  }
+
+}
+
+void TestBVH3D(void) {
+
+  // Create two sets of Frames along two crossing helixes
+  Frame3D thatFrames[NB_FRAMES_BVH];
+  Frame3D thoFrames[NB_FRAMES_BVH];
+  FMB_REAL comp[3][3] = {
+
+    {1.0, 0.0, 0.0},
+    {0.0, 1.0, 0.0},
+    {0.0, 0.0, 1.0}
+
+  };
+  for (
+    int iFrame = NB_FRAMES_BVH;
+    iFrame--;) {
+
+    double theta = 0.3 * (double)iFrame;
+    FMB_REAL orig[3] = {
+
+      5.0 * cos(theta),
+      5.0 * sin(theta),
+      0.5 * (double)iFrame
+
+    };
+    thatFrames[iFrame] =
+      Frame3DCreateStatic(
+        (iFrame % 2 == 0 ? FrameCuboid : FrameTetrahedron),
+        orig,
+        comp);
+    orig[0] = 5.0 * sin(theta);
+    orig[1] = 5.0 * cos(theta);
+    thoFrames[iFrame] =
+      Frame3DCreateStatic(
+        (iFrame % 3 == 0 ? FrameCuboid : FrameTetrahedron),
+        orig,
+        comp);
+
+  }
+
+  // Create the BVH3D and check their structure
+  BVH3D* that =
+    BVH3DCreate(
+      thatFrames,
+      NB_FRAMES_BVH);
+  BVH3D* tho =
+    BVH3DCreate(
+      thoFrames,
+      NB_FRAMES_BVH);
+  UnitTestBVH3DStructure(
+    that,
+    thatFrames);
+  UnitTestBVH3DStructure(
+    tho,
+    thoFrames);
+  printf("UnitTestBVH3DStructure Succeed\n");
+
+  // Collide the two sets
+  UnitTestBVH3DCollide(
+    that,
+    thatFrames,
+    tho,
+    thoFrames);
+  printf("UnitTestBVH3DCollide Succeed\n");
+
+  // Move the second set, refit its BVH3D and collide again
+  FMB_REAL axis[3] = {0.0, 0.0, 1.0};
+  FMB_REAL v[3] = {0.3, -0.2, 1.0};
+  for (
+    int iFrame = NB_FRAMES_BVH;
+    iFrame--;) {
+
+    Frame3DTranslate(
+      thoFrames + iFrame,
+      v);
+    Frame3DRotate(
+      thoFrames + iFrame,
+      axis,
+      0.1 * (double)iFrame);
+
+  }
+
+  BVH3DRefit(
+    tho,
+    thoFrames);
+  UnitTestBVH3DStructure(
+    tho,
+    thoFrames);
+  UnitTestBVH3DCollide(
+    that,
+    thatFrames,
+    tho,
+    thoFrames);
+  printf("UnitTestBVH3DRefit Succeed\n");
+
+  // Free memory
+  BVH3DFree(&that);
+  BVH3DFree(&tho);
+
+  // If we reached here, it means all the unit tests succeed
+  printf("All unit tests BVH3D have succeed.\n");
+
+}
+
+// Job function of the unit tests of the FMBPool, count the visits of
+// each index in the array data
+void CountVisit(
+  const int iStart,
+  const int iEnd,
+  const int iThread,
+  void* const data) {
+
+  (void)iThread;
+  int* nbVisit = data;
+  for (
+    int i = iStart;
+    i < iEnd;
+    ++i) {
+
+    ++(nbVisit[i]);
+
+  }
+
+}
+
+// Unit test function
+// Run a job on NB_INDEX_POOL indices with the FMBPool pool in chunks
+// of chunkSize indices and check each index is visited once
+void UnitTestFMBPoolRun(
+  FMBPool* const pool,
+  const int chunkSize) {
+
+  int nbVisit[NB_INDEX_POOL] = {0};
+  FMBPoolRun(
+    pool,
+    NB_INDEX_POOL,
+    chunkSize,
+    CountVisit,
+    nbVisit);
+  for (
+    int i = NB_INDEX_POOL;
+    i--;) {
+
+    if (nbVisit[i] != 1) {
+
+      printf("UnitTestFMBPoolRun Failed\n");
+      printf("%d threads, chunks of %d: index %d visited %d times\n",
+        pool->nbThread, chunkSize, i, nbVisit[i]);
+      exit(0);
+
+    }
+
+  }
+
+}
+
+// Unit test function
+// Run the tests of all the pairs of Frames of thatFrames and thoFrames
+// with the FMBPool pool, as a list of pairs and as one-vs-many jobs,
+// and check the results against FMBTestIntersection3D
+void UnitTestFMBPoolTest3D(
+  FMBPool* const pool,
+  const Frame3D* const thatFrames,
+  const Frame3D* const thoFrames) {
+
+  // Create the list of all the pairs
+  FMBPair pairs[NB_FRAMES_BVH * NB_FRAMES_BVH];
+  for (
+    int iPair = NB_FRAMES_BVH * NB_FRAMES_BVH;
+    iPair--;) {
+
+    pairs[iPair].iThat = iPair / NB_FRAMES_BVH;
+    pairs[iPair].iTho = iPair % NB_FRAMES_BVH;
+
+  }
+
+  // Test the pairs, with the pruning of FMB to check its statistics
+  // recorded by the threads against the ones of the serial test
+  FMBSetPruning3D(true);
+  FMBResetPruneStats3D();
+  FMBResetElimStats3D();
+  int iIntersecting[NB_FRAMES_BVH * NB_FRAMES_BVH];
+  int nbInter =
+    FMBPoolTestPairs3D(
+      pool,
+      thatFrames,
+      thoFrames,
+      pairs,
+      NB_FRAMES_BVH * NB_FRAMES_BVH,
+      FMBTestIntersection3D,
+      iIntersecting);
+  FMBPruneStats poolStats = FMBGetPruneStats3D();
+  FMBResetPruneStats3D();
+  FMBElimStats poolElimStats = FMBGetElimStats3D();
+  FMBResetElimStats3D();
+
+  // Check the result, the indices are sorted so the k-th intersecting
+  // pair of the serial test must be the k-th result
+  int iInter = 0;
+  for (
+    int iPair = 0;
+    iPair < NB_FRAMES_BVH * NB_FRAMES_BVH;
+    ++iPair) {
+
+    bool isIntersecting =
+      FMBTestIntersection3D(
+        thatFrames + pairs[iPair].iThat,
+        thoFrames + pairs[iPair].iTho,
+        NULL);
+    if (isIntersecting == true) {
+
+      if (iInter >= nbInter || iIntersecting[iInter] != iPair) {
+
+        printf("UnitTestFMBPoolTestPairs3D Failed\n");
+        printf("%d threads: pair %d missing\n", pool->nbThread, iPair);
+        exit(0);
+
+      }
+
+      ++iInter;
+
+    }
+
+  }
+
+  if (iInter != nbInter || nbInter == 0) {
+
+    printf("UnitTestFMBPoolTestPairs3D Failed\n");
+    printf("%d threads: %d intersections instead of %d\n",
+      pool->nbThread, nbInter, iInter);
+    exit(0);
+
+  }
+
+  FMBPruneStats serialStats = FMBGetPruneStats3D();
+  FMBSetPruning3D(false);
+  if (
+    poolStats.nbRows != serialStats.nbRows ||
+    poolStats.nbDuplicate != serialStats.nbDuplicate ||
+    poolStats.nbDominated != serialStats.nbDominated ||
+    poolStats.nbTrivial != serialStats.nbTrivial ||
+    serialStats.nbRows == 0) {
+
+    printf("UnitTestFMBPoolTestPairs3D Failed\n");
+    printf("%d threads: pruning statistics %lu %lu %lu %lu instead of "
+      "%lu %lu %lu %lu\n", pool->nbThread,
+      poolStats.nbRows, poolStats.nbDuplicate, poolStats.nbDominated,
+      poolStats.nbTrivial, serialStats.nbRows, serialStats.nbDuplicate,
+      serialStats.nbDominated, serialStats.nbTrivial);
+    exit(0);
+
+  }
+
+  // The statistics of the elimination are recorded only if
+  // FMB_ELIM_STATS is defined, else both are null
+  FMBElimStats serialElimStats = FMBGetElimStats3D();
+  if (
+    memcmp(
+      &poolElimStats,
+      &serialElimStats,
+      sizeof(FMBElimStats)) != 0) {
+
+    printf("UnitTestFMBPoolTestPairs3D Failed\n");
+    printf("%d threads: elimination statistics differ from the serial "
+      "ones\n", pool->nbThread);
+    exit(0);
+
+  }
+
+  // Test each Frame of the first set against the second set
+  for (
+    int iThat = NB_FRAMES_BVH;
+    iThat--;) {
+
+    nbInter =
+      FMBPoolTestOneVsMany3D(
+        pool,
+        thatFrames + iThat,
+        thoFrames,
+        NB_FRAMES_BVH,
+        FMBTestIntersection3D,
+        iIntersecting);
+    iInter = 0;
+    for (
+      int iTho = 0;
+      iTho < NB_FRAMES_BVH;
+      ++iTho) {
+
+      bool isIntersecting =
+        FMBTestIntersection3D(
+          thatFrames + iThat,
+          thoFrames + iTho,
+          NULL);
+      if (isIntersecting == true) {
+
+        if (iInter >= nbInter || iIntersecting[iInter] != iTho) {
+
+          printf("UnitTestFMBPoolTestOneVsMany3D Failed\n");
+          printf("%d threads: pair (%d, %d) missing\n",
+            pool->nbThread, iThat, iTho);
+          exit(0);
+
+        }
+
+        ++iInter;
+
+      }
+
+    }
+
+    if (iInter != nbInter) {
+
+      printf("UnitTestFMBPoolTestOneVsMany3D Failed\n");
+      printf("%d threads: %d intersections instead of %d\n",
+        pool->nbThread, nbInter, iInter);
+      exit(0);
+
+    }
+
+  }
+
+}
+
+// Run empty jobs with the FMBPool pool after the non empty jobs of
+// UnitTestFMBPoolTest3D, and check they give no result and leave the
+// result buffer untouched
+void UnitTestFMBPoolEmpty3D(
+  FMBPool* const pool,
+  const Frame3D* const thatFrames,
+  const Frame3D* const thoFrames) {
+
+  // Run a non empty job first, leaving results in the workers
+  FMBPair pairs[NB_FRAMES_BVH * NB_FRAMES_BVH];
+  for (
+    int iPair = NB_FRAMES_BVH * NB_FRAMES_BVH;
+    iPair--;) {
+
+    pairs[iPair].iThat = iPair / NB_FRAMES_BVH;
+    pairs[iPair].iTho = iPair % NB_FRAMES_BVH;
+
+  }
+
+  int iIntersecting[NB_FRAMES_BVH * NB_FRAMES_BVH];
+  int nbInter =
+    FMBPoolTestPairs3D(
+      pool,
+      thatFrames,
+      thoFrames,
+      pairs,
+      NB_FRAMES_BVH * NB_FRAMES_BVH,
+      FMBTestIntersection3D,
+      iIntersecting);
+  if (nbInter == 0) {
+
+    printf("UnitTestFMBPoolEmpty3D Failed\n");
+    printf("%d threads: no intersection in the non empty job\n",
+      pool->nbThread);
+    exit(0);
+
+  }
+
+  // The buffer of the empty jobs has a single sentinel value
+  int iEmpty[1] = {-1};
+  nbInter =
+    FMBPoolTestPairs3D(
+      pool,
+      thatFrames,
+      thoFrames,
+      pairs,
+      0,
+      FMBTestIntersection3D,
+      iEmpty);
+  if (nbInter != 0 || iEmpty[0] != -1) {
+
+    printf("UnitTestFMBPoolEmpty3D Failed\n");
+    printf("%d threads: %d results from an empty list of pairs\n",
+      pool->nbThread, nbInter);
+    exit(0);
+
+  }
+
+  nbInter =
+    FMBPoolTestOneVsMany3D(
+      pool,
+      thatFrames,
+      thoFrames,
+      0,
+      FMBTestIntersection3D,
+      iEmpty);
+  if (nbInter != 0 || iEmpty[0] != -1) {
+
+    printf("UnitTestFMBPoolEmpty3D Failed\n");
+    printf("%d threads: %d results from an empty one-vs-many job\n",
+      pool->nbThread, nbInter);
+    exit(0);
+
+  }
+
+}
+
+void TestFMBPool(void) {
+
+  // Create two sets of Frames along two crossing helixes (cf
+  // TestBVH3D)
+  Frame3D thatFrames[NB_FRAMES_BVH];
+  Frame3D thoFrames[NB_FRAMES_BVH];
+  FMB_REAL comp[3][3] = {
+
+    {1.0, 0.0, 0.0},
+    {0.0, 1.0, 0.0},
+    {0.0, 0.0, 1.0}
+
+  };
+  for (
+    int iFrame = NB_FRAMES_BVH;
+    iFrame--;) {
+
+    double theta = 0.3 * (double)iFrame;
+    FMB_REAL orig[3] = {
+
+      5.0 * cos(theta),
+      5.0 * sin(theta),
+      0.5 * (double)iFrame
+
+    };
+    thatFrames[iFrame] =
+      Frame3DCreateStatic(
+        (iFrame % 2 == 0 ? FrameCuboid : FrameTetrahedron),
+        orig,
+        comp);
+    orig[0] = 5.0 * sin(theta);
+    orig[1] = 5.0 * cos(theta);
+    thoFrames[iFrame] =
+      Frame3DCreateStatic(
+        (iFrame % 3 == 0 ? FrameCuboid : FrameTetrahedron),
+        orig,
+        comp);
+
+  }
+
+  // Loop on several numbers of threads, more than the number of cores
+  // to force the steals
+  int nbThreads[4] = {1, 2, 3, 8};
+  for (
+    int iNbThread = 4;
+    iNbThread--;) {
+
+    FMBPool* pool = FMBPoolCreate(nbThreads[iNbThread]);
+
+    // Run jobs with various chunk sizes, several times to check the
+    // reuse of the threads
+    int chunkSizes[4] = {1, 7, 64, NB_INDEX_POOL + 1};
+    for (
+      int iChunkSize = 4;
+      iChunkSize--;) {
+
+      UnitTestFMBPoolRun(
+        pool,
+        chunkSizes[iChunkSize]);
+      UnitTestFMBPoolRun(
+        pool,
+        chunkSizes[iChunkSize]);
+
+    }
+
+    // Run the intersection tests
+    UnitTestFMBPoolTest3D(
+      pool,
+      thatFrames,
+      thoFrames);
+
+    // Run empty jobs after non empty ones
+    UnitTestFMBPoolEmpty3D(
+      pool,
+      thatFrames,
+      thoFrames);
+
+    FMBPoolFree(&pool);
+
+  }
+
+  printf("UnitTestFMBPoolRun Succeed\n");
+  printf("UnitTestFMBPoolTestPairs3D Succeed\n");
+  printf("UnitTestFMBPoolTestOneVsMany3D Succeed\n");
+  printf("UnitTestFMBPoolEmpty3D Succeed\n");
+
+  // If we reached here, it means all the unit tests succeed
+  printf("All unit tests FMBPool have succeed.\n");
+
+}
+
+// Main function
+int main(int argc, char** argv) {
+
+  TestSAP3D();
+  TestSAP2DTime();
+  TestSAP3DTime();
+  TestBVH3D();
+  TestFMBPool();
+
+  return 0;
+
+}
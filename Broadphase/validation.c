@@ -0,0 +1,997 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Include standard libraries
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+// Include the broadphase library
+#include "broadphase.h"
+#include "bvh.h"
+#include "pool.h"
+
+// Epsilon to detect degenerated Frames
+#define EPSILON 0.1
+
+// Nb of Frames in the scenes of the validation
+#define NB_FRAMES 2000
+
+// Size of the cube containing the origins of the Frames
+#define RANGE_SCENE 40.0
+
+// Range of values for the components of the Frames
+#define RANGE_COMP 2.0
+
+// Max displacement of a Frame per step
+#define RANGE_MOVE 0.5
+
+// Range of values for the speed of the moving Frames
+#define RANGE_SPEED 2.0
+
+// Nb of scenes and of steps per scene of the validation
+#define NB_SCENES 5
+#define NB_STEPS 10
+
+// Nb of Frames per set in the validation of the BVH3D
+#define NB_FRAMES_BVH 1000
+
+// Nb of threads in the validation of the FMBPool
+#define NB_THREADS_POOL 4
+
+// Helper macro to generate random number in [0.0, 1.0]
+#define rnd() (double)(rand())/(double)(RAND_MAX)
+
+// Structure to memorize the pairs reported by SAP3DCollide
+typedef struct {
+
+  // Matrix of flags, [iFrame * NB_FRAMES + jFrame] with iFrame < jFrame
+  bool* isIntersecting;
+
+  // Flag memorizing if a pair was reported twice or unordered
+  bool isCorrupted;
+
+} Pairs;
+
+// Function called on each pair of intersecting Frames, memorize the
+// pair in the Pairs data
+void MemorizePair(
+  const int iFrame,
+  const int jFrame,
+  void* const data) {
+
+  Pairs* pairs = data;
+  bool* flag = pairs->isIntersecting + iFrame * NB_FRAMES + jFrame;
+  if (*flag == true || iFrame >= jFrame) {
+
+    pairs->isCorrupted = true;
+
+  }
+
+  *flag = true;
+
+}
+
+// Return a random Frame3D of size about RANGE_COMP located in the
+// cube [0, RANGE_SCENE]^3
+Frame3D RandomFrame3D(void) {
+
+  // Loop until we get a non degenerated Frame
+  while (true) {
+
+    // 50% chance of being a Cuboid or a Tetrahedron
+    FrameType type = (rnd() < 0.5 ? FrameCuboid : FrameTetrahedron);
+
+    // Random origin and components
+    FMB_REAL orig[3];
+    FMB_REAL comp[3][3];
+    for (
+      int iAxis = 3;
+      iAxis--;) {
+
+      orig[iAxis] = rnd() * RANGE_SCENE;
+
+      for (
+        int iComp = 3;
+        iComp--;) {
+
+        comp[iComp][iAxis] = -RANGE_COMP + 2.0 * rnd() * RANGE_COMP;
+
+      }
+
+    }
+
+    // If the determinant is not null, ie the Frame is not degenerate
+    double det =
+      comp[0][0] * (comp[1][1] * comp[2][2] -
+      comp[1][2] * comp[2][1]) -
+      comp[1][0] * (comp[0][1] * comp[2][2] -
+      comp[0][2] * comp[2][1]) +
+      comp[2][0] * (comp[0][1] * comp[1][2] -
+      comp[0][2] * comp[1][1]);
+    if (fabs(det) > EPSILON) {
+
+      return
+        Frame3DCreateStatic(
+          type,
+          orig,
+          comp);
+
+    }
+
+  }
+
+}
+
+// Return a random Frame2DTime of size about RANGE_COMP located in the
+// square [0, RANGE_SCENE]^2 and moving at a speed up to RANGE_SPEED
+// along each axis
+Frame2DTime RandomFrame2DTime(void) {
+
+  // Loop until we get a non degenerated Frame
+  while (true) {
+
+    // 50% chance of being a Cuboid or a Tetrahedron
+    FrameType type = (rnd() < 0.5 ? FrameCuboid : FrameTetrahedron);
+
+    // Random origin, speed and components
+    FMB_REAL orig[2];
+    FMB_REAL speed[2];
+    FMB_REAL comp[2][2];
+    for (
+      int iAxis = 2;
+      iAxis--;) {
+
+      orig[iAxis] = rnd() * RANGE_SCENE;
+      speed[iAxis] = -RANGE_SPEED + 2.0 * rnd() * RANGE_SPEED;
+
+      for (
+        int iComp = 2;
+        iComp--;) {
+
+        comp[iComp][iAxis] = -RANGE_COMP + 2.0 * rnd() * RANGE_COMP;
+
+      }
+
+    }
+
+    // If the determinant is not null, ie the Frame is not degenerate
+    double det = comp[0][0] * comp[1][1] - comp[1][0] * comp[0][1];
+    if (fabs(det) > EPSILON) {
+
+      return
+        Frame2DTimeCreateStatic(
+          type,
+          orig,
+          speed,
+          comp);
+
+    }
+
+  }
+
+}
+
+// Return a random Frame3DTime of size about RANGE_COMP located in the
+// cube [0, RANGE_SCENE]^3 and moving at a speed up to RANGE_SPEED
+// along each axis
+Frame3DTime RandomFrame3DTime(void) {
+
+  // Loop until we get a non degenerated Frame
+  while (true) {
+
+    // 50% chance of being a Cuboid or a Tetrahedron
+    FrameType type = (rnd() < 0.5 ? FrameCuboid : FrameTetrahedron);
+
+    // Random origin, speed and components
+    FMB_REAL orig[3];
+    FMB_REAL speed[3];
+    FMB_REAL comp[3][3];
+    for (
+      int iAxis = 3;
+      iAxis--;) {
+
+      orig[iAxis] = rnd() * RANGE_SCENE;
+      speed[iAxis] = -RANGE_SPEED + 2.0 * rnd() * RANGE_SPEED;
+
+      for (
+        int iComp = 3;
+        iComp--;) {
+
+        comp[iComp][iAxis] = -RANGE_COMP + 2.0 * rnd() * RANGE_COMP;
+
+      }
+
+    }
+
+    // If the determinant is not null, ie the Frame is not degenerate
+    double det =
+      comp[0][0] * (comp[1][1] * comp[2][2] -
+      comp[1][2] * comp[2][1]) -
+      comp[1][0] * (comp[0][1] * comp[2][2] -
+      comp[0][2] * comp[2][1]) +
+      comp[2][0] * (comp[0][1] * comp[1][2] -
+      comp[0][2] * comp[1][1]);
+    if (fabs(det) > EPSILON) {
+
+      return
+        Frame3DTimeCreateStatic(
+          type,
+          orig,
+          speed,
+          comp);
+
+    }
+
+  }
+
+}
+
+// Validation of the sweep and prune against the brute force test of
+// all the pairs, on NB_SCENES random scenes of NB_FRAMES Frames each
+// moving randomly during NB_STEPS steps
+void ValidationBroadphase(void) {
+
+  // Allocate memory
+  Frame3D* frames = malloc(sizeof(Frame3D) * NB_FRAMES);
+  Pairs pairs = {
+
+    .isIntersecting = malloc(sizeof(bool) * NB_FRAMES * NB_FRAMES),
+    .isCorrupted = false
+
+  };
+  SAP3D* sap = SAP3DCreate();
+
+  // Declare variables to count the intersections and the swaps
+  unsigned long nbInter = 0;
+  unsigned long nbSwap = 0;
+
+  // Loop on the scenes
+  for (
+    int iScene = NB_SCENES;
+    iScene--;) {
+
+    // Create the random scene
+    for (
+      int iFrame = NB_FRAMES;
+      iFrame--;) {
+
+      frames[iFrame] = RandomFrame3D();
+
+    }
+
+    // Loop on the steps
+    for (
+      int iStep = NB_STEPS;
+      iStep--;) {
+
+      // Run the sweep and prune
+      memset(
+        pairs.isIntersecting,
+        0,
+        sizeof(bool) * NB_FRAMES * NB_FRAMES);
+      SAP3DUpdate(
+        sap,
+        frames,
+        NB_FRAMES);
+      unsigned long nbInterSAP =
+        SAP3DCollide(
+          sap,
+          frames,
+          MemorizePair,
+          &pairs);
+      nbSwap += sap->nbSwap;
+
+      // Check the reported pairs are all distinct and ordered
+      if (pairs.isCorrupted == true) {
+
+        printf("ValidationBroadphase has failed\n");
+        printf("A pair has been reported twice or unordered\n");
+        exit(0);
+
+      }
+
+      // Loop on the pairs of Frames and compare the brute force test
+      // with the result of the sweep and prune
+      unsigned long nbInterBrute = 0;
+      for (
+        int iFrame = 0;
+        iFrame < NB_FRAMES;
+        ++iFrame) {
+
+        for (
+          int jFrame = iFrame + 1;
+          jFrame < NB_FRAMES;
+          ++jFrame) {
+
+          bool isIntersecting =
+            FMBTestIntersection3D(
+              frames + iFrame,
+              frames + jFrame,
+              NULL);
+          if (isIntersecting == true) {
+
+            ++nbInterBrute;
+
+          }
+
+          if (
+            isIntersecting !=
+            pairs.isIntersecting[iFrame * NB_FRAMES + jFrame]) {
+
+            printf("ValidationBroadphase has failed\n");
+            printf("Pair (%d, %d): brute force %d, sweep and prune %d\n",
+              iFrame, jFrame, isIntersecting,
+              pairs.isIntersecting[iFrame * NB_FRAMES + jFrame]);
+            exit(0);
+
+          }
+
+        }
+
+      }
+
+      if (nbInterBrute != nbInterSAP) {
+
+        printf("ValidationBroadphase has failed\n");
+        printf("Nb of intersections: brute force %lu, sweep and prune %lu\n",
+          nbInterBrute, nbInterSAP);
+        exit(0);
+
+      }
+
+      nbInter += nbInterSAP;
+
+      // Move the Frames randomly
+      for (
+        int iFrame = NB_FRAMES;
+        iFrame--;) {
+
+        FMB_REAL v[3];
+        for (
+          int iAxis = 3;
+          iAxis--;) {
+
+          v[iAxis] = -RANGE_MOVE + 2.0 * rnd() * RANGE_MOVE;
+
+        }
+
+        Frame3DTranslate(
+          frames + iFrame,
+          v);
+
+      }
+
+    }
+
+  }
+
+  // Free memory
+  SAP3DFree(&sap);
+  free(pairs.isIntersecting);
+  free(frames);
+
+  printf("Tested %d steps of %d Frames, ", NB_SCENES * NB_STEPS, NB_FRAMES);
+  printf("%lu intersections, %lu swaps\n", nbInter, nbSwap);
+  printf("ValidationBroadphase has succeed\n");
+
+}
+
+// Validation of the sweep and prune against the brute force test of
+// all the pairs, on NB_SCENES random scenes of NB_FRAMES moving
+// Frames each continuing their motion with a new random speed during
+// NB_STEPS steps
+void ValidationBroadphase2DTime(void) {
+
+  // Allocate memory
+  Frame2DTime* frames = malloc(sizeof(Frame2DTime) * NB_FRAMES);
+  Pairs pairs = {
+
+    .isIntersecting = malloc(sizeof(bool) * NB_FRAMES * NB_FRAMES),
+    .isCorrupted = false
+
+  };
+  SAP2DTime* sap = SAP2DTimeCreate();
+
+  // Declare variables to count the intersections and the swaps
+  unsigned long nbInter = 0;
+  unsigned long nbSwap = 0;
+
+  // Loop on the scenes
+  for (
+    int iScene = NB_SCENES;
+    iScene--;) {
+
+    // Create the random scene
+    for (
+      int iFrame = NB_FRAMES;
+      iFrame--;) {
+
+      frames[iFrame] = RandomFrame2DTime();
+
+    }
+
+    // Loop on the steps
+    for (
+      int iStep = NB_STEPS;
+      iStep--;) {
+
+      // Run the sweep and prune
+      memset(
+        pairs.isIntersecting,
+        0,
+        sizeof(bool) * NB_FRAMES * NB_FRAMES);
+      SAP2DTimeUpdate(
+        sap,
+        frames,
+        NB_FRAMES);
+      unsigned long nbInterSAP =
+        SAP2DTimeCollide(
+          sap,
+          frames,
+          MemorizePair,
+          &pairs);
+      nbSwap += sap->nbSwap;
+
+      // Check the reported pairs are all distinct and ordered
+      if (pairs.isCorrupted == true) {
+
+        printf("ValidationBroadphase2DTime has failed\n");
+        printf("A pair has been reported twice or unordered\n");
+        exit(0);
+
+      }
+
+      // Loop on the pairs of Frames and compare the brute force test
+      // with the result of the sweep and prune
+      unsigned long nbInterBrute = 0;
+      for (
+        int iFrame = 0;
+        iFrame < NB_FRAMES;
+        ++iFrame) {
+
+        for (
+          int jFrame = iFrame + 1;
+          jFrame < NB_FRAMES;
+          ++jFrame) {
+
+          bool isIntersecting =
+            FMBTestIntersection2DTime(
+              frames + iFrame,
+              frames + jFrame,
+              NULL);
+          if (isIntersecting == true) {
+
+            ++nbInterBrute;
+
+          }
+
+          if (
+            isIntersecting !=
+            pairs.isIntersecting[iFrame * NB_FRAMES + jFrame]) {
+
+            printf("ValidationBroadphase2DTime has failed\n");
+            printf("Pair (%d, %d): brute force %d, sweep and prune %d\n",
+              iFrame, jFrame, isIntersecting,
+              pairs.isIntersecting[iFrame * NB_FRAMES + jFrame]);
+            exit(0);
+
+          }
+
+        }
+
+      }
+
+      if (nbInterBrute != nbInterSAP) {
+
+        printf("ValidationBroadphase2DTime has failed\n");
+        printf("Nb of intersections: brute force %lu, sweep and prune %lu\n",
+          nbInterBrute, nbInterSAP);
+        exit(0);
+
+      }
+
+      nbInter += nbInterSAP;
+
+      // Move the Frames to their position at the end of the step,
+      // with a new random speed
+      for (
+        int iFrame = NB_FRAMES;
+        iFrame--;) {
+
+        FMB_REAL orig[2];
+        FMB_REAL speed[2];
+        for (
+          int iAxis = 2;
+          iAxis--;) {
+
+          orig[iAxis] =
+            frames[iFrame].orig[iAxis] + frames[iFrame].speed[iAxis];
+          speed[iAxis] = -RANGE_SPEED + 2.0 * rnd() * RANGE_SPEED;
+
+        }
+
+        Frame2DTimeSetMotion(
+          frames + iFrame,
+          orig,
+          speed);
+
+      }
+
+    }
+
+  }
+
+  // Free memory
+  SAP2DTimeFree(&sap);
+  free(pairs.isIntersecting);
+  free(frames);
+
+  printf("Tested %d steps of %d Frames, ", NB_SCENES * NB_STEPS, NB_FRAMES);
+  printf("%lu intersections, %lu swaps\n", nbInter, nbSwap);
+  printf("ValidationBroadphase2DTime has succeed\n");
+
+}
+
+// Validation of the sweep and prune against the brute force test of
+// all the pairs, on NB_SCENES random scenes of NB_FRAMES moving
+// Frames each continuing their motion with a new random speed during
+// NB_STEPS steps
+void ValidationBroadphase3DTime(void) {
+
+  // Allocate memory
+  Frame3DTime* frames = malloc(sizeof(Frame3DTime) * NB_FRAMES);
+  Pairs pairs = {
+
+    .isIntersecting = malloc(sizeof(bool) * NB_FRAMES * NB_FRAMES),
+    .isCorrupted = false
+
+  };
+  SAP3DTime* sap = SAP3DTimeCreate();
+
+  // Declare variables to count the intersections and the swaps
+  unsigned long nbInter = 0;
+  unsigned long nbSwap = 0;
+
+  // Loop on the scenes
+  for (
+    int iScene = NB_SCENES;
+    iScene--;) {
+
+    // Create the random scene
+    for (
+      int iFrame = NB_FRAMES;
+      iFrame--;) {
+
+      frames[iFrame] = RandomFrame3DTime();
+
+    }
+
+    // Loop on the steps
+    for (
+      int iStep = NB_STEPS;
+      iStep--;) {
+
+      // Run the sweep and prune
+      memset(
+        pairs.isIntersecting,
+        0,
+        sizeof(bool) * NB_FRAMES * NB_FRAMES);
+      SAP3DTimeUpdate(
+        sap,
+        frames,
+        NB_FRAMES);
+      unsigned long nbInterSAP =
+        SAP3DTimeCollide(
+          sap,
+          frames,
+          MemorizePair,
+          &pairs);
+      nbSwap += sap->nbSwap;
+
+      // Check the reported pairs are all distinct and ordered
+      if (pairs.isCorrupted == true) {
+
+        printf("ValidationBroadphase3DTime has failed\n");
+        printf("A pair has been reported twice or unordered\n");
+        exit(0);
+
+      }
+
+      // Loop on the pairs of Frames and compare the brute force test
+      // with the result of the sweep and prune
+      unsigned long nbInterBrute = 0;
+      for (
+        int iFrame = 0;
+        iFrame < NB_FRAMES;
+        ++iFrame) {
+
+        for (
+          int jFrame = iFrame + 1;
+          jFrame < NB_FRAMES;
+          ++jFrame) {
+
+          bool isIntersecting =
+            FMBTestIntersection3DTime(
+              frames + iFrame,
+              frames + jFrame,
+              NULL);
+          if (isIntersecting == true) {
+
+            ++nbInterBrute;
+
+          }
+
+          if (
+            isIntersecting !=
+            pairs.isIntersecting[iFrame * NB_FRAMES + jFrame]) {
+
+            printf("ValidationBroadphase3DTime has failed\n");
+            printf("Pair (%d, %d): brute force %d, sweep and prune %d\n",
+              iFrame, jFrame, isIntersecting,
+              pairs.isIntersecting[iFrame * NB_FRAMES + jFrame]);
+            exit(0);
+
+          }
+
+        }
+
+      }
+
+      if (nbInterBrute != nbInterSAP) {
+
+        printf("ValidationBroadphase3DTime has failed\n");
+        printf("Nb of intersections: brute force %lu, sweep and prune %lu\n",
+          nbInterBrute, nbInterSAP);
+        exit(0);
+
+      }
+
+      nbInter += nbInterSAP;
+
+      // Move the Frames to their position at the end of the step,
+      // with a new random speed
+      for (
+        int iFrame = NB_FRAMES;
+        iFrame--;) {
+
+        FMB_REAL orig[3];
+        FMB_REAL speed[3];
+        for (
+          int iAxis = 3;
+          iAxis--;) {
+
+          orig[iAxis] =
+            frames[iFrame].orig[iAxis] + frames[iFrame].speed[iAxis];
+          speed[iAxis] = -RANGE_SPEED + 2.0 * rnd() * RANGE_SPEED;
+
+        }
+
+        Frame3DTimeSetMotion(
+          frames + iFrame,
+          orig,
+          speed);
+
+      }
+
+    }
+
+  }
+
+  // Free memory
+  SAP3DTimeFree(&sap);
+  free(pairs.isIntersecting);
+  free(frames);
+
+  printf("Tested %d steps of %d Frames, ", NB_SCENES * NB_STEPS, NB_FRAMES);
+  printf("%lu intersections, %lu swaps\n", nbInter, nbSwap);
+  printf("ValidationBroadphase3DTime has succeed\n");
+
+}
+
+// Function called on each pair of intersecting Frames by
+// BVH3DCollide, memorize the pair in the matrix of flags data
+void MemorizePairBVH(
+  const int iFrame,
+  const int jFrame,
+  void* const data) {
+
+  bool* isIntersecting = data;
+  isIntersecting[iFrame * NB_FRAMES_BVH + jFrame] = true;
+
+}
+
+// Validation of the BVH3D against the brute force test of all the
+// pairs, on NB_SCENES pairs of random sets of NB_FRAMES_BVH Frames,
+// the second set moving randomly during NB_STEPS steps (the BVH3D of
+// the second set is refitted at each step)
+void ValidationBVH(void) {
+
+  // Allocate memory
+  Frame3D* thatFrames = malloc(sizeof(Frame3D) * NB_FRAMES_BVH);
+  Frame3D* thoFrames = malloc(sizeof(Frame3D) * NB_FRAMES_BVH);
+  bool* isIntersecting =
+    malloc(sizeof(bool) * NB_FRAMES_BVH * NB_FRAMES_BVH);
+
+  // Declare a variable to count the intersections
+  unsigned long nbInter = 0;
+
+  // Loop on the scenes
+  for (
+    int iScene = NB_SCENES;
+    iScene--;) {
+
+    // Create the random sets and their BVH3D
+    for (
+      int iFrame = NB_FRAMES_BVH;
+      iFrame--;) {
+
+      thatFrames[iFrame] = RandomFrame3D();
+      thoFrames[iFrame] = RandomFrame3D();
+
+    }
+
+    BVH3D* that =
+      BVH3DCreate(
+        thatFrames,
+        NB_FRAMES_BVH);
+    BVH3D* tho =
+      BVH3DCreate(
+        thoFrames,
+        NB_FRAMES_BVH);
+
+    // Loop on the steps
+    for (
+      int iStep = NB_STEPS;
+      iStep--;) {
+
+      // Run the collision of the BVH3D
+      memset(
+        isIntersecting,
+        0,
+        sizeof(bool) * NB_FRAMES_BVH * NB_FRAMES_BVH);
+      unsigned long nbInterBVH =
+        BVH3DCollide(
+          that,
+          thatFrames,
+          tho,
+          thoFrames,
+          FMBTestIntersection3D,
+          MemorizePairBVH,
+          isIntersecting);
+
+      // Loop on the pairs of Frames and compare the brute force test
+      // with the result of the BVH3D
+      unsigned long nbInterBrute = 0;
+      for (
+        int iThat = NB_FRAMES_BVH;
+        iThat--;) {
+
+        for (
+          int iTho = NB_FRAMES_BVH;
+          iTho--;) {
+
+          bool isIntersectingBrute =
+            FMBTestIntersection3D(
+              thatFrames + iThat,
+              thoFrames + iTho,
+              NULL);
+          if (isIntersectingBrute == true) {
+
+            ++nbInterBrute;
+
+          }
+
+          if (
+            isIntersectingBrute !=
+            isIntersecting[iThat * NB_FRAMES_BVH + iTho]) {
+
+            printf("ValidationBVH has failed\n");
+            printf("Pair (%d, %d): brute force %d, BVH %d\n",
+              iThat, iTho, isIntersectingBrute,
+              isIntersecting[iThat * NB_FRAMES_BVH + iTho]);
+            exit(0);
+
+          }
+
+        }
+
+      }
+
+      if (nbInterBrute != nbInterBVH) {
+
+        printf("ValidationBVH has failed\n");
+        printf("Nb of intersections: brute force %lu, BVH %lu\n",
+          nbInterBrute, nbInterBVH);
+        exit(0);
+
+      }
+
+      nbInter += nbInterBVH;
+
+      // Move the second set randomly and refit its BVH3D
+      for (
+        int iFrame = NB_FRAMES_BVH;
+        iFrame--;) {
+
+        FMB_REAL v[3];
+        for (
+          int iAxis = 3;
+          iAxis--;) {
+
+          v[iAxis] = -RANGE_MOVE + 2.0 * rnd() * RANGE_MOVE;
+
+        }
+
+        Frame3DTranslate(
+          thoFrames + iFrame,
+          v);
+
+      }
+
+      BVH3DRefit(
+        tho,
+        thoFrames);
+
+    }
+
+    BVH3DFree(&that);
+    BVH3DFree(&tho);
+
+  }
+
+  // Free memory
+  free(isIntersecting);
+  free(thatFrames);
+  free(thoFrames);
+
+  printf("Tested %d steps of %d against %d Frames, ",
+    NB_SCENES * NB_STEPS, NB_FRAMES_BVH, NB_FRAMES_BVH);
+  printf("%lu intersections\n", nbInter);
+  printf("ValidationBVH has succeed\n");
+
+}
+
+// Validation of the FMBPool against the serial test of all the pairs,
+// on NB_SCENES pairs of random sets of NB_FRAMES_BVH Frames tested
+// with NB_THREADS_POOL threads
+void ValidationFMBPool(void) {
+
+  // Allocate memory
+  Frame3D* thatFrames = malloc(sizeof(Frame3D) * NB_FRAMES_BVH);
+  Frame3D* thoFrames = malloc(sizeof(Frame3D) * NB_FRAMES_BVH);
+  FMBPair* pairs = malloc(sizeof(FMBPair) * NB_FRAMES_BVH * NB_FRAMES_BVH);
+  int* iIntersecting = malloc(sizeof(int) * NB_FRAMES_BVH * NB_FRAMES_BVH);
+
+  // Create the pool and the list of all the pairs
+  FMBPool* pool = FMBPoolCreate(NB_THREADS_POOL);
+  for (
+    int iPair = NB_FRAMES_BVH * NB_FRAMES_BVH;
+    iPair--;) {
+
+    pairs[iPair].iThat = iPair / NB_FRAMES_BVH;
+    pairs[iPair].iTho = iPair % NB_FRAMES_BVH;
+
+  }
+
+  // Declare a variable to count the intersections
+  unsigned long nbInter = 0;
+
+  // Loop on the scenes
+  for (
+    int iScene = NB_SCENES;
+    iScene--;) {
+
+    // Create the random sets
+    for (
+      int iFrame = NB_FRAMES_BVH;
+      iFrame--;) {
+
+      thatFrames[iFrame] = RandomFrame3D();
+      thoFrames[iFrame] = RandomFrame3D();
+
+    }
+
+    // Test all the pairs with the pool
+    int nbInterPool =
+      FMBPoolTestPairs3D(
+        pool,
+        thatFrames,
+        thoFrames,
+        pairs,
+        NB_FRAMES_BVH * NB_FRAMES_BVH,
+        FMBTestIntersection3D,
+        iIntersecting);
+
+    // Compare with the serial test, the results of the pool are sorted
+    int iInter = 0;
+    for (
+      int iPair = 0;
+      iPair < NB_FRAMES_BVH * NB_FRAMES_BVH;
+      ++iPair) {
+
+      bool isIntersecting =
+        FMBTestIntersection3D(
+          thatFrames + pairs[iPair].iThat,
+          thoFrames + pairs[iPair].iTho,
+          NULL);
+      bool isIntersectingPool =
+        (iInter < nbInterPool && iIntersecting[iInter] == iPair);
+      if (isIntersecting != isIntersectingPool) {
+
+        printf("ValidationFMBPool has failed\n");
+        printf("Pair %d: serial %d, pool %d\n",
+          iPair, isIntersecting, isIntersectingPool);
+        exit(0);
+
+      }
+
+      if (isIntersectingPool == true) {
+
+        ++iInter;
+
+      }
+
+    }
+
+    if (iInter != nbInterPool) {
+
+      printf("ValidationFMBPool has failed\n");
+      printf("Nb of intersections: serial %d, pool %d\n",
+        iInter, nbInterPool);
+      exit(0);
+
+    }
+
+    nbInter += nbInterPool;
+
+  }
+
+  // Free memory
+  FMBPoolFree(&pool);
+  free(iIntersecting);
+  free(pairs);
+  free(thatFrames);
+  free(thoFrames);
+
+  printf("Tested %d sets of %d against %d Frames with %d threads, ",
+    NB_SCENES, NB_FRAMES_BVH, NB_FRAMES_BVH, NB_THREADS_POOL);
+  printf("%lu intersections\n", nbInter);
+  printf("ValidationFMBPool has succeed\n");
+
+}
+
+int main(int argc, char** argv) {
+
+  // Initialise the random generator
+  srand(time(NULL));
+
+  // Run the validation
+  ValidationBroadphase();
+  ValidationBroadphase2DTime();
+  ValidationBroadphase3DTime();
+  ValidationBVH();
+  ValidationFMBPool();
+
+  return 0;
+
+}
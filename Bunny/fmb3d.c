@@ -31,7 +31,7 @@
 #define SND_VAR 1
 #define THD_VAR 2
 
-#define EPSILON 0.0000001
+#define EPSILON FMB_EPSILON
 
 // ------------- Functions declaration -------------
 
@@ -42,12 +42,12 @@
 // Return false if the system becomes inconsistent during elimination,
 // else return true
 bool ElimVar3D(
-  const double (*M)[3],
-  const double* Y,
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
   const int nbRows,
   const int nbCols,
-  double (*Mp)[3],
-  double* Yp,
+  FMB_REAL (*Mp)[3],
+  FMB_REAL* Yp,
   int* const nbRemainRows);
 
 // Get the bounds of the iVar-th variable in the nbRows rows
@@ -59,8 +59,8 @@ bool ElimVar3D(
 // mean the system has no solution
 void GetBoundLastVar3D(
   const int iVar,
-  const double (*M)[3],
-  const double* Y,
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
   const int nbRows,
   AABB3D* const bdgBox);
 
@@ -70,8 +70,8 @@ void GetBoundLastVar3D(
 // (M arrangement is [iRow][iCol])
 void GetBoundVar3D(
   const int iVar,
-  const double (*M)[3],
-  const double* Y,
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
   const int nbRows,
   const int nbCols,
   AABB3D* const bdgBox);
@@ -86,12 +86,12 @@ void GetBoundVar3D(
 // Return true if the system becomes inconsistent during elimination,
 // else return false
 bool ElimVar3D(
-  const double (*M)[3],
-  const double* Y,
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
   const int nbRows,
   const int nbCols,
-  double (*Mp)[3],
-  double* Yp,
+  FMB_REAL (*Mp)[3],
+  FMB_REAL* Yp,
   int* const nbRemainRows) {
 
   // Initialize the number of rows in the result system
@@ -105,16 +105,16 @@ bool ElimVar3D(
     ++iRow) {
 
     // Shortcuts
-    const double fabsMIRowIVar = fabs(M[iRow][0]);
+    const FMB_REAL fabsMIRowIVar = fabs(M[iRow][0]);
 
     // If the coefficient for the eliminated variable is not null
     // in this row
     if (fabsMIRowIVar > EPSILON) {
 
       // Shortcuts
-      const double* MiRow = M[iRow];
+      const FMB_REAL* MiRow = M[iRow];
       const int sgnMIRowIVar = sgn(MiRow[0]);
-      const double YIRowDivideByFabsMIRowIVar = Y[iRow] / fabsMIRowIVar;
+      const FMB_REAL YIRowDivideByFabsMIRowIVar = Y[iRow] / fabsMIRowIVar;
 
       // For each following rows
       for (
@@ -129,12 +129,12 @@ bool ElimVar3D(
           fabs(M[jRow][0]) > EPSILON) {
 
           // Shortcuts
-          const double* MjRow = M[jRow];
-          const double fabsMjRow = fabs(MjRow[0]);
+          const FMB_REAL* MjRow = M[jRow];
+          const FMB_REAL fabsMjRow = fabs(MjRow[0]);
 
           // Declare a variable to memorize the sum of the negative
           // coefficients in the row
-          double sumNegCoeff = 0.0;
+          FMB_REAL sumNegCoeff = 0.0;
 
           // Add the sum of the two normed (relative to the eliminated
           // variable) rows into the result system. This actually
@@ -189,14 +189,14 @@ bool ElimVar3D(
     ++iRow) {
 
     // Shortcut
-    const double* MiRow = M[iRow];
+    const FMB_REAL* MiRow = M[iRow];
 
     // If the coefficient of the eliminated variable is null on
     // this row
     if (fabs(MiRow[0]) < EPSILON) {
 
       // Shortcut
-      double* MpnbResRows = Mp[nbResRows];
+      FMB_REAL* MpnbResRows = Mp[nbResRows];
 
       // Copy this row into the result system excluding the eliminated
       // variable
@@ -235,14 +235,14 @@ bool ElimVar3D(
 // mean the system has no solution
 void GetBoundLastVar3D(
   const int iVar,
-  const double (*M)[3],
-  const double* Y,
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
   const int nbRows,
   AABB3D* const bdgBox) {
 
   // Shortcuts
-  double* min = bdgBox->min + iVar;
-  double* max = bdgBox->max + iVar;
+  FMB_REAL* min = bdgBox->min + iVar;
+  FMB_REAL* max = bdgBox->max + iVar;
 
   // Initialize the bounds to their maximum maximum and minimum minimum
   *min = 0.0;
@@ -255,14 +255,14 @@ void GetBoundLastVar3D(
     ++jRow) {
 
     // Shortcut
-    double MjRowiVar = M[jRow][0];
+    FMB_REAL MjRowiVar = M[jRow][0];
 
     // If this row has been reduced to the variable in argument
     // and it has a strictly positive coefficient
     if (MjRowiVar > EPSILON) {
 
       // Get the scaled value of Y for this row
-      double y = Y[jRow] / MjRowiVar;
+      FMB_REAL y = Y[jRow] / MjRowiVar;
 
       // If the value is lower than the current maximum bound
       if (*max > y) {
@@ -277,7 +277,7 @@ void GetBoundLastVar3D(
     } else if (MjRowiVar < -EPSILON) {
 
       // Get the scaled value of Y for this row
-      double y = Y[jRow] / MjRowiVar;
+      FMB_REAL y = Y[jRow] / MjRowiVar;
 
       // If the value is greater than the current minimum bound
       if (*min < y) {
@@ -299,15 +299,15 @@ void GetBoundLastVar3D(
 // (M arrangement is [iRow][iCol])
 void GetBoundVar3D(
   const int iVar,
-  const double (*M)[3],
-  const double* Y,
+  const FMB_REAL (*M)[3],
+  const FMB_REAL* Y,
   const int nbRows,
   const int nbCols,
   AABB3D* const bdgBox) {
 
   // Shortcuts
-  double* bdgBoxMin = bdgBox->min;
-  double* bdgBoxMax = bdgBox->max;
+  FMB_REAL* bdgBoxMin = bdgBox->min;
+  FMB_REAL* bdgBoxMax = bdgBox->max;
 
   // Initialize the bounds
   bdgBoxMin[iVar] = 0.0;
@@ -320,16 +320,16 @@ void GetBoundVar3D(
     ++iRow) {
 
     // Shortcuts
-    const double* MIRow = M[iRow];
-    double fabsMIRowIVar = fabs(MIRow[0]);
+    const FMB_REAL* MIRow = M[iRow];
+    FMB_REAL fabsMIRowIVar = fabs(MIRow[0]);
 
     // If the coefficient of the first variable on this row is not null
     if (fabsMIRowIVar > EPSILON) {
 
       // Declare two variables to memorize the min and max of the
       // requested variable in this row
-      double min = -1.0 * Y[iRow];
-      double max = Y[iRow];
+      FMB_REAL min = -1.0 * Y[iRow];
+      FMB_REAL max = Y[iRow];
 
       // Loop on columns except the first one which is the one of the
       // requested variable
@@ -393,8 +393,8 @@ bool FMB(
 
   // Declare two variables to memorize the system to be solved M.X <= Y
   // (M arrangement is [iRow][iCol])
-  double M[8][3];
-  double Y[8];
+  FMB_REAL M[8][3];
+  FMB_REAL Y[8];
 
   // Create the inequality system
   // -sum_iC_j,iX_i<=O_j
@@ -485,10 +485,10 @@ bool FMB(
   // Instead I use a smaller value which has proven to be sufficient
   // during tests, validation and qualification, to avoid running
   // into the heap limit and to optimize slightly the performance
-  //double Mp[48][3];
-  //double Yp[48];
-  double Mp[20][3];
-  double Yp[20];
+  //FMB_REAL Mp[48][3];
+  //FMB_REAL Yp[48];
+  FMB_REAL Mp[20][3];
+  FMB_REAL Yp[20];
   int nbRowsP;
 
   // Eliminate the first variable in the original system
@@ -515,10 +515,10 @@ bool FMB(
   // Instead I use a smaller value which has proven to be sufficient
   // during tests, validation and qualification, to avoid running
   // into the heap limit and to optimize slightly the performance
-  //double Mpp[624][3];
-  //double Ypp[624];
-  double Mpp[55][3];
-  double Ypp[55];
+  //FMB_REAL Mpp[624][3];
+  //FMB_REAL Ypp[624];
+  FMB_REAL Mpp[55][3];
+  FMB_REAL Ypp[55];
   int nbRowsPP;
 
   // Eliminate the second variable (which is the first in the new system)
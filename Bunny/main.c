@@ -22,10 +22,15 @@
 #include <stdio.h>
 #include <stdbool.h>
 #include <math.h>
+#include <string.h>
+#include <sys/time.h>
 
 // Include the FMB algorithm library
 #include "fmb3d.h"
 #include "sat.h"
+#include "bvh.h"
+#include "pool.h"
+#include "ply.h"
 
 // Intersection detection mode
 // 0: FMB
@@ -34,6 +39,156 @@
   #define MODE 0
 #endif
 
+// Path of the bunny in PLY format
+#define PLY_PATH "./bun_zipper.ply"
+
+// Scale of the model, to avoid null determinant
+#define SCALE 1000.0
+
+// Test the intersection between the Frames that and tho with the
+// algorithm selected by MODE, with the signature expected by
+// BVH3DCollide (bdgBox is unused)
+bool TestIntersection(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  AABB3D* const bdgBox) {
+
+  (void)bdgBox;
+#if MODE == 0
+  return
+    FMB(
+      that,
+      tho);
+#else
+  return
+    SATTestIntersection3D(
+      that,
+      tho);
+#endif
+
+}
+
+// Function called by BVH3DCollide on each pair of intersecting faces,
+// flag the face of the first bunny in the array of flags data
+void FlagFace(
+  const int iFace,
+  const int jFace,
+  void* const data) {
+
+  (void)jFace;
+  bool* isInter = data;
+  isInter[iFace] = true;
+
+}
+
+// Job of the brute force test of the faces by the FMBPool
+typedef struct {
+
+  // Faces of the two bunnies and their number
+  int nbFace;
+  const Frame3D* framesA;
+  const Frame3D* framesB;
+
+  // Geometries of the faces of the two bunnies used by the SAT
+  // intersection test (cf SATFrame3DCreate)
+  const SATFrame3D* satFramesA;
+  const SATFrame3D* satFramesB;
+
+  // Flags of intersection of the faces of the first bunny
+  bool* isInter;
+
+} BruteForceJob;
+
+// Job function of the brute force test, flag the faces of the first
+// bunny in [iStart, iEnd) intersecting a face of the second one
+void TestFaces(
+  const int iStart,
+  const int iEnd,
+  const int iThread,
+  void* const data) {
+
+  (void)iThread;
+  BruteForceJob* job = data;
+
+  // Loop on the faces of one bunny
+  for (
+    int iFace = iStart;
+    iFace < iEnd;
+    ++iFace) {
+
+    // Loop on the faces of the mirrored/translated bunny, until
+    // one intersecting the face is found
+    for (
+      int jFace = 0;
+      jFace < job->nbFace && job->isInter[iFace] == false;
+      ++jFace) {
+
+#if MODE == 0
+      job->isInter[iFace] =
+        TestIntersection(
+          job->framesA + iFace,
+          job->framesB + jFace,
+          NULL);
+#else
+      job->isInter[iFace] =
+        SATTestIntersection3DPrecomputed(
+          job->satFramesA + iFace,
+          job->satFramesB + jFace);
+#endif
+
+    }
+
+  }
+
+}
+
+// Growable list of the pairs of faces whose bounding boxes intersect
+typedef struct {
+
+  FMBPair* pairs;
+  int nbPair;
+  int size;
+
+} Candidates;
+
+// Test used with BVH3DCollide to get all the pairs of faces whose
+// bounding boxes intersect, which are then tested by the FMBPool
+bool AcceptPair(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  AABB3D* const bdgBox) {
+
+  (void)that;
+  (void)tho;
+  (void)bdgBox;
+  return true;
+
+}
+
+// Function called by BVH3DCollide on each pair of faces whose bounding
+// boxes intersect, add the pair to the Candidates data
+void MemorizeCandidate(
+  const int iFace,
+  const int jFace,
+  void* const data) {
+
+  Candidates* candidates = data;
+  if (candidates->nbPair == candidates->size) {
+
+    candidates->size = (candidates->size == 0 ? 1024 : 2 * candidates->size);
+    candidates->pairs =
+      realloc(
+        candidates->pairs,
+        sizeof(FMBPair) * candidates->size);
+
+  }
+
+  candidates->pairs[candidates->nbPair].iThat = iFace;
+  candidates->pairs[candidates->nbPair].iTho = jFace;
+  ++(candidates->nbPair);
+
+}
+
 // Main function
 int main(int argc, char** argv) {
 
@@ -43,270 +198,326 @@ int main(int argc, char** argv) {
       printf("Using SAT\n");
 #endif
 
-  // Allocate memory for the vertices
-  double* vertices =
-    malloc(sizeof(double) * 3L * 35947L);
+  // Check if the user requested the use of the BVH3D (else all the
+  // pairs of faces are tested)
+  // the number of threads, and the path of the mesh
+  bool useBVH = false;
+  int nbThread = 1;
+  const char* path = PLY_PATH;
+  for (
+    int iArg = 1;
+    iArg < argc;
+    ++iArg) {
 
-  // Allocate memory for the faces
-  unsigned long* faces =
-    malloc(sizeof(unsigned long) * 3L * 69451L);
+    if (strcmp(argv[iArg], "-bvh") == 0) {
 
-  // Open the file containing the bunny in PLY format
-  FILE* fp =
-    fopen(
-      "./bun_zipper.ply",
-      "r");
+      useBVH = true;
 
-  // Open the file to save the bunny in Pov-Ray format
-  FILE* fpPov =
-    fopen(
-      "./bunny.inc",
-      "w");
+    } else if (strcmp(argv[iArg], "-threads") == 0 && iArg + 1 < argc) {
 
-  // Open the file to save the intersection in Pov-Ray format
-  FILE* fpFmb =
-    fopen(
-      "./fmb.inc",
-      "w");
+      ++iArg;
+      nbThread = atoi(argv[iArg]);
 
-  // Skip the header
-  for (
-    int i = 12;
-    i--;) {
+    } else if (strcmp(argv[iArg], "-ply") == 0 && iArg + 1 < argc) {
 
-    char buffer[1000];
-    char* ret =
-      fgets(
-        buffer,
-        1000,
-        fp);
-    (void)ret;
+      ++iArg;
+      path = argv[iArg];
+
+    }
 
   }
 
-  // Declare a variable to scale the model to avoid null determinant
-  const double scale = 1000.0;
+  if (useBVH == true) {
 
-  // Read the vertices
-  for (
-    unsigned long iVertex =0;
-    iVertex < 35947L;
-    ++iVertex) {
-
-    double buff;
-    int ret = 
-      fscanf(
-        fp,
-        "%lf %lf %lf %lf %lf\n",
-        vertices + 3L * iVertex,
-        vertices + 3L * iVertex + 1L,
-        vertices + 3L * iVertex + 2L,
-        &buff,
-        &buff);
-    (void)ret;
-
-    // Scale 
-    vertices[3L * iVertex] *= scale;
-    vertices[3L * iVertex + 1L] *= scale;
-    vertices[3L * iVertex + 2L] *= scale;
+    printf("Using BVH\n");
+
+  } else {
+
+    printf("Using brute force\n");
 
   }
 
-  // Write the header of the bunny file
+  // Create the pool of threads
+  FMBPool* pool = FMBPoolCreate(nbThread);
+  printf("Using %d thread(s)\n", pool->nbThread);
+
+  // Load the bunny, which is given in ascii, but can be converted to
+  // binary for faster loading of larger meshes
+  struct timeval startLoad;
+  gettimeofday(&startLoad, NULL);
+  PLYMesh* mesh =
+    PLYMeshLoad(
+      path,
+      SCALE);
+  if (mesh == NULL) {
+
+    return 1;
+
+  }
+
+  // Create the tetrahedrons of the faces of the bunny, and of the
+  // mirrored/translated bunny
+  Frame3D* framesA = malloc(sizeof(Frame3D) * (mesh->nbFace + 1));
+  Frame3D* framesB = malloc(sizeof(Frame3D) * (mesh->nbFace + 1));
+  FMB_REAL mirror[3][3] = {
+
+    {-1.0, 0.0, 0.0},
+    {0.0, 1.0, 0.0},
+    {0.0, 0.0, 1.0}
+
+  };
+  FMB_REAL translation[3] = {50.0, -10.0, 0.0};
+  PLYMeshCreateFrames3D(
+    mesh,
+    NULL,
+    NULL,
+    framesA);
+  PLYMeshCreateFrames3D(
+    mesh,
+    (const FMB_REAL (*)[3])mirror,
+    translation,
+    framesB);
+  struct timeval stopLoad;
+  gettimeofday(&stopLoad, NULL);
+  printf("%d vertices, %d faces, loaded in %.3fs\n",
+    mesh->nbVertex, mesh->nbFace,
+    (double)((stopLoad.tv_sec - startLoad.tv_sec) * 1000000 +
+    stopLoad.tv_usec - startLoad.tv_usec) / 1000000.0);
+
+  // Save the bunny in Pov-Ray format
+  FILE* fpPov =
+    fopen(
+      "./bunny.inc",
+      "w");
   fprintf(
     fpPov,
     "#declare bunny = union {\n");
-
-  // Read the faces
   for (
-    unsigned long iFace =0;
-    iFace < 69451L;
+    int iFace = 0;
+    iFace < mesh->nbFace;
     ++iFace) {
 
-    unsigned long buff;
-    int ret =
-      fscanf(
-        fp,
-        "%lu %lu %lu %lu\n",
-        &buff,
-        faces + 3L * iFace,
-        faces + 3L * iFace + 1,
-        faces + 3L * iFace + 2);
-    (void)ret;
+    FMB_REAL vert[3][3];
+    for (
+      int iVert = 3;
+      iVert--;) {
+
+      PLYMeshGetVertex(
+        mesh,
+        mesh->faces[3 * iFace + iVert],
+        vert[iVert]);
+
+    }
 
     fprintf(
       fpPov,
       "triangle {<%lf,%lf,%lf>, <%lf,%lf,%lf>, <%lf,%lf,%lf>}\n",
-      vertices[faces[3L * iFace] * 3L],
-      vertices[faces[3L * iFace] * 3L + 1],
-      vertices[faces[3L * iFace] * 3L + 2],
-      vertices[faces[3L * iFace + 1] * 3L],
-      vertices[faces[3L * iFace + 1] * 3L + 1],
-      vertices[faces[3L * iFace + 1] * 3L + 2],
-      vertices[faces[3L * iFace + 2] * 3L],
-      vertices[faces[3L * iFace + 2] * 3L + 1],
-      vertices[faces[3L * iFace + 2] * 3L + 2]);
+      vert[0][0],
+      vert[0][1],
+      vert[0][2],
+      vert[1][0],
+      vert[1][1],
+      vert[1][2],
+      vert[2][0],
+      vert[2][1],
+      vert[2][2]);
 
   }
 
-  // Write the tailer of the bunny file
   fprintf(
     fpPov,
     "}\n");
-  
+
+  // Open the file to save the intersection in Pov-Ray format
+  FILE* fpFmb =
+    fopen(
+      "./fmb.inc",
+      "w");
 
   // Write the header of the intersection file
   fprintf(
     fpFmb,
     "#declare fmb = union {\n");
 
-  // Declare variables to create the tetrahedrons
-  double orig[3];
-  double comp[3][3];
-  double l;
+  // Allocate memory for the flags of intersection of the faces of the
+  // first bunny
+  bool* isInter = calloc(mesh->nbFace + 1, sizeof(bool));
+
+  // Start measuring time
+  struct timeval start;
+  gettimeofday(&start, NULL);
+
+  // If the user requested the BVH3D
+  if (useBVH == true) {
+
+    // Create the BVH3D over the faces of the two bunnies
+    BVH3D* bvhA =
+      BVH3DCreate(
+        framesA,
+        mesh->nbFace);
+    BVH3D* bvhB =
+      BVH3DCreate(
+        framesB,
+        mesh->nbFace);
+
+    // If there is only one thread
+    if (pool->nbThread == 1) {
+
+      // Flag the faces of the first bunny intersecting a face of the
+      // second one
+      BVH3DCollide(
+        bvhA,
+        framesA,
+        bvhB,
+        framesB,
+        TestIntersection,
+        FlagFace,
+        isInter);
+
+    // Else, get the pairs of faces whose bounding boxes intersect and
+    // test them with the pool
+    } else {
+
+      Candidates candidates = {
+
+        .pairs = NULL,
+        .nbPair = 0,
+        .size = 0
+
+      };
+      BVH3DCollide(
+        bvhA,
+        framesA,
+        bvhB,
+        framesB,
+        AcceptPair,
+        MemorizeCandidate,
+        &candidates);
+      int* iIntersecting = malloc(sizeof(int) * (candidates.nbPair + 1));
+      int nbPairInter =
+        FMBPoolTestPairs3D(
+          pool,
+          framesA,
+          framesB,
+          candidates.pairs,
+          candidates.nbPair,
+          TestIntersection,
+          iIntersecting);
+      for (
+        int iPair = nbPairInter;
+        iPair--;) {
+
+        isInter[candidates.pairs[iIntersecting[iPair]].iThat] = true;
+
+      }
+
+      bvhA->nbIntersection = nbPairInter;
+      free(iIntersecting);
+      free(candidates.pairs);
+
+    }
+
+    printf("Nodes tested: %lu, faces tested: %lu, intersections: %lu\n",
+      bvhA->nbNodeTest, bvhA->nbCandidate, bvhA->nbIntersection);
+
+    // Free memory
+    BVH3DFree(&bvhA);
+    BVH3DFree(&bvhB);
+
+  // Else, test all the pairs of faces
+  } else {
+
+    // Create the geometries of the faces used by the SAT intersection
+    // test, once per face instead of once per pair of faces
+    SATFrame3D* satFramesA = NULL;
+    SATFrame3D* satFramesB = NULL;
+#if MODE == 1
+    satFramesA = malloc(sizeof(SATFrame3D) * (mesh->nbFace + 1));
+    satFramesB = malloc(sizeof(SATFrame3D) * (mesh->nbFace + 1));
+    for (
+      int iFace = mesh->nbFace;
+      iFace--;) {
+
+      satFramesA[iFace] = SATFrame3DCreate(framesA + iFace);
+      satFramesB[iFace] = SATFrame3DCreate(framesB + iFace);
+
+    }
+#endif
+
+    // Distribute the faces of one bunny among the threads, by small
+    // chunks as the time to find an intersecting face varies a lot
+    BruteForceJob job = {
+
+      .nbFace = mesh->nbFace,
+      .framesA = framesA,
+      .framesB = framesB,
+      .satFramesA = satFramesA,
+      .satFramesB = satFramesB,
+      .isInter = isInter
+
+    };
+    FMBPoolRun(
+      pool,
+      mesh->nbFace,
+      16,
+      TestFaces,
+      &job);
+
+    // Free memory
+    free(satFramesA);
+    free(satFramesB);
+
+  }
+
+  // Stop measuring time
+  struct timeval stop;
+  gettimeofday(&stop, NULL);
+  unsigned long deltaus =
+    (stop.tv_sec - start.tv_sec) * 1000000 +
+    stop.tv_usec - start.tv_usec;
 
   // Loop on the faces of one bunny
+  int nbFaceInter = 0;
   for (
-    unsigned long iFace =0;
-    iFace < 69451L;
+    int iFace = 0;
+    iFace < mesh->nbFace;
     ++iFace) {
 
-    // printf(
-    //   "%05ld/69451\r",
-    //   iFace);
-
-    // Create the Tetrahedron for this face
-    orig[0] = vertices[faces[3L * iFace] * 3L];
-    orig[1] = vertices[faces[3L * iFace] * 3L + 1];
-    orig[2] = vertices[faces[3L * iFace] * 3L + 2];
-    comp[0][0] =
-      vertices[faces[3L * iFace + 1] * 3L] -
-      vertices[faces[3L * iFace] * 3L];
-    comp[0][1] =
-      vertices[faces[3L * iFace + 1] * 3L + 1] -
-      vertices[faces[3L * iFace] * 3L + 1];
-    comp[0][2] =
-      vertices[faces[3L * iFace + 1] * 3L + 2] -
-      vertices[faces[3L * iFace] * 3L + 2];
-    comp[1][0] =
-      vertices[faces[3L * iFace + 2] * 3L] -
-      vertices[faces[3L * iFace] * 3L];
-    comp[1][1] =
-      vertices[faces[3L * iFace + 2] * 3L + 1] -
-      vertices[faces[3L * iFace] * 3L + 1];
-    comp[1][2] =
-      vertices[faces[3L * iFace + 2] * 3L + 2] -
-      vertices[faces[3L * iFace] * 3L + 2];
-    comp[2][0] = comp[1][1] * comp[0][2] - comp[1][2] * comp[0][1];
-    comp[2][1] = comp[1][2] * comp[0][0] - comp[1][0] * comp[0][2];
-    comp[2][2] = comp[1][0] * comp[0][1] - comp[1][1] * comp[0][0];
-    l =
-      sqrt(
-        comp[2][0] * comp[2][0] +
-        comp[2][1] * comp[2][1] +
-        comp[2][2] * comp[2][2]);
-    comp[2][0] /= l;
-    comp[2][1] /= l;
-    comp[2][2] /= l;
-
-    Frame3D P =
-      Frame3DCreateStatic(
-        FrameTetrahedron,
-        orig,
-        comp);
-
-    // Loop on the faces of the mirrored/translated bunny
-    for (
-      unsigned long jFace =0;
-      jFace < 69451L;
-      ++jFace) {
+    // If there is intersection
+    if (isInter[iFace]) {
 
-      // Create the second tetrahedron
-      orig[0] = -1.0 * vertices[faces[3L * jFace] * 3L] + 50.0;
-      orig[1] = vertices[faces[3L * jFace] * 3L + 1] - 10.0;
-      orig[2] = vertices[faces[3L * jFace] * 3L + 2];
-      comp[0][0] = -1.0 * (
-        vertices[faces[3L * jFace + 1] * 3L] -
-        vertices[faces[3L * jFace] * 3L]);
-      comp[0][1] =
-        vertices[faces[3L * jFace + 1] * 3L + 1] -
-        vertices[faces[3L * jFace] * 3L + 1];
-      comp[0][2] =
-        vertices[faces[3L * jFace + 1] * 3L + 2] -
-        vertices[faces[3L * jFace] * 3L + 2];
-      comp[1][0] = -1.0 * (
-        vertices[faces[3L * jFace + 2] * 3L] -
-        vertices[faces[3L * jFace] * 3L]);
-      comp[1][1] =
-        vertices[faces[3L * jFace + 2] * 3L + 1] -
-        vertices[faces[3L * jFace] * 3L + 1];
-      comp[1][2] =
-        vertices[faces[3L * jFace + 2] * 3L + 2] -
-        vertices[faces[3L * jFace] * 3L + 2];
-      comp[2][0] = comp[1][1] * comp[0][2] - comp[1][2] * comp[0][1];
-      comp[2][1] = comp[1][2] * comp[0][0] - comp[1][0] * comp[0][2];
-      comp[2][2] = comp[1][0] * comp[0][1] - comp[1][1] * comp[0][0];
-      l =
-        sqrt(
-          comp[2][0] * comp[2][0] +
-          comp[2][1] * comp[2][1] +
-          comp[2][2] * comp[2][2]);
-      comp[2][0] /= l;
-      comp[2][1] /= l;
-      comp[2][2] /= l;
-
-      Frame3D Q =
-        Frame3DCreateStatic(
-          FrameTetrahedron,
-          orig,
-          comp);
-
-      // Test the intersection
-#if MODE == 0
-      bool inter = 
-        FMB(
-          &P,
-          &Q);
-#else
-      bool inter = 
-        SATTestIntersection3D(
-          &P,
-          &Q);
-#endif
+      // Add the intersection  to the file
+      ++nbFaceInter;
+      FMB_REAL vert[3][3];
+      for (
+        int iVert = 3;
+        iVert--;) {
 
-      // If there is intersection
-      if (inter) {
-
-        // Add the intersection  to the file
-        double pos[3];
-        pos[0] =
-          (vertices[faces[3L * iFace] * 3L] +
-          vertices[faces[3L * iFace + 1] * 3L] +
-          vertices[faces[3L * iFace + 2] * 3L]) / 3.0;
-        pos[1] =
-          (vertices[faces[3L * iFace] * 3L + 1L] +
-          vertices[faces[3L * iFace + 1] * 3L + 1L] +
-          vertices[faces[3L * iFace + 2] * 3L + 1L]) / 3.0;
-        pos[2] =
-          (vertices[faces[3L * iFace] * 3L + 2L] +
-          vertices[faces[3L * iFace + 1] * 3L + 2L] +
-          vertices[faces[3L * iFace + 2] * 3L + 2L]) / 3.0;
-        fprintf(
-          fpFmb,
-          "sphere {<%lf,%lf,%lf>, 1.0}\n",
-          pos[0],
-          pos[1],
-          pos[2]);
-
-        // Skip the other faces
-        jFace = 69451L;
+        PLYMeshGetVertex(
+          mesh,
+          mesh->faces[3 * iFace + iVert],
+          vert[iVert]);
 
       }
 
+      FMB_REAL pos[3];
+      pos[0] = (vert[0][0] + vert[1][0] + vert[2][0]) / 3.0;
+      pos[1] = (vert[0][1] + vert[1][1] + vert[2][1]) / 3.0;
+      pos[2] = (vert[0][2] + vert[1][2] + vert[2][2]) / 3.0;
+      fprintf(
+        fpFmb,
+        "sphere {<%lf,%lf,%lf>, 1.0}\n",
+        pos[0],
+        pos[1],
+        pos[2]);
+
     }
 
   }
 
+  printf("%d intersecting faces, detected in %.3fs\n",
+    nbFaceInter, (double)deltaus / 1000000.0);
+
   // Write the tailer of the bunny file
   fprintf(
     fpFmb,
@@ -314,11 +525,13 @@ int main(int argc, char** argv) {
   
 
   // Free memory
-  fclose(fp);
   fclose(fpPov);
   fclose(fpFmb);
-  free(vertices);
-  free(faces);
+  PLYMeshFree(&mesh);
+  free(framesA);
+  free(framesB);
+  free(isInter);
+  FMBPoolFree(&pool);
 
   return 0;
 
@@ -0,0 +1,1153 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <string.h>
+#include <limits.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "ply.h"
+
+// ------------- Macros -------------
+
+// Max number of elements in the header, of properties per element,
+// and length of their names
+#define PLY_MAX_ELEMENT 16
+#define PLY_MAX_PROPERTY 32
+#define PLY_MAX_NAME 64
+
+// ------------- Data structures -------------
+
+// Property of an element in the header
+typedef struct {
+
+  // Name of the property
+  char name[PLY_MAX_NAME];
+
+  // Flag to memorize if the property is a list, type of the values
+  // and type of the number of values (if it's a list)
+  bool isList;
+  PLYType type;
+  PLYType countType;
+
+} PLYProperty;
+
+// Element in the header
+typedef struct {
+
+  // Name of the element and number of records
+  char name[PLY_MAX_NAME];
+  long nb;
+
+  // Properties of the element
+  int nbProperty;
+  PLYProperty properties[PLY_MAX_PROPERTY];
+
+} PLYElement;
+
+// Header of a PLY file
+typedef struct {
+
+  PLYFormat format;
+  int nbElement;
+  PLYElement elements[PLY_MAX_ELEMENT];
+
+  // Position of the data after the header in the content of the file
+  size_t offsetData;
+
+} PLYHeader;
+
+// Cursor on the data of a PLY file
+typedef struct {
+
+  // Current position and end of the data
+  const unsigned char* ptr;
+  const unsigned char* end;
+
+  // Format of the data
+  PLYFormat format;
+
+} PLYCursor;
+
+// ------------- Functions declaration -------------
+
+// Get the type named name into type
+// Return false if the name is not a type of the PLY format
+static bool PLYGetType(
+  const char* const name,
+  PLYType* const type);
+
+// Return the size in bytes of a value of type type in binary format
+static int PLYGetSize(const PLYType type);
+
+// Parse the header at the beginning of the content of size size of a
+// PLY file into header
+// Return false (after printing the reason) if the header is invalid
+static bool PLYParseHeader(
+  const char* const content,
+  const size_t size,
+  PLYHeader* const header);
+
+// Read the next value of type type at the cursor cursor into val and
+// move the cursor after it
+// Return false if there is no more value
+static bool PLYRead(
+  PLYCursor* const cursor,
+  const PLYType type,
+  double* const val);
+
+// Read the record of the element element at the cursor cursor and
+// move the cursor after it. If mesh is not null and the element is
+// the faces, add the triangles of the face to the mesh, and if
+// coords is not null and the element is the vertices, store the
+// coordinates of the vertex into coords
+// Return false (after printing the reason) if the record is invalid
+static bool PLYReadRecord(
+  PLYCursor* const cursor,
+  const PLYElement* const element,
+  PLYMesh* const mesh,
+  size_t* const sizeFaces,
+  double* const coords);
+
+// Store the cross product of v and u into w and return its length
+static FMB_REAL PLYCross(
+  const FMB_REAL* const u,
+  const FMB_REAL* const v,
+  FMB_REAL* const w);
+
+// Return true if the triangle of the vertices #iA, #iB, #iC of the
+// PLYMesh that has a null area, in which case its Tetrahedron would
+// have a null normal
+static bool PLYIsDegenerate(
+  const PLYMesh* const that,
+  const int iA,
+  const int iB,
+  const int iC);
+
+// ------------- Functions implementation -------------
+
+// Get the type named name into type
+static bool PLYGetType(
+  const char* const name,
+  PLYType* const type) {
+
+  static const char* names[][2] = {
+
+    {"char", "int8"},
+    {"uchar", "uint8"},
+    {"short", "int16"},
+    {"ushort", "uint16"},
+    {"int", "int32"},
+    {"uint", "uint32"},
+    {"float", "float32"},
+    {"double", "float64"}
+
+  };
+  for (
+    int iType = PLYTypeDouble + 1;
+    iType--;) {
+
+    if (
+      strcmp(name, names[iType][0]) == 0 ||
+      strcmp(name, names[iType][1]) == 0) {
+
+      *type = (PLYType)iType;
+      return true;
+
+    }
+
+  }
+
+  return false;
+
+}
+
+// Return the size in bytes of a value of type type in binary format
+static int PLYGetSize(const PLYType type) {
+
+  static const int sizes[] = {1, 1, 2, 2, 4, 4, 4, 8};
+  return sizes[type];
+
+}
+
+// Parse the header at the beginning of the content of size size of a
+// PLY file into header
+static bool PLYParseHeader(
+  const char* const content,
+  const size_t size,
+  PLYHeader* const header) {
+
+  header->nbElement = 0;
+  bool hasFormat = false;
+  size_t pos = 0;
+  int iLine = 0;
+
+  // Loop on the lines of the header
+  while (true) {
+
+    // Copy the line, to work on a null terminated string whatever the
+    // content
+    char line[256];
+    size_t len = 0;
+    while (pos < size && content[pos] != '\n') {
+
+      if (len < sizeof(line) - 1 && content[pos] != '\r') {
+
+        line[len] = content[pos];
+        ++len;
+
+      }
+
+      ++pos;
+
+    }
+
+    if (pos >= size) {
+
+      printf("PLYMeshLoad: end of header not found\n");
+      return false;
+
+    }
+
+    line[len] = '\0';
+    ++pos;
+
+    // Split the line in words
+    char* words[8];
+    int nbWord = 0;
+    char* save = NULL;
+    for (
+      char* word = strtok_r(line, " \t", &save);
+      word != NULL && nbWord < 8;
+      word = strtok_r(NULL, " \t", &save)) {
+
+      words[nbWord] = word;
+      ++nbWord;
+
+    }
+
+    // The first line must be the magic number
+    if (iLine == 0) {
+
+      if (nbWord != 1 || strcmp(words[0], "ply") != 0) {
+
+        printf("PLYMeshLoad: not a PLY file\n");
+        return false;
+
+      }
+
+    } else if (nbWord == 0 || strcmp(words[0], "comment") == 0 ||
+      strcmp(words[0], "obj_info") == 0) {
+
+      // Nothing to do
+
+    } else if (strcmp(words[0], "format") == 0 && nbWord == 3) {
+
+      if (strcmp(words[1], "ascii") == 0) {
+
+        header->format = PLYFormatAscii;
+
+      } else if (strcmp(words[1], "binary_little_endian") == 0) {
+
+        header->format = PLYFormatBinaryLittleEndian;
+
+      } else {
+
+        printf("PLYMeshLoad: unsupported format %s\n", words[1]);
+        return false;
+
+      }
+
+      hasFormat = true;
+
+    } else if (strcmp(words[0], "element") == 0 && nbWord == 3) {
+
+      if (header->nbElement == PLY_MAX_ELEMENT) {
+
+        printf("PLYMeshLoad: too many elements\n");
+        return false;
+
+      }
+
+      PLYElement* element = header->elements + header->nbElement;
+      ++(header->nbElement);
+      snprintf(element->name, PLY_MAX_NAME, "%s", words[1]);
+      element->nb = strtol(words[2], NULL, 10);
+      element->nbProperty = 0;
+      if (element->nb < 0 || element->nb > INT_MAX) {
+
+        printf("PLYMeshLoad: invalid number of %s\n", words[1]);
+        return false;
+
+      }
+
+    } else if (strcmp(words[0], "property") == 0 && nbWord >= 3) {
+
+      if (header->nbElement == 0) {
+
+        printf("PLYMeshLoad: property outside of an element\n");
+        return false;
+
+      }
+
+      PLYElement* element = header->elements + header->nbElement - 1;
+      if (element->nbProperty == PLY_MAX_PROPERTY) {
+
+        printf("PLYMeshLoad: too many properties\n");
+        return false;
+
+      }
+
+      PLYProperty* prop = element->properties + element->nbProperty;
+      ++(element->nbProperty);
+      bool isValid = false;
+      if (strcmp(words[1], "list") == 0) {
+
+        prop->isList = true;
+        isValid =
+          nbWord == 5 &&
+          PLYGetType(words[2], &(prop->countType)) &&
+          PLYGetType(words[3], &(prop->type));
+        if (isValid == true) {
+
+          snprintf(prop->name, PLY_MAX_NAME, "%s", words[4]);
+
+        }
+
+      } else {
+
+        prop->isList = false;
+        isValid =
+          nbWord == 3 &&
+          PLYGetType(words[1], &(prop->type));
+        if (isValid == true) {
+
+          snprintf(prop->name, PLY_MAX_NAME, "%s", words[2]);
+
+        }
+
+      }
+
+      if (isValid == false) {
+
+        printf("PLYMeshLoad: invalid property\n");
+        return false;
+
+      }
+
+    } else if (strcmp(words[0], "end_header") == 0) {
+
+      break;
+
+    } else {
+
+      printf("PLYMeshLoad: invalid header line %s\n", words[0]);
+      return false;
+
+    }
+
+    ++iLine;
+
+  }
+
+  if (hasFormat == false) {
+
+    printf("PLYMeshLoad: format not found\n");
+    return false;
+
+  }
+
+  header->offsetData = pos;
+  return true;
+
+}
+
+// Read the next value of type type at the cursor cursor into val and
+// move the cursor after it
+static bool PLYRead(
+  PLYCursor* const cursor,
+  const PLYType type,
+  double* const val) {
+
+  // If the file is in ascii
+  if (cursor->format == PLYFormatAscii) {
+
+    // The content is null terminated, strtod stops on it
+    char* end = NULL;
+    *val = strtod((const char*)(cursor->ptr), &end);
+    if ((const unsigned char*)end == cursor->ptr) {
+
+      return false;
+
+    }
+
+    cursor->ptr = (const unsigned char*)end;
+    return true;
+
+  }
+
+  // Else the file is in binary little endian, read the value with
+  // memcpy as it may be unaligned
+  int size = PLYGetSize(type);
+  if (cursor->end - cursor->ptr < size) {
+
+    return false;
+
+  }
+
+  switch (type) {
+
+    case PLYTypeChar: {
+      *val = (double)(*(const signed char*)(cursor->ptr));
+      break;
+    }
+    case PLYTypeUChar: {
+      *val = (double)(*(cursor->ptr));
+      break;
+    }
+    case PLYTypeShort: {
+      short v;
+      memcpy(&v, cursor->ptr, sizeof(v));
+      *val = (double)v;
+      break;
+    }
+    case PLYTypeUShort: {
+      unsigned short v;
+      memcpy(&v, cursor->ptr, sizeof(v));
+      *val = (double)v;
+      break;
+    }
+    case PLYTypeInt: {
+      int v;
+      memcpy(&v, cursor->ptr, sizeof(v));
+      *val = (double)v;
+      break;
+    }
+    case PLYTypeUInt: {
+      unsigned int v;
+      memcpy(&v, cursor->ptr, sizeof(v));
+      *val = (double)v;
+      break;
+    }
+    case PLYTypeFloat: {
+      float v;
+      memcpy(&v, cursor->ptr, sizeof(v));
+      *val = (double)v;
+      break;
+    }
+    case PLYTypeDouble: {
+      memcpy(val, cursor->ptr, sizeof(*val));
+      break;
+    }
+
+  }
+
+  cursor->ptr += size;
+  return true;
+
+}
+
+// Read the record of the element element at the cursor cursor and
+// move the cursor after it
+static bool PLYReadRecord(
+  PLYCursor* const cursor,
+  const PLYElement* const element,
+  PLYMesh* const mesh,
+  size_t* const sizeFaces,
+  double* const coords) {
+
+  // Loop on the properties of the element
+  for (
+    int iProp = 0;
+    iProp < element->nbProperty;
+    ++iProp) {
+
+    // Shortcut
+    const PLYProperty* prop = element->properties + iProp;
+
+    // If the property is a single value
+    if (prop->isList == false) {
+
+      double val;
+      if (
+        PLYRead(
+          cursor,
+          prop->type,
+          &val) == false) {
+
+        printf("PLYMeshLoad: unexpected end of %s\n", element->name);
+        return false;
+
+      }
+
+      if (coords != NULL && prop->name[1] == '\0' &&
+        prop->name[0] >= 'x' && prop->name[0] <= 'z') {
+
+        coords[prop->name[0] - 'x'] = val;
+
+      }
+
+      continue;
+
+    }
+
+    // Else the property is a list, read the number of values
+    double val;
+    if (
+      PLYRead(
+        cursor,
+        prop->countType,
+        &val) == false ||
+      val < 0.0) {
+
+      printf("PLYMeshLoad: unexpected end of %s\n", element->name);
+      return false;
+
+    }
+
+    int nbVal = (int)val;
+    bool isFace =
+      mesh != NULL &&
+      (strcmp(prop->name, "vertex_indices") == 0 ||
+      strcmp(prop->name, "vertex_index") == 0);
+
+    // Loop on the values
+    int iFirst = 0;
+    int iPrev = 0;
+    for (
+      int iVal = 0;
+      iVal < nbVal;
+      ++iVal) {
+
+      if (
+        PLYRead(
+          cursor,
+          prop->type,
+          &val) == false) {
+
+        printf("PLYMeshLoad: unexpected end of %s\n", element->name);
+        return false;
+
+      }
+
+      if (isFace == false) {
+
+        continue;
+
+      }
+
+      int iVertex = (int)val;
+      if (iVertex < 0 || iVertex >= mesh->nbVertex) {
+
+        printf("PLYMeshLoad: invalid vertex index %d\n", iVertex);
+        return false;
+
+      }
+
+      // Split the polygon in triangles sharing its first vertex
+      if (iVal == 0) {
+
+        iFirst = iVertex;
+
+      // The triangles with a null area are skipped
+      } else if (
+        iVal >= 2 &&
+        PLYIsDegenerate(
+          mesh,
+          iFirst,
+          iPrev,
+          iVertex) == false) {
+
+        if (mesh->nbFace == INT_MAX) {
+
+          printf("PLYMeshLoad: too many faces\n");
+          return false;
+
+        }
+
+        if (3 * ((size_t)(mesh->nbFace) + 1) > *sizeFaces) {
+
+          if (*sizeFaces > SIZE_MAX / (2 * sizeof(int))) {
+
+            printf("PLYMeshLoad: too many faces\n");
+            return false;
+
+          }
+
+          *sizeFaces *= 2;
+          mesh->faces =
+            realloc(
+              mesh->faces,
+              sizeof(int) * (*sizeFaces));
+          if (mesh->faces == NULL) {
+
+            printf("PLYMeshLoad: failed to allocate memory\n");
+            exit(0);
+
+          }
+
+        }
+
+        int* face = mesh->faces + 3 * mesh->nbFace;
+        face[0] = iFirst;
+        face[1] = iPrev;
+        face[2] = iVertex;
+        ++(mesh->nbFace);
+
+      }
+
+      iPrev = iVertex;
+
+    }
+
+  }
+
+  return true;
+
+}
+
+// Load the PLY file at path, with the coordinates of the vertices
+// scaled by scale
+PLYMesh* PLYMeshLoad(
+  const char* const path,
+  const double scale) {
+
+  // Open the file and get its size
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+
+    printf("PLYMeshLoad: can't open %s\n", path);
+    return NULL;
+
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size == 0) {
+
+    printf("PLYMeshLoad: can't read %s\n", path);
+    close(fd);
+    return NULL;
+
+  }
+
+  // Map the file in memory
+  size_t size = (size_t)(st.st_size);
+  void* map =
+    mmap(
+      NULL,
+      size,
+      PROT_READ,
+      MAP_PRIVATE,
+      fd,
+      0);
+  close(fd);
+  if (map == MAP_FAILED) {
+
+    printf("PLYMeshLoad: can't map %s\n", path);
+    return NULL;
+
+  }
+
+  // Parse the header
+  PLYHeader header;
+  if (
+    PLYParseHeader(
+      map,
+      size,
+      &header) == false) {
+
+    munmap(map, size);
+    return NULL;
+
+  }
+
+  // Allocate memory for the mesh
+  PLYMesh* that = malloc(sizeof(PLYMesh));
+  if (that == NULL) {
+
+    printf("PLYMeshLoad: failed to allocate memory\n");
+    exit(0);
+
+  }
+
+  that->format = header.format;
+  that->nbVertex = 0;
+  that->nbFace = 0;
+  that->scale = scale;
+  that->vertexData = NULL;
+  that->vertexStride = 0;
+  that->faces = NULL;
+
+  // If the file is binary, keep it mapped to access the vertices
+  // without copy
+  if (header.format == PLYFormatBinaryLittleEndian) {
+
+    that->content = map;
+    that->sizeContent = size;
+
+  // Else, copy the content with a terminating null character for
+  // strtod and release the mapping
+  } else {
+
+    that->content = malloc(size + 1);
+    if (that->content == NULL) {
+
+      printf("PLYMeshLoad: failed to allocate memory\n");
+      exit(0);
+
+    }
+
+    memcpy(
+      that->content,
+      map,
+      size);
+    ((char*)(that->content))[size] = '\0';
+    that->sizeContent = size + 1;
+    munmap(map, size);
+
+  }
+
+  // Declare the cursor on the data
+  PLYCursor cursor = {
+
+    .ptr = (const unsigned char*)(that->content) + header.offsetData,
+    .end = (const unsigned char*)(that->content) + size,
+    .format = header.format
+
+  };
+
+  // Loop on the elements
+  bool hasVertex = false;
+  bool hasFace = false;
+  bool isValid = true;
+  for (
+    int iElem = 0;
+    iElem < header.nbElement && isValid == true;
+    ++iElem) {
+
+    // Shortcut
+    const PLYElement* element = header.elements + iElem;
+
+    // If the element is the vertices
+    if (strcmp(element->name, "vertex") == 0) {
+
+      hasVertex = true;
+      that->nbVertex = (int)(element->nb);
+
+      // Get the position of the coordinates in the records
+      int nbFound = 0;
+      int offset = 0;
+      bool hasList = false;
+      for (
+        int iProp = 0;
+        iProp < element->nbProperty;
+        ++iProp) {
+
+        const PLYProperty* prop = element->properties + iProp;
+        hasList = hasList || prop->isList;
+        if (
+          prop->isList == false &&
+          prop->name[1] == '\0' &&
+          prop->name[0] >= 'x' && prop->name[0] <= 'z' &&
+          (prop->type == PLYTypeFloat || prop->type == PLYTypeDouble)) {
+
+          that->offsetXYZ[prop->name[0] - 'x'] = offset;
+          that->typeXYZ[prop->name[0] - 'x'] = prop->type;
+          ++nbFound;
+
+        }
+
+        offset += PLYGetSize(prop->type);
+
+      }
+
+      if (nbFound != 3) {
+
+        printf("PLYMeshLoad: x, y, z float properties not found\n");
+        isValid = false;
+
+      // If the file is binary, the vertices are fixed size records
+      // accessed directly in the mapped file
+      } else if (header.format == PLYFormatBinaryLittleEndian) {
+
+        if (hasList == true) {
+
+          printf("PLYMeshLoad: list property in binary vertices\n");
+          isValid = false;
+
+        } else if (
+          (size_t)(cursor.end - cursor.ptr) <
+          (size_t)offset * (size_t)(element->nb)) {
+
+          printf("PLYMeshLoad: unexpected end of vertex\n");
+          isValid = false;
+
+        } else {
+
+          that->vertexData = cursor.ptr;
+          that->vertexStride = offset;
+          cursor.ptr += (size_t)offset * (size_t)(element->nb);
+
+        }
+
+      // Else, parse the vertices in an array of double
+      } else {
+
+        double* vertices = malloc(sizeof(double) * 3 * (element->nb + 1));
+        if (vertices == NULL) {
+
+          printf("PLYMeshLoad: failed to allocate memory\n");
+          exit(0);
+
+        }
+
+        that->vertexData = (const unsigned char*)vertices;
+        that->vertexStride = 3 * sizeof(double);
+        for (
+          int iAxis = 3;
+          iAxis--;) {
+
+          that->offsetXYZ[iAxis] = iAxis * sizeof(double);
+          that->typeXYZ[iAxis] = PLYTypeDouble;
+
+        }
+
+        for (
+          long iVertex = 0;
+          iVertex < element->nb && isValid == true;
+          ++iVertex) {
+
+          isValid =
+            PLYReadRecord(
+              &cursor,
+              element,
+              NULL,
+              NULL,
+              vertices + 3 * iVertex);
+
+        }
+
+      }
+
+    // Else, if the element is the faces
+    } else if (strcmp(element->name, "face") == 0) {
+
+      if (hasVertex == false) {
+
+        printf("PLYMeshLoad: faces before vertices\n");
+        isValid = false;
+        continue;
+
+      }
+
+      // Allocate the faces for triangles, enlarged if necessary
+      hasFace = true;
+      if ((size_t)(element->nb) + 1 > SIZE_MAX / (3 * sizeof(int))) {
+
+        printf("PLYMeshLoad: too many faces\n");
+        isValid = false;
+        continue;
+
+      }
+
+      size_t sizeFaces = 3 * ((size_t)(element->nb) + 1);
+      that->faces = malloc(sizeof(int) * sizeFaces);
+      if (that->faces == NULL) {
+
+        printf("PLYMeshLoad: failed to allocate memory\n");
+        exit(0);
+
+      }
+
+      for (
+        long iFace = 0;
+        iFace < element->nb && isValid == true;
+        ++iFace) {
+
+        isValid =
+          PLYReadRecord(
+            &cursor,
+            element,
+            that,
+            &sizeFaces,
+            NULL);
+
+      }
+
+    // Else, skip the element
+    } else {
+
+      for (
+        long iRecord = 0;
+        iRecord < element->nb && isValid == true;
+        ++iRecord) {
+
+        isValid =
+          PLYReadRecord(
+            &cursor,
+            element,
+            NULL,
+            NULL,
+            NULL);
+
+      }
+
+    }
+
+  }
+
+  if (isValid == true && (hasVertex == false || hasFace == false)) {
+
+    printf("PLYMeshLoad: vertex or face element not found\n");
+    isValid = false;
+
+  }
+
+  if (isValid == false) {
+
+    PLYMeshFree(&that);
+    return NULL;
+
+  }
+
+  // Return the mesh
+  return that;
+
+}
+
+// Free the memory used by the PLYMesh that
+void PLYMeshFree(PLYMesh** that) {
+
+  if (that == NULL || *that == NULL) {
+
+    return;
+
+  }
+
+  if ((*that)->format == PLYFormatBinaryLittleEndian) {
+
+    munmap(
+      (*that)->content,
+      (*that)->sizeContent);
+
+  } else {
+
+    free((void*)((*that)->vertexData));
+    free((*that)->content);
+
+  }
+
+  free((*that)->faces);
+  free(*that);
+  *that = NULL;
+
+}
+
+// Get the scaled coordinates of the vertex #iVertex of the PLYMesh
+// that into v
+void PLYMeshGetVertex(
+  const PLYMesh* const that,
+  const int iVertex,
+  FMB_REAL* const v) {
+
+  const unsigned char* record =
+    that->vertexData + (size_t)iVertex * (size_t)(that->vertexStride);
+  for (
+    int iAxis = 3;
+    iAxis--;) {
+
+    if (that->typeXYZ[iAxis] == PLYTypeFloat) {
+
+      float val;
+      memcpy(&val, record + that->offsetXYZ[iAxis], sizeof(val));
+      v[iAxis] = (FMB_REAL)((double)val * that->scale);
+
+    } else {
+
+      double val;
+      memcpy(&val, record + that->offsetXYZ[iAxis], sizeof(val));
+      v[iAxis] = (FMB_REAL)(val * that->scale);
+
+    }
+
+  }
+
+}
+
+// Create in one pass over the faces of the PLYMesh that the
+// Tetrahedrons of its faces into the array frames
+void PLYMeshCreateFrames3D(
+  const PLYMesh* const that,
+  const FMB_REAL mat[3][3],
+  const FMB_REAL* const translation,
+  Frame3D* const frames) {
+
+  // Loop on the faces
+  for (
+    int iFace = 0;
+    iFace < that->nbFace;
+    ++iFace) {
+
+    // Get the vertices of the face
+    FMB_REAL vert[3][3];
+    for (
+      int iVert = 3;
+      iVert--;) {
+
+      PLYMeshGetVertex(
+        that,
+        that->faces[3 * iFace + iVert],
+        vert[iVert]);
+
+    }
+
+    // Get the origin and the first two components, the linear part of
+    // the transformation is applied to the edges rather than the
+    // transformed vertices to avoid rounding errors on the components
+    FMB_REAL edge[2][3];
+    for (
+      int iAxis = 3;
+      iAxis--;) {
+
+      edge[0][iAxis] = vert[1][iAxis] - vert[0][iAxis];
+      edge[1][iAxis] = vert[2][iAxis] - vert[0][iAxis];
+
+    }
+
+    FMB_REAL orig[3];
+    FMB_REAL comp[3][3];
+    for (
+      int iAxis = 3;
+      iAxis--;) {
+
+      if (mat == NULL) {
+
+        orig[iAxis] = vert[0][iAxis];
+        comp[0][iAxis] = edge[0][iAxis];
+        comp[1][iAxis] = edge[1][iAxis];
+
+      } else {
+
+        orig[iAxis] =
+          mat[iAxis][0] * vert[0][0] +
+          mat[iAxis][1] * vert[0][1] +
+          mat[iAxis][2] * vert[0][2];
+        comp[0][iAxis] =
+          mat[iAxis][0] * edge[0][0] +
+          mat[iAxis][1] * edge[0][1] +
+          mat[iAxis][2] * edge[0][2];
+        comp[1][iAxis] =
+          mat[iAxis][0] * edge[1][0] +
+          mat[iAxis][1] * edge[1][1] +
+          mat[iAxis][2] * edge[1][2];
+
+      }
+
+      if (translation != NULL) {
+
+        orig[iAxis] += translation[iAxis];
+
+      }
+
+    }
+
+    // The third component is the normal of the face, not null as the
+    // loader skips the faces with a null area
+    FMB_REAL l =
+      PLYCross(
+        comp[0],
+        comp[1],
+        comp[2]);
+    comp[2][0] /= l;
+    comp[2][1] /= l;
+    comp[2][2] /= l;
+
+    frames[iFace] =
+      Frame3DCreateStatic(
+        FrameTetrahedron,
+        orig,
+        comp);
+
+  }
+
+}
+
+// Store the cross product of v and u into w and return its length
+static FMB_REAL PLYCross(
+  const FMB_REAL* const u,
+  const FMB_REAL* const v,
+  FMB_REAL* const w) {
+
+  w[0] = v[1] * u[2] - v[2] * u[1];
+  w[1] = v[2] * u[0] - v[0] * u[2];
+  w[2] = v[0] * u[1] - v[1] * u[0];
+  return
+    sqrt(
+      w[0] * w[0] +
+      w[1] * w[1] +
+      w[2] * w[2]);
+
+}
+
+// Return true if the triangle of the vertices #iA, #iB, #iC of the
+// PLYMesh that has a null area
+static bool PLYIsDegenerate(
+  const PLYMesh* const that,
+  const int iA,
+  const int iB,
+  const int iC) {
+
+  // Get the edges as PLYMeshCreateFrames3D without transformation
+  FMB_REAL vert[3][3];
+  PLYMeshGetVertex(
+    that,
+    iA,
+    vert[0]);
+  PLYMeshGetVertex(
+    that,
+    iB,
+    vert[1]);
+  PLYMeshGetVertex(
+    that,
+    iC,
+    vert[2]);
+  FMB_REAL edge[2][3];
+  for (
+    int iAxis = 3;
+    iAxis--;) {
+
+    edge[0][iAxis] = vert[1][iAxis] - vert[0][iAxis];
+    edge[1][iAxis] = vert[2][iAxis] - vert[0][iAxis];
+
+  }
+
+  FMB_REAL normal[3];
+  FMB_REAL l =
+    PLYCross(
+      edge[0],
+      edge[1],
+      normal);
+
+  // Negated comparison to also catch a NaN length
+  return (l > 0.0) == false;
+
+}
@@ -0,0 +1,133 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef __PLY_H_
+#define __PLY_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "frame.h"
+
+// ------------- Enumerations -------------
+
+// Formats of PLY file supported by PLYMeshLoad
+typedef enum {
+
+  PLYFormatAscii,
+  PLYFormatBinaryLittleEndian
+
+} PLYFormat;
+
+// Types of the properties of a PLY file
+typedef enum {
+
+  PLYTypeChar,
+  PLYTypeUChar,
+  PLYTypeShort,
+  PLYTypeUShort,
+  PLYTypeInt,
+  PLYTypeUInt,
+  PLYTypeFloat,
+  PLYTypeDouble
+
+} PLYType;
+
+// ------------- Data structures -------------
+
+// Triangular mesh loaded from a PLY file
+typedef struct {
+
+  // Format of the file
+  PLYFormat format;
+
+  // Nb of vertices and of triangles (polygons with more than 3
+  // vertices are split in triangles sharing their first vertex)
+  int nbVertex;
+  int nbFace;
+
+  // Scale applied to the coordinates of the vertices by
+  // PLYMeshGetVertex
+  double scale;
+
+  // Coordinates of the vertices: the i-th coordinate of the vertex
+  // #iVertex is of type typeXYZ[i] at
+  // vertexData + iVertex * vertexStride + offsetXYZ[i]
+  // For a binary file vertexData points directly into the mapped
+  // file, for an ascii file into an array of double owned by the mesh
+  const unsigned char* vertexData;
+  int vertexStride;
+  int offsetXYZ[3];
+  PLYType typeXYZ[3];
+
+  // Indices of the vertices of the triangles, 3 per triangle
+  int* faces;
+
+  // Mapped file (binary) or content of the file (ascii) and its size
+  void* content;
+  size_t sizeContent;
+
+} PLYMesh;
+
+// ------------- Functions declaration -------------
+
+// Load the PLY file at path, with the coordinates of the vertices
+// scaled by scale
+// The counts of vertices and faces and the layout of their properties
+// are read from the header, the vertices must have the x, y, z float
+// or double properties and the faces a vertex_indices (or
+// vertex_index) list property. Other elements and properties are
+// skipped
+// Binary files are mapped in memory and their vertices accessed
+// without copy, ascii files are read and parsed once
+// Polygons are split in triangles sharing their first vertex, and the
+// triangles with a null area (once scaled) are skipped
+// Return the mesh, or null (after printing the reason) if the file
+// can't be loaded
+PLYMesh* PLYMeshLoad(
+  const char* const path,
+  const double scale);
+
+// Free the memory used by the PLYMesh that
+void PLYMeshFree(PLYMesh** that);
+
+// Get the scaled coordinates of the vertex #iVertex of the PLYMesh
+// that into v
+void PLYMeshGetVertex(
+  const PLYMesh* const that,
+  const int iVertex,
+  FMB_REAL* const v);
+
+// Create in one pass over the faces of the PLYMesh that the
+// Tetrahedrons of its faces into the array frames, which must have at
+// least that->nbFace elements
+// The Tetrahedron of a face ABC has origin A, first and second
+// components AB and AC, and third component the normalized
+// cross product of AC and AB
+// The vertices are transformed by X -> mat.X + translation before
+// creating the Tetrahedrons, mat and translation can be null for the
+// identity matrix and the null vector
+// mat must be invertible, to keep the normals of the faces not null
+void PLYMeshCreateFrames3D(
+  const PLYMesh* const that,
+  const FMB_REAL mat[3][3],
+  const FMB_REAL* const translation,
+  Frame3D* const frames);
+
+#endif
@@ -0,0 +1,638 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Include standard libraries
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+// Include the PLY loader
+#include "ply.h"
+
+// Epsilon for numerical precision
+#define EPSILON 0.0001
+
+// Path of the PLY files written by the unit tests
+#define PLY_PATH "unitTests.ply"
+
+// Size of the buffer of the binary PLY files
+#define PLY_MAX_SIZE 1024
+
+// Mesh of the unit tests: 4 vertices, a triangle and a quad split in
+// two triangles sharing its first vertex
+#define NB_VERTEX 4
+#define NB_FACE 3
+static const double vertices[NB_VERTEX][3] = {
+
+  {0.0, 0.0, 0.0},
+  {1.0, 0.0, 0.0},
+  {0.0, 1.0, 0.5},
+  {-1.5, 2.0, 0.25}
+
+};
+static const int faces[NB_FACE][3] = {
+
+  {0, 1, 2},
+  {1, 3, 2},
+  {1, 2, 0}
+
+};
+
+// Write the size bytes of content into the file at PLY_PATH
+void WritePLYFile(
+  const void* const content,
+  const size_t size) {
+
+  FILE* fp = fopen(PLY_PATH, "wb");
+  if (fp == NULL) {
+
+    printf("UnitTestPLY can't write %s\n", PLY_PATH);
+    exit(0);
+
+  }
+
+  fwrite(
+    content,
+    1,
+    size,
+    fp);
+  fclose(fp);
+
+}
+
+// Unit test of the loading of a PLY file
+// Takes the content of the file, its size, the correct answer in term
+// of loaded/not loaded and the name of the test
+// Load the file with PLYMeshLoad with a scale of 2.0 and, if it is
+// loaded, check the vertices and faces against the mesh of the unit
+// tests
+void UnitTestPLYLoad(
+  const void* const content,
+  const size_t size,
+  const bool correctAnswer,
+  const char* const name) {
+
+  // Write and load the file
+  WritePLYFile(
+    content,
+    size);
+  PLYMesh* mesh =
+    PLYMeshLoad(
+      PLY_PATH,
+      2.0);
+  remove(PLY_PATH);
+
+  // If the loader hasn't given the expected answer
+  if ((mesh != NULL) != correctAnswer) {
+
+    printf("UnitTestPLYLoad %s Failed\n", name);
+    printf("Expected : ");
+    if (correctAnswer == false) printf("not ");
+    printf("loaded\n");
+    printf("Got : ");
+    if (mesh == NULL) printf("not ");
+    printf("loaded\n");
+    exit(0);
+
+  }
+
+  // If the file is not loaded there is nothing else to check
+  if (mesh == NULL) {
+
+    return;
+
+  }
+
+  // Check the numbers of vertices and faces
+  if (
+    mesh->nbVertex != NB_VERTEX ||
+    mesh->nbFace != NB_FACE) {
+
+    printf("UnitTestPLYLoad %s Failed\n", name);
+    printf("Expected %d vertices and %d faces, got %d and %d\n",
+      NB_VERTEX, NB_FACE, mesh->nbVertex, mesh->nbFace);
+    exit(0);
+
+  }
+
+  // Check the scaled vertices
+  for (
+    int iVertex = NB_VERTEX;
+    iVertex--;) {
+
+    FMB_REAL v[3];
+    PLYMeshGetVertex(
+      mesh,
+      iVertex,
+      v);
+    for (
+      int iAxis = 3;
+      iAxis--;) {
+
+      if (fabs(v[iAxis] - 2.0 * vertices[iVertex][iAxis]) > EPSILON) {
+
+        printf("UnitTestPLYLoad %s Failed\n", name);
+        printf("Vertex %d axis %d expected %f got %f\n",
+          iVertex, iAxis, 2.0 * vertices[iVertex][iAxis], v[iAxis]);
+        exit(0);
+
+      }
+
+    }
+
+  }
+
+  // Check the faces
+  for (
+    int iFace = NB_FACE;
+    iFace--;) {
+
+    for (
+      int iVertex = 3;
+      iVertex--;) {
+
+      if (mesh->faces[3 * iFace + iVertex] != faces[iFace][iVertex]) {
+
+        printf("UnitTestPLYLoad %s Failed\n", name);
+        printf("Face %d vertex %d expected %d got %d\n",
+          iFace, iVertex, faces[iFace][iVertex],
+          mesh->faces[3 * iFace + iVertex]);
+        exit(0);
+
+      }
+
+    }
+
+  }
+
+  // Free the mesh
+  PLYMeshFree(&mesh);
+  if (mesh != NULL) {
+
+    printf("UnitTestPLYLoad %s Failed\n", name);
+    printf("The mesh is not null after PLYMeshFree\n");
+    exit(0);
+
+  }
+
+}
+
+// Unit tests of the loading of ascii PLY files
+void TestPLYAscii(void) {
+
+  // Valid file, with a comment, an extra property in the vertices,
+  // the coordinates in double for z, and an element which is skipped
+  const char* ascii =
+    "ply\n"
+    "format ascii 1.0\n"
+    "comment unit test\n"
+    "element vertex 4\n"
+    "property float x\n"
+    "property uchar confidence\n"
+    "property float y\n"
+    "property double z\n"
+    "element face 2\n"
+    "property list uchar int vertex_indices\n"
+    "element edge 1\n"
+    "property int vertex1\n"
+    "property int vertex2\n"
+    "end_header\n"
+    "0.0 7 0.0 0.0\n"
+    "1.0 7 0.0 0.0\n"
+    "0.0 7 1.0 0.5\n"
+    "-1.5 7 2.0 0.25\n"
+    "3 0 1 2\n"
+    "4 1 3 2 0\n"
+    "0 1\n";
+  UnitTestPLYLoad(
+    ascii,
+    strlen(ascii),
+    true,
+    "ascii");
+
+  // Same file with Windows line endings in the header
+  const char* asciiCRLF =
+    "ply\r\n"
+    "format ascii 1.0\r\n"
+    "element vertex 4\r\n"
+    "property float x\r\n"
+    "property float y\r\n"
+    "property float z\r\n"
+    "element face 2\r\n"
+    "property list uchar int vertex_index\r\n"
+    "end_header\r\n"
+    "0.0 0.0 0.0\r\n"
+    "1.0 0.0 0.0\r\n"
+    "0.0 1.0 0.5\r\n"
+    "-1.5 2.0 0.25\r\n"
+    "3 0 1 2\r\n"
+    "4 1 3 2 0\r\n";
+  UnitTestPLYLoad(
+    asciiCRLF,
+    strlen(asciiCRLF),
+    true,
+    "ascii CRLF");
+
+  // Vertices truncated
+  const char* truncatedVertex =
+    "ply\n"
+    "format ascii 1.0\n"
+    "element vertex 4\n"
+    "property float x\n"
+    "property float y\n"
+    "property float z\n"
+    "element face 2\n"
+    "property list uchar int vertex_indices\n"
+    "end_header\n"
+    "0.0 0.0 0.0\n"
+    "1.0 0.0 0.0\n"
+    "0.0 1.0\n";
+  UnitTestPLYLoad(
+    truncatedVertex,
+    strlen(truncatedVertex),
+    false,
+    "ascii truncated vertices");
+
+  // Faces truncated
+  const char* truncatedFace =
+    "ply\n"
+    "format ascii 1.0\n"
+    "element vertex 4\n"
+    "property float x\n"
+    "property float y\n"
+    "property float z\n"
+    "element face 2\n"
+    "property list uchar int vertex_indices\n"
+    "end_header\n"
+    "0.0 0.0 0.0\n"
+    "1.0 0.0 0.0\n"
+    "0.0 1.0 0.5\n"
+    "-1.5 2.0 0.25\n"
+    "3 0 1 2\n"
+    "4 1 3\n";
+  UnitTestPLYLoad(
+    truncatedFace,
+    strlen(truncatedFace),
+    false,
+    "ascii truncated faces");
+
+  // Index of a vertex out of range
+  const char* invalidIndex =
+    "ply\n"
+    "format ascii 1.0\n"
+    "element vertex 4\n"
+    "property float x\n"
+    "property float y\n"
+    "property float z\n"
+    "element face 1\n"
+    "property list uchar int vertex_indices\n"
+    "end_header\n"
+    "0.0 0.0 0.0\n"
+    "1.0 0.0 0.0\n"
+    "0.0 1.0 0.5\n"
+    "-1.5 2.0 0.25\n"
+    "3 0 1 4\n";
+  UnitTestPLYLoad(
+    invalidIndex,
+    strlen(invalidIndex),
+    false,
+    "ascii invalid index");
+
+  printf("UnitTestPLYAscii Succeed\n\n");
+
+}
+
+// Append the size bytes of val to the buffer buffer of length *len
+void AppendPLYBinary(
+  unsigned char* const buffer,
+  size_t* const len,
+  const void* const val,
+  const size_t size) {
+
+  memcpy(
+    buffer + *len,
+    val,
+    size);
+  *len += size;
+
+}
+
+// Create into buffer the binary little endian PLY file of the mesh of
+// the unit tests, with an extra uchar property between x and y in the
+// vertices and z in double, and return its size
+// (the unit tests run on a little endian machine)
+size_t CreatePLYBinary(unsigned char* const buffer) {
+
+  const char* header =
+    "ply\n"
+    "format binary_little_endian 1.0\n"
+    "comment unit test\n"
+    "element vertex 4\n"
+    "property float x\n"
+    "property uchar confidence\n"
+    "property float y\n"
+    "property double z\n"
+    "element face 2\n"
+    "property list uchar int vertex_indices\n"
+    "end_header\n";
+  size_t len = strlen(header);
+  memcpy(
+    buffer,
+    header,
+    len);
+
+  // Vertices
+  for (
+    int iVertex = 0;
+    iVertex < NB_VERTEX;
+    ++iVertex) {
+
+    float x = (float)(vertices[iVertex][0]);
+    unsigned char confidence = 7;
+    float y = (float)(vertices[iVertex][1]);
+    double z = vertices[iVertex][2];
+    AppendPLYBinary(buffer, &len, &x, sizeof(x));
+    AppendPLYBinary(buffer, &len, &confidence, sizeof(confidence));
+    AppendPLYBinary(buffer, &len, &y, sizeof(y));
+    AppendPLYBinary(buffer, &len, &z, sizeof(z));
+
+  }
+
+  // Faces, a triangle and a quad
+  const unsigned char nbTriangle = 3;
+  const int triangle[3] = {0, 1, 2};
+  const unsigned char nbQuad = 4;
+  const int quad[4] = {1, 3, 2, 0};
+  AppendPLYBinary(buffer, &len, &nbTriangle, sizeof(nbTriangle));
+  AppendPLYBinary(buffer, &len, triangle, sizeof(triangle));
+  AppendPLYBinary(buffer, &len, &nbQuad, sizeof(nbQuad));
+  AppendPLYBinary(buffer, &len, quad, sizeof(quad));
+
+  return len;
+
+}
+
+// Unit tests of the loading of binary little endian PLY files
+void TestPLYBinary(void) {
+
+  // Valid file
+  unsigned char buffer[PLY_MAX_SIZE];
+  size_t len = CreatePLYBinary(buffer);
+  UnitTestPLYLoad(
+    buffer,
+    len,
+    true,
+    "binary");
+
+  // Position of the data after the header
+  size_t offsetData =
+    (size_t)(strstr((const char*)buffer, "end_header\n") -
+    (const char*)buffer) + strlen("end_header\n");
+
+  // Faces truncated
+  UnitTestPLYLoad(
+    buffer,
+    len - 1,
+    false,
+    "binary truncated faces");
+
+  // Vertices truncated, the last vertex misses its z coordinate
+  UnitTestPLYLoad(
+    buffer,
+    offsetData + 3 * 17 + 9,
+    false,
+    "binary truncated vertices");
+
+  // Header only
+  UnitTestPLYLoad(
+    buffer,
+    offsetData,
+    false,
+    "binary no data");
+
+  // Number of values of the quad changed to 200, beyond the end of
+  // the file
+  buffer[offsetData + NB_VERTEX * 17 + 1 + 3 * sizeof(int)] = 200;
+  UnitTestPLYLoad(
+    buffer,
+    len,
+    false,
+    "binary invalid list count");
+
+  printf("UnitTestPLYBinary Succeed\n\n");
+
+}
+
+// Unit tests of the loading of PLY files with an invalid header
+void TestPLYHeader(void) {
+
+  // Header lines replacing the beginning of a valid ascii file, with
+  // the name of the test
+  const char* headers[][2] = {
+
+    {"plyx\nformat ascii 1.0\n", "not a PLY file"},
+    {"ply\nformat ascii 1.0\nelement vertex 4\n", "end of header not found"},
+    {"ply\nformat binary_big_endian 1.0\n", "big endian format"},
+    {"ply\nformat ascii\n", "incomplete format"},
+    {"ply\nelement vertex 4\n", "format not found"},
+    {"ply\nformat ascii 1.0\nproperty float x\n",
+      "property outside of an element"},
+    {"ply\nformat ascii 1.0\nelement vertex 4\nproperty float128 x\n",
+      "invalid property type"},
+    {"ply\nformat ascii 1.0\nelement vertex 4\nproperty list uchar x\n",
+      "incomplete list property"},
+    {"ply\nformat ascii 1.0\nelement vertex -4\n",
+      "negative number of records"},
+    {"ply\nformat ascii 1.0\nelement vertex 4\nproperty float x\n"
+      "property float y\nelement face 0\n", "z not found"},
+    {"ply\nformat ascii 1.0\nelement face 0\nelement vertex 4\n",
+      "faces before vertices"},
+    {"ply\nformat ascii 1.0\nelement vertex 0\nproperty float x\n"
+      "property float y\nproperty float z\n", "face not found"},
+    {"ply\nformat ascii 1.0\nunknown keyword\n", "invalid header line"}
+
+  };
+  const int nbHeader = sizeof(headers) / sizeof(headers[0]);
+
+  // Loop on the headers
+  for (
+    int iHeader = 0;
+    iHeader < nbHeader;
+    ++iHeader) {
+
+    // Complete the header, unless it is the one without end, and add
+    // the data of a valid file
+    char content[PLY_MAX_SIZE];
+    const char* end =
+      (strstr(headers[iHeader][1], "end of header") != NULL ?
+      "" :
+      "end_header\n0.0 0.0 0.0\n");
+    snprintf(
+      content,
+      sizeof(content),
+      "%s%s",
+      headers[iHeader][0],
+      end);
+    UnitTestPLYLoad(
+      content,
+      strlen(content),
+      false,
+      headers[iHeader][1]);
+
+  }
+
+  // Empty file
+  UnitTestPLYLoad(
+    "",
+    0,
+    false,
+    "empty file");
+
+  // File which doesn't exist
+  PLYMesh* mesh =
+    PLYMeshLoad(
+      PLY_PATH,
+      1.0);
+  if (mesh != NULL) {
+
+    printf("UnitTestPLYHeader Failed\n");
+    printf("Loaded a file which doesn't exist\n");
+    exit(0);
+
+  }
+
+  printf("UnitTestPLYHeader Succeed\n\n");
+
+}
+
+// Unit tests of the faces with a null area
+void TestPLYDegenerate(void) {
+
+  // Ascii file with a face whose vertices are aligned, a face with a
+  // repeated vertex, and a quad whose second triangle has a repeated
+  // vertex
+  const char* degenerate =
+    "ply\n"
+    "format ascii 1.0\n"
+    "element vertex 4\n"
+    "property float x\n"
+    "property float y\n"
+    "property float z\n"
+    "element face 4\n"
+    "property list uchar int vertex_indices\n"
+    "end_header\n"
+    "0.0 0.0 0.0\n"
+    "1.0 0.0 0.0\n"
+    "0.0 1.0 0.0\n"
+    "2.0 0.0 0.0\n"
+    "3 0 1 3\n"
+    "3 0 0 2\n"
+    "4 0 1 2 2\n"
+    "3 1 3 2\n";
+  WritePLYFile(
+    degenerate,
+    strlen(degenerate));
+  PLYMesh* mesh =
+    PLYMeshLoad(
+      PLY_PATH,
+      1.0);
+  remove(PLY_PATH);
+  if (mesh == NULL) {
+
+    printf("UnitTestPLYDegenerate Failed\n");
+    printf("The file is not loaded\n");
+    exit(0);
+
+  }
+
+  // Only the two faces with a non null area remain
+  const int correctFaces[2][3] = {
+
+    {0, 1, 2},
+    {1, 3, 2}
+
+  };
+  if (
+    mesh->nbFace != 2 ||
+    memcmp(
+      mesh->faces,
+      correctFaces,
+      sizeof(correctFaces)) != 0) {
+
+    printf("UnitTestPLYDegenerate Failed\n");
+    printf("Expected 2 faces, got %d\n", mesh->nbFace);
+    exit(0);
+
+  }
+
+  // The Tetrahedrons of the faces must be valid
+  Frame3D frames[2];
+  PLYMeshCreateFrames3D(
+    mesh,
+    NULL,
+    NULL,
+    frames);
+  for (
+    int iFrame = 2;
+    iFrame--;) {
+
+    for (
+      int iComp = 3;
+      iComp--;) {
+
+      for (
+        int iAxis = 3;
+        iAxis--;) {
+
+        if (
+          isfinite(frames[iFrame].comp[iComp][iAxis]) == false ||
+          isfinite(frames[iFrame].invComp[iComp][iAxis]) == false) {
+
+          printf("UnitTestPLYDegenerate Failed\n");
+          printf("Frame %d is not finite\n", iFrame);
+          exit(0);
+
+        }
+
+      }
+
+    }
+
+  }
+
+  PLYMeshFree(&mesh);
+
+  printf("UnitTestPLYDegenerate Succeed\n\n");
+
+}
+
+// Main function
+int main(int argc, char** argv) {
+
+  TestPLYAscii();
+  TestPLYBinary();
+  TestPLYHeader();
+  TestPLYDegenerate();
+  printf("All unit tests PLY have succeed.\n");
+
+  return 0;
+
+}
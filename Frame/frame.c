@@ -17,20 +17,118 @@
     along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
-#include "frame.h"
+#include "frameinternal.h"
+#include <string.h>
 
 // ------------- Macros -------------
 
-#define EPSILON 0.0000001
+#define EPSILON FMB_EPSILON
+
+// Nb of FMB_REAL arrays in a Frame3DSoA: orig, comp, invComp, bdgBoxMin,
+// bdgBoxMax
+#define FRAME_SOA_NB_ARRAYS (3 + 9 + 9 + 3 + 3)
+
+// ------------- Data structures -------------
+
+// Block of statistics of one thread for one FrameStats
+struct FrameStatsBlock {
+
+  // FrameStats the block belongs to
+  FrameStats* stats;
+
+  // Previous and next blocks of the FrameStats
+  FrameStatsBlock* prev;
+  FrameStatsBlock* next;
+
+  // Next block of the same thread
+  FrameStatsBlock* nextThread;
+
+  // Statistics of the thread
+  void* data;
+
+};
+
+// ------------- Global variables -------------
+
+// Implementation of the hot paths currently used (cf FrameGetCPUPath)
+static FrameCPUPath frameCPUPath = FrameCPUGeneric;
+
+// Names of the paths, indexed by FrameCPUPath
+static const char* const frameCPUPathNames[FrameCPUNb] = {
+
+  "generic",
+  "sse2",
+  "avx2",
+  "avx512"
+
+};
+
+// Names of the stages of the FMB intersection tests, indexed by
+// FMBElimStage
+static const char* const fmbElimStageNames[FMBElimStageNb] = {
+
+  "init",
+  "pass1",
+  "pass2",
+  "pass3",
+  "bound",
+  "inter"
+
+};
+
+// Names of the pairs of types
+static const char* const frameTypePairNames[2][2] = {
+
+  {"CC", "CT"},
+  {"TC", "TT"}
+
+};
+
+// Lock of the lists of blocks of all the FrameStats
+static pthread_mutex_t frameStatsLock = PTHREAD_MUTEX_INITIALIZER;
+
+// Key of the first block of statistics of the calling thread, whose
+// destructor retires the blocks of the thread when it exits
+static pthread_key_t frameStatsKey;
+static pthread_once_t frameStatsKeyOnce = PTHREAD_ONCE_INIT;
 
 // ------------- Functions declaration -------------
 
+// Select the implementation of the hot paths at load time
+static void FrameInitCPUPath(void) __attribute__((constructor));
+
+// Create the key of the blocks of statistics of the threads
+static void FrameStatsCreateKey(void);
+
+// Add the blocks of statistics of an exiting thread, starting with
+// block, to the retired statistics of their FrameStats and free them
+static void FrameStatsRetireThread(void* block);
+
 // Update the inverse components of the Frame that
 static inline void Frame2DUpdateInv(Frame2D* const that);
 static inline void Frame3DUpdateInv(Frame3D* const that);
 static inline void Frame2DTimeUpdateInv(Frame2DTime* const that);
 static inline void Frame3DTimeUpdateInv(Frame3DTime* const that);
 
+// Update the bounding box of the Frame that
+static inline void Frame2DUpdateBdgBox(Frame2D* const that);
+static inline void Frame3DUpdateBdgBox(Frame3D* const that);
+static inline void Frame2DTimeUpdateBdgBox(Frame2DTime* const that);
+static inline void Frame3DTimeUpdateBdgBox(Frame3DTime* const that);
+
+// Get the rotation matrix rot ([iRow][iCol]) of angle theta around
+// the axis 'axis'
+static inline void GetRotMatrix3D(
+  const FMB_REAL axis[3],
+  const FMB_REAL theta,
+  FMB_REAL rot[3][3]);
+
+// Power function for integer base and exponent
+// Return base^exp
+static int powi(
+  int base,
+  unsigned int exp);
+
 // ------------- Functions implementation -------------
 
 // Create a static Frame structure of FrameType type,
@@ -38,8 +136,8 @@ static inline void Frame3DTimeUpdateInv(Frame3DTime* const that);
 // arrangement is comp[iComp][iAxis]
 Frame2D Frame2DCreateStatic(
   const FrameType type,
-  const double orig[2],
-  const double comp[2][2]) {
+  const FMB_REAL orig[2],
+  const FMB_REAL comp[2][2]) {
 
   // Create the new Frame
   Frame2D that;
@@ -61,79 +159,106 @@ Frame2D Frame2DCreateStatic(
   }
 
   // Create the bounding box
+  Frame2DUpdateBdgBox(&that);
+
+  // Calculate the inverse matrix
+  Frame2DUpdateInv(&that);
+
+  // Return the new Frame
+  return that;
+
+}
+
+Frame3D Frame3DCreateStatic(
+  const FrameType type,
+  const FMB_REAL orig[3],
+  const FMB_REAL comp[3][3]) {
+
+  // Create the new Frame
+  Frame3D that;
+  that.type = type;
   for (
-    int iAxis = 2;
+    int iAxis = 3;
     iAxis--;) {
 
-    double min = orig[iAxis];
-    double max = orig[iAxis];
+    that.orig[iAxis] = orig[iAxis];
 
     for (
-      int iComp = 2;
+      int iComp = 3;
       iComp--;) {
 
-      if (that.type == FrameCuboid) {
-
-        if (that.comp[iComp][iAxis] < 0.0) {
-
-          min += that.comp[iComp][iAxis];
+      that.comp[iComp][iAxis] = comp[iComp][iAxis];
 
-        }
+    }
 
-        if (that.comp[iComp][iAxis] > 0.0) {
+  }
 
-          max += that.comp[iComp][iAxis];
+  // Create the bounding box
+  Frame3DUpdateBdgBox(&that);
 
-        }
+  // By default the Frame is not a face
+  that.isFace = false;
 
-      } else if (that.type == FrameTetrahedron) {
+  // Calculate the inverse matrix
+  Frame3DUpdateInv(&that);
 
-        if (
-          that.comp[iComp][iAxis] < 0.0 &&
-          min > orig[iAxis] + that.comp[iComp][iAxis]) {
+  // Return the new Frame
+  return that;
 
-          min = orig[iAxis] + that.comp[iComp][iAxis];
+}
 
-        }
+Frame2DTime Frame2DTimeCreateStatic(
+  const FrameType type,
+  const FMB_REAL orig[2],
+  const FMB_REAL speed[2],
+  const FMB_REAL comp[2][2]) {
 
-        if (
-          that.comp[iComp][iAxis] > 0.0 &&
-          max < orig[iAxis] + that.comp[iComp][iAxis]) {
+  // Create the new Frame
+  Frame2DTime that;
+  that.type = type;
+  for (
+    int iAxis = 2;
+    iAxis--;) {
 
-          max = orig[iAxis] + that.comp[iComp][iAxis];
+    that.orig[iAxis] = orig[iAxis];
+    that.speed[iAxis] = speed[iAxis];
 
-        }
+    for (
+      int iComp = 2;
+      iComp--;) {
 
-      }
+      that.comp[iComp][iAxis] = comp[iComp][iAxis];
 
     }
 
-    that.bdgBox.min[iAxis] = min;
-    that.bdgBox.max[iAxis] = max;
-
   }
 
+  // Create the bounding box
+  Frame2DTimeUpdateBdgBox(&that);
+
   // Calculate the inverse matrix
-  Frame2DUpdateInv(&that);
+  Frame2DTimeUpdateInv(&that);
 
   // Return the new Frame
   return that;
 
 }
 
-Frame3D Frame3DCreateStatic(
+Frame3DTime Frame3DTimeCreateStatic(
   const FrameType type,
-  const double orig[3],
-  const double comp[3][3]) {
+  const FMB_REAL orig[3],
+  const FMB_REAL speed[3],
+  const FMB_REAL comp[3][3]) {
 
   // Create the new Frame
-  Frame3D that;
+  Frame3DTime that;
   that.type = type;
   for (
     int iAxis = 3;
     iAxis--;) {
 
     that.orig[iAxis] = orig[iAxis];
+    that.speed[iAxis] = speed[iAxis];
 
     for (
       int iComp = 3;
@@ -146,286 +271,499 @@ Frame3D Frame3DCreateStatic(
   }
 
   // Create the bounding box
-  for (
-    int iAxis = 3;
-    iAxis--;) {
+  Frame3DTimeUpdateBdgBox(&that);
 
-    double min = orig[iAxis];
-    double max = orig[iAxis];
+  // By default the Frame is not a face
+  that.isFace = false;
 
-    for (
-      int iComp = 3;
-      iComp--;) {
+  // Calculate the inverse matrix
+  Frame3DTimeUpdateInv(&that);
 
-      if (that.type == FrameCuboid) {
+  // Return the new Frame
+  return that;
 
-        if (that.comp[iComp][iAxis] < 0.0) {
+}
 
-          min += that.comp[iComp][iAxis];
+// Translate the Frame that by the vector v
+// The components are not modified, so the inverse components are
+// kept as is and only the bounding box is updated
+void Frame2DTranslate(
+  Frame2D* const that,
+  const FMB_REAL v[2]) {
 
-        }
+  // Move the origin
+  for (
+    int iAxis = 2;
+    iAxis--;) {
 
-        if (that.comp[iComp][iAxis] > 0.0) {
+    that->orig[iAxis] += v[iAxis];
 
-          max += that.comp[iComp][iAxis];
+  }
 
-        }
+  // Update the bounding box
+  Frame2DUpdateBdgBox(that);
 
-      } else if (that.type == FrameTetrahedron) {
+}
 
-        if (
-          that.comp[iComp][iAxis] < 0.0 &&
-          min > orig[iAxis] + that.comp[iComp][iAxis]) {
+void Frame3DTranslate(
+  Frame3D* const that,
+  const FMB_REAL v[3]) {
 
-          min = orig[iAxis] + that.comp[iComp][iAxis];
+  // Move the origin
+  for (
+    int iAxis = 3;
+    iAxis--;) {
 
-        }
+    that->orig[iAxis] += v[iAxis];
 
-        if (
-          that.comp[iComp][iAxis] > 0.0 &&
-          max < orig[iAxis] + that.comp[iComp][iAxis]) {
+  }
 
-          max = orig[iAxis] + that.comp[iComp][iAxis];
+  // Update the bounding box
+  Frame3DUpdateBdgBox(that);
 
-        }
+}
 
-      }
+void Frame2DTimeTranslate(
+  Frame2DTime* const that,
+  const FMB_REAL v[2]) {
 
-    }
+  // Move the origin
+  for (
+    int iAxis = 2;
+    iAxis--;) {
 
-    that.bdgBox.min[iAxis] = min;
-    that.bdgBox.max[iAxis] = max;
+    that->orig[iAxis] += v[iAxis];
 
   }
 
-  // Calculate the inverse matrix
-  Frame3DUpdateInv(&that);
-
-  // Return the new Frame
-  return that;
+  // Update the bounding box
+  Frame2DTimeUpdateBdgBox(that);
 
 }
 
-Frame2DTime Frame2DTimeCreateStatic(
-  const FrameType type,
-  const double orig[2],
-  const double speed[2],
-  const double comp[2][2]) {
+void Frame3DTimeTranslate(
+  Frame3DTime* const that,
+  const FMB_REAL v[3]) {
 
-  // Create the new Frame
-  Frame2DTime that;
-  that.type = type;
+  // Move the origin
   for (
-    int iAxis = 2;
+    int iAxis = 3;
     iAxis--;) {
 
-    that.orig[iAxis] = orig[iAxis];
-    that.speed[iAxis] = speed[iAxis];
+    that->orig[iAxis] += v[iAxis];
 
-    for (
-      int iComp = 2;
-      iComp--;) {
+  }
 
-      that.comp[iComp][iAxis] = comp[iComp][iAxis];
+  // Update the bounding box
+  Frame3DTimeUpdateBdgBox(that);
 
-    }
+}
 
-  }
+// Rotate the components of the Frame that around its origin by the
+// angle theta (in radians), around the axis 'axis' in 3D (which
+// doesn't need to be normalized)
+// The speed of the moving Frames is not modified
+// The bounding box and inverse components are updated only if theta
+// is not null
+void Frame2DRotate(
+  Frame2D* const that,
+  const FMB_REAL theta) {
 
-  // Create the bounding box
-  for (
-    int iAxis = 2;
-    iAxis--;) {
+  // If the rotation is null, nothing to do
+  if (theta == 0.0) {
 
-    double min = orig[iAxis];
-    double max = orig[iAxis];
+    return;
 
-    for (
-      int iComp = 2;
-      iComp--;) {
+  }
 
-      if (that.type == FrameCuboid) {
+  // Shortcuts
+  FMB_REAL (*tc)[2] = that->comp;
+  FMB_REAL c = cos(theta);
+  FMB_REAL s = sin(theta);
 
-        if (that.comp[iComp][iAxis] < 0.0) {
+  // Rotate the components
+  for (
+    int iComp = 2;
+    iComp--;) {
 
-          min += that.comp[iComp][iAxis];
+    FMB_REAL x = tc[iComp][0];
+    FMB_REAL y = tc[iComp][1];
+    tc[iComp][0] = c * x - s * y;
+    tc[iComp][1] = s * x + c * y;
 
-        }
+  }
 
-        if (that.comp[iComp][iAxis] > 0.0) {
+  // Update the bounding box and the inverse matrix
+  Frame2DUpdateBdgBox(that);
+  Frame2DUpdateInv(that);
 
-          max += that.comp[iComp][iAxis];
+}
 
-        }
+void Frame3DRotate(
+  Frame3D* const that,
+  const FMB_REAL axis[3],
+  const FMB_REAL theta) {
 
-      } else if (that.type == FrameTetrahedron) {
+  // If the rotation is null, nothing to do
+  if (theta == 0.0) {
 
-        if (
-          that.comp[iComp][iAxis] < 0.0 &&
-          min > orig[iAxis] + that.comp[iComp][iAxis]) {
+    return;
 
-          min = orig[iAxis] + that.comp[iComp][iAxis];
+  }
 
-        }
+  // Get the rotation matrix
+  FMB_REAL rot[3][3];
+  GetRotMatrix3D(
+    axis,
+    theta,
+    rot);
 
-        if (
-          that.comp[iComp][iAxis] > 0.0 &&
-          max < orig[iAxis] + that.comp[iComp][iAxis]) {
+  // Rotate the components
+  FMB_REAL (*tc)[3] = that->comp;
+  for (
+    int iComp = 3;
+    iComp--;) {
 
-          max = orig[iAxis] + that.comp[iComp][iAxis];
+    FMB_REAL v[3] = {tc[iComp][0], tc[iComp][1], tc[iComp][2]};
 
-        }
+    for (
+      int i = 3;
+      i--;) {
 
-      }
+      tc[iComp][i] =
+        rot[i][0] * v[0] + rot[i][1] * v[1] + rot[i][2] * v[2];
 
     }
 
-    if (that.speed[iAxis] < 0.0) {
-
-      min += that.speed[iAxis];
+  }
 
-    }
+  // Update the bounding box and the inverse matrix
+  Frame3DUpdateBdgBox(that);
+  Frame3DUpdateInv(that);
 
-    if (that.speed[iAxis] > 0.0) {
+}
 
-      max += that.speed[iAxis];
+void Frame2DTimeRotate(
+  Frame2DTime* const that,
+  const FMB_REAL theta) {
 
-    }
+  // If the rotation is null, nothing to do
+  if (theta == 0.0) {
 
-    that.bdgBox.min[iAxis] = min;
-    that.bdgBox.max[iAxis] = max;
+    return;
 
   }
 
-  that.bdgBox.min[2] = 0.0;
-  that.bdgBox.max[2] = 1.0;
+  // Shortcuts
+  FMB_REAL (*tc)[2] = that->comp;
+  FMB_REAL c = cos(theta);
+  FMB_REAL s = sin(theta);
+
+  // Rotate the components
+  for (
+    int iComp = 2;
+    iComp--;) {
 
-  // Calculate the inverse matrix
-  Frame2DTimeUpdateInv(&that);
+    FMB_REAL x = tc[iComp][0];
+    FMB_REAL y = tc[iComp][1];
+    tc[iComp][0] = c * x - s * y;
+    tc[iComp][1] = s * x + c * y;
 
-  // Return the new Frame
-  return that;
+  }
+
+  // Update the bounding box and the inverse matrix
+  Frame2DTimeUpdateBdgBox(that);
+  Frame2DTimeUpdateInv(that);
 
 }
 
-Frame3DTime Frame3DTimeCreateStatic(
-  const FrameType type,
-  const double orig[3],
-  const double speed[3],
-  const double comp[3][3]) {
+void Frame3DTimeRotate(
+  Frame3DTime* const that,
+  const FMB_REAL axis[3],
+  const FMB_REAL theta) {
 
-  // Create the new Frame
-  Frame3DTime that;
-  that.type = type;
+  // If the rotation is null, nothing to do
+  if (theta == 0.0) {
+
+    return;
+
+  }
+
+  // Get the rotation matrix
+  FMB_REAL rot[3][3];
+  GetRotMatrix3D(
+    axis,
+    theta,
+    rot);
+
+  // Rotate the components
+  FMB_REAL (*tc)[3] = that->comp;
   for (
-    int iAxis = 3;
-    iAxis--;) {
+    int iComp = 3;
+    iComp--;) {
 
-    that.orig[iAxis] = orig[iAxis];
-    that.speed[iAxis] = speed[iAxis];
+    FMB_REAL v[3] = {tc[iComp][0], tc[iComp][1], tc[iComp][2]};
 
     for (
-      int iComp = 3;
-      iComp--;) {
+      int i = 3;
+      i--;) {
 
-      that.comp[iComp][iAxis] = comp[iComp][iAxis];
+      tc[iComp][i] =
+        rot[i][0] * v[0] + rot[i][1] * v[1] + rot[i][2] * v[2];
 
     }
 
   }
 
-  // Create the bounding box
-  for (
-    int iAxis = 3;
-    iAxis--;) {
+  // Update the bounding box and the inverse matrix
+  Frame3DTimeUpdateBdgBox(that);
+  Frame3DTimeUpdateInv(that);
+
+}
+
+// Set the components of the Frame that to comp ([iComp][iAxis])
+// The bounding box and inverse components are updated only if comp
+// differs from the current components
+void Frame2DSetComp(
+  Frame2D* const that,
+  const FMB_REAL comp[2][2]) {
 
-    double min = orig[iAxis];
-    double max = orig[iAxis];
+  // Copy the new components and check if they differ from the
+  // current ones
+  bool hasChanged = false;
+  for (
+    int iComp = 2;
+    iComp--;) {
 
     for (
-      int iComp = 3;
-      iComp--;) {
+      int iAxis = 2;
+      iAxis--;) {
 
-      if (that.type == FrameCuboid) {
+      if (that->comp[iComp][iAxis] != comp[iComp][iAxis]) {
 
-        if (that.comp[iComp][iAxis] < 0.0) {
+        that->comp[iComp][iAxis] = comp[iComp][iAxis];
+        hasChanged = true;
 
-          min += that.comp[iComp][iAxis];
+      }
 
-        }
+    }
 
-        if (that.comp[iComp][iAxis] > 0.0) {
+  }
 
-          max += that.comp[iComp][iAxis];
+  // If the components have changed
+  if (hasChanged == true) {
 
-        }
+    // Update the bounding box and the inverse matrix
+    Frame2DUpdateBdgBox(that);
+    Frame2DUpdateInv(that);
 
-      } else if (that.type == FrameTetrahedron) {
+  }
 
-        if (
-          that.comp[iComp][iAxis] < 0.0 &&
-          min > orig[iAxis] + that.comp[iComp][iAxis]) {
+}
 
-          min = orig[iAxis] + that.comp[iComp][iAxis];
+void Frame3DSetComp(
+  Frame3D* const that,
+  const FMB_REAL comp[3][3]) {
 
-        }
+  // Copy the new components and check if they differ from the
+  // current ones
+  bool hasChanged = false;
+  for (
+    int iComp = 3;
+    iComp--;) {
 
-        if (
-          that.comp[iComp][iAxis] > 0.0 &&
-          max < orig[iAxis] + that.comp[iComp][iAxis]) {
+    for (
+      int iAxis = 3;
+      iAxis--;) {
 
-          max = orig[iAxis] + that.comp[iComp][iAxis];
+      if (that->comp[iComp][iAxis] != comp[iComp][iAxis]) {
 
-        }
+        that->comp[iComp][iAxis] = comp[iComp][iAxis];
+        hasChanged = true;
 
       }
 
     }
 
-    if (that.speed[iAxis] < 0.0) {
+  }
 
-      min += that.speed[iAxis];
+  // If the components have changed
+  if (hasChanged == true) {
 
-    }
+    // Update the bounding box and the inverse matrix
+    Frame3DUpdateBdgBox(that);
+    Frame3DUpdateInv(that);
 
-    if (that.speed[iAxis] > 0.0) {
+  }
+
+}
 
-      max += that.speed[iAxis];
+void Frame2DTimeSetComp(
+  Frame2DTime* const that,
+  const FMB_REAL comp[2][2]) {
 
-    }
+  // Copy the new components and check if they differ from the
+  // current ones
+  bool hasChanged = false;
+  for (
+    int iComp = 2;
+    iComp--;) {
+
+    for (
+      int iAxis = 2;
+      iAxis--;) {
+
+      if (that->comp[iComp][iAxis] != comp[iComp][iAxis]) {
 
-    that.bdgBox.min[iAxis] = min;
-    that.bdgBox.max[iAxis] = max;
+        that->comp[iComp][iAxis] = comp[iComp][iAxis];
+        hasChanged = true;
+
+      }
+
+    }
 
   }
 
-  that.bdgBox.min[3] = 0.0;
-  that.bdgBox.max[3] = 1.0;
+  // If the components have changed
+  if (hasChanged == true) {
 
-  // Calculate the inverse matrix
-  Frame3DTimeUpdateInv(&that);
+    // Update the bounding box and the inverse matrix
+    Frame2DTimeUpdateBdgBox(that);
+    Frame2DTimeUpdateInv(that);
 
-  // Return the new Frame
-  return that;
+  }
 
 }
 
-// Update the inverse components of the Frame that
-static inline void Frame2DUpdateInv(Frame2D* const that) {
+void Frame3DTimeSetComp(
+  Frame3DTime* const that,
+  const FMB_REAL comp[3][3]) {
 
-  // Shortcuts
-  double (*tc)[2] = that->comp;
-  double (*tic)[2] = that->invComp;
+  // Copy the new components and check if they differ from the
+  // current ones
+  bool hasChanged = false;
+  for (
+    int iComp = 3;
+    iComp--;) {
 
-  double det = tc[0][0] * tc[1][1] - tc[1][0] * tc[0][1];
-  /*if (fabs(det) < EPSILON) {
+    for (
+      int iAxis = 3;
+      iAxis--;) {
 
-    fprintf(
-      stderr,
-      "FrameUpdateInv: det == 0.0\n");
-    exit(1);
+      if (that->comp[iComp][iAxis] != comp[iComp][iAxis]) {
 
-  }*/
+        that->comp[iComp][iAxis] = comp[iComp][iAxis];
+        hasChanged = true;
+
+      }
+
+    }
+
+  }
+
+  // If the components have changed
+  if (hasChanged == true) {
+
+    // Update the bounding box and the inverse matrix
+    Frame3DTimeUpdateBdgBox(that);
+    Frame3DTimeUpdateInv(that);
+
+  }
+
+}
+
+// Set the origin and speed of the moving Frame that to orig and speed
+// The components are not modified, so the inverse components are
+// kept as is and only the bounding box is updated
+void Frame2DTimeSetMotion(
+  Frame2DTime* const that,
+  const FMB_REAL orig[2],
+  const FMB_REAL speed[2]) {
+
+  // Set the origin and the speed
+  for (
+    int iAxis = 2;
+    iAxis--;) {
+
+    that->orig[iAxis] = orig[iAxis];
+    that->speed[iAxis] = speed[iAxis];
+
+  }
+
+  // Update the bounding box
+  Frame2DTimeUpdateBdgBox(that);
+
+}
+
+void Frame3DTimeSetMotion(
+  Frame3DTime* const that,
+  const FMB_REAL orig[3],
+  const FMB_REAL speed[3]) {
+
+  // Set the origin and the speed
+  for (
+    int iAxis = 3;
+    iAxis--;) {
+
+    that->orig[iAxis] = orig[iAxis];
+    that->speed[iAxis] = speed[iAxis];
+
+  }
+
+  // Update the bounding box
+  Frame3DTimeUpdateBdgBox(that);
+
+}
+
+// Get the rotation matrix rot ([iRow][iCol]) of angle theta around
+// the axis 'axis'
+static inline void GetRotMatrix3D(
+  const FMB_REAL axis[3],
+  const FMB_REAL theta,
+  FMB_REAL rot[3][3]) {
+
+  // Normalize the axis
+  FMB_REAL l =
+    sqrt(
+      axis[0] * axis[0] +
+      axis[1] * axis[1] +
+      axis[2] * axis[2]);
+  FMB_REAL x = axis[0] / l;
+  FMB_REAL y = axis[1] / l;
+  FMB_REAL z = axis[2] / l;
+
+  // Rodrigues' rotation formula
+  FMB_REAL c = cos(theta);
+  FMB_REAL s = sin(theta);
+  FMB_REAL t = 1.0 - c;
+  rot[0][0] = t * x * x + c;
+  rot[0][1] = t * x * y - s * z;
+  rot[0][2] = t * x * z + s * y;
+  rot[1][0] = t * x * y + s * z;
+  rot[1][1] = t * y * y + c;
+  rot[1][2] = t * y * z - s * x;
+  rot[2][0] = t * x * z - s * y;
+  rot[2][1] = t * y * z + s * x;
+  rot[2][2] = t * z * z + c;
+
+}
+
+// Update the inverse components of the Frame that
+static inline void Frame2DUpdateInv(Frame2D* const that) {
+
+  // Shortcuts
+  FMB_REAL (*tc)[2] = that->comp;
+  FMB_REAL (*tic)[2] = that->invComp;
+
+  FMB_REAL det = tc[0][0] * tc[1][1] - tc[1][0] * tc[0][1];
+  /*if (fabs(det) < EPSILON) {
+
+    fprintf(
+      stderr,
+      "FrameUpdateInv: det == 0.0\n");
+    exit(1);
+
+  }*/
 
   tic[0][0] = tc[1][1] / det;
   tic[0][1] = -tc[0][1] / det;
@@ -437,11 +775,11 @@ static inline void Frame2DUpdateInv(Frame2D* const that) {
 static inline void Frame3DUpdateInv(Frame3D* const that) {
 
   // Shortcuts
-  double (*tc)[3] = that->comp;
-  double (*tic)[3] = that->invComp;
+  FMB_REAL (*tc)[3] = that->comp;
+  FMB_REAL (*tic)[3] = that->invComp;
 
   // Update the inverse components
-  double det =
+  FMB_REAL det =
     tc[0][0] * (tc[1][1] * tc[2][2] - tc[1][2] * tc[2][1]) -
     tc[1][0] * (tc[0][1] * tc[2][2] - tc[0][2] * tc[2][1]) +
     tc[2][0] * (tc[0][1] * tc[1][2] - tc[0][2] * tc[1][1]);
@@ -470,10 +808,10 @@ static inline void Frame3DUpdateInv(Frame3D* const that) {
 static inline void Frame2DTimeUpdateInv(Frame2DTime* const that) {
 
   // Shortcuts
-  double (*tc)[2] = that->comp;
-  double (*tic)[2] = that->invComp;
+  FMB_REAL (*tc)[2] = that->comp;
+  FMB_REAL (*tic)[2] = that->invComp;
 
-  double det = tc[0][0] * tc[1][1] - tc[1][0] * tc[0][1];
+  FMB_REAL det = tc[0][0] * tc[1][1] - tc[1][0] * tc[0][1];
   /*if (fabs(det) < EPSILON) {
 
     fprintf(
@@ -493,11 +831,11 @@ static inline void Frame2DTimeUpdateInv(Frame2DTime* const that) {
 static inline void Frame3DTimeUpdateInv(Frame3DTime* const that) {
 
   // Shortcuts
-  double (*tc)[3] = that->comp;
-  double (*tic)[3] = that->invComp;
+  FMB_REAL (*tc)[3] = that->comp;
+  FMB_REAL (*tic)[3] = that->invComp;
 
   // Update the inverse components
-  double det =
+  FMB_REAL det =
     tc[0][0] * (tc[1][1] * tc[2][2] - tc[1][2] * tc[2][1]) -
     tc[1][0] * (tc[0][1] * tc[2][2] - tc[0][2] * tc[2][1]) +
     tc[2][0] * (tc[0][1] * tc[1][2] - tc[0][2] * tc[1][1]);
@@ -522,27 +860,279 @@ static inline void Frame3DTimeUpdateInv(Frame3DTime* const that) {
 
 }
 
+// Update the bounding box of the Frame that
+static inline void Frame2DUpdateBdgBox(Frame2D* const that) {
+
+  for (
+    int iAxis = 2;
+    iAxis--;) {
+
+    FMB_REAL min = that->orig[iAxis];
+    FMB_REAL max = that->orig[iAxis];
+
+    for (
+      int iComp = 2;
+      iComp--;) {
+
+      if (that->type == FrameCuboid) {
+
+        if (that->comp[iComp][iAxis] < 0.0) {
+
+          min += that->comp[iComp][iAxis];
+
+        }
+
+        if (that->comp[iComp][iAxis] > 0.0) {
+
+          max += that->comp[iComp][iAxis];
+
+        }
+
+      } else if (that->type == FrameTetrahedron) {
+
+        if (
+          that->comp[iComp][iAxis] < 0.0 &&
+          min > that->orig[iAxis] + that->comp[iComp][iAxis]) {
+
+          min = that->orig[iAxis] + that->comp[iComp][iAxis];
+
+        }
+
+        if (
+          that->comp[iComp][iAxis] > 0.0 &&
+          max < that->orig[iAxis] + that->comp[iComp][iAxis]) {
+
+          max = that->orig[iAxis] + that->comp[iComp][iAxis];
+
+        }
+
+      }
+
+    }
+
+    that->bdgBox.min[iAxis] = min;
+    that->bdgBox.max[iAxis] = max;
+
+  }
+
+}
+
+static inline void Frame3DUpdateBdgBox(Frame3D* const that) {
+
+  for (
+    int iAxis = 3;
+    iAxis--;) {
+
+    FMB_REAL min = that->orig[iAxis];
+    FMB_REAL max = that->orig[iAxis];
+
+    for (
+      int iComp = 3;
+      iComp--;) {
+
+      if (that->type == FrameCuboid) {
+
+        if (that->comp[iComp][iAxis] < 0.0) {
+
+          min += that->comp[iComp][iAxis];
+
+        }
+
+        if (that->comp[iComp][iAxis] > 0.0) {
+
+          max += that->comp[iComp][iAxis];
+
+        }
+
+      } else if (that->type == FrameTetrahedron) {
+
+        if (
+          that->comp[iComp][iAxis] < 0.0 &&
+          min > that->orig[iAxis] + that->comp[iComp][iAxis]) {
+
+          min = that->orig[iAxis] + that->comp[iComp][iAxis];
+
+        }
+
+        if (
+          that->comp[iComp][iAxis] > 0.0 &&
+          max < that->orig[iAxis] + that->comp[iComp][iAxis]) {
+
+          max = that->orig[iAxis] + that->comp[iComp][iAxis];
+
+        }
+
+      }
+
+    }
+
+    that->bdgBox.min[iAxis] = min;
+    that->bdgBox.max[iAxis] = max;
+
+  }
+
+}
+
+static inline void Frame2DTimeUpdateBdgBox(Frame2DTime* const that) {
+
+  for (
+    int iAxis = 2;
+    iAxis--;) {
+
+    FMB_REAL min = that->orig[iAxis];
+    FMB_REAL max = that->orig[iAxis];
+
+    for (
+      int iComp = 2;
+      iComp--;) {
+
+      if (that->type == FrameCuboid) {
+
+        if (that->comp[iComp][iAxis] < 0.0) {
+
+          min += that->comp[iComp][iAxis];
+
+        }
+
+        if (that->comp[iComp][iAxis] > 0.0) {
+
+          max += that->comp[iComp][iAxis];
+
+        }
+
+      } else if (that->type == FrameTetrahedron) {
+
+        if (
+          that->comp[iComp][iAxis] < 0.0 &&
+          min > that->orig[iAxis] + that->comp[iComp][iAxis]) {
+
+          min = that->orig[iAxis] + that->comp[iComp][iAxis];
+
+        }
+
+        if (
+          that->comp[iComp][iAxis] > 0.0 &&
+          max < that->orig[iAxis] + that->comp[iComp][iAxis]) {
+
+          max = that->orig[iAxis] + that->comp[iComp][iAxis];
+
+        }
+
+      }
+
+    }
+
+    if (that->speed[iAxis] < 0.0) {
+
+      min += that->speed[iAxis];
+
+    }
+
+    if (that->speed[iAxis] > 0.0) {
+
+      max += that->speed[iAxis];
+
+    }
+
+    that->bdgBox.min[iAxis] = min;
+    that->bdgBox.max[iAxis] = max;
+
+  }
+
+  that->bdgBox.min[2] = 0.0;
+  that->bdgBox.max[2] = 1.0;
+
+}
+
+static inline void Frame3DTimeUpdateBdgBox(Frame3DTime* const that) {
+
+  for (
+    int iAxis = 3;
+    iAxis--;) {
+
+    FMB_REAL min = that->orig[iAxis];
+    FMB_REAL max = that->orig[iAxis];
+
+    for (
+      int iComp = 3;
+      iComp--;) {
+
+      if (that->type == FrameCuboid) {
+
+        if (that->comp[iComp][iAxis] < 0.0) {
+
+          min += that->comp[iComp][iAxis];
+
+        }
+
+        if (that->comp[iComp][iAxis] > 0.0) {
+
+          max += that->comp[iComp][iAxis];
+
+        }
+
+      } else if (that->type == FrameTetrahedron) {
+
+        if (
+          that->comp[iComp][iAxis] < 0.0 &&
+          min > that->orig[iAxis] + that->comp[iComp][iAxis]) {
+
+          min = that->orig[iAxis] + that->comp[iComp][iAxis];
+
+        }
+
+        if (
+          that->comp[iComp][iAxis] > 0.0 &&
+          max < that->orig[iAxis] + that->comp[iComp][iAxis]) {
+
+          max = that->orig[iAxis] + that->comp[iComp][iAxis];
+
+        }
+
+      }
+
+    }
+
+    if (that->speed[iAxis] < 0.0) {
+
+      min += that->speed[iAxis];
+
+    }
+
+    if (that->speed[iAxis] > 0.0) {
+
+      max += that->speed[iAxis];
+
+    }
+
+    that->bdgBox.min[iAxis] = min;
+    that->bdgBox.max[iAxis] = max;
+
+  }
+
+  that->bdgBox.min[3] = 0.0;
+  that->bdgBox.max[3] = 1.0;
+
+}
+
 // Project the Frame Q in the Frame P's coordinates system and
 // memorize the result in the Frame Qp
-void Frame2DImportFrame(
-  Frame2D* const P,
+static void Frame2DImportFrameGeneric(
+  const Frame2D* const P,
   const Frame2D* const Q,
   Frame2D* const Qp) {
 
-  // Update the inverse matrix of P
-  Frame2DUpdateInv(P);
-
   // Shortcuts
-  const double*  qo  = Q->orig;
-  double*  qpo = Qp->orig;
-  const double*  po  = P->orig;
+  const FMB_REAL*  qo  = Q->orig;
+  FMB_REAL*  qpo = Qp->orig;
+  const FMB_REAL*  po  = P->orig;
 
-  const double  (*pi)[2] = P->invComp;
-  double (*qpc)[2] = Qp->comp;
-  const double  (*qc)[2] = Q->comp;
+  const FMB_REAL  (*pi)[2] = P->invComp;
+  FMB_REAL (*qpc)[2] = Qp->comp;
+  const FMB_REAL  (*qc)[2] = Q->comp;
 
   // Calculate the projection
-  double v[2];
+  FMB_REAL v[2];
   for (
     int i = 2;
     i--;) {
@@ -578,25 +1168,22 @@ void Frame2DImportFrame(
 
 }
 
-void Frame3DImportFrame(
-  Frame3D* const P,
+static void Frame3DImportFrameGeneric(
+  const Frame3D* const P,
   const Frame3D* const Q,
   Frame3D* const Qp) {
 
-  // Update the inverse matrix of P
-  Frame3DUpdateInv(P);
-
   // Shortcuts
-  const double*  qo  = Q->orig;
-  double*  qpo = Qp->orig;
-  const double*  po  = P->orig;
+  const FMB_REAL*  qo  = Q->orig;
+  FMB_REAL*  qpo = Qp->orig;
+  const FMB_REAL*  po  = P->orig;
 
-  const double  (*pi)[3] = P->invComp;
-  double (*qpc)[3] = Qp->comp;
-  const double  (*qc)[3] = Q->comp;
+  const FMB_REAL  (*pi)[3] = P->invComp;
+  FMB_REAL (*qpc)[3] = Qp->comp;
+  const FMB_REAL  (*qc)[3] = Q->comp;
 
   // Calculate the projection
-  double v[3];
+  FMB_REAL v[3];
   for (
     int i = 3;
     i--;) {
@@ -632,30 +1219,27 @@ void Frame3DImportFrame(
 
 }
 
-void Frame2DTimeImportFrame(
-  Frame2DTime* const P,
+static void Frame2DTimeImportFrameGeneric(
+  const Frame2DTime* const P,
   const Frame2DTime* const Q,
   Frame2DTime* const Qp) {
 
-  // Update the inverse matrix of P
-  Frame2DTimeUpdateInv(P);
-
   // Shortcuts
-  const double*  qo  = Q->orig;
-  double*  qpo = Qp->orig;
-  const double*  po  = P->orig;
+  const FMB_REAL*  qo  = Q->orig;
+  FMB_REAL*  qpo = Qp->orig;
+  const FMB_REAL*  po  = P->orig;
 
-  const double*  qs  = Q->speed;
-  double*  qps = Qp->speed;
-  const double*  ps  = P->speed;
+  const FMB_REAL*  qs  = Q->speed;
+  FMB_REAL*  qps = Qp->speed;
+  const FMB_REAL*  ps  = P->speed;
 
-  const double  (*pi)[2] = P->invComp;
-  double (*qpc)[2] = Qp->comp;
-  const double  (*qc)[2] = Q->comp;
+  const FMB_REAL  (*pi)[2] = P->invComp;
+  FMB_REAL (*qpc)[2] = Qp->comp;
+  const FMB_REAL  (*qc)[2] = Q->comp;
 
   // Calculate the projection
-  double v[2];
-  double s[2];
+  FMB_REAL v[2];
+  FMB_REAL s[2];
   for (
     int i = 2;
     i--;) {
@@ -694,30 +1278,27 @@ void Frame2DTimeImportFrame(
 
 }
 
-void Frame3DTimeImportFrame(
-  Frame3DTime* const P,
+static void Frame3DTimeImportFrameGeneric(
+  const Frame3DTime* const P,
   const Frame3DTime* const Q,
   Frame3DTime* const Qp) {
 
-  // Update the inverse matrix of P
-  Frame3DTimeUpdateInv(P);
-
   // Shortcuts
-  const double*  qo  = Q->orig;
-  double*  qpo = Qp->orig;
-  const double*  po  = P->orig;
+  const FMB_REAL*  qo  = Q->orig;
+  FMB_REAL*  qpo = Qp->orig;
+  const FMB_REAL*  po  = P->orig;
 
-  const double*  qs  = Q->speed;
-  double*  qps = Qp->speed;
-  const double*  ps  = P->speed;
+  const FMB_REAL*  qs  = Q->speed;
+  FMB_REAL*  qps = Qp->speed;
+  const FMB_REAL*  ps  = P->speed;
 
-  const double  (*pi)[3] = P->invComp;
-  double (*qpc)[3] = Qp->comp;
-  const double  (*qc)[3] = Q->comp;
+  const FMB_REAL  (*pi)[3] = P->invComp;
+  FMB_REAL (*qpc)[3] = Qp->comp;
+  const FMB_REAL  (*qc)[3] = Q->comp;
 
   // Calculate the projection
-  double v[3];
-  double s[3];
+  FMB_REAL v[3];
+  FMB_REAL s[3];
   for (
     int i = 3;
     i--;) {
@@ -756,99 +1337,82 @@ void Frame3DTimeImportFrame(
 
 }
 
-// Export the AABB bdgBox from that's coordinates system to
-// the real coordinates system and update bdgBoxProj with the resulting
-// AABB
-void Frame2DExportBdgBox(
-  const Frame2D* const that,
-  const AABB2D* const bdgBox,
-  AABB2D* const bdgBoxProj) {
-
-  // Shortcuts
-  const double* to    = that->orig;
-  const double* bbmi  = bdgBox->min;
-  const double* bbma  = bdgBox->max;
-  double* bbpmi = bdgBoxProj->min;
-  double* bbpma = bdgBoxProj->max;
-
-  const double (*tc)[2] = that->comp;
+// Project the nb Frames Q in the Frame P's coordinates system and
+// memorize the results in the nb Frames Qp
+// The type, origin, components (and speed) of Qp are set, the
+// bounding box and inverse components are not
+static void Frame2DImportFramesGeneric(
+  const Frame2D* const P,
+  const Frame2D* const Q,
+  const int nb,
+  Frame2D* const Qp) {
 
-  // Initialise the coordinates of the result AABB with the projection
-  // of the first corner of the AABB in argument
+  // Copy P's origin and inverse components in local variables shared
+  // by all the projections
+  FMB_REAL po[2];
+  FMB_REAL pi[2][2];
   for (
     int i = 2;
     i--;) {
 
-    bbpma[i] = to[i];
+    po[i] = P->orig[i];
 
     for (
       int j = 2;
       j--;) {
 
-      bbpma[i] += tc[j][i] * bbmi[j];
+      pi[j][i] = P->invComp[j][i];
 
     }
 
-    bbpmi[i] = bbpma[i];
-
   }
 
-  // Loop on vertices of the AABB
-  // Skip the first vertex which is the origin already computed above
-  int nbVertices = powi(2, 2);
+  // Loop on the Frames to project
   for (
-    int iVertex = nbVertices;
-    iVertex-- && iVertex;) {
-
-    // Declare a variable to memorize the coordinates of the vertex in
-    // that's coordinates system
-    double v[2];
-
-    // Calculate the coordinates of the vertex in
-    // that's coordinates system
+    int iFrame = 0;
+    iFrame < nb;
+    ++iFrame) {
+
+    // Shortcuts
+    const FMB_REAL* qo = Q[iFrame].orig;
+    FMB_REAL* qpo = Qp[iFrame].orig;
+    const FMB_REAL (*qc)[2] = Q[iFrame].comp;
+    FMB_REAL (*qpc)[2] = Qp[iFrame].comp;
+
+    // Copy the type
+    Qp[iFrame].type = Q[iFrame].type;
+
+    // Calculate the projection, in the same order as
+    // Frame2DImportFrame to get identical results
+    FMB_REAL v[2];
     for (
       int i = 2;
       i--;) {
 
-      v[i] = ((iVertex & (1 << i)) ? bbma[i] : bbmi[i]);
+      v[i] = qo[i] - po[i];
 
     }
 
-    // Declare a variable to memorize the projected coordinates
-    // in real coordinates system
-    double w[2];
-
-    // Project the vertex to real coordinates system
     for (
       int i = 2;
       i--;) {
 
-      w[i] = to[i];
+      qpo[i] = 0.0;
 
       for (
         int j = 2;
         j--;) {
 
-        w[i] += tc[j][i] * v[j];
-
-      }
-
-    }
-
-    // Update the coordinates of the result AABB
-    for (
-      int i = 2;
-      i--;) {
-
-      if (bbpmi[i] > w[i]) {
+        qpo[i] += pi[j][i] * v[j];
+        qpc[j][i] = 0.0;
 
-        bbpmi[i] = w[i];
-
-      }
+        for (
+          int k = 2;
+          k--;) {
 
-      if (bbpma[i] < w[i]) {
+          qpc[j][i] += pi[k][i] * qc[j][k];
 
-        bbpma[i] = w[i];
+        }
 
       }
 
@@ -858,96 +1422,78 @@ void Frame2DExportBdgBox(
 
 }
 
-void Frame3DExportBdgBox(
-  const Frame3D* const that,
-  const AABB3D* const bdgBox,
-  AABB3D* const bdgBoxProj) {
-
-  // Shortcuts
-  const double* to    = that->orig;
-  const double* bbmi  = bdgBox->min;
-  const double* bbma  = bdgBox->max;
-  double* bbpmi = bdgBoxProj->min;
-  double* bbpma = bdgBoxProj->max;
-
-  const double (*tc)[3] = that->comp;
+static void Frame3DImportFramesGeneric(
+  const Frame3D* const P,
+  const Frame3D* const Q,
+  const int nb,
+  Frame3D* const Qp) {
 
-  // Initialise the coordinates of the result AABB with the projection
-  // of the first corner of the AABB in argument
+  // Copy P's origin and inverse components in local variables shared
+  // by all the projections
+  FMB_REAL po[3];
+  FMB_REAL pi[3][3];
   for (
     int i = 3;
     i--;) {
 
-    bbpma[i] = to[i];
+    po[i] = P->orig[i];
 
     for (
       int j = 3;
       j--;) {
 
-      bbpma[i] += tc[j][i] * bbmi[j];
+      pi[j][i] = P->invComp[j][i];
 
     }
 
-    bbpmi[i] = bbpma[i];
-
   }
 
-  // Loop on vertices of the AABB
-  // skip the first vertex which is the origin already computed above
-  int nbVertices = powi(2, 3);
+  // Loop on the Frames to project
   for (
-    int iVertex = nbVertices;
-    iVertex-- && iVertex;) {
-
-    // Declare a variable to memorize the coordinates of the vertex in
-    // that's coordinates system
-    double v[3];
-
-    // Calculate the coordinates of the vertex in
-    // that's coordinates system
+    int iFrame = 0;
+    iFrame < nb;
+    ++iFrame) {
+
+    // Shortcuts
+    const FMB_REAL* qo = Q[iFrame].orig;
+    FMB_REAL* qpo = Qp[iFrame].orig;
+    const FMB_REAL (*qc)[3] = Q[iFrame].comp;
+    FMB_REAL (*qpc)[3] = Qp[iFrame].comp;
+
+    // Copy the type
+    Qp[iFrame].type = Q[iFrame].type;
+
+    // Calculate the projection, in the same order as
+    // Frame3DImportFrame to get identical results
+    FMB_REAL v[3];
     for (
       int i = 3;
       i--;) {
 
-      v[i] = ((iVertex & (1 << i)) ? bbma[i] : bbmi[i]);
+      v[i] = qo[i] - po[i];
 
     }
 
-    // Declare a variable to memorize the projected coordinates
-    // in real coordinates system
-    double w[3];
-
-    // Project the vertex to real coordinates system
     for (
       int i = 3;
       i--;) {
 
-      w[i] = to[i];
+      qpo[i] = 0.0;
 
       for (
         int j = 3;
         j--;) {
 
-        w[i] += tc[j][i] * v[j];
-
-      }
-
-    }
-
-    // Update the coordinates of the result AABB
-    for (
-      int i = 3;
-      i--;) {
+        qpo[i] += pi[j][i] * v[j];
+        qpc[j][i] = 0.0;
 
-      if (bbpmi[i] > w[i]) {
-
-        bbpmi[i] = w[i];
-
-      }
+        for (
+          int k = 3;
+          k--;) {
 
-      if (bbpma[i] < w[i]) {
+          qpc[j][i] += pi[k][i] * qc[j][k];
 
-        bbpma[i] = w[i];
+        }
 
       }
 
@@ -957,96 +1503,94 @@ void Frame3DExportBdgBox(
 
 }
 
-void Frame3DFaceExportBdgBox(
-  const Frame3D* const that,
-  const AABB2D* const bdgBox,
-  AABB3D* const bdgBoxProj) {
-
-  // Shortcuts
-  const double* to    = that->orig;
-  const double* bbmi  = bdgBox->min;
-  const double* bbma  = bdgBox->max;
-  double* bbpmi = bdgBoxProj->min;
-  double* bbpma = bdgBoxProj->max;
-
-  const double (*tc)[3] = that->comp;
+static void Frame2DTimeImportFramesGeneric(
+  const Frame2DTime* const P,
+  const Frame2DTime* const Q,
+  const int nb,
+  Frame2DTime* const Qp) {
 
-  // Initialise the coordinates of the result AABB with the projection
-  // of the first corner of the AABB in argument
+  // Copy P's origin and inverse components in local variables shared
+  // by all the projections
+  FMB_REAL po[2];
+  FMB_REAL pi[2][2];
   for (
-    int i = 3;
+    int i = 2;
     i--;) {
 
-    bbpma[i] = to[i];
+    po[i] = P->orig[i];
 
     for (
       int j = 2;
       j--;) {
 
-      bbpma[i] += tc[j][i] * bbmi[j];
+      pi[j][i] = P->invComp[j][i];
 
     }
 
-    bbpmi[i] = bbpma[i];
-
   }
 
-  // Loop on vertices of the AABB
-  // skip the first vertex which is the origin already computed above
-  int nbVertices = powi(2, 3);
+  // Copy P's speed in local variables shared by all the projections
+  FMB_REAL ps[2];
   for (
-    int iVertex = nbVertices;
-    iVertex-- && iVertex;) {
+    int i = 2;
+    i--;) {
 
-    // Declare a variable to memorize the coordinates of the vertex in
-    // that's coordinates system
-    double v[3];
+    ps[i] = P->speed[i];
 
-    // Calculate the coordinates of the vertex in
-    // that's coordinates system
+  }
+
+  // Loop on the Frames to project
+  for (
+    int iFrame = 0;
+    iFrame < nb;
+    ++iFrame) {
+
+    // Shortcuts
+    const FMB_REAL* qo = Q[iFrame].orig;
+    FMB_REAL* qpo = Qp[iFrame].orig;
+    const FMB_REAL* qs = Q[iFrame].speed;
+    FMB_REAL* qps = Qp[iFrame].speed;
+    const FMB_REAL (*qc)[2] = Q[iFrame].comp;
+    FMB_REAL (*qpc)[2] = Qp[iFrame].comp;
+
+    // Copy the type
+    Qp[iFrame].type = Q[iFrame].type;
+
+    // Calculate the projection, in the same order as
+    // Frame2DTimeImportFrame to get identical results
+    FMB_REAL v[2];
+    FMB_REAL s[2];
     for (
       int i = 2;
       i--;) {
 
-      v[i] = ((iVertex & (1 << i)) ? bbma[i] : bbmi[i]);
+      v[i] = qo[i] - po[i];
+      s[i] = qs[i] - ps[i];
 
     }
 
-    // Declare a variable to memorize the projected coordinates
-    // in real coordinates system
-    double w[3];
-
-    // Project the vertex to real coordinates system
     for (
-      int i = 3;
+      int i = 2;
       i--;) {
 
-      w[i] = to[i];
+      qpo[i] = 0.0;
+      qps[i] = 0.0;
 
       for (
         int j = 2;
         j--;) {
 
-        w[i] += tc[j][i] * v[j];
-
-      }
-
-    }
-
-    // Update the coordinates of the result AABB
-    for (
-      int i = 3;
-      i--;) {
-
-      if (bbpmi[i] > w[i]) {
-
-        bbpmi[i] = w[i];
+        qpo[i] += pi[j][i] * v[j];
+        qps[i] += pi[j][i] * s[j];
+        qpc[j][i] = 0.0;
 
-      }
+        for (
+          int k = 2;
+          k--;) {
 
-      if (bbpma[i] < w[i]) {
+          qpc[j][i] += pi[k][i] * qc[j][k];
 
-        bbpma[i] = w[i];
+        }
 
       }
 
@@ -1056,618 +1600,2183 @@ void Frame3DFaceExportBdgBox(
 
 }
 
-void Frame2DTimeExportBdgBox(
-  const Frame2DTime* const that,
-  const AABB2DTime* const bdgBox,
-  AABB2DTime* const bdgBoxProj) {
-
-  // Shortcuts
-  const double* to    = that->orig;
-  const double* ts    = that->speed;
-  const double* bbmi  = bdgBox->min;
-  const double* bbma  = bdgBox->max;
-  double* bbpmi = bdgBoxProj->min;
-  double* bbpma = bdgBoxProj->max;
-  const double (*tc)[2] = that->comp;
-
-  // The time component is not affected
-  bbpmi[2] = bbmi[2];
-  bbpma[2] = bbma[2];
+static void Frame3DTimeImportFramesGeneric(
+  const Frame3DTime* const P,
+  const Frame3DTime* const Q,
+  const int nb,
+  Frame3DTime* const Qp) {
 
-  // Initialise the coordinates of the result AABB with the projection
-  // of the first corner of the AABB in argument
+  // Copy P's origin and inverse components in local variables shared
+  // by all the projections
+  FMB_REAL po[3];
+  FMB_REAL pi[3][3];
   for (
-    int i = 2;
+    int i = 3;
     i--;) {
 
-    bbpma[i] = to[i] + ts[i] * bbmi[2];
+    po[i] = P->orig[i];
 
     for (
-      int j = 2;
+      int j = 3;
       j--;) {
 
-      bbpma[i] += tc[j][i] * bbmi[j];
+      pi[j][i] = P->invComp[j][i];
 
     }
 
-    bbpmi[i] = bbpma[i];
-
   }
 
-  // Loop on vertices of the AABB
-  // skip the first vertex which is the origin already computed above
-  int nbVertices = powi(2, 2);
+  // Copy P's speed in local variables shared by all the projections
+  FMB_REAL ps[3];
   for (
-    int iVertex = nbVertices;
-    iVertex-- && iVertex;) {
+    int i = 3;
+    i--;) {
 
-    // Declare a variable to memorize the coordinates of the vertex in
-    // 'that' 's coordinates system
-    double v[2];
+    ps[i] = P->speed[i];
 
-    // Calculate the coordinates of the vertex in
-    // 'that' 's coordinates system
+  }
+
+  // Loop on the Frames to project
+  for (
+    int iFrame = 0;
+    iFrame < nb;
+    ++iFrame) {
+
+    // Shortcuts
+    const FMB_REAL* qo = Q[iFrame].orig;
+    FMB_REAL* qpo = Qp[iFrame].orig;
+    const FMB_REAL* qs = Q[iFrame].speed;
+    FMB_REAL* qps = Qp[iFrame].speed;
+    const FMB_REAL (*qc)[3] = Q[iFrame].comp;
+    FMB_REAL (*qpc)[3] = Qp[iFrame].comp;
+
+    // Copy the type
+    Qp[iFrame].type = Q[iFrame].type;
+
+    // Calculate the projection, in the same order as
+    // Frame3DTimeImportFrame to get identical results
+    FMB_REAL v[3];
+    FMB_REAL s[3];
     for (
-      int i = 2;
+      int i = 3;
       i--;) {
 
-      v[i] = ((iVertex & (1 << i)) ? bbma[i] : bbmi[i]);
+      v[i] = qo[i] - po[i];
+      s[i] = qs[i] - ps[i];
 
     }
 
-    // Declare a variable to memorize the projected coordinates
-    // in real coordinates system
-    double w[2];
-
-    // Project the vertex to real coordinates system
     for (
-      int i = 2;
+      int i = 3;
       i--;) {
 
-      w[i] = to[i];
+      qpo[i] = 0.0;
+      qps[i] = 0.0;
 
       for (
-        int j = 2;
+        int j = 3;
         j--;) {
 
-        w[i] += tc[j][i] * v[j];
-
-      }
-
-    }
+        qpo[i] += pi[j][i] * v[j];
+        qps[i] += pi[j][i] * s[j];
+        qpc[j][i] = 0.0;
 
-    // Update the coordinates of the result AABB
-    for (
-      int i = 2;
-      i--;) {
+        for (
+          int k = 3;
+          k--;) {
 
-      if (bbpmi[i] > w[i] + ts[i] * bbmi[2]) {
+          qpc[j][i] += pi[k][i] * qc[j][k];
 
-        bbpmi[i] = w[i] + ts[i] * bbmi[2];
+        }
 
       }
 
-      if (bbpmi[i] > w[i] + ts[i] * bbma[2]) {
+    }
 
-        bbpmi[i] = w[i] + ts[i] * bbma[2];
+  }
 
-      }
+}
 
-      if (bbpma[i] < w[i] + ts[i] * bbmi[2]) {
+// Create a Frame3DSoA able to memorize nb Frames, all set to null
+// Frames of type FrameCuboid
+Frame3DSoA* Frame3DSoACreate(const int nb) {
 
-        bbpma[i] = w[i] + ts[i] * bbmi[2];
+  // Allocate memory for the structure
+  Frame3DSoA* that = malloc(sizeof(Frame3DSoA));
+  if (that == NULL) {
 
-      }
+    printf("Frame3DSoACreate: failed to allocate memory\n");
+    exit(0);
 
-      if (bbpma[i] < w[i] + ts[i] * bbma[2]) {
+  }
 
-        bbpma[i] = w[i] + ts[i] * bbma[2];
+  // Set the number of Frames, padded to a multiple of FRAME_SOA_PAD
+  // so the vectorized functions never have to process a partial group
+  // of Frames
+  that->nb = nb;
+  that->nbPad =
+    ((nb + FRAME_SOA_PAD - 1) / FRAME_SOA_PAD) * FRAME_SOA_PAD;
 
-      }
+  // Allocate one aligned block of memory for all the FMB_REAL arrays
+  // The size of each array is a multiple of FRAME_SOA_ALIGN bytes
+  // given that nbPad is a multiple of FRAME_SOA_PAD
+  size_t sizeArr = sizeof(FMB_REAL) * (size_t)(that->nbPad);
+  size_t sizeData = sizeArr * FRAME_SOA_NB_ARRAYS;
+  if (sizeData == 0) {
 
-    }
+    sizeData = FRAME_SOA_ALIGN;
 
   }
 
-}
+  that->data = aligned_alloc(FRAME_SOA_ALIGN, sizeData);
+  that->type = malloc(sizeof(FrameType) * (that->nbPad + 1));
+  that->isFace = malloc(sizeof(bool) * (that->nbPad + 1));
+  if (
+    that->data == NULL ||
+    that->type == NULL ||
+    that->isFace == NULL) {
 
-void Frame3DTimeExportBdgBox(
-  const Frame3DTime* const that,
-  const AABB3DTime* const bdgBox,
-  AABB3DTime* const bdgBoxProj) {
+    printf("Frame3DSoACreate: failed to allocate memory\n");
+    exit(0);
 
-  // Shortcuts
-  const double* to    = that->orig;
-  const double* ts    = that->speed;
-  const double* bbmi  = bdgBox->min;
-  const double* bbma  = bdgBox->max;
-  double* bbpmi = bdgBoxProj->min;
-  double* bbpma = bdgBoxProj->max;
-  const double (*tc)[3] = that->comp;
+  }
 
-  // The time component is not affected
-  bbpmi[3] = bbmi[3];
-  bbpma[3] = bbma[3];
+  memset(that->data, 0, sizeData);
+  memset(that->isFace, 0, sizeof(bool) * (that->nbPad + 1));
+  for (
+    int iFrame = that->nbPad;
+    iFrame--;) {
 
-  // Initialise the coordinates of the result AABB with the projection
-  // of the first corner of the AABB in argument
+    that->type[iFrame] = FrameCuboid;
+
+  }
+
+  // Set the pointers to the arrays in the block
+  FMB_REAL* arr = that->data;
   for (
     int i = 3;
     i--;) {
 
-    bbpma[i] = to[i] + ts[i] * bbmi[3];
+    that->orig[i] = arr;
+    arr += that->nbPad;
+    that->bdgBoxMin[i] = arr;
+    arr += that->nbPad;
+    that->bdgBoxMax[i] = arr;
+    arr += that->nbPad;
 
     for (
       int j = 3;
       j--;) {
 
-      bbpma[i] += tc[j][i] * bbmi[j];
+      that->comp[i][j] = arr;
+      arr += that->nbPad;
+      that->invComp[i][j] = arr;
+      arr += that->nbPad;
 
     }
 
-    bbpmi[i] = bbpma[i];
-
   }
 
-  // Loop on vertices of the AABB
-  // skip the first vertex which is the origin already computed above
-  int nbVertices = powi(2, 3);
-  for (
-    int iVertex = nbVertices;
-    iVertex-- && iVertex;) {
+  // Return the new Frame3DSoA
+  return that;
 
-    // Declare a variable to memorize the coordinates of the vertex in
-    // that's coordinates system
-    double v[3];
+}
 
-    // Calculate the coordinates of the vertex in
-    // that's coordinates system
-    for (
-      int i = 3;
-      i--;) {
+// Free the memory used by the Frame3DSoA that
+void Frame3DSoAFree(Frame3DSoA** that) {
 
-      v[i] = ((iVertex & (1 << i)) ? bbma[i] : bbmi[i]);
+  if (that == NULL || *that == NULL) {
 
-    }
+    return;
 
-    // Declare a variable to memorize the projected coordinates
-    // in real coordinates system
-    double w[3];
+  }
 
-    // Project the vertex to real coordinates system
-    for (
-      int i = 3;
-      i--;) {
+  free((*that)->data);
+  free((*that)->type);
+  free((*that)->isFace);
+  free(*that);
+  *that = NULL;
+
+}
+
+// Copy the Frame frame into the iFrame-th Frame of the Frame3DSoA that
+void Frame3DSoASet(
+  Frame3DSoA* const that,
+  const int iFrame,
+  const Frame3D* const frame) {
+
+  that->type[iFrame] = frame->type;
+  that->isFace[iFrame] = frame->isFace;
+
+  for (
+    int i = 3;
+    i--;) {
+
+    that->orig[i][iFrame] = frame->orig[i];
+    that->bdgBoxMin[i][iFrame] = frame->bdgBox.min[i];
+    that->bdgBoxMax[i][iFrame] = frame->bdgBox.max[i];
+
+    for (
+      int j = 3;
+      j--;) {
+
+      that->comp[i][j][iFrame] = frame->comp[i][j];
+      that->invComp[i][j][iFrame] = frame->invComp[i][j];
+
+    }
+
+  }
+
+}
+
+// Copy the iFrame-th Frame of the Frame3DSoA that into the Frame frame
+void Frame3DSoAGet(
+  const Frame3DSoA* const that,
+  const int iFrame,
+  Frame3D* const frame) {
+
+  frame->type = that->type[iFrame];
+  frame->isFace = that->isFace[iFrame];
+
+  for (
+    int i = 3;
+    i--;) {
+
+    frame->orig[i] = that->orig[i][iFrame];
+    frame->bdgBox.min[i] = that->bdgBoxMin[i][iFrame];
+    frame->bdgBox.max[i] = that->bdgBoxMax[i][iFrame];
+
+    for (
+      int j = 3;
+      j--;) {
+
+      frame->comp[i][j] = that->comp[i][j][iFrame];
+      frame->invComp[i][j] = that->invComp[i][j][iFrame];
+
+    }
+
+  }
+
+}
+
+// Implementations of Frame3DSoAImportFrames for each FrameCPUPath,
+// vectorized on the width of the path (cf framesimd.h)
+#define FRAME_SIMD_PATH FRAME_SIMD_GENERIC
+#include "framesoasimd.h"
+#define FRAME_SIMD_PATH FRAME_SIMD_SSE2
+#include "framesoasimd.h"
+#define FRAME_SIMD_PATH FRAME_SIMD_AVX2
+#include "framesoasimd.h"
+#define FRAME_SIMD_PATH FRAME_SIMD_AVX512
+#include "framesoasimd.h"
+
+// Implementations of the projections for each FrameCPUPath
+FRAME_CPU_VARIANTS_VOID(
+  Frame2DImportFrame,
+  (
+    const Frame2D* const P,
+    const Frame2D* const Q,
+    Frame2D* const Qp),
+  (P, Q, Qp))
+FRAME_CPU_VARIANTS_VOID(
+  Frame3DImportFrame,
+  (
+    const Frame3D* const P,
+    const Frame3D* const Q,
+    Frame3D* const Qp),
+  (P, Q, Qp))
+FRAME_CPU_VARIANTS_VOID(
+  Frame2DTimeImportFrame,
+  (
+    const Frame2DTime* const P,
+    const Frame2DTime* const Q,
+    Frame2DTime* const Qp),
+  (P, Q, Qp))
+FRAME_CPU_VARIANTS_VOID(
+  Frame3DTimeImportFrame,
+  (
+    const Frame3DTime* const P,
+    const Frame3DTime* const Q,
+    Frame3DTime* const Qp),
+  (P, Q, Qp))
+FRAME_CPU_VARIANTS_VOID(
+  Frame2DImportFrames,
+  (
+    const Frame2D* const P,
+    const Frame2D* const Q,
+    const int nb,
+    Frame2D* const Qp),
+  (P, Q, nb, Qp))
+FRAME_CPU_VARIANTS_VOID(
+  Frame3DImportFrames,
+  (
+    const Frame3D* const P,
+    const Frame3D* const Q,
+    const int nb,
+    Frame3D* const Qp),
+  (P, Q, nb, Qp))
+FRAME_CPU_VARIANTS_VOID(
+  Frame2DTimeImportFrames,
+  (
+    const Frame2DTime* const P,
+    const Frame2DTime* const Q,
+    const int nb,
+    Frame2DTime* const Qp),
+  (P, Q, nb, Qp))
+FRAME_CPU_VARIANTS_VOID(
+  Frame3DTimeImportFrames,
+  (
+    const Frame3DTime* const P,
+    const Frame3DTime* const Q,
+    const int nb,
+    Frame3DTime* const Qp),
+  (P, Q, nb, Qp))
+
+// Dispatch tables of the projections, [FrameCPUPath]
+static void (* const frame2DImportFrameCPU[FrameCPUNb])(
+  const Frame2D* const,
+  const Frame2D* const,
+  Frame2D* const) = {
+
+  Frame2DImportFrameGeneric,
+  Frame2DImportFrameSSE2,
+  Frame2DImportFrameAVX2,
+  Frame2DImportFrameAVX512
+
+};
+
+static void (* const frame3DImportFrameCPU[FrameCPUNb])(
+  const Frame3D* const,
+  const Frame3D* const,
+  Frame3D* const) = {
+
+  Frame3DImportFrameGeneric,
+  Frame3DImportFrameSSE2,
+  Frame3DImportFrameAVX2,
+  Frame3DImportFrameAVX512
+
+};
+
+static void (* const frame2DTimeImportFrameCPU[FrameCPUNb])(
+  const Frame2DTime* const,
+  const Frame2DTime* const,
+  Frame2DTime* const) = {
+
+  Frame2DTimeImportFrameGeneric,
+  Frame2DTimeImportFrameSSE2,
+  Frame2DTimeImportFrameAVX2,
+  Frame2DTimeImportFrameAVX512
+
+};
+
+static void (* const frame3DTimeImportFrameCPU[FrameCPUNb])(
+  const Frame3DTime* const,
+  const Frame3DTime* const,
+  Frame3DTime* const) = {
+
+  Frame3DTimeImportFrameGeneric,
+  Frame3DTimeImportFrameSSE2,
+  Frame3DTimeImportFrameAVX2,
+  Frame3DTimeImportFrameAVX512
+
+};
+
+static void (* const frame2DImportFramesCPU[FrameCPUNb])(
+  const Frame2D* const,
+  const Frame2D* const,
+  const int,
+  Frame2D* const) = {
+
+  Frame2DImportFramesGeneric,
+  Frame2DImportFramesSSE2,
+  Frame2DImportFramesAVX2,
+  Frame2DImportFramesAVX512
+
+};
+
+static void (* const frame3DImportFramesCPU[FrameCPUNb])(
+  const Frame3D* const,
+  const Frame3D* const,
+  const int,
+  Frame3D* const) = {
+
+  Frame3DImportFramesGeneric,
+  Frame3DImportFramesSSE2,
+  Frame3DImportFramesAVX2,
+  Frame3DImportFramesAVX512
+
+};
+
+static void (* const frame2DTimeImportFramesCPU[FrameCPUNb])(
+  const Frame2DTime* const,
+  const Frame2DTime* const,
+  const int,
+  Frame2DTime* const) = {
+
+  Frame2DTimeImportFramesGeneric,
+  Frame2DTimeImportFramesSSE2,
+  Frame2DTimeImportFramesAVX2,
+  Frame2DTimeImportFramesAVX512
+
+};
+
+static void (* const frame3DTimeImportFramesCPU[FrameCPUNb])(
+  const Frame3DTime* const,
+  const Frame3DTime* const,
+  const int,
+  Frame3DTime* const) = {
+
+  Frame3DTimeImportFramesGeneric,
+  Frame3DTimeImportFramesSSE2,
+  Frame3DTimeImportFramesAVX2,
+  Frame3DTimeImportFramesAVX512
+
+};
+
+static void (* const frame3DSoAImportFramesCPU[FrameCPUNb])(
+  const Frame3D* const,
+  const Frame3DSoA* const,
+  Frame3DSoA* const) = {
+
+  Frame3DSoAImportFramesGeneric,
+  Frame3DSoAImportFramesSSE2,
+  Frame3DSoAImportFramesAVX2,
+  Frame3DSoAImportFramesAVX512
+
+};
+
+// Project the Frames with the current implementation
+void Frame2DImportFrame(
+  const Frame2D* const P,
+  const Frame2D* const Q,
+  Frame2D* const Qp) {
+
+  frame2DImportFrameCPU[frameCPUPath](
+    P,
+    Q,
+    Qp);
+
+}
+
+void Frame3DImportFrame(
+  const Frame3D* const P,
+  const Frame3D* const Q,
+  Frame3D* const Qp) {
+
+  frame3DImportFrameCPU[frameCPUPath](
+    P,
+    Q,
+    Qp);
+
+}
+
+void Frame2DTimeImportFrame(
+  const Frame2DTime* const P,
+  const Frame2DTime* const Q,
+  Frame2DTime* const Qp) {
+
+  frame2DTimeImportFrameCPU[frameCPUPath](
+    P,
+    Q,
+    Qp);
+
+}
+
+void Frame3DTimeImportFrame(
+  const Frame3DTime* const P,
+  const Frame3DTime* const Q,
+  Frame3DTime* const Qp) {
+
+  frame3DTimeImportFrameCPU[frameCPUPath](
+    P,
+    Q,
+    Qp);
+
+}
+
+void Frame2DImportFrames(
+  const Frame2D* const P,
+  const Frame2D* const Q,
+  const int nb,
+  Frame2D* const Qp) {
+
+  frame2DImportFramesCPU[frameCPUPath](
+    P,
+    Q,
+    nb,
+    Qp);
+
+}
+
+void Frame3DImportFrames(
+  const Frame3D* const P,
+  const Frame3D* const Q,
+  const int nb,
+  Frame3D* const Qp) {
+
+  frame3DImportFramesCPU[frameCPUPath](
+    P,
+    Q,
+    nb,
+    Qp);
+
+}
+
+void Frame2DTimeImportFrames(
+  const Frame2DTime* const P,
+  const Frame2DTime* const Q,
+  const int nb,
+  Frame2DTime* const Qp) {
+
+  frame2DTimeImportFramesCPU[frameCPUPath](
+    P,
+    Q,
+    nb,
+    Qp);
+
+}
+
+void Frame3DTimeImportFrames(
+  const Frame3DTime* const P,
+  const Frame3DTime* const Q,
+  const int nb,
+  Frame3DTime* const Qp) {
+
+  frame3DTimeImportFramesCPU[frameCPUPath](
+    P,
+    Q,
+    nb,
+    Qp);
+
+}
+
+void Frame3DSoAImportFrames(
+  const Frame3D* const P,
+  const Frame3DSoA* const Q,
+  Frame3DSoA* const Qp) {
+
+  frame3DSoAImportFramesCPU[frameCPUPath](
+    P,
+    Q,
+    Qp);
+
+}
+
+// Return the best implementation of the hot paths supported by the CPU
+// and the OS
+FrameCPUPath FrameGetBestCPUPath(void) {
+
+#ifdef FRAME_CPU_DISPATCH
+
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f")) {
+
+    return FrameCPUAVX512;
+
+  } else if (__builtin_cpu_supports("avx2")) {
+
+    return FrameCPUAVX2;
+
+  } else if (__builtin_cpu_supports("sse2")) {
+
+    return FrameCPUSSE2;
+
+  }
+
+#endif
+
+  return FrameCPUGeneric;
+
+}
+
+// Return the implementation of the hot paths currently used
+FrameCPUPath FrameGetCPUPath(void) {
+
+  return frameCPUPath;
+
+}
+
+// Set the implementation of the hot paths used by all the threads
+// Return true if the path is supported by the CPU and has been set,
+// else false and the current path is not modified
+bool FrameSetCPUPath(const FrameCPUPath path) {
+
+  if (
+    path < FrameCPUGeneric ||
+    path > FrameGetBestCPUPath()) {
+
+    return false;
+
+  }
+
+  frameCPUPath = path;
+  return true;
+
+}
+
+// Return the name of the path
+const char* FrameGetCPUPathName(const FrameCPUPath path) {
+
+  if (
+    path < FrameCPUGeneric ||
+    path >= FrameCPUNb) {
+
+    return "unknown";
+
+  }
+
+  return frameCPUPathNames[path];
+
+}
+
+// Select the path at load time, the best one supported by the CPU
+// unless the environment variable FMB_CPU_PATH overrides it
+static void FrameInitCPUPath(void) {
+
+  frameCPUPath = FrameGetBestCPUPath();
+  const char* const name = getenv("FMB_CPU_PATH");
+  if (name != NULL) {
+
+    for (
+      int iPath = FrameCPUNb;
+      iPath--;) {
+
+      if (strcmp(name, frameCPUPathNames[iPath]) == 0) {
+
+        FrameSetCPUPath((FrameCPUPath)iPath);
+
+      }
+
+    }
+
+  }
+
+}
+
+// Return the number of Frames projected per instruction by
+// Frame3DSoAImportFrames
+int Frame3DSoASIMDWidth(void) {
+
+  return FrameSIMDWidth(frameCPUPath);
+
+}
+
+// Export the AABB bdgBox from that's coordinates system to
+// the real coordinates system and update bdgBoxProj with the resulting
+// AABB
+void Frame2DExportBdgBox(
+  const Frame2D* const that,
+  const AABB2D* const bdgBox,
+  AABB2D* const bdgBoxProj) {
+
+  // Shortcuts
+  const FMB_REAL* to    = that->orig;
+  const FMB_REAL* bbmi  = bdgBox->min;
+  const FMB_REAL* bbma  = bdgBox->max;
+  FMB_REAL* bbpmi = bdgBoxProj->min;
+  FMB_REAL* bbpma = bdgBoxProj->max;
+
+  const FMB_REAL (*tc)[2] = that->comp;
+
+  // Initialise the coordinates of the result AABB with the projection
+  // of the first corner of the AABB in argument
+  for (
+    int i = 2;
+    i--;) {
+
+    bbpma[i] = to[i];
+
+    for (
+      int j = 2;
+      j--;) {
+
+      bbpma[i] += tc[j][i] * bbmi[j];
+
+    }
+
+    bbpmi[i] = bbpma[i];
+
+  }
+
+  // Loop on vertices of the AABB
+  // Skip the first vertex which is the origin already computed above
+  int nbVertices = powi(2, 2);
+  for (
+    int iVertex = nbVertices;
+    iVertex-- && iVertex;) {
+
+    // Declare a variable to memorize the coordinates of the vertex in
+    // that's coordinates system
+    FMB_REAL v[2];
+
+    // Calculate the coordinates of the vertex in
+    // that's coordinates system
+    for (
+      int i = 2;
+      i--;) {
+
+      v[i] = ((iVertex & (1 << i)) ? bbma[i] : bbmi[i]);
+
+    }
+
+    // Declare a variable to memorize the projected coordinates
+    // in real coordinates system
+    FMB_REAL w[2];
+
+    // Project the vertex to real coordinates system
+    for (
+      int i = 2;
+      i--;) {
+
+      w[i] = to[i];
+
+      for (
+        int j = 2;
+        j--;) {
+
+        w[i] += tc[j][i] * v[j];
+
+      }
+
+    }
+
+    // Update the coordinates of the result AABB
+    for (
+      int i = 2;
+      i--;) {
+
+      if (bbpmi[i] > w[i]) {
+
+        bbpmi[i] = w[i];
+
+      }
+
+      if (bbpma[i] < w[i]) {
+
+        bbpma[i] = w[i];
+
+      }
+
+    }
+
+  }
+
+}
+
+void Frame3DExportBdgBox(
+  const Frame3D* const that,
+  const AABB3D* const bdgBox,
+  AABB3D* const bdgBoxProj) {
+
+  // Shortcuts
+  const FMB_REAL* to    = that->orig;
+  const FMB_REAL* bbmi  = bdgBox->min;
+  const FMB_REAL* bbma  = bdgBox->max;
+  FMB_REAL* bbpmi = bdgBoxProj->min;
+  FMB_REAL* bbpma = bdgBoxProj->max;
+
+  const FMB_REAL (*tc)[3] = that->comp;
+
+  // Initialise the coordinates of the result AABB with the projection
+  // of the first corner of the AABB in argument
+  for (
+    int i = 3;
+    i--;) {
+
+    bbpma[i] = to[i];
+
+    for (
+      int j = 3;
+      j--;) {
+
+      bbpma[i] += tc[j][i] * bbmi[j];
+
+    }
+
+    bbpmi[i] = bbpma[i];
+
+  }
+
+  // Loop on vertices of the AABB
+  // skip the first vertex which is the origin already computed above
+  int nbVertices = powi(2, 3);
+  for (
+    int iVertex = nbVertices;
+    iVertex-- && iVertex;) {
+
+    // Declare a variable to memorize the coordinates of the vertex in
+    // that's coordinates system
+    FMB_REAL v[3];
+
+    // Calculate the coordinates of the vertex in
+    // that's coordinates system
+    for (
+      int i = 3;
+      i--;) {
+
+      v[i] = ((iVertex & (1 << i)) ? bbma[i] : bbmi[i]);
+
+    }
+
+    // Declare a variable to memorize the projected coordinates
+    // in real coordinates system
+    FMB_REAL w[3];
+
+    // Project the vertex to real coordinates system
+    for (
+      int i = 3;
+      i--;) {
+
+      w[i] = to[i];
+
+      for (
+        int j = 3;
+        j--;) {
+
+        w[i] += tc[j][i] * v[j];
+
+      }
+
+    }
+
+    // Update the coordinates of the result AABB
+    for (
+      int i = 3;
+      i--;) {
+
+      if (bbpmi[i] > w[i]) {
+
+        bbpmi[i] = w[i];
+
+      }
+
+      if (bbpma[i] < w[i]) {
+
+        bbpma[i] = w[i];
+
+      }
+
+    }
+
+  }
+
+}
+
+void Frame3DFaceExportBdgBox(
+  const Frame3D* const that,
+  const AABB2D* const bdgBox,
+  AABB3D* const bdgBoxProj) {
+
+  // Shortcuts
+  const FMB_REAL* to    = that->orig;
+  const FMB_REAL* bbmi  = bdgBox->min;
+  const FMB_REAL* bbma  = bdgBox->max;
+  FMB_REAL* bbpmi = bdgBoxProj->min;
+  FMB_REAL* bbpma = bdgBoxProj->max;
+
+  const FMB_REAL (*tc)[3] = that->comp;
+
+  // Initialise the coordinates of the result AABB with the projection
+  // of the first corner of the AABB in argument
+  for (
+    int i = 3;
+    i--;) {
+
+    bbpma[i] = to[i];
+
+    for (
+      int j = 2;
+      j--;) {
+
+      bbpma[i] += tc[j][i] * bbmi[j];
+
+    }
+
+    bbpmi[i] = bbpma[i];
+
+  }
+
+  // Loop on vertices of the AABB
+  // skip the first vertex which is the origin already computed above
+  int nbVertices = powi(2, 3);
+  for (
+    int iVertex = nbVertices;
+    iVertex-- && iVertex;) {
+
+    // Declare a variable to memorize the coordinates of the vertex in
+    // that's coordinates system
+    FMB_REAL v[3];
+
+    // Calculate the coordinates of the vertex in
+    // that's coordinates system
+    for (
+      int i = 2;
+      i--;) {
+
+      v[i] = ((iVertex & (1 << i)) ? bbma[i] : bbmi[i]);
+
+    }
+
+    // Declare a variable to memorize the projected coordinates
+    // in real coordinates system
+    FMB_REAL w[3];
+
+    // Project the vertex to real coordinates system
+    for (
+      int i = 3;
+      i--;) {
+
+      w[i] = to[i];
+
+      for (
+        int j = 2;
+        j--;) {
+
+        w[i] += tc[j][i] * v[j];
+
+      }
+
+    }
+
+    // Update the coordinates of the result AABB
+    for (
+      int i = 3;
+      i--;) {
+
+      if (bbpmi[i] > w[i]) {
+
+        bbpmi[i] = w[i];
+
+      }
+
+      if (bbpma[i] < w[i]) {
+
+        bbpma[i] = w[i];
+
+      }
+
+    }
+
+  }
+
+}
+
+void Frame2DTimeExportBdgBox(
+  const Frame2DTime* const that,
+  const AABB2DTime* const bdgBox,
+  AABB2DTime* const bdgBoxProj) {
+
+  // Shortcuts
+  const FMB_REAL* to    = that->orig;
+  const FMB_REAL* ts    = that->speed;
+  const FMB_REAL* bbmi  = bdgBox->min;
+  const FMB_REAL* bbma  = bdgBox->max;
+  FMB_REAL* bbpmi = bdgBoxProj->min;
+  FMB_REAL* bbpma = bdgBoxProj->max;
+  const FMB_REAL (*tc)[2] = that->comp;
+
+  // The time component is not affected
+  bbpmi[2] = bbmi[2];
+  bbpma[2] = bbma[2];
+
+  // Initialise the coordinates of the result AABB with the projection
+  // of the first corner of the AABB in argument
+  for (
+    int i = 2;
+    i--;) {
+
+    bbpma[i] = to[i] + ts[i] * bbmi[2];
+
+    for (
+      int j = 2;
+      j--;) {
+
+      bbpma[i] += tc[j][i] * bbmi[j];
+
+    }
+
+    bbpmi[i] = bbpma[i];
+
+  }
+
+  // Loop on vertices of the AABB
+  // skip the first vertex which is the origin already computed above
+  int nbVertices = powi(2, 2);
+  for (
+    int iVertex = nbVertices;
+    iVertex-- && iVertex;) {
+
+    // Declare a variable to memorize the coordinates of the vertex in
+    // 'that' 's coordinates system
+    FMB_REAL v[2];
+
+    // Calculate the coordinates of the vertex in
+    // 'that' 's coordinates system
+    for (
+      int i = 2;
+      i--;) {
+
+      v[i] = ((iVertex & (1 << i)) ? bbma[i] : bbmi[i]);
+
+    }
+
+    // Declare a variable to memorize the projected coordinates
+    // in real coordinates system
+    FMB_REAL w[2];
+
+    // Project the vertex to real coordinates system
+    for (
+      int i = 2;
+      i--;) {
+
+      w[i] = to[i];
+
+      for (
+        int j = 2;
+        j--;) {
+
+        w[i] += tc[j][i] * v[j];
+
+      }
+
+    }
+
+    // Update the coordinates of the result AABB
+    for (
+      int i = 2;
+      i--;) {
+
+      if (bbpmi[i] > w[i] + ts[i] * bbmi[2]) {
+
+        bbpmi[i] = w[i] + ts[i] * bbmi[2];
+
+      }
+
+      if (bbpmi[i] > w[i] + ts[i] * bbma[2]) {
+
+        bbpmi[i] = w[i] + ts[i] * bbma[2];
+
+      }
+
+      if (bbpma[i] < w[i] + ts[i] * bbmi[2]) {
+
+        bbpma[i] = w[i] + ts[i] * bbmi[2];
+
+      }
+
+      if (bbpma[i] < w[i] + ts[i] * bbma[2]) {
+
+        bbpma[i] = w[i] + ts[i] * bbma[2];
+
+      }
+
+    }
+
+  }
+
+}
+
+void Frame3DTimeExportBdgBox(
+  const Frame3DTime* const that,
+  const AABB3DTime* const bdgBox,
+  AABB3DTime* const bdgBoxProj) {
+
+  // Shortcuts
+  const FMB_REAL* to    = that->orig;
+  const FMB_REAL* ts    = that->speed;
+  const FMB_REAL* bbmi  = bdgBox->min;
+  const FMB_REAL* bbma  = bdgBox->max;
+  FMB_REAL* bbpmi = bdgBoxProj->min;
+  FMB_REAL* bbpma = bdgBoxProj->max;
+  const FMB_REAL (*tc)[3] = that->comp;
+
+  // The time component is not affected
+  bbpmi[3] = bbmi[3];
+  bbpma[3] = bbma[3];
+
+  // Initialise the coordinates of the result AABB with the projection
+  // of the first corner of the AABB in argument
+  for (
+    int i = 3;
+    i--;) {
+
+    bbpma[i] = to[i] + ts[i] * bbmi[3];
+
+    for (
+      int j = 3;
+      j--;) {
+
+      bbpma[i] += tc[j][i] * bbmi[j];
+
+    }
+
+    bbpmi[i] = bbpma[i];
+
+  }
+
+  // Loop on vertices of the AABB
+  // skip the first vertex which is the origin already computed above
+  int nbVertices = powi(2, 3);
+  for (
+    int iVertex = nbVertices;
+    iVertex-- && iVertex;) {
+
+    // Declare a variable to memorize the coordinates of the vertex in
+    // that's coordinates system
+    FMB_REAL v[3];
+
+    // Calculate the coordinates of the vertex in
+    // that's coordinates system
+    for (
+      int i = 3;
+      i--;) {
+
+      v[i] = ((iVertex & (1 << i)) ? bbma[i] : bbmi[i]);
+
+    }
+
+    // Declare a variable to memorize the projected coordinates
+    // in real coordinates system
+    FMB_REAL w[3];
+
+    // Project the vertex to real coordinates system
+    for (
+      int i = 3;
+      i--;) {
 
       w[i] = to[i];
 
-      for (
-        int j = 3;
-        j--;) {
+      for (
+        int j = 3;
+        j--;) {
+
+        w[i] += tc[j][i] * v[j];
+
+      }
+
+    }
+
+    // Update the coordinates of the result AABB
+    for (
+      int i = 3;
+      i--;) {
+
+      if (bbpmi[i] > w[i] + ts[i] * bbmi[3]) {
+
+        bbpmi[i] = w[i] + ts[i] * bbmi[3];
+
+      }
+
+      if (bbpmi[i] > w[i] + ts[i] * bbma[3]) {
+
+        bbpmi[i] = w[i] + ts[i] * bbma[3];
+
+      }
+
+      if (bbpma[i] < w[i] + ts[i] * bbmi[3]) {
+
+        bbpma[i] = w[i] + ts[i] * bbmi[3];
+
+      }
+
+      if (bbpma[i] < w[i] + ts[i] * bbma[3]) {
+
+        bbpma[i] = w[i] + ts[i] * bbma[3];
+
+      }
+
+    }
+
+  }
+
+}
+
+// Print the AABB that on stdout
+// Output format is (min[0], min[1], ...)-(max[0], max[1], ...)
+void AABB2DPrint(const AABB2D* const that) {
+
+  printf("minXY(");
+  for (
+    int i = 0;
+    i < 2;
+    ++i) {
+
+    printf("%f", that->min[i]);
+    if (i < 1) printf(",");
+
+  }
+
+  printf(")-maxXY(");
+  for (
+    int i = 0;
+    i < 2;
+    ++i) {
+
+    printf("%f", that->max[i]);
+    if (i < 1) printf(",");
+
+  }
+
+  printf(")");
+
+}
+
+void AABB3DPrint(const AABB3D* const that) {
+
+  printf("minXYZ(");
+  for (
+    int i = 0;
+    i < 3;
+    ++i) {
+
+    printf("%f", that->min[i]);
+    if (i < 2) printf(",");
+
+  }
+
+  printf(")-maxXYZ(");
+  for (
+    int i = 0;
+    i < 3;
+    ++i) {
+
+    printf("%f", that->max[i]);
+    if (i < 2) printf(",");
+
+  }
+
+  printf(")");
+
+}
+
+void AABB2DTimePrint(const AABB2DTime* const that) {
+
+  printf("minXYT(");
+  for (
+    int i = 0;
+    i < 3;
+    ++i) {
+
+    printf("%f", that->min[i]);
+    if (i < 2) printf(",");
+
+  }
+
+  printf(")-maxXYT(");
+  for (
+    int i = 0;
+    i < 3;
+    ++i) {
+
+    printf("%f", that->max[i]);
+    if (i < 2) printf(",");
+
+  }
+
+  printf(")");
+
+}
+
+void AABB3DTimePrint(const AABB3DTime* const that) {
+
+  printf("minXYZT(");
+  for (
+    int i = 0;
+    i < 4;
+    ++i) {
+
+    printf("%f", that->min[i]);
+    if (i < 3) printf(",");
+
+  }
+
+  printf(")-maxXYZT(");
+  for (
+    int i = 0;
+    i < 4;
+    ++i) {
+
+    printf("%f", that->max[i]);
+    if (i < 3) printf(",");
+
+  }
+
+  printf(")");
+
+}
+
+// Print the Frame that on stdout
+// Output format is
+// T/C  <- type of Frame
+// o(orig[0], orig[1], orig[2])
+// s(speed[0], speed[1], speed[2])
+// x(comp[0][0], comp[0][1], comp[0][2])
+// y(comp[1][0], comp[1][1], comp[1][2])
+// z(comp[2][0], comp[2][1], comp[2][2])
+void Frame2DPrint(const Frame2D* const that) {
+
+  if (that->type == FrameTetrahedron) {
+
+    printf("T");
+
+  } else if (that->type == FrameCuboid) {
+
+    printf("C");
+
+  }
+
+  printf("o(");
+  for (
+    int i = 0;
+    i < 2;
+    ++i) {
+
+    printf("%f", that->orig[i]);
+    if (i < 1) printf(",");
+
+  }
+
+  char comp[2] = {'x', 'y'};
+  for (
+    int j = 0;
+    j < 2;
+    ++j) {
+
+    printf(") %c(", comp[j]);
+    for (
+      int i = 0;
+      i < 2;
+      ++i) {
+
+      printf("%f", that->comp[j][i]);
+      if (i < 1) printf(",");
+
+    }
+
+  }
+
+  printf(")");
+
+}
+
+void Frame3DPrint(const Frame3D* const that) {
+
+  if (that->type == FrameTetrahedron) {
+
+    printf("T");
+
+  } else if (that->type == FrameCuboid) {
+
+    printf("C");
+
+  }
+
+  if (that->isFace == true) {
+
+    printf("f");
+
+  }
+
+  printf("o(");
+  for (
+    int i = 0;
+    i < 3;
+    ++i) {
 
-        w[i] += tc[j][i] * v[j];
+    printf("%f", that->orig[i]);
+    if (i < 2) printf(",");
 
-      }
+  }
 
-    }
+  char comp[3] = {'x', 'y', 'z'};
+  for (
+    int j = 0;
+    j < 3;
+    ++j) {
 
-    // Update the coordinates of the result AABB
+    printf(") %c(", comp[j]);
     for (
-      int i = 3;
-      i--;) {
+      int i = 0;
+      i < 3;
+      ++i) {
 
-      if (bbpmi[i] > w[i] + ts[i] * bbmi[3]) {
+      printf("%f", that->comp[j][i]);
+      if (i < 2) printf(",");
 
-        bbpmi[i] = w[i] + ts[i] * bbmi[3];
+    }
 
-      }
+  }
 
-      if (bbpmi[i] > w[i] + ts[i] * bbma[3]) {
+  printf(")");
 
-        bbpmi[i] = w[i] + ts[i] * bbma[3];
+}
 
-      }
+void Frame2DTimePrint(const Frame2DTime* const that) {
 
-      if (bbpma[i] < w[i] + ts[i] * bbmi[3]) {
+  if (that->type == FrameTetrahedron) {
 
-        bbpma[i] = w[i] + ts[i] * bbmi[3];
+    printf("T");
 
-      }
+  } else if (that->type == FrameCuboid) {
 
-      if (bbpma[i] < w[i] + ts[i] * bbma[3]) {
+    printf("C");
 
-        bbpma[i] = w[i] + ts[i] * bbma[3];
+  }
 
-      }
+  printf("o(");
+  for (
+    int i = 0;
+    i < 2;
+    ++i) {
+
+    printf("%f", that->orig[i]);
+    if (i < 1) printf(",");
+
+  }
+
+  printf(") s(");
+  for (
+    int i = 0;
+    i < 2;
+    ++i) {
+
+    printf("%f", that->speed[i]);
+    if (i < 1) printf(",");
+
+  }
+
+  char comp[2] = {'x', 'y'};
+  for (
+    int j = 0;
+    j < 2;
+    ++j) {
+
+    printf(") %c(", comp[j]);
+    for (
+      int i = 0;
+      i < 2;
+      ++i) {
+
+      printf("%f", that->comp[j][i]);
+      if (i < 1) printf(",");
 
     }
 
   }
 
+  printf(")");
+
 }
 
-// Print the AABB that on stdout
-// Output format is (min[0], min[1], ...)-(max[0], max[1], ...)
-void AABB2DPrint(const AABB2D* const that) {
+void Frame3DTimePrint(const Frame3DTime* const that) {
 
-  printf("minXY(");
+  if (that->type == FrameTetrahedron) {
+
+    printf("T");
+
+  } else if (that->type == FrameCuboid) {
+
+    printf("C");
+
+  }
+
+  if (that->isFace == true) {
+
+    printf("f");
+
+  }
+
+  printf("o(");
   for (
     int i = 0;
-    i < 2;
+    i < 3;
     ++i) {
 
-    printf("%f", that->min[i]);
-    if (i < 1) printf(",");
+    printf("%f", that->orig[i]);
+    if (i < 2) printf(",");
 
   }
 
-  printf(")-maxXY(");
+  printf(") s(");
   for (
     int i = 0;
-    i < 2;
+    i < 3;
     ++i) {
 
-    printf("%f", that->max[i]);
-    if (i < 1) printf(",");
+    printf("%f", that->speed[i]);
+    if (i < 2) printf(",");
+
+  }
+
+  char comp[3] = {'x', 'y', 'z'};
+  for (
+    int j = 0;
+    j < 3;
+    ++j) {
+
+    printf(") %c(", comp[j]);
+    for (
+      int i = 0;
+      i < 3;
+      ++i) {
+
+      printf("%f", that->comp[j][i]);
+      if (i < 2) printf(",");
+
+    }
+
+  }
+
+  printf(")");
+
+}
+
+// Check the intersection between two static AABB that and tho
+bool AABBTestIntersection2D(
+  const AABB2D* const that,
+  const AABB2D* const tho) {
+
+  if (
+    that->min[0] > tho->max[0] ||
+    that->min[1] > tho->max[1] ||
+    tho->min[0] > that->max[0] ||
+    tho->min[1] > that->max[1]) {
+
+    return false;
+
+  }
+
+  return true;
+
+}
+
+bool AABBTestIntersection3D(
+  const AABB3D* const that,
+  const AABB3D* const tho) {
+
+  if (
+    that->min[0] > tho->max[0] ||
+    that->min[1] > tho->max[1] ||
+    that->min[2] > tho->max[2] ||
+    tho->min[0] > that->max[0] ||
+    tho->min[1] > that->max[1] ||
+    tho->min[2] > that->max[2]) {
+
+    return false;
+
+  }
+
+  return true;
+
+}
+
+// Check the intersection between two AABB of moving Frames that and
+// tho, along the spatial axes and the time axis
+bool AABBTestIntersection2DTime(
+  const AABB2DTime* const that,
+  const AABB2DTime* const tho) {
+
+  if (
+    that->min[0] > tho->max[0] ||
+    that->min[1] > tho->max[1] ||
+    that->min[2] > tho->max[2] ||
+    tho->min[0] > that->max[0] ||
+    tho->min[1] > that->max[1] ||
+    tho->min[2] > that->max[2]) {
+
+    return false;
+
+  }
+
+  return true;
+
+}
+
+bool AABBTestIntersection3DTime(
+  const AABB3DTime* const that,
+  const AABB3DTime* const tho) {
+
+  if (
+    that->min[0] > tho->max[0] ||
+    that->min[1] > tho->max[1] ||
+    that->min[2] > tho->max[2] ||
+    that->min[3] > tho->max[3] ||
+    tho->min[0] > that->max[0] ||
+    tho->min[1] > that->max[1] ||
+    tho->min[2] > that->max[2] ||
+    tho->min[3] > that->max[3]) {
+
+    return false;
+
+  }
+
+  return true;
+
+}
+
+// Create the key of the blocks of statistics of the threads
+static void FrameStatsCreateKey(void) {
+
+  if (
+    pthread_key_create(
+      &frameStatsKey,
+      FrameStatsRetireThread) != 0) {
+
+    printf("pthread_key_create failed\n");
+    exit(0);
+
+  }
+
+}
+
+// Create the block of statistics of the calling thread for the
+// FrameStats that, with all the statistics null, and return its
+// statistics
+void* FrameStatsAddThread(FrameStats* const that) {
+
+  // Allocate the block
+  FrameStatsBlock* block = malloc(sizeof(FrameStatsBlock));
+  if (block == NULL) {
+
+    printf("malloc failed\n");
+    exit(0);
+
+  }
+
+  block->data = calloc(1, that->size);
+  if (block->data == NULL) {
+
+    printf("calloc failed\n");
+    exit(0);
+
+  }
+
+  // Add the block to the ones of the thread
+  pthread_once(
+    &frameStatsKeyOnce,
+    FrameStatsCreateKey);
+  block->stats = that;
+  block->nextThread = pthread_getspecific(frameStatsKey);
+  pthread_setspecific(
+    frameStatsKey,
+    block);
+
+  // Add the block to the ones of the FrameStats
+  pthread_mutex_lock(&frameStatsLock);
+  block->prev = NULL;
+  block->next = that->blocks;
+  if (that->blocks != NULL) {
+
+    that->blocks->prev = block;
+
+  }
+
+  that->blocks = block;
+  pthread_mutex_unlock(&frameStatsLock);
+
+  return block->data;
+
+}
+
+// Add the blocks of statistics of an exiting thread, starting with
+// block, to the retired statistics of their FrameStats and free them
+static void FrameStatsRetireThread(void* block) {
+
+  pthread_mutex_lock(&frameStatsLock);
+
+  // Loop on the blocks of the thread
+  FrameStatsBlock* iter = block;
+  while (iter != NULL) {
+
+    // Add the statistics to the retired ones
+    FrameStats* stats = iter->stats;
+    if (stats->retired == NULL) {
+
+      stats->retired = calloc(1, stats->size);
+      if (stats->retired == NULL) {
+
+        printf("calloc failed\n");
+        exit(0);
+
+      }
+
+    }
+
+    stats->merge(
+      stats->retired,
+      iter->data);
 
-  }
+    // Remove the block from the ones of the FrameStats
+    if (iter->prev != NULL) {
 
-  printf(")");
+      iter->prev->next = iter->next;
 
-}
+    } else {
 
-void AABB3DPrint(const AABB3D* const that) {
+      stats->blocks = iter->next;
 
-  printf("minXYZ(");
-  for (
-    int i = 0;
-    i < 3;
-    ++i) {
+    }
 
-    printf("%f", that->min[i]);
-    if (i < 2) printf(",");
+    if (iter->next != NULL) {
 
-  }
+      iter->next->prev = iter->prev;
 
-  printf(")-maxXYZ(");
-  for (
-    int i = 0;
-    i < 3;
-    ++i) {
+    }
 
-    printf("%f", that->max[i]);
-    if (i < 2) printf(",");
+    // Free the block
+    FrameStatsBlock* next = iter->nextThread;
+    free(iter->data);
+    free(iter);
+    iter = next;
 
   }
 
-  printf(")");
+  pthread_mutex_unlock(&frameStatsLock);
 
 }
 
-void AABB2DTimePrint(const AABB2DTime* const that) {
+// Add the statistics of all the threads of the FrameStats that into
+// stats, which is first set to null statistics
+void FrameStatsGet(
+  FrameStats* const that,
+  void* const stats) {
 
-  printf("minXYT(");
-  for (
-    int i = 0;
-    i < 3;
-    ++i) {
+  memset(
+    stats,
+    0,
+    that->size);
 
-    printf("%f", that->min[i]);
-    if (i < 2) printf(",");
+  pthread_mutex_lock(&frameStatsLock);
+  if (that->retired != NULL) {
+
+    that->merge(
+      stats,
+      that->retired);
 
   }
 
-  printf(")-maxXYT(");
   for (
-    int i = 0;
-    i < 3;
-    ++i) {
+    FrameStatsBlock* block = that->blocks;
+    block != NULL;
+    block = block->next) {
 
-    printf("%f", that->max[i]);
-    if (i < 2) printf(",");
+    that->merge(
+      stats,
+      block->data);
 
   }
 
-  printf(")");
+  pthread_mutex_unlock(&frameStatsLock);
 
 }
 
-void AABB3DTimePrint(const AABB3DTime* const that) {
+// Set the statistics of all the threads of the FrameStats that to null
+// statistics
+void FrameStatsReset(FrameStats* const that) {
 
-  printf("minXYZT(");
-  for (
-    int i = 0;
-    i < 4;
-    ++i) {
+  pthread_mutex_lock(&frameStatsLock);
+  if (that->retired != NULL) {
 
-    printf("%f", that->min[i]);
-    if (i < 3) printf(",");
+    memset(
+      that->retired,
+      0,
+      that->size);
 
   }
 
-  printf(")-maxXYZT(");
   for (
-    int i = 0;
-    i < 4;
-    ++i) {
+    FrameStatsBlock* block = that->blocks;
+    block != NULL;
+    block = block->next) {
 
-    printf("%f", that->max[i]);
-    if (i < 3) printf(",");
+    memset(
+      block->data,
+      0,
+      that->size);
 
   }
 
-  printf(")");
+  pthread_mutex_unlock(&frameStatsLock);
 
 }
 
-// Print the Frame that on stdout
-// Output format is
-// T/C  <- type of Frame
-// o(orig[0], orig[1], orig[2])
-// s(speed[0], speed[1], speed[2])
-// x(comp[0][0], comp[0][1], comp[0][2])
-// y(comp[1][0], comp[1][1], comp[1][2])
-// z(comp[2][0], comp[2][1], comp[2][2])
-void Frame2DPrint(const Frame2D* const that) {
+// Add the FMBPruneStats from to the FMBPruneStats to
+void FMBPruneStatsMerge(
+  void* const to,
+  const void* const from) {
 
-  if (that->type == FrameTetrahedron) {
+  FMBPruneStats* const statsTo = to;
+  const FMBPruneStats* const statsFrom = from;
+  statsTo->nbRows += statsFrom->nbRows;
+  statsTo->nbDuplicate += statsFrom->nbDuplicate;
+  statsTo->nbDominated += statsFrom->nbDominated;
+  statsTo->nbTrivial += statsFrom->nbTrivial;
 
-    printf("T");
+}
 
-  } else if (that->type == FrameCuboid) {
+// Reset the statistics of the elimination that
+void FMBElimStatsReset(FMBElimStats* const that) {
 
-    printf("C");
+  memset(
+    that,
+    0,
+    sizeof(FMBElimStats));
 
-  }
+}
 
-  printf("o(");
-  for (
-    int i = 0;
-    i < 2;
-    ++i) {
+// Record into the statistics of the elimination that the end at the
+// stage stage of a test between Frames of types thatType and thoType
+void FMBElimStatsAddStage(
+  FMBElimStats* const that,
+  const FrameType thatType,
+  const FrameType thoType,
+  const FMBElimStage stage) {
 
-    printf("%f", that->orig[i]);
-    if (i < 1) printf(",");
+  ++(that->nbStage[thatType][thoType][stage]);
+
+}
+
+// Record into the statistics of the elimination that the nb of rows
+// nbRows of the system resulting from the elimination iPass in a test
+// between Frames of types thatType and thoType
+void FMBElimStatsAddRows(
+  FMBElimStats* const that,
+  const FrameType thatType,
+  const FrameType thoType,
+  const int iPass,
+  const int nbRows) {
+
+  int iBin = (nbRows < FMB_ELIM_NB_BIN ? nbRows : FMB_ELIM_NB_BIN - 1);
+  ++(that->histoRows[thatType][thoType][iPass][iBin]);
+  if (that->maxRows[thatType][thoType][iPass] < nbRows) {
+
+    that->maxRows[thatType][thoType][iPass] = nbRows;
 
   }
 
-  char comp[2] = {'x', 'y'};
+}
+
+// Add the FMBElimStats from to the FMBElimStats to
+void FMBElimStatsMerge(
+  void* const to,
+  const void* const from) {
+
+  FMBElimStats* const statsTo = to;
+  const FMBElimStats* const statsFrom = from;
   for (
-    int j = 0;
-    j < 2;
-    ++j) {
+    int thatType = 2;
+    thatType--;) {
 
-    printf(") %c(", comp[j]);
     for (
-      int i = 0;
-      i < 2;
-      ++i) {
+      int thoType = 2;
+      thoType--;) {
 
-      printf("%f", that->comp[j][i]);
-      if (i < 1) printf(",");
+      for (
+        int iStage = FMBElimStageNb;
+        iStage--;) {
 
-    }
+        statsTo->nbStage[thatType][thoType][iStage] +=
+          statsFrom->nbStage[thatType][thoType][iStage];
 
-  }
+      }
 
-  printf(")");
+      for (
+        int iPass = FMB_ELIM_NB_PASS;
+        iPass--;) {
 
-}
+        for (
+          int iBin = FMB_ELIM_NB_BIN;
+          iBin--;) {
 
-void Frame3DPrint(const Frame3D* const that) {
+          statsTo->histoRows[thatType][thoType][iPass][iBin] +=
+            statsFrom->histoRows[thatType][thoType][iPass][iBin];
 
-  if (that->type == FrameTetrahedron) {
+        }
 
-    printf("T");
+        if (
+          statsTo->maxRows[thatType][thoType][iPass] <
+          statsFrom->maxRows[thatType][thoType][iPass]) {
 
-  } else if (that->type == FrameCuboid) {
+          statsTo->maxRows[thatType][thoType][iPass] =
+            statsFrom->maxRows[thatType][thoType][iPass];
 
-    printf("C");
+        }
+
+      }
+
+    }
 
   }
 
-  if (that->isFace == true) {
+}
 
-    printf("f");
+// Return the name of the stage
+const char* FMBElimStageGetName(const FMBElimStage stage) {
+
+  if (stage < 0 || stage >= FMBElimStageNb) {
+
+    return NULL;
 
   }
 
-  printf("o(");
-  for (
-    int i = 0;
-    i < 3;
-    ++i) {
+  return fmbElimStageNames[stage];
 
-    printf("%f", that->orig[i]);
-    if (i < 2) printf(",");
+}
 
-  }
+// Print the statistics of the elimination that on the stream stream
+void FMBElimStatsPrint(
+  const FMBElimStats* const that,
+  FILE* const stream) {
 
-  char comp[3] = {'x', 'y', 'z'};
   for (
-    int j = 0;
-    j < 3;
-    ++j) {
+    int iPair = 0;
+    iPair < 4;
+    ++iPair) {
 
-    printf(") %c(", comp[j]);
+    int thatType = iPair / 2;
+    int thoType = iPair % 2;
+
+    // Get the nb of tests
+    unsigned long nbTest = 0;
     for (
-      int i = 0;
-      i < 3;
-      ++i) {
+      int iStage = FMBElimStageNb;
+      iStage--;) {
 
-      printf("%f", that->comp[j][i]);
-      if (i < 2) printf(",");
+      nbTest += that->nbStage[thatType][thoType][iStage];
 
     }
 
-  }
+    if (nbTest == 0) {
 
-  printf(")");
+      continue;
 
-}
+    }
 
-void Frame2DTimePrint(const Frame2DTime* const that) {
+    // Print the percentage of tests ended at each stage
+    fprintf(
+      stream,
+      "%s: %lu tests,",
+      frameTypePairNames[thatType][thoType],
+      nbTest);
+    for (
+      int iStage = 0;
+      iStage < FMBElimStageNb;
+      ++iStage) {
 
-  if (that->type == FrameTetrahedron) {
+      fprintf(
+        stream,
+        " %s %.2f%%",
+        fmbElimStageNames[iStage],
+        100.0 * (double)(that->nbStage[thatType][thoType][iStage]) /
+        (double)nbTest);
 
-    printf("T");
+    }
 
-  } else if (that->type == FrameCuboid) {
+    fprintf(stream, "\n");
 
-    printf("C");
+    // Print the summary of the histograms of nb of rows
+    for (
+      int iPass = 0;
+      iPass < FMB_ELIM_NB_PASS;
+      ++iPass) {
 
-  }
+      const unsigned long* histo = that->histoRows[thatType][thoType][iPass];
+      unsigned long nb = 0;
+      double sum = 0.0;
+      for (
+        int iBin = FMB_ELIM_NB_BIN;
+        iBin--;) {
 
-  printf("o(");
-  for (
-    int i = 0;
-    i < 2;
-    ++i) {
+        nb += histo[iBin];
+        sum += (double)iBin * (double)(histo[iBin]);
 
-    printf("%f", that->orig[i]);
-    if (i < 1) printf(",");
+      }
 
-  }
+      if (nb == 0) {
 
-  printf(") s(");
-  for (
-    int i = 0;
-    i < 2;
-    ++i) {
+        continue;
 
-    printf("%f", that->speed[i]);
-    if (i < 1) printf(",");
+      }
 
-  }
+      // 99th percentile (nearest rank)
+      unsigned long rank = (99 * nb + 99) / 100;
+      unsigned long cumul = 0;
+      int p99 = 0;
+      while (cumul + histo[p99] < rank) {
 
-  char comp[2] = {'x', 'y'};
-  for (
-    int j = 0;
-    j < 2;
-    ++j) {
+        cumul += histo[p99];
+        ++p99;
 
-    printf(") %c(", comp[j]);
-    for (
-      int i = 0;
-      i < 2;
-      ++i) {
+      }
 
-      printf("%f", that->comp[j][i]);
-      if (i < 1) printf(",");
+      fprintf(
+        stream,
+        "  rows after pass %d: %lu systems, avg %.2f, p99 %d, max %d\n",
+        iPass + 1,
+        nb,
+        sum / (double)nb,
+        p99,
+        that->maxRows[thatType][thoType][iPass]);
 
     }
 
   }
 
-  printf(")");
-
 }
 
-void Frame3DTimePrint(const Frame3DTime* const that) {
+// Return the index of the slot of the pair (idThat, idTho) in the
+// FMBPairCache that
+// The identifiers are mixed (cf the finalizer of splitmix64) so that
+// consecutive identifiers are spread over the slots
+static inline int FMBPairCacheGetSlot(
+  const FMBPairCache* const that,
+  const unsigned long idThat,
+  const unsigned long idTho) {
+
+  unsigned long long h =
+    (unsigned long long)idThat * 0x9E3779B97F4A7C15ULL +
+    (unsigned long long)idTho;
+  h ^= h >> 30;
+  h *= 0xBF58476D1CE4E5B9ULL;
+  h ^= h >> 27;
+  h *= 0x94D049BB133111EBULL;
+  h ^= h >> 31;
+
+  return (int)(h & (unsigned long long)(that->nbSlot - 1));
 
-  if (that->type == FrameTetrahedron) {
+}
 
-    printf("T");
+// Create a new FMBPairCache with at least nbSlot slots (rounded up to
+// a power of 2), all empty
+FMBPairCache* FMBPairCacheCreate(const int nbSlot) {
 
-  } else if (that->type == FrameCuboid) {
+  // Allocate memory for the structure
+  FMBPairCache* that = malloc(sizeof(FMBPairCache));
+  if (that == NULL) {
 
-    printf("C");
+    printf("FMBPairCacheCreate: failed to allocate memory\n");
+    exit(0);
 
   }
 
-  if (that->isFace == true) {
+  // Round up the number of slots to a power of 2
+  that->nbSlot = 1;
+  while (that->nbSlot < nbSlot) {
 
-    printf("f");
+    that->nbSlot *= 2;
 
   }
 
-  printf("o(");
-  for (
-    int i = 0;
-    i < 3;
-    ++i) {
+  // Allocate memory for the slots
+  that->slots = malloc(sizeof(FMBPairCacheSlot) * that->nbSlot);
+  if (that->slots == NULL) {
 
-    printf("%f", that->orig[i]);
-    if (i < 2) printf(",");
+    printf("FMBPairCacheCreate: failed to allocate memory\n");
+    exit(0);
 
   }
 
-  printf(") s(");
-  for (
-    int i = 0;
-    i < 3;
-    ++i) {
+  // Empty the slots
+  FMBPairCacheClear(that);
 
-    printf("%f", that->speed[i]);
-    if (i < 2) printf(",");
+  // Return the new cache
+  return that;
+
+}
+
+// Free the memory used by the FMBPairCache that
+void FMBPairCacheFree(FMBPairCache** that) {
+
+  if (that == NULL || *that == NULL) {
+
+    return;
 
   }
 
-  char comp[3] = {'x', 'y', 'z'};
-  for (
-    int j = 0;
-    j < 3;
-    ++j) {
+  free((*that)->slots);
+  free(*that);
+  *that = NULL;
 
-    printf(") %c(", comp[j]);
-    for (
-      int i = 0;
-      i < 3;
-      ++i) {
+}
 
-      printf("%f", that->comp[j][i]);
-      if (i < 2) printf(",");
+// Empty all the slots of the FMBPairCache that and reset its
+// statistics
+void FMBPairCacheClear(FMBPairCache* const that) {
 
-    }
+  for (
+    int iSlot = that->nbSlot;
+    iSlot--;) {
+
+    that->slots[iSlot].idThat = 0;
+    that->slots[iSlot].idTho = 0;
+    that->slots[iSlot].witness = FMB_PAIR_CACHE_NONE;
 
   }
 
-  printf(")");
+  that->nbHit = 0;
+  that->nbMiss = 0;
 
 }
 
-// Check the intersection between two static AABB that and tho
-bool AABBTestIntersection2D(
-  const AABB2D* const that,
-  const AABB2D* const tho) {
-
+// Return the witness memorized in the FMBPairCache that for the pair
+// (idThat, idTho), or FMB_PAIR_CACHE_NONE if the pair is not in the
+// cache or has no witness
+int FMBPairCacheGet(
+  const FMBPairCache* const that,
+  const unsigned long idThat,
+  const unsigned long idTho) {
+
+  const FMBPairCacheSlot* slot =
+    that->slots +
+    FMBPairCacheGetSlot(
+      that,
+      idThat,
+      idTho);
   if (
-    that->min[0] > tho->max[0] ||
-    that->min[1] > tho->max[1] ||
-    tho->min[0] > that->max[0] ||
-    tho->min[1] > that->max[1]) {
+    slot->idThat == idThat &&
+    slot->idTho == idTho) {
 
-    return false;
+    return slot->witness;
 
   }
 
-  return true;
+  return FMB_PAIR_CACHE_NONE;
 
 }
 
-bool AABBTestIntersection3D(
-  const AABB3D* const that,
-  const AABB3D* const tho) {
-
+// Memorize the witness for the pair (idThat, idTho) in the
+// FMBPairCache that
+// FMB_PAIR_CACHE_NONE doesn't replace the witness of another pair
+// memorized in the same slot
+void FMBPairCacheSet(
+  FMBPairCache* const that,
+  const unsigned long idThat,
+  const unsigned long idTho,
+  const int witness) {
+
+  FMBPairCacheSlot* slot =
+    that->slots +
+    FMBPairCacheGetSlot(
+      that,
+      idThat,
+      idTho);
   if (
-    that->min[0] > tho->max[0] ||
-    that->min[1] > tho->max[1] ||
-    that->min[2] > tho->max[2] ||
-    tho->min[0] > that->max[0] ||
-    tho->min[1] > that->max[1] ||
-    tho->min[2] > that->max[2]) {
+    witness == FMB_PAIR_CACHE_NONE &&
+    (slot->idThat != idThat || slot->idTho != idTho)) {
 
-    return false;
+    return;
 
   }
 
-  return true;
+  slot->idThat = idThat;
+  slot->idTho = idTho;
+  slot->witness = witness;
 
 }
 
 // Power function for integer base and exponent
 // Return base^exp
-int powi(
+static int powi(
   int base,
   unsigned int exp) {
 
@@ -29,6 +29,91 @@
 
 // ------------- Macros -------------
 
+// Bitsets used to memorize the results of the batch intersection
+// tests, as arrays of unsigned long
+// Number of bits per word of a bitset
+#define FMB_BITSET_WORD_SIZE (8 * sizeof(unsigned long))
+
+// Number of words of a bitset able to memorize nb bits
+#define FMBBitsetNbWords(nb) \
+  (((nb) + FMB_BITSET_WORD_SIZE - 1) / FMB_BITSET_WORD_SIZE)
+
+// Return the iBit-th bit of the bitset (1 or 0)
+#define FMBBitsetGet(bitset, iBit) \
+  (((bitset)[(iBit) / FMB_BITSET_WORD_SIZE] >> \
+  ((iBit) % FMB_BITSET_WORD_SIZE)) & 1UL)
+
+// Set the iBit-th bit of the bitset to 1
+#define FMBBitsetSet(bitset, iBit) \
+  ((bitset)[(iBit) / FMB_BITSET_WORD_SIZE] |= \
+  (1UL << ((iBit) % FMB_BITSET_WORD_SIZE)))
+
+// Statistics of the Fourier-Motzkin elimination in the FMB
+// intersection tests (cf FMBElimStats)
+// Maximum number of eliminations in a test (3DTime)
+#define FMB_ELIM_NB_PASS 3
+
+// Number of bins of the histograms of the number of rows, the last one
+// counting the systems with FMB_ELIM_NB_BIN - 1 rows or more
+#define FMB_ELIM_NB_BIN 128
+
+// Record the end of a test at a stage, and the number of rows after
+// an elimination, into the statistics stats (cf FMBElimStatsAddStage,
+// FMBElimStatsAddRows)
+// The statistics are recorded only if FMB_ELIM_STATS is defined at
+// compilation, else these macros are empty and cost nothing
+#ifdef FMB_ELIM_STATS
+  #define FMB_ELIM_STATS_STAGE(stats, thatType, thoType, stage) \
+    FMBElimStatsAddStage(stats, thatType, thoType, stage)
+  #define FMB_ELIM_STATS_ROWS(stats, thatType, thoType, iPass, nbRows) \
+    FMBElimStatsAddRows(stats, thatType, thoType, iPass, nbRows)
+#else
+  #define FMB_ELIM_STATS_STAGE(stats, thatType, thoType, stage)
+  #define FMB_ELIM_STATS_ROWS(stats, thatType, thoType, iPass, nbRows)
+#endif
+
+// Value of the witness of a pair without witness in a FMBPairCache
+#define FMB_PAIR_CACHE_NONE -1
+
+// Axes used as filters by the hybrid intersection tests (cf
+// FMBHybridTestIntersection3D): the iFace-th bit selects the normal to
+// the iFace-th face of that (edge in 2D) and the (4 + iFace)-th bit
+// the normal to the iFace-th face of tho, the bits of faces a Frame
+// doesn't have being ignored (cf SATCheckFaces3D for the order of
+// the faces)
+#define FMB_HYBRID_AXES_NONE 0x00u
+#define FMB_HYBRID_AXES_THAT 0x0Fu
+#define FMB_HYBRID_AXES_THO 0xF0u
+#define FMB_HYBRID_AXES_ALL 0xFFu
+
+// Type of the real values in the Frames, SAT and FMB: double by
+// default, float if FMB_REAL_FLOAT is defined at compilation (cf
+// PRECISION in the Makefiles)
+// FMB_EPSILON is the tolerance of the numerical imprecision used by
+// the algorithms, scaled to the precision
+// FMB_REAL_NAME is the name of the type, for display
+#ifdef FMB_REAL_FLOAT
+
+  typedef float FMB_REAL;
+  #define FMB_EPSILON 0.0001
+  #define FMB_REAL_NAME "float"
+
+#else
+
+  typedef double FMB_REAL;
+  #define FMB_EPSILON 0.0000001
+  #define FMB_REAL_NAME "double"
+
+#endif
+
+// Alignment in bytes of the arrays of Frame3DSoA, the size of the
+// widest vectors used by Frame3DSoAImportFrames (AVX-512)
+#define FRAME_SOA_ALIGN 64
+
+// Nb of Frames the arrays of Frame3DSoA are padded to, multiple of the
+// nb of FMB_REAL in FRAME_SOA_ALIGN bytes
+#define FRAME_SOA_PAD 16
+
 // ------------- Enumerations -------------
 
 typedef enum {
@@ -38,38 +123,87 @@ typedef enum {
 
 } FrameType;
 
+// Implementation of the hot paths selected at run time, in order of
+// preference: the generic one, and the ones compiled for the
+// instruction sets SSE2, AVX2 and AVX-512 with vectors of 128, 256 and
+// 512 bits
+typedef enum {
+
+  FrameCPUGeneric,
+  FrameCPUSSE2,
+  FrameCPUAVX2,
+  FrameCPUAVX512,
+  FrameCPUNb
+
+} FrameCPUPath;
+
+// Stage of the FMB intersection tests at which a test ends
+// FMBElimStageInit: one of the constraints on tho can't be satisfied
+// by any X in [0,1] (checked while building the system)
+// FMBElimStagePass1..3: the system has become inconsistent during the
+// first, second or third elimination
+// FMBElimStageBound: the bounds of the last variable are inconsistent
+// FMBElimStageInter: the Frames are intersecting
+typedef enum {
+
+  FMBElimStageInit,
+  FMBElimStagePass1,
+  FMBElimStagePass2,
+  FMBElimStagePass3,
+  FMBElimStageBound,
+  FMBElimStageInter,
+  FMBElimStageNb
+
+} FMBElimStage;
+
+// Order of elimination of the variables in the FMB intersection tests
+// FMBElimOrderFixed: the variables are eliminated in the order of the
+// axes
+// FMBElimOrderAdaptive: at each elimination the eliminated variable
+// is the one giving the smallest resulting system, i.e. the one
+// minimizing p.n+z where p, n and z are the numbers of rows with a
+// positive, negative and null coefficient of this variable
+// Both give the same intersection results, the bounding boxes may be
+// different (both containing the intersection)
+typedef enum {
+
+  FMBElimOrderFixed,
+  FMBElimOrderAdaptive
+
+} FMBElimOrder;
+
 // ------------- Data structures -------------
 
 // Axis aligned bounding box structure
 typedef struct {
 
   // x, y
-  double min[2];
-  double max[2];
+  FMB_REAL min[2];
+  FMB_REAL max[2];
 
 } AABB2D;
 
 typedef struct {
 
   // x, y, z
-  double min[3];
-  double max[3];
+  FMB_REAL min[3];
+  FMB_REAL max[3];
 
 } AABB3D;
 
 typedef struct {
 
   // x, y, t
-  double min[3];
-  double max[3];
+  FMB_REAL min[3];
+  FMB_REAL max[3];
 
 } AABB2DTime;
 
 typedef struct {
 
   // x, y, z, t
-  double min[4];
-  double max[4];
+  FMB_REAL min[4];
+  FMB_REAL max[4];
 
 } AABB3DTime;
 
@@ -77,28 +211,28 @@ typedef struct {
 typedef struct {
 
   FrameType type;
-  double orig[2];
-  double comp[2][2];
+  FMB_REAL orig[2];
+  FMB_REAL comp[2][2];
 
   // AABB of the frame
   AABB2D bdgBox;
 
   // Inverted components used during computation
-  double invComp[2][2];
+  FMB_REAL invComp[2][2];
 
 } Frame2D;
 
 typedef struct {
 
   FrameType type;
-  double orig[3];
-  double comp[3][3];
+  FMB_REAL orig[3];
+  FMB_REAL comp[3][3];
 
   // AABB of the frame
   AABB3D bdgBox;
 
   // Inverted components used during computation
-  double invComp[3][3];
+  FMB_REAL invComp[3][3];
 
   // Flag to memorize if it's a face
   bool isFace;
@@ -108,36 +242,151 @@ typedef struct {
 typedef struct {
 
   FrameType type;
-  double orig[2];
-  double comp[2][2];
+  FMB_REAL orig[2];
+  FMB_REAL comp[2][2];
 
   // AABB of the frame
   AABB2DTime bdgBox;
 
   // Inverted components used during computation
-  double invComp[2][2];
-  double speed[2];
+  FMB_REAL invComp[2][2];
+  FMB_REAL speed[2];
 
 } Frame2DTime;
 
 typedef struct {
 
   FrameType type;
-  double orig[3];
-  double comp[3][3];
+  FMB_REAL orig[3];
+  FMB_REAL comp[3][3];
 
   // AABB of the frame
   AABB3DTime bdgBox;
 
   // Inverted components used during computation
-  double invComp[3][3];
-  double speed[3];
+  FMB_REAL invComp[3][3];
+  FMB_REAL speed[3];
 
   // Flag to memorize if it's a face
   bool isFace;
 
 } Frame3DTime;
 
+// Structure of arrays memorizing a set of Frame3D, each field of the
+// Frame is stored in its own contiguous array (for example orig[0][i]
+// is the first coordinate of the origin of the i-th Frame) to allow
+// the vectorized projection of several Frames at once
+// The arrays are aligned on FRAME_SOA_ALIGN bytes and padded to a
+// multiple of FRAME_SOA_PAD Frames
+typedef struct {
+
+  // Number of Frames
+  int nb;
+
+  // Number of Frames including the padding
+  int nbPad;
+
+  // Types of the Frames
+  FrameType* type;
+
+  // Origins, orig[iAxis][iFrame]
+  FMB_REAL* orig[3];
+
+  // Components, comp[iComp][iAxis][iFrame]
+  FMB_REAL* comp[3][3];
+
+  // Inverted components, invComp[iComp][iAxis][iFrame]
+  FMB_REAL* invComp[3][3];
+
+  // AABB of the Frames, bdgBoxMin[iAxis][iFrame]
+  FMB_REAL* bdgBoxMin[3];
+  FMB_REAL* bdgBoxMax[3];
+
+  // Flags to memorize if the Frames are faces
+  bool* isFace;
+
+  // Memory block holding all the FMB_REAL arrays
+  FMB_REAL* data;
+
+} Frame3DSoA;
+
+// Statistics of the pruning of redundant rows between the
+// eliminations of variables in the FMB intersection tests
+// (cf FMBSetPruning3D, FMBSetPruning3DTime)
+typedef struct {
+
+  // Nb of rows given to the pruning
+  unsigned long nbRows;
+
+  // Nb of rows removed because identical to another one
+  unsigned long nbDuplicate;
+
+  // Nb of rows removed because they have the same coefficients as
+  // another one and a greater right side
+  unsigned long nbDominated;
+
+  // Nb of rows removed because satisfied by any X in [0,1]
+  unsigned long nbTrivial;
+
+} FMBPruneStats;
+
+// Statistics of the Fourier-Motzkin elimination in the FMB
+// intersection tests, per pair of types [thatType][thoType]
+// Recorded only if FMB_ELIM_STATS is defined at compilation (cf
+// FMBGetElimStats2D, FMBGetElimStats3D, ...)
+typedef struct {
+
+  // Nb of tests ended at each stage
+  unsigned long nbStage[2][2][FMBElimStageNb];
+
+  // Histograms of the nb of rows of the system resulting from each
+  // elimination, [iPass][nbRows]
+  unsigned long histoRows[2][2][FMB_ELIM_NB_PASS][FMB_ELIM_NB_BIN];
+
+  // Maximum nb of rows of the system resulting from each elimination,
+  // ie the peak occupancy of the buffers Mp, Mpp, Mppp
+  int maxRows[2][2][FMB_ELIM_NB_PASS];
+
+} FMBElimStats;
+
+// Slot of a FMBPairCache
+typedef struct {
+
+  // Identifiers of the pair memorized in the slot, given by the caller
+  unsigned long idThat;
+  unsigned long idTho;
+
+  // Witness of the separation of the pair, FMB_PAIR_CACHE_NONE if the
+  // pair was intersecting or no witness was found
+  int witness;
+
+} FMBPairCacheSlot;
+
+// Cache of the witnesses of separation of pairs of Frames between
+// successive intersection tests (cf SATTestIntersection3DCached,
+// FMBTestIntersection3DCached)
+// The cache is direct mapped: a pair is memorized in the slot given by
+// the hash of its identifiers, replacing the pair previously memorized
+// in that slot, if any. Use several slots per pair (for example 4) to
+// limit the collisions
+// The meaning of the witness depends on the test using the cache,
+// hence a cache must be used by only one test
+typedef struct {
+
+  // Nb of slots, power of 2
+  int nbSlot;
+
+  // Slots
+  FMBPairCacheSlot* slots;
+
+  // Nb of tests where the witness was still separating the pair, and
+  // nb of tests where the pair had no witness or the witness wasn't
+  // separating it anymore (updated by the tests using the cache)
+  unsigned long nbHit;
+  unsigned long nbMiss;
+
+} FMBPairCache;
+
 // ------------- Functions declaration -------------
 
 // Print the AABB that on stdout
@@ -166,42 +415,196 @@ void Frame3DTimePrint(const Frame3DTime* const that);
 // and speed
 Frame2D Frame2DCreateStatic(
   const FrameType type,
-  const double orig[2],
-  const double comp[2][2]);
+  const FMB_REAL orig[2],
+  const FMB_REAL comp[2][2]);
 Frame3D Frame3DCreateStatic(
   const FrameType type,
-  const double orig[3],
-  const double comp[3][3]);
+  const FMB_REAL orig[3],
+  const FMB_REAL comp[3][3]);
 Frame2DTime Frame2DTimeCreateStatic(
   const FrameType type,
-  const double orig[2],
-  const double speed[2],
-  const double comp[2][2]);
+  const FMB_REAL orig[2],
+  const FMB_REAL speed[2],
+  const FMB_REAL comp[2][2]);
 Frame3DTime Frame3DTimeCreateStatic(
   const FrameType type,
-  const double orig[3],
-  const double speed[3],
-  const double comp[3][3]);
+  const FMB_REAL orig[3],
+  const FMB_REAL speed[3],
+  const FMB_REAL comp[3][3]);
+
+// Translate the Frame that by the vector v
+// The components are not modified, so the inverse components are
+// kept as is and only the bounding box is updated
+void Frame2DTranslate(
+  Frame2D* const that,
+  const FMB_REAL v[2]);
+void Frame3DTranslate(
+  Frame3D* const that,
+  const FMB_REAL v[3]);
+void Frame2DTimeTranslate(
+  Frame2DTime* const that,
+  const FMB_REAL v[2]);
+void Frame3DTimeTranslate(
+  Frame3DTime* const that,
+  const FMB_REAL v[3]);
+
+// Rotate the components of the Frame that around its origin by the
+// angle theta (in radians), around the axis 'axis' in 3D (which
+// doesn't need to be normalized)
+// The speed of the moving Frames is not modified
+// The bounding box and inverse components are updated only if theta
+// is not null
+void Frame2DRotate(
+  Frame2D* const that,
+  const FMB_REAL theta);
+void Frame3DRotate(
+  Frame3D* const that,
+  const FMB_REAL axis[3],
+  const FMB_REAL theta);
+void Frame2DTimeRotate(
+  Frame2DTime* const that,
+  const FMB_REAL theta);
+void Frame3DTimeRotate(
+  Frame3DTime* const that,
+  const FMB_REAL axis[3],
+  const FMB_REAL theta);
+
+// Set the components of the Frame that to comp ([iComp][iAxis])
+// The bounding box and inverse components are updated only if comp
+// differs from the current components
+void Frame2DSetComp(
+  Frame2D* const that,
+  const FMB_REAL comp[2][2]);
+void Frame3DSetComp(
+  Frame3D* const that,
+  const FMB_REAL comp[3][3]);
+void Frame2DTimeSetComp(
+  Frame2DTime* const that,
+  const FMB_REAL comp[2][2]);
+void Frame3DTimeSetComp(
+  Frame3DTime* const that,
+  const FMB_REAL comp[3][3]);
+
+// Set the origin and speed of the moving Frame that to orig and speed
+// The components are not modified, so the inverse components are
+// kept as is and only the bounding box is updated
+void Frame2DTimeSetMotion(
+  Frame2DTime* const that,
+  const FMB_REAL orig[2],
+  const FMB_REAL speed[2]);
+void Frame3DTimeSetMotion(
+  Frame3DTime* const that,
+  const FMB_REAL orig[3],
+  const FMB_REAL speed[3]);
 
 // Project the Frame Q in the Frame P's coordinates system and
 // memorize the result in the Frame Qp
+// The inverse components of P are not recomputed, they are kept up to
+// date by the functions creating and modifying the Frame, hence the
+// Frame P must not be modified by any other mean
 void Frame2DImportFrame(
-  Frame2D* const P,
+  const Frame2D* const P,
   const Frame2D* const Q,
   Frame2D* const Qp);
 void Frame3DImportFrame(
-  Frame3D* const P,
+  const Frame3D* const P,
   const Frame3D* const Q,
   Frame3D* const Qp);
 void Frame2DTimeImportFrame(
-  Frame2DTime* const P,
+  const Frame2DTime* const P,
   const Frame2DTime* const Q,
   Frame2DTime* const Qp);
 void Frame3DTimeImportFrame(
-  Frame3DTime* const P,
+  const Frame3DTime* const P,
+  const Frame3DTime* const Q,
+  Frame3DTime* const Qp);
+
+// Project the nb Frames Q in the Frame P's coordinates system and
+// memorize the results in the nb Frames Qp
+// The type, origin, components (and speed) of Qp are set, the
+// bounding box and inverse components are not
+void Frame2DImportFrames(
+  const Frame2D* const P,
+  const Frame2D* const Q,
+  const int nb,
+  Frame2D* const Qp);
+void Frame3DImportFrames(
+  const Frame3D* const P,
+  const Frame3D* const Q,
+  const int nb,
+  Frame3D* const Qp);
+void Frame2DTimeImportFrames(
+  const Frame2DTime* const P,
+  const Frame2DTime* const Q,
+  const int nb,
+  Frame2DTime* const Qp);
+void Frame3DTimeImportFrames(
+  const Frame3DTime* const P,
   const Frame3DTime* const Q,
+  const int nb,
   Frame3DTime* const Qp);
 
+// Create a Frame3DSoA able to memorize nb Frames, all set to null
+// Frames of type FrameCuboid
+Frame3DSoA* Frame3DSoACreate(const int nb);
+
+// Free the memory used by the Frame3DSoA that
+void Frame3DSoAFree(Frame3DSoA** that);
+
+// Copy the Frame frame into the iFrame-th Frame of the Frame3DSoA that
+void Frame3DSoASet(
+  Frame3DSoA* const that,
+  const int iFrame,
+  const Frame3D* const frame);
+
+// Copy the iFrame-th Frame of the Frame3DSoA that into the Frame frame
+void Frame3DSoAGet(
+  const Frame3DSoA* const that,
+  const int iFrame,
+  Frame3D* const frame);
+
+// Project the Frames of the Frame3DSoA Q in the Frame P's coordinates
+// system and memorize the results in the Frame3DSoA Qp (which must have
+// the same number of Frames as Q)
+// The type, origin and components of Qp are set, the bounding box,
+// inverse components and face flag are not
+// The projection is vectorized on Frame3DSoASIMDWidth() Frames and
+// performs the same operations in the same order as
+// Frame3DImportFrame, hence the results are identical
+// as long as the compiler doesn't contract the multiplications and
+// additions into FMA instructions (which it doesn't with the default
+// build options), else they differ by at most a few rounding errors
+void Frame3DSoAImportFrames(
+  const Frame3D* const P,
+  const Frame3DSoA* const Q,
+  Frame3DSoA* const Qp);
+
+// Return the number of Frames projected per instruction by
+// Frame3DSoAImportFrames with the current FrameCPUPath: 1 for the
+// generic path, and 2, 4 and 8 doubles or 4, 8 and 16 floats for the
+// SSE2, AVX2 and AVX-512 paths
+int Frame3DSoASIMDWidth(void);
+
+// Return the best implementation of the hot paths supported by the CPU
+// and the OS
+FrameCPUPath FrameGetBestCPUPath(void);
+
+// Return the implementation of the hot paths currently used
+// At load time it is FrameGetBestCPUPath(), unless the environment
+// variable FMB_CPU_PATH is set to the name of another path (cf
+// FrameGetCPUPathName) supported by the CPU, unknown or unsupported
+// values are ignored
+FrameCPUPath FrameGetCPUPath(void);
+
+// Set the implementation of the hot paths used by all the threads,
+// must not be called while another thread is running a test
+// Return true if the path is supported by the CPU and has been set,
+// else false and the current path is not modified
+bool FrameSetCPUPath(const FrameCPUPath path);
+
+// Return the name of the path: "generic", "sse2", "avx2" or "avx512"
+const char* FrameGetCPUPathName(const FrameCPUPath path);
+
 // Export the AABB bdgBox from that's coordinates system to
 // the real coordinates system and update bdgBoxProj with the resulting
 // AABB
@@ -234,10 +637,76 @@ bool AABBTestIntersection3D(
   const AABB3D* const that,
   const AABB3D* const tho);
 
-// Power function for integer base and exponent
-// Return base^exp
-int powi(
-  int base,
-  unsigned int exp);
+// Check the intersection between two AABB of moving Frames that and
+// tho, along the spatial axes and the time axis (the bounding box of a
+// moving Frame covers its displacement during [0,1], cf
+// Frame2DTimeCreateStatic)
+bool AABBTestIntersection2DTime(
+  const AABB2DTime* const that,
+  const AABB2DTime* const tho);
+bool AABBTestIntersection3DTime(
+  const AABB3DTime* const that,
+  const AABB3DTime* const tho);
+
+// Reset the statistics of the elimination that
+void FMBElimStatsReset(FMBElimStats* const that);
+
+// Record into the statistics of the elimination that the end at the
+// stage stage of a test between Frames of types thatType and thoType
+void FMBElimStatsAddStage(
+  FMBElimStats* const that,
+  const FrameType thatType,
+  const FrameType thoType,
+  const FMBElimStage stage);
+
+// Record into the statistics of the elimination that the nb of rows
+// nbRows of the system resulting from the elimination iPass (starting
+// at 0) in a test between Frames of types thatType and thoType
+void FMBElimStatsAddRows(
+  FMBElimStats* const that,
+  const FrameType thatType,
+  const FrameType thoType,
+  const int iPass,
+  const int nbRows);
+
+// Return the name of the stage
+const char* FMBElimStageGetName(const FMBElimStage stage);
+
+// Print the statistics of the elimination that on the stream stream:
+// for each pair of types with at least one test, the percentage of
+// tests ended at each stage and, for each elimination, the average,
+// 99th percentile and maximum nb of rows of the resulting system
+void FMBElimStatsPrint(
+  const FMBElimStats* const that,
+  FILE* const stream);
+
+// Create a new FMBPairCache with at least nbSlot slots (rounded up to
+// a power of 2), all empty
+FMBPairCache* FMBPairCacheCreate(const int nbSlot);
+
+// Free the memory used by the FMBPairCache that
+void FMBPairCacheFree(FMBPairCache** that);
+
+// Empty all the slots of the FMBPairCache that and reset its
+// statistics
+void FMBPairCacheClear(FMBPairCache* const that);
+
+// Return the witness memorized in the FMBPairCache that for the pair
+// (idThat, idTho), or FMB_PAIR_CACHE_NONE if the pair is not in the
+// cache or has no witness
+int FMBPairCacheGet(
+  const FMBPairCache* const that,
+  const unsigned long idThat,
+  const unsigned long idTho);
+
+// Memorize the witness for the pair (idThat, idTho) in the
+// FMBPairCache that
+// FMB_PAIR_CACHE_NONE doesn't replace the witness of another pair
+// memorized in the same slot
+void FMBPairCacheSet(
+  FMBPairCache* const that,
+  const unsigned long idThat,
+  const unsigned long idTho,
+  const int witness);
 
 #endif
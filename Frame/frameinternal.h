@@ -0,0 +1,249 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Implementation details shared by the source files of the library,
+// not installed with the public headers
+
+#ifndef __FRAMEINTERNAL_H_
+#define __FRAMEINTERNAL_H_
+
+// ------------- Includes -------------
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include "frame.h"
+
+// ------------- Macros -------------
+
+// Implementations of the hot paths (FMBTestIntersection*,
+// SATTestIntersection*, Frame*ImportFrame*) for each FrameCPUPath:
+// the same code compiled with the instruction set of the path, and
+// every function it calls in its translation unit inlined into it.
+// FRAME_CPU_VARIANTS(ret, name, params, args) defines name##SSE2,
+// name##AVX2 and name##AVX512 from name##Generic, and
+// FRAME_CPU_VARIANTS_VOID the same for a function returning void
+// FRAME_CPU_VARIANTS_PATH(ret, name, params, args) defines the four
+// variants from name##Path, which takes the FrameCPUPath as an
+// additional last argument, for the functions using the SIMD kernels
+// (cf framesimd.h): the path being a constant in each variant, the
+// kernel of the width of the path is selected at compilation
+// The contraction of multiplications and additions into FMA
+// instructions (available with AVX-512) is disabled, so that all the
+// paths give identical results
+// The variants are compiled only with gcc on x86, elsewhere they are
+// copies of the generic implementation and FrameGetBestCPUPath()
+// always returns FrameCPUGeneric
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+
+  #define FRAME_CPU_DISPATCH
+  #define FRAME_TARGET(isa) \
+    __attribute__(( \
+      target(isa), \
+      optimize("fp-contract=off"), \
+      flatten))
+  #define FRAME_TARGET_GENERIC __attribute__((flatten))
+  #define FRAME_TARGET_SSE2 FRAME_TARGET("sse2")
+  #define FRAME_TARGET_AVX2 FRAME_TARGET("avx2")
+  #define FRAME_TARGET_AVX512 FRAME_TARGET("avx512f")
+
+#else
+
+  #define FRAME_TARGET_GENERIC
+  #define FRAME_TARGET_SSE2
+  #define FRAME_TARGET_AVX2
+  #define FRAME_TARGET_AVX512
+
+#endif
+
+#define FRAME_CPU_VARIANTS(ret, name, params, args) \
+  FRAME_TARGET_SSE2 static ret name##SSE2 params { \
+    return name##Generic args; } \
+  FRAME_TARGET_AVX2 static ret name##AVX2 params { \
+    return name##Generic args; } \
+  FRAME_TARGET_AVX512 static ret name##AVX512 params { \
+    return name##Generic args; }
+
+#define FRAME_CPU_VARIANTS_VOID(name, params, args) \
+  FRAME_TARGET_SSE2 static void name##SSE2 params { \
+    name##Generic args; } \
+  FRAME_TARGET_AVX2 static void name##AVX2 params { \
+    name##Generic args; } \
+  FRAME_TARGET_AVX512 static void name##AVX512 params { \
+    name##Generic args; }
+
+#define FRAME_CPU_ARGS(...) __VA_ARGS__
+
+#define FRAME_CPU_VARIANTS_PATH(ret, name, params, args) \
+  FRAME_TARGET_GENERIC static ret name##Generic params { \
+    return name##Path(FRAME_CPU_ARGS args, FrameCPUGeneric); } \
+  FRAME_TARGET_SSE2 static ret name##SSE2 params { \
+    return name##Path(FRAME_CPU_ARGS args, FrameCPUSSE2); } \
+  FRAME_TARGET_AVX2 static ret name##AVX2 params { \
+    return name##Path(FRAME_CPU_ARGS args, FrameCPUAVX2); } \
+  FRAME_TARGET_AVX512 static ret name##AVX512 params { \
+    return name##Path(FRAME_CPU_ARGS args, FrameCPUAVX512); }
+
+#define FRAME_CPU_VARIANTS_PATH_VOID(name, params, args) \
+  FRAME_TARGET_GENERIC static void name##Generic params { \
+    name##Path(FRAME_CPU_ARGS args, FrameCPUGeneric); } \
+  FRAME_TARGET_SSE2 static void name##SSE2 params { \
+    name##Path(FRAME_CPU_ARGS args, FrameCPUSSE2); } \
+  FRAME_TARGET_AVX2 static void name##AVX2 params { \
+    name##Path(FRAME_CPU_ARGS args, FrameCPUAVX2); } \
+  FRAME_TARGET_AVX512 static void name##AVX512 params { \
+    name##Path(FRAME_CPU_ARGS args, FrameCPUAVX512); }
+
+// Nb of FMB_REAL per vector of the SIMD kernels for each FrameCPUPath,
+// and the largest one, which divides FRAME_SOA_PAD and whose vectors
+// are aligned on FRAME_SOA_ALIGN bytes
+#if defined(FRAME_CPU_DISPATCH) && defined(FMB_REAL_FLOAT)
+
+  #define FRAME_SIMD_WIDTH_SSE2 4
+  #define FRAME_SIMD_WIDTH_AVX2 8
+  #define FRAME_SIMD_WIDTH_AVX512 16
+
+#elif defined(FRAME_CPU_DISPATCH)
+
+  #define FRAME_SIMD_WIDTH_SSE2 2
+  #define FRAME_SIMD_WIDTH_AVX2 4
+  #define FRAME_SIMD_WIDTH_AVX512 8
+
+#else
+
+  #define FRAME_SIMD_WIDTH_SSE2 1
+  #define FRAME_SIMD_WIDTH_AVX2 1
+  #define FRAME_SIMD_WIDTH_AVX512 1
+
+#endif
+
+#define FRAME_SIMD_WIDTH_GENERIC 1
+#define FRAME_SIMD_WIDTH_MAX FRAME_SIMD_WIDTH_AVX512
+
+// Values of FRAME_SIMD_PATH selecting the FrameCPUPath of a SIMD
+// kernel (cf framesimd.h)
+#define FRAME_SIMD_GENERIC 0
+#define FRAME_SIMD_SSE2 1
+#define FRAME_SIMD_AVX2 2
+#define FRAME_SIMD_AVX512 3
+
+// Visibility of the functions shared by the source files of the
+// library, hidden so that libfmb.so doesn't export them
+#define FRAME_INTERNAL __attribute__((visibility("hidden")))
+
+// Define the FrameStats name of statistics of type type whose values
+// are added by the function mergeFun (cf FrameStats), and the function
+// name##Thread() returning the statistics of the calling thread, in
+// which the intersection tests accumulate their statistics
+#define FRAME_STATS_DEFINE(type, name, mergeFun) \
+  static FrameStats name = { \
+    .size = sizeof(type), \
+    .merge = mergeFun, \
+    .blocks = NULL, \
+    .retired = NULL}; \
+  static _Thread_local type* name##Block = NULL; \
+  static inline type* name##Thread(void) { \
+    if (name##Block == NULL) { \
+      name##Block = FrameStatsAddThread(&name); } \
+    return name##Block; }
+
+// ------------- Data structures -------------
+
+// Block of statistics of one thread (cf FrameStats)
+typedef struct FrameStatsBlock FrameStatsBlock;
+
+// Statistics updated by the intersection tests from several threads:
+// each thread accumulates them without synchronization in its own
+// block, and the blocks are added together when the statistics are
+// read. The block of a thread is added to the retired statistics when
+// the thread exits
+// FrameStatsGet and FrameStatsReset must not be called while another
+// thread is running an intersection test, they would read or reset its
+// block at the same time as it updates it
+typedef struct {
+
+  // Size in bytes of the statistics
+  size_t size;
+
+  // Function adding the statistics from to the statistics to
+  void (*merge)(
+    void* const to,
+    const void* const from);
+
+  // Blocks of the running threads
+  FrameStatsBlock* blocks;
+
+  // Statistics of the exited threads, null if there is none
+  void* retired;
+
+} FrameStats;
+
+// ------------- Functions declaration -------------
+
+// Create the block of statistics of the calling thread for the
+// FrameStats that, with all the statistics null, and return its
+// statistics (cf FRAME_STATS_DEFINE)
+FRAME_INTERNAL void* FrameStatsAddThread(FrameStats* const that);
+
+// Add the statistics of all the threads of the FrameStats that into
+// stats, which is first set to null statistics
+FRAME_INTERNAL void FrameStatsGet(
+  FrameStats* const that,
+  void* const stats);
+
+// Set the statistics of all the threads of the FrameStats that to null
+// statistics
+FRAME_INTERNAL void FrameStatsReset(FrameStats* const that);
+
+// Add the FMBPruneStats from to the FMBPruneStats to
+FRAME_INTERNAL void FMBPruneStatsMerge(
+  void* const to,
+  const void* const from);
+
+// Add the FMBElimStats from to the FMBElimStats to
+FRAME_INTERNAL void FMBElimStatsMerge(
+  void* const to,
+  const void* const from);
+
+// Check the intersection constraint for Frames that and tho,
+// both faces, relatively to axis (cf sat.c)
+FRAME_INTERNAL bool CheckAxis3DFace(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  const FMB_REAL* const axis);
+
+// Return the nb of FMB_REAL per vector of the SIMD kernels for the
+// FrameCPUPath path
+static inline int FrameSIMDWidth(const FrameCPUPath path) {
+
+  switch (path) {
+
+    case FrameCPUSSE2:
+      return FRAME_SIMD_WIDTH_SSE2;
+    case FrameCPUAVX2:
+      return FRAME_SIMD_WIDTH_AVX2;
+    case FrameCPUAVX512:
+      return FRAME_SIMD_WIDTH_AVX512;
+    default:
+      return FRAME_SIMD_WIDTH_GENERIC;
+
+  }
+
+}
+
+#endif
@@ -0,0 +1,210 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Vector operations of the SIMD kernels for the FrameCPUPath selected
+// by FRAME_SIMD_PATH (one of FRAME_SIMD_GENERIC, FRAME_SIMD_SSE2,
+// FRAME_SIMD_AVX2, FRAME_SIMD_AVX512, cf frameinternal.h)
+// Not protected against multiple inclusion: the templates of the
+// kernels include it at their beginning and undefine FRAME_SIMD_PATH
+// at their end, and the source files include each template once per
+// FrameCPUPath, as follows:
+//   #define FRAME_SIMD_PATH FRAME_SIMD_AVX2
+//   #include "fmb3dsimd.h"
+// FRAME_SIMD_WIDTH is the nb of FMB_REAL per vector, FrameSIMD the
+// type of the vectors, FRAME_SIMD_NAME(name) suffixes name with the
+// name of the path (Generic, SSE2, AVX2, AVX512) and FRAME_SIMD_TARGET
+// compiles the kernel with the instruction set of the path
+// Load and Store require addresses aligned on FRAME_SOA_ALIGN bytes
+// FrameSIMDAnyLt(a, b) is true if any lane of a is lower than the
+// same lane of b
+
+// ------------- Includes -------------
+
+#include "frameinternal.h"
+#ifdef FRAME_CPU_DISPATCH
+  #include <immintrin.h>
+#endif
+
+// ------------- Macros -------------
+
+#ifndef FRAME_SIMD_PATH
+  #error "FRAME_SIMD_PATH must be defined before including framesimd.h"
+#endif
+
+#undef FRAME_SIMD_WIDTH
+#undef FRAME_SIMD_SUFFIX
+#undef FRAME_SIMD_TARGET
+#undef FrameSIMD
+#undef FrameSIMDLoad
+#undef FrameSIMDStore
+#undef FrameSIMDSet1
+#undef FrameSIMDZero
+#undef FrameSIMDAdd
+#undef FrameSIMDSub
+#undef FrameSIMDMul
+#undef FrameSIMDMin
+#undef FrameSIMDMax
+#undef FrameSIMDAnyLt
+
+#define FRAME_SIMD_CAT_(a, b) a##b
+#define FRAME_SIMD_CAT(a, b) FRAME_SIMD_CAT_(a, b)
+#define FRAME_SIMD_NAME(name) FRAME_SIMD_CAT(name, FRAME_SIMD_SUFFIX)
+
+#if FRAME_SIMD_PATH == FRAME_SIMD_AVX512 && \
+  defined(FRAME_CPU_DISPATCH) && defined(FMB_REAL_FLOAT)
+
+  #define FRAME_SIMD_WIDTH FRAME_SIMD_WIDTH_AVX512
+  #define FRAME_SIMD_SUFFIX AVX512
+  #define FRAME_SIMD_TARGET FRAME_TARGET_AVX512
+  #define FrameSIMD __m512
+  #define FrameSIMDLoad(p) _mm512_load_ps(p)
+  #define FrameSIMDStore(p, a) _mm512_store_ps(p, a)
+  #define FrameSIMDSet1(x) _mm512_set1_ps(x)
+  #define FrameSIMDZero() _mm512_setzero_ps()
+  #define FrameSIMDAdd(a, b) _mm512_add_ps(a, b)
+  #define FrameSIMDSub(a, b) _mm512_sub_ps(a, b)
+  #define FrameSIMDMul(a, b) _mm512_mul_ps(a, b)
+  #define FrameSIMDMin(a, b) _mm512_min_ps(a, b)
+  #define FrameSIMDMax(a, b) _mm512_max_ps(a, b)
+  #define FrameSIMDAnyLt(a, b) \
+    (_mm512_cmp_ps_mask(a, b, _CMP_LT_OQ) != 0)
+
+#elif FRAME_SIMD_PATH == FRAME_SIMD_AVX512 && \
+  defined(FRAME_CPU_DISPATCH)
+
+  #define FRAME_SIMD_WIDTH FRAME_SIMD_WIDTH_AVX512
+  #define FRAME_SIMD_SUFFIX AVX512
+  #define FRAME_SIMD_TARGET FRAME_TARGET_AVX512
+  #define FrameSIMD __m512d
+  #define FrameSIMDLoad(p) _mm512_load_pd(p)
+  #define FrameSIMDStore(p, a) _mm512_store_pd(p, a)
+  #define FrameSIMDSet1(x) _mm512_set1_pd(x)
+  #define FrameSIMDZero() _mm512_setzero_pd()
+  #define FrameSIMDAdd(a, b) _mm512_add_pd(a, b)
+  #define FrameSIMDSub(a, b) _mm512_sub_pd(a, b)
+  #define FrameSIMDMul(a, b) _mm512_mul_pd(a, b)
+  #define FrameSIMDMin(a, b) _mm512_min_pd(a, b)
+  #define FrameSIMDMax(a, b) _mm512_max_pd(a, b)
+  #define FrameSIMDAnyLt(a, b) \
+    (_mm512_cmp_pd_mask(a, b, _CMP_LT_OQ) != 0)
+
+#elif FRAME_SIMD_PATH == FRAME_SIMD_AVX2 && \
+  defined(FRAME_CPU_DISPATCH) && defined(FMB_REAL_FLOAT)
+
+  #define FRAME_SIMD_WIDTH FRAME_SIMD_WIDTH_AVX2
+  #define FRAME_SIMD_SUFFIX AVX2
+  #define FRAME_SIMD_TARGET FRAME_TARGET_AVX2
+  #define FrameSIMD __m256
+  #define FrameSIMDLoad(p) _mm256_load_ps(p)
+  #define FrameSIMDStore(p, a) _mm256_store_ps(p, a)
+  #define FrameSIMDSet1(x) _mm256_set1_ps(x)
+  #define FrameSIMDZero() _mm256_setzero_ps()
+  #define FrameSIMDAdd(a, b) _mm256_add_ps(a, b)
+  #define FrameSIMDSub(a, b) _mm256_sub_ps(a, b)
+  #define FrameSIMDMul(a, b) _mm256_mul_ps(a, b)
+  #define FrameSIMDMin(a, b) _mm256_min_ps(a, b)
+  #define FrameSIMDMax(a, b) _mm256_max_ps(a, b)
+  #define FrameSIMDAnyLt(a, b) \
+    (_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LT_OQ)) != 0)
+
+#elif FRAME_SIMD_PATH == FRAME_SIMD_AVX2 && \
+  defined(FRAME_CPU_DISPATCH)
+
+  #define FRAME_SIMD_WIDTH FRAME_SIMD_WIDTH_AVX2
+  #define FRAME_SIMD_SUFFIX AVX2
+  #define FRAME_SIMD_TARGET FRAME_TARGET_AVX2
+  #define FrameSIMD __m256d
+  #define FrameSIMDLoad(p) _mm256_load_pd(p)
+  #define FrameSIMDStore(p, a) _mm256_store_pd(p, a)
+  #define FrameSIMDSet1(x) _mm256_set1_pd(x)
+  #define FrameSIMDZero() _mm256_setzero_pd()
+  #define FrameSIMDAdd(a, b) _mm256_add_pd(a, b)
+  #define FrameSIMDSub(a, b) _mm256_sub_pd(a, b)
+  #define FrameSIMDMul(a, b) _mm256_mul_pd(a, b)
+  #define FrameSIMDMin(a, b) _mm256_min_pd(a, b)
+  #define FrameSIMDMax(a, b) _mm256_max_pd(a, b)
+  #define FrameSIMDAnyLt(a, b) \
+    (_mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_LT_OQ)) != 0)
+
+#elif FRAME_SIMD_PATH == FRAME_SIMD_SSE2 && \
+  defined(FRAME_CPU_DISPATCH) && defined(FMB_REAL_FLOAT)
+
+  #define FRAME_SIMD_WIDTH FRAME_SIMD_WIDTH_SSE2
+  #define FRAME_SIMD_SUFFIX SSE2
+  #define FRAME_SIMD_TARGET FRAME_TARGET_SSE2
+  #define FrameSIMD __m128
+  #define FrameSIMDLoad(p) _mm_load_ps(p)
+  #define FrameSIMDStore(p, a) _mm_store_ps(p, a)
+  #define FrameSIMDSet1(x) _mm_set1_ps(x)
+  #define FrameSIMDZero() _mm_setzero_ps()
+  #define FrameSIMDAdd(a, b) _mm_add_ps(a, b)
+  #define FrameSIMDSub(a, b) _mm_sub_ps(a, b)
+  #define FrameSIMDMul(a, b) _mm_mul_ps(a, b)
+  #define FrameSIMDMin(a, b) _mm_min_ps(a, b)
+  #define FrameSIMDMax(a, b) _mm_max_ps(a, b)
+  #define FrameSIMDAnyLt(a, b) \
+    (_mm_movemask_ps(_mm_cmplt_ps(a, b)) != 0)
+
+#elif FRAME_SIMD_PATH == FRAME_SIMD_SSE2 && \
+  defined(FRAME_CPU_DISPATCH)
+
+  #define FRAME_SIMD_WIDTH FRAME_SIMD_WIDTH_SSE2
+  #define FRAME_SIMD_SUFFIX SSE2
+  #define FRAME_SIMD_TARGET FRAME_TARGET_SSE2
+  #define FrameSIMD __m128d
+  #define FrameSIMDLoad(p) _mm_load_pd(p)
+  #define FrameSIMDStore(p, a) _mm_store_pd(p, a)
+  #define FrameSIMDSet1(x) _mm_set1_pd(x)
+  #define FrameSIMDZero() _mm_setzero_pd()
+  #define FrameSIMDAdd(a, b) _mm_add_pd(a, b)
+  #define FrameSIMDSub(a, b) _mm_sub_pd(a, b)
+  #define FrameSIMDMul(a, b) _mm_mul_pd(a, b)
+  #define FrameSIMDMin(a, b) _mm_min_pd(a, b)
+  #define FrameSIMDMax(a, b) _mm_max_pd(a, b)
+  #define FrameSIMDAnyLt(a, b) \
+    (_mm_movemask_pd(_mm_cmplt_pd(a, b)) != 0)
+
+#else
+
+  // Generic path, and all the paths where the variants are copies of
+  // the generic implementation (cf FRAME_CPU_DISPATCH)
+  #define FRAME_SIMD_WIDTH 1
+  #if FRAME_SIMD_PATH == FRAME_SIMD_AVX512
+    #define FRAME_SIMD_SUFFIX AVX512
+  #elif FRAME_SIMD_PATH == FRAME_SIMD_AVX2
+    #define FRAME_SIMD_SUFFIX AVX2
+  #elif FRAME_SIMD_PATH == FRAME_SIMD_SSE2
+    #define FRAME_SIMD_SUFFIX SSE2
+  #else
+    #define FRAME_SIMD_SUFFIX Generic
+  #endif
+  #define FRAME_SIMD_TARGET
+  #define FrameSIMD FMB_REAL
+  #define FrameSIMDLoad(p) (*(p))
+  #define FrameSIMDStore(p, a) (*(p) = (a))
+  #define FrameSIMDSet1(x) (x)
+  #define FrameSIMDZero() 0.0
+  #define FrameSIMDAdd(a, b) ((a) + (b))
+  #define FrameSIMDSub(a, b) ((a) - (b))
+  #define FrameSIMDMul(a, b) ((a) * (b))
+  #define FrameSIMDMin(a, b) ((a) < (b) ? (a) : (b))
+  #define FrameSIMDMax(a, b) ((a) > (b) ? (a) : (b))
+  #define FrameSIMDAnyLt(a, b) ((a) < (b))
+
+#endif
@@ -0,0 +1,131 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Template of Frame3DSoAImportFrames for the FrameCPUPath selected by
+// FRAME_SIMD_PATH, included once per path by frame.c (cf framesimd.h)
+
+// ------------- Includes -------------
+
+#include "framesimd.h"
+
+// ------------- Functions implementation -------------
+
+// Project the Frames of the Frame3DSoA Q in the Frame P's coordinates
+// system and memorize the results in the Frame3DSoA Qp
+FRAME_SIMD_TARGET static void FRAME_SIMD_NAME(Frame3DSoAImportFrames)(
+  const Frame3D* const P,
+  const Frame3DSoA* const Q,
+  Frame3DSoA* const Qp) {
+
+  // Broadcast P's origin and inverse components
+  FrameSIMD po[3];
+  FrameSIMD pi[3][3];
+  for (
+    int i = 3;
+    i--;) {
+
+    po[i] = FrameSIMDSet1(P->orig[i]);
+
+    for (
+      int j = 3;
+      j--;) {
+
+      pi[j][i] = FrameSIMDSet1(P->invComp[j][i]);
+
+    }
+
+  }
+
+  // Loop on the groups of FRAME_SIMD_WIDTH Frames, the arrays
+  // being padded there is no partial group to process
+  for (
+    int iFrame = 0;
+    iFrame < Q->nb;
+    iFrame += FRAME_SIMD_WIDTH) {
+
+    // Load the origins and components of the group
+    FrameSIMD v[3];
+    FrameSIMD qc[3][3];
+    for (
+      int i = 3;
+      i--;) {
+
+      v[i] =
+        FrameSIMDSub(
+          FrameSIMDLoad(Q->orig[i] + iFrame),
+          po[i]);
+
+      for (
+        int j = 3;
+        j--;) {
+
+        qc[i][j] = FrameSIMDLoad(Q->comp[i][j] + iFrame);
+
+      }
+
+    }
+
+    // Calculate the projection, in the same order as
+    // Frame3DImportFrame to get identical results
+    for (
+      int i = 3;
+      i--;) {
+
+      FrameSIMD qpo = FrameSIMDZero();
+
+      for (
+        int j = 3;
+        j--;) {
+
+        qpo =
+          FrameSIMDAdd(
+            qpo,
+            FrameSIMDMul(pi[j][i], v[j]));
+
+        FrameSIMD qpc = FrameSIMDZero();
+
+        for (
+          int k = 3;
+          k--;) {
+
+          qpc =
+            FrameSIMDAdd(
+              qpc,
+              FrameSIMDMul(pi[k][i], qc[j][k]));
+
+        }
+
+        FrameSIMDStore(Qp->comp[j][i] + iFrame, qpc);
+
+      }
+
+      FrameSIMDStore(Qp->orig[i] + iFrame, qpo);
+
+    }
+
+  }
+
+  // Copy the types
+  memcpy(Qp->type, Q->type, sizeof(FrameType) * Q->nb);
+
+}
+
+// ------------- Macros -------------
+
+#undef FRAME_SIMD_PATH
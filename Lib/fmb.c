@@ -0,0 +1,46 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "fmb.h"
+
+// ------------- Functions implementation -------------
+
+// Return the size in bytes of FMB_REAL in the library, which must be
+// equal to sizeof(FMB_REAL) in the application
+size_t FMBGetRealSize(void) {
+
+  return sizeof(FMB_REAL);
+
+}
+
+// Return the version of the API of the library as
+// FMB_VERSION_MAJOR * 100 + FMB_VERSION_MINOR
+int FMBGetVersion(void) {
+
+  return FMB_VERSION_MAJOR * 100 + FMB_VERSION_MINOR;
+
+}
+
+// Return the options the library has been built with, which must be
+// equal to FMB_CONFIG in the application
+unsigned int FMBGetConfig(void) {
+
+  return FMB_CONFIG;
+
+}
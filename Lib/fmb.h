@@ -0,0 +1,88 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef __FMB_H_
+#define __FMB_H_
+
+// Public header of the FMB library (libfmb.a, libfmb.so), giving
+// access to all the variants of the intersection tests (2D, 2DTime,
+// 3D, 3DTime, 3DFace), the SAT tests and the broadphase in one process
+// The API is stable for a given FMB_VERSION_MAJOR, which is also the
+// version of the soname of the shared library
+
+// ------------- Macros -------------
+
+// Version of the API
+#define FMB_VERSION_MAJOR 1
+#define FMB_VERSION_MINOR 0
+
+// ------------- Includes -------------
+
+// Options the library has been built with (FMB_REAL_FLOAT for the
+// precision, cf FMB_REAL in frame.h, and FMB_ELIM_STATS for the
+// statistics of the elimination), generated at compilation
+#include "fmbconfig.h"
+
+#include "frame.h"
+#include "sat.h"
+#include "fmb2d.h"
+#include "fmb2dt.h"
+#include "fmb3d.h"
+#include "fmb3dt.h"
+#include "fmb3dface.h"
+#include "broadphase.h"
+#include "bvh.h"
+#include "pool.h"
+
+// ------------- Macros -------------
+
+// Bits of the options the library has been built with (cf
+// FMBGetConfig)
+#define FMB_CONFIG_REAL_FLOAT 0x01u
+#define FMB_CONFIG_ELIM_STATS 0x02u
+
+// Options seen by the application including fmb.h
+#ifdef FMB_REAL_FLOAT
+  #define FMB_CONFIG_REAL FMB_CONFIG_REAL_FLOAT
+#else
+  #define FMB_CONFIG_REAL 0x00u
+#endif
+#ifdef FMB_ELIM_STATS
+  #define FMB_CONFIG_STATS FMB_CONFIG_ELIM_STATS
+#else
+  #define FMB_CONFIG_STATS 0x00u
+#endif
+#define FMB_CONFIG (FMB_CONFIG_REAL | FMB_CONFIG_STATS)
+
+// ------------- Functions declaration -------------
+
+// Return the size in bytes of FMB_REAL in the library, which must be
+// equal to sizeof(FMB_REAL) in the application
+size_t FMBGetRealSize(void);
+
+// Return the version of the API of the library as
+// FMB_VERSION_MAJOR * 100 + FMB_VERSION_MINOR
+int FMBGetVersion(void);
+
+// Return the options the library has been built with (cf
+// FMB_CONFIG_REAL_FLOAT), which must be equal to FMB_CONFIG in the
+// application
+unsigned int FMBGetConfig(void);
+
+#endif
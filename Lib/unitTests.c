@@ -0,0 +1,252 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Include standard libraries
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+
+// Include the FMB library
+#include "fmb.h"
+
+// Check the result of a test and stop if it's not the expected one
+void CheckResult(
+  const char* const label,
+  const bool result,
+  const bool correctResult) {
+
+  if (result != correctResult) {
+
+    printf("UnitTestLib %s Failed\n", label);
+    printf("Expected : ");
+    if (correctResult == false) printf("no ");
+    printf("intersection\n");
+    printf("Got : ");
+    if (result == false) printf("no ");
+    printf("intersection\n");
+    exit(0);
+
+  }
+
+}
+
+// Unit test of the library
+// Run the intersection tests of all the variants in the same process
+// on pairs of Frames with known results
+void UnitTestLib(void) {
+
+  // Check the header and the library agree on the precision, the
+  // options and the version
+  if (
+    FMBGetRealSize() != sizeof(FMB_REAL) ||
+    FMBGetConfig() != FMB_CONFIG ||
+    FMBGetVersion() != FMB_VERSION_MAJOR * 100 + FMB_VERSION_MINOR) {
+
+    printf("UnitTestLib header and library mismatch\n");
+    exit(0);
+
+  }
+
+  // 2D: unit square against a square translated by (0.5, 0.5) or
+  // (2.0, 0.0)
+  FMB_REAL orig2D[2] = {0.0, 0.0};
+  FMB_REAL comp2D[2][2] = {{1.0, 0.0}, {0.0, 1.0}};
+  Frame2D P2D =
+    Frame2DCreateStatic(
+      FrameCuboid,
+      orig2D,
+      comp2D);
+  orig2D[0] = 0.5;
+  orig2D[1] = 0.5;
+  Frame2D Q2D =
+    Frame2DCreateStatic(
+      FrameCuboid,
+      orig2D,
+      comp2D);
+  orig2D[0] = 2.0;
+  orig2D[1] = 0.0;
+  Frame2D R2D =
+    Frame2DCreateStatic(
+      FrameCuboid,
+      orig2D,
+      comp2D);
+  CheckResult(
+    "FMB2D",
+    FMBTestIntersection2D(&P2D, &Q2D, NULL),
+    true);
+  CheckResult(
+    "FMB2D",
+    FMBTestIntersection2D(&P2D, &R2D, NULL),
+    false);
+  CheckResult(
+    "SAT2D",
+    SATTestIntersection2D(&P2D, &R2D),
+    false);
+
+  // 2DTime: unit square against a square moving from (2.0, 0.0) to
+  // (0.0, 0.0), or moving away
+  FMB_REAL speed2D[2] = {-2.0, 0.0};
+  Frame2DTime P2DTime =
+    Frame2DTimeCreateStatic(
+      FrameCuboid,
+      (FMB_REAL[2]){0.0, 0.0},
+      (FMB_REAL[2]){0.0, 0.0},
+      comp2D);
+  Frame2DTime Q2DTime =
+    Frame2DTimeCreateStatic(
+      FrameCuboid,
+      orig2D,
+      speed2D,
+      comp2D);
+  speed2D[0] = 2.0;
+  Frame2DTime R2DTime =
+    Frame2DTimeCreateStatic(
+      FrameCuboid,
+      orig2D,
+      speed2D,
+      comp2D);
+  CheckResult(
+    "FMB2DTime",
+    FMBTestIntersection2DTime(&P2DTime, &Q2DTime, NULL),
+    true);
+  CheckResult(
+    "FMB2DTime",
+    FMBTestIntersection2DTime(&P2DTime, &R2DTime, NULL),
+    false);
+
+  // 3D: unit cube against a cube translated by (0.5, 0.5, 0.5) or
+  // (2.0, 0.0, 0.0)
+  FMB_REAL orig3D[3] = {0.0, 0.0, 0.0};
+  FMB_REAL comp3D[3][3] =
+    {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+  Frame3D P3D =
+    Frame3DCreateStatic(
+      FrameCuboid,
+      orig3D,
+      comp3D);
+  orig3D[0] = 0.5;
+  orig3D[1] = 0.5;
+  orig3D[2] = 0.5;
+  Frame3D Q3D =
+    Frame3DCreateStatic(
+      FrameCuboid,
+      orig3D,
+      comp3D);
+  orig3D[0] = 2.0;
+  orig3D[1] = 0.0;
+  orig3D[2] = 0.0;
+  Frame3D R3D =
+    Frame3DCreateStatic(
+      FrameCuboid,
+      orig3D,
+      comp3D);
+  CheckResult(
+    "FMB3D",
+    FMBTestIntersection3D(&P3D, &Q3D, NULL),
+    true);
+  CheckResult(
+    "FMB3D",
+    FMBTestIntersection3D(&P3D, &R3D, NULL),
+    false);
+  CheckResult(
+    "SAT3D",
+    SATTestIntersection3D(&P3D, &Q3D),
+    true);
+
+  // 3DTime: unit cube against a cube moving from (2.0, 0.0, 0.0) to
+  // (0.0, 0.0, 0.0), or moving away
+  FMB_REAL speed3D[3] = {-2.0, 0.0, 0.0};
+  Frame3DTime P3DTime =
+    Frame3DTimeCreateStatic(
+      FrameCuboid,
+      (FMB_REAL[3]){0.0, 0.0, 0.0},
+      (FMB_REAL[3]){0.0, 0.0, 0.0},
+      comp3D);
+  Frame3DTime Q3DTime =
+    Frame3DTimeCreateStatic(
+      FrameCuboid,
+      orig3D,
+      speed3D,
+      comp3D);
+  speed3D[0] = 2.0;
+  Frame3DTime R3DTime =
+    Frame3DTimeCreateStatic(
+      FrameCuboid,
+      orig3D,
+      speed3D,
+      comp3D);
+  CheckResult(
+    "FMB3DTime",
+    FMBTestIntersection3DTime(&P3DTime, &Q3DTime, NULL),
+    true);
+  CheckResult(
+    "FMB3DTime",
+    FMBTestIntersection3DTime(&P3DTime, &R3DTime, NULL),
+    false);
+
+  // 3DFace: unit square in the plane z=0.5 against a unit square in
+  // the plane x=0.5 crossing it or above it
+  FMB_REAL compFace[3][3] =
+    {{1.0, 0.0, 0.0}, {0.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+  Frame3D PFace =
+    Frame3DCreateStatic(
+      FrameCuboid,
+      (FMB_REAL[3]){0.0, 0.0, 0.5},
+      compFace);
+  PFace.isFace = true;
+  compFace[0][0] = 0.0;
+  compFace[0][2] = 1.0;
+  compFace[2][0] = 1.0;
+  compFace[2][2] = 0.0;
+  Frame3D QFace =
+    Frame3DCreateStatic(
+      FrameCuboid,
+      (FMB_REAL[3]){0.5, 0.0, 0.0},
+      compFace);
+  QFace.isFace = true;
+  Frame3D RFace =
+    Frame3DCreateStatic(
+      FrameCuboid,
+      (FMB_REAL[3]){0.5, 0.0, 1.0},
+      compFace);
+  RFace.isFace = true;
+  CheckResult(
+    "FMB3DFace",
+    FMBTestIntersection3DFace(&PFace, &QFace, NULL),
+    true);
+  CheckResult(
+    "FMB3DFace",
+    FMBTestIntersection3DFace(&PFace, &RFace, NULL),
+    false);
+
+  printf("UnitTestLib Succeed\n\n");
+
+}
+
+// Main function
+int main(int argc, char** argv) {
+
+  UnitTestLib();
+
+  // If we reached here, it means all the unit tests succeed
+  printf("All unit tests Lib have succeed.\n");
+
+  return 0;
+
+}
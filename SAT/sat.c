@@ -18,31 +18,445 @@
 */
 
 #include "sat.h"
+#include "frameinternal.h"
 
 // ------------- Macros -------------
 
-#define EPSILON 0.0000001
+#define EPSILON FMB_EPSILON
+
+// Default implementation of the projection of the vertices on the axes
+#ifndef SAT_CHECK_MODE
+  #define SAT_CHECK_MODE SATCheckModeSIMD
+#endif
+
+// Max nb of vertices of a Frame in a SATCheck (the 8 vertices of a
+// moving cuboid and the same vertices moved by the relative speed),
+// multiple of FRAME_SIMD_WIDTH_MAX
+#define SAT_NB_VERTEX_MAX 16
+
+// ------------- Data structures -------------
+
+// Vertices of the two Frames of an intersection test in structure of
+// arrays, and axes waiting to be checked, used by the vectorized
+// projections (cf SATCheckMode)
+typedef struct {
+
+  // Nb of vertices of that and tho, and the same padded to a multiple
+  // of the width of the SIMD kernels by repeating their first vertex
+  int nbVertex[2];
+  int nbVertexPad[2];
+
+  // Coordinates of the vertices, [iFrame][iCoord][iVertex]
+  _Alignas(FRAME_SOA_ALIGN)
+    FMB_REAL vertices[2][3][SAT_NB_VERTEX_MAX];
+
+  // Axes waiting to be checked, [iCoord][iAxis], their index, and
+  // their number
+  _Alignas(FRAME_SOA_ALIGN)
+    FMB_REAL axes[3][FRAME_SIMD_WIDTH_MAX];
+  int iAxes[FRAME_SIMD_WIDTH_MAX];
+  int nbAxis;
+
+} SATCheck;
+
+// ------------- Global variables -------------
+
+// Implementation of the projection of the vertices on the axes
+static SATCheckMode satCheckMode = SAT_CHECK_MODE;
+
+// Components added to the origin to get the vertices of a Frame, in
+// the order of CheckAxis3D and CheckAxis3DTime, and of
+// CheckAxis3DFace (bit 0: first component, bit 1: second, bit 2:
+// third)
+static const int satVertexComps3D[8] = {0, 1, 2, 4, 3, 5, 6, 7};
+static const int satVertexComps3DFace[4] = {0, 1, 2, 3};
 
 // ------------- Functions declaration -------------
 
-// Check the intersection constraint along one axis for 3D Frames
-bool CheckAxis3D(
+// Check the intersection constraint for 2D Frames that and tho
+// relatively to the normal of edge
+static bool CheckAxis2D(
+  const Frame2D* const that,
+  const Frame2D* const tho,
+  const FMB_REAL* const edge);
+
+// Check the intersection constraint for moving 2D Frames that and tho
+// relatively to the normal of edge, relSpeed being the speed of tho
+// relative to that
+static bool CheckAxis2DTime(
+  const Frame2DTime* const that,
+  const Frame2DTime* const tho,
+  const FMB_REAL* const edge,
+  const FMB_REAL* const relSpeed);
+
+// Check the intersection constraint for 3D Frames that and tho
+// relatively to axis
+static bool CheckAxis3D(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  const FMB_REAL* const axis);
+
+// Check the intersection constraint for moving 3D Frames that and tho
+// relatively to axis, relSpeed being the speed of tho relative to
+// that
+static bool CheckAxis3DTime(
+  const Frame3DTime* const that,
+  const Frame3DTime* const tho,
+  const FMB_REAL* const axis,
+  const FMB_REAL* const relSpeed);
+
+// Set the vertices of the iFrame-th Frame (0 for that, 1 for tho) of
+// the SATCheck check from the Frame of origin orig and components
+// comp, where comps[iVertex] are the bits of the components added to
+// the origin to get the iVertex-th vertex, and if relSpeed is not null
+// add the same vertices moved by relSpeed, padded for the SIMD kernels
+// of the FrameCPUPath path
+static inline void SATCheckSetVertices(
+  SATCheck* const check,
+  const int iFrame,
+  const FMB_REAL* const orig,
+  const FMB_REAL (*comp)[3],
+  const int* const comps,
+  const int nbVertex,
+  const FMB_REAL* const relSpeed,
+  const FrameCPUPath path);
+
+// Check the intersection constraint along axis, the iAxis-th axis of
+// the test, for the vertices of the SATCheck check with the vectorized
+// implementation mode (cf SATCheckMode) and the kernel of the
+// FrameCPUPath path
+// Return false if an axis separates the Frames and store its index in
+// iAxisSep, else true. With SATCheckModeSIMDAxes the axis may only be
+// added to the group of axes waiting to be checked, and the separating
+// axis may be a previous one (cf SATCheckAxes)
+static inline bool SATCheckAxis(
+  SATCheck* const check,
+  const SATCheckMode mode,
+  const FMB_REAL* const axis,
+  const int iAxis,
+  int* const iAxisSep,
+  const FrameCPUPath path);
+
+// Check the intersection constraint along the axes waiting in the
+// SATCheck check with the kernel of the FrameCPUPath path, and empty
+// the group of axes
+// Return false if an axis separates the Frames and store the index of
+// the first one in iAxisSep, else true
+static inline bool SATCheckAxes(
+  SATCheck* const check,
+  int* const iAxisSep,
+  const FrameCPUPath path);
+
+// Check the intersection constraint along one axis for the 3D Frames
+// whose geometries are that and tho
+static bool CheckAxisSATFrame3D(
+  const SATFrame3D* const that,
+  const SATFrame3D* const tho,
+  const FMB_REAL* const axis);
+
+// Get the normal to the iFace-th face of a 3D Frame of type type and
+// components comp into normal, as in SATTestIntersection3D
+// Return false if the face doesn't exist for this type
+static inline bool SATGetFaceNormal3D(
+  const FrameType type,
+  const FMB_REAL (*comp)[3],
+  const int iFace,
+  FMB_REAL* const normal);
+
+// Implementations of SATCheckFaces2D for each FrameCPUPath
+static bool SATCheckFaces2DGeneric(
+  const Frame2D* const that,
+  const Frame2D* const tho,
+  const unsigned int axes);
+FRAME_CPU_VARIANTS(
+  bool,
+  SATCheckFaces2D,
+  (
+    const Frame2D* const that,
+    const Frame2D* const tho,
+    const unsigned int axes),
+  (that, tho, axes))
+
+// Dispatch table of the implementations, [FrameCPUPath]
+static bool (* const satCheckFaces2DCPU[FrameCPUNb])(
+  const Frame2D* const,
+  const Frame2D* const,
+  const unsigned int) = {
+
+  SATCheckFaces2DGeneric,
+  SATCheckFaces2DSSE2,
+  SATCheckFaces2DAVX2,
+  SATCheckFaces2DAVX512
+
+};
+
+// Implementations of SATCheckFaces2DTime for each FrameCPUPath
+static bool SATCheckFaces2DTimeGeneric(
+  const Frame2DTime* const that,
+  const Frame2DTime* const tho,
+  const unsigned int axes);
+FRAME_CPU_VARIANTS(
+  bool,
+  SATCheckFaces2DTime,
+  (
+    const Frame2DTime* const that,
+    const Frame2DTime* const tho,
+    const unsigned int axes),
+  (that, tho, axes))
+
+// Dispatch table of the implementations, [FrameCPUPath]
+static bool (* const satCheckFaces2DTimeCPU[FrameCPUNb])(
+  const Frame2DTime* const,
+  const Frame2DTime* const,
+  const unsigned int) = {
+
+  SATCheckFaces2DTimeGeneric,
+  SATCheckFaces2DTimeSSE2,
+  SATCheckFaces2DTimeAVX2,
+  SATCheckFaces2DTimeAVX512
+
+};
+
+// Implementations of SATCheckFaces3D for each FrameCPUPath
+static bool SATCheckFaces3DGeneric(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  const unsigned int axes);
+FRAME_CPU_VARIANTS(
+  bool,
+  SATCheckFaces3D,
+  (
+    const Frame3D* const that,
+    const Frame3D* const tho,
+    const unsigned int axes),
+  (that, tho, axes))
+
+// Dispatch table of the implementations, [FrameCPUPath]
+static bool (* const satCheckFaces3DCPU[FrameCPUNb])(
+  const Frame3D* const,
+  const Frame3D* const,
+  const unsigned int) = {
+
+  SATCheckFaces3DGeneric,
+  SATCheckFaces3DSSE2,
+  SATCheckFaces3DAVX2,
+  SATCheckFaces3DAVX512
+
+};
+
+// Implementations of SATCheckFaces3DTime for each FrameCPUPath
+static bool SATCheckFaces3DTimeGeneric(
+  const Frame3DTime* const that,
+  const Frame3DTime* const tho,
+  const unsigned int axes);
+FRAME_CPU_VARIANTS(
+  bool,
+  SATCheckFaces3DTime,
+  (
+    const Frame3DTime* const that,
+    const Frame3DTime* const tho,
+    const unsigned int axes),
+  (that, tho, axes))
+
+// Dispatch table of the implementations, [FrameCPUPath]
+static bool (* const satCheckFaces3DTimeCPU[FrameCPUNb])(
+  const Frame3DTime* const,
+  const Frame3DTime* const,
+  const unsigned int) = {
+
+  SATCheckFaces3DTimeGeneric,
+  SATCheckFaces3DTimeSSE2,
+  SATCheckFaces3DTimeAVX2,
+  SATCheckFaces3DTimeAVX512
+
+};
+
+// Test for intersection between 3D Frame that and 3D Frame tho, and
+// get the index of the separating axis, with the SIMD kernels of the
+// FrameCPUPath path (cf SATTestIntersection3D)
+static inline bool SATTestIntersection3DWitness(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  int* const iAxisSep,
+  const FrameCPUPath path) __attribute__((always_inline));
+
+// Get the iAxis-th axis tested by SATTestIntersection3D for the 3D
+// Frames that and tho into axis
+static bool SATGetAxis3D(
   const Frame3D* const that,
   const Frame3D* const tho,
-  const double* const axis);
+  const int iAxis,
+  FMB_REAL* const axis);
 
-// Check the intersection constraint along one axis for moving 3D Frames
-bool CheckAxis3DTime(
+// Implementations of SATTestIntersection2D for each FrameCPUPath
+static bool SATTestIntersection2DGeneric(
+  const Frame2D* const that,
+  const Frame2D* const tho);
+FRAME_CPU_VARIANTS(
+  bool,
+  SATTestIntersection2D,
+  (
+    const Frame2D* const that,
+    const Frame2D* const tho),
+  (that, tho))
+
+// Dispatch table of the implementations, [FrameCPUPath]
+static bool (* const satTestIntersection2DCPU[FrameCPUNb])(
+  const Frame2D* const,
+  const Frame2D* const) = {
+
+  SATTestIntersection2DGeneric,
+  SATTestIntersection2DSSE2,
+  SATTestIntersection2DAVX2,
+  SATTestIntersection2DAVX512
+
+};
+
+// Implementations of SATTestIntersection2DTime for each FrameCPUPath
+static bool SATTestIntersection2DTimeGeneric(
+  const Frame2DTime* const that,
+  const Frame2DTime* const tho);
+FRAME_CPU_VARIANTS(
+  bool,
+  SATTestIntersection2DTime,
+  (
+    const Frame2DTime* const that,
+    const Frame2DTime* const tho),
+  (that, tho))
+
+// Dispatch table of the implementations, [FrameCPUPath]
+static bool (* const satTestIntersection2DTimeCPU[FrameCPUNb])(
+  const Frame2DTime* const,
+  const Frame2DTime* const) = {
+
+  SATTestIntersection2DTimeGeneric,
+  SATTestIntersection2DTimeSSE2,
+  SATTestIntersection2DTimeAVX2,
+  SATTestIntersection2DTimeAVX512
+
+};
+
+// Implementations of SATTestIntersection3D for each FrameCPUPath
+static inline bool SATTestIntersection3DPath(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  const FrameCPUPath path);
+FRAME_CPU_VARIANTS_PATH(
+  bool,
+  SATTestIntersection3D,
+  (
+    const Frame3D* const that,
+    const Frame3D* const tho),
+  (that, tho))
+
+// Dispatch table of the implementations, [FrameCPUPath]
+static bool (* const satTestIntersection3DCPU[FrameCPUNb])(
+  const Frame3D* const,
+  const Frame3D* const) = {
+
+  SATTestIntersection3DGeneric,
+  SATTestIntersection3DSSE2,
+  SATTestIntersection3DAVX2,
+  SATTestIntersection3DAVX512
+
+};
+
+// Implementations of SATTestIntersection3DPrecomputed for each
+// FrameCPUPath
+static bool SATTestIntersection3DPrecomputedGeneric(
+  const SATFrame3D* const that,
+  const SATFrame3D* const tho);
+FRAME_CPU_VARIANTS(
+  bool,
+  SATTestIntersection3DPrecomputed,
+  (
+    const SATFrame3D* const that,
+    const SATFrame3D* const tho),
+  (that, tho))
+
+// Dispatch table of the implementations, [FrameCPUPath]
+static bool (* const satTestIntersection3DPrecomputedCPU[FrameCPUNb])(
+  const SATFrame3D* const,
+  const SATFrame3D* const) = {
+
+  SATTestIntersection3DPrecomputedGeneric,
+  SATTestIntersection3DPrecomputedSSE2,
+  SATTestIntersection3DPrecomputedAVX2,
+  SATTestIntersection3DPrecomputedAVX512
+
+};
+
+// Implementations of SATTestIntersection3DTime for each FrameCPUPath
+static inline bool SATTestIntersection3DTimePath(
   const Frame3DTime* const that,
   const Frame3DTime* const tho,
-  const double* const axis,
-  const double* const relSpeed);
+  const FrameCPUPath path);
+FRAME_CPU_VARIANTS_PATH(
+  bool,
+  SATTestIntersection3DTime,
+  (
+    const Frame3DTime* const that,
+    const Frame3DTime* const tho),
+  (that, tho))
+
+// Dispatch table of the implementations, [FrameCPUPath]
+static bool (* const satTestIntersection3DTimeCPU[FrameCPUNb])(
+  const Frame3DTime* const,
+  const Frame3DTime* const) = {
+
+  SATTestIntersection3DTimeGeneric,
+  SATTestIntersection3DTimeSSE2,
+  SATTestIntersection3DTimeAVX2,
+  SATTestIntersection3DTimeAVX512
+
+};
+
+// Implementations of SATTestIntersection3DFace for each FrameCPUPath
+static inline bool SATTestIntersection3DFacePath(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  const FrameCPUPath path);
+FRAME_CPU_VARIANTS_PATH(
+  bool,
+  SATTestIntersection3DFace,
+  (
+    const Frame3D* const that,
+    const Frame3D* const tho),
+  (that, tho))
+
+// Dispatch table of the implementations, [FrameCPUPath]
+static bool (* const satTestIntersection3DFaceCPU[FrameCPUNb])(
+  const Frame3D* const,
+  const Frame3D* const) = {
+
+  SATTestIntersection3DFaceGeneric,
+  SATTestIntersection3DFaceSSE2,
+  SATTestIntersection3DFaceAVX2,
+  SATTestIntersection3DFaceAVX512
+
+};
 
 // ------------- Functions implementation -------------
 
+// Set the implementation of the projection of the vertices on the
+// axes used by the SAT intersection tests of 3D Frames
+void SATSetCheckMode(const SATCheckMode mode) {
+
+  satCheckMode = mode;
+
+}
+
+// Get the implementation of the projection of the vertices on the
+// axes currently used by the SAT intersection tests
+SATCheckMode SATGetCheckMode(void) {
+
+  return satCheckMode;
+
+}
+
 // Test for intersection between 2D Frame that and 2D Frame tho
 // Return true if the two Frames are intersecting, else false
-bool SATTestIntersection2D(
+static bool SATTestIntersection2DGeneric(
   const Frame2D* const that,
   const Frame2D* const tho) {
 
@@ -57,15 +471,15 @@ bool SATTestIntersection2D(
 
     // Shortcuts
     FrameType frameEdgeType = frameEdge->type;
-    const double* frameEdgeCompA = frameEdge->comp[0];
-    const double* frameEdgeCompB = frameEdge->comp[1];
+    const FMB_REAL* frameEdgeCompA = frameEdge->comp[0];
+    const FMB_REAL* frameEdgeCompB = frameEdge->comp[1];
 
     // Declare a variable to memorize the number of edges, by default 2
     int nbEdges = 2;
 
     // Declare a variable to memorize the third edge in case of
     // tetrahedron
-    double thirdEdge[2];
+    FMB_REAL thirdEdge[2];
 
     // If the frame is a tetrahedron
     if (frameEdgeType == FrameTetrahedron) {
@@ -85,17 +499,17 @@ bool SATTestIntersection2D(
       iEdge--;) {
 
       // Get the current edge
-      const double* edge =
+      const FMB_REAL* edge =
         (iEdge == 2 ? thirdEdge : frameEdge->comp[iEdge]);
 
       // Declare variables to memorize the boundaries of projection
       // of the two frames on the current edge
-      double bdgBoxA[2];
-      double bdgBoxB[2];
+      FMB_REAL bdgBoxA[2];
+      FMB_REAL bdgBoxB[2];
 
       // Declare two variables to loop on Frames and commonalize code
       const Frame2D* frame = that;
-      double* bdgBox = bdgBoxA;
+      FMB_REAL* bdgBox = bdgBoxA;
 
       // Loop on Frames
       for (
@@ -103,9 +517,9 @@ bool SATTestIntersection2D(
         jFrame--;) {
 
         // Shortcuts
-        const double* frameOrig = frame->orig;
-        const double* frameCompA = frame->comp[0];
-        const double* frameCompB = frame->comp[1];
+        const FMB_REAL* frameOrig = frame->orig;
+        const FMB_REAL* frameCompA = frame->comp[0];
+        const FMB_REAL* frameCompB = frame->comp[1];
         FrameType frameType = frame->type;
 
         // Get the number of vertices of frame
@@ -121,7 +535,7 @@ bool SATTestIntersection2D(
           iVertex--;) {
 
           // Get the vertex
-          double vertex[2];
+          FMB_REAL vertex[2];
           vertex[0] = frameOrig[0];
           vertex[1] = frameOrig[1];
           switch (iVertex) {
@@ -146,7 +560,7 @@ bool SATTestIntersection2D(
           // Get the projection of the vertex on the normal of the edge
           // Orientation of the normal doesn't matter, so we
           // use arbitrarily the normal (edge[1], -edge[0])
-          double proj = vertex[0] * edge[1] - vertex[1] * edge[0];
+          FMB_REAL proj = vertex[0] * edge[1] - vertex[1] * edge[0];
 
           // If it's the first vertex
           if (firstVertex == true) {
@@ -210,10 +624,23 @@ bool SATTestIntersection2D(
 
 }
 
+// Test for intersection with the current implementation
+// (cf FrameGetCPUPath)
+bool SATTestIntersection2D(
+  const Frame2D* const that,
+  const Frame2D* const tho) {
+
+  return
+    satTestIntersection2DCPU[FrameGetCPUPath()](
+      that,
+      tho);
+
+}
+
 // Test for intersection between moving 2D Frame that and 2D
 // Frame tho
 // Return true if the two Frames are intersecting, else false
-bool SATTestIntersection2DTime(
+static bool SATTestIntersection2DTimeGeneric(
   const Frame2DTime* const that,
   const Frame2DTime* const tho) {
 
@@ -221,7 +648,7 @@ bool SATTestIntersection2DTime(
   const Frame2DTime* frameEdge = that;
 
   // Declare a variable to memorize the speed of tho relative to that
-  double relSpeed[2];
+  FMB_REAL relSpeed[2];
   relSpeed[0] = tho->speed[0] - that->speed[0];
   relSpeed[1] = tho->speed[1] - that->speed[1];
 
@@ -233,15 +660,15 @@ bool SATTestIntersection2DTime(
 
     // Shortcuts
     FrameType frameEdgeType = frameEdge->type;
-    const double* frameEdgeCompA = frameEdge->comp[0];
-    const double* frameEdgeCompB = frameEdge->comp[1];
+    const FMB_REAL* frameEdgeCompA = frameEdge->comp[0];
+    const FMB_REAL* frameEdgeCompB = frameEdge->comp[1];
 
     // Declare a variable to memorize the number of edges, by default 2
     int nbEdges = 2;
 
     // Declare a variable to memorize the third edge in case of
     // tetrahedron
-    double thirdEdge[2];
+    FMB_REAL thirdEdge[2];
 
     // If the frame is a tetrahedron
     if (frameEdgeType == FrameTetrahedron) {
@@ -270,7 +697,7 @@ bool SATTestIntersection2DTime(
       iEdge--;) {
 
       // Get the current edge
-      const double* edge = 0;
+      const FMB_REAL* edge = 0;
 
       if (iEdge == 3) {
 
@@ -296,12 +723,12 @@ bool SATTestIntersection2DTime(
 
       // Declare variables to memorize the boundaries of projection
       // of the two frames on the current edge
-      double bdgBoxA[2];
-      double bdgBoxB[2];
+      FMB_REAL bdgBoxA[2];
+      FMB_REAL bdgBoxB[2];
 
       // Declare two variables to loop on Frames and commonalize code
       const Frame2DTime* frame = that;
-      double* bdgBox = bdgBoxA;
+      FMB_REAL* bdgBox = bdgBoxA;
 
       // Loop on Frames
       for (
@@ -309,9 +736,9 @@ bool SATTestIntersection2DTime(
         jFrame--;) {
 
         // Shortcuts
-        const double* frameOrig = frame->orig;
-        const double* frameCompA = frame->comp[0];
-        const double* frameCompB = frame->comp[1];
+        const FMB_REAL* frameOrig = frame->orig;
+        const FMB_REAL* frameCompA = frame->comp[0];
+        const FMB_REAL* frameCompB = frame->comp[1];
         FrameType frameType = frame->type;
 
         // Get the number of vertices of frame
@@ -327,7 +754,7 @@ bool SATTestIntersection2DTime(
           iVertex--;) {
 
           // Get the vertex
-          double vertex[2];
+          FMB_REAL vertex[2];
           vertex[0] = frameOrig[0];
           vertex[1] = frameOrig[1];
           switch (iVertex) {
@@ -352,7 +779,7 @@ bool SATTestIntersection2DTime(
           // Get the projection of the vertex on the normal of the edge
           // Orientation of the normal doesn't matter, so we
           // use arbitrarily the normal (edge[1], -edge[0])
-          double proj = vertex[0] * edge[1] - vertex[1] * edge[0];
+          FMB_REAL proj = vertex[0] * edge[1] - vertex[1] * edge[0];
 
           // If it's the first vertex
           if (firstVertex == true) {
@@ -439,28 +866,78 @@ bool SATTestIntersection2DTime(
 
 }
 
+// Test for intersection with the current implementation
+// (cf FrameGetCPUPath)
+bool SATTestIntersection2DTime(
+  const Frame2DTime* const that,
+  const Frame2DTime* const tho) {
+
+  return
+    satTestIntersection2DTimeCPU[FrameGetCPUPath()](
+      that,
+      tho);
+
+}
+
 // Test for intersection between 3D Frame that and 3D Frame tho
-// Return true if the two Frames are intersecting, else false
-bool SATTestIntersection3D(
+// Return true if the two Frames are intersecting, else false, and if
+// iAxisSep is not null store the index of the separating axis into it
+// (cf SATGetAxis3D)
+// Always inlined, the code storing the index is removed when iAxisSep
+// is null
+static inline bool SATTestIntersection3DWitness(
   const Frame3D* const that,
-  const Frame3D* const tho) {
+  const Frame3D* const tho,
+  int* const iAxisSep,
+  const FrameCPUPath path) {
 
   // Declare two variables to memorize the opposite edges in case
   // of tetrahedron
-  double oppEdgesThat[3][3];
-  double oppEdgesTho[3][3];
+  FMB_REAL oppEdgesThat[3][3];
+  FMB_REAL oppEdgesTho[3][3];
 
   // Declare two variables to memorize the number of edges, by default 3
   int nbEdgesThat = 3;
   int nbEdgesTho = 3;
 
+  // Get the implementation of the projection of the vertices and, if
+  // it is vectorized, initialise the vertices
+  SATCheckMode mode = satCheckMode;
+  SATCheck check;
+  if (mode != SATCheckModeScalar) {
+
+    SATCheckSetVertices(
+      &check,
+      0,
+      that->orig,
+      that->comp,
+      satVertexComps3D,
+      (that->type == FrameTetrahedron ? 4 : 8),
+      NULL,
+      path);
+    SATCheckSetVertices(
+      &check,
+      1,
+      tho->orig,
+      tho->comp,
+      satVertexComps3D,
+      (tho->type == FrameTetrahedron ? 4 : 8),
+      NULL,
+      path);
+    check.nbAxis = 0;
+
+  }
+
+  // Declare a variable to memorize the index of the separating axis
+  int iAxisCheck = 0;
+
   // If the first Frame is a tetrahedron
   if (that->type == FrameTetrahedron) {
 
     // Shortcuts
-    const double* frameCompA = that->comp[0];
-    const double* frameCompB = that->comp[1];
-    const double* frameCompC = that->comp[2];
+    const FMB_REAL* frameCompA = that->comp[0];
+    const FMB_REAL* frameCompB = that->comp[1];
+    const FMB_REAL* frameCompC = that->comp[2];
 
     // Initialise the opposite edges
     oppEdgesThat[0][0] = frameCompB[0] - frameCompA[0];
@@ -484,9 +961,9 @@ bool SATTestIntersection3D(
   if (tho->type == FrameTetrahedron) {
 
     // Shortcuts
-    const double* frameCompA = tho->comp[0];
-    const double* frameCompB = tho->comp[1];
-    const double* frameCompC = tho->comp[2];
+    const FMB_REAL* frameCompA = tho->comp[0];
+    const FMB_REAL* frameCompB = tho->comp[1];
+    const FMB_REAL* frameCompC = tho->comp[2];
 
     // Initialise the opposite edges
     oppEdgesTho[0][0] = frameCompB[0] - frameCompA[0];
@@ -508,7 +985,7 @@ bool SATTestIntersection3D(
 
   // Declare variables to loop on Frames and commonalize code
   const Frame3D* frame = that;
-  const double (*oppEdgesA)[3] = oppEdgesThat;
+  const FMB_REAL (*oppEdgesA)[3] = oppEdgesThat;
 
   // Loop to commonalize code when checking SAT based on that's edges
   // and then tho's edges
@@ -518,16 +995,16 @@ bool SATTestIntersection3D(
 
     // Shortcuts
     FrameType frameType = frame->type;
-    const double* frameCompA = frame->comp[0];
-    const double* frameCompB = frame->comp[1];
-    const double* frameCompC = frame->comp[2];
+    const FMB_REAL* frameCompA = frame->comp[0];
+    const FMB_REAL* frameCompB = frame->comp[1];
+    const FMB_REAL* frameCompC = frame->comp[2];
 
     // Declare a variable to memorize the number of faces, by default 3
     int nbFaces = 3;
 
     // Declare a variable to memorize the normal to faces
     // Arrangement is normFaces[iFace][iAxis]
-    double normFaces[4][3];
+    FMB_REAL normFaces[4][3];
 
     // Initialise the normal to faces
     normFaces[0][0] =
@@ -564,8 +1041,8 @@ bool SATTestIntersection3D(
     if (frameType == FrameTetrahedron) {
 
       // Shortcuts
-      const double* oppEdgeA = oppEdgesA[0];
-      const double* oppEdgeB = oppEdgesA[1];
+      const FMB_REAL* oppEdgeA = oppEdgesA[0];
+      const FMB_REAL* oppEdgeB = oppEdgesA[1];
 
       // Initialise the normal to the opposite face
       normFaces[3][0] =
@@ -589,15 +1066,31 @@ bool SATTestIntersection3D(
       iFace--;) {
 
       // Check against the current face's normal
+      iAxisCheck = (iFrame == 1 ? 0 : 4) + iFace;
       bool isIntersection =
-        CheckAxis3D(
-          that,
-          tho,
-          normFaces[iFace]);
+        (mode == SATCheckModeScalar ?
+          CheckAxis3D(
+            that,
+            tho,
+            normFaces[iFace]) :
+          SATCheckAxis(
+            &check,
+            mode,
+            normFaces[iFace],
+            iAxisCheck,
+            &iAxisCheck,
+            path));
 
       // If the axis is separating the Frames
       if (isIntersection == false) {
 
+        // Memorize the separating axis if requested
+        if (iAxisSep != NULL) {
+
+          *iAxisSep = iAxisCheck;
+
+        }
+
         // The Frames are not in intersection,
         // terminate the test
         return false;
@@ -618,7 +1111,7 @@ bool SATTestIntersection3D(
     iEdgeThat--;) {
 
     // Get the first edge
-    const double* edgeThat = NULL;
+    const FMB_REAL* edgeThat = NULL;
     if (iEdgeThat < 3) {
 
       edgeThat = that->comp[iEdgeThat];
@@ -634,7 +1127,7 @@ bool SATTestIntersection3D(
       iEdgeTho--;) {
 
       // Get the second edge
-      const double* edgeTho = NULL;
+      const FMB_REAL* edgeTho = NULL;
       if (iEdgeTho < 3) {
 
         edgeTho = tho->comp[iEdgeTho];
@@ -646,21 +1139,37 @@ bool SATTestIntersection3D(
       }
 
       // Get the cross product of the two edges
-      double axis[3];
+      FMB_REAL axis[3];
       axis[0] = edgeThat[1] * edgeTho[2] - edgeThat[2] * edgeTho[1];
       axis[1] = edgeThat[2] * edgeTho[0] - edgeThat[0] * edgeTho[2];
       axis[2] = edgeThat[0] * edgeTho[1] - edgeThat[1] * edgeTho[0];
 
       // Check against the cross product of the two edges
+      iAxisCheck = 8 + iEdgeThat * 6 + iEdgeTho;
       bool isIntersection =
-        CheckAxis3D(
-          that,
-          tho,
-          axis);
+        (mode == SATCheckModeScalar ?
+          CheckAxis3D(
+            that,
+            tho,
+            axis) :
+          SATCheckAxis(
+            &check,
+            mode,
+            axis,
+            iAxisCheck,
+            &iAxisCheck,
+            path));
 
       // If the axis is separating the Frames
       if (isIntersection == false) {
 
+        // Memorize the separating axis if requested
+        if (iAxisSep != NULL) {
+
+          *iAxisSep = iAxisCheck;
+
+        }
+
         // The Frames are not in intersection,
         // terminate the test
         return false;
@@ -671,297 +1180,379 @@ bool SATTestIntersection3D(
 
   }
 
+  // Check the axes remaining in the group if they are checked by
+  // groups
+  if (
+    mode == SATCheckModeSIMDAxes &&
+    SATCheckAxes(
+      &check,
+      &iAxisCheck,
+      path) == false) {
+
+    // Memorize the separating axis if requested
+    if (iAxisSep != NULL) {
+
+      *iAxisSep = iAxisCheck;
+
+    }
+
+    // The Frames are not in intersection
+    return false;
+
+  }
+
   // If we reaches here, it means the two Frames are intersecting
   return true;
 
 }
 
-// Test for intersection between moving 3D Frame that and 3D
-// Frame tho
+// Test for intersection between 3D Frame that and 3D Frame tho
 // Return true if the two Frames are intersecting, else false
-bool SATTestIntersection3DTime(
-  const Frame3DTime* const that,
-  const Frame3DTime* const tho) {
+static inline bool SATTestIntersection3DPath(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  const FrameCPUPath path) {
 
-  // Declare two variables to memorize the opposite edges in case
-  // of tetrahedron
-  double oppEdgesThat[3][3];
-  double oppEdgesTho[3][3];
+  return
+    SATTestIntersection3DWitness(
+      that,
+      tho,
+      NULL,
+      path);
 
-  // Declare a variable to memorize the speed of tho relative to that
-  double relSpeed[3];
-  relSpeed[0] = tho->speed[0] - that->speed[0];
-  relSpeed[1] = tho->speed[1] - that->speed[1];
-  relSpeed[2] = tho->speed[2] - that->speed[2];
+}
 
-  // Declare two variables to memorize the number of edges, by default 3
-  int nbEdgesThat = 3;
-  int nbEdgesTho = 3;
+// Test for intersection with the current implementation
+// (cf FrameGetCPUPath)
+bool SATTestIntersection3D(
+  const Frame3D* const that,
+  const Frame3D* const tho) {
 
-  // If the first Frame is a tetrahedron
-  if (that->type == FrameTetrahedron) {
+  return
+    satTestIntersection3DCPU[FrameGetCPUPath()](
+      that,
+      tho);
 
-    // Shortcuts
-    const double* frameCompA = that->comp[0];
-    const double* frameCompB = that->comp[1];
-    const double* frameCompC = that->comp[2];
+}
 
-    // Initialise the opposite edges
-    oppEdgesThat[0][0] = frameCompB[0] - frameCompA[0];
-    oppEdgesThat[0][1] = frameCompB[1] - frameCompA[1];
-    oppEdgesThat[0][2] = frameCompB[2] - frameCompA[2];
+// Get the iEdge-th edge of the 3D Frame frame, the components (0 to 2)
+// and for a tetrahedron the opposite edges (3 to 5), using edge as
+// buffer for the opposite edges
+// Return null if the edge doesn't exist for the type of the Frame
+static const FMB_REAL* SATGetEdge3D(
+  const Frame3D* const frame,
+  const int iEdge,
+  FMB_REAL* const edge) {
 
-    oppEdgesThat[1][0] = frameCompB[0] - frameCompC[0];
-    oppEdgesThat[1][1] = frameCompB[1] - frameCompC[1];
-    oppEdgesThat[1][2] = frameCompB[2] - frameCompC[2];
+  // If it's one of the components
+  if (iEdge < 3) {
 
-    oppEdgesThat[2][0] = frameCompC[0] - frameCompA[0];
-    oppEdgesThat[2][1] = frameCompC[1] - frameCompA[1];
-    oppEdgesThat[2][2] = frameCompC[2] - frameCompA[2];
+    return frame->comp[iEdge];
 
-    // Correct the number of edges
-    nbEdgesThat = 6;
+  // Else, if it's an opposite edge of a tetrahedron
+  } else if (frame->type == FrameTetrahedron) {
 
-  }
+    // Shortcuts
+    const FMB_REAL* frameCompA = frame->comp[0];
+    const FMB_REAL* frameCompB = frame->comp[1];
+    const FMB_REAL* frameCompC = frame->comp[2];
 
-  // If the second Frame is a tetrahedron
-  if (tho->type == FrameTetrahedron) {
+    // Get the opposite edge as in SATTestIntersection3D
+    const FMB_REAL* from = frameCompA;
+    const FMB_REAL* to = frameCompB;
+    if (iEdge == 4) {
 
-    // Shortcuts
-    const double* frameCompA = tho->comp[0];
-    const double* frameCompB = tho->comp[1];
-    const double* frameCompC = tho->comp[2];
+      from = frameCompC;
 
-    // Initialise the opposite edges
-    oppEdgesTho[0][0] = frameCompB[0] - frameCompA[0];
-    oppEdgesTho[0][1] = frameCompB[1] - frameCompA[1];
-    oppEdgesTho[0][2] = frameCompB[2] - frameCompA[2];
+    } else if (iEdge == 5) {
 
-    oppEdgesTho[1][0] = frameCompB[0] - frameCompC[0];
-    oppEdgesTho[1][1] = frameCompB[1] - frameCompC[1];
-    oppEdgesTho[1][2] = frameCompB[2] - frameCompC[2];
+      to = frameCompC;
 
-    oppEdgesTho[2][0] = frameCompC[0] - frameCompA[0];
-    oppEdgesTho[2][1] = frameCompC[1] - frameCompA[1];
-    oppEdgesTho[2][2] = frameCompC[2] - frameCompA[2];
+    }
 
-    // Correct the number of edges
-    nbEdgesTho = 6;
+    for (
+      int i = 3;
+      i--;) {
+
+      edge[i] = to[i] - from[i];
+
+    }
+
+    return edge;
 
   }
 
-  // Declare variables to loop on Frames and commonalize code
-  const Frame3DTime* frame = that;
-  const double (*oppEdgesA)[3] = oppEdgesThat;
+  // The edge doesn't exist
+  return NULL;
 
-  // Loop to commonalize code when checking SAT based on that's edges
-  // and then tho's edges
-  for (
-    int iFrame = 2;
-    iFrame--;) {
+}
 
-    // Shortcuts
-    FrameType frameType = frame->type;
-    const double* frameCompA = frame->comp[0];
-    const double* frameCompB = frame->comp[1];
-    const double* frameCompC = frame->comp[2];
+// Get the iAxis-th axis tested by SATTestIntersection3D for the 3D
+// Frames that and tho into axis: the normals to the faces of that
+// (0 to 3), the normals to the faces of tho (4 to 7) and the cross
+// products of the edges of that and tho (8 + iEdgeThat * 6 + iEdgeTho,
+// cf SATGetEdge3D)
+// Return false if the axis doesn't exist for the types of the Frames
+static bool SATGetAxis3D(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  const int iAxis,
+  FMB_REAL* const axis) {
 
-    // Declare a variable to memorize the number of faces, by default 3
-    int nbFaces = 3;
+  // Declare variables to memorize the two vectors whose cross product
+  // is the axis, and buffers for the opposite edges
+  const FMB_REAL* u = NULL;
+  const FMB_REAL* v = NULL;
+  FMB_REAL edgeU[3];
+  FMB_REAL edgeV[3];
 
-    // Declare a variable to memorize the normal to faces
-    // Arrangement is normFaces[iFace][iAxis]
-    double normFaces[10][3];
+  // If the axis is the normal to a face
+  if (iAxis < 8) {
 
-    // Initialise the normal to faces
-    normFaces[0][0] =
-      frameCompA[1] * frameCompB[2] -
-      frameCompA[2] * frameCompB[1];
-    normFaces[0][1] =
-      frameCompA[2] * frameCompB[0] -
-      frameCompA[0] * frameCompB[2];
-    normFaces[0][2] =
-      frameCompA[0] * frameCompB[1] -
-      frameCompA[1] * frameCompB[0];
+    // Shortcuts
+    const Frame3D* frame = (iAxis < 4 ? that : tho);
+    int iFace = iAxis % 4;
 
-    normFaces[1][0] =
-      frameCompA[1] * frameCompC[2] -
-      frameCompA[2] * frameCompC[1];
-    normFaces[1][1] =
-      frameCompA[2] * frameCompC[0] -
-      frameCompA[0] * frameCompC[2];
-    normFaces[1][2] =
-      frameCompA[0] * frameCompC[1] -
-      frameCompA[1] * frameCompC[0];
+    // Get the two edges of the face as in SATTestIntersection3D
+    if (iFace == 0) {
 
-    normFaces[2][0] =
-      frameCompC[1] * frameCompB[2] -
-      frameCompC[2] * frameCompB[1];
-    normFaces[2][1] =
-      frameCompC[2] * frameCompB[0] -
-      frameCompC[0] * frameCompB[2];
-    normFaces[2][2] =
-      frameCompC[0] * frameCompB[1] -
-      frameCompC[1] * frameCompB[0];
+      u = frame->comp[0];
+      v = frame->comp[1];
 
-    // If the frame is a tetrahedron
-    if (frameType == FrameTetrahedron) {
+    } else if (iFace == 1) {
 
-      // Shortcuts
-      const double* oppEdgeA = oppEdgesA[0];
-      const double* oppEdgeB = oppEdgesA[1];
+      u = frame->comp[0];
+      v = frame->comp[2];
 
-      // Initialise the normal to the opposite face
-      normFaces[3][0] =
-        oppEdgeA[1] * oppEdgeB[2] -
-        oppEdgeA[2] * oppEdgeB[1];
-      normFaces[3][1] =
-        oppEdgeA[2] * oppEdgeB[0] -
-        oppEdgeA[0] * oppEdgeB[2];
-      normFaces[3][2] =
-        oppEdgeA[0] * oppEdgeB[1] -
-        oppEdgeA[1] * oppEdgeB[0];
+    } else if (iFace == 2) {
 
-      // Correct the number of faces
-      nbFaces = 4;
+      u = frame->comp[2];
+      v = frame->comp[1];
+
+    } else {
+
+      u =
+        SATGetEdge3D(
+          frame,
+          3,
+          edgeU);
+      v =
+        SATGetEdge3D(
+          frame,
+          4,
+          edgeV);
 
     }
 
-    // If we are checking the frame 'tho'
-    if (frame == tho) {
+  // Else, the axis is the cross product of two edges
+  } else {
 
-      // Add the normal to the virtual faces created by the speed
-      // of tho relative to that
-      normFaces[nbFaces][0] =
-        relSpeed[1] * frameCompA[2] -
-        relSpeed[2] * frameCompA[1];
-      normFaces[nbFaces][1] =
-        relSpeed[2] * frameCompA[0] -
-        relSpeed[0] * frameCompA[2];
-      normFaces[nbFaces][2] =
-        relSpeed[0] * frameCompA[1] -
-        relSpeed[1] * frameCompA[0];
-      if (
-        fabs(normFaces[nbFaces][0]) > EPSILON ||
-        fabs(normFaces[nbFaces][1]) > EPSILON ||
-        fabs(normFaces[nbFaces][2]) > EPSILON) {
+    u =
+      SATGetEdge3D(
+        that,
+        (iAxis - 8) / 6,
+        edgeU);
+    v =
+      SATGetEdge3D(
+        tho,
+        (iAxis - 8) % 6,
+        edgeV);
 
-        ++nbFaces;
+  }
 
-      }
+  // If one of the edges doesn't exist
+  if (u == NULL || v == NULL) {
 
-      normFaces[nbFaces][0] =
-        relSpeed[1] * frameCompB[2] -
-        relSpeed[2] * frameCompB[1];
-      normFaces[nbFaces][1] =
-        relSpeed[2] * frameCompB[0] -
-        relSpeed[0] * frameCompB[2];
-      normFaces[nbFaces][2] =
-        relSpeed[0] * frameCompB[1] -
-        relSpeed[1] * frameCompB[0];
-      if (
-        fabs(normFaces[nbFaces][0]) > EPSILON ||
-        fabs(normFaces[nbFaces][1]) > EPSILON ||
-        fabs(normFaces[nbFaces][2]) > EPSILON) {
+    return false;
 
-        ++nbFaces;
+  }
 
-      }
+  // Get the cross product of the two vectors
+  axis[0] = u[1] * v[2] - u[2] * v[1];
+  axis[1] = u[2] * v[0] - u[0] * v[2];
+  axis[2] = u[0] * v[1] - u[1] * v[0];
 
-      normFaces[nbFaces][0] =
-        relSpeed[1] * frameCompC[2] -
-        relSpeed[2] * frameCompC[1];
-      normFaces[nbFaces][1] =
-        relSpeed[2] * frameCompC[0] -
-        relSpeed[0] * frameCompC[2];
-      normFaces[nbFaces][2] =
-        relSpeed[0] * frameCompC[1] -
-        relSpeed[1] * frameCompC[0];
-      if (
-        fabs(normFaces[nbFaces][0]) > EPSILON ||
-        fabs(normFaces[nbFaces][1]) > EPSILON ||
-        fabs(normFaces[nbFaces][2]) > EPSILON) {
+  return true;
 
-        ++nbFaces;
+}
 
-      }
+// Test for intersection between 3D Frame that and 3D Frame tho,
+// using the separating axis memorized for the pair (idThat, idTho) in
+// the FMBPairCache cache
+// Return true if the two Frames are intersecting, else false, as
+// SATTestIntersection3D
+// If the memorized axis still separates the Frames the test is
+// limited to this axis, else the full test is run and the separating
+// axis, if any, is memorized for the next test
+bool SATTestIntersection3DCached(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  FMBPairCache* const cache,
+  const unsigned long idThat,
+  const unsigned long idTho) {
+
+  // Get the separating axis of the last test of the pair
+  int witness =
+    FMBPairCacheGet(
+      cache,
+      idThat,
+      idTho);
+
+  // If there is one and it still separates the Frames
+  if (witness != FMB_PAIR_CACHE_NONE) {
+
+    FMB_REAL axis[3];
+    bool isAxis =
+      SATGetAxis3D(
+        that,
+        tho,
+        witness,
+        axis);
+    if (
+      isAxis == true &&
+      CheckAxis3D(
+        that,
+        tho,
+        axis) == false) {
+
+      // The Frames are not in intersection
+      ++(cache->nbHit);
+      return false;
 
-      if (frameType == FrameTetrahedron) {
+    }
 
-        const double* oppEdgeA = oppEdgesA[0];
-        const double* oppEdgeB = oppEdgesA[1];
-        const double* oppEdgeC = oppEdgesA[2];
+  }
 
-        normFaces[nbFaces][0] =
-          relSpeed[1] * oppEdgeA[2] -
-          relSpeed[2] * oppEdgeA[1];
-        normFaces[nbFaces][1] =
-          relSpeed[2] * oppEdgeA[0] -
-          relSpeed[0] * oppEdgeA[2];
-        normFaces[nbFaces][2] =
-          relSpeed[0] * oppEdgeA[1] -
-          relSpeed[1] * oppEdgeA[0];
-        if (
-          fabs(normFaces[nbFaces][0]) > EPSILON ||
-          fabs(normFaces[nbFaces][1]) > EPSILON ||
-          fabs(normFaces[nbFaces][2]) > EPSILON) {
+  // Run the full test and memorize the separating axis
+  ++(cache->nbMiss);
+  int iAxisSep = FMB_PAIR_CACHE_NONE;
+  bool isIntersecting =
+    SATTestIntersection3DWitness(
+      that,
+      tho,
+      &iAxisSep,
+      FrameGetCPUPath());
+  FMBPairCacheSet(
+    cache,
+    idThat,
+    idTho,
+    iAxisSep);
 
-          ++nbFaces;
+  return isIntersecting;
 
-        }
+}
 
-        normFaces[nbFaces][0] =
-          relSpeed[1] * oppEdgeB[2] -
-          relSpeed[2] * oppEdgeB[1];
-        normFaces[nbFaces][1] =
-          relSpeed[2] * oppEdgeB[0] -
-          relSpeed[0] * oppEdgeB[2];
-        normFaces[nbFaces][2] =
-          relSpeed[0] * oppEdgeB[1] -
-          relSpeed[1] * oppEdgeB[0];
-        if (
-          fabs(normFaces[nbFaces][0]) > EPSILON ||
-          fabs(normFaces[nbFaces][1]) > EPSILON ||
-          fabs(normFaces[nbFaces][2]) > EPSILON) {
+// Create the geometry used by the SAT intersection test of the 3D
+// Frame frame
+// The vertices, normals and edges are calculated exactly as in
+// CheckAxis3D and SATTestIntersection3D, so that
+// SATTestIntersection3DPrecomputed gives the same results
+SATFrame3D SATFrame3DCreate(const Frame3D* const frame) {
 
-          ++nbFaces;
+  // Declare the geometry
+  SATFrame3D that;
 
-        }
+  // Shortcuts
+  const FMB_REAL* frameOrig = frame->orig;
+  const FMB_REAL* frameCompA = frame->comp[0];
+  const FMB_REAL* frameCompB = frame->comp[1];
+  const FMB_REAL* frameCompC = frame->comp[2];
 
-        normFaces[nbFaces][0] =
-          relSpeed[1] * oppEdgeC[2] -
-          relSpeed[2] * oppEdgeC[1];
-        normFaces[nbFaces][1] =
-          relSpeed[2] * oppEdgeC[0] -
-          relSpeed[0] * oppEdgeC[2];
-        normFaces[nbFaces][2] =
-          relSpeed[0] * oppEdgeC[1] -
-          relSpeed[1] * oppEdgeC[0];
-        if (
-          fabs(normFaces[nbFaces][0]) > EPSILON ||
-          fabs(normFaces[nbFaces][1]) > EPSILON ||
-          fabs(normFaces[nbFaces][2]) > EPSILON) {
+  // Set the type and the nb of vertices, faces and edges
+  that.type = frame->type;
+  if (frame->type == FrameTetrahedron) {
 
-          ++nbFaces;
+    that.nbVertex = 4;
+    that.nbFace = 4;
+    that.nbEdge = 6;
 
-        }
+  } else {
 
-      }
+    that.nbVertex = 8;
+    that.nbFace = 3;
+    that.nbEdge = 3;
 
-    }
+  }
+
+  // Loop on the coordinates
+  for (
+    int i = 3;
+    i--;) {
+
+    // Get the vertices
+    that.vertices[0][i] = frameOrig[i];
+    that.vertices[1][i] = frameOrig[i] + frameCompA[i];
+    that.vertices[2][i] = frameOrig[i] + frameCompB[i];
+    that.vertices[3][i] = frameOrig[i] + frameCompC[i];
+    that.vertices[4][i] = frameOrig[i] + (frameCompA[i] + frameCompB[i]);
+    that.vertices[5][i] = frameOrig[i] + (frameCompA[i] + frameCompC[i]);
+    that.vertices[6][i] = frameOrig[i] + (frameCompB[i] + frameCompC[i]);
+    that.vertices[7][i] =
+      frameOrig[i] + (frameCompA[i] + frameCompB[i] + frameCompC[i]);
+
+    // Get the edges
+    that.edges[0][i] = frameCompA[i];
+    that.edges[1][i] = frameCompB[i];
+    that.edges[2][i] = frameCompC[i];
+    that.edges[3][i] = frameCompB[i] - frameCompA[i];
+    that.edges[4][i] = frameCompB[i] - frameCompC[i];
+    that.edges[5][i] = frameCompC[i] - frameCompA[i];
+
+  }
+
+  // Get the normals to the faces
+  const FMB_REAL* faceEdges[4][2] = {
+
+    {frameCompA, frameCompB},
+    {frameCompA, frameCompC},
+    {frameCompC, frameCompB},
+    {that.edges[3], that.edges[4]}
+
+  };
+  for (
+    int iFace = 4;
+    iFace--;) {
+
+    const FMB_REAL* u = faceEdges[iFace][0];
+    const FMB_REAL* v = faceEdges[iFace][1];
+    that.normFaces[iFace][0] = u[1] * v[2] - u[2] * v[1];
+    that.normFaces[iFace][1] = u[2] * v[0] - u[0] * v[2];
+    that.normFaces[iFace][2] = u[0] * v[1] - u[1] * v[0];
+
+  }
+
+  // Return the geometry
+  return that;
+
+}
+
+// Test for intersection between the 3D Frames whose geometries are
+// that and tho
+// Return true if the two Frames are intersecting, else false
+static bool SATTestIntersection3DPrecomputedGeneric(
+  const SATFrame3D* const that,
+  const SATFrame3D* const tho) {
+
+  // Declare a variable to loop on Frames and commonalize code
+  const SATFrame3D* frame = that;
+
+  // Loop to commonalize code when checking SAT based on that's faces
+  // and then tho's faces
+  for (
+    int iFrame = 2;
+    iFrame--;) {
 
     // Loop on the frame's faces
     for (
-      int iFace = nbFaces;
+      int iFace = frame->nbFace;
       iFace--;) {
 
       // Check against the current face's normal
       bool isIntersection =
-        CheckAxis3DTime(
+        CheckAxisSATFrame3D(
           that,
           tho,
-          normFaces[iFace],
-          relSpeed);
+          frame->normFaces[iFace]);
 
       // If the axis is separating the Frames
       if (isIntersection == false) {
@@ -976,60 +1567,36 @@ bool SATTestIntersection3DTime(
 
     // Switch the frame to test against the second Frame
     frame = tho;
-    oppEdgesA = oppEdgesTho;
 
   }
 
   // Loop on the pair of edges between the two frames
   for (
-    int iEdgeThat = nbEdgesThat;
+    int iEdgeThat = that->nbEdge;
     iEdgeThat--;) {
 
-    // Get the first edge
-    const double* edgeThat = NULL;
-    if (iEdgeThat < 3) {
-
-      edgeThat = that->comp[iEdgeThat];
-
-    } else {
-
-      edgeThat = oppEdgesThat[iEdgeThat - 3];
-
-    }
+    // Shortcut
+    const FMB_REAL* edgeThat = that->edges[iEdgeThat];
 
     for (
-      int iEdgeTho = nbEdgesTho + 1;
+      int iEdgeTho = tho->nbEdge;
       iEdgeTho--;) {
 
-      // Get the second edge
-      const double* edgeTho = NULL;
-      if (iEdgeTho == nbEdgesTho) {
-
-        edgeTho = relSpeed;
-
-      } else if (iEdgeTho < 3) {
-
-        edgeTho = tho->comp[iEdgeTho];
-
-      } else {
-
-        edgeTho = oppEdgesTho[iEdgeTho - 3];
-
-      }
+      // Shortcut
+      const FMB_REAL* edgeTho = tho->edges[iEdgeTho];
 
       // Get the cross product of the two edges
-      double axis[3];
+      FMB_REAL axis[3];
       axis[0] = edgeThat[1] * edgeTho[2] - edgeThat[2] * edgeTho[1];
       axis[1] = edgeThat[2] * edgeTho[0] - edgeThat[0] * edgeTho[2];
       axis[2] = edgeThat[0] * edgeTho[1] - edgeThat[1] * edgeTho[0];
 
       // Check against the cross product of the two edges
       bool isIntersection =
-        CheckAxis3DTime(
+        CheckAxisSATFrame3D(
           that,
           tho,
-          axis,
-          relSpeed);
+          axis);
 
       // If the axis is separating the Frames
       if (isIntersection == false) {
@@ -1049,167 +1616,1077 @@ bool SATTestIntersection3DTime(
 
 }
 
-// Test for intersection between 3D Frame that and 3D Frame tho,
-// both faces
-// Return true if the two Frames are intersecting, else false
-bool SATTestIntersection3DFace(
-  const Frame3D* const that,
-  const Frame3D* const tho) {
+// Test for intersection with the current implementation
+// (cf FrameGetCPUPath)
+bool SATTestIntersection3DPrecomputed(
+  const SATFrame3D* const that,
+  const SATFrame3D* const tho) {
 
-  // Check against that's normal
-  bool isIntersection =
-    CheckAxis3DFace(
+  return
+    satTestIntersection3DPrecomputedCPU[FrameGetCPUPath()](
       that,
-      tho,
-      that->comp[2]);
+      tho);
 
-  // If the axis is separating the Frames
-  if (isIntersection == false) {
+}
 
-    // The Frames are not in intersection,
-    // terminate the test
-    return false;
+// Test for intersection between moving 3D Frame that and 3D
+// Frame tho
+// Return true if the two Frames are intersecting, else false
+static inline bool SATTestIntersection3DTimePath(
+  const Frame3DTime* const that,
+  const Frame3DTime* const tho,
+  const FrameCPUPath path) {
+
+  // Declare two variables to memorize the opposite edges in case
+  // of tetrahedron
+  FMB_REAL oppEdgesThat[3][3];
+  FMB_REAL oppEdgesTho[3][3];
+
+  // Declare a variable to memorize the speed of tho relative to that
+  FMB_REAL relSpeed[3];
+  relSpeed[0] = tho->speed[0] - that->speed[0];
+  relSpeed[1] = tho->speed[1] - that->speed[1];
+  relSpeed[2] = tho->speed[2] - that->speed[2];
+
+  // Declare two variables to memorize the number of edges, by default 3
+  int nbEdgesThat = 3;
+  int nbEdgesTho = 3;
+
+  // Get the implementation of the projection of the vertices and, if
+  // it is vectorized, initialise the vertices, those of tho at the
+  // beginning and end of the move relative to that
+  SATCheckMode mode = satCheckMode;
+  SATCheck check;
+  if (mode != SATCheckModeScalar) {
+
+    SATCheckSetVertices(
+      &check,
+      0,
+      that->orig,
+      that->comp,
+      satVertexComps3D,
+      (that->type == FrameTetrahedron ? 4 : 8),
+      NULL,
+      path);
+    SATCheckSetVertices(
+      &check,
+      1,
+      tho->orig,
+      tho->comp,
+      satVertexComps3D,
+      (tho->type == FrameTetrahedron ? 4 : 8),
+      relSpeed,
+      path);
+    check.nbAxis = 0;
 
   }
 
-  // Check against tho's normal
-  isIntersection =
-    CheckAxis3DFace(
-      that,
-      tho,
-      tho->comp[2]);
+  // Declare a variable to memorize the index of the separating axis,
+  // unused here
+  int iAxisCheck = 0;
 
-  // If the axis is separating the Frames
-  if (isIntersection == false) {
+  // If the first Frame is a tetrahedron
+  if (that->type == FrameTetrahedron) {
+
+    // Shortcuts
+    const FMB_REAL* frameCompA = that->comp[0];
+    const FMB_REAL* frameCompB = that->comp[1];
+    const FMB_REAL* frameCompC = that->comp[2];
+
+    // Initialise the opposite edges
+    oppEdgesThat[0][0] = frameCompB[0] - frameCompA[0];
+    oppEdgesThat[0][1] = frameCompB[1] - frameCompA[1];
+    oppEdgesThat[0][2] = frameCompB[2] - frameCompA[2];
+
+    oppEdgesThat[1][0] = frameCompB[0] - frameCompC[0];
+    oppEdgesThat[1][1] = frameCompB[1] - frameCompC[1];
+    oppEdgesThat[1][2] = frameCompB[2] - frameCompC[2];
+
+    oppEdgesThat[2][0] = frameCompC[0] - frameCompA[0];
+    oppEdgesThat[2][1] = frameCompC[1] - frameCompA[1];
+    oppEdgesThat[2][2] = frameCompC[2] - frameCompA[2];
+
+    // Correct the number of edges
+    nbEdgesThat = 6;
+
+  }
+
+  // If the second Frame is a tetrahedron
+  if (tho->type == FrameTetrahedron) {
+
+    // Shortcuts
+    const FMB_REAL* frameCompA = tho->comp[0];
+    const FMB_REAL* frameCompB = tho->comp[1];
+    const FMB_REAL* frameCompC = tho->comp[2];
+
+    // Initialise the opposite edges
+    oppEdgesTho[0][0] = frameCompB[0] - frameCompA[0];
+    oppEdgesTho[0][1] = frameCompB[1] - frameCompA[1];
+    oppEdgesTho[0][2] = frameCompB[2] - frameCompA[2];
+
+    oppEdgesTho[1][0] = frameCompB[0] - frameCompC[0];
+    oppEdgesTho[1][1] = frameCompB[1] - frameCompC[1];
+    oppEdgesTho[1][2] = frameCompB[2] - frameCompC[2];
+
+    oppEdgesTho[2][0] = frameCompC[0] - frameCompA[0];
+    oppEdgesTho[2][1] = frameCompC[1] - frameCompA[1];
+    oppEdgesTho[2][2] = frameCompC[2] - frameCompA[2];
+
+    // Correct the number of edges
+    nbEdgesTho = 6;
+
+  }
+
+  // Declare variables to loop on Frames and commonalize code
+  const Frame3DTime* frame = that;
+  const FMB_REAL (*oppEdgesA)[3] = oppEdgesThat;
+
+  // Loop to commonalize code when checking SAT based on that's edges
+  // and then tho's edges
+  for (
+    int iFrame = 2;
+    iFrame--;) {
+
+    // Shortcuts
+    FrameType frameType = frame->type;
+    const FMB_REAL* frameCompA = frame->comp[0];
+    const FMB_REAL* frameCompB = frame->comp[1];
+    const FMB_REAL* frameCompC = frame->comp[2];
+
+    // Declare a variable to memorize the number of faces, by default 3
+    int nbFaces = 3;
+
+    // Declare a variable to memorize the normal to faces
+    // Arrangement is normFaces[iFace][iAxis]
+    FMB_REAL normFaces[10][3];
+
+    // Initialise the normal to faces
+    normFaces[0][0] =
+      frameCompA[1] * frameCompB[2] -
+      frameCompA[2] * frameCompB[1];
+    normFaces[0][1] =
+      frameCompA[2] * frameCompB[0] -
+      frameCompA[0] * frameCompB[2];
+    normFaces[0][2] =
+      frameCompA[0] * frameCompB[1] -
+      frameCompA[1] * frameCompB[0];
+
+    normFaces[1][0] =
+      frameCompA[1] * frameCompC[2] -
+      frameCompA[2] * frameCompC[1];
+    normFaces[1][1] =
+      frameCompA[2] * frameCompC[0] -
+      frameCompA[0] * frameCompC[2];
+    normFaces[1][2] =
+      frameCompA[0] * frameCompC[1] -
+      frameCompA[1] * frameCompC[0];
+
+    normFaces[2][0] =
+      frameCompC[1] * frameCompB[2] -
+      frameCompC[2] * frameCompB[1];
+    normFaces[2][1] =
+      frameCompC[2] * frameCompB[0] -
+      frameCompC[0] * frameCompB[2];
+    normFaces[2][2] =
+      frameCompC[0] * frameCompB[1] -
+      frameCompC[1] * frameCompB[0];
+
+    // If the frame is a tetrahedron
+    if (frameType == FrameTetrahedron) {
+
+      // Shortcuts
+      const FMB_REAL* oppEdgeA = oppEdgesA[0];
+      const FMB_REAL* oppEdgeB = oppEdgesA[1];
+
+      // Initialise the normal to the opposite face
+      normFaces[3][0] =
+        oppEdgeA[1] * oppEdgeB[2] -
+        oppEdgeA[2] * oppEdgeB[1];
+      normFaces[3][1] =
+        oppEdgeA[2] * oppEdgeB[0] -
+        oppEdgeA[0] * oppEdgeB[2];
+      normFaces[3][2] =
+        oppEdgeA[0] * oppEdgeB[1] -
+        oppEdgeA[1] * oppEdgeB[0];
+
+      // Correct the number of faces
+      nbFaces = 4;
+
+    }
+
+    // If we are checking the frame 'tho'
+    if (frame == tho) {
+
+      // Add the normal to the virtual faces created by the speed
+      // of tho relative to that
+      normFaces[nbFaces][0] =
+        relSpeed[1] * frameCompA[2] -
+        relSpeed[2] * frameCompA[1];
+      normFaces[nbFaces][1] =
+        relSpeed[2] * frameCompA[0] -
+        relSpeed[0] * frameCompA[2];
+      normFaces[nbFaces][2] =
+        relSpeed[0] * frameCompA[1] -
+        relSpeed[1] * frameCompA[0];
+      if (
+        fabs(normFaces[nbFaces][0]) > EPSILON ||
+        fabs(normFaces[nbFaces][1]) > EPSILON ||
+        fabs(normFaces[nbFaces][2]) > EPSILON) {
+
+        ++nbFaces;
+
+      }
+
+      normFaces[nbFaces][0] =
+        relSpeed[1] * frameCompB[2] -
+        relSpeed[2] * frameCompB[1];
+      normFaces[nbFaces][1] =
+        relSpeed[2] * frameCompB[0] -
+        relSpeed[0] * frameCompB[2];
+      normFaces[nbFaces][2] =
+        relSpeed[0] * frameCompB[1] -
+        relSpeed[1] * frameCompB[0];
+      if (
+        fabs(normFaces[nbFaces][0]) > EPSILON ||
+        fabs(normFaces[nbFaces][1]) > EPSILON ||
+        fabs(normFaces[nbFaces][2]) > EPSILON) {
+
+        ++nbFaces;
+
+      }
+
+      normFaces[nbFaces][0] =
+        relSpeed[1] * frameCompC[2] -
+        relSpeed[2] * frameCompC[1];
+      normFaces[nbFaces][1] =
+        relSpeed[2] * frameCompC[0] -
+        relSpeed[0] * frameCompC[2];
+      normFaces[nbFaces][2] =
+        relSpeed[0] * frameCompC[1] -
+        relSpeed[1] * frameCompC[0];
+      if (
+        fabs(normFaces[nbFaces][0]) > EPSILON ||
+        fabs(normFaces[nbFaces][1]) > EPSILON ||
+        fabs(normFaces[nbFaces][2]) > EPSILON) {
+
+        ++nbFaces;
+
+      }
+
+      if (frameType == FrameTetrahedron) {
+
+        const FMB_REAL* oppEdgeA = oppEdgesA[0];
+        const FMB_REAL* oppEdgeB = oppEdgesA[1];
+        const FMB_REAL* oppEdgeC = oppEdgesA[2];
+
+        normFaces[nbFaces][0] =
+          relSpeed[1] * oppEdgeA[2] -
+          relSpeed[2] * oppEdgeA[1];
+        normFaces[nbFaces][1] =
+          relSpeed[2] * oppEdgeA[0] -
+          relSpeed[0] * oppEdgeA[2];
+        normFaces[nbFaces][2] =
+          relSpeed[0] * oppEdgeA[1] -
+          relSpeed[1] * oppEdgeA[0];
+        if (
+          fabs(normFaces[nbFaces][0]) > EPSILON ||
+          fabs(normFaces[nbFaces][1]) > EPSILON ||
+          fabs(normFaces[nbFaces][2]) > EPSILON) {
+
+          ++nbFaces;
+
+        }
+
+        normFaces[nbFaces][0] =
+          relSpeed[1] * oppEdgeB[2] -
+          relSpeed[2] * oppEdgeB[1];
+        normFaces[nbFaces][1] =
+          relSpeed[2] * oppEdgeB[0] -
+          relSpeed[0] * oppEdgeB[2];
+        normFaces[nbFaces][2] =
+          relSpeed[0] * oppEdgeB[1] -
+          relSpeed[1] * oppEdgeB[0];
+        if (
+          fabs(normFaces[nbFaces][0]) > EPSILON ||
+          fabs(normFaces[nbFaces][1]) > EPSILON ||
+          fabs(normFaces[nbFaces][2]) > EPSILON) {
+
+          ++nbFaces;
+
+        }
+
+        normFaces[nbFaces][0] =
+          relSpeed[1] * oppEdgeC[2] -
+          relSpeed[2] * oppEdgeC[1];
+        normFaces[nbFaces][1] =
+          relSpeed[2] * oppEdgeC[0] -
+          relSpeed[0] * oppEdgeC[2];
+        normFaces[nbFaces][2] =
+          relSpeed[0] * oppEdgeC[1] -
+          relSpeed[1] * oppEdgeC[0];
+        if (
+          fabs(normFaces[nbFaces][0]) > EPSILON ||
+          fabs(normFaces[nbFaces][1]) > EPSILON ||
+          fabs(normFaces[nbFaces][2]) > EPSILON) {
+
+          ++nbFaces;
+
+        }
+
+      }
+
+    }
+
+    // Loop on the frame's faces
+    for (
+      int iFace = nbFaces;
+      iFace--;) {
+
+      // Check against the current face's normal
+      bool isIntersection =
+        (mode == SATCheckModeScalar ?
+          CheckAxis3DTime(
+            that,
+            tho,
+            normFaces[iFace],
+            relSpeed) :
+          SATCheckAxis(
+            &check,
+            mode,
+            normFaces[iFace],
+            iAxisCheck,
+            &iAxisCheck,
+            path));
+
+      // If the axis is separating the Frames
+      if (isIntersection == false) {
+
+        // The Frames are not in intersection,
+        // terminate the test
+        return false;
+
+      }
+
+    }
+
+    // Switch the frame to test against the second Frame
+    frame = tho;
+    oppEdgesA = oppEdgesTho;
+
+  }
+
+  // Loop on the pair of edges between the two frames
+  for (
+    int iEdgeThat = nbEdgesThat;
+    iEdgeThat--;) {
+
+    // Get the first edge
+    const FMB_REAL* edgeThat = NULL;
+    if (iEdgeThat < 3) {
+
+      edgeThat = that->comp[iEdgeThat];
+
+    } else {
+
+      edgeThat = oppEdgesThat[iEdgeThat - 3];
+
+    }
+
+    for (
+      int iEdgeTho = nbEdgesTho + 1;
+      iEdgeTho--;) {
+
+      // Get the second edge
+      const FMB_REAL* edgeTho = NULL;
+      if (iEdgeTho == nbEdgesTho) {
+
+        edgeTho = relSpeed;
+
+      } else if (iEdgeTho < 3) {
+
+        edgeTho = tho->comp[iEdgeTho];
+
+      } else {
+
+        edgeTho = oppEdgesTho[iEdgeTho - 3];
+
+      }
+
+      // Get the cross product of the two edges
+      FMB_REAL axis[3];
+      axis[0] = edgeThat[1] * edgeTho[2] - edgeThat[2] * edgeTho[1];
+      axis[1] = edgeThat[2] * edgeTho[0] - edgeThat[0] * edgeTho[2];
+      axis[2] = edgeThat[0] * edgeTho[1] - edgeThat[1] * edgeTho[0];
+
+      // Check against the cross product of the two edges
+      bool isIntersection =
+        (mode == SATCheckModeScalar ?
+          CheckAxis3DTime(
+            that,
+            tho,
+            axis,
+            relSpeed) :
+          SATCheckAxis(
+            &check,
+            mode,
+            axis,
+            iAxisCheck,
+            &iAxisCheck,
+            path));
+
+      // If the axis is separating the Frames
+      if (isIntersection == false) {
+
+        // The Frames are not in intersection,
+        // terminate the test
+        return false;
+
+      }
+
+    }
+
+  }
+
+  // Check the axes remaining in the group if they are checked by
+  // groups
+  if (
+    mode == SATCheckModeSIMDAxes &&
+    SATCheckAxes(
+      &check,
+      &iAxisCheck,
+      path) == false) {
+
+    // The Frames are not in intersection
+    return false;
+
+  }
+
+  // If we reaches here, it means the two Frames are intersecting
+  return true;
+
+}
+
+// Test for intersection with the current implementation
+// (cf FrameGetCPUPath)
+bool SATTestIntersection3DTime(
+  const Frame3DTime* const that,
+  const Frame3DTime* const tho) {
+
+  return
+    satTestIntersection3DTimeCPU[FrameGetCPUPath()](
+      that,
+      tho);
+
+}
+
+// Test for intersection between 3D Frame that and 3D Frame tho,
+// both faces
+// Return true if the two Frames are intersecting, else false
+static inline bool SATTestIntersection3DFacePath(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  const FrameCPUPath path) {
+
+  // Get the implementation of the projection of the vertices and, if
+  // it is vectorized, initialise the vertices
+  SATCheckMode mode = satCheckMode;
+  SATCheck check;
+  if (mode != SATCheckModeScalar) {
+
+    SATCheckSetVertices(
+      &check,
+      0,
+      that->orig,
+      that->comp,
+      satVertexComps3DFace,
+      (that->type == FrameTetrahedron ? 3 : 4),
+      NULL,
+      path);
+    SATCheckSetVertices(
+      &check,
+      1,
+      tho->orig,
+      tho->comp,
+      satVertexComps3DFace,
+      (tho->type == FrameTetrahedron ? 3 : 4),
+      NULL,
+      path);
+    check.nbAxis = 0;
+
+  }
+
+  // Declare a variable to memorize the index of the separating axis,
+  // unused here
+  int iAxisCheck = 0;
+
+  // Check against that's normal
+  bool isIntersection =
+    (mode == SATCheckModeScalar ?
+      CheckAxis3DFace(
+        that,
+        tho,
+        that->comp[2]) :
+      SATCheckAxis(
+        &check,
+        mode,
+        that->comp[2],
+        iAxisCheck,
+        &iAxisCheck,
+        path));
+
+  // If the axis is separating the Frames
+  if (isIntersection == false) {
+
+    // The Frames are not in intersection,
+    // terminate the test
+    return false;
+
+  }
+
+  // Check against tho's normal
+  isIntersection =
+    (mode == SATCheckModeScalar ?
+      CheckAxis3DFace(
+        that,
+        tho,
+        tho->comp[2]) :
+      SATCheckAxis(
+        &check,
+        mode,
+        tho->comp[2],
+        iAxisCheck,
+        &iAxisCheck,
+        path));
+
+  // If the axis is separating the Frames
+  if (isIntersection == false) {
+
+    // The Frames are not in intersection,
+    // terminate the test
+    return false;
+
+  }
+
+  // Declare two variables to memorize the opposite edges in case
+  // of tetrahedron
+  FMB_REAL oppEdgeThat[3];
+  FMB_REAL oppEdgeTho[3];
+
+  // Declare two variables to memorize the number of edges, by default 3
+  int nbEdgesThat = 2;
+  int nbEdgesTho = 2;
+
+  // If the first Frame is a tetrahedron
+  if (that->type == FrameTetrahedron) {
+
+    // Shortcuts
+    const FMB_REAL* frameCompA = that->comp[0];
+    const FMB_REAL* frameCompB = that->comp[1];
+
+    // Initialise the opposite edges
+    oppEdgeThat[0] = frameCompB[0] - frameCompA[0];
+    oppEdgeThat[1] = frameCompB[1] - frameCompA[1];
+    oppEdgeThat[2] = frameCompB[2] - frameCompA[2];
+
+    // Correct the number of edges
+    nbEdgesThat = 3;
+
+  }
+
+  // If the second Frame is a tetrahedron
+  if (tho->type == FrameTetrahedron) {
+
+    // Shortcuts
+    const FMB_REAL* frameCompA = tho->comp[0];
+    const FMB_REAL* frameCompB = tho->comp[1];
+
+    // Initialise the opposite edges
+    oppEdgeTho[0] = frameCompB[0] - frameCompA[0];
+    oppEdgeTho[1] = frameCompB[1] - frameCompA[1];
+    oppEdgeTho[2] = frameCompB[2] - frameCompA[2];
+
+    // Correct the number of edges
+    nbEdgesTho = 3;
+
+  }
+
+  // Loop on the pair of edges between the two frames
+  for (
+    int iEdgeThat = nbEdgesThat;
+    iEdgeThat--;) {
+
+    // Get the first edge
+    const FMB_REAL* edgeThat = NULL;
+    if (iEdgeThat < 2) {
+
+      edgeThat = that->comp[iEdgeThat];
+
+    } else {
+
+      edgeThat = oppEdgeThat;
+
+    }
+
+    for (
+      int iEdgeTho = nbEdgesTho;
+      iEdgeTho--;) {
+
+      // Get the second edge
+      const FMB_REAL* edgeTho = NULL;
+      if (iEdgeTho < 2) {
+
+        edgeTho = tho->comp[iEdgeTho];
+
+      } else {
+
+        edgeTho = oppEdgeTho;
+
+      }
+
+      // Get the cross product of the two edges
+      FMB_REAL axis[3];
+      axis[0] = edgeThat[1] * edgeTho[2] - edgeThat[2] * edgeTho[1];
+      axis[1] = edgeThat[2] * edgeTho[0] - edgeThat[0] * edgeTho[2];
+      axis[2] = edgeThat[0] * edgeTho[1] - edgeThat[1] * edgeTho[0];
+
+      // Check against the cross product of the two edges
+      bool isIntersection =
+        (mode == SATCheckModeScalar ?
+          CheckAxis3DFace(
+            that,
+            tho,
+            axis) :
+          SATCheckAxis(
+            &check,
+            mode,
+            axis,
+            iAxisCheck,
+            &iAxisCheck,
+            path));
+
+      // If the axis is separating the Frames
+      if (isIntersection == false) {
+
+        // The Frames are not in intersection,
+        // terminate the test
+        return false;
+
+      }
+
+    }
+
+  }
+
+  // Check the axes remaining in the group if they are checked by
+  // groups
+  if (
+    mode == SATCheckModeSIMDAxes &&
+    SATCheckAxes(
+      &check,
+      &iAxisCheck,
+      path) == false) {
+
+    // The Frames are not in intersection
+    return false;
+
+  }
+
+  // If we reaches here, it means the two Frames are intersecting
+  return true;
+
+}
+
+// Test for intersection with the current implementation
+// (cf FrameGetCPUPath)
+bool SATTestIntersection3DFace(
+  const Frame3D* const that,
+  const Frame3D* const tho) {
+
+  return
+    satTestIntersection3DFaceCPU[FrameGetCPUPath()](
+      that,
+      tho);
+
+}
+
+// Check the intersection constraint for Frames that and tho
+// relatively to axis
+static bool CheckAxis3D(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  const FMB_REAL* const axis) {
+
+  // Declare variables to memorize the boundaries of projection
+  // of the two frames on the current edge
+  FMB_REAL bdgBoxA[2];
+  FMB_REAL bdgBoxB[2];
+
+  // Declare two variables to loop on Frames and commonalize code
+  const Frame3D* frame = that;
+  FMB_REAL* bdgBox = bdgBoxA;
+
+  // Loop on Frames
+  for (
+    int iFrame = 2;
+    iFrame--;) {
+
+    // Shortcuts
+    const FMB_REAL* frameOrig = frame->orig;
+    const FMB_REAL* frameCompA = frame->comp[0];
+    const FMB_REAL* frameCompB = frame->comp[1];
+    const FMB_REAL* frameCompC = frame->comp[2];
+    FrameType frameType = frame->type;
+
+    // Get the number of vertices of frame
+    int nbVertices = (frameType == FrameTetrahedron ? 4 : 8);
+
+    // Declare a variable to memorize if the current vertex is
+    // the first in the loop, used to initialize the boundaries
+    bool firstVertex = true;
+
+    // Loop on vertices of the frame
+    for (
+      int iVertex = nbVertices;
+      iVertex--;) {
+
+      // Get the vertex
+      FMB_REAL vertex[3];
+      vertex[0] = frameOrig[0];
+      vertex[1] = frameOrig[1];
+      vertex[2] = frameOrig[2];
+      switch (iVertex) {
+
+        case 7:
+          vertex[0] +=
+            frameCompA[0] +  frameCompB[0] + frameCompC[0];
+          vertex[1] +=
+            frameCompA[1] +  frameCompB[1] + frameCompC[1];
+          vertex[2] +=
+            frameCompA[2] +  frameCompB[2] + frameCompC[2];
+          break;
+        case 6:
+          vertex[0] += frameCompB[0] + frameCompC[0];
+          vertex[1] += frameCompB[1] + frameCompC[1];
+          vertex[2] += frameCompB[2] + frameCompC[2];
+          break;
+        case 5:
+          vertex[0] += frameCompA[0] + frameCompC[0];
+          vertex[1] += frameCompA[1] + frameCompC[1];
+          vertex[2] += frameCompA[2] + frameCompC[2];
+          break;
+        case 4:
+          vertex[0] += frameCompA[0] + frameCompB[0];
+          vertex[1] += frameCompA[1] + frameCompB[1];
+          vertex[2] += frameCompA[2] + frameCompB[2];
+          break;
+        case 3:
+          vertex[0] += frameCompC[0];
+          vertex[1] += frameCompC[1];
+          vertex[2] += frameCompC[2];
+          break;
+        case 2:
+          vertex[0] += frameCompB[0];
+          vertex[1] += frameCompB[1];
+          vertex[2] += frameCompB[2];
+          break;
+        case 1:
+          vertex[0] += frameCompA[0];
+          vertex[1] += frameCompA[1];
+          vertex[2] += frameCompA[2];
+          break;
+        default:
+          break;
+
+      }
+
+      // Get the projection of the vertex on the axis
+      FMB_REAL proj =
+        vertex[0] * axis[0] +
+        vertex[1] * axis[1] +
+        vertex[2] * axis[2];
+
+      // If it's the first vertex
+      if (firstVertex == true) {
+
+        // Initialize the boundaries of the projection of the
+        // Frame on the edge
+        bdgBox[0] = proj;
+        bdgBox[1] = proj;
+
+        // Update the flag to memorize we did the first vertex
+        firstVertex = false;
+
+      // Else, it's not the first vertex
+      } else {
+
+        // Update the boundaries of the projection of the Frame on
+        // the edge
+        if (bdgBox[0] > proj) {
+
+          bdgBox[0] = proj;
+
+        }
+
+        if (bdgBox[1] < proj) {
+
+          bdgBox[1] = proj;
+
+        }
+
+      }
+
+    }
+
+    // Switch the frame to check the vertices of the second Frame
+    frame = tho;
+    bdgBox = bdgBoxB;
+
+  }
+
+  // If the projections of the two frames on the edge are
+  // not intersecting
+  if (
+    bdgBoxB[1] < bdgBoxA[0] ||
+    bdgBoxA[1] < bdgBoxB[0]) {
+
+    // There exists an axis which separates the Frames,
+    // thus they are not in intersection
+    return false;
+
+  }
+
+  // If we reaches here the two Frames are in intersection
+  return true;
+
+}
+
+// Check the intersection constraint for the 3D Frames whose
+// geometries are that and tho, relatively to axis
+static bool CheckAxisSATFrame3D(
+  const SATFrame3D* const that,
+  const SATFrame3D* const tho,
+  const FMB_REAL* const axis) {
+
+  // Declare variables to memorize the boundaries of projection
+  // of the two frames on the current edge
+  FMB_REAL bdgBoxA[2];
+  FMB_REAL bdgBoxB[2];
+
+  // Declare two variables to loop on Frames and commonalize code
+  const SATFrame3D* frame = that;
+  FMB_REAL* bdgBox = bdgBoxA;
+
+  // Loop on Frames
+  for (
+    int iFrame = 2;
+    iFrame--;) {
+
+    // Initialize the boundaries of the projection of the Frame on the
+    // axis with the projection of its origin
+    const FMB_REAL* vertex = frame->vertices[0];
+    bdgBox[0] =
+      vertex[0] * axis[0] +
+      vertex[1] * axis[1] +
+      vertex[2] * axis[2];
+    bdgBox[1] = bdgBox[0];
+
+    // Loop on the other vertices of the frame
+    for (
+      int iVertex = frame->nbVertex;
+      --iVertex;) {
+
+      // Get the projection of the vertex on the axis
+      vertex = frame->vertices[iVertex];
+      FMB_REAL proj =
+        vertex[0] * axis[0] +
+        vertex[1] * axis[1] +
+        vertex[2] * axis[2];
+
+      // Update the boundaries of the projection of the Frame on
+      // the axis
+      if (bdgBox[0] > proj) {
+
+        bdgBox[0] = proj;
+
+      }
 
-    // The Frames are not in intersection,
-    // terminate the test
-    return false;
+      if (bdgBox[1] < proj) {
 
-  }
+        bdgBox[1] = proj;
 
-  // Declare two variables to memorize the opposite edges in case
-  // of tetrahedron
-  double oppEdgeThat[3];
-  double oppEdgeTho[3];
+      }
 
-  // Declare two variables to memorize the number of edges, by default 3
-  int nbEdgesThat = 2;
-  int nbEdgesTho = 2;
+    }
 
-  // If the first Frame is a tetrahedron
-  if (that->type == FrameTetrahedron) {
+    // Switch the frame to check the vertices of the second Frame
+    frame = tho;
+    bdgBox = bdgBoxB;
 
-    // Shortcuts
-    const double* frameCompA = that->comp[0];
-    const double* frameCompB = that->comp[1];
+  }
 
-    // Initialise the opposite edges
-    oppEdgeThat[0] = frameCompB[0] - frameCompA[0];
-    oppEdgeThat[1] = frameCompB[1] - frameCompA[1];
-    oppEdgeThat[2] = frameCompB[2] - frameCompA[2];
+  // If the projections of the two frames on the axis are
+  // not intersecting
+  if (
+    bdgBoxB[1] < bdgBoxA[0] ||
+    bdgBoxA[1] < bdgBoxB[0]) {
 
-    // Correct the number of edges
-    nbEdgesThat = 3;
+    // There exists an axis which separates the Frames,
+    // thus they are not in intersection
+    return false;
 
   }
 
-  // If the second Frame is a tetrahedron
-  if (tho->type == FrameTetrahedron) {
+  // If we reaches here the two Frames are in intersection
+  return true;
 
-    // Shortcuts
-    const double* frameCompA = tho->comp[0];
-    const double* frameCompB = tho->comp[1];
+}
 
-    // Initialise the opposite edges
-    oppEdgeTho[0] = frameCompB[0] - frameCompA[0];
-    oppEdgeTho[1] = frameCompB[1] - frameCompA[1];
-    oppEdgeTho[2] = frameCompB[2] - frameCompA[2];
+// Check the intersection constraint for Frames that and tho,
+// both faces, relatively to axis
+bool CheckAxis3DFace(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  const FMB_REAL* const axis) {
 
-    // Correct the number of edges
-    nbEdgesTho = 3;
+  // Declare variables to memorize the boundaries of projection
+  // of the two frames on the current edge
+  FMB_REAL bdgBoxA[2];
+  FMB_REAL bdgBoxB[2];
 
-  }
+  // Declare two variables to loop on Frames and commonalize code
+  const Frame3D* frame = that;
+  FMB_REAL* bdgBox = bdgBoxA;
 
-  // Loop on the pair of edges between the two frames
+  // Loop on Frames
   for (
-    int iEdgeThat = nbEdgesThat;
-    iEdgeThat--;) {
+    int iFrame = 2;
+    iFrame--;) {
 
-    // Get the first edge
-    const double* edgeThat = NULL;
-    if (iEdgeThat < 2) {
+    // Shortcuts
+    const FMB_REAL* frameOrig = frame->orig;
+    const FMB_REAL* frameCompA = frame->comp[0];
+    const FMB_REAL* frameCompB = frame->comp[1];
+    FrameType frameType = frame->type;
 
-      edgeThat = that->comp[iEdgeThat];
+    // Get the number of vertices of frame
+    int nbVertices = (frameType == FrameTetrahedron ? 3 : 4);
 
-    } else {
+    // Declare a variable to memorize if the current vertex is
+    // the first in the loop, used to initialize the boundaries
+    bool firstVertex = true;
 
-      edgeThat = oppEdgeThat;
+    // Loop on vertices of the frame
+    for (
+      int iVertex = nbVertices;
+      iVertex--;) {
 
-    }
+      // Get the vertex
+      FMB_REAL vertex[3];
+      vertex[0] = frameOrig[0];
+      vertex[1] = frameOrig[1];
+      vertex[2] = frameOrig[2];
+      switch (iVertex) {
 
-    for (
-      int iEdgeTho = nbEdgesTho;
-      iEdgeTho--;) {
+        case 3:
+          vertex[0] +=
+            frameCompA[0] +  frameCompB[0];
+          vertex[1] +=
+            frameCompA[1] +  frameCompB[1];
+          vertex[2] +=
+            frameCompA[2] +  frameCompB[2];
+          break;
+        case 2:
+          vertex[0] += frameCompB[0];
+          vertex[1] += frameCompB[1];
+          vertex[2] += frameCompB[2];
+          break;
+        case 1:
+          vertex[0] += frameCompA[0];
+          vertex[1] += frameCompA[1];
+          vertex[2] += frameCompA[2];
+          break;
+        default:
+          break;
 
-      // Get the second edge
-      const double* edgeTho = NULL;
-      if (iEdgeTho < 2) {
+      }
 
-        edgeTho = tho->comp[iEdgeTho];
+      // Get the projection of the vertex on the axis
+      FMB_REAL proj =
+        vertex[0] * axis[0] +
+        vertex[1] * axis[1] +
+        vertex[2] * axis[2];
+
+      // If it's the first vertex
+      if (firstVertex == true) {
+
+        // Initialize the boundaries of the projection of the
+        // Frame on the edge
+        bdgBox[0] = proj;
+        bdgBox[1] = proj;
+
+        // Update the flag to memorize we did the first vertex
+        firstVertex = false;
 
+      // Else, it's not the first vertex
       } else {
 
-        edgeTho = oppEdgeTho;
+        // Update the boundaries of the projection of the Frame on
+        // the edge
+        if (bdgBox[0] > proj) {
 
-      }
+          bdgBox[0] = proj;
 
-      // Get the cross product of the two edges
-      double axis[3];
-      axis[0] = edgeThat[1] * edgeTho[2] - edgeThat[2] * edgeTho[1];
-      axis[1] = edgeThat[2] * edgeTho[0] - edgeThat[0] * edgeTho[2];
-      axis[2] = edgeThat[0] * edgeTho[1] - edgeThat[1] * edgeTho[0];
+        }
 
-      // Check against the cross product of the two edges
-      bool isIntersection =
-        CheckAxis3DFace(
-          that,
-          tho,
-          axis);
+        if (bdgBox[1] < proj) {
 
-      // If the axis is separating the Frames
-      if (isIntersection == false) {
+          bdgBox[1] = proj;
 
-        // The Frames are not in intersection,
-        // terminate the test
-        return false;
+        }
 
       }
 
     }
 
+    // Switch the frame to check the vertices of the second Frame
+    frame = tho;
+    bdgBox = bdgBoxB;
+
   }
 
-  // If we reaches here, it means the two Frames are intersecting
+  // If the projections of the two frames on the edge are
+  // not intersecting
+  if (
+    bdgBoxB[1] < bdgBoxA[0] ||
+    bdgBoxA[1] < bdgBoxB[0]) {
+
+    // There exists an axis which separates the Frames,
+    // thus they are not in intersection
+    return false;
+
+  }
+
+  // If we reaches here the two Frames are in intersection
   return true;
 
 }
 
 // Check the intersection constraint for Frames that and tho
 // relatively to axis
-bool CheckAxis3D(
-  const Frame3D* const that,
-  const Frame3D* const tho,
-  const double* const axis) {
+static bool CheckAxis3DTime(
+  const Frame3DTime* const that,
+  const Frame3DTime* const tho,
+  const FMB_REAL* const axis,
+  const FMB_REAL* const relSpeed) {
 
   // Declare variables to memorize the boundaries of projection
   // of the two frames on the current edge
-  double bdgBoxA[2];
-  double bdgBoxB[2];
+  FMB_REAL bdgBoxA[2];
+  FMB_REAL bdgBoxB[2];
 
   // Declare two variables to loop on Frames and commonalize code
-  const Frame3D* frame = that;
-  double* bdgBox = bdgBoxA;
+  const Frame3DTime* frame = that;
+  FMB_REAL* bdgBox = bdgBoxA;
 
   // Loop on Frames
   for (
@@ -1217,10 +2694,10 @@ bool CheckAxis3D(
     iFrame--;) {
 
     // Shortcuts
-    const double* frameOrig = frame->orig;
-    const double* frameCompA = frame->comp[0];
-    const double* frameCompB = frame->comp[1];
-    const double* frameCompC = frame->comp[2];
+    const FMB_REAL* frameOrig = frame->orig;
+    const FMB_REAL* frameCompA = frame->comp[0];
+    const FMB_REAL* frameCompB = frame->comp[1];
+    const FMB_REAL* frameCompC = frame->comp[2];
     FrameType frameType = frame->type;
 
     // Get the number of vertices of frame
@@ -1236,7 +2713,7 @@ bool CheckAxis3D(
       iVertex--;) {
 
       // Get the vertex
-      double vertex[3];
+      FMB_REAL vertex[3];
       vertex[0] = frameOrig[0];
       vertex[1] = frameOrig[1];
       vertex[2] = frameOrig[2];
@@ -1286,7 +2763,7 @@ bool CheckAxis3D(
       }
 
       // Get the projection of the vertex on the axis
-      double proj =
+      FMB_REAL proj =
         vertex[0] * axis[0] +
         vertex[1] * axis[1] +
         vertex[2] * axis[2];
@@ -1321,6 +2798,33 @@ bool CheckAxis3D(
 
       }
 
+      // If we are checking the second frame's vertices
+      if (frame == tho) {
+
+        // Check also the vertices moved by the relative speed
+        vertex[0] += relSpeed[0];
+        vertex[1] += relSpeed[1];
+        vertex[2] += relSpeed[2];
+
+        proj =
+          vertex[0] * axis[0] +
+          vertex[1] * axis[1] +
+          vertex[2] * axis[2];
+
+        if (bdgBox[0] > proj) {
+
+          bdgBox[0] = proj;
+
+        }
+
+        if (bdgBox[1] < proj) {
+
+          bdgBox[1] = proj;
+
+        }
+
+      }
+
     }
 
     // Switch the frame to check the vertices of the second Frame
@@ -1329,38 +2833,229 @@ bool CheckAxis3D(
 
   }
 
-  // If the projections of the two frames on the edge are
-  // not intersecting
-  if (
-    bdgBoxB[1] < bdgBoxA[0] ||
-    bdgBoxA[1] < bdgBoxB[0]) {
+  // If the projections of the two frames on the edge are
+  // not intersecting
+  if (
+    bdgBoxB[1] < bdgBoxA[0] ||
+    bdgBoxA[1] < bdgBoxB[0]) {
+
+    // There exists an axis which separates the Frames,
+    // thus they are not in intersection
+    return false;
+
+  }
+
+  // If we reaches here the two Frames are in intersection
+  return true;
+
+}
+
+// Set the vertices of the iFrame-th Frame (0 for that, 1 for tho) of
+// the SATCheck check from the Frame of origin orig and components
+// comp, where comps[iVertex] are the bits of the components added to
+// the origin to get the iVertex-th vertex, and if relSpeed is not null
+// add the same vertices moved by relSpeed, padded for the SIMD kernels
+// of the FrameCPUPath path
+// The vertices are calculated as in CheckAxis3D, CheckAxis3DTime and
+// CheckAxis3DFace to get identical projections
+static inline void SATCheckSetVertices(
+  SATCheck* const check,
+  const int iFrame,
+  const FMB_REAL* const orig,
+  const FMB_REAL (*comp)[3],
+  const int* const comps,
+  const int nbVertex,
+  const FMB_REAL* const relSpeed,
+  const FrameCPUPath path) {
+
+  // Shortcut
+  FMB_REAL (*vertices)[SAT_NB_VERTEX_MAX] = check->vertices[iFrame];
+
+  // Loop on the vertices and coordinates
+  for (
+    int iVertex = nbVertex;
+    iVertex--;) {
+
+    for (
+      int i = 3;
+      i--;) {
+
+      // Sum the components of the vertex, in the same order as
+      // CheckAxis3D, and add them to the origin
+      FMB_REAL vertex = orig[i];
+      if (comps[iVertex] != 0) {
+
+        FMB_REAL sum = 0.0;
+        bool isFirst = true;
+        for (
+          int iComp = 0;
+          iComp < 3;
+          ++iComp) {
+
+          if (((comps[iVertex] >> iComp) & 1) != 0) {
+
+            sum = (isFirst == true ? comp[iComp][i] : sum + comp[iComp][i]);
+            isFirst = false;
+
+          }
+
+        }
+
+        vertex += sum;
+
+      }
+
+      vertices[i][iVertex] = vertex;
+
+      // Add the vertex moved by the relative speed if requested
+      if (relSpeed != NULL) {
+
+        vertices[i][nbVertex + iVertex] = vertex + relSpeed[i];
+
+      }
+
+    }
+
+  }
+
+  // Memorize the nb of vertices and pad them with the first one
+  int nbVertexTot = (relSpeed != NULL ? 2 * nbVertex : nbVertex);
+  const int width = FrameSIMDWidth(path);
+  int nbVertexPad = ((nbVertexTot + width - 1) / width) * width;
+  for (
+    int iVertex = nbVertexTot;
+    iVertex < nbVertexPad;
+    ++iVertex) {
+
+    for (
+      int i = 3;
+      i--;) {
+
+      vertices[i][iVertex] = vertices[i][0];
+
+    }
+
+  }
+
+  check->nbVertex[iFrame] = nbVertexTot;
+  check->nbVertexPad[iFrame] = nbVertexPad;
+
+}
+
+// Implementations of SATCheckAxes and SATCheckAxis for each
+// FrameCPUPath, vectorized on the width of the path (cf framesimd.h)
+#define FRAME_SIMD_PATH FRAME_SIMD_GENERIC
+#include "satsimd.h"
+#define FRAME_SIMD_PATH FRAME_SIMD_SSE2
+#include "satsimd.h"
+#define FRAME_SIMD_PATH FRAME_SIMD_AVX2
+#include "satsimd.h"
+#define FRAME_SIMD_PATH FRAME_SIMD_AVX512
+#include "satsimd.h"
+
+// Check the intersection constraint along axis, the iAxis-th axis of
+// the test, for the vertices of the SATCheck check with the vectorized
+// implementation mode (cf SATCheckMode) and the kernel of the
+// FrameCPUPath path
+// The path being constant in the callers, the selection of the kernel
+// is resolved at compilation
+static inline bool SATCheckAxis(
+  SATCheck* const check,
+  const SATCheckMode mode,
+  const FMB_REAL* const axis,
+  const int iAxis,
+  int* const iAxisSep,
+  const FrameCPUPath path) {
+
+  switch (path) {
+
+    case FrameCPUSSE2:
+      return
+        SATCheckAxisSSE2(
+          check,
+          mode,
+          axis,
+          iAxis,
+          iAxisSep);
+    case FrameCPUAVX2:
+      return
+        SATCheckAxisAVX2(
+          check,
+          mode,
+          axis,
+          iAxis,
+          iAxisSep);
+    case FrameCPUAVX512:
+      return
+        SATCheckAxisAVX512(
+          check,
+          mode,
+          axis,
+          iAxis,
+          iAxisSep);
+    default:
+      return
+        SATCheckAxisGeneric(
+          check,
+          mode,
+          axis,
+          iAxis,
+          iAxisSep);
+
+  }
+
+}
 
-    // There exists an axis which separates the Frames,
-    // thus they are not in intersection
-    return false;
+// Check the intersection constraint along the axes waiting in the
+// SATCheck check with the kernel of the FrameCPUPath path, and empty
+// the group of axes
+static inline bool SATCheckAxes(
+  SATCheck* const check,
+  int* const iAxisSep,
+  const FrameCPUPath path) {
+
+  switch (path) {
+
+    case FrameCPUSSE2:
+      return
+        SATCheckAxesSSE2(
+          check,
+          iAxisSep);
+    case FrameCPUAVX2:
+      return
+        SATCheckAxesAVX2(
+          check,
+          iAxisSep);
+    case FrameCPUAVX512:
+      return
+        SATCheckAxesAVX512(
+          check,
+          iAxisSep);
+    default:
+      return
+        SATCheckAxesGeneric(
+          check,
+          iAxisSep);
 
   }
 
-  // If we reaches here the two Frames are in intersection
-  return true;
-
 }
 
-// Check the intersection constraint for Frames that and tho,
-// both faces, relatively to axis
-bool CheckAxis3DFace(
-  const Frame3D* const that,
-  const Frame3D* const tho,
-  const double* const axis) {
+// Check the intersection constraint for 2D Frames that and tho
+// relatively to the normal of edge
+static bool CheckAxis2D(
+  const Frame2D* const that,
+  const Frame2D* const tho,
+  const FMB_REAL* const edge) {
 
   // Declare variables to memorize the boundaries of projection
   // of the two frames on the current edge
-  double bdgBoxA[2];
-  double bdgBoxB[2];
+  FMB_REAL bdgBoxA[2];
+  FMB_REAL bdgBoxB[2];
 
   // Declare two variables to loop on Frames and commonalize code
-  const Frame3D* frame = that;
-  double* bdgBox = bdgBoxA;
+  const Frame2D* frame = that;
+  FMB_REAL* bdgBox = bdgBoxA;
 
   // Loop on Frames
   for (
@@ -1368,9 +3063,9 @@ bool CheckAxis3DFace(
     iFrame--;) {
 
     // Shortcuts
-    const double* frameOrig = frame->orig;
-    const double* frameCompA = frame->comp[0];
-    const double* frameCompB = frame->comp[1];
+    const FMB_REAL* frameOrig = frame->orig;
+    const FMB_REAL* frameCompA = frame->comp[0];
+    const FMB_REAL* frameCompB = frame->comp[1];
     FrameType frameType = frame->type;
 
     // Get the number of vertices of frame
@@ -1386,40 +3081,32 @@ bool CheckAxis3DFace(
       iVertex--;) {
 
       // Get the vertex
-      double vertex[3];
+      FMB_REAL vertex[2];
       vertex[0] = frameOrig[0];
       vertex[1] = frameOrig[1];
-      vertex[2] = frameOrig[2];
       switch (iVertex) {
 
         case 3:
-          vertex[0] +=
-            frameCompA[0] +  frameCompB[0];
-          vertex[1] +=
-            frameCompA[1] +  frameCompB[1];
-          vertex[2] +=
-            frameCompA[2] +  frameCompB[2];
+          vertex[0] += frameCompA[0] + frameCompB[0];
+          vertex[1] += frameCompA[1] + frameCompB[1];
           break;
         case 2:
-          vertex[0] += frameCompB[0];
-          vertex[1] += frameCompB[1];
-          vertex[2] += frameCompB[2];
-          break;
-        case 1:
           vertex[0] += frameCompA[0];
           vertex[1] += frameCompA[1];
-          vertex[2] += frameCompA[2];
+          break;
+        case 1:
+          vertex[0] += frameCompB[0];
+          vertex[1] += frameCompB[1];
           break;
         default:
           break;
 
       }
 
-      // Get the projection of the vertex on the axis
-      double proj =
-        vertex[0] * axis[0] +
-        vertex[1] * axis[1] +
-        vertex[2] * axis[2];
+      // Get the projection of the vertex on the normal of the edge
+      // Orientation of the normal doesn't matter, so we
+      // use arbitrarily the normal (edge[1], -edge[0])
+      FMB_REAL proj = vertex[0] * edge[1] - vertex[1] * edge[0];
 
       // If it's the first vertex
       if (firstVertex == true) {
@@ -1476,22 +3163,22 @@ bool CheckAxis3DFace(
 
 }
 
-// Check the intersection constraint for Frames that and tho
-// relatively to axis
-bool CheckAxis3DTime(
-  const Frame3DTime* const that,
-  const Frame3DTime* const tho,
-  const double* const axis,
-  const double* const relSpeed) {
+// Check the intersection constraint for moving 2D Frames that and tho
+// relatively to the normal of edge
+static bool CheckAxis2DTime(
+  const Frame2DTime* const that,
+  const Frame2DTime* const tho,
+  const FMB_REAL* const edge,
+  const FMB_REAL* const relSpeed) {
 
   // Declare variables to memorize the boundaries of projection
   // of the two frames on the current edge
-  double bdgBoxA[2];
-  double bdgBoxB[2];
+  FMB_REAL bdgBoxA[2];
+  FMB_REAL bdgBoxB[2];
 
   // Declare two variables to loop on Frames and commonalize code
-  const Frame3DTime* frame = that;
-  double* bdgBox = bdgBoxA;
+  const Frame2DTime* frame = that;
+  FMB_REAL* bdgBox = bdgBoxA;
 
   // Loop on Frames
   for (
@@ -1499,14 +3186,13 @@ bool CheckAxis3DTime(
     iFrame--;) {
 
     // Shortcuts
-    const double* frameOrig = frame->orig;
-    const double* frameCompA = frame->comp[0];
-    const double* frameCompB = frame->comp[1];
-    const double* frameCompC = frame->comp[2];
+    const FMB_REAL* frameOrig = frame->orig;
+    const FMB_REAL* frameCompA = frame->comp[0];
+    const FMB_REAL* frameCompB = frame->comp[1];
     FrameType frameType = frame->type;
 
     // Get the number of vertices of frame
-    int nbVertices = (frameType == FrameTetrahedron ? 4 : 8);
+    int nbVertices = (frameType == FrameTetrahedron ? 3 : 4);
 
     // Declare a variable to memorize if the current vertex is
     // the first in the loop, used to initialize the boundaries
@@ -1518,60 +3204,30 @@ bool CheckAxis3DTime(
       iVertex--;) {
 
       // Get the vertex
-      double vertex[3];
+      FMB_REAL vertex[2];
       vertex[0] = frameOrig[0];
       vertex[1] = frameOrig[1];
-      vertex[2] = frameOrig[2];
       switch (iVertex) {
 
-        case 7:
-          vertex[0] +=
-            frameCompA[0] +  frameCompB[0] + frameCompC[0];
-          vertex[1] +=
-            frameCompA[1] +  frameCompB[1] + frameCompC[1];
-          vertex[2] +=
-            frameCompA[2] +  frameCompB[2] + frameCompC[2];
-          break;
-        case 6:
-          vertex[0] += frameCompB[0] + frameCompC[0];
-          vertex[1] += frameCompB[1] + frameCompC[1];
-          vertex[2] += frameCompB[2] + frameCompC[2];
-          break;
-        case 5:
-          vertex[0] += frameCompA[0] + frameCompC[0];
-          vertex[1] += frameCompA[1] + frameCompC[1];
-          vertex[2] += frameCompA[2] + frameCompC[2];
-          break;
-        case 4:
+        case 3:
           vertex[0] += frameCompA[0] + frameCompB[0];
           vertex[1] += frameCompA[1] + frameCompB[1];
-          vertex[2] += frameCompA[2] + frameCompB[2];
-          break;
-        case 3:
-          vertex[0] += frameCompC[0];
-          vertex[1] += frameCompC[1];
-          vertex[2] += frameCompC[2];
           break;
         case 2:
-          vertex[0] += frameCompB[0];
-          vertex[1] += frameCompB[1];
-          vertex[2] += frameCompB[2];
-          break;
-        case 1:
           vertex[0] += frameCompA[0];
           vertex[1] += frameCompA[1];
-          vertex[2] += frameCompA[2];
+          break;
+        case 1:
+          vertex[0] += frameCompB[0];
+          vertex[1] += frameCompB[1];
           break;
         default:
           break;
 
       }
 
-      // Get the projection of the vertex on the axis
-      double proj =
-        vertex[0] * axis[0] +
-        vertex[1] * axis[1] +
-        vertex[2] * axis[2];
+      // Get the projection of the vertex on the normal of the edge
+      FMB_REAL proj = vertex[0] * edge[1] - vertex[1] * edge[0];
 
       // If it's the first vertex
       if (firstVertex == true) {
@@ -1609,12 +3265,8 @@ bool CheckAxis3DTime(
         // Check also the vertices moved by the relative speed
         vertex[0] += relSpeed[0];
         vertex[1] += relSpeed[1];
-        vertex[2] += relSpeed[2];
 
-        proj =
-          vertex[0] * axis[0] +
-          vertex[1] * axis[1] +
-          vertex[2] * axis[2];
+        proj = vertex[0] * edge[1] - vertex[1] * edge[0];
 
         if (bdgBox[0] > proj) {
 
@@ -1654,3 +3306,352 @@ bool CheckAxis3DTime(
   return true;
 
 }
+
+// Check the intersection constraint for 2D Frames that and tho
+// relatively to the normals of the edges selected by axes
+// Return false if one of them separates the Frames, else true
+static bool SATCheckFaces2DGeneric(
+  const Frame2D* const that,
+  const Frame2D* const tho,
+  const unsigned int axes) {
+
+  // Declare a variable to loop on Frames and commonalize code
+  const Frame2D* frame = that;
+
+  // Loop on that's edges and then tho's edges
+  for (
+    int iFrame = 0;
+    iFrame < 2;
+    ++iFrame) {
+
+    // Get the third edge, used only by tetrahedrons
+    FMB_REAL thirdEdge[2];
+    thirdEdge[0] = frame->comp[1][0] - frame->comp[0][0];
+    thirdEdge[1] = frame->comp[1][1] - frame->comp[0][1];
+
+    // Loop on the frame's edges
+    int nbEdges = (frame->type == FrameTetrahedron ? 3 : 2);
+    for (
+      int iEdge = 0;
+      iEdge < nbEdges;
+      ++iEdge) {
+
+      // If the edge is selected and its normal separates the Frames
+      if (
+        ((axes >> (4 * iFrame + iEdge)) & 1u) != 0 &&
+        CheckAxis2D(
+          that,
+          tho,
+          (iEdge == 2 ? thirdEdge : frame->comp[iEdge])) == false) {
+
+        // The Frames are not in intersection
+        return false;
+
+      }
+
+    }
+
+    // Switch the frame to check the edges of the second Frame
+    frame = tho;
+
+  }
+
+  // If we reaches here none of the axes separates the Frames
+  return true;
+
+}
+
+// Check the intersection constraint relatively to the normals of the
+// faces selected by axes with the current implementation
+// (cf FrameGetCPUPath)
+bool SATCheckFaces2D(
+  const Frame2D* const that,
+  const Frame2D* const tho,
+  const unsigned int axes) {
+
+  return
+    satCheckFaces2DCPU[FrameGetCPUPath()](
+      that,
+      tho,
+      axes);
+
+}
+
+// Check the intersection constraint for moving 2D Frames that and tho
+// relatively to the normals of the edges selected by axes
+// Return false if one of them separates the Frames, else true
+static bool SATCheckFaces2DTimeGeneric(
+  const Frame2DTime* const that,
+  const Frame2DTime* const tho,
+  const unsigned int axes) {
+
+  // Get the speed of tho relative to that
+  FMB_REAL relSpeed[2];
+  relSpeed[0] = tho->speed[0] - that->speed[0];
+  relSpeed[1] = tho->speed[1] - that->speed[1];
+
+  // Declare a variable to loop on Frames and commonalize code
+  const Frame2DTime* frame = that;
+
+  // Loop on that's edges and then tho's edges
+  for (
+    int iFrame = 0;
+    iFrame < 2;
+    ++iFrame) {
+
+    // Get the third edge, used only by tetrahedrons
+    FMB_REAL thirdEdge[2];
+    thirdEdge[0] = frame->comp[1][0] - frame->comp[0][0];
+    thirdEdge[1] = frame->comp[1][1] - frame->comp[0][1];
+
+    // Loop on the frame's edges
+    int nbEdges = (frame->type == FrameTetrahedron ? 3 : 2);
+    for (
+      int iEdge = 0;
+      iEdge < nbEdges;
+      ++iEdge) {
+
+      // If the edge is selected and its normal separates the Frames
+      if (
+        ((axes >> (4 * iFrame + iEdge)) & 1u) != 0 &&
+        CheckAxis2DTime(
+          that,
+          tho,
+          (iEdge == 2 ? thirdEdge : frame->comp[iEdge]),
+          relSpeed) == false) {
+
+        // The Frames are not in intersection
+        return false;
+
+      }
+
+    }
+
+    // Switch the frame to check the edges of the second Frame
+    frame = tho;
+
+  }
+
+  // If we reaches here none of the axes separates the Frames
+  return true;
+
+}
+
+// Check the intersection constraint relatively to the normals of the
+// faces selected by axes with the current implementation
+// (cf FrameGetCPUPath)
+bool SATCheckFaces2DTime(
+  const Frame2DTime* const that,
+  const Frame2DTime* const tho,
+  const unsigned int axes) {
+
+  return
+    satCheckFaces2DTimeCPU[FrameGetCPUPath()](
+      that,
+      tho,
+      axes);
+
+}
+
+// Get the normal to the iFace-th face of a 3D Frame of type type and
+// components comp into normal, as in SATTestIntersection3D
+// Return false if the face doesn't exist for this type
+static inline bool SATGetFaceNormal3D(
+  const FrameType type,
+  const FMB_REAL (*comp)[3],
+  const int iFace,
+  FMB_REAL* const normal) {
+
+  // Declare variables to memorize the two edges of the face, and
+  // buffers for the opposite edges of tetrahedron
+  const FMB_REAL* u = NULL;
+  const FMB_REAL* v = NULL;
+  FMB_REAL oppEdgeA[3];
+  FMB_REAL oppEdgeB[3];
+
+  // Get the two edges of the face
+  if (iFace == 0) {
+
+    u = comp[0];
+    v = comp[1];
+
+  } else if (iFace == 1) {
+
+    u = comp[0];
+    v = comp[2];
+
+  } else if (iFace == 2) {
+
+    u = comp[2];
+    v = comp[1];
+
+  } else if (type == FrameTetrahedron) {
+
+    for (
+      int i = 3;
+      i--;) {
+
+      oppEdgeA[i] = comp[1][i] - comp[0][i];
+      oppEdgeB[i] = comp[1][i] - comp[2][i];
+
+    }
+
+    u = oppEdgeA;
+    v = oppEdgeB;
+
+  } else {
+
+    // The face doesn't exist
+    return false;
+
+  }
+
+  // Get the cross product of the two edges
+  normal[0] = u[1] * v[2] - u[2] * v[1];
+  normal[1] = u[2] * v[0] - u[0] * v[2];
+  normal[2] = u[0] * v[1] - u[1] * v[0];
+
+  return true;
+
+}
+
+// Check the intersection constraint for 3D Frames that and tho
+// relatively to the normals of the faces selected by axes
+// Return false if one of them separates the Frames, else true
+static bool SATCheckFaces3DGeneric(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  const unsigned int axes) {
+
+  // Loop on the selected faces of that and then tho
+  for (
+    int iAxis = 0;
+    iAxis < 8;
+    ++iAxis) {
+
+    // If the face is not selected, skip it
+    if (((axes >> iAxis) & 1u) == 0) {
+
+      continue;
+
+    }
+
+    // Get the normal to the face
+    const Frame3D* frame = (iAxis < 4 ? that : tho);
+    FMB_REAL normal[3];
+    bool isFace =
+      SATGetFaceNormal3D(
+        frame->type,
+        frame->comp,
+        iAxis % 4,
+        normal);
+
+    // If the face exists and its normal separates the Frames
+    if (
+      isFace == true &&
+      CheckAxis3D(
+        that,
+        tho,
+        normal) == false) {
+
+      // The Frames are not in intersection
+      return false;
+
+    }
+
+  }
+
+  // If we reaches here none of the axes separates the Frames
+  return true;
+
+}
+
+// Check the intersection constraint relatively to the normals of the
+// faces selected by axes with the current implementation
+// (cf FrameGetCPUPath)
+bool SATCheckFaces3D(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  const unsigned int axes) {
+
+  return
+    satCheckFaces3DCPU[FrameGetCPUPath()](
+      that,
+      tho,
+      axes);
+
+}
+
+// Check the intersection constraint for moving 3D Frames that and tho
+// relatively to the normals of the faces selected by axes
+// Return false if one of them separates the Frames, else true
+static bool SATCheckFaces3DTimeGeneric(
+  const Frame3DTime* const that,
+  const Frame3DTime* const tho,
+  const unsigned int axes) {
+
+  // Get the speed of tho relative to that
+  FMB_REAL relSpeed[3];
+  relSpeed[0] = tho->speed[0] - that->speed[0];
+  relSpeed[1] = tho->speed[1] - that->speed[1];
+  relSpeed[2] = tho->speed[2] - that->speed[2];
+
+  // Loop on the selected faces of that and then tho
+  for (
+    int iAxis = 0;
+    iAxis < 8;
+    ++iAxis) {
+
+    // If the face is not selected, skip it
+    if (((axes >> iAxis) & 1u) == 0) {
+
+      continue;
+
+    }
+
+    // Get the normal to the face
+    const Frame3DTime* frame = (iAxis < 4 ? that : tho);
+    FMB_REAL normal[3];
+    bool isFace =
+      SATGetFaceNormal3D(
+        frame->type,
+        frame->comp,
+        iAxis % 4,
+        normal);
+
+    // If the face exists and its normal separates the Frames
+    if (
+      isFace == true &&
+      CheckAxis3DTime(
+        that,
+        tho,
+        normal,
+        relSpeed) == false) {
+
+      // The Frames are not in intersection
+      return false;
+
+    }
+
+  }
+
+  // If we reaches here none of the axes separates the Frames
+  return true;
+
+}
+
+// Check the intersection constraint relatively to the normals of the
+// faces selected by axes with the current implementation
+// (cf FrameGetCPUPath)
+bool SATCheckFaces3DTime(
+  const Frame3DTime* const that,
+  const Frame3DTime* const tho,
+  const unsigned int axes) {
+
+  return
+    satCheckFaces3DTimeCPU[FrameGetCPUPath()](
+      that,
+      tho,
+      axes);
+
+}
@@ -24,8 +24,75 @@
 #include <string.h>
 #include "frame.h"
 
+// ------------- Enumerations -------------
+
+// Implementation of the projection of the vertices of the Frames on
+// the axes in SATTestIntersection3D, SATTestIntersection3DTime and
+// SATTestIntersection3DFace
+// SATCheckModeScalar: the vertices are computed and projected one by
+// one for each axis
+// SATCheckModeSIMD: the vertices are computed once per test and
+// projected on each axis by Frame3DSoASIMDWidth() at once, the width
+// of the vectors of the current FrameCPUPath (cf frame.h)
+// SATCheckModeSIMDAxes: the vertices are computed once per test and
+// each one is projected on Frame3DSoASIMDWidth() axes at once, the
+// axes being checked by groups of Frame3DSoASIMDWidth()
+// All give identical results
+typedef enum {
+
+  SATCheckModeScalar,
+  SATCheckModeSIMD,
+  SATCheckModeSIMDAxes
+
+} SATCheckMode;
+
+// ------------- Data structures -------------
+
+// Geometry of a 3D Frame used by the SAT intersection test, computed
+// once per Frame by SATFrame3DCreate and reused by
+// SATTestIntersection3DPrecomputed for all the pairs the Frame is
+// tested in
+typedef struct {
+
+  // Type of the Frame
+  FrameType type;
+
+  // Nb of vertices, faces and edges (8, 3 and 3 for a cuboid, 4, 4
+  // and 6 for a tetrahedron)
+  int nbVertex;
+  int nbFace;
+  int nbEdge;
+
+  // Vertices, [iVertex][iAxis]
+  FMB_REAL vertices[8][3];
+
+  // Normals to the faces, not normalized, [iFace][iAxis]
+  FMB_REAL normFaces[4][3];
+
+  // Edges, the components of the Frame and, for a tetrahedron, the
+  // opposite edges, [iEdge][iAxis]
+  FMB_REAL edges[6][3];
+
+} SATFrame3D;
+
 // ------------- Functions declaration -------------
 
+// Set the implementation of the projection of the vertices on the
+// axes used by the SAT intersection tests of 3D Frames
+// The default one is SAT_CHECK_MODE, SATCheckModeSIMD unless defined
+// otherwise at compilation (for example
+// -DSAT_CHECK_MODE=SATCheckModeScalar)
+// On random pairs (cf QualifySATCheck3D) SATCheckModeSIMD takes
+// about 0.45 times the time of SATCheckModeScalar for pairs of cuboids
+// and 0.53 times for pairs of tetrahedrons on the development machine
+// (SSE2, double), SATCheckModeSIMDAxes being slightly slower than
+// SATCheckModeSIMD
+void SATSetCheckMode(const SATCheckMode mode);
+
+// Get the implementation of the projection of the vertices on the
+// axes currently used by the SAT intersection tests
+SATCheckMode SATGetCheckMode(void);
+
 // Test for intersection between 2D Frame that and 2D Frame tho
 // Return true if the two Frames are intersecting, else false
 bool SATTestIntersection2D(
@@ -45,6 +112,34 @@ bool SATTestIntersection3D(
   const Frame3D* const that,
   const Frame3D* const tho);
 
+// Create the geometry used by the SAT intersection test of the 3D
+// Frame frame
+// The SATFrame3D must be created again if the Frame is modified
+SATFrame3D SATFrame3DCreate(const Frame3D* const frame);
+
+// Test for intersection between the 3D Frames whose geometries are
+// that and tho (cf SATFrame3DCreate)
+// Return true if the two Frames are intersecting, else false, as
+// SATTestIntersection3D (the results are identical), without
+// computing again the vertices, normals and edges of the Frames
+bool SATTestIntersection3DPrecomputed(
+  const SATFrame3D* const that,
+  const SATFrame3D* const tho);
+
+// Test for intersection between 3D Frame that and 3D Frame tho,
+// using the FMBPairCache cache to memorize the separating axis of the
+// pair, identified by idThat and idTho, from one test to the next
+// Return true if the two Frames are intersecting, else false, as
+// SATTestIntersection3D
+// If the axis which separated the Frames at the last test still
+// separates them, only this axis is checked
+bool SATTestIntersection3DCached(
+  const Frame3D* const that,
+  const Frame3D* const tho,
+  FMBPairCache* const cache,
+  const unsigned long idThat,
+  const unsigned long idTho);
+
 // Test for intersection between moving 3D Frame that and 3D
 // Frame tho
 // Return true if the two Frames are intersecting, else false
@@ -59,11 +154,42 @@ bool SATTestIntersection3DFace(
   const Frame3D* const that,
   const Frame3D* const tho);
 
-// Check the intersection constraint for Frames that and tho,
-// both faces, relatively to axis
-bool CheckAxis3DFace(
+// Check the intersection constraint for 2D Frames that and tho
+// relatively to the normals of the edges selected by axes (cf
+// FMB_HYBRID_AXES_ALL in frame.h): comp[0], comp[1], and
+// comp[1] - comp[0] for a tetrahedron
+// Return false if one of them separates the Frames, else true
+bool SATCheckFaces2D(
+  const Frame2D* const that,
+  const Frame2D* const tho,
+  const unsigned int axes);
+
+// Check the intersection constraint for moving 2D Frames that and tho
+// relatively to the normals of the edges selected by axes, as
+// SATCheckFaces2D
+bool SATCheckFaces2DTime(
+  const Frame2DTime* const that,
+  const Frame2DTime* const tho,
+  const unsigned int axes);
+
+// Check the intersection constraint for 3D Frames that and tho
+// relatively to the normals of the faces selected by axes (cf
+// FMB_HYBRID_AXES_ALL in frame.h): comp[0] x comp[1],
+// comp[0] x comp[2], comp[2] x comp[1], and for a tetrahedron
+// (comp[1] - comp[0]) x (comp[1] - comp[2]), the same axes as in
+// SATTestIntersection3D
+// Return false if one of them separates the Frames, else true
+bool SATCheckFaces3D(
   const Frame3D* const that,
   const Frame3D* const tho,
-  const double* const axis);
+  const unsigned int axes);
+
+// Check the intersection constraint for moving 3D Frames that and tho
+// relatively to the normals of the faces selected by axes, as
+// SATCheckFaces3D
+bool SATCheckFaces3DTime(
+  const Frame3DTime* const that,
+  const Frame3DTime* const tho,
+  const unsigned int axes);
 
 #endif
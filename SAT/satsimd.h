@@ -0,0 +1,311 @@
+/*
+    FMB algorithm implementation to perform intersection detection of pairs of static/dynamic cuboid/tetrahedron in 2D/3D by using the Fourier-Motzkin elimination method
+    Copyright (C) 2020  Pascal Baillehache bayashipascal@gmail.com
+    https://github.com/BayashiPascal/FMB
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// Template of SATCheckAxes and SATCheckAxis for the FrameCPUPath
+// selected by FRAME_SIMD_PATH, included once per path by sat.c (cf
+// framesimd.h)
+
+// ------------- Includes -------------
+
+#include "framesimd.h"
+
+// ------------- Functions implementation -------------
+
+// Check the intersection constraint along the axes waiting in the
+// SATCheck check, and empty the group of axes
+// Each vertex is projected on all the axes at once, in the same order
+// of operations as CheckAxis3D
+// Return false if an axis separates the Frames and store the index of
+// the first one in iAxisSep, else true
+FRAME_SIMD_TARGET static inline bool FRAME_SIMD_NAME(SATCheckAxes)(
+  SATCheck* const check,
+  int* const iAxisSep) {
+
+  // If there is no axis, nothing to check
+  int nbAxis = check->nbAxis;
+  if (nbAxis == 0) {
+
+    return true;
+
+  }
+
+  // Empty the group
+  check->nbAxis = 0;
+
+  // Pad the group with the first axis
+  for (
+    int iLane = nbAxis;
+    iLane < FRAME_SIMD_WIDTH;
+    ++iLane) {
+
+    for (
+      int i = 3;
+      i--;) {
+
+      check->axes[i][iLane] = check->axes[i][0];
+
+    }
+
+  }
+
+  // Load the axes
+  const FrameSIMD axisVec[3] = {
+
+    FrameSIMDLoad(check->axes[0]),
+    FrameSIMDLoad(check->axes[1]),
+    FrameSIMDLoad(check->axes[2])
+
+  };
+
+  // Declare variables to memorize the boundaries of projection of the
+  // two Frames on each axis, [iFrame]
+  FrameSIMD minVec[2];
+  FrameSIMD maxVec[2];
+
+  // Loop on Frames
+  for (
+    int iFrame = 2;
+    iFrame--;) {
+
+    // Shortcut
+    const FMB_REAL (*vertices)[SAT_NB_VERTEX_MAX] = check->vertices[iFrame];
+
+    // Loop on the vertices
+    for (
+      int iVertex = 0;
+      iVertex < check->nbVertex[iFrame];
+      ++iVertex) {
+
+      // Project the vertex on the axes
+      FrameSIMD proj =
+        FrameSIMDAdd(
+          FrameSIMDAdd(
+            FrameSIMDMul(
+              FrameSIMDSet1(vertices[0][iVertex]),
+              axisVec[0]),
+            FrameSIMDMul(
+              FrameSIMDSet1(vertices[1][iVertex]),
+              axisVec[1])),
+          FrameSIMDMul(
+            FrameSIMDSet1(vertices[2][iVertex]),
+            axisVec[2]));
+      if (iVertex == 0) {
+
+        minVec[iFrame] = proj;
+        maxVec[iFrame] = proj;
+
+      } else {
+
+        minVec[iFrame] = FrameSIMDMin(minVec[iFrame], proj);
+        maxVec[iFrame] = FrameSIMDMax(maxVec[iFrame], proj);
+
+      }
+
+    }
+
+  }
+
+  // If none of the axes separates the Frames
+  if (
+    FrameSIMDAnyLt(maxVec[1], minVec[0]) == false &&
+    FrameSIMDAnyLt(maxVec[0], minVec[1]) == false) {
+
+    return true;
+
+  }
+
+  // Search the first separating axis
+  _Alignas(FRAME_SOA_ALIGN) FMB_REAL bdgBox[2][2][FRAME_SIMD_WIDTH];
+  for (
+    int iFrame = 2;
+    iFrame--;) {
+
+    FrameSIMDStore(bdgBox[iFrame][0], minVec[iFrame]);
+    FrameSIMDStore(bdgBox[iFrame][1], maxVec[iFrame]);
+
+  }
+
+  for (
+    int iLane = 0;
+    iLane < nbAxis;
+    ++iLane) {
+
+    if (
+      bdgBox[1][1][iLane] < bdgBox[0][0][iLane] ||
+      bdgBox[0][1][iLane] < bdgBox[1][0][iLane]) {
+
+      *iAxisSep = check->iAxes[iLane];
+      break;
+
+    }
+
+  }
+
+  return false;
+
+}
+
+// Check the intersection constraint along axis, the iAxis-th axis of
+// the test, for the vertices of the SATCheck check with the vectorized
+// implementation mode (cf SATCheckMode)
+// Return false if an axis separates the Frames and store its index in
+// iAxisSep, else true. With SATCheckModeSIMDAxes the axis may only be
+// added to the group of axes waiting to be checked, and the separating
+// axis may be a previous one (cf SATCheckAxes)
+FRAME_SIMD_TARGET static inline bool FRAME_SIMD_NAME(SATCheckAxis)(
+  SATCheck* const check,
+  const SATCheckMode mode,
+  const FMB_REAL* const axis,
+  const int iAxis,
+  int* const iAxisSep) {
+
+  // If the axes are checked by groups
+  if (mode == SATCheckModeSIMDAxes) {
+
+    // Add the axis to the group
+    int iLane = check->nbAxis;
+    for (
+      int i = 3;
+      i--;) {
+
+      check->axes[i][iLane] = axis[i];
+
+    }
+
+    check->iAxes[iLane] = iAxis;
+    ++(check->nbAxis);
+
+    // If the group is full, check it
+    if (check->nbAxis == FRAME_SIMD_WIDTH) {
+
+      return
+        FRAME_SIMD_NAME(SATCheckAxes)(
+          check,
+          iAxisSep);
+
+    }
+
+    return true;
+
+  }
+
+  // Declare variables to memorize the boundaries of projection
+  // of the two frames on the axis, [iFrame][min/max]
+  _Alignas(FRAME_SOA_ALIGN) FMB_REAL bdgMin[FRAME_SIMD_WIDTH];
+  _Alignas(FRAME_SOA_ALIGN) FMB_REAL bdgMax[FRAME_SIMD_WIDTH];
+  FMB_REAL bdgBox[2][2];
+
+  // Broadcast the axis
+  const FrameSIMD axisVec[3] = {
+
+    FrameSIMDSet1(axis[0]),
+    FrameSIMDSet1(axis[1]),
+    FrameSIMDSet1(axis[2])
+
+  };
+
+  // Loop on Frames
+  for (
+    int iFrame = 2;
+    iFrame--;) {
+
+    // Shortcut
+    const FMB_REAL (*vertices)[SAT_NB_VERTEX_MAX] = check->vertices[iFrame];
+
+    // Project the vertices by groups of FRAME_SIMD_WIDTH, in the
+    // same order of operations as CheckAxis3D
+    FrameSIMD minVec = FrameSIMDZero();
+    FrameSIMD maxVec = FrameSIMDZero();
+    for (
+      int iVertex = 0;
+      iVertex < check->nbVertexPad[iFrame];
+      iVertex += FRAME_SIMD_WIDTH) {
+
+      FrameSIMD proj =
+        FrameSIMDAdd(
+          FrameSIMDAdd(
+            FrameSIMDMul(
+              FrameSIMDLoad(vertices[0] + iVertex),
+              axisVec[0]),
+            FrameSIMDMul(
+              FrameSIMDLoad(vertices[1] + iVertex),
+              axisVec[1])),
+          FrameSIMDMul(
+            FrameSIMDLoad(vertices[2] + iVertex),
+            axisVec[2]));
+      if (iVertex == 0) {
+
+        minVec = proj;
+        maxVec = proj;
+
+      } else {
+
+        minVec = FrameSIMDMin(minVec, proj);
+        maxVec = FrameSIMDMax(maxVec, proj);
+
+      }
+
+    }
+
+    // Get the boundaries over the lanes
+    FrameSIMDStore(bdgMin, minVec);
+    FrameSIMDStore(bdgMax, maxVec);
+    bdgBox[iFrame][0] = bdgMin[0];
+    bdgBox[iFrame][1] = bdgMax[0];
+    for (
+      int iLane = 1;
+      iLane < FRAME_SIMD_WIDTH;
+      ++iLane) {
+
+      if (bdgBox[iFrame][0] > bdgMin[iLane]) {
+
+        bdgBox[iFrame][0] = bdgMin[iLane];
+
+      }
+
+      if (bdgBox[iFrame][1] < bdgMax[iLane]) {
+
+        bdgBox[iFrame][1] = bdgMax[iLane];
+
+      }
+
+    }
+
+  }
+
+  // If the projections of the two frames on the axis are
+  // not intersecting
+  if (
+    bdgBox[1][1] < bdgBox[0][0] ||
+    bdgBox[0][1] < bdgBox[1][0]) {
+
+    // The axis separates the Frames
+    *iAxisSep = iAxis;
+    return false;
+
+  }
+
+  // If we reaches here the two Frames are in intersection
+  return true;
+
+}
+
+// ------------- Macros -------------
+
+#undef FRAME_SIMD_PATH